@@ -130,6 +130,10 @@ android {
                         "-DENABLE_LTO=ON",
                         "-DCMAKE_BUILD_TYPE=Release"
                     )
+                    // Profiles of src/main/cpp/vibrafp/scripts/pgo.sh, one per ABI
+                    (project.findProperty("vibraPgoDir") as String?)?.let { pgoDir ->
+                        arguments += listOf("-DVIBRA_PGO=USE", "-DVIBRA_PGO_DIR=${file(pgoDir).absolutePath}")
+                    }
                 }
             }
             ndk {
@@ -148,7 +152,8 @@ android {
                 cmake {
                     arguments += listOf(
                         "-DENABLE_LTO=OFF",
-                        "-DCMAKE_BUILD_TYPE=Debug"
+                        "-DCMAKE_BUILD_TYPE=Debug",
+                        "-DVIBRA_TRACING=ON"
                     )
                 }
             }
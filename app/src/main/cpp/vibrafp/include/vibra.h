@@ -3,8 +3,46 @@
 
 #include <string>
 
+/**
+ * @brief Number of values in a signature digest, see vibra_signature_get_digest().
+ */
+#define VIBRA_DIGEST_SIZE 32
+
+/*
+ * Thread safety: every function may be called from several threads at once, as long
+ * as each object (Fingerprint, VibraSession, VibraSignature, ...) is used by one
+ * thread at a time, unless its documentation says otherwise. Calls share no mutable
+ * state but the FFT plans, which are made once per process under a lock. The global
+ * settings, vibra_set_stats_enabled() and vibra_set_force_scalar(), may be changed
+ * at any time; the tracing ones may not while fingerprints are being computed.
+ */
+
 extern "C"
 {
+/**
+ * @brief Where the time and memory of a fingerprint computation went, see
+ * vibra_set_stats_enabled().
+ *
+ * The stage times add up to about total_ms. The memory figures are those of the
+ * whole process, so work done on other threads at the same time is included.
+ */
+struct VibraStats
+{
+    double wav_parse_ms;   /**< WAV header parsing, 0 for PCM input. */
+    double downsample_ms;  /**< Downmix and resampling to 16 kHz mono. */
+    double fft_ms;         /**< Windowing and FFT of each 128 sample hop. */
+    double spreading_ms;   /**< Spreading of the spectra over time and frequency. */
+    double recognition_ms; /**< Peak detection. */
+    double encode_ms;      /**< Encoding of the signature URI. */
+    double total_ms;       /**< The library calls doing the work. */
+    unsigned long long frames_processed; /**< Input frames, before downsampling. */
+    unsigned int peaks_per_band[4];      /**< Peaks found per VibraFrequencyBand 0 to 3. */
+    /** Heap bytes in use at the peak above those at the start, 0 if unknown. */
+    unsigned long long heap_high_water_bytes;
+    /** High-water mark of the process resident set, 0 if unknown. */
+    unsigned long long max_resident_bytes;
+};
+
 /**
  * @brief Structure to hold a music fingerprint.
  *
@@ -15,8 +53,78 @@ struct Fingerprint
 {
     std::string uri;        /**< The URI associated with the fingerprint. */
     unsigned int sample_ms; /**< The sample duration in milliseconds. */
+    unsigned long long digest[VIBRA_DIGEST_SIZE]; /**< See vibra_signature_get_digest(). */
+    int has_stats;    /**< Non-zero if stats were collected, see vibra_set_stats_enabled(). */
+    VibraStats stats; /**< See vibra_get_stats_from_fingerprint(). */
 };
 
+/**
+ * @brief Collect a VibraStats for every fingerprint computed from now on.
+ *
+ * Disabled by default, when the only cost left is a branch per pipeline stage.
+ * Applies to the computations started after the call, from any thread.
+ *
+ * @param enabled Non-zero to collect stats.
+ */
+void vibra_set_stats_enabled(int enabled);
+
+/**
+ * @brief Use the portable kernels instead of the vectorized ones picked for the CPU.
+ *
+ * Both give the same fingerprints, this is for checking that on a device and for
+ * measuring the difference. Also set at startup by the VIBRA_FORCE_SCALAR environment
+ * variable. Applies to the computations started after the call, from any thread.
+ *
+ * @param forced Non-zero for the portable kernels.
+ */
+void vibra_set_force_scalar(int forced);
+
+/**
+ * @brief The instruction set extensions detected on this CPU, e.g. "neon crc32 pmull".
+ *
+ * @return const char* A static string, whether or not vibra_set_force_scalar() is on.
+ */
+const char *vibra_get_cpu_features(void);
+
+/**
+ * @brief Receives the trace sections of the pipeline stages, see vibra_trace_set_callback().
+ *
+ * @param name Name of the section, a string literal that stays valid.
+ * @param begin Non-zero when the section starts, zero when it ends.
+ * @param user_data The pointer passed to vibra_trace_set_callback().
+ */
+typedef void (*VibraTraceCallback)(const char *name, int begin, void *user_data);
+
+/**
+ * @brief Call `callback` at the start and end of each pipeline stage.
+ *
+ * Sections of a thread nest and are reported on that thread. On Android they are
+ * also emitted as ATrace sections, for systrace and Perfetto. Replaces the JSON
+ * writer of vibra_trace_start_json(). Must not be called while fingerprints are
+ * being computed.
+ *
+ * @param callback The callback, or NULL to stop.
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the library was built
+ * without VIBRA_TRACING.
+ */
+int vibra_trace_set_callback(VibraTraceCallback callback, void *user_data);
+
+/**
+ * @brief Write the trace sections of all threads to `path` as Chrome trace JSON,
+ * for chrome://tracing or ui.perfetto.dev, until vibra_trace_stop_json().
+ *
+ * Replaces the callback of vibra_trace_set_callback().
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the file cannot be created
+ * or the library was built without VIBRA_TRACING.
+ */
+int vibra_trace_start_json(const char *path);
+
+/**
+ * @brief Complete and close the file of vibra_trace_start_json().
+ */
+void vibra_trace_stop_json(void);
+
 /**
  * @brief Generate a fingerprint from a music file.
  *
@@ -70,6 +178,614 @@ Fingerprint *vibra_get_fingerprint_from_float_pcm(const char *raw_pcm, int pcm_d
                                                   int sample_rate, int sample_width,
                                                   int channel_count);
 
+/**
+ * @brief Status codes returned by vibra_session_step() and vibra_ingestor_feed().
+ */
+enum VibraStatus
+{
+    VIBRA_STATUS_DONE = 0,               /**< The fingerprint is ready. */
+    VIBRA_STATUS_PENDING = 1,            /**< More steps are needed. */
+    VIBRA_STATUS_CANCELLED = -1,         /**< vibra_session_cancel() was called. */
+    VIBRA_STATUS_DEADLINE_EXCEEDED = -2, /**< The session timeout elapsed. */
+    VIBRA_STATUS_ERROR = -3,             /**< See vibra_session_get_error(). */
+    VIBRA_STATUS_DROPPED = -4,           /**< The ingested track fell behind playback. */
+};
+
+/**
+ * @brief Incremental fingerprint computation, see vibra_session_create().
+ */
+struct VibraSession;
+
+/**
+ * @brief Start a fingerprint computation that is driven in bounded steps.
+ *
+ * The PCM data is copied, so the caller may release it right away.
+ *
+ * @param raw_pcm The raw PCM data.
+ * @param pcm_data_size The size of the PCM data in bytes.
+ * @param sample_rate The sample rate of the PCM data.
+ * @param sample_width The sample width (bits per sample) of the PCM data.
+ * @param channel_count The number of channels in the PCM data.
+ * @param is_float Non-zero for IEEE float samples, zero for signed integers.
+ * @return VibraSession* The session, or NULL if the format is invalid or unsupported.
+ *
+ * @note The returned pointer must be freed after use. See vibra_session_free().
+ */
+VibraSession *vibra_session_create(const char *raw_pcm, int pcm_data_size, int sample_rate,
+                                   int sample_width, int channel_count, int is_float);
+
+/**
+ * @brief Like vibra_session_create(), but without copying the PCM data.
+ *
+ * For callers that already hold the whole recording, such as the JNI bindings,
+ * where the copy would double the memory of a session.
+ *
+ * @note raw_pcm must stay valid and unchanged until vibra_session_free().
+ */
+VibraSession *vibra_session_create_borrowed(const char *raw_pcm, int pcm_data_size,
+                                            int sample_rate, int sample_width, int channel_count,
+                                            int is_float);
+
+/**
+ * @brief Make the session fail with VIBRA_STATUS_DEADLINE_EXCEEDED once
+ * timeout_ms milliseconds have passed from now.
+ */
+void vibra_session_set_timeout_ms(VibraSession *session, unsigned int timeout_ms);
+
+/**
+ * @brief Cancel the session.
+ *
+ * Safe to call from any thread while another one is inside vibra_session_step(),
+ * which then returns VIBRA_STATUS_CANCELLED within a few milliseconds.
+ */
+void vibra_session_cancel(VibraSession *session);
+
+/**
+ * @brief Process at most max_frames frames of the input.
+ *
+ * @return int VIBRA_STATUS_PENDING while more work is left, VIBRA_STATUS_DONE once
+ * the fingerprint can be fetched, or a negative VibraStatus on failure.
+ */
+int vibra_session_step(VibraSession *session, int max_frames);
+
+/**
+ * @brief Get the fingerprint of a session that returned VIBRA_STATUS_DONE.
+ *
+ * @return Fingerprint* The fingerprint, or NULL on error. May only be called once.
+ *
+ * @note The returned pointer must be freed after use. See vibra_free_fingerprint().
+ */
+Fingerprint *vibra_session_get_fingerprint(VibraSession *session);
+
+/**
+ * @brief Get the stats of a session created while stats were enabled.
+ *
+ * May be called at any time, the stats cover the steps run so far and, once the
+ * fingerprint was fetched, its encoding.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the session collects none.
+ */
+int vibra_session_get_stats(const VibraSession *session, VibraStats *stats);
+
+/**
+ * @brief Get the message describing the last failure of the session.
+ *
+ * @note The returned pointer should not be freed.
+ */
+const char *vibra_session_get_error(VibraSession *session);
+
+/**
+ * @brief Free a session.
+ *
+ * @param session Pointer to the session.
+ */
+void vibra_session_free(VibraSession *session);
+
+/**
+ * @brief Frequency bands of a signature, see VibraPeak.
+ */
+enum VibraFrequencyBand
+{
+    VIBRA_BAND_0_150 = -1,
+    VIBRA_BAND_250_520 = 0,
+    VIBRA_BAND_520_1450 = 1,
+    VIBRA_BAND_1450_3500 = 2,
+    VIBRA_BAND_3500_5500 = 3,
+};
+
+/**
+ * @brief One spectral peak of a signature.
+ */
+struct VibraPeak
+{
+    int band;                     /**< The VibraFrequencyBand of the peak. */
+    unsigned int fft_pass_number; /**< Position in 128 sample hops from the start. */
+    unsigned int magnitude;       /**< Log-scaled peak magnitude. */
+    unsigned int frequency_bin;   /**< Interpolated FFT bin, in 1/64 bin units. */
+};
+
+/**
+ * @brief A signature decoded from its URI, see vibra_signature_from_uri().
+ */
+struct VibraSignature;
+
+/**
+ * @brief Decode a signature URI such as the one returned by vibra_get_uri_from_fingerprint().
+ *
+ * The data:audio/vnd.shazam.sig;base64, prefix is optional. The header magic numbers,
+ * sizes and CRC are validated.
+ *
+ * @param uri The signature URI.
+ * @param uri_size The length of the URI in bytes.
+ * @return VibraSignature* The decoded signature, or NULL if the URI is malformed.
+ *
+ * @note The returned pointer must be freed after use. See vibra_signature_free().
+ */
+VibraSignature *vibra_signature_from_uri(const char *uri, int uri_size);
+
+/**
+ * @brief Get the duration of the audio a signature was computed from, in milliseconds.
+ */
+unsigned int vibra_signature_get_sample_ms(const VibraSignature *signature);
+
+/**
+ * @brief Get the total number of peaks over all bands of a signature.
+ */
+int vibra_signature_get_peak_count(const VibraSignature *signature);
+
+/**
+ * @brief Copy the peaks of a signature, ordered by band and then by time.
+ *
+ * @param signature Pointer to the signature.
+ * @param peaks Output array.
+ * @param capacity Number of elements peaks can hold.
+ * @return int The number of peaks written, at most capacity.
+ */
+int vibra_signature_get_peaks(const VibraSignature *signature, VibraPeak *peaks, int capacity);
+
+/**
+ * @brief Re-encode a decoded signature.
+ *
+ * @return Fingerprint* The fingerprint, or NULL on error.
+ *
+ * @note The returned pointer must be freed after use. See vibra_free_fingerprint().
+ */
+Fingerprint *vibra_signature_to_fingerprint(const VibraSignature *signature);
+
+/**
+ * @brief Free a decoded signature.
+ *
+ * @param signature Pointer to the signature.
+ */
+void vibra_signature_free(VibraSignature *signature);
+
+/**
+ * @brief How alike two signatures are, see vibra_compare_signatures().
+ */
+struct VibraSimilarity
+{
+    double score;              /**< From 0 for unrelated audio to 1 for identical signatures. */
+    long long offset_us;       /**< Start of b relative to the start of a, in microseconds. */
+    unsigned int matched_peaks; /**< Peaks that line up at that offset. */
+};
+
+/**
+ * @brief Compare two signatures, allowing for a time offset and small frequency jitter.
+ *
+ * Two recordings of the same audio that overlap in time score high even when their
+ * URIs differ. The score only considers the time range both signatures cover.
+ *
+ * @param a The first signature.
+ * @param b The second signature.
+ * @param similarity Receives the score and the offset that aligns b with a.
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the sample rates differ.
+ */
+int vibra_compare_signatures(const VibraSignature *a, const VibraSignature *b,
+                             VibraSimilarity *similarity);
+
+/**
+ * @brief Get the locality-sensitive digest of a signature.
+ *
+ * The digest is a MinHash of the landmarks of the signature: the more landmarks two
+ * signatures share, the more of their digest values are equal, so two recordings of the
+ * same audio get close digests even though their URIs differ. Generated fingerprints
+ * carry the same digest, computed while the audio was analysed.
+ *
+ * @param signature Pointer to the signature.
+ * @param digest Receives VIBRA_DIGEST_SIZE values.
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the signature has too few peaks
+ * to form landmarks, in which case the digest says nothing about the audio.
+ */
+int vibra_signature_get_digest(const VibraSignature *signature, unsigned long long *digest);
+
+/**
+ * @brief Table of signature digests for near-duplicate lookups, see vibra_lsh_table_create().
+ */
+struct VibraLshTable;
+
+/**
+ * @brief Create an empty digest table.
+ *
+ * Lookups cost a fixed number of hash probes whatever the table size. The table is not
+ * thread-safe.
+ *
+ * @note The returned pointer must be freed after use. See vibra_lsh_table_free().
+ */
+VibraLshTable *vibra_lsh_table_create(void);
+
+/**
+ * @brief Add a digest under a caller-defined id, replacing any entry with that id.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if the digest is that of a
+ * signature without landmarks.
+ */
+int vibra_lsh_table_insert(VibraLshTable *table, long long id, const unsigned long long *digest);
+
+/**
+ * @brief Remove the entry with an id.
+ *
+ * @return int 1 if an entry was removed, 0 if there was none.
+ */
+int vibra_lsh_table_remove(VibraLshTable *table, long long id);
+
+/**
+ * @brief Find the entries whose digests are close to a digest.
+ *
+ * The candidates are likely, not certain, to be the same audio; confirm them with
+ * vibra_compare_signatures().
+ *
+ * @param table Pointer to the table.
+ * @param digest The query digest.
+ * @param ids Output array, the closest candidates first.
+ * @param capacity Number of elements ids can hold.
+ * @return int The number of ids written, at most capacity.
+ */
+int vibra_lsh_table_query(const VibraLshTable *table, const unsigned long long *digest,
+                          long long *ids, int capacity);
+
+/**
+ * @brief Get the number of entries of a table.
+ */
+int vibra_lsh_table_get_size(const VibraLshTable *table);
+
+/**
+ * @brief Free a digest table.
+ *
+ * @param table Pointer to the table.
+ */
+void vibra_lsh_table_free(VibraLshTable *table);
+
+/**
+ * @brief Best match of a query against a VibraIndex, see vibra_index_query().
+ */
+struct VibraMatch
+{
+    unsigned int track_id;        /**< The track id given when indexing. */
+    int offset_ms;                /**< Position of the query start within the track. */
+    unsigned int score;           /**< Query landmarks agreeing with track and offset. */
+    unsigned int query_landmarks; /**< Landmarks extracted from the query. */
+};
+
+/**
+ * @brief Collects tracks for a VibraIndex, see vibra_index_builder_create().
+ */
+struct VibraIndexBuilder;
+
+/**
+ * @brief Memory-mapped landmark index of tracks, see vibra_index_open().
+ */
+struct VibraIndex;
+
+/**
+ * @brief Create an empty index builder.
+ *
+ * @note The returned pointer must be freed after use. See vibra_index_builder_free().
+ */
+VibraIndexBuilder *vibra_index_builder_create(void);
+
+/**
+ * @brief Add the peaks of a signature to a track.
+ *
+ * @param builder Pointer to the builder.
+ * @param track_id Caller-defined id returned by queries that match this track.
+ * @param signature The signature.
+ * @param offset_ms Position of the signature within the track, for tracks added in segments.
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_index_builder_get_error().
+ */
+int vibra_index_builder_add_signature(VibraIndexBuilder *builder, unsigned int track_id,
+                                      const VibraSignature *signature, unsigned int offset_ms);
+
+/**
+ * @brief Fingerprint a whole track and add it.
+ *
+ * Unlike the fingerprint functions, which stop after a few seconds, this analyses all
+ * of the PCM data.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_index_builder_get_error().
+ */
+int vibra_index_builder_add_pcm(VibraIndexBuilder *builder, unsigned int track_id,
+                                const char *raw_pcm, int pcm_data_size, int sample_rate,
+                                int sample_width, int channel_count, int is_float);
+
+/**
+ * @brief Add every track of an existing index, to extend it.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_index_builder_get_error().
+ */
+int vibra_index_builder_add_index(VibraIndexBuilder *builder, const VibraIndex *index);
+
+/**
+ * @brief Write the index file.
+ *
+ * The file is replaced atomically, indexes already open on the previous version stay valid.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_index_builder_get_error().
+ */
+int vibra_index_builder_write(VibraIndexBuilder *builder, const char *path);
+
+/**
+ * @brief Get the message describing the last failure of the builder.
+ *
+ * @note The returned pointer should not be freed.
+ */
+const char *vibra_index_builder_get_error(VibraIndexBuilder *builder);
+
+/**
+ * @brief Free an index builder.
+ *
+ * @param builder Pointer to the builder.
+ */
+void vibra_index_builder_free(VibraIndexBuilder *builder);
+
+/**
+ * @brief Map an index file written by vibra_index_builder_write(), or every segment of an
+ * index directory written by a VibraIngestor.
+ *
+ * @return VibraIndex* The index, or NULL if the path is missing or corrupt.
+ *
+ * @note The returned pointer must be freed after use. See vibra_index_free().
+ */
+VibraIndex *vibra_index_open(const char *path);
+
+/**
+ * @brief Find the indexed track and position that best match a signature.
+ *
+ * Safe to call from several threads on the same index.
+ *
+ * @param index Pointer to the index.
+ * @param signature The query signature, typically a few seconds of recording.
+ * @param match Receives the best candidate, even when it is too weak to count as a match.
+ * @return int 1 if a track matched, 0 if not, VIBRA_STATUS_ERROR on failure.
+ */
+int vibra_index_query(const VibraIndex *index, const VibraSignature *signature,
+                      VibraMatch *match);
+
+/**
+ * @brief Get the number of distinct tracks in an index.
+ */
+unsigned int vibra_index_get_track_count(const VibraIndex *index);
+
+/**
+ * @brief Unmap an index.
+ *
+ * @param index Pointer to the index.
+ */
+void vibra_index_free(VibraIndex *index);
+
+/**
+ * @brief Fingerprints tracks while they are played into an index directory, see
+ * vibra_ingestor_create().
+ */
+struct VibraIngestor;
+
+/**
+ * @brief Create an ingestor appending to the index directory at `directory`.
+ *
+ * The directory is created by the first commit. Open it with vibra_index_open() to query
+ * the tracks played so far.
+ *
+ * @return VibraIngestor* The ingestor, or NULL if `directory` is NULL.
+ *
+ * @note The returned pointer must be freed after use. See vibra_ingestor_free().
+ */
+VibraIngestor *vibra_ingestor_create(const char *directory);
+
+/**
+ * @brief Start ingesting a track, ending the current one.
+ *
+ * The begin, feed and end functions are meant for the audio thread and must not be called
+ * concurrently with each other.
+ *
+ * @param track_id Id returned by queries that match this track. Each id may be committed once.
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_ingestor_get_error().
+ */
+int vibra_ingestor_begin_track(VibraIngestor *ingestor, unsigned int track_id, int sample_rate,
+                               int sample_width, int channel_count, int is_float);
+
+/**
+ * @brief Queue a block of the track being played and analyse queued audio for at most
+ * `budget_us` microseconds.
+ *
+ * A track that falls too far behind playback is dropped, nothing of it is committed. Blocks
+ * fed while no track is being ingested are ignored.
+ *
+ * @return int VIBRA_STATUS_DONE once all queued audio is analysed, VIBRA_STATUS_PENDING if
+ * some is left for later calls, VIBRA_STATUS_DROPPED if this block dropped the track, or
+ * VIBRA_STATUS_ERROR. See vibra_ingestor_get_error().
+ */
+int vibra_ingestor_feed(VibraIngestor *ingestor, const char *raw_pcm, int pcm_data_size,
+                        int budget_us);
+
+/**
+ * @brief Hand the current track over to the next vibra_ingestor_commit().
+ */
+void vibra_ingestor_end_track(VibraIngestor *ingestor);
+
+/**
+ * @brief Analyse what is left of the ended tracks and add them to the index directory.
+ *
+ * Meant for a low priority thread, can run alongside the audio thread calls but not
+ * alongside another commit. Tracks played too briefly are skipped, their ids are never
+ * indexed and may be ingested again under a new id.
+ *
+ * @return int The number of tracks added, see vibra_ingestor_get_committed_ids(), or
+ * VIBRA_STATUS_ERROR, in which case all ended tracks are lost. See
+ * vibra_ingestor_get_commit_error().
+ */
+int vibra_ingestor_commit(VibraIngestor *ingestor);
+
+/**
+ * @brief Copy the ids of the tracks added by the last vibra_ingestor_commit().
+ *
+ * @param ingestor Pointer to the ingestor.
+ * @param ids Output array, in the order the tracks ended.
+ * @param capacity Number of elements ids can hold.
+ * @return int The number of ids written, at most capacity.
+ */
+int vibra_ingestor_get_committed_ids(const VibraIngestor *ingestor, unsigned int *ids,
+                                     int capacity);
+
+/**
+ * @brief Get the message describing the last failure of the audio thread calls.
+ *
+ * @note The returned pointer should not be freed.
+ */
+const char *vibra_ingestor_get_error(VibraIngestor *ingestor);
+
+/**
+ * @brief Get the message describing the last failure of vibra_ingestor_commit().
+ *
+ * @note The returned pointer should not be freed.
+ */
+const char *vibra_ingestor_get_commit_error(VibraIngestor *ingestor);
+
+/**
+ * @brief Free an ingestor, dropping the tracks not committed.
+ *
+ * @param ingestor Pointer to the ingestor.
+ */
+void vibra_ingestor_free(VibraIngestor *ingestor);
+
+/**
+ * @brief Collects signatures for a signature pack file, see vibra_signature_pack_writer_create().
+ */
+struct VibraSignaturePackWriter;
+
+/**
+ * @brief A signature pack file mapped by vibra_signature_pack_open().
+ *
+ * Packs store many signatures in less space than their URIs and are mapped rather than
+ * read, a signature is only decoded when it is accessed.
+ */
+struct VibraSignaturePack;
+
+/**
+ * @brief Create an empty signature pack writer.
+ *
+ * @note The returned pointer must be freed after use. See vibra_signature_pack_writer_free().
+ */
+VibraSignaturePackWriter *vibra_signature_pack_writer_create(void);
+
+/**
+ * @brief Add a signature URI under `key`, replacing any signature with the same key.
+ *
+ * The URI must be in the encoding this library produces, which the pack gives back byte
+ * for byte. Signatures from other encoders can be re-encoded first with
+ * vibra_signature_to_fingerprint().
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_signature_pack_writer_get_error().
+ */
+int vibra_signature_pack_writer_add(VibraSignaturePackWriter *writer, unsigned long long key,
+                                    const char *uri, int uri_size);
+
+/**
+ * @brief Add every signature of an existing pack, to extend it.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_signature_pack_writer_get_error().
+ */
+int vibra_signature_pack_writer_add_pack(VibraSignaturePackWriter *writer,
+                                         const VibraSignaturePack *pack);
+
+/**
+ * @brief Remove the signature added under `key`.
+ *
+ * @return int 1 if there was one, 0 if not.
+ */
+int vibra_signature_pack_writer_remove(VibraSignaturePackWriter *writer, unsigned long long key);
+
+/**
+ * @brief Write the pack file.
+ *
+ * The file is replaced atomically, packs already open on the previous version stay valid.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR. See vibra_signature_pack_writer_get_error().
+ */
+int vibra_signature_pack_writer_write(VibraSignaturePackWriter *writer, const char *path);
+
+/**
+ * @brief Get the message describing the last failure of the writer.
+ *
+ * @note The returned pointer should not be freed.
+ */
+const char *vibra_signature_pack_writer_get_error(VibraSignaturePackWriter *writer);
+
+/**
+ * @brief Free a signature pack writer.
+ *
+ * @param writer Pointer to the writer.
+ */
+void vibra_signature_pack_writer_free(VibraSignaturePackWriter *writer);
+
+/**
+ * @brief Map a pack file written by vibra_signature_pack_writer_write().
+ *
+ * Only the file header is read, so opening takes about the same time for any pack size.
+ *
+ * @return VibraSignaturePack* The pack, or NULL if the file is missing or corrupt.
+ *
+ * @note The returned pointer must be freed after use. See vibra_signature_pack_free().
+ */
+VibraSignaturePack *vibra_signature_pack_open(const char *path);
+
+/**
+ * @brief Get the number of signatures in a pack.
+ */
+int vibra_signature_pack_get_size(const VibraSignaturePack *pack);
+
+/**
+ * @brief Get the key of the signature at `index`, from 0 to the pack size, keys are in
+ * ascending order.
+ *
+ * @return unsigned long long The key, or 0 if the index is out of range.
+ */
+unsigned long long vibra_signature_pack_get_key(const VibraSignaturePack *pack, int index);
+
+/**
+ * @brief Find the signature stored under `key`.
+ *
+ * @return int Its index, or -1 if there is none.
+ */
+int vibra_signature_pack_find(const VibraSignaturePack *pack, unsigned long long key);
+
+/**
+ * @brief Decode the signature at `index`.
+ *
+ * Safe to call from several threads on the same pack.
+ *
+ * @return VibraSignature* The signature, or NULL if the index is out of range or the
+ * record is corrupt.
+ *
+ * @note The returned pointer must be freed after use. See vibra_signature_free().
+ */
+VibraSignature *vibra_signature_pack_get_signature(const VibraSignaturePack *pack, int index);
+
+/**
+ * @brief Unmap a signature pack.
+ *
+ * @param pack Pointer to the pack.
+ */
+void vibra_signature_pack_free(VibraSignaturePack *pack);
+
 /**
  * @brief Get the URI associated with a fingerprint.
  *
@@ -88,6 +804,13 @@ const char *vibra_get_uri_from_fingerprint(Fingerprint *fingerprint);
  */
 unsigned int vibra_get_sample_ms_from_fingerprint(Fingerprint *fingerprint);
 
+/**
+ * @brief Get the stats of a fingerprint computed while stats were enabled.
+ *
+ * @return int VIBRA_STATUS_DONE, or VIBRA_STATUS_ERROR if none were collected.
+ */
+int vibra_get_stats_from_fingerprint(const Fingerprint *fingerprint, VibraStats *stats);
+
 /**
  * @brief Free a fingerprint.
  *
@@ -0,0 +1,90 @@
+#include "algorithm/fingerprint_session.h"
+#include <algorithm>
+#include <limits>
+#include "utils/trace.h"
+
+// The downsampler output of one block is the only audio held in memory
+constexpr std::size_t STREAM_BLOCK_FRAMES = 4096;
+// Samples the resampler may emit for a block beyond the rate ratio
+constexpr std::size_t BLOCK_OUTPUT_SLACK = 16;
+
+FingerprintSession::FingerprintSession(const char *pcm, std::size_t pcm_size,
+                                       SampleFormat sample_format, std::uint32_t sample_rate,
+                                       std::uint32_t bits_per_sample, std::uint32_t channels,
+                                       double max_time_seconds)
+    : pcm_(pcm), pcm_size_(pcm_size), offset_(0), done_(false),
+      downsampler_(sample_format, sample_rate, bits_per_sample, channels), generator_(),
+      cancellation_token_(nullptr), stats_(nullptr), block_()
+{
+    generator_.set_max_time_seconds(max_time_seconds);
+    block_.reserve(STREAM_BLOCK_FRAMES * LOW_QUALITY_SAMPLE_RATE / sample_rate +
+                   BLOCK_OUTPUT_SLACK);
+}
+
+void FingerprintSession::set_cancellation_token(const CancellationToken *token)
+{
+    cancellation_token_ = token;
+    generator_.set_cancellation_token(token);
+}
+
+void FingerprintSession::set_stats(PipelineStats *stats)
+{
+    stats_ = stats;
+    generator_.set_stats(stats);
+}
+
+bool FingerprintSession::Step(std::size_t max_frames)
+{
+    const std::size_t frame_size = downsampler_.frame_size();
+    std::size_t frames_left = max_frames;
+    while (!done_ && frames_left > 0)
+    {
+        checkCancelled();
+        if (generator_.IsSignatureComplete())
+        {
+            done_ = true;
+            break;
+        }
+
+        block_.clear();
+        if (offset_ >= pcm_size_)
+        {
+            StageTimer downsample_timer(stats_, PipelineStats::DOWNSAMPLE);
+            downsampler_.Flush(&block_);
+            downsample_timer.Stop();
+            generator_.ProcessInput(block_.data(), block_.size());
+            done_ = true;
+            break;
+        }
+
+        trace::Scope trace_scope("FingerprintSession block");
+        const std::size_t frames = std::min(STREAM_BLOCK_FRAMES, frames_left);
+        const std::size_t size = std::min(frames * frame_size, pcm_size_ - offset_);
+        StageTimer downsample_timer(stats_, PipelineStats::DOWNSAMPLE);
+        downsampler_.Process(pcm_ + offset_, size, &block_);
+        downsample_timer.Stop();
+        generator_.ProcessInput(block_.data(), block_.size());
+        offset_ += size;
+        if (stats_ != nullptr)
+        {
+            stats_->frames_processed += size / frame_size;
+            stats_->SampleHeap();
+        }
+        frames_left -= frames;
+    }
+    return done_;
+}
+
+Signature FingerprintSession::Finish()
+{
+    Step(std::numeric_limits<std::size_t>::max());
+    return generator_.GetNextSignature();
+}
+
+void FingerprintSession::checkCancelled() const
+{
+    if (cancellation_token_ != nullptr)
+    {
+        cancellation_token_->ThrowIfCancelled();
+    }
+}
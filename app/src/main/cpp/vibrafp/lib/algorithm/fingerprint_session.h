@@ -0,0 +1,71 @@
+#ifndef LIB_ALGORITHM_FINGERPRINT_SESSION_H_
+#define LIB_ALGORITHM_FINGERPRINT_SESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "algorithm/signature_generator.h"
+#include "audio/downsampler.h"
+#include "utils/cancellation.h"
+
+// Drives PCM through the downsampler and signature generator in bounded
+// steps, so callers can interleave the DSP with their own cancellation
+// points or hand it a CancellationToken polled from inside.
+class FingerprintSession
+{
+public:
+    // `pcm` is not copied and must outlive the session.
+    FingerprintSession(const char *pcm, std::size_t pcm_size, SampleFormat sample_format,
+                       std::uint32_t sample_rate, std::uint32_t bits_per_sample,
+                       std::uint32_t channels, double max_time_seconds);
+    FingerprintSession(const FingerprintSession &) = delete;
+    FingerprintSession &operator=(const FingerprintSession &) = delete;
+
+    // Processes at most `max_frames` source frames. Returns true once the
+    // signature is complete or the input is exhausted.
+    bool Step(std::size_t max_frames);
+
+    inline bool IsDone() const
+    {
+        return done_;
+    }
+
+    // Runs whatever work is left and returns the signature.
+    Signature Finish();
+
+    // See SignatureGenerator::EnableLandmarks() and TakeLandmarks()
+    inline void EnableLandmarks(const LandmarkConfig &config)
+    {
+        generator_.EnableLandmarks(config);
+    }
+    inline void TakeLandmarks(std::vector<Landmark> *landmarks)
+    {
+        generator_.TakeLandmarks(landmarks);
+    }
+
+    // Checked between blocks and by the signature generator, a cancelled
+    // token makes Step() and Finish() throw OperationCancelled.
+    void set_cancellation_token(const CancellationToken *token);
+
+    // Collects the downsampling and generator stage times, frame count and
+    // heap high-water mark of Step() into `stats`, which must outlive the
+    // session. Null, the default, stops collecting.
+    void set_stats(PipelineStats *stats);
+
+private:
+    void checkCancelled() const;
+
+private:
+    const char *pcm_;
+    std::size_t pcm_size_;
+    std::size_t offset_;
+    bool done_;
+
+    Downsampler downsampler_;
+    SignatureGenerator generator_;
+    const CancellationToken *cancellation_token_;
+    PipelineStats *stats_;
+    LowQualityTrack block_;
+};
+
+#endif // LIB_ALGORITHM_FINGERPRINT_SESSION_H_
@@ -1,12 +1,14 @@
 #include "algorithm/signature.h"
 #include <algorithm>
-#include <sstream>
+#include <cstring>
+#include <stdexcept>
 #include <string>
 #include "utils/base64.h"
 #include "utils/crc32.h"
+#include "utils/trace.h"
 
 Signature::Signature(std::uint32_t sample_rate, std::uint32_t num_samples)
-    : sample_rate_(sample_rate), num_samples_(num_samples)
+    : sample_rate_(sample_rate), num_samples_(num_samples), digest_(EmptyDigest())
 {
 }
 
@@ -15,6 +17,7 @@ void Signature::Reset(std::uint32_t sampleRate, std::uint32_t num_samples)
     sample_rate_ = sampleRate;
     num_samples_ = num_samples;
     frequency_band_to_peaks_.clear();
+    digest_ = EmptyDigest();
 }
 
 std::uint32_t Signature::SumOfPeaksLength() const
@@ -27,70 +30,251 @@ std::uint32_t Signature::SumOfPeaksLength() const
     return sum;
 }
 
-std::string Signature::EncodeBase64() const
+namespace
+{
+constexpr char BASE64_URI_PREFIX[] = "data:audio/vnd.shazam.sig;base64,";
+constexpr std::size_t BAND_HEADER_SIZE = 8;  // tag + payload size
+constexpr std::size_t PEAK_SIZE = 5;         // pass delta + magnitude + bin
+constexpr std::size_t PASS_ESCAPE_SIZE = 5;  // 0xff + absolute pass number
+
+constexpr std::uint32_t HEADER_MAGIC1 = 0xcafe2580;
+constexpr std::uint32_t HEADER_MAGIC2 = 0x94119c00;
+constexpr std::uint32_t SAMPLE_RATE_ID_SHIFT = 27;
+constexpr std::uint32_t CONTENTS_TAG = 0x40000000;
+constexpr std::uint32_t BAND_TAG_BASE = 0x60030040;
+
+// Indexed by the sample rate id in the header, 0 marks unused ids
+constexpr std::uint32_t SAMPLE_RATES[] = {0, 8000, 11025, 16000, 32000, 44100, 48000};
+
+inline std::uint32_t loadLittleEndian(const char *src, std::size_t size = 4)
 {
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(src[i])) << (i << 3);
+    }
+    return value;
+}
+
+inline char *storeLittleEndian(char *dst, std::uint32_t value, std::size_t size = 4)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        *dst++ = static_cast<char>(value >> (i << 3));
+    }
+    return dst;
+}
+
+// A peak whose pass is 255 or more after the previous one (or before it)
+// is preceded by an escape carrying its absolute pass number.
+inline bool needsPassEscape(std::uint32_t pass_number, std::size_t previous_pass_number)
+{
+    return pass_number - previous_pass_number >= 255;
+}
+
+std::size_t bandPayloadSize(const std::vector<FrequencyPeak> &peaks)
+{
+    std::size_t size = peaks.size() * PEAK_SIZE;
+    std::size_t fft_pass_number = 0;
+    for (const auto &peak : peaks)
+    {
+        if (needsPassEscape(peak.fft_pass_number(), fft_pass_number))
+        {
+            size += PASS_ESCAPE_SIZE;
+        }
+        fft_pass_number = peak.fft_pass_number();
+    }
+    return size;
+}
+} // namespace
+
+std::string Signature::EncodeBinary() const
+{
+    std::size_t contents_size = 0;
+    for (const auto &pair : frequency_band_to_peaks_)
+    {
+        const std::size_t payload_size = bandPayloadSize(pair.second);
+        contents_size += BAND_HEADER_SIZE + payload_size + (-payload_size % 4);
+    }
+
     RawSignatureHeader header = {};
-    header.magic1 = 0xcafe2580;
-    header.magic2 = 0x94119c00;
-    header.shifted_sample_rate_id = 3 << 27;
+    header.magic1 = HEADER_MAGIC1;
+    header.magic2 = HEADER_MAGIC2;
+    header.shifted_sample_rate_id = 3 << SAMPLE_RATE_ID_SHIFT;
     header.fixed_value = ((15 << 19) + 0x40000);
     header.number_samples_plus_divided_sample_rate =
         static_cast<std::uint32_t>(num_samples_ + sample_rate_ * 0.24);
-    std::stringstream contents;
+    header.size_minus_header = contents_size + 8;
+
+    // Zero filled, so padding needs no explicit writes
+    std::string binary(sizeof(header) + 8 + contents_size, '\0');
+    char *out = &binary[0] + sizeof(header);
+    out = storeLittleEndian(out, CONTENTS_TAG);
+    out = storeLittleEndian(out, static_cast<std::uint32_t>(contents_size) + 8);
+
     for (const auto &pair : frequency_band_to_peaks_)
     {
-        const auto &band = pair.first;
         const auto &peaks = pair.second;
+        const std::size_t payload_size = bandPayloadSize(peaks);
+        out = storeLittleEndian(out, BAND_TAG_BASE + static_cast<std::uint32_t>(pair.first));
+        out = storeLittleEndian(out, static_cast<std::uint32_t>(payload_size));
 
-        std::stringstream peak_buf;
         std::size_t fft_pass_number = 0;
-
         for (const auto &peak : peaks)
         {
-            if (peak.fft_pass_number() - fft_pass_number >= 255)
+            if (needsPassEscape(peak.fft_pass_number(), fft_pass_number))
             {
-                peak_buf << "\xff";
-                write_little_endian(peak_buf, peak.fft_pass_number());
+                *out++ = '\xff';
+                out = storeLittleEndian(out, peak.fft_pass_number());
                 fft_pass_number = peak.fft_pass_number();
             }
-
-            peak_buf << static_cast<char>(peak.fft_pass_number() - fft_pass_number);
-            write_little_endian(peak_buf, peak.peak_magnitude(), 2);
-            write_little_endian(peak_buf, peak.corrected_peak_frequency_bin(), 2);
-
+            *out++ = static_cast<char>(peak.fft_pass_number() - fft_pass_number);
+            out = storeLittleEndian(out, peak.peak_magnitude(), 2);
+            out = storeLittleEndian(out, peak.corrected_peak_frequency_bin(), 2);
             fft_pass_number = peak.fft_pass_number();
         }
+        out += -payload_size % 4;
+    }
 
-        write_little_endian(contents, 0x60030040u + static_cast<std::uint32_t>(band));
-        write_little_endian(contents, static_cast<std::uint32_t>(peak_buf.str().size()));
-        contents << peak_buf.str();
+    // The CRC covers everything after the crc32 field itself
+    std::memcpy(&binary[0], &header, sizeof(header));
+    header.crc32 = crc32::crc32(binary.data() + 8, binary.size() - 8) & 0xffffffff;
+    std::memcpy(&binary[0], &header, sizeof(header));
+    return binary;
+}
 
-        for (std::size_t i = 0; i < (-peak_buf.str().size() % 4); ++i)
-            contents << '\0';
-    }
+std::string Signature::EncodeBase64() const
+{
+    trace::Scope trace_scope("Signature::EncodeBase64");
+    const std::string binary = EncodeBinary();
+    constexpr std::size_t kPrefixSize = sizeof(BASE64_URI_PREFIX) - 1;
 
-    header.size_minus_header = contents.str().size() + 8;
+    std::string base64_uri(kPrefixSize + base64::encoded_size(binary.size()), '\0');
+    std::memcpy(&base64_uri[0], BASE64_URI_PREFIX, kPrefixSize);
+    base64::encode(binary.data(), binary.size(), &base64_uri[kPrefixSize]);
+    return base64_uri;
+}
 
-    std::stringstream header_buf;
-    header_buf.write(reinterpret_cast<const char *>(&header), sizeof(header));
+Signature Signature::DecodeBinary(const char *data, std::size_t size)
+{
+    RawSignatureHeader header;
+    if (size < sizeof(header) + 8)
+    {
+        throw std::runtime_error("Signature is truncated");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.magic1 != HEADER_MAGIC1 || header.magic2 != HEADER_MAGIC2)
+    {
+        throw std::runtime_error("Signature has an invalid magic number");
+    }
+    if (header.size_minus_header != size - sizeof(header) ||
+        loadLittleEndian(data + sizeof(header)) != CONTENTS_TAG ||
+        loadLittleEndian(data + sizeof(header) + 4) != size - sizeof(header))
+    {
+        throw std::runtime_error("Signature size does not match its header");
+    }
+    if (header.crc32 != crc32::crc32(data + 8, size - 8))
+    {
+        throw std::runtime_error("Signature CRC mismatch");
+    }
 
-    write_little_endian(header_buf, 0x40000000u);
-    write_little_endian(header_buf, static_cast<std::uint32_t>(contents.str().size()) + 8);
+    const std::uint32_t sample_rate_id = header.shifted_sample_rate_id >> SAMPLE_RATE_ID_SHIFT;
+    const std::size_t kSampleRateCount = sizeof(SAMPLE_RATES) / sizeof(SAMPLE_RATES[0]);
+    if (sample_rate_id >= kSampleRateCount || SAMPLE_RATES[sample_rate_id] == 0)
+    {
+        throw std::runtime_error("Signature has an unknown sample rate");
+    }
+    const std::uint32_t sample_rate = SAMPLE_RATES[sample_rate_id];
+    const auto rate_samples = static_cast<std::uint32_t>(sample_rate * 0.24);
+    if (header.number_samples_plus_divided_sample_rate < rate_samples)
+    {
+        throw std::runtime_error("Signature has an invalid sample count");
+    }
+    Signature signature(sample_rate, header.number_samples_plus_divided_sample_rate - rate_samples);
 
-    header_buf << contents.str();
+    const char *p = data + sizeof(header) + 8;
+    const char *end = data + size;
+    while (p != end)
+    {
+        if (static_cast<std::size_t>(end - p) < BAND_HEADER_SIZE)
+        {
+            throw std::runtime_error("Signature band header is truncated");
+        }
+        const auto band = static_cast<std::int32_t>(loadLittleEndian(p) - BAND_TAG_BASE);
+        const std::size_t payload_size = loadLittleEndian(p + 4);
+        p += BAND_HEADER_SIZE;
+        if (band < static_cast<std::int32_t>(FrequencyBand::_0_150) ||
+            band > static_cast<std::int32_t>(FrequencyBand::_3500_5500))
+        {
+            throw std::runtime_error("Signature has an unknown frequency band");
+        }
+        const std::size_t available = end - p;
+        if (payload_size > available || -payload_size % 4 > available - payload_size)
+        {
+            throw std::runtime_error("Signature band payload is truncated");
+        }
+        auto inserted = signature.frequency_band_to_peaks_.emplace(
+            static_cast<FrequencyBand>(band), std::vector<FrequencyPeak>());
+        if (!inserted.second)
+        {
+            throw std::runtime_error("Signature repeats a frequency band");
+        }
 
-    const auto &header_buf_str = header_buf.str();
-    header.crc32 = crc32::crc32(header_buf_str.c_str() + 8, header_buf_str.size() - 8) & 0xffffffff;
+        // Exact unless the band contains pass number escapes
+        auto &peaks = inserted.first->second;
+        peaks.reserve(payload_size / PEAK_SIZE);
+        const char *payload_end = p + payload_size;
+        std::uint32_t fft_pass_number = 0;
+        while (p != payload_end)
+        {
+            if (static_cast<std::uint8_t>(*p) == 0xff)
+            {
+                if (static_cast<std::size_t>(payload_end - p) < PASS_ESCAPE_SIZE)
+                {
+                    throw std::runtime_error("Signature pass number escape is truncated");
+                }
+                fft_pass_number = loadLittleEndian(p + 1);
+                p += PASS_ESCAPE_SIZE;
+            }
+            if (static_cast<std::size_t>(payload_end - p) < PEAK_SIZE)
+            {
+                throw std::runtime_error("Signature peak is truncated");
+            }
+            fft_pass_number += static_cast<std::uint8_t>(p[0]);
+            peaks.emplace_back(fft_pass_number, loadLittleEndian(p + 1, 2),
+                               loadLittleEndian(p + 3, 2), sample_rate);
+            p += PEAK_SIZE;
+        }
+        p += -payload_size % 4;
+    }
 
-    header_buf.seekp(0);
-    header_buf.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    DigestBuilder digest_builder;
+    for (const auto &pair : signature.frequency_band_to_peaks_)
+    {
+        for (const auto &peak : pair.second)
+        {
+            digest_builder.AddPeak(pair.first, peak);
+        }
+    }
+    signature.digest_ = digest_builder.Digest();
+    return signature;
+}
 
-    std::string header_string = header_buf.str();
+Signature Signature::DecodeBase64(const char *uri, std::size_t size)
+{
+    constexpr std::size_t kPrefixSize = sizeof(BASE64_URI_PREFIX) - 1;
+    if (size >= kPrefixSize && std::memcmp(uri, BASE64_URI_PREFIX, kPrefixSize) == 0)
+    {
+        uri += kPrefixSize;
+        size -= kPrefixSize;
+    }
 
-    std::string base64_uri;
-    base64_uri += "data:audio/vnd.shazam.sig;base64,";
-    base64_uri += base64::encode(header_string.c_str(), header_string.size());
-    return base64_uri;
+    std::string binary;
+    if (!base64::decode(uri, size, &binary))
+    {
+        throw std::runtime_error("Signature is not valid base64");
+    }
+    return DecodeBinary(binary.data(), binary.size());
 }
 
 Signature::~Signature()
@@ -1,12 +1,13 @@
 #ifndef LIB_ALGORITHM_SIGNATURE_H_
 #define LIB_ALGORITHM_SIGNATURE_H_
 
-#include <list>
+#include <cstddef>
 #include <map>
 #include <memory>
-#include <sstream>
 #include <string>
+#include <vector>
 #include "algorithm/frequency.h"
+#include "algorithm/signature_digest.h"
 
 // Prevent Structure Padding
 #ifdef _MSC_VER
@@ -52,29 +53,41 @@ public:
     {
         return num_samples_;
     }
-    inline std::map<FrequencyBand, std::list<FrequencyPeak>> &frequency_band_to_peaks()
+    inline std::map<FrequencyBand, std::vector<FrequencyPeak>> &frequency_band_to_peaks()
     {
         return frequency_band_to_peaks_;
     }
+    inline const std::map<FrequencyBand, std::vector<FrequencyPeak>> &frequency_band_to_peaks()
+        const
+    {
+        return frequency_band_to_peaks_;
+    }
+    // Set by SignatureGenerator as peaks are found and by the decoders
+    inline const SignatureDigest &digest() const
+    {
+        return digest_;
+    }
+    inline void set_digest(const SignatureDigest &digest)
+    {
+        digest_ = digest;
+    }
     std::uint32_t SumOfPeaksLength() const;
+    // Raw signature bytes: header, band TLVs and padding, with the CRC set
+    std::string EncodeBinary() const;
+    // EncodeBinary() as a data:audio/vnd.shazam.sig URI
     std::string EncodeBase64() const;
 
-private:
-    template <typename T>
-    std::stringstream &write_little_endian(std::stringstream &stream, const T &&value,
-                                           size_t size = sizeof(T)) const
-    {
-        for (size_t i = 0; i < size; ++i)
-        {
-            stream << static_cast<char>(value >> (i << 3));
-        }
-        return stream;
-    }
+    // Inverse of EncodeBinary(), validating the magic numbers, sizes and CRC.
+    // Throws std::runtime_error on malformed input.
+    static Signature DecodeBinary(const char *data, std::size_t size);
+    // Accepts a data:audio/vnd.shazam.sig URI or its bare base64 payload
+    static Signature DecodeBase64(const char *uri, std::size_t size);
 
 private:
     std::uint32_t sample_rate_;
     std::uint32_t num_samples_;
-    std::map<FrequencyBand, std::list<FrequencyPeak>> frequency_band_to_peaks_;
+    std::map<FrequencyBand, std::vector<FrequencyPeak>> frequency_band_to_peaks_;
+    SignatureDigest digest_;
 };
 
 #endif // LIB_ALGORITHM_SIGNATURE_H_
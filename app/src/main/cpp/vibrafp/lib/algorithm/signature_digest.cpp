@@ -0,0 +1,81 @@
+#include "algorithm/signature_digest.h"
+#include <algorithm>
+#include <limits>
+
+constexpr std::uint64_t GOLDEN_RATIO_64 = 0x9e3779b97f4a7c15ull;
+// A peak completes at most one landmark per pending anchor of its band
+constexpr std::size_t LANDMARKS_PER_PEAK_RESERVED = 16;
+
+namespace
+{
+// splitmix64 finalizer
+inline std::uint64_t mix64(std::uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+} // namespace
+
+SignatureDigest EmptyDigest()
+{
+    SignatureDigest digest;
+    digest.fill(std::numeric_limits<std::uint64_t>::max());
+    return digest;
+}
+
+DigestBuilder::DigestBuilder()
+    : landmark_stream_(), landmarks_(), min_hashes_(EmptyDigest()), landmark_count_(0)
+{
+    landmarks_.reserve(LANDMARKS_PER_PEAK_RESERVED);
+}
+
+void DigestBuilder::Reset()
+{
+    landmark_stream_.Reset();
+    min_hashes_ = EmptyDigest();
+    landmark_count_ = 0;
+}
+
+void DigestBuilder::AddPeak(FrequencyBand band, const FrequencyPeak &peak)
+{
+    landmarks_.clear();
+    landmark_stream_.AddPeak(band, peak, &landmarks_);
+    for (const auto &landmark : landmarks_)
+    {
+        addLandmark(landmark.hash);
+    }
+}
+
+SignatureDigest DigestBuilder::Digest() const
+{
+    SignatureDigest digest = min_hashes_;
+    if (landmark_count_ == 0)
+    {
+        return digest;
+    }
+    const auto empty = std::numeric_limits<std::uint64_t>::max();
+    for (std::size_t i = 0; i < DIGEST_SIZE; ++i)
+    {
+        // Offset by the distance so that borrowed copies differ from the
+        // original value and from each other
+        std::size_t distance = 1;
+        for (; min_hashes_[i] == empty && min_hashes_[(i + distance) % DIGEST_SIZE] == empty;
+             ++distance)
+        {
+        }
+        if (min_hashes_[i] == empty)
+        {
+            digest[i] = mix64(min_hashes_[(i + distance) % DIGEST_SIZE] + distance * GOLDEN_RATIO_64);
+        }
+    }
+    return digest;
+}
+
+void DigestBuilder::addLandmark(std::uint32_t hash)
+{
+    ++landmark_count_;
+    const std::uint64_t mixed = mix64(hash + GOLDEN_RATIO_64);
+    std::uint64_t &min_hash = min_hashes_[mixed >> (64 - DIGEST_BITS)];
+    min_hash = std::min(min_hash, mixed);
+}
@@ -0,0 +1,52 @@
+#ifndef LIB_ALGORITHM_SIGNATURE_DIGEST_H_
+#define LIB_ALGORITHM_SIGNATURE_DIGEST_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "algorithm/frequency.h"
+#include "match/landmark.h"
+
+constexpr std::size_t DIGEST_BITS = 5u;
+constexpr std::size_t DIGEST_SIZE = 1u << DIGEST_BITS;
+
+// One permutation MinHash of the landmark hashes of a signature (see
+// match/landmark.h, with the default LandmarkConfig): each landmark hash is
+// mixed once, its top DIGEST_BITS bits pick a value and the value keeps the
+// smallest hash it is given. The fraction of equal values of two digests
+// estimates the Jaccard similarity of their landmark sets, so signatures of
+// the same audio have close digests even though their URIs differ. All
+// values are UINT64_MAX for a signature without landmarks.
+typedef std::array<std::uint64_t, DIGEST_SIZE> SignatureDigest;
+
+SignatureDigest EmptyDigest();
+
+// Pairs peaks into landmarks as they are found, so the digest of a signature
+// is ready as soon as its last peak is.
+class DigestBuilder
+{
+public:
+    DigestBuilder();
+    void Reset();
+
+    // The peaks of each band must be added in time order
+    void AddPeak(FrequencyBand band, const FrequencyPeak &peak);
+
+    // Values no landmark hash fell into are filled from the next value that
+    // has one, so digests of short signatures still compare value by value
+    SignatureDigest Digest() const;
+    inline std::uint32_t landmark_count() const
+    {
+        return landmark_count_;
+    }
+
+private:
+    void addLandmark(std::uint32_t hash);
+
+    LandmarkStream landmark_stream_;
+    std::vector<Landmark> landmarks_; // scratch for landmark_stream_
+    SignatureDigest min_hashes_;
+    std::uint32_t landmark_count_;
+};
+
+#endif // LIB_ALGORITHM_SIGNATURE_DIGEST_H_
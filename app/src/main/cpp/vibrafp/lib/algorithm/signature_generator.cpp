@@ -1,16 +1,31 @@
 #include "algorithm/signature_generator.h"
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <iostream>
-#include <list>
 #include <numeric>
 #include <vector>
 #include <utility>
-#include "utils/hanning.h"
+#include "utils/trace.h"
+
+constexpr std::size_t SAMPLES_PER_BLOCK = 128;
+// About half a second of audio per trace section
+constexpr std::uint32_t TRACE_SLICE_HOPS = 64;
+
+namespace
+{
+// In long double, as the reference implementation does
+inline long double peakMagnitude(double power)
+{
+    return std::log(std::max(1.0l / 64, static_cast<long double>(power))) * 1477.3 + 6144;
+}
+} // namespace
 
 SignatureGenerator::SignatureGenerator()
-    : input_pending_processing_(), sample_processed_(0), max_time_seconds_(3.1),
-      next_signature_(16000, 0), samples_ring_buffer_(FFT_BUFFER_CHUNK_SIZE, 0),
+    : input_pending_processing_(), sample_processed_(0), partial_block_(), max_time_seconds_(3.1),
+      cancellation_token_(nullptr), hops_since_check_(0), stats_(nullptr),
+      kernels_(&GetSpectrumKernels()), next_signature_(16000, 0),
+      samples_ring_buffer_(FFT_BUFFER_CHUNK_SIZE, 0),
       fft_outputs_(256, {0.0}), spread_ffts_output_(256, {0.0})
 {
 }
@@ -21,104 +36,147 @@ void SignatureGenerator::FeedInput(const LowQualityTrack &input)
     input_pending_processing_.insert(input_pending_processing_.end(), input.begin(), input.end());
 }
 
+std::size_t SignatureGenerator::ProcessInput(const LowQualitySample *input, std::size_t count)
+{
+    std::size_t consumed = 0;
+    if (!partial_block_.empty())
+    {
+        if (IsSignatureComplete())
+        {
+            return 0;
+        }
+        consumed = std::min(count, SAMPLES_PER_BLOCK - partial_block_.size());
+        partial_block_.insert(partial_block_.end(), input, input + consumed);
+        if (partial_block_.size() < SAMPLES_PER_BLOCK)
+        {
+            return consumed;
+        }
+        processInput(partial_block_.data(), SAMPLES_PER_BLOCK);
+        partial_block_.clear();
+    }
+
+    while (count - consumed >= SAMPLES_PER_BLOCK && !IsSignatureComplete())
+    {
+        processInput(input + consumed, SAMPLES_PER_BLOCK);
+        consumed += SAMPLES_PER_BLOCK;
+    }
+    if (count - consumed < SAMPLES_PER_BLOCK && !IsSignatureComplete())
+    {
+        partial_block_.assign(input + consumed, input + count);
+        consumed = count;
+    }
+    return consumed;
+}
+
+bool SignatureGenerator::IsSignatureComplete() const
+{
+    const double num_samples = static_cast<double>(next_signature_.num_samples());
+    return num_samples / next_signature_.sample_rate() >= max_time_seconds_ &&
+           next_signature_.SumOfPeaksLength() >= MAX_PEAKS;
+}
+
+void SignatureGenerator::EnableLandmarks(const LandmarkConfig &config)
+{
+    landmark_stream_.reset(new LandmarkStream(config));
+    landmarks_.clear();
+}
+
+void SignatureGenerator::TakeLandmarks(std::vector<Landmark> *landmarks)
+{
+    if (landmarks->empty())
+    {
+        landmarks->swap(landmarks_);
+    }
+    else
+    {
+        landmarks->insert(landmarks->end(), landmarks_.begin(), landmarks_.end());
+    }
+    landmarks_.clear();
+}
+
 Signature SignatureGenerator::GetNextSignature()
 {
-    if (input_pending_processing_.size() - sample_processed_ < 128)
+    trace::Scope trace_scope("SignatureGenerator::GetNextSignature");
+    // Streamed input has already been analysed by ProcessInput()
+    if (next_signature_.num_samples() == 0 &&
+        input_pending_processing_.size() - sample_processed_ < SAMPLES_PER_BLOCK)
     {
         throw std::runtime_error("Not enough input to generate signature");
     }
 
-    double num_samples = static_cast<double>(next_signature_.num_samples());
-    while (input_pending_processing_.size() - sample_processed_ >= 128 &&
-           (num_samples / next_signature_.sample_rate() < max_time_seconds_ ||
-            next_signature_.SumOfPeaksLength() < MAX_PEAKS))
+    trace::Slices trace_slices("SignatureGenerator hops", TRACE_SLICE_HOPS);
+    while (input_pending_processing_.size() - sample_processed_ >= SAMPLES_PER_BLOCK &&
+           !IsSignatureComplete())
     {
-        LowQualityTrack input(input_pending_processing_.begin() + sample_processed_,
-                              input_pending_processing_.begin() + sample_processed_ + 128);
-
-        processInput(input);
-        sample_processed_ += 128;
-        num_samples = static_cast<double>(next_signature_.num_samples());
+        trace_slices.Tick();
+        processInput(input_pending_processing_.data() + sample_processed_, SAMPLES_PER_BLOCK);
+        sample_processed_ += SAMPLES_PER_BLOCK;
     }
 
+    next_signature_.set_digest(digest_builder_.Digest());
     Signature result = std::move(next_signature_);
     resetSignatureGenerater();
     return result; // RVO
 }
 
-void SignatureGenerator::processInput(const LowQualityTrack &input)
+void SignatureGenerator::processInput(const LowQualitySample *input, std::size_t size)
 {
-    next_signature_.Addnum_samples(input.size());
-    for (std::size_t chunk = 0; chunk < input.size(); chunk += 128)
+    next_signature_.Addnum_samples(size);
+    for (std::size_t chunk = 0; chunk < size; chunk += SAMPLES_PER_BLOCK)
     {
-        LowQualityTrack chunk_input(input.begin() + chunk, input.begin() + chunk + 128);
-
-        doFFT(chunk_input);
+        if (cancellation_token_ != nullptr && ++hops_since_check_ >= CANCELLATION_CHECK_HOPS)
+        {
+            hops_since_check_ = 0;
+            cancellation_token_->ThrowIfCancelled();
+        }
+        StageTimer fft_timer(stats_, PipelineStats::FFT);
+        doFFT(input + chunk, SAMPLES_PER_BLOCK);
+        fft_timer.Stop();
         doPeakSpreadingAndRecoginzation();
     }
 }
 
-void SignatureGenerator::doFFT(const LowQualityTrack &input)
+void SignatureGenerator::doFFT(const LowQualitySample *input, std::size_t size)
 {
-    std::copy(input.begin(), input.end(),
-              samples_ring_buffer_.begin() + samples_ring_buffer_.position());
+    std::copy(input, input + size, samples_ring_buffer_.begin() + samples_ring_buffer_.position());
 
-    samples_ring_buffer_.position() += input.size();
+    samples_ring_buffer_.position() += size;
     samples_ring_buffer_.position() %= FFT_BUFFER_CHUNK_SIZE;
-    samples_ring_buffer_.num_written() += input.size();
-
-    std::vector<long double> excerpt_from_ring_buffer(FFT_BUFFER_CHUNK_SIZE, 0.0);
-
-    std::copy(samples_ring_buffer_.begin() + samples_ring_buffer_.position(),
-              samples_ring_buffer_.end(), excerpt_from_ring_buffer.begin());
-
-    std::copy(samples_ring_buffer_.begin(),
-              samples_ring_buffer_.begin() + samples_ring_buffer_.position(),
-              excerpt_from_ring_buffer.begin() + FFT_BUFFER_CHUNK_SIZE -
-                  samples_ring_buffer_.position());
-
-    for (std::size_t i = 0; i < FFT_BUFFER_CHUNK_SIZE; ++i)
-    {
-        excerpt_from_ring_buffer[i] *= HANNIG_MATRIX[i];
-    }
+    samples_ring_buffer_.num_written() += size;
 
-    decltype(fft_object_)::FFTOutput real = fft_object_.RFFT(excerpt_from_ring_buffer);
-    fft_outputs_.Append(real);
+    // Windowed straight into FFTW's input, oldest sample first
+    kernels_->window(samples_ring_buffer_.data(), samples_ring_buffer_.position(),
+                     fft_object_.input());
+    const fftw_complex *fft = fft_object_.Execute();
+    kernels_->power_spectrum(reinterpret_cast<const double *>(fft), fft_outputs_.Next().data());
+    fft_outputs_.Advance();
 }
 
 void SignatureGenerator::doPeakSpreadingAndRecoginzation()
 {
+    StageTimer spreading_timer(stats_, PipelineStats::SPREADING);
     doPeakSpreading();
+    spreading_timer.Stop();
 
     if (spread_ffts_output_.num_written() >= 47)
     {
+        StageTimer recognition_timer(stats_, PipelineStats::RECOGNITION);
         doPeakRecognition();
     }
 }
 
 void SignatureGenerator::doPeakSpreading()
 {
-    auto spread_last_fft = fft_outputs_[fft_outputs_.position() - 1];
-
-    for (auto position = 0u; position < decltype(fft_object_)::OUTPUT_SIZE; ++position)
-    {
-        if (position < decltype(fft_object_)::OUTPUT_SIZE - 2)
-        {
-            spread_last_fft[position] = *std::max_element(spread_last_fft.begin() + position,
-                                                          spread_last_fft.begin() + position + 3);
-        }
+    auto &spread_last_fft = spread_ffts_output_.Next();
+    spread_last_fft = fft_outputs_[fft_outputs_.position() - 1];
 
-        auto max_value = spread_last_fft[position];
-        for (auto former_fft_num : {-1, -3, -6})
-        {
-            auto &former_fft_ouput =
-                spread_ffts_output_[(spread_ffts_output_.position() + former_fft_num) %
-                                  spread_ffts_output_.size()];
-            former_fft_ouput[position] = max_value =
-                std::max(max_value, former_fft_ouput[position]);
-        }
-    }
-    spread_ffts_output_.Append(spread_last_fft);
+    auto former_fft = [this](int former_fft_num) {
+        return spread_ffts_output_[(spread_ffts_output_.position() + former_fft_num) %
+                                   spread_ffts_output_.size()]
+            .data();
+    };
+    kernels_->spread(spread_last_fft.data(), former_fft(-1), former_fft(-3), former_fft(-6));
+    spread_ffts_output_.Advance();
 }
 
 void SignatureGenerator::doPeakRecognition()
@@ -127,77 +185,71 @@ void SignatureGenerator::doPeakRecognition()
     const auto &fft_minus_49 =
         spread_ffts_output_[(spread_ffts_output_.position() - 49) % spread_ffts_output_.size()];
 
+    // Bins that pass the checks against fft_minus_49, the rarer ones that
+    // follow are done per bin
+    std::uint16_t candidates[SPECTRUM_BINS];
+    const std::size_t candidate_count =
+        kernels_->find_peak_candidates(fft_minus_46.data(), fft_minus_49.data(), candidates);
+
     auto other_offsets = {-53, -45, 165, 172, 179, 186, 193, 200, 214, 221, 228, 235, 242, 249};
-    for (auto bin_position = 10u; bin_position < decltype(fft_object_)::OUTPUT_SIZE - 8; ++bin_position)
+    for (std::size_t candidate = 0; candidate < candidate_count; ++candidate)
     {
-        if (fft_minus_46[bin_position] >= 1.0 / 64.0 &&
-            fft_minus_46[bin_position] >= fft_minus_49[bin_position])
+        const std::uint32_t bin_position = candidates[candidate];
+        // Already below fft_minus_46, as are the fft_minus_49 neighbors
+        auto max_neighbor_in_other_adjacent_ffts = 0.0;
+        for (auto other_offset : other_offsets)
+        {
+            max_neighbor_in_other_adjacent_ffts = std::max(
+                max_neighbor_in_other_adjacent_ffts,
+                spread_ffts_output_[(spread_ffts_output_.position() + other_offset) %
+                                    spread_ffts_output_.size()][bin_position - 1]);
+        }
+        if (fft_minus_46[bin_position] <= max_neighbor_in_other_adjacent_ffts)
+        {
+            continue;
+        }
+
+        auto fft_number = spread_ffts_output_.num_written() - 46;
+        auto peak_magnitude = peakMagnitude(fft_minus_46[bin_position]);
+        auto peak_magnitude_before = peakMagnitude(fft_minus_46[bin_position - 1]);
+        auto peak_magnitude_after = peakMagnitude(fft_minus_46[bin_position + 1]);
+
+        auto peak_variation_1 = peak_magnitude * 2 - peak_magnitude_before - peak_magnitude_after;
+        auto peak_variation_2 =
+            (peak_magnitude_after - peak_magnitude_before) * 32 / peak_variation_1;
+
+        auto corrected_peak_frequency_bin = bin_position * 64.0 + peak_variation_2;
+        auto frequency_hz = corrected_peak_frequency_bin * (16000.0l / 2. / 1024. / 64.);
+
+        auto band = FrequencyBand();
+        if (frequency_hz < 250)
+            continue;
+        else if (frequency_hz < 520)
+            band = FrequencyBand::_250_520;
+        else if (frequency_hz < 1450)
+            band = FrequencyBand::_520_1450;
+        else if (frequency_hz < 3500)
+            band = FrequencyBand::_1450_3500;
+        else if (frequency_hz <= 5500)
+            band = FrequencyBand::_3500_5500;
+        else
+            continue;
+
+        // Bands are only added once they have a peak, empty ones would be encoded
+        auto &band_peaks = next_signature_.frequency_band_to_peaks()[band];
+        if (band_peaks.empty())
+        {
+            band_peaks.reserve(PEAKS_RESERVED_PER_BAND);
+        }
+
+        band_peaks.push_back(FrequencyPeak(fft_number, static_cast<std::int32_t>(peak_magnitude),
+                                           static_cast<std::int32_t>(corrected_peak_frequency_bin),
+                                           LOW_QUALITY_SAMPLE_RATE));
+        const FrequencyPeak &peak = band_peaks.back();
+        digest_builder_.AddPeak(band, peak);
+        if (landmark_stream_)
         {
-            auto max_neighbor_in_fft_minus_49 = 0.0l;
-            for (auto neighbor_offset : {-10, -7, -4, -3, 1, 2, 5, 8})
-            {
-                max_neighbor_in_fft_minus_49 = std::max(
-                    max_neighbor_in_fft_minus_49, fft_minus_49[bin_position + neighbor_offset]);
-            }
-
-            if (fft_minus_46[bin_position] > max_neighbor_in_fft_minus_49)
-            {
-                auto max_neighbor_in_other_adjacent_ffts = max_neighbor_in_fft_minus_49;
-                for (auto other_offset : other_offsets)
-                {
-                    max_neighbor_in_other_adjacent_ffts = std::max(
-                        max_neighbor_in_other_adjacent_ffts,
-                        spread_ffts_output_[(spread_ffts_output_.position() + other_offset) %
-                                            spread_ffts_output_.size()][bin_position - 1]);
-                }
-
-                if (fft_minus_46[bin_position] > max_neighbor_in_other_adjacent_ffts)
-                {
-                    auto fft_number = spread_ffts_output_.num_written() - 46;
-                    auto peak_magnitude =
-                        std::log(std::max(1.0l / 64, fft_minus_46[bin_position])) * 1477.3 + 6144;
-                    auto peak_magnitude_before =
-                        std::log(std::max(1.0l / 64, fft_minus_46[bin_position - 1])) * 1477.3 +
-                        6144;
-                    auto peak_magnitude_after =
-                        std::log(std::max(1.0l / 64, fft_minus_46[bin_position + 1])) * 1477.3 +
-                        6144;
-
-                    auto peak_variation_1 =
-                        peak_magnitude * 2 - peak_magnitude_before - peak_magnitude_after;
-                    auto peak_variation_2 =
-                        (peak_magnitude_after - peak_magnitude_before) * 32 / peak_variation_1;
-
-                    auto corrected_peak_frequency_bin = bin_position * 64.0 + peak_variation_2;
-                    auto frequency_hz =
-                        corrected_peak_frequency_bin * (16000.0l / 2. / 1024. / 64.);
-
-                    auto band = FrequencyBand();
-                    if (frequency_hz < 250)
-                        continue;
-                    else if (frequency_hz < 520)
-                        band = FrequencyBand::_250_520;
-                    else if (frequency_hz < 1450)
-                        band = FrequencyBand::_520_1450;
-                    else if (frequency_hz < 3500)
-                        band = FrequencyBand::_1450_3500;
-                    else if (frequency_hz <= 5500)
-                        band = FrequencyBand::_3500_5500;
-                    else
-                        continue;
-
-                    auto &band_to_sound_peaks = next_signature_.frequency_band_to_peaks();
-                    if (band_to_sound_peaks.find(band) == band_to_sound_peaks.end())
-                    {
-                        band_to_sound_peaks[band] = std::list<FrequencyPeak>();
-                    }
-
-                    band_to_sound_peaks[band].push_back(
-                        FrequencyPeak(fft_number, static_cast<std::int32_t>(peak_magnitude),
-                                      static_cast<std::int32_t>(corrected_peak_frequency_bin),
-                                      LOW_QUALITY_SAMPLE_RATE));
-                }
-            }
+            landmark_stream_->AddPeak(band, peak, &landmarks_);
         }
     }
 }
@@ -205,7 +257,13 @@ void SignatureGenerator::doPeakRecognition()
 void SignatureGenerator::resetSignatureGenerater()
 {
     next_signature_ = Signature(16000, 0);
-    samples_ring_buffer_ = RingBuffer<std::int16_t>(FFT_BUFFER_CHUNK_SIZE, 0);
-    fft_outputs_ = RingBuffer<decltype(fft_object_)::FFTOutput>(256, {0.0});
-    spread_ffts_output_ = RingBuffer<decltype(fft_object_)::FFTOutput>(256, {0.0});
+    digest_builder_.Reset();
+    if (landmark_stream_)
+    {
+        landmark_stream_->Reset();
+    }
+    // In place, the two spectrum rings are 2 MB each
+    samples_ring_buffer_.Reset(0);
+    fft_outputs_.Reset({0.0});
+    spread_ffts_output_.Reset({0.0});
 }
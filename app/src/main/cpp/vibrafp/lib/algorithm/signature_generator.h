@@ -1,13 +1,24 @@
 #ifndef LIB_ALGORITHM_SIGNATURE_GENERATOR_H_
 #define LIB_ALGORITHM_SIGNATURE_GENERATOR_H_
 
+#include <memory>
+#include <vector>
 #include "algorithm/signature.h"
+#include "algorithm/signature_digest.h"
+#include "algorithm/spectrum_kernels.h"
 #include "audio/downsampler.h"
+#include "match/landmark.h"
+#include "utils/cancellation.h"
 #include "utils/fft.h"
+#include "utils/pipeline_stats.h"
 #include "utils/ring_buffer.h"
 
 constexpr std::size_t MAX_PEAKS = 255u;
-constexpr std::size_t FFT_BUFFER_CHUNK_SIZE = 2048u;
+// Peak list capacity of a band when its first peak is found, about twice
+// what a 12 s signature of music has, so that it does not grow hop by hop
+constexpr std::size_t PEAKS_RESERVED_PER_BAND = 256u;
+// One check costs a clock read, 32 hops are about 256 ms of audio
+constexpr std::uint32_t CANCELLATION_CHECK_HOPS = 32u;
 
 class SignatureGenerator
 {
@@ -16,6 +27,16 @@ public:
     void FeedInput(const LowQualityTrack &input);
     Signature GetNextSignature();
 
+    // Streaming alternative to FeedInput(): the samples are analysed right
+    // away instead of being buffered, only a partial 128 sample block is
+    // carried over. Returns how many samples were taken, which is less than
+    // `count` once the current signature is complete.
+    std::size_t ProcessInput(const LowQualitySample *input, std::size_t count);
+
+    // True once the signature being built is long enough and has enough
+    // peaks, GetNextSignature() would not analyse more input.
+    bool IsSignatureComplete() const;
+
     inline void AddSampleProcessed(std::uint32_t sample_processed)
     {
         sample_processed_ += sample_processed;
@@ -26,9 +47,36 @@ public:
         max_time_seconds_ = max_time_seconds;
     }
 
+    // Polled every CANCELLATION_CHECK_HOPS hops, processing throws
+    // OperationCancelled once it fires. The token must outlive the generator.
+    inline void set_cancellation_token(const CancellationToken *token)
+    {
+        cancellation_token_ = token;
+    }
+
+    // Adds the time of the FFT, spreading and recognition stages to `stats`,
+    // which must outlive the generator. Null, the default, stops timing.
+    inline void set_stats(PipelineStats *stats)
+    {
+        stats_ = stats;
+    }
+
+    // Also pairs the peaks into landmarks as they are found, for indexing
+    // from the same pass that builds the signature. Landmark anchor passes
+    // count from the start of the current signature, like its peaks.
+    // Throws std::invalid_argument if the config is out of range.
+    void EnableLandmarks(const LandmarkConfig &config);
+
+    // Moves the landmarks completed since the last call to the end of
+    // `landmarks`. Those of a peak are complete once the peak is found, about
+    // 46 hops after its audio, so little is held back between calls.
+    void TakeLandmarks(std::vector<Landmark> *landmarks);
+
 private:
-    void processInput(const LowQualityTrack &input);
-    void doFFT(const LowQualityTrack &input);
+    friend class SignatureGeneratorStages; // per-stage timing in tools/vibra_bench.cpp
+
+    void processInput(const LowQualitySample *input, std::size_t size);
+    void doFFT(const LowQualitySample *input, std::size_t size);
     void doPeakSpreadingAndRecoginzation();
     void doPeakSpreading();
     void doPeakRecognition();
@@ -37,10 +85,18 @@ private:
 private:
     LowQualityTrack input_pending_processing_;
     std::uint32_t sample_processed_;
+    LowQualityTrack partial_block_; // ProcessInput() samples short of a block
     double max_time_seconds_;
+    const CancellationToken *cancellation_token_;
+    std::uint32_t hops_since_check_;
+    PipelineStats *stats_;
+    const SpectrumKernels *kernels_; // picked at construction
 
     fft::FFT<FFT_BUFFER_CHUNK_SIZE> fft_object_;
     Signature next_signature_;
+    DigestBuilder digest_builder_; // digest of next_signature_
+    std::unique_ptr<LandmarkStream> landmark_stream_; // null unless EnableLandmarks()
+    std::vector<Landmark> landmarks_;                 // not yet taken
     RingBuffer<std::int16_t> samples_ring_buffer_;
     RingBuffer<decltype(fft_object_)::FFTOutput> fft_outputs_;
     RingBuffer<decltype(fft_object_)::FFTOutput> spread_ffts_output_;
@@ -0,0 +1,407 @@
+#include "algorithm/spectrum_kernels.h"
+#include <algorithm>
+#include <cfloat>
+#include "utils/cpu_features.h"
+#include "utils/hanning.h"
+
+// NEON has double lanes on AArch64 only
+#if defined(__aarch64__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define SPECTRUM_NEON 1
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#define SPECTRUM_X86 1
+#include <immintrin.h>
+#endif
+
+// This file is built with -ffp-contract=off: a fused multiply-add rounds
+// differently, and would only happen in some of the kernels.
+
+namespace
+{
+constexpr double POWER_SCALE = 1.0 / (1 << 17);
+constexpr double MIN_POWER = 1e-10;
+constexpr double MIN_PEAK_POWER = 1.0 / 64.0;
+constexpr int NEIGHBOR_OFFSETS[] = {-10, -7, -4, -3, 1, 2, 5, 8};
+
+// The windowed samples used to be computed in long double and rounded to
+// double for FFTW. A double product rounds the exact one the same way where
+// long double is double, or wide enough to hold a 16 x 53 bit product. The
+// 64-bit mantissa of x87 rounds twice, so the long double math stays there.
+#if LDBL_MANT_DIG == DBL_MANT_DIG || LDBL_MANT_DIG >= DBL_MANT_DIG + 16
+#define DOUBLE_WINDOW_IS_EXACT 1
+#endif
+
+inline double windowSample(std::int16_t sample, double weight)
+{
+#if defined(DOUBLE_WINDOW_IS_EXACT)
+    return sample * weight;
+#else
+    return static_cast<double>(static_cast<long double>(sample) * weight);
+#endif
+}
+
+inline double power(double real, double imag)
+{
+    const double value = (real * real + imag * imag) * POWER_SCALE;
+    return value < MIN_POWER ? MIN_POWER : value;
+}
+
+using WindowSegmentFunc = void (*)(const std::int16_t *samples, const double *weights,
+                                   double *out, std::size_t count);
+
+void windowSegmentScalar(const std::int16_t *samples, const double *weights, double *out,
+                         std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        out[i] = windowSample(samples[i], weights[i]);
+    }
+}
+
+// The oldest sample is at `position`, the ring wraps once
+template <WindowSegmentFunc SEGMENT>
+void windowKernel(const std::int16_t *ring, std::size_t position, double *out)
+{
+    const std::size_t wrap = FFT_BUFFER_CHUNK_SIZE - position;
+    SEGMENT(ring + position, HANNIG_MATRIX, out, wrap);
+    SEGMENT(ring, HANNIG_MATRIX + wrap, out + wrap, position);
+}
+
+void powerSpectrumTail(const double *fft, double *out, std::size_t begin)
+{
+    for (std::size_t i = begin; i < SPECTRUM_BINS; ++i)
+    {
+        out[i] = power(fft[2 * i], fft[2 * i + 1]);
+    }
+}
+
+void powerSpectrumScalar(const double *fft, double *out)
+{
+    powerSpectrumTail(fft, out, 0);
+}
+
+// Every bin reads the next two before they are replaced
+void spreadFrequencyTail(double *spectrum, std::size_t begin)
+{
+    for (std::size_t i = begin; i + 2 < SPECTRUM_BINS; ++i)
+    {
+        spectrum[i] = std::max(std::max(spectrum[i], spectrum[i + 1]), spectrum[i + 2]);
+    }
+}
+
+void spreadTimeTail(const double *spectrum, double *minus_1, double *minus_3, double *minus_6,
+                    std::size_t begin)
+{
+    for (std::size_t i = begin; i < SPECTRUM_BINS; ++i)
+    {
+        double max_value = spectrum[i];
+        max_value = minus_1[i] = std::max(max_value, minus_1[i]);
+        max_value = minus_3[i] = std::max(max_value, minus_3[i]);
+        minus_6[i] = std::max(max_value, minus_6[i]);
+    }
+}
+
+void spreadScalar(double *spectrum, double *minus_1, double *minus_3, double *minus_6)
+{
+    spreadFrequencyTail(spectrum, 0);
+    spreadTimeTail(spectrum, minus_1, minus_3, minus_6, 0);
+}
+
+std::size_t findPeakCandidatesTail(const double *minus_46, const double *minus_49,
+                                   std::uint16_t *bins, std::size_t count, std::size_t begin)
+{
+    for (std::size_t bin = begin; bin < PEAK_END_BIN; ++bin)
+    {
+        const double value = minus_46[bin];
+        if (value >= MIN_PEAK_POWER && value >= minus_49[bin])
+        {
+            double max_neighbor = 0.0;
+            for (int offset : NEIGHBOR_OFFSETS)
+            {
+                max_neighbor = std::max(max_neighbor, minus_49[bin + offset]);
+            }
+            if (value > max_neighbor)
+            {
+                bins[count++] = static_cast<std::uint16_t>(bin);
+            }
+        }
+    }
+    return count;
+}
+
+std::size_t findPeakCandidatesScalar(const double *minus_46, const double *minus_49,
+                                     std::uint16_t *bins)
+{
+    return findPeakCandidatesTail(minus_46, minus_49, bins, 0, PEAK_FIRST_BIN);
+}
+
+inline std::size_t appendBins(unsigned int mask, std::size_t bin, std::uint16_t *bins,
+                              std::size_t count)
+{
+    for (; mask != 0; mask &= mask - 1)
+    {
+        bins[count++] = static_cast<std::uint16_t>(bin + __builtin_ctz(mask));
+    }
+    return count;
+}
+
+#if defined(SPECTRUM_NEON)
+void windowSegmentNeon(const std::int16_t *samples, const double *weights, double *out,
+                       std::size_t count)
+{
+    std::size_t i = 0;
+#if defined(DOUBLE_WINDOW_IS_EXACT)
+    for (; i + 4 <= count; i += 4)
+    {
+        // int16 to float is exact
+        float32x4_t values = vcvtq_f32_s32(vmovl_s16(vld1_s16(samples + i)));
+        vst1q_f64(out + i, vmulq_f64(vcvt_f64_f32(vget_low_f32(values)), vld1q_f64(weights + i)));
+        vst1q_f64(out + i + 2, vmulq_f64(vcvt_high_f64_f32(values), vld1q_f64(weights + i + 2)));
+    }
+#endif
+    windowSegmentScalar(samples + i, weights + i, out + i, count - i);
+}
+
+void powerSpectrumNeon(const double *fft, double *out)
+{
+    const float64x2_t scale = vdupq_n_f64(POWER_SCALE);
+    const float64x2_t min_power = vdupq_n_f64(MIN_POWER);
+    std::size_t i = 0;
+    for (; i + 2 <= SPECTRUM_BINS; i += 2)
+    {
+        float64x2x2_t values = vld2q_f64(fft + 2 * i);
+        float64x2_t sum = vaddq_f64(vmulq_f64(values.val[0], values.val[0]),
+                                    vmulq_f64(values.val[1], values.val[1]));
+        vst1q_f64(out + i, vmaxq_f64(vmulq_f64(sum, scale), min_power));
+    }
+    powerSpectrumTail(fft, out, i);
+}
+
+void spreadNeon(double *spectrum, double *minus_1, double *minus_3, double *minus_6)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= SPECTRUM_BINS; i += 2)
+    {
+        float64x2_t max_value = vmaxq_f64(vld1q_f64(spectrum + i), vld1q_f64(spectrum + i + 1));
+        vst1q_f64(spectrum + i, vmaxq_f64(max_value, vld1q_f64(spectrum + i + 2)));
+    }
+    spreadFrequencyTail(spectrum, i);
+
+    for (i = 0; i + 2 <= SPECTRUM_BINS; i += 2)
+    {
+        float64x2_t max_value = vmaxq_f64(vld1q_f64(spectrum + i), vld1q_f64(minus_1 + i));
+        vst1q_f64(minus_1 + i, max_value);
+        max_value = vmaxq_f64(max_value, vld1q_f64(minus_3 + i));
+        vst1q_f64(minus_3 + i, max_value);
+        vst1q_f64(minus_6 + i, vmaxq_f64(max_value, vld1q_f64(minus_6 + i)));
+    }
+    spreadTimeTail(spectrum, minus_1, minus_3, minus_6, i);
+}
+
+std::size_t findPeakCandidatesNeon(const double *minus_46, const double *minus_49,
+                                   std::uint16_t *bins)
+{
+    const float64x2_t min_power = vdupq_n_f64(MIN_PEAK_POWER);
+    std::size_t count = 0;
+    std::size_t bin = PEAK_FIRST_BIN;
+    for (; bin + 2 <= PEAK_END_BIN; bin += 2)
+    {
+        const float64x2_t value = vld1q_f64(minus_46 + bin);
+        uint64x2_t passed = vandq_u64(vcgeq_f64(value, min_power),
+                                      vcgeq_f64(value, vld1q_f64(minus_49 + bin)));
+        if ((vgetq_lane_u64(passed, 0) | vgetq_lane_u64(passed, 1)) == 0)
+        {
+            continue;
+        }
+        float64x2_t max_neighbor = vdupq_n_f64(0.0);
+        for (int offset : NEIGHBOR_OFFSETS)
+        {
+            max_neighbor = vmaxq_f64(max_neighbor, vld1q_f64(minus_49 + bin + offset));
+        }
+        passed = vandq_u64(passed, vcgtq_f64(value, max_neighbor));
+        const unsigned int mask = static_cast<unsigned int>(vgetq_lane_u64(passed, 0) & 1) |
+                                  static_cast<unsigned int>(vgetq_lane_u64(passed, 1) & 2);
+        count = appendBins(mask, bin, bins, count);
+    }
+    return findPeakCandidatesTail(minus_46, minus_49, bins, count, bin);
+}
+#elif defined(SPECTRUM_X86)
+__attribute__((target("sse2"))) void powerSpectrumSse2(const double *fft, double *out)
+{
+    const __m128d scale = _mm_set1_pd(POWER_SCALE);
+    const __m128d min_power = _mm_set1_pd(MIN_POWER);
+    std::size_t i = 0;
+    for (; i + 2 <= SPECTRUM_BINS; i += 2)
+    {
+        __m128d first = _mm_loadu_pd(fft + 2 * i);
+        __m128d second = _mm_loadu_pd(fft + 2 * i + 2);
+        first = _mm_mul_pd(first, first);
+        second = _mm_mul_pd(second, second);
+        __m128d sum = _mm_add_pd(_mm_unpacklo_pd(first, second), _mm_unpackhi_pd(first, second));
+        _mm_storeu_pd(out + i, _mm_max_pd(_mm_mul_pd(sum, scale), min_power));
+    }
+    powerSpectrumTail(fft, out, i);
+}
+
+__attribute__((target("sse2"))) void spreadSse2(double *spectrum, double *minus_1,
+                                                double *minus_3, double *minus_6)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= SPECTRUM_BINS; i += 2)
+    {
+        __m128d max_value = _mm_max_pd(_mm_loadu_pd(spectrum + i), _mm_loadu_pd(spectrum + i + 1));
+        _mm_storeu_pd(spectrum + i, _mm_max_pd(max_value, _mm_loadu_pd(spectrum + i + 2)));
+    }
+    spreadFrequencyTail(spectrum, i);
+
+    for (i = 0; i + 2 <= SPECTRUM_BINS; i += 2)
+    {
+        __m128d max_value = _mm_max_pd(_mm_loadu_pd(spectrum + i), _mm_loadu_pd(minus_1 + i));
+        _mm_storeu_pd(minus_1 + i, max_value);
+        max_value = _mm_max_pd(max_value, _mm_loadu_pd(minus_3 + i));
+        _mm_storeu_pd(minus_3 + i, max_value);
+        _mm_storeu_pd(minus_6 + i, _mm_max_pd(max_value, _mm_loadu_pd(minus_6 + i)));
+    }
+    spreadTimeTail(spectrum, minus_1, minus_3, minus_6, i);
+}
+
+__attribute__((target("sse2"))) std::size_t findPeakCandidatesSse2(const double *minus_46,
+                                                                   const double *minus_49,
+                                                                   std::uint16_t *bins)
+{
+    const __m128d min_power = _mm_set1_pd(MIN_PEAK_POWER);
+    std::size_t count = 0;
+    std::size_t bin = PEAK_FIRST_BIN;
+    for (; bin + 2 <= PEAK_END_BIN; bin += 2)
+    {
+        const __m128d value = _mm_loadu_pd(minus_46 + bin);
+        __m128d passed = _mm_and_pd(_mm_cmpge_pd(value, min_power),
+                                    _mm_cmpge_pd(value, _mm_loadu_pd(minus_49 + bin)));
+        if (_mm_movemask_pd(passed) == 0)
+        {
+            continue;
+        }
+        __m128d max_neighbor = _mm_setzero_pd();
+        for (int offset : NEIGHBOR_OFFSETS)
+        {
+            max_neighbor = _mm_max_pd(max_neighbor, _mm_loadu_pd(minus_49 + bin + offset));
+        }
+        passed = _mm_and_pd(passed, _mm_cmpgt_pd(value, max_neighbor));
+        count = appendBins(static_cast<unsigned int>(_mm_movemask_pd(passed)), bin, bins, count);
+    }
+    return findPeakCandidatesTail(minus_46, minus_49, bins, count, bin);
+}
+
+__attribute__((target("avx2"))) void powerSpectrumAvx2(const double *fft, double *out)
+{
+    const __m256d scale = _mm256_set1_pd(POWER_SCALE);
+    const __m256d min_power = _mm256_set1_pd(MIN_POWER);
+    std::size_t i = 0;
+    for (; i + 4 <= SPECTRUM_BINS; i += 4)
+    {
+        __m256d first = _mm256_loadu_pd(fft + 2 * i);
+        __m256d second = _mm256_loadu_pd(fft + 2 * i + 4);
+        first = _mm256_mul_pd(first, first);
+        second = _mm256_mul_pd(second, second);
+        // Adds within 128-bit lanes, giving bins 0 2 1 3
+        __m256d sum = _mm256_permute4x64_pd(_mm256_hadd_pd(first, second), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_pd(out + i, _mm256_max_pd(_mm256_mul_pd(sum, scale), min_power));
+    }
+    powerSpectrumTail(fft, out, i);
+}
+
+__attribute__((target("avx2"))) void spreadAvx2(double *spectrum, double *minus_1,
+                                                double *minus_3, double *minus_6)
+{
+    std::size_t i = 0;
+    for (; i + 6 <= SPECTRUM_BINS; i += 4)
+    {
+        __m256d max_value =
+            _mm256_max_pd(_mm256_loadu_pd(spectrum + i), _mm256_loadu_pd(spectrum + i + 1));
+        _mm256_storeu_pd(spectrum + i, _mm256_max_pd(max_value, _mm256_loadu_pd(spectrum + i + 2)));
+    }
+    spreadFrequencyTail(spectrum, i);
+
+    for (i = 0; i + 4 <= SPECTRUM_BINS; i += 4)
+    {
+        __m256d max_value =
+            _mm256_max_pd(_mm256_loadu_pd(spectrum + i), _mm256_loadu_pd(minus_1 + i));
+        _mm256_storeu_pd(minus_1 + i, max_value);
+        max_value = _mm256_max_pd(max_value, _mm256_loadu_pd(minus_3 + i));
+        _mm256_storeu_pd(minus_3 + i, max_value);
+        _mm256_storeu_pd(minus_6 + i, _mm256_max_pd(max_value, _mm256_loadu_pd(minus_6 + i)));
+    }
+    spreadTimeTail(spectrum, minus_1, minus_3, minus_6, i);
+}
+
+__attribute__((target("avx2"))) std::size_t findPeakCandidatesAvx2(const double *minus_46,
+                                                                   const double *minus_49,
+                                                                   std::uint16_t *bins)
+{
+    const __m256d min_power = _mm256_set1_pd(MIN_PEAK_POWER);
+    std::size_t count = 0;
+    std::size_t bin = PEAK_FIRST_BIN;
+    for (; bin + 4 <= PEAK_END_BIN; bin += 4)
+    {
+        const __m256d value = _mm256_loadu_pd(minus_46 + bin);
+        __m256d passed =
+            _mm256_and_pd(_mm256_cmp_pd(value, min_power, _CMP_GE_OQ),
+                          _mm256_cmp_pd(value, _mm256_loadu_pd(minus_49 + bin), _CMP_GE_OQ));
+        if (_mm256_movemask_pd(passed) == 0)
+        {
+            continue;
+        }
+        __m256d max_neighbor = _mm256_setzero_pd();
+        for (int offset : NEIGHBOR_OFFSETS)
+        {
+            max_neighbor = _mm256_max_pd(max_neighbor, _mm256_loadu_pd(minus_49 + bin + offset));
+        }
+        passed = _mm256_and_pd(passed, _mm256_cmp_pd(value, max_neighbor, _CMP_GT_OQ));
+        count =
+            appendBins(static_cast<unsigned int>(_mm256_movemask_pd(passed)), bin, bins, count);
+    }
+    return findPeakCandidatesTail(minus_46, minus_49, bins, count, bin);
+}
+#endif
+
+const SpectrumKernels SCALAR_KERNELS = {&windowKernel<&windowSegmentScalar>, &powerSpectrumScalar,
+                                        &spreadScalar, &findPeakCandidatesScalar, "scalar"};
+
+// x86 keeps the scalar window, see DOUBLE_WINDOW_IS_EXACT
+#if defined(SPECTRUM_NEON)
+const SpectrumKernels NEON_KERNELS = {&windowKernel<&windowSegmentNeon>, &powerSpectrumNeon,
+                                      &spreadNeon, &findPeakCandidatesNeon, "neon"};
+#elif defined(SPECTRUM_X86)
+const SpectrumKernels SSE2_KERNELS = {&windowKernel<&windowSegmentScalar>, &powerSpectrumSse2,
+                                      &spreadSse2, &findPeakCandidatesSse2, "sse2"};
+const SpectrumKernels AVX2_KERNELS = {&windowKernel<&windowSegmentScalar>, &powerSpectrumAvx2,
+                                      &spreadAvx2, &findPeakCandidatesAvx2, "avx2"};
+#endif
+
+const SpectrumKernels &selectKernels(const cpu::Features &features)
+{
+#if defined(SPECTRUM_NEON)
+    if (features.neon)
+    {
+        return NEON_KERNELS;
+    }
+#elif defined(SPECTRUM_X86)
+    if (features.avx2)
+    {
+        return AVX2_KERNELS;
+    }
+    if (features.sse2)
+    {
+        return SSE2_KERNELS;
+    }
+#endif
+    (void)features;
+    return SCALAR_KERNELS;
+}
+} // namespace
+
+const SpectrumKernels &GetSpectrumKernels()
+{
+    static const SpectrumKernels &selected = selectKernels(cpu::Detected());
+    return cpu::IsScalarForced() ? SCALAR_KERNELS : selected;
+}
@@ -0,0 +1,45 @@
+#ifndef LIB_ALGORITHM_SPECTRUM_KERNELS_H_
+#define LIB_ALGORITHM_SPECTRUM_KERNELS_H_
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr std::size_t FFT_BUFFER_CHUNK_SIZE = 2048u;
+constexpr std::size_t SPECTRUM_BINS = FFT_BUFFER_CHUNK_SIZE / 2 + 1;
+// Peaks are looked for in bins [PEAK_FIRST_BIN, PEAK_END_BIN), their
+// neighbors reach 10 bins below and 8 above
+constexpr std::size_t PEAK_FIRST_BIN = 10u;
+constexpr std::size_t PEAK_END_BIN = SPECTRUM_BINS - 8u;
+
+// The per-hop loops of SignatureGenerator. Every instruction set gets the
+// same results bit for bit as the portable versions, which are what the
+// vectorized ones are checked against with VIBRA_FORCE_SCALAR.
+struct SpectrumKernels
+{
+    // out[i] = ring[(position + i) % FFT_BUFFER_CHUNK_SIZE] * HANNIG_MATRIX[i]
+    void (*window)(const std::int16_t *ring, std::size_t position, double *out);
+
+    // out[i] = max(|fft[i]|^2 / 2^17, 1e-10) over SPECTRUM_BINS complex
+    // values, stored as interleaved real and imaginary parts
+    void (*power_spectrum)(const double *fft, double *out);
+
+    // Replaces each bin of `spectrum` with the max of it and the next two,
+    // then raises the same bin of the spectra 1, 3 and 6 hops back to the
+    // running max of those before them.
+    void (*spread)(double *spectrum, double *minus_1, double *minus_3, double *minus_6);
+
+    // Writes the bins of [PEAK_FIRST_BIN, PEAK_END_BIN) that may hold a peak
+    // of `minus_46` to `bins` in increasing order, and returns how many. A bin
+    // is at least 1/64, at least the same bin of the spread `minus_49` and
+    // above its neighbors -10, -7, -4, -3, +1, +2, +5 and +8 there.
+    std::size_t (*find_peak_candidates)(const double *minus_46, const double *minus_49,
+                                        std::uint16_t *bins);
+
+    const char *name; // instruction set, e.g. "avx2"
+};
+
+// The best kernels of cpu::Enabled(), looked up once. The portable ones
+// while cpu::SetScalarForced() is on.
+const SpectrumKernels &GetSpectrumKernels();
+
+#endif // LIB_ALGORITHM_SPECTRUM_KERNELS_H_
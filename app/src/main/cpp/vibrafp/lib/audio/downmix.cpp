@@ -0,0 +1,514 @@
+#include "audio/downmix.h"
+#include <algorithm>
+#include <cstring>
+#include "utils/cpu_features.h"
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DOWNMIX_NEON 1
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#define DOWNMIX_X86 1
+#include <immintrin.h>
+#endif
+
+namespace
+{
+// Each reader loads one sample as Value. Multiplying by scale() maps the
+// format's full range onto the int16 range used by LowQualityTrack.
+struct Int8Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 1;
+    static constexpr Value scale()
+    {
+        return 256.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        return static_cast<std::int8_t>(p[0]);
+    }
+};
+
+struct Uint8Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 1;
+    static constexpr Value scale()
+    {
+        return 256.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        return static_cast<std::int32_t>(p[0]) - 128;
+    }
+};
+
+struct Int16Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 2;
+    static constexpr Value scale()
+    {
+        return 1.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        std::int16_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+};
+
+struct Int24Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 3;
+    static constexpr Value scale()
+    {
+        return 1.0f / 256.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        return static_cast<std::int32_t>(p[0] | (p[1] << 8) |
+                                         (static_cast<std::int8_t>(p[2]) * (1 << 16)));
+    }
+};
+
+struct Int32Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 4;
+    static constexpr Value scale()
+    {
+        return 1.0f / 65536.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        std::int32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return static_cast<Value>(value);
+    }
+};
+
+struct Float32Reader
+{
+    using Value = float;
+    static constexpr std::uint32_t WIDTH = 4;
+    static constexpr Value scale()
+    {
+        return 32767.0f;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        float value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+};
+
+struct Float64Reader
+{
+    using Value = double;
+    static constexpr std::uint32_t WIDTH = 8;
+    static constexpr Value scale()
+    {
+        return 32767.0;
+    }
+    static inline Value Read(const std::uint8_t *p)
+    {
+        double value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+};
+
+// CHANNELS == 0 means the channel count is only known at run time.
+template <typename Reader, std::uint32_t CHANNELS>
+inline void downmixScalar(float *dst, const std::uint8_t *src, std::size_t begin,
+                          std::size_t end, std::uint32_t channels)
+{
+    using Value = typename Reader::Value;
+    const std::uint32_t count = CHANNELS != 0 ? CHANNELS : channels;
+    const std::size_t stride = static_cast<std::size_t>(Reader::WIDTH) * count;
+    const Value scale = Reader::scale() / static_cast<Value>(count);
+
+    const std::uint8_t *frame = src + begin * stride;
+    for (std::size_t i = begin; i < end; ++i, frame += stride)
+    {
+        Value sum = Reader::Read(frame);
+        for (std::uint32_t k = 1; k < count; ++k)
+        {
+            sum += Reader::Read(frame + k * Reader::WIDTH);
+        }
+        dst[i] = static_cast<float>(sum * scale);
+    }
+}
+
+template <typename Reader, std::uint32_t CHANNELS>
+void downmixKernel(float *dst, const void *src, std::size_t frame_count, std::uint32_t channels)
+{
+    downmixScalar<Reader, CHANNELS>(dst, static_cast<const std::uint8_t *>(src), 0, frame_count,
+                                    channels);
+}
+
+// Sign extends `count` packed little-endian 24-bit samples into int32.
+using UnpackInt24Func = void (*)(const std::uint8_t *src, std::int32_t *dst, std::size_t count);
+
+inline void unpackInt24Tail(const std::uint8_t *src, std::int32_t *dst, std::size_t begin,
+                            std::size_t count)
+{
+    for (std::size_t i = begin; i < count; ++i)
+    {
+        const std::uint8_t *p = src + 3 * i;
+        dst[i] = p[0] | (p[1] << 8) | (static_cast<std::int8_t>(p[2]) * (1 << 16));
+    }
+}
+
+void unpackInt24Scalar(const std::uint8_t *src, std::int32_t *dst, std::size_t count)
+{
+    unpackInt24Tail(src, dst, 0, count);
+}
+
+// Packed 24-bit is unpacked a block at a time, then downmixed from int32.
+template <std::uint32_t CHANNELS, UnpackInt24Func UNPACK>
+void downmixInt24Kernel(float *dst, const void *src, std::size_t frame_count,
+                        std::uint32_t channels)
+{
+    constexpr std::size_t kBlockSamples = 1024;
+    const std::uint32_t count = CHANNELS != 0 ? CHANNELS : channels;
+    const auto *in = static_cast<const std::uint8_t *>(src);
+    if (count > kBlockSamples)
+    {
+        downmixScalar<Int24Reader, 0>(dst, in, 0, frame_count, count);
+        return;
+    }
+
+    const float scale = Int24Reader::scale() / static_cast<float>(count);
+    const std::size_t block_frames = kBlockSamples / count;
+    std::int32_t block[kBlockSamples];
+    for (std::size_t begin = 0; begin < frame_count; begin += block_frames)
+    {
+        const std::size_t frames = std::min(block_frames, frame_count - begin);
+        UNPACK(in + begin * count * Int24Reader::WIDTH, block, frames * count);
+        for (std::size_t i = 0; i < frames; ++i)
+        {
+            float sum = static_cast<float>(block[i * count]);
+            for (std::uint32_t k = 1; k < count; ++k)
+            {
+                sum += static_cast<float>(block[i * count + k]);
+            }
+            dst[begin + i] = sum * scale;
+        }
+    }
+}
+
+// Vectorized versions of the formats Android actually records and decodes to.
+// They produce the same values as downmixScalar.
+#if defined(DOWNMIX_NEON)
+void unpackInt24Neon(const std::uint8_t *src, std::int32_t *dst, std::size_t count)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        // val[0..2] hold the low, middle and high byte of 16 samples
+        uint8x16x3_t bytes = vld3q_u8(src + 3 * i);
+        uint16x8_t low_bytes[2] = {vmovl_u8(vget_low_u8(bytes.val[0])),
+                                   vmovl_u8(vget_high_u8(bytes.val[0]))};
+        int16x8_t high_words[2] = {
+            vreinterpretq_s16_u16(vorrq_u16(vshll_n_u8(vget_low_u8(bytes.val[2]), 8),
+                                            vmovl_u8(vget_low_u8(bytes.val[1])))),
+            vreinterpretq_s16_u16(vorrq_u16(vshll_n_u8(vget_high_u8(bytes.val[2]), 8),
+                                            vmovl_u8(vget_high_u8(bytes.val[1]))))};
+        for (int half = 0; half < 2; ++half)
+        {
+            int32x4_t first = vorrq_s32(
+                vshll_n_s16(vget_low_s16(high_words[half]), 8),
+                vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(low_bytes[half]))));
+            int32x4_t second = vorrq_s32(
+                vshll_n_s16(vget_high_s16(high_words[half]), 8),
+                vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(low_bytes[half]))));
+            vst1q_s32(dst + i + 8 * half, first);
+            vst1q_s32(dst + i + 8 * half + 4, second);
+        }
+    }
+    unpackInt24Tail(src, dst, i, count);
+}
+
+void downmixInt16MonoNeon(float *dst, const void *src, std::size_t frame_count,
+                          std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    for (; i + 8 <= frame_count; i += 8)
+    {
+        int16x8_t samples = vld1q_s16(in + i);
+        vst1q_f32(dst + i, vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))));
+        vst1q_f32(dst + i + 4, vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples))));
+    }
+    downmixScalar<Int16Reader, 1>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+void downmixInt16StereoNeon(float *dst, const void *src, std::size_t frame_count,
+                            std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    for (; i + 4 <= frame_count; i += 4)
+    {
+        int32x4_t sums = vpaddlq_s16(vld1q_s16(in + 2 * i));
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(sums), half));
+    }
+    downmixScalar<Int16Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+void downmixFloat32StereoNeon(float *dst, const void *src, std::size_t frame_count,
+                              std::uint32_t channels)
+{
+    const auto *in = static_cast<const float *>(src);
+    std::size_t i = 0;
+    const float32x4_t scale = vdupq_n_f32(Float32Reader::scale() / 2);
+    for (; i + 4 <= frame_count; i += 4)
+    {
+        float32x4x2_t frames = vld2q_f32(in + 2 * i);
+        vst1q_f32(dst + i, vmulq_f32(vaddq_f32(frames.val[0], frames.val[1]), scale));
+    }
+    downmixScalar<Float32Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                    channels);
+}
+#elif defined(DOWNMIX_X86)
+// Each 16 byte load covers four samples, place them in the top three bytes
+// of every lane and shift them back down arithmetically.
+__attribute__((target("ssse3"))) void unpackInt24Ssse3(const std::uint8_t *src,
+                                                       std::int32_t *dst, std::size_t count)
+{
+    std::size_t i = 0;
+    const __m128i shuffle =
+        _mm_setr_epi8(-1, 0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11);
+    for (; i + 6 <= count; i += 4)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 3 * i));
+        __m128i samples = _mm_srai_epi32(_mm_shuffle_epi8(bytes, shuffle), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), samples);
+    }
+    unpackInt24Tail(src, dst, i, count);
+}
+
+__attribute__((target("sse2"))) void downmixInt16MonoSse2(float *dst, const void *src,
+                                                          std::size_t frame_count,
+                                                          std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    for (; i + 8 <= frame_count; i += 8)
+    {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        __m128i low = _mm_srai_epi32(_mm_unpacklo_epi16(samples, samples), 16);
+        __m128i high = _mm_srai_epi32(_mm_unpackhi_epi16(samples, samples), 16);
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(low));
+        _mm_storeu_ps(dst + i + 4, _mm_cvtepi32_ps(high));
+    }
+    downmixScalar<Int16Reader, 1>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+__attribute__((target("sse2"))) void downmixInt16StereoSse2(float *dst, const void *src,
+                                                            std::size_t frame_count,
+                                                            std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    const __m128i ones = _mm_set1_epi16(1);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= frame_count; i += 4)
+    {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + 2 * i));
+        __m128i sums = _mm_madd_epi16(samples, ones);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(sums), half));
+    }
+    downmixScalar<Int16Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+__attribute__((target("sse2"))) void downmixFloat32StereoSse2(float *dst, const void *src,
+                                                              std::size_t frame_count,
+                                                              std::uint32_t channels)
+{
+    const auto *in = static_cast<const float *>(src);
+    std::size_t i = 0;
+    const __m128 scale = _mm_set1_ps(Float32Reader::scale() / 2);
+    for (; i + 4 <= frame_count; i += 4)
+    {
+        __m128 a = _mm_loadu_ps(in + 2 * i);
+        __m128 b = _mm_loadu_ps(in + 2 * i + 4);
+        __m128 left = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 right = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_add_ps(left, right), scale));
+    }
+    downmixScalar<Float32Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                    channels);
+}
+
+__attribute__((target("avx2"))) void downmixInt16MonoAvx2(float *dst, const void *src,
+                                                          std::size_t frame_count,
+                                                          std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    for (; i + 8 <= frame_count; i += 8)
+    {
+        __m128i samples = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(samples)));
+    }
+    downmixScalar<Int16Reader, 1>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+__attribute__((target("avx2"))) void downmixInt16StereoAvx2(float *dst, const void *src,
+                                                            std::size_t frame_count,
+                                                            std::uint32_t channels)
+{
+    const auto *in = static_cast<const std::int16_t *>(src);
+    std::size_t i = 0;
+    const __m256i ones = _mm256_set1_epi16(1);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    for (; i + 8 <= frame_count; i += 8)
+    {
+        __m256i samples = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 2 * i));
+        __m256i sums = _mm256_madd_epi16(samples, ones);
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(_mm256_cvtepi32_ps(sums), half));
+    }
+    downmixScalar<Int16Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                  channels);
+}
+
+__attribute__((target("avx2"))) void downmixFloat32StereoAvx2(float *dst, const void *src,
+                                                              std::size_t frame_count,
+                                                              std::uint32_t channels)
+{
+    const auto *in = static_cast<const float *>(src);
+    std::size_t i = 0;
+    const __m256 scale = _mm256_set1_ps(Float32Reader::scale() / 2);
+    for (; i + 8 <= frame_count; i += 8)
+    {
+        __m256 a = _mm256_loadu_ps(in + 2 * i);
+        __m256 b = _mm256_loadu_ps(in + 2 * i + 8);
+        // The shuffles work within 128-bit lanes, giving frames 0 1 4 5 2 3 6 7
+        __m256 sums = _mm256_add_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                                    _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+        sums = _mm256_castpd_ps(
+            _mm256_permute4x64_pd(_mm256_castps_pd(sums), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(dst + i, _mm256_mul_ps(sums, scale));
+    }
+    downmixScalar<Float32Reader, 2>(dst, static_cast<const std::uint8_t *>(src), i, frame_count,
+                                    channels);
+}
+#endif
+
+struct DownmixEntry
+{
+    SampleFormat format;
+    std::uint32_t width;
+    std::uint32_t channels; // 0 matches any channel count
+    DownmixFunc func;
+};
+
+#define DOWNMIX_ENTRIES(FORMAT, READER)                                                            \
+    {FORMAT, READER::WIDTH, 1, &downmixKernel<READER, 1>},                                         \
+        {FORMAT, READER::WIDTH, 2, &downmixKernel<READER, 2>},                                     \
+        {FORMAT, READER::WIDTH, 0, &downmixKernel<READER, 0>}
+
+#define INT24_ENTRIES(UNPACK)                                                                      \
+    {SampleFormat::SIGNED_INTEGER, Int24Reader::WIDTH, 1, &downmixInt24Kernel<1, UNPACK>},         \
+        {SampleFormat::SIGNED_INTEGER, Int24Reader::WIDTH, 2, &downmixInt24Kernel<2, UNPACK>},     \
+        {SampleFormat::SIGNED_INTEGER, Int24Reader::WIDTH, 0, &downmixInt24Kernel<0, UNPACK>}
+
+// Every format, portable kernels
+constexpr DownmixEntry DOWNMIX_TABLE[] = {
+    DOWNMIX_ENTRIES(SampleFormat::SIGNED_INTEGER, Int8Reader),
+    DOWNMIX_ENTRIES(SampleFormat::UNSIGNED_INTEGER, Uint8Reader),
+    DOWNMIX_ENTRIES(SampleFormat::SIGNED_INTEGER, Int16Reader),
+    INT24_ENTRIES(&unpackInt24Scalar),
+    DOWNMIX_ENTRIES(SampleFormat::SIGNED_INTEGER, Int32Reader),
+    DOWNMIX_ENTRIES(SampleFormat::FLOAT, Float32Reader),
+    DOWNMIX_ENTRIES(SampleFormat::FLOAT, Float64Reader),
+};
+
+// The vectorized kernels of each instruction set, tried before the portable ones
+#if defined(DOWNMIX_NEON)
+constexpr DownmixEntry NEON_TABLE[] = {
+    {SampleFormat::SIGNED_INTEGER, 2, 1, &downmixInt16MonoNeon},
+    {SampleFormat::SIGNED_INTEGER, 2, 2, &downmixInt16StereoNeon},
+    {SampleFormat::FLOAT, 4, 2, &downmixFloat32StereoNeon},
+    INT24_ENTRIES(&unpackInt24Neon),
+};
+#elif defined(DOWNMIX_X86)
+constexpr DownmixEntry AVX2_TABLE[] = {
+    {SampleFormat::SIGNED_INTEGER, 2, 1, &downmixInt16MonoAvx2},
+    {SampleFormat::SIGNED_INTEGER, 2, 2, &downmixInt16StereoAvx2},
+    {SampleFormat::FLOAT, 4, 2, &downmixFloat32StereoAvx2},
+};
+constexpr DownmixEntry SSSE3_TABLE[] = {
+    INT24_ENTRIES(&unpackInt24Ssse3),
+};
+constexpr DownmixEntry SSE2_TABLE[] = {
+    {SampleFormat::SIGNED_INTEGER, 2, 1, &downmixInt16MonoSse2},
+    {SampleFormat::SIGNED_INTEGER, 2, 2, &downmixInt16StereoSse2},
+    {SampleFormat::FLOAT, 4, 2, &downmixFloat32StereoSse2},
+};
+#endif
+
+#undef DOWNMIX_ENTRIES
+#undef INT24_ENTRIES
+
+template <std::size_t N>
+DownmixFunc findDownmixFunc(const DownmixEntry (&table)[N], SampleFormat format,
+                            std::uint32_t width, std::uint32_t channels)
+{
+    for (const auto &entry : table)
+    {
+        if (entry.format == format && entry.width == width &&
+            (entry.channels == channels || entry.channels == 0))
+        {
+            return entry.func;
+        }
+    }
+    return nullptr;
+}
+} // namespace
+
+namespace downmix
+{
+DownmixFunc GetDownmixFunc(SampleFormat format, std::uint32_t width, std::uint32_t channels)
+{
+    if (channels == 0)
+    {
+        return nullptr;
+    }
+    DownmixFunc func = nullptr;
+    const cpu::Features &features = cpu::Enabled();
+#if defined(DOWNMIX_NEON)
+    if (features.neon)
+    {
+        func = findDownmixFunc(NEON_TABLE, format, width, channels);
+    }
+#elif defined(DOWNMIX_X86)
+    if (features.avx2)
+    {
+        func = findDownmixFunc(AVX2_TABLE, format, width, channels);
+    }
+    if (func == nullptr && features.ssse3)
+    {
+        func = findDownmixFunc(SSSE3_TABLE, format, width, channels);
+    }
+    if (func == nullptr && features.sse2)
+    {
+        func = findDownmixFunc(SSE2_TABLE, format, width, channels);
+    }
+#endif
+    (void)features;
+    return func != nullptr ? func : findDownmixFunc(DOWNMIX_TABLE, format, width, channels);
+}
+} // namespace downmix
@@ -0,0 +1,26 @@
+#ifndef LIB_AUDIO_DOWNMIX_H_
+#define LIB_AUDIO_DOWNMIX_H_
+
+#include <cstddef>
+#include <cstdint>
+
+enum class SampleFormat
+{
+    SIGNED_INTEGER,
+    UNSIGNED_INTEGER, // 8-bit WAV only
+    FLOAT,
+};
+
+// Averages `frame_count` interleaved frames of `channels` samples into mono
+// floats in the int16 range, at the source rate.
+using DownmixFunc = void (*)(float *dst, const void *src, std::size_t frame_count,
+                             std::uint32_t channels);
+
+namespace downmix
+{
+// Returns the kernel specialized for the given format, or nullptr if the
+// format is not supported. `width` is the container size in bytes.
+DownmixFunc GetDownmixFunc(SampleFormat format, std::uint32_t width, std::uint32_t channels);
+} // namespace downmix
+
+#endif // LIB_AUDIO_DOWNMIX_H_
@@ -1,179 +1,150 @@
 #include "audio/downsampler.h"
 #include <cstring>
 #include <algorithm>
-#include <map>
-#include <tuple>
-#include "audio/byte_control.h"
+#include <stdexcept>
+#include <string>
+#include "audio/resampler.h"
 #include "audio/wav.h"
+#include "utils/trace.h"
 
-LowQualityTrack Downsampler::GetLowQualityPCM(const Wav &wav, std::int32_t start_sec,
-                                              std::int32_t end_sec)
+Downsampler::Downsampler(SampleFormat sample_format, std::uint32_t sample_rate,
+                         std::uint32_t bits_per_sample, std::uint32_t channels)
+    : downmix_func_(nullptr), channels_(channels), frame_size_(0), copy_through_(false),
+      partial_frame_size_(0)
 {
-    LowQualityTrack low_quality_pcm;
-
-    const auto channels = wav.num_channels();
-    const auto sample_rate = wav.sample_rate_();
-    const auto bits_per_sample = wav.bits_per_sample();
-    const auto data_size = wav.data_size();
-    const auto audio_format = wav.audio_format();
-    const std::uint8_t *pcm_data = wav.data().get();
-
-    if (channels == 1 && sample_rate == LOW_QUALITY_SAMPLE_RATE &&
-        bits_per_sample == LOW_QUALITY_SAMPLE_BIT_WIDTH && start_sec == 0 && end_sec == -1)
+    if (sample_rate == 0 || channels == 0)
     {
-        // no need to convert low quality pcm. just copy raw data
-        low_quality_pcm.resize(data_size);
-        std::memcpy(low_quality_pcm.data(), wav.data().get(), data_size);
-        return low_quality_pcm;
+        throw std::invalid_argument("Sample rate and channel count must be positive");
     }
-
-    double downsample_ratio = sample_rate / static_cast<double>(LOW_QUALITY_SAMPLE_RATE);
-    std::uint32_t width = bits_per_sample / 8;
-    std::uint32_t sample_count = data_size / width;
-
-    const void *src_raw_data = pcm_data + (start_sec * sample_rate * width * channels);
-
-    std::uint32_t new_sample_count = sample_count / channels / downsample_ratio;
-
-    if (end_sec != -1)
+    if (sample_rate < MIN_RESAMPLER_INPUT_RATE)
     {
-        new_sample_count = (end_sec - start_sec) * LOW_QUALITY_SAMPLE_RATE;
+        throw std::invalid_argument("Sample rate must be at least " +
+                                    std::to_string(MIN_RESAMPLER_INPUT_RATE) + " Hz");
     }
+    const std::uint32_t width = bits_per_sample / 8;
+    if (bits_per_sample % 8 != 0 ||
+        (downmix_func_ = downmix::GetDownmixFunc(sample_format, width, channels)) == nullptr)
+    {
+        throw std::runtime_error("Unsupported PCM format");
+    }
+    frame_size_ = static_cast<std::size_t>(width) * channels;
+    partial_frame_.resize(frame_size_);
 
-    low_quality_pcm.resize(new_sample_count);
-
-    auto downsample_func = &Downsampler::signedMonoToMono;
-    bool is_signed = audio_format == 1;
-
-    downsample_func = getDownsampleFunc(is_signed, bits_per_sample, channels);
-    downsample_func(&low_quality_pcm, src_raw_data, downsample_ratio, new_sample_count, width,
-                    channels);
-    return low_quality_pcm;
+    // Downmix at the source rate, the resampler low-pass filters the mono
+    // signal so nothing above 8 kHz aliases into the fingerprint bands.
+    if (sample_rate != LOW_QUALITY_SAMPLE_RATE)
+    {
+        resampler_.reset(new Resampler(sample_rate));
+    }
+    else
+    {
+        copy_through_ = channels == 1 && sample_format == SampleFormat::SIGNED_INTEGER &&
+                        bits_per_sample == LOW_QUALITY_SAMPLE_BIT_WIDTH;
+    }
 }
 
-DownsampleFunc Downsampler::getDownsampleFunc(bool is_signed, std::uint32_t width,
-                                              std::uint32_t channels)
+Downsampler::~Downsampler()
 {
-    channels = std::min(channels, 3u);
-    width = is_signed ? 0 : width;
-
-    static std::map<std::tuple<bool, std::uint32_t, std::uint32_t>, DownsampleFunc> func_map{
-        {std::make_tuple(true, 0, 1), &Downsampler::signedMonoToMono},
-        {std::make_tuple(true, 0, 2), &Downsampler::signedStereoToMono},
-        {std::make_tuple(true, 0, 3), &Downsampler::signedMultiToMono},
-        {std::make_tuple(false, 32, 1), &Downsampler::floatMonoToMono<float>},
-        {std::make_tuple(false, 32, 2), &Downsampler::floatStereoToMono<float>},
-        {std::make_tuple(false, 32, 3), &Downsampler::floatMultiToMono<float>},
-        {std::make_tuple(false, 64, 1), &Downsampler::floatMonoToMono<double>},
-        {std::make_tuple(false, 64, 2), &Downsampler::floatStereoToMono<double>},
-        {std::make_tuple(false, 64, 3), &Downsampler::floatMultiToMono<double>},
-    };
-    return func_map.at(std::make_tuple(is_signed, width, channels));
 }
 
-void Downsampler::signedMonoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                   std::uint32_t new_sample_count, std::uint32_t width,
-                                   std::uint32_t channels)
+void Downsampler::Process(const void *data, std::size_t size, LowQualityTrack *output)
 {
-    std::uint32_t index = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    const auto *bytes = static_cast<const std::uint8_t *>(data);
+    if (partial_frame_size_ != 0)
     {
-        index = std::uint32_t(i * downsample_ratio) * width * channels;
-        dst->at(i) = GETSAMPLE64(width, src, index) >> (64 - LOW_QUALITY_SAMPLE_BIT_WIDTH);
+        const auto count = std::min(size, frame_size_ - partial_frame_size_);
+        std::memcpy(partial_frame_.data() + partial_frame_size_, bytes, count);
+        partial_frame_size_ += count;
+        bytes += count;
+        size -= count;
+        if (partial_frame_size_ < frame_size_)
+        {
+            return;
+        }
+        processFrames(partial_frame_.data(), 1, output);
+        partial_frame_size_ = 0;
     }
+
+    const std::size_t frame_count = size / frame_size_;
+    processFrames(bytes, frame_count, output);
+
+    partial_frame_size_ = size - frame_count * frame_size_;
+    std::memcpy(partial_frame_.data(), bytes + frame_count * frame_size_, partial_frame_size_);
 }
 
-void Downsampler::signedStereoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                     std::uint32_t new_sample_count, std::uint32_t width,
-                                     std::uint32_t channels)
+void Downsampler::Flush(LowQualityTrack *output)
 {
-    std::uint32_t index = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    if (resampler_)
     {
-        index = std::uint32_t(i * downsample_ratio) * width * channels;
-        LowQualitySample sample1 =
-            GETSAMPLE64(width, src, index) >> (64 - LOW_QUALITY_SAMPLE_BIT_WIDTH);
-        LowQualitySample sample2 =
-            GETSAMPLE64(width, src, index + width) >> (64 - LOW_QUALITY_SAMPLE_BIT_WIDTH);
-        dst->at(i) = (sample1 + sample2) / 2;
+        resampler_->Flush(output);
     }
+    partial_frame_size_ = 0;
 }
 
-void Downsampler::signedMultiToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                    std::uint32_t new_sample_count, std::uint32_t width,
-                                    std::uint32_t channels)
+void Downsampler::processFrames(const std::uint8_t *frames, std::size_t frame_count,
+                                LowQualityTrack *output)
 {
-    double collected_sample = 0;
-    std::uint32_t index = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    if (copy_through_)
     {
-        collected_sample = 0;
-        for (std::uint32_t k = 0; k < channels; k++)
+        // no need to convert low quality pcm. just copy raw data
+        const auto offset = output->size();
+        output->resize(offset + frame_count);
+        std::memcpy(output->data() + offset, frames, frame_count * sizeof(LowQualitySample));
+        return;
+    }
+
+    constexpr std::size_t kChunkSize = 1024;
+    float chunk[kChunkSize];
+    for (std::size_t offset = 0; offset < frame_count; offset += kChunkSize)
+    {
+        const auto count = std::min<std::size_t>(kChunkSize, frame_count - offset);
+        downmix_func_(chunk, frames + offset * frame_size_, count, channels_);
+        if (resampler_)
+        {
+            resampler_->Process(chunk, count, output);
+        }
+        else
         {
-            index = std::uint32_t(i * downsample_ratio) * width * channels;
-            collected_sample +=
-                GETSAMPLE64(width, src, index + k * width) >> (64 - LOW_QUALITY_SAMPLE_BIT_WIDTH);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                output->push_back(static_cast<LowQualitySample>(
+                    std::min(std::max(chunk[i], -32768.0f), 32767.0f)));
+            }
         }
-        dst->at(i) = LowQualitySample(collected_sample / channels);
     }
 }
 
-template <typename T>
-void Downsampler::floatMonoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                  std::uint32_t new_sample_count, std::uint32_t width,
-                                  std::uint32_t channels)
+LowQualityTrack Downsampler::GetLowQualityPCM(const Wav &wav, std::int32_t start_sec,
+                                              std::int32_t end_sec)
 {
-    T temp_float_sample = 0;
-    std::uint64_t temp_sample = 0;
-    std::uint32_t index = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    trace::Scope trace_scope("Downsampler::GetLowQualityPCM");
+    const auto sample_rate = wav.sample_rate_();
+    Downsampler downsampler(wav.sample_format(), sample_rate, wav.bits_per_sample(),
+                            wav.num_channels());
+
+    const std::uint64_t total_frames = wav.data_size() / downsampler.frame_size();
+    const std::uint64_t first_frame =
+        std::min<std::uint64_t>(static_cast<std::uint64_t>(std::max(start_sec, 0)) * sample_rate,
+                                total_frames);
+    std::uint64_t last_frame = total_frames;
+    if (end_sec >= 0)
     {
-        index = std::uint32_t(i * downsample_ratio) * width * channels;
-        temp_sample = GETSAMPLE64(width, src, index) >> (64 - sizeof(T) * 8);
-        temp_float_sample = *reinterpret_cast<T *>(&temp_sample);
-        dst->at(i) = LowQualitySample(temp_float_sample * LOW_QUALITY_SAMPLE_MAX);
+        last_frame = std::min<std::uint64_t>(static_cast<std::uint64_t>(end_sec) * sample_rate,
+                                             total_frames);
     }
-}
+    const std::uint64_t frame_count = last_frame > first_frame ? last_frame - first_frame : 0;
 
-template <typename T>
-void Downsampler::floatStereoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                    std::uint32_t new_sample_count, std::uint32_t width,
-                                    std::uint32_t channels)
-{
-    std::uint64_t temp_sample1 = 0;
-    std::uint64_t temp_sample2 = 0;
-    T temp_float_sample1 = 0;
-    T temp_float_sample2 = 0;
-    std::uint32_t index = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    LowQualityTrack low_quality_pcm;
+    if (downsampler.resampler_)
     {
-        index = std::uint32_t(i * downsample_ratio) * width * channels;
-        temp_sample1 = GETSAMPLE64(width, src, index) >> (64 - sizeof(T) * 8);
-        temp_sample2 = GETSAMPLE64(width, src, index + width) >> (64 - sizeof(T) * 8);
-        temp_float_sample1 = *reinterpret_cast<T *>(&temp_sample1);
-        temp_float_sample2 = *reinterpret_cast<T *>(&temp_sample2);
-        dst->at(i) = LowQualitySample((temp_float_sample1 + temp_float_sample2) / 2 *
-                                      LOW_QUALITY_SAMPLE_MAX);
+        low_quality_pcm.reserve(downsampler.resampler_->OutputCountFor(frame_count));
     }
-}
-
-template <typename T>
-void Downsampler::floatMultiToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                   std::uint32_t new_sample_count, std::uint32_t width,
-                                   std::uint32_t channels)
-{
-    std::uint32_t index = 0;
-    T collected_sample = 0;
-    std::uint64_t temp_sample = 0;
-    for (std::uint32_t i = 0; i < new_sample_count; i++)
+    else
     {
-        collected_sample = 0;
-        index = std::uint32_t(i * downsample_ratio) * width * channels;
-        for (std::uint32_t k = 0; k < channels; k++)
-        {
-            temp_sample = GETSAMPLE64(width, src, index + k * width) >> (64 - sizeof(T) * 8);
-            collected_sample += *reinterpret_cast<T *>(&temp_sample);
-        }
-        dst->at(i) = LowQualitySample(collected_sample / channels * LOW_QUALITY_SAMPLE_MAX);
+        low_quality_pcm.reserve(frame_count);
     }
+    downsampler.Process(wav.data() + first_frame * downsampler.frame_size(),
+                        frame_count * downsampler.frame_size(), &low_quality_pcm);
+    downsampler.Flush(&low_quality_pcm);
+    return low_quality_pcm;
 }
@@ -2,10 +2,13 @@
 #define LIB_AUDIO_DOWNSAMPLER_H_
 
 #include <cstdint>
+#include <memory>
 #include <vector>
+#include "audio/downmix.h"
 
 // forward declaration
 class Wav;
+class Resampler;
 //
 
 using LowQualitySample = std::int16_t;
@@ -15,41 +18,51 @@ constexpr std::uint32_t LOW_QUALITY_SAMPLE_RATE = 16000;
 constexpr std::uint32_t LOW_QUALITY_SAMPLE_BIT_WIDTH = sizeof(LowQualitySample) * 8;
 constexpr std::uint32_t LOW_QUALITY_SAMPLE_MAX = 32767;
 
-using DownsampleFunc = void (*)(LowQualityTrack *, const void *, double, std::uint32_t,
-                                std::uint32_t, std::uint32_t);
-
+// Converts interleaved PCM of any supported format into the mono 16 kHz
+// LowQualityTrack the signature generator consumes. The downmix and filter
+// state is kept between Process() calls, so a source can be fed in blocks
+// and only ever needs a block of audio in memory.
 class Downsampler
 {
 public:
+    Downsampler(SampleFormat sample_format, std::uint32_t sample_rate,
+                std::uint32_t bits_per_sample, std::uint32_t channels);
+    Downsampler(const Downsampler &) = delete;
+    Downsampler &operator=(const Downsampler &) = delete;
+    ~Downsampler();
+
+    // Consumes `size` bytes of interleaved PCM and appends the low quality
+    // samples they complete. Blocks do not have to end on a frame boundary.
+    void Process(const void *data, std::size_t size, LowQualityTrack *output);
+
+    // Emits the samples still held back by the resampler and resets the
+    // downsampler for a new stream.
+    void Flush(LowQualityTrack *output);
+
+    inline std::size_t frame_size() const
+    {
+        return frame_size_;
+    }
+
+    // Converts the frames between start_sec and end_sec in one go. A
+    // negative end_sec means the end of the track, the window is clamped to
+    // the data actually present.
     static LowQualityTrack GetLowQualityPCM(const Wav &wav, std::int32_t start_sec = 0,
                                             std::int32_t end_sec = -1);
 
 private:
-    static DownsampleFunc getDownsampleFunc(bool is_signed, std::uint32_t width,
-                                            std::uint32_t channels);
-
-    static void signedStereoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                   std::uint32_t new_sample_count, std::uint32_t width,
-                                   std::uint32_t channels);
-    static void signedMonoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                 std::uint32_t new_sample_count, std::uint32_t width,
-                                 std::uint32_t channels);
-    static void signedMultiToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                  std::uint32_t new_sample_count, std::uint32_t width,
-                                  std::uint32_t channels);
-
-    template <typename T>
-    static void floatStereoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                  std::uint32_t new_sample_count, std::uint32_t width,
-                                  std::uint32_t channels);
-    template <typename T>
-    static void floatMonoToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                std::uint32_t new_sample_count, std::uint32_t width,
-                                std::uint32_t channels);
-    template <typename T>
-    static void floatMultiToMono(LowQualityTrack *dst, const void *src, double downsample_ratio,
-                                 std::uint32_t new_sample_count, std::uint32_t width,
-                                 std::uint32_t channels);
+    void processFrames(const std::uint8_t *frames, std::size_t frame_count,
+                       LowQualityTrack *output);
+
+private:
+    DownmixFunc downmix_func_;
+    std::unique_ptr<Resampler> resampler_;
+    std::uint32_t channels_;
+    std::size_t frame_size_;
+    bool copy_through_; // already mono 16 kHz int16
+
+    std::vector<std::uint8_t> partial_frame_;
+    std::size_t partial_frame_size_;
 };
 
 #endif // LIB_AUDIO_DOWNSAMPLER_H_
@@ -0,0 +1,275 @@
+#include "audio/resampler.h"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+constexpr double STOPBAND_ATTENUATION_DB = 70.0;
+constexpr std::uint32_t MAX_DESIGNED_PHASES = 1024;
+static_assert(MIN_RESAMPLER_INPUT_RATE ==
+                  (LOW_QUALITY_SAMPLE_RATE + MAX_DESIGNED_PHASES - 1) / MAX_DESIGNED_PHASES,
+              "MIN_RESAMPLER_INPUT_RATE does not match MAX_DESIGNED_PHASES");
+
+std::uint32_t gcd(std::uint32_t a, std::uint32_t b)
+{
+    while (b != 0)
+    {
+        std::uint32_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Last continued fraction convergent numerator / denominator of a / b whose
+// denominator does not exceed max_denominator.
+void approximateRatio(std::uint32_t a, std::uint32_t b, std::uint32_t max_denominator,
+                      std::uint32_t *numerator, std::uint32_t *denominator)
+{
+    std::uint64_t p0 = 0, q0 = 1, p1 = 1, q1 = 0;
+    std::uint64_t x = a, y = b;
+    while (y != 0)
+    {
+        const std::uint64_t t = x / y;
+        const std::uint64_t p2 = t * p1 + p0;
+        const std::uint64_t q2 = t * q1 + q0;
+        if (q2 > max_denominator)
+        {
+            break;
+        }
+        p0 = p1;
+        q0 = q1;
+        p1 = p2;
+        q1 = q2;
+        const std::uint64_t r = x - t * y;
+        x = y;
+        y = r;
+    }
+    *numerator = static_cast<std::uint32_t>(p1);
+    *denominator = static_cast<std::uint32_t>(q1);
+}
+
+double besselI0(double x)
+{
+    double total = 1.0;
+    double term = 1.0;
+    for (int k = 1; term > 1e-12 * total; ++k)
+    {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        total += term;
+    }
+    return total;
+}
+
+// taps is always a multiple of 4
+inline float dot(const float *coefficients, const float *samples, std::uint32_t taps)
+{
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    for (std::uint32_t i = 0; i < taps; i += 4)
+    {
+        acc = vmlaq_f32(acc, vld1q_f32(coefficients + i), vld1q_f32(samples + i));
+    }
+#if defined(__aarch64__)
+    return vaddvq_f32(acc);
+#else
+    float32x2_t sum = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#endif
+#elif defined(__SSE2__)
+    __m128 acc = _mm_setzero_ps();
+    for (std::uint32_t i = 0; i < taps; i += 4)
+    {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(coefficients + i), _mm_loadu_ps(samples + i)));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    return _mm_cvtss_f32(acc);
+#else
+    float acc[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (std::uint32_t i = 0; i < taps; i += 4)
+    {
+        acc[0] += coefficients[i] * samples[i];
+        acc[1] += coefficients[i + 1] * samples[i + 1];
+        acc[2] += coefficients[i + 2] * samples[i + 2];
+        acc[3] += coefficients[i + 3] * samples[i + 3];
+    }
+    return (acc[0] + acc[2]) + (acc[1] + acc[3]);
+#endif
+}
+
+inline LowQualitySample saturate(float value)
+{
+    value = std::min(std::max(value, -32768.0f), 32767.0f);
+    return static_cast<LowQualitySample>(std::lrint(value));
+}
+} // namespace
+
+Resampler::Resampler(std::uint32_t input_rate)
+{
+    if (input_rate < MIN_RESAMPLER_INPUT_RATE)
+    {
+        throw std::invalid_argument("Sample rate must be at least " +
+                                    std::to_string(MIN_RESAMPLER_INPUT_RATE) + " Hz");
+    }
+
+    coefficients_.table = nullptr;
+    for (const auto &candidate : RESAMPLER_COEFFICIENTS)
+    {
+        if (candidate.input_rate == input_rate)
+        {
+            coefficients_ = candidate;
+            break;
+        }
+    }
+    if (coefficients_.table == nullptr)
+    {
+        designCoefficients(input_rate);
+    }
+
+    step_whole_ = coefficients_.down / coefficients_.up;
+    step_fraction_ = coefficients_.down % coefficients_.up;
+    Reset();
+}
+
+void Resampler::Reset()
+{
+    const auto taps = coefficients_.taps;
+    history_.assign(taps - 1, 0.0f);
+    history_.reserve(4096);
+    history_start_ = -static_cast<std::int64_t>(taps - 1);
+
+    // Aim each output at the centre of the prototype filter so the stream is
+    // not delayed by the filter's group delay.
+    const std::uint64_t center = static_cast<std::uint64_t>(coefficients_.up) * taps / 2;
+    next_input_ = center / coefficients_.up;
+    next_phase_ = center % coefficients_.up;
+    input_count_ = 0;
+    output_count_ = 0;
+}
+
+std::uint64_t Resampler::OutputCountFor(std::uint64_t input_count) const
+{
+    return (input_count * coefficients_.up + coefficients_.down - 1) / coefficients_.down;
+}
+
+void Resampler::Process(const float *input, std::size_t count, LowQualityTrack *output)
+{
+    history_.insert(history_.end(), input, input + count);
+    input_count_ += count;
+    produce(UINT64_MAX, output);
+
+    // keep only the samples the next output still reads
+    const std::int64_t keep_from =
+        static_cast<std::int64_t>(next_input_) - static_cast<std::int64_t>(coefficients_.taps - 1);
+    if (keep_from > history_start_)
+    {
+        const auto drop = std::min<std::size_t>(keep_from - history_start_, history_.size());
+        history_.erase(history_.begin(), history_.begin() + drop);
+        history_start_ += drop;
+    }
+}
+
+void Resampler::Flush(LowQualityTrack *output)
+{
+    const std::uint64_t expected = OutputCountFor(input_count_);
+
+    // the centred filter looks taps / 2 samples ahead, pad with silence
+    history_.insert(history_.end(), coefficients_.taps, 0.0f);
+    input_count_ += coefficients_.taps;
+    produce(expected, output);
+    Reset();
+}
+
+void Resampler::produce(std::uint64_t max_output_count, LowQualityTrack *output)
+{
+    const auto taps = coefficients_.taps;
+    const auto up = coefficients_.up;
+    const float *table = coefficients_.table;
+
+    while (next_input_ < input_count_ && output_count_ < max_output_count)
+    {
+        const float *samples =
+            history_.data() + (static_cast<std::int64_t>(next_input_) - (taps - 1) - history_start_);
+        output->push_back(saturate(dot(table + next_phase_ * taps, samples, taps)));
+        ++output_count_;
+
+        next_input_ += step_whole_;
+        next_phase_ += step_fraction_;
+        if (next_phase_ >= up)
+        {
+            next_phase_ -= up;
+            ++next_input_;
+        }
+    }
+}
+
+void Resampler::designCoefficients(std::uint32_t input_rate)
+{
+    // Same rules as scripts/gen_resampler_coefficients.py
+    std::uint32_t divisor = gcd(input_rate, LOW_QUALITY_SAMPLE_RATE);
+    std::uint32_t up = LOW_QUALITY_SAMPLE_RATE / divisor;
+    std::uint32_t down = input_rate / divisor;
+    if (up > MAX_DESIGNED_PHASES)
+    {
+        // Odd rates would need thousands of branches. Use the closest ratio
+        // with at most MAX_DESIGNED_PHASES branches instead, the resulting
+        // pitch error is far below the resolution of a frequency bin.
+        approximateRatio(input_rate, LOW_QUALITY_SAMPLE_RATE, MAX_DESIGNED_PHASES, &down, &up);
+    }
+    // The constructor rejects the rates that would round down to 0 and never
+    // move the input forward
+    assert(down >= 1 && up >= 1);
+
+    const double min_rate = std::min<double>(input_rate, LOW_QUALITY_SAMPLE_RATE);
+    const double cutoff = 0.5 * min_rate;
+    const double transition = 0.25 * min_rate;
+    const double beta = 0.1102 * (STOPBAND_ATTENUATION_DB - 8.7);
+    auto taps = static_cast<std::uint32_t>(std::ceil(
+        (STOPBAND_ATTENUATION_DB - 7.95) / (2.285 * 2.0 * M_PI * transition / input_rate)));
+    taps = (taps + 3) / 4 * 4;
+
+    const std::size_t length = static_cast<std::size_t>(up) * taps;
+    const double center = static_cast<double>(length / 2);
+    const double fc = cutoff / (static_cast<double>(input_rate) * up);
+    const double window_norm = besselI0(beta);
+
+    designed_table_.resize(length);
+    std::vector<double> branch(taps);
+    for (std::uint32_t phase = 0; phase < up; ++phase)
+    {
+        double gain = 0.0;
+        for (std::uint32_t k = 0; k < taps; ++k)
+        {
+            const std::size_t n = phase + static_cast<std::size_t>(k) * up;
+            const double t = n - center;
+            const double sinc =
+                t == 0 ? 2.0 * fc : std::sin(2.0 * M_PI * fc * t) / (M_PI * t);
+            const double ratio = t / center;
+            const double window =
+                besselI0(beta * std::sqrt(std::max(0.0, 1.0 - ratio * ratio))) / window_norm;
+            branch[k] = sinc * window;
+            gain += branch[k];
+        }
+        for (std::uint32_t k = 0; k < taps; ++k)
+        {
+            designed_table_[static_cast<std::size_t>(phase) * taps + k] =
+                static_cast<float>(branch[taps - 1 - k] / gain);
+        }
+    }
+
+    coefficients_.input_rate = input_rate;
+    coefficients_.up = up;
+    coefficients_.down = down;
+    coefficients_.taps = taps;
+    coefficients_.table = designed_table_.data();
+}
@@ -0,0 +1,62 @@
+#ifndef LIB_AUDIO_RESAMPLER_H_
+#define LIB_AUDIO_RESAMPLER_H_
+
+#include <cstdint>
+#include <vector>
+#include "audio/downsampler.h"
+#include "audio/resampler_coefficients.h"
+
+// Below this rate no ratio to LOW_QUALITY_SAMPLE_RATE fits in the polyphase
+// branches a designed table may have.
+constexpr std::uint32_t MIN_RESAMPLER_INPUT_RATE = 16;
+
+// Rational L/M polyphase FIR resampler from an arbitrary input rate to
+// LOW_QUALITY_SAMPLE_RATE. Common rates use the precomputed tables in
+// resampler_coefficients.h, anything else gets a table designed at
+// construction. The filter state is kept across Process() calls so a track
+// can be fed in chunks of any size.
+class Resampler
+{
+public:
+    explicit Resampler(std::uint32_t input_rate);
+    Resampler(const Resampler &) = delete;
+    Resampler &operator=(const Resampler &) = delete;
+
+    // Consumes `count` mono samples in the int16 range and appends every
+    // output sample that is fully determined by the input seen so far.
+    void Process(const float *input, std::size_t count, LowQualityTrack *output);
+
+    // Drains the filter delay line so the output covers the whole input, then
+    // resets the resampler for a new stream.
+    void Flush(LowQualityTrack *output);
+
+    void Reset();
+
+    inline std::uint32_t input_rate() const
+    {
+        return coefficients_.input_rate;
+    }
+
+    // Number of output samples produced for `input_count` input samples once flushed.
+    std::uint64_t OutputCountFor(std::uint64_t input_count) const;
+
+private:
+    void designCoefficients(std::uint32_t input_rate);
+    void produce(std::uint64_t max_output_count, LowQualityTrack *output);
+
+private:
+    ResamplerCoefficients coefficients_;
+    std::vector<float> designed_table_;
+
+    std::uint32_t step_whole_;    // M / L
+    std::uint32_t step_fraction_; // M % L
+
+    std::vector<float> history_; // input samples from history_start_ onwards
+    std::int64_t history_start_;
+    std::uint64_t next_input_; // newest input sample needed by the next output
+    std::uint32_t next_phase_; // polyphase branch of the next output
+    std::uint64_t input_count_;
+    std::uint64_t output_count_;
+};
+
+#endif // LIB_AUDIO_RESAMPLER_H_
@@ -0,0 +1,4781 @@
+// Generated by scripts/gen_resampler_coefficients.py. Do not edit.
+#ifndef LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_
+#define LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_
+
+#include <cstdint>
+
+struct ResamplerCoefficients
+{
+    std::uint32_t input_rate;
+    std::uint32_t up;   // L: number of polyphase branches
+    std::uint32_t down; // M: input step per output, in branches
+    std::uint32_t taps; // K: taps per branch, multiple of 4
+    const float *table; // L * K, each branch reversed
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_8000[] = {
+    1.352940462e-18f, -3.430477658e-18f, 6.751622546e-18f, -1.135154496e-17f, 1.700465562e-17f, -2.321427068e-17f,
+    2.927100839e-17f, -3.437308570e-17f, 3.778288622e-17f, 1.000000000e+00f, 3.778288622e-17f, -3.437308570e-17f,
+    2.927100839e-17f, -2.321427068e-17f, 1.700465562e-17f, -1.135154496e-17f, 6.751622546e-18f, -3.430477658e-18f,
+    1.352940462e-18f, -2.898973263e-19f, -6.137303509e-04f, 2.159035399e-03f, -5.366024317e-03f, 1.118144445e-02f,
+    -2.089458137e-02f, 3.644318873e-02f, -6.139499669e-02f, 1.045064321e-01f, -1.977948170e-01f, 6.317740491e-01f,
+    6.317740491e-01f, -1.977948170e-01f, 1.045064321e-01f, -6.139499669e-02f, 3.644318873e-02f, -2.089458137e-02f,
+    1.118144445e-02f, -5.366024317e-03f, 2.159035399e-03f, -6.137303509e-04f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_11025[] = {
+    1.352940462e-18f, -3.430477658e-18f, 6.751622546e-18f, -1.135154496e-17f, 1.700465562e-17f, -2.321427068e-17f,
+    2.927100839e-17f, -3.437308570e-17f, 3.778288622e-17f, 1.000000000e+00f, 3.778288622e-17f, -3.437308570e-17f,
+    2.927100839e-17f, -2.321427068e-17f, 1.700465562e-17f, -1.135154496e-17f, 6.751622546e-18f, -3.430477658e-18f,
+    1.352940462e-18f, -2.898973263e-19f, -6.013892295e-06f, 1.716360277e-05f, -3.861636562e-05f, 7.575970646e-05f,
+    -1.362006148e-04f, 2.324342375e-04f, -3.907649608e-04f, 6.882099649e-04f, -1.511932342e-03f, 9.999970674e-01f,
+    1.516961329e-03f, -6.895597472e-04f, 3.914108858e-04f, -2.328121283e-04f, 1.364370004e-04f, -7.590749934e-05f,
+    3.870475325e-05f, -1.721219019e-05f, 6.037147600e-06f, -1.166317236e-06f, -1.200444395e-05f, 3.427831937e-05f,
+    -7.714361695e-05f, 1.513701392e-04f, -2.721621343e-04f, 4.644859562e-04f, -7.808764047e-04f, 1.375058076e-03f,
+    -3.018825656e-03f, 9.999859458e-01f, 3.038941528e-03f, -1.380457156e-03f, 7.834600779e-04f, -4.659975035e-04f,
+    2.731076669e-04f, -1.519613044e-04f, 7.749716371e-05f, -3.447266701e-05f, 1.209746421e-05f, -2.341281635e-06f,
+    -1.797155669e-05f, 5.134381336e-05f, -1.155809416e-04f, 2.268296478e-04f, -4.078815431e-04f, 6.961500049e-04f,
+    -1.170325859e-03f, 2.060530716e-03f, -4.520666475e-03f, 9.999666352e-01f, 4.565926867e-03f, -2.072678448e-03f,
+    1.176139021e-03f, -6.995509239e-04f, 4.100089522e-04f, -2.281597449e-04f, 1.163764071e-04f, -5.178108754e-05f,
+    1.818084850e-05f, -3.524888906e-06f, -2.391513327e-05f, 6.835975055e-05f, -1.539275312e-04f, 3.021365892e-04f,
+    -5.433558371e-04f, 9.274212502e-04f, -1.559104882e-03f, 2.744614324e-03f, -6.017441431e-03f, 9.999391360e-01f,
+    6.097903516e-03f, -2.766209793e-03f, 1.569439129e-03f, -9.334671706e-04f, 5.471377980e-04f, -3.045011437e-04f,
+    1.553416549e-04f, -6.913710655e-05f, 2.428719806e-05f, -4.717134371e-06f, -2.983507754e-05f, 8.532579903e-05f,
+    -1.921825819e-04f, 3.772893271e-04f, -6.785820234e-04f, 1.158294577e-03f, -1.947205061e-03f, 3.427295396e-03f,
+    -7.509137258e-03f, 9.999034485e-01f, 7.634857546e-03f, -3.461037301e-03f, 1.963351789e-03f, -1.167741007e-03f,
+    6.844911349e-04f, -3.809838167e-04f, 1.943920745e-04f, -8.654037658e-05f, 3.041640941e-05f, -5.918012969e-06f,
+    -3.573129442e-05f, 1.022416292e-04f, -2.303452938e-04f, 4.522862324e-04f, -8.135571204e-04f, 1.388764887e-03f,
+    -2.334618013e-03f, 4.108560484e-03f, -8.995740789e-03f, 9.998595733e-01f, 9.176774929e-03f, -4.157147030e-03f,
+    2.357868357e-03f, -1.402367179e-03f, 8.220658827e-04f, -4.576060731e-04f, 2.335268293e-04f, -1.039905479e-04f,
+    3.656837800e-05f, -7.127519254e-06f, -4.160368988e-05f, 1.191069137e-04f, -2.684148712e-04f, 5.271256833e-04f,
+    -9.482781582e-04f, 1.618827101e-03f, -2.721335385e-03f, 4.788396197e-03f, -1.047723896e-02f, 9.998075110e-01f,
+    1.072364154e-02f, -4.854524980e-03f, 2.752980163e-03f, -1.637340416e-03f, 9.598589504e-04f, -5.343662150e-04f,
+    2.727450784e-04f, -1.214872685e-04f, 4.274299821e-05f, -8.345647394e-06f, -4.745217097e-05f, 1.359213276e-04f,
+    -3.063905230e-04f, 6.018060650e-04f, -1.082742178e-03f, 1.848476158e-03f, -3.107348855e-03f, 5.466789204e-03f,
+    -1.195361879e-02f, 9.997472624e-01f, 1.227544315e-02f, -5.553157097e-03f, 3.148678506e-03f, -1.872655430e-03f,
+    1.097867236e-03f, -6.112625379e-04f, 3.120459769e-04f, -1.390301843e-04f, 4.894016336e-05f, -9.572391166e-06f,
+    -5.327664582e-05f, 1.526845480e-04f, -3.442714619e-04f, 6.763257698e-04f, -1.216946233e-03f, 2.077707017e-03f,
+    -3.492650132e-03f, 6.143726229e-03f, -1.342486743e-02f, 9.996788284e-01f, 1.383216544e-02f, -6.253029272e-03f,
+    3.544954658e-03f, -2.108306915e-03f, 1.236087627e-03f, -6.882933303e-04f, 3.514286758e-04f, -1.566189386e-04f,
+    5.515976570e-05f, -1.080774396e-05f, -5.907702359e-05f, 1.693962547e-04f, -3.820569051e-04f, 7.506831974e-04f,
+    -1.350887388e-03f, 2.306514651e-03f, -3.877230953e-03f, 6.819194053e-03f, -1.489097211e-02f, 9.996022100e-01f,
+    1.539379399e-02f, -6.954127344e-03f, 3.941799862e-03f, -2.344289551e-03f, 1.374516999e-03f, -7.654568743e-04f,
+    3.908923222e-04f, -1.742531728e-04f, 6.140169638e-05f, -1.205169878e-05f, -6.485321453e-05f, 1.860561294e-04f,
+    -4.197460741e-04f, 8.248767547e-04f, -1.484562719e-03f, 2.534894056e-03f, -4.261083090e-03f, 7.493179517e-03f,
+    -1.635192016e-02f, 9.995174084e-01f, 1.696031428e-02f, -7.656437092e-03f, 4.339205335e-03f, -2.580597997e-03f,
+    1.513152220e-03f, -8.427514449e-04f, 4.304360588e-04f, -1.919325259e-04f, 6.766584553e-05f, -1.330424822e-05f,
+    -7.060512997e-05f, 2.026638563e-04f, -4.573381946e-04f, 8.989048559e-04f, -1.617969313e-03f, 2.762840245e-03f,
+    -4.644198342e-03f, 8.165669520e-03f, -1.780769902e-02f, 9.994244248e-01f, 1.853171168e-02f, -8.359944247e-03f,
+    4.737162264e-03f, -2.817226900e-03f, 1.651990144e-03f, -9.201753107e-04f, 4.700590247e-04f, -2.096566349e-04f,
+    7.395210217e-05f, -1.456538452e-05f, -7.633268227e-05f, 2.192191219e-04f, -4.948324968e-04f, 9.727659223e-04f,
+    -1.751104272e-03f, 2.990348249e-03f, -5.026568541e-03f, 8.836651017e-03f, -1.925829623e-02f, 9.993232606e-01f,
+    2.010797149e-02f, -9.064634482e-03f, 5.135661809e-03f, -3.054170887e-03f, 1.791027616e-03f, -9.977267336e-04f,
+    5.097603546e-04f, -2.274251341e-04f, 8.026035427e-05f, -1.583509948e-05f, -8.203578489e-05f, 2.357216150e-04f,
+    -5.322282148e-04f, 1.046458383e-03f, -1.883964705e-03f, 3.217413118e-03f, -5.408185549e-03f, 9.506111024e-03f,
+    -2.070369942e-02f, 9.992139174e-01f, 2.168907889e-02f, -9.770493417e-03f, 5.534695103e-03f, -3.291424569e-03f,
+    1.930261471e-03f, -1.075403969e-03f, 5.495391795e-04f, -2.452376561e-04f, 8.659048872e-05f, -1.711338453e-05f,
+    -8.771435233e-05f, 2.521710268e-04f, -5.695245875e-04f, 1.119980674e-03f, -2.016547737e-03f, 3.444029922e-03f,
+    -5.789041261e-03f, 1.017403661e-02f, -2.214389634e-02f, 9.990963968e-01f, 2.327501896e-02f, -1.047750662e-02f,
+    5.934253251e-03f, -3.528982543e-03f, 2.069688533e-03f, -1.153205265e-03f, 5.893946261e-04f, -2.630938310e-04f,
+    9.294239136e-05f, -1.840023071e-05f, -9.336830016e-05f, 2.685670507e-04f, -6.067208579e-04f, 1.193331238e-03f,
+    -2.148850503e-03f, 3.670193749e-03f, -6.169127602e-03f, 1.084041492e-02f, -2.357887482e-02f, 9.989707005e-01f,
+    2.486577671e-02f, -1.118565960e-02f, 6.334327332e-03f, -3.766839388e-03f, 2.209305616e-03f, -1.231128864e-03f,
+    6.293258175e-04f, -2.809932867e-04f, 9.931594694e-05f, -1.969562865e-05f, -9.899754502e-05f, 2.849093825e-04f,
+    -6.438162732e-04f, 1.266508528e-03f, -2.280870150e-03f, 3.895899707e-03f, -6.548436529e-03f, 1.150523313e-02f,
+    -2.500862281e-02f, 9.988368304e-01f, 2.646133703e-02f, -1.189493783e-02f, 6.734908396e-03f, -4.004989666e-03f,
+    2.349109523e-03f, -1.309173002e-03f, 6.693318726e-04f, -2.989356490e-04f, 1.057110392e-04f, -2.099956859e-05f,
+    -1.046020046e-04f, 3.011977202e-04f, -6.808100854e-04f, 1.339511000e-03f, -2.412603838e-03f, 4.121142923e-03f,
+    -6.926960032e-03f, 1.216847850e-02f, -2.643312836e-02f, 9.986947886e-01f, 2.806168472e-02f, -1.260532670e-02f,
+    7.135987468e-03f, -4.243427924e-03f, 2.489097049e-03f, -1.387335908e-03f, 7.094119064e-04f, -3.169205415e-04f,
+    1.121275507e-04f, -2.231204035e-05f, -1.101815977e-04f, 3.174317643e-04f, -7.177015504e-04f, 1.412337122e-03f,
+    -2.544048738e-03f, 4.345918542e-03f, -7.304690131e-03f, 1.283013834e-02f, -2.785237960e-02f, 9.985445772e-01f,
+    2.966680447e-02f, -1.331681158e-02f, 7.537555547e-03f, -4.482148695e-03f, 2.629264975e-03f, -1.465615804e-03f,
+    7.495650300e-04f, -3.349475853e-04f, 1.185653630e-04f, -2.363303339e-05f, -1.157362441e-04f, 3.336112175e-04f,
+    -7.544899289e-04f, 1.484985366e-03f, -2.675202034e-03f, 4.570221729e-03f, -7.681618879e-03f, 1.349020001e-02f,
+    -2.926636479e-02f, 9.983861984e-01f, 3.127668089e-02f, -1.402937777e-02f, 7.939603602e-03f, -4.721146493e-03f,
+    2.769610076e-03f, -1.544010907e-03f, 7.897903505e-04f, -3.530163998e-04f, 1.250243566e-04f, -2.496253673e-05f,
+    -1.212658646e-04f, 3.497357850e-04f, -7.911744855e-04f, 1.557454213e-03f, -2.806060922e-03f, 4.794047670e-03f,
+    -8.057738362e-03f, 1.414865095e-02f, -3.067507228e-02f, 9.982196546e-01f, 3.289129850e-02f, -1.474301051e-02f,
+    8.342122581e-03f, -4.960415818e-03f, 2.910129114e-03f, -1.622519427e-03f, 8.300869714e-04f, -3.711266019e-04f,
+    1.315044110e-04f, -2.630053901e-05f, -1.267703814e-04f, 3.658051741e-04f, -8.277544898e-04f, 1.629742152e-03f,
+    -2.936622609e-03f, 5.017391569e-03f, -8.433040698e-03f, 1.480547865e-02f, -3.207849052e-02f, 9.980449484e-01f,
+    3.451064171e-02f, -1.545769501e-02f, 8.745103400e-03f, -5.199951155e-03f, 3.050818844e-03f, -1.701139568e-03f,
+    8.704539919e-04f, -3.892778064e-04f, 1.380054045e-04f, -2.764702846e-05f, -1.322497172e-04f, 3.818190946e-04f,
+    -8.642292153e-04f, 1.701847679e-03f, -3.066884316e-03f, 5.240248650e-03f, -8.807518035e-03f, 1.546067065e-02f,
+    -3.347660807e-02f, 9.978620823e-01f, 3.613469483e-02f, -1.617341641e-02f, 9.148536955e-03f, -5.439746972e-03f,
+    3.191676009e-03f, -1.779869526e-03f, 9.108905077e-04f, -4.074696260e-04f, 1.445272144e-04f, -2.900199290e-05f,
+    -1.377037962e-04f, 3.977772587e-04f, -9.005979401e-04f, 1.773769297e-03f, -3.196843276e-03f, 5.462614156e-03f,
+    -9.181162558e-03f, 1.611421456e-02f, -3.486941358e-02f, 9.976710591e-01f, 3.776344208e-02f, -1.689015981e-02f,
+    9.552414111e-03f, -5.679797723e-03f, 3.332697341e-03f, -1.858707493e-03f, 9.513956104e-04f, -4.257016709e-04f,
+    1.510697169e-04f, -3.036541975e-05f, -1.431325436e-04f, 4.136793807e-04f, -9.368599470e-04f, 1.845505518e-03f,
+    -3.326496734e-03f, 5.684483352e-03f, -9.553966480e-03f, 1.676609805e-02f, -3.625689581e-02f, 9.974718818e-01f,
+    3.939686760e-02f, -1.760791026e-02f, 9.956725711e-03f, -5.920097846e-03f, 3.473879567e-03f, -1.937651653e-03f,
+    9.919683880e-04f, -4.439735497e-04f, 1.576327872e-04f, -3.173729603e-05f, -1.485358854e-04f, 4.295251776e-04f,
+    -9.730145228e-04f, 1.917054860e-03f, -3.455841947e-03f, 5.905851520e-03f, -9.925922052e-03f, 1.741630886e-02f,
+    -3.763904363e-02f, 9.972645532e-01f, 4.103495541e-02f, -1.832665274e-02f, 1.036146257e-02f, -6.160641764e-03f,
+    3.615219399e-03f, -2.016700185e-03f, 1.032607925e-03f, -4.622848683e-04f, 1.642162995e-04f, -3.311760835e-05f,
+    -1.539137490e-04f, 4.453143684e-04f, -1.009060959e-03f, 1.988415851e-03f, -3.584876185e-03f, 6.126713965e-03f,
+    -1.029702155e-02f, 1.806483477e-02f, -3.901584599e-02f, 9.970490765e-01f, 4.267768945e-02f, -1.904637220e-02f,
+    1.076661548e-02f, -6.401423886e-03f, 3.756713543e-03f, -2.095851262e-03f, 1.073313300e-03f, -4.806352309e-04f,
+    1.708201267e-04f, -3.450634289e-05f, -1.592660625e-04f, 4.610466746e-04f, -1.044998552e-03f, 2.059587023e-03f,
+    -3.713596732e-03f, 6.347066009e-03f, -1.066725730e-02f, 1.871166363e-02f, -4.038729198e-02f, 9.968254550e-01f,
+    4.432505355e-02f, -1.976705352e-02f, 1.117217521e-02f, -6.642438606e-03f, 3.898358694e-03f, -2.175103050e-03f,
+    1.114083592e-03f, -4.990242391e-04f, 1.774441409e-04f, -3.590348545e-05f, -1.645927554e-04f, 4.767218201e-04f,
+    -1.080826601e-03f, 2.130566920e-03f, -3.842000883e-03f, 6.566902997e-03f, -1.103662164e-02f, 1.935678337e-02f,
+    -4.175337076e-02f, 9.965936920e-01f, 4.597703148e-02f, -2.048868156e-02f, 1.157813250e-02f, -6.883680300e-03f,
+    4.040151537e-03f, -2.254453709e-03f, 1.154917872e-03f, -5.174514928e-04f, 1.840882130e-04f, -3.730902141e-05f,
+    -1.698937581e-04f, 4.923395311e-04f, -1.116544412e-03f, 2.201354091e-03f, -3.970085944e-03f, 6.786220292e-03f,
+    -1.140510695e-02f, 2.000018195e-02f, -4.311407160e-02f, 9.963537911e-01f, 4.763360687e-02f, -2.121124111e-02f,
+    1.198447807e-02f, -7.125143335e-03f, 4.182088751e-03f, -2.333901394e-03f, 1.195815210e-03f, -5.359165896e-04f,
+    1.907522128e-04f, -3.872293574e-05f, -1.751690018e-04f, 5.078995361e-04f, -1.152151294e-03f, 2.271947094e-03f,
+    -4.097849237e-03f, 7.005013279e-03f, -1.177270566e-02f, 2.064184740e-02f, -4.446938388e-02f, 9.961057557e-01f,
+    4.929476330e-02f, -2.193471689e-02f, 1.239120260e-02f, -7.366822059e-03f, 4.324167000e-03f, -2.413444252e-03f,
+    1.236774670e-03f, -5.544191248e-04f, 1.974360091e-04f, -4.014521299e-05f, -1.804184193e-04f, 5.234015662e-04f,
+    -1.187646561e-03f, 2.342344494e-03f, -4.225288096e-03f, 7.223277363e-03f, -1.213941020e-02f, 2.128176783e-02f,
+    -4.581929708e-02f, 9.958495898e-01f, 5.096048421e-02f, -2.265909362e-02f, 1.279829677e-02f, -7.608710807e-03f,
+    4.466382945e-03f, -2.493080426e-03f, 1.277795315e-03f, -5.729586918e-04f, 2.041394698e-04f, -4.157583731e-05f,
+    -1.856419439e-04f, 5.388453545e-04f, -1.223029532e-03f, 2.412544863e-03f, -4.352399865e-03f, 7.441007969e-03f,
+    -1.250521306e-02f, 2.191993140e-02f, -4.716380079e-02f, 9.955852971e-01f, 5.263075298e-02f, -2.338435593e-02f,
+    1.320575122e-02f, -7.850803901e-03f, 4.608733233e-03f, -2.572808053e-03f, 1.318876202e-03f, -5.915348818e-04f,
+    2.108624615e-04f, -4.301479242e-05f, -1.908395104e-04f, 5.542306367e-04f, -1.258299529e-03f, 2.482546784e-03f,
+    -4.479181905e-03f, 7.658200543e-03f, -1.287010675e-02f, 2.255632632e-02f, -4.850288470e-02f, 9.953128816e-01f,
+    5.430555290e-02f, -2.411048840e-02f, 1.361355657e-02f, -8.093095647e-03f, 4.751214504e-03f, -2.652625261e-03f,
+    1.360016386e-03f, -6.101472839e-04f, 2.176048498e-04f, -4.446206164e-05f, -1.960110543e-04f, 5.695571509e-04f,
+    -1.293455879e-03f, 2.552348844e-03f, -4.605631586e-03f, 7.874850551e-03f, -1.323408384e-02f, 2.319094087e-02f,
+    -4.983653859e-02f, 9.950323474e-01f, 5.598486714e-02f, -2.483747560e-02f, 1.402170341e-02f, -8.335580338e-03f,
+    4.893823389e-03f, -2.732530178e-03f, 1.401214916e-03f, -6.287954852e-04f, 2.243664993e-04f, -4.591762787e-05f,
+    -2.011565122e-04f, 5.848246374e-04f, -1.328497915e-03f, 2.621949641e-03f, -4.731746295e-03f, 8.090953481e-03f,
+    -1.359713689e-02f, 2.382376341e-02f, -5.116475236e-02f, 9.947436988e-01f, 5.766867878e-02f, -2.556530201e-02f,
+    1.443018233e-02f, -8.578252253e-03f, 5.036556509e-03f, -2.812520920e-03f, 1.442470841e-03f, -6.474790706e-04f,
+    2.311472736e-04f, -4.738147359e-05f, -2.062758221e-04f, 6.000328389e-04f, -1.363424974e-03f, 2.691347779e-03f,
+    -4.857523428e-03f, 8.306504841e-03f, -1.395925854e-02f, 2.445478233e-02f, -5.248751601e-02f, 9.944469401e-01f,
+    5.935697085e-02f, -2.629395209e-02f, 1.483898386e-02f, -8.821105657e-03f, 5.179410479e-03f, -2.892595601e-03f,
+    1.483783203e-03f, -6.661976229e-04f, 2.379470351e-04f, -4.885358086e-05f, -2.113689225e-04f, 6.151815006e-04f,
+    -1.398236396e-03f, 2.760541870e-03f, -4.982960395e-03f, 8.521500160e-03f, -1.432044143e-02f, 2.508398612e-02f,
+    -5.380481964e-02f, 9.941420758e-01f, 6.104972622e-02f, -2.702341023e-02f, 1.524809854e-02f, -9.064134801e-03f,
+    5.322381901e-03f, -2.972752328e-03f, 1.525151043e-03f, -6.849507228e-04f, 2.447656453e-04f, -5.033393134e-05f,
+    -2.164357534e-04f, 6.302703699e-04f, -1.432931527e-03f, 2.829530536e-03f, -5.108054622e-03f, 8.735934988e-03f,
+    -1.468067825e-02f, 2.571136329e-02f, -5.511665345e-02f, 9.938291105e-01f, 6.274692773e-02f, -2.775366078e-02f,
+    1.565751687e-02f, -9.307333923e-03f, 5.465467371e-03f, -3.052989202e-03f, 1.566573395e-03f, -7.037379491e-04f,
+    2.516029645e-04f, -5.182250625e-05f, -2.214762555e-04f, 6.452991967e-04f, -1.467509717e-03f, 2.898312405e-03f,
+    -5.232803545e-03f, 8.949804896e-03f, -1.503996173e-02f, 2.633690245e-02f, -5.642300777e-02f, 9.935080488e-01f,
+    6.444855808e-02f, -2.848468806e-02f, 1.606722932e-02f, -9.550697248e-03f, 5.608663476e-03f, -3.133304321e-03f,
+    1.608049294e-03f, -7.225588783e-04f, 2.584588521e-04f, -5.331928641e-05f, -2.264903709e-04f, 6.602677333e-04f,
+    -1.501970321e-03f, 2.966886113e-03f, -5.357204614e-03f, 9.163105476e-03f, -1.539828462e-02f, 2.696059225e-02f,
+    -5.772387299e-02f, 9.931788957e-01f, 6.615459991e-02f, -2.921647631e-02f, 1.647722637e-02f, -9.794218987e-03f,
+    5.751966794e-03f, -3.213695773e-03f, 1.649577767e-03f, -7.414130851e-04f, 2.653331663e-04f, -5.482425219e-05f,
+    -2.314780423e-04f, 6.751757341e-04f, -1.536312699e-03f, 3.035250304e-03f, -5.481255292e-03f, 9.375832343e-03f,
+    -1.575563972e-02f, 2.758242142e-02f, -5.901923965e-02f, 9.928416562e-01f, 6.786503576e-02f, -2.994900974e-02f,
+    1.688749843e-02f, -1.003789334e-02f, 5.895373895e-03f, -3.294161644e-03f, 1.691157841e-03f, -7.603001419e-04f,
+    2.722257644e-04f, -5.633738357e-05f, -2.364392138e-04f, 6.900229563e-04f, -1.570536214e-03f, 3.103403632e-03f,
+    -5.604953056e-03f, 9.587981130e-03f, -1.611201985e-02f, 2.820237873e-02f, -6.030909836e-02f, 9.924963352e-01f,
+    6.957984806e-02f, -3.068227253e-02f, 1.729803593e-02f, -1.028171448e-02f, 6.038881339e-03f, -3.374700012e-03f,
+    1.732788537e-03f, -7.792196191e-04f, 2.791365026e-04f, -5.785866010e-05f, -2.413738304e-04f, 7.048091591e-04f,
+    -1.604640235e-03f, 3.171344757e-03f, -5.728295396e-03f, 9.799547494e-03f, -1.646741788e-02f, 2.882045304e-02f,
+    -6.159343984e-02f, 9.921429380e-01f, 7.129901918e-02f, -3.141624879e-02f, 1.770882926e-02f, -1.052567660e-02f,
+    6.182485680e-03f, -3.455308952e-03f, 1.774468874e-03f, -7.981710853e-04f, 2.860652361e-04f, -5.938806090e-05f,
+    -2.462818381e-04f, 7.195341043e-04f, -1.638624135e-03f, 3.239072347e-03f, -5.851279814e-03f, 1.001052711e-02f,
+    -1.682182670e-02f, 2.943663325e-02f, -6.287225494e-02f, 9.917814699e-01f, 7.302253138e-02f, -3.215092258e-02f,
+    1.811986878e-02f, -1.076977384e-02f, 6.326183463e-03f, -3.535986532e-03f, 1.816197868e-03f, -8.171541068e-04f,
+    2.930118189e-04f, -6.092556466e-05f, -2.511631840e-04f, 7.341975559e-04f, -1.672487293e-03f, 3.306585079e-03f,
+    -5.973903828e-03f, 1.022091568e-02f, -1.717523925e-02f, 3.005090834e-02f, -6.414553459e-02f, 9.914119365e-01f,
+    7.475036683e-02f, -3.288627793e-02f, 1.853114485e-02f, -1.101400036e-02f, 6.469971222e-03f, -3.616730814e-03f,
+    1.857974529e-03f, -8.361682479e-04f, 2.999761040e-04f, -6.247114967e-05f, -2.560178162e-04f, 7.487992805e-04f,
+    -1.706229090e-03f, 3.373881639e-03f, -6.096164966e-03f, 1.043070893e-02f, -1.752764849e-02f, 3.066326735e-02f,
+    -6.541326982e-02f, 9.910343431e-01f, 7.648250761e-02f, -3.362229883e-02f, 1.894264779e-02f, -1.125835029e-02f,
+    6.613845488e-03f, -3.697539855e-03f, 1.899797866e-03f, -8.552130712e-04f, 3.069579437e-04f, -6.402479377e-05f,
+    -2.608456838e-04f, 7.633390468e-04f, -1.739848914e-03f, 3.440960718e-03f, -6.218060773e-03f, 1.063990260e-02f,
+    -1.787904744e-02f, 3.127369938e-02f, -6.667545179e-02f, 9.906486957e-01f, 7.821893571e-02f, -3.435896920e-02f,
+    1.935436790e-02f, -1.150281775e-02f, 6.757802780e-03f, -3.778411708e-03f, 1.941666883e-03f, -8.742881368e-04f,
+    3.139571887e-04f, -6.558647439e-05f, -2.656467370e-04f, 7.778166262e-04f, -1.773346156e-03f, 3.507821020e-03f,
+    -6.339588805e-03f, 1.084849244e-02f, -1.822942914e-02f, 3.188219360e-02f, -6.793207174e-02f, 9.902549999e-01f,
+    7.995963304e-02f, -3.509627294e-02f, 1.976629548e-02f, -1.174739684e-02f, 6.901839610e-03f, -3.859344420e-03f,
+    1.983580583e-03f, -8.933930031e-04f, 3.209736891e-04f, -6.715616853e-05f, -2.704209270e-04f, 7.922317923e-04f,
+    -1.806720213e-03f, 3.574461252e-03f, -6.460746633e-03f, 1.105647425e-02f, -1.857878665e-02f, 3.248873923e-02f,
+    -6.918312102e-02f, 9.898532617e-01f, 8.170458141e-02f, -3.583419388e-02f, 2.017842078e-02f, -1.199208168e-02f,
+    7.045952482e-03f, -3.940336032e-03f, 2.025537963e-03f, -9.125272265e-04f, 3.280072938e-04f, -6.873385277e-05f,
+    -2.751682059e-04f, 8.065843210e-04f, -1.839970485e-03f, 3.640880132e-03f, -6.581531840e-03f, 1.126384384e-02f,
+    -1.892711309e-02f, 3.309332557e-02f, -7.042859110e-02f, 9.894434871e-01f, 8.345376254e-02f, -3.657271582e-02f,
+    2.059073405e-02f, -1.223686633e-02f, 7.190137893e-03f, -4.021384580e-03f, 2.067538018e-03f, -9.316903615e-04f,
+    3.350578507e-04f, -7.031950324e-05f, -2.798885270e-04f, 8.208739908e-04f, -1.873096379e-03f, 3.707076386e-03f,
+    -6.701942025e-03f, 1.147059703e-02f, -1.927440162e-02f, 3.369594197e-02f, -7.166847354e-02f, 9.890256824e-01f,
+    8.520715807e-02f, -3.731182252e-02f, 2.100322551e-02f, -1.248174489e-02f, 7.334392331e-03f, -4.102488096e-03f,
+    2.109579739e-03f, -9.508819603e-04f, 3.421252066e-04f, -7.191309567e-05f, -2.845818446e-04f, 8.351005823e-04f,
+    -1.906097305e-03f, 3.773048749e-03f, -6.821974797e-03f, 1.167672968e-02f, -1.962064540e-02f, 3.429657787e-02f,
+    -7.290276000e-02f, 9.885998538e-01f, 8.696474953e-02f, -3.805149769e-02f, 2.141588536e-02f, -1.272671139e-02f,
+    7.478712278e-03f, -4.183644605e-03f, 2.151662114e-03f, -9.701015734e-04f, 3.492092074e-04f, -7.351460535e-05f,
+    -2.892481139e-04f, 8.492638787e-04f, -1.938972677e-03f, 3.838795962e-03f, -6.941627783e-03f, 1.188223767e-02f,
+    -1.996583768e-02f, 3.489522275e-02f, -7.413144227e-02f, 9.881660078e-01f, 8.872651839e-02f, -3.879172500e-02f,
+    2.182870379e-02f, -1.297175991e-02f, 7.623094207e-03f, -4.264852129e-03f, 2.193784129e-03f, -9.893487492e-04f,
+    3.563096978e-04f, -7.512400713e-05f, -2.938872913e-04f, 8.633636656e-04f, -1.971721916e-03f, 3.904316775e-03f,
+    -7.060898621e-03f, 1.208711687e-02f, -2.030997170e-02f, 3.549186616e-02f, -7.535451222e-02f, 9.877241510e-01f,
+    9.049244601e-02f, -3.953248806e-02f, 2.224167095e-02f, -1.321688447e-02f, 7.767534583e-03f, -4.346108684e-03f,
+    2.235944764e-03f, -1.008623034e-03f, 3.634265217e-04f, -7.674127545e-05f, -2.984993339e-04f, 8.773997308e-04f,
+    -2.004344446e-03f, 3.969609949e-03f, -7.179784963e-03f, 1.229136323e-02f, -2.065304076e-02f, 3.608649772e-02f,
+    -7.657196183e-02f, 9.872742898e-01f, 9.226251367e-02f, -4.027377045e-02f, 2.265477699e-02f, -1.346207910e-02f,
+    7.912029866e-03f, -4.427412279e-03f, 2.278142998e-03f, -1.027923973e-03f, 3.705595218e-04f, -7.836638430e-05f,
+    -3.030842002e-04f, 8.913718646e-04f, -2.036839695e-03f, 4.034674249e-03f, -7.298284475e-03f, 1.249497267e-02f,
+    -2.099503818e-02f, 3.667910712e-02f, -7.778378319e-02f, 9.868164313e-01f, 9.403670256e-02f, -4.101555572e-02f,
+    2.306801204e-02f, -1.370733782e-02f, 8.056576506e-03f, -4.508760922e-03f, 2.320377806e-03f, -1.047251109e-03f,
+    3.777085398e-04f, -7.999930725e-05f, -3.076418495e-04f, 9.052798597e-04f, -2.069207098e-03f, 4.099508452e-03f,
+    -7.416394837e-03f, 1.269794116e-02f, -2.133595735e-02f, 3.726968409e-02f, -7.898996850e-02f, 9.863505822e-01f,
+    9.581499379e-02f, -4.175782735e-02f, 2.348136620e-02f, -1.395265463e-02f, 8.201170947e-03f, -4.590152613e-03f,
+    2.362648160e-03f, -1.066603982e-03f, 3.848734164e-04f, -8.164001745e-05f, -3.121722421e-04f, 9.191235111e-04f,
+    -2.101446093e-03f, 4.164111341e-03f, -7.534113744e-03f, 1.290026469e-02f, -2.167579165e-02f, 3.785821845e-02f,
+    -8.019051005e-02f, 9.858767495e-01f, 9.759736837e-02f, -4.250056880e-02f, 2.389482955e-02f, -1.419802353e-02f,
+    8.345809625e-03f, -4.671585349e-03f, 2.404953029e-03f, -1.085982130e-03f, 3.920539914e-04f, -8.328848759e-05f,
+    -3.166753393e-04f, 9.329026162e-04f, -2.133556124e-03f, 4.228481708e-03f, -7.651438902e-03f, 1.310193926e-02f,
+    -2.201453453e-02f, 3.844470009e-02f, -8.138540026e-02f, 9.853949405e-01f, 9.938380723e-02f, -4.324376347e-02f,
+    2.430839216e-02f, -1.444343849e-02f, 8.490488971e-03f, -4.753057120e-03f, 2.447291377e-03f, -1.105385092e-03f,
+    3.992501033e-04f, -8.494468995e-05f, -3.211511036e-04f, 9.466169749e-04f, -2.165536637e-03f, 4.292618353e-03f,
+    -7.768368034e-03f, 1.330296090e-02f, -2.235217948e-02f, 3.902911894e-02f, -8.257463162e-02f, 9.849051624e-01f,
+    1.011742912e-01f, -4.398739473e-02f, 2.472204407e-02f, -1.468889350e-02f, 8.635205405e-03f, -4.834565914e-03f,
+    2.489662168e-03f, -1.124812401e-03f, 4.064615899e-04f, -8.660859637e-05f, -3.255994982e-04f, 9.602663894e-04f,
+    -2.197387085e-03f, 4.356520086e-03f, -7.884898876e-03f, 1.350332567e-02f, -2.268872000e-02f, 3.961146501e-02f,
+    -8.375819675e-02f, 9.844074225e-01f, 1.029688011e-01f, -4.473144591e-02f, 2.513577533e-02f, -1.493438250e-02f,
+    8.779955345e-03f, -4.916109712e-03f, 2.532064361e-03f, -1.144263592e-03f, 4.136882878e-04f, -8.828017825e-05f,
+    -3.300204876e-04f, 9.738506641e-04f, -2.229106927e-03f, 4.420185724e-03f, -8.001029177e-03f, 1.370302964e-02f,
+    -2.302414965e-02f, 4.019172838e-02f, -8.493608838e-02f, 9.839017285e-01f, 1.047673175e-01f, -4.547590028e-02f,
+    2.554957594e-02f, -1.517989947e-02f, 8.924735198e-03f, -4.997686491e-03f, 2.574496912e-03f, -1.163738194e-03f,
+    4.209300326e-04f, -8.995940657e-05f, -3.344140371e-04f, 9.873696060e-04f, -2.260695624e-03f, 4.483614093e-03f,
+    -8.116756700e-03f, 1.390206892e-02f, -2.335846202e-02f, 4.076989920e-02f, -8.610829933e-02f, 9.833880878e-01f,
+    1.065698210e-01f, -4.622074110e-02f, 2.596343589e-02f, -1.542543832e-02f, 9.069541366e-03f, -5.079294224e-03f,
+    2.616958773e-03f, -1.183235738e-03f, 4.281866590e-04f, -9.164625187e-05f, -3.387801130e-04f, 1.000823025e-03f,
+    -2.292152642e-03f, 4.546804026e-03f, -8.232079225e-03f, 1.410043962e-02f, -2.369165073e-02f, 4.134596765e-02f,
+    -8.727482252e-02f, 9.828665083e-01f, 1.083762922e-01f, -4.696595156e-02f, 2.637734515e-02f, -1.567099300e-02f,
+    9.214370244e-03f, -5.160930879e-03f, 2.659448896e-03f, -1.202755751e-03f, 4.354580006e-04f, -9.334068424e-05f,
+    -3.431186828e-04f, 1.014210731e-03f, -2.323477453e-03f, 4.609754366e-03f, -8.346994542e-03f, 1.429813789e-02f,
+    -2.402370946e-02f, 4.191992403e-02f, -8.843565100e-02f, 9.823369977e-01f, 1.101867114e-01f, -4.771151482e-02f,
+    2.679129370e-02f, -1.591655742e-02f, 9.359218221e-03f, -5.242594419e-03f, 2.701966227e-03f, -1.222297758e-03f,
+    4.427438899e-04f, -9.504267336e-05f, -3.474297147e-04f, 1.027532541e-03f, -2.354669533e-03f, 4.672463965e-03f,
+    -8.461500458e-03f, 1.449515989e-02f, -2.435463190e-02f, 4.249175866e-02f, -8.959077791e-02f, 9.817995642e-01f,
+    1.120010590e-01f, -4.845741401e-02f, 2.720527147e-02f, -1.616212550e-02f, 9.504081678e-03f, -5.324282803e-03f,
+    2.744509710e-03f, -1.241861284e-03f, 4.500441588e-04f, -9.675218846e-05f, -3.517131782e-04f, 1.040788268e-03f,
+    -2.385728364e-03f, 4.734931681e-03f, -8.575594793e-03f, 1.469150182e-02f, -2.468441179e-02f, 4.306146196e-02f,
+    -9.074019649e-02f, 9.812542158e-01f, 1.138193152e-01f, -4.920363220e-02f, 2.761926838e-02f, -1.640769113e-02f,
+    9.648956990e-03f, -5.405993985e-03f, 2.787078286e-03f, -1.261445849e-03f, 4.573586377e-04f, -9.846919834e-05f,
+    -3.559690435e-04f, 1.053977734e-03f, -2.416653430e-03f, 4.797156383e-03f, -8.689275381e-03f, 1.488715989e-02f,
+    -2.501304292e-02f, 4.362902439e-02f, -9.188390009e-02f, 9.807009606e-01f, 1.156414602e-01f, -4.995015245e-02f,
+    2.803327434e-02f, -1.665324822e-02f, 9.793840527e-03f, -5.487725915e-03f, 2.829670893e-03f, -1.281050975e-03f,
+    4.646871562e-04f, -1.001936713e-04f, -3.601972821e-04f, 1.067100758e-03f, -2.447444223e-03f, 4.859136948e-03f,
+    -8.802540073e-03f, 1.508213034e-02f, -2.534051909e-02f, 4.419443649e-02f, -9.302188218e-02f, 9.801398071e-01f,
+    1.174674740e-01f, -5.069695774e-02f, 2.844727924e-02f, -1.689879063e-02f, 9.938728650e-03f, -5.569476539e-03f,
+    2.872286467e-03f, -1.300676179e-03f, 4.720295431e-04f, -1.019255754e-04f, -3.643978660e-04f, 1.080157165e-03f,
+    -2.478100237e-03f, 4.920872259e-03f, -8.915386729e-03f, 1.527640942e-02f, -2.566683417e-02f, 4.475768887e-02f,
+    -9.415413632e-02f, 9.795707637e-01f, 1.192973366e-01f, -5.144403104e-02f, 2.886127295e-02f, -1.714431224e-02f,
+    1.008361772e-02f, -5.651243798e-03f, 2.914923939e-03f, -1.320320978e-03f, 4.793856259e-04f, -1.036648780e-04f,
+    -3.685707688e-04f, 1.093146781e-03f, -2.508620973e-03f, 4.982361212e-03f, -9.027813228e-03f, 1.546999342e-02f,
+    -2.599198204e-02f, 4.531877219e-02f, -9.528065617e-02f, 9.789938390e-01f, 1.211310280e-01f, -5.219135527e-02f,
+    2.927524534e-02f, -1.738980691e-02f, 1.022850408e-02f, -5.733025629e-03f, 2.957582239e-03f, -1.339984887e-03f,
+    4.867552313e-04f, -1.054115462e-04f, -3.727159646e-04f, 1.106069432e-03f, -2.539005935e-03f, 5.043602707e-03f,
+    -9.139817462e-03f, 1.566287864e-02f, -2.631595664e-02f, 4.587767720e-02f, -9.640143551e-02f, 9.784090416e-01f,
+    1.229685279e-01f, -5.293891333e-02f, 2.968918624e-02f, -1.763526851e-02f, 1.037338408e-02f, -5.814819965e-03f,
+    3.000260294e-03f, -1.359667418e-03f, 4.941381850e-04f, -1.071655466e-04f, -3.768334287e-04f, 1.118924952e-03f,
+    -2.569254632e-03f, 5.104595656e-03f, -9.251397336e-03f, 1.585506142e-02f, -2.663875193e-02f, 4.643439469e-02f,
+    -9.751646822e-02f, 9.778163804e-01f, 1.248098161e-01f, -5.368668806e-02f, 3.010308548e-02f, -1.788069086e-02f,
+    1.051825405e-02f, -5.896624733e-03f, 3.042957027e-03f, -1.379368082e-03f, 5.015343116e-04f, -1.089268454e-04f,
+    -3.809231374e-04f, 1.131713172e-03f, -2.599366579e-03f, 5.165338978e-03f, -9.362550772e-03f, 1.604653811e-02f,
+    -2.696036193e-02f, 4.698891555e-02f, -9.862574829e-02f, 9.772158644e-01f, 1.266548723e-01f, -5.443466227e-02f,
+    3.051693288e-02f, -1.812606782e-02f, 1.066311033e-02f, -5.978437860e-03f, 3.085671359e-03f, -1.399086390e-03f,
+    5.089434349e-04f, -1.106954083e-04f, -3.849850677e-04f, 1.144433927e-03f, -2.629341296e-03f, 5.225831601e-03f,
+    -9.473275703e-03f, 1.623730508e-02f, -2.728078067e-02f, 4.754123071e-02f, -9.972926981e-02f, 9.766075024e-01f,
+    1.285036760e-01f, -5.518281873e-02f, 3.093071822e-02f, -1.837139320e-02f, 1.080794925e-02f, -6.060257264e-03f,
+    3.128402207e-03f, -1.418821847e-03f, 5.163653775e-04f, -1.124712006e-04f, -3.890191980e-04f, 1.157087057e-03f,
+    -2.659178304e-03f, 5.286072460e-03f, -9.583570079e-03f, 1.642735874e-02f, -2.760000224e-02f, 4.809133117e-02f,
+    -1.008270270e-01f, 9.759913038e-01f, 1.303562067e-01f, -5.593114017e-02f, 3.134443129e-02f, -1.861666082e-02f,
+    1.095276712e-02f, -6.142080862e-03f, 3.171148488e-03f, -1.438573960e-03f, 5.237999612e-04f, -1.142541872e-04f,
+    -3.930255073e-04f, 1.169672400e-03f, -2.688877134e-03f, 5.346060502e-03f, -9.693431864e-03f, 1.661669551e-02f,
+    -2.791802076e-02f, 4.863920800e-02f, -1.019190141e-01f, 9.753672778e-01f, 1.322124438e-01f, -5.667960929e-02f,
+    3.175806185e-02f, -1.886186451e-02f, 1.109756026e-02f, -6.223906567e-03f, 3.213909113e-03f, -1.458342233e-03f,
+    5.312470067e-04f, -1.160443325e-04f, -3.970039758e-04f, 1.182189800e-03f, -2.718437318e-03f, 5.405794679e-03f,
+    -9.802859037e-03f, 1.680531183e-02f, -2.823483040e-02f, 4.918485235e-02f, -1.030052255e-01f, 9.747354338e-01f,
+    1.340723667e-01f, -5.742820876e-02f, 3.217159965e-02f, -1.910699805e-02f, 1.124232498e-02f, -6.305732286e-03f,
+    3.256682993e-03f, -1.478126168e-03f, 5.387063339e-04f, -1.178416004e-04f, -4.009545845e-04f, 1.194639101e-03f,
+    -2.747858394e-03f, 5.465273954e-03f, -9.911849590e-03f, 1.699320418e-02f, -2.855042536e-02f, 4.972825543e-02f,
+    -1.040856558e-01f, 9.740957813e-01f, 1.359359546e-01f, -5.817692120e-02f, 3.258503443e-02f, -1.935205525e-02f,
+    1.138705759e-02f, -6.387555925e-03f, 3.299469034e-03f, -1.497925267e-03f, 5.461777616e-04f, -1.196459545e-04f,
+    -4.048773155e-04f, 1.207020150e-03f, -2.777139906e-03f, 5.524497298e-03f, -1.002040153e-02f, 1.718036905e-02f,
+    -2.886479987e-02f, 5.026940850e-02f, -1.051602996e-01f, 9.734483299e-01f, 1.378031866e-01f, -5.892572920e-02f,
+    3.299835592e-02f, -1.959702988e-02f, 1.153175438e-02f, -6.469375382e-03f, 3.342266141e-03f, -1.517739026e-03f,
+    5.536611077e-04f, -1.214573579e-04f, -4.087721518e-04f, 1.219332798e-03f, -2.806281401e-03f, 5.583463690e-03f,
+    -1.012851288e-02f, 1.736680296e-02f, -2.917794821e-02f, 5.080830291e-02f, -1.062291517e-01f, 9.727930895e-01f,
+    1.396740419e-01f, -5.967461530e-02f, 3.341155380e-02f, -1.984191573e-02f, 1.167641164e-02f, -6.551188557e-03f,
+    3.385073215e-03f, -1.537566945e-03f, 5.611561890e-04f, -1.232757733e-04f, -4.126390773e-04f, 1.231576896e-03f,
+    -2.835282431e-03f, 5.642172119e-03f, -1.023618168e-02f, 1.755250245e-02f, -2.948986470e-02f, 5.134493008e-02f,
+    -1.072922067e-01f, 9.721300698e-01f, 1.415484995e-01f, -6.042356203e-02f, 3.382461779e-02f, -2.008670657e-02f,
+    1.182102567e-02f, -6.632993340e-03f, 3.427889155e-03f, -1.557408517e-03f, 5.686628215e-04f, -1.251011629e-04f,
+    -4.164780769e-04f, 1.243752298e-03f, -2.864142554e-03f, 5.700621581e-03f, -1.034340597e-02f, 1.773746409e-02f,
+    -2.980054369e-02f, 5.187928147e-02f, -1.083494597e-01f, 9.714592808e-01f, 1.434265382e-01f, -6.117255187e-02f,
+    3.423753757e-02f, -2.033139617e-02f, 1.196559274e-02f, -6.714787622e-03f, 3.470712859e-03f, -1.577263238e-03f,
+    5.761808201e-04f, -1.269334884e-04f, -4.202891365e-04f, 1.255858862e-03f, -2.892861332e-03f, 5.758811082e-03f,
+    -1.045018383e-02f, 1.792168447e-02f, -3.010997958e-02f, 5.241134863e-02f, -1.094009058e-01f, 9.707807327e-01f,
+    1.453081369e-01f, -6.192156727e-02f, 3.465030279e-02f, -2.057597827e-02f, 1.211010914e-02f, -6.796569287e-03f,
+    3.513543220e-03f, -1.597130598e-03f, 5.837099990e-04f, -1.287727112e-04f, -4.240722429e-04f, 1.267896446e-03f,
+    -2.921438331e-03f, 5.816739636e-03f, -1.055651333e-02f, 1.810516020e-02f, -3.041816681e-02f, 5.294112318e-02f,
+    -1.104465400e-01f, 9.700944356e-01f, 1.471932744e-01f, -6.267059063e-02f, 3.506290311e-02f, -2.082044662e-02f,
+    1.225457113e-02f, -6.878336219e-03f, 3.556379129e-03f, -1.617010089e-03f, 5.912501711e-04f, -1.306187922e-04f,
+    -4.278273839e-04f, 1.279864911e-03f, -2.949873123e-03f, 5.874406267e-03f, -1.066239257e-02f, 1.828788792e-02f,
+    -3.072509985e-02f, 5.346859679e-02f, -1.114863576e-01f, 9.694003999e-01f, 1.490819294e-01f, -6.341960435e-02f,
+    3.547532818e-02f, -2.106479498e-02f, 1.239897500e-02f, -6.960086295e-03f, 3.599219475e-03f, -1.636901199e-03f,
+    5.988011486e-04f, -1.324716919e-04f, -4.315545481e-04f, 1.291764122e-03f, -2.978165284e-03f, 5.931810005e-03f,
+    -1.076781966e-02f, 1.846986429e-02f, -3.103077320e-02f, 5.399376122e-02f, -1.125203540e-01f, 9.686986361e-01f,
+    1.509740805e-01f, -6.416859075e-02f, 3.588756762e-02f, -2.130901706e-02f, 1.254331698e-02f, -7.041817391e-03f,
+    3.642063144e-03f, -1.656803415e-03f, 6.063627427e-04f, -1.343313703e-04f, -4.352537253e-04f, 1.303593944e-03f,
+    -3.006314396e-03f, 5.988949891e-03f, -1.087279273e-02f, 1.865108601e-02f, -3.133518143e-02f, 5.451660828e-02f,
+    -1.135485246e-01f, 9.679891546e-01f, 1.528697061e-01f, -6.491753216e-02f, 3.629961105e-02f, -2.155310661e-02f,
+    1.268759336e-02f, -7.123527376e-03f, 3.684909021e-03f, -1.676716223e-03f, 6.139347637e-04f, -1.361977869e-04f,
+    -4.389249060e-04f, 1.315354246e-03f, -3.034320045e-03f, 6.045824975e-03f, -1.097730991e-02f, 1.883154977e-02f,
+    -3.163831913e-02f, 5.503712985e-02f, -1.145708651e-01f, 9.672719662e-01f, 1.547687848e-01f, -6.566641085e-02f,
+    3.671144807e-02f, -2.179705734e-02f, 1.283180038e-02f, -7.205214121e-03f, 3.727755986e-03f, -1.696639106e-03f,
+    6.215170207e-04f, -1.380709009e-04f, -4.425680816e-04f, 1.327044899e-03f, -3.062181820e-03f, 6.102434314e-03f,
+    -1.108136936e-02f, 1.901125231e-02f, -3.194018092e-02f, 5.555531789e-02f, -1.155873710e-01f, 9.665470817e-01f,
+    1.566712950e-01f, -6.641520906e-02f, 3.712306828e-02f, -2.204086296e-02f, 1.297593429e-02f, -7.286875489e-03f,
+    3.770602918e-03f, -1.716571548e-03f, 6.291093223e-04f, -1.399506710e-04f, -4.461832448e-04f, 1.338665775e-03f,
+    -3.089899319e-03f, 6.158776975e-03f, -1.118496925e-02f, 1.919019040e-02f, -3.224076148e-02f, 5.607116443e-02f,
+    -1.165980381e-01f, 9.658145119e-01f, 1.585772148e-01f, -6.716390902e-02f, 3.753446124e-02f, -2.228451719e-02f,
+    1.311999133e-02f, -7.368509341e-03f, 3.813448694e-03f, -1.736513027e-03f, 6.367114758e-04f, -1.418370554e-04f,
+    -4.497703888e-04f, 1.350216751e-03f, -3.117472141e-03f, 6.214852033e-03f, -1.128810776e-02f, 1.936836081e-02f,
+    -3.254005552e-02f, 5.658466154e-02f, -1.176028624e-01f, 9.650742679e-01f, 1.604865226e-01f, -6.791249289e-02f,
+    3.794561654e-02f, -2.252801373e-02f, 1.326396775e-02f, -7.450113536e-03f, 3.856292189e-03f, -1.756463024e-03f,
+    6.443232878e-04f, -1.437300120e-04f, -4.533295080e-04f, 1.361697703e-03f, -3.144899891e-03f, 6.270658573e-03f,
+    -1.139078309e-02f, 1.954576036e-02f, -3.283805779e-02f, 5.709580139e-02f, -1.186018398e-01f, 9.643263608e-01f,
+    1.623991965e-01f, -6.866094282e-02f, 3.835652373e-02f, -2.277134627e-02f, 1.340785979e-02f, -7.531685928e-03f,
+    3.899132273e-03f, -1.776421016e-03f, 6.519445637e-04f, -1.456294981e-04f, -4.568605976e-04f, 1.373108513e-03f,
+    -3.172182179e-03f, 6.326195686e-03f, -1.149299346e-02f, 1.972238587e-02f, -3.313476308e-02f, 5.760457620e-02f,
+    -1.195949665e-01f, 9.635708019e-01f, 1.643152145e-01f, -6.940924094e-02f, 3.876717235e-02f, -2.301450849e-02f,
+    1.355166367e-02f, -7.613224370e-03f, 3.941967816e-03f, -1.796386479e-03f, 6.595751084e-04f, -1.475354707e-04f,
+    -4.603636537e-04f, 1.384449062e-03f, -3.199318621e-03f, 6.381462475e-03f, -1.159473709e-02f, 1.989823420e-02f,
+    -3.343016622e-02f, 5.811097827e-02f, -1.205822386e-01f, 9.628076025e-01f, 1.662345546e-01f, -7.015736932e-02f,
+    3.917755194e-02f, -2.325749410e-02f, 1.369537562e-02f, -7.694726709e-03f, 3.984797686e-03f, -1.816358886e-03f,
+    6.672147255e-04f, -1.494478862e-04f, -4.638386736e-04f, 1.395719235e-03f, -3.226308835e-03f, 6.436458051e-03f,
+    -1.169601223e-02f, 2.007330224e-02f, -3.372426209e-02f, 5.861499997e-02f, -1.215636524e-01f, 9.620367741e-01f,
+    1.681571947e-01f, -7.090531002e-02f, 3.958765203e-02f, -2.350029676e-02f, 1.383899187e-02f, -7.776190790e-03f,
+    4.027620747e-03f, -1.836337712e-03f, 6.748632178e-04f, -1.513667007e-04f, -4.672856550e-04f, 1.406918919e-03f,
+    -3.253152446e-03f, 6.491181532e-03f, -1.179681713e-02f, 2.024758688e-02f, -3.401704558e-02f, 5.911663372e-02f,
+    -1.225392043e-01f, 9.612583283e-01f, 1.700831128e-01f, -7.165304506e-02f, 3.999746212e-02f, -2.374291015e-02f,
+    1.398250864e-02f, -7.857614458e-03f, 4.070435862e-03f, -1.856322427e-03f, 6.825203873e-04f, -1.532918699e-04f,
+    -4.707045971e-04f, 1.418048005e-03f, -3.279849083e-03f, 6.545632047e-03f, -1.189715008e-02f, 2.042108506e-02f,
+    -3.430851166e-02f, 5.961587202e-02f, -1.235088909e-01f, 9.604722768e-01f, 1.720122864e-01f, -7.240055644e-02f,
+    4.040697173e-02f, -2.398532793e-02f, 1.412592214e-02f, -7.938995550e-03f, 4.113241891e-03f, -1.876312501e-03f,
+    6.901860349e-04f, -1.552233489e-04f, -4.740954995e-04f, 1.429106383e-03f, -3.306398380e-03f, 6.599808732e-03f,
+    -1.199700936e-02f, 2.059379373e-02f, -3.459865532e-02f, 6.011270744e-02f, -1.244727088e-01f, 9.596786314e-01f,
+    1.739446934e-01f, -7.314782611e-02f, 4.081617035e-02f, -2.422754377e-02f, 1.426922858e-02f, -8.020331904e-03f,
+    4.156037692e-03f, -1.896307402e-03f, 6.978599608e-04f, -1.571610924e-04f, -4.774583630e-04f, 1.440093947e-03f,
+    -3.332799975e-03f, 6.653710733e-03f, -1.209639327e-02f, 2.076570988e-02f, -3.488747157e-02f, 6.060713263e-02f,
+    -1.254306547e-01f, 9.588774041e-01f, 1.758803113e-01f, -7.389483602e-02f, 4.122504745e-02f, -2.446955133e-02f,
+    1.441242419e-02f, -8.101621352e-03f, 4.198822122e-03f, -1.916306597e-03f, 7.055419641e-04f, -1.591050547e-04f,
+    -4.807931893e-04f, 1.451010594e-03f, -3.359053513e-03f, 6.707337205e-03f, -1.219530013e-02f, 2.093683049e-02f,
+    -3.517495551e-02f, 6.109914028e-02f, -1.263827254e-01f, 9.580686068e-01f, 1.778191176e-01f, -7.464156805e-02f,
+    4.163359252e-02f, -2.471134425e-02f, 1.455550515e-02f, -8.182861727e-03f, 4.241594034e-03f, -1.936309551e-03f,
+    7.132318432e-04f, -1.610551897e-04f, -4.840999809e-04f, 1.461856223e-03f, -3.385158642e-03f, 6.760687310e-03f,
+    -1.229372828e-02f, 2.110715261e-02f, -3.546110224e-02f, 6.158872317e-02f, -1.273289179e-01f, 9.572522518e-01f,
+    1.797610899e-01f, -7.538800409e-02f, 4.204179503e-02f, -2.495291619e-02f, 1.469846768e-02f, -8.264050856e-03f,
+    4.284352280e-03f, -1.956315728e-03f, 7.209293954e-04f, -1.630114507e-04f, -4.873787413e-04f, 1.472630734e-03f,
+    -3.411115014e-03f, 6.813760221e-03f, -1.239167607e-02f, 2.127667328e-02f, -3.574590690e-02f, 6.207587416e-02f,
+    -1.282692293e-01f, 9.564283513e-01f, 1.817062055e-01f, -7.613412598e-02f, 4.244964442e-02f, -2.519426079e-02f,
+    1.484130797e-02f, -8.345186565e-03f, 4.327095710e-03f, -1.976324590e-03f, 7.286344173e-04f, -1.649737908e-04f,
+    -4.906294747e-04f, 1.483334031e-03f, -3.436922288e-03f, 6.866555120e-03f, -1.248914185e-02f, 2.144538959e-02f,
+    -3.602936470e-02f, 6.256058614e-02f, -1.292036565e-01f, 9.555969176e-01f, 1.836544417e-01f, -7.687991554e-02f,
+    4.285713015e-02f, -2.543537169e-02f, 1.498402222e-02f, -8.426266676e-03f, 4.369823170e-03f, -1.996335598e-03f,
+    7.363467045e-04f, -1.669421625e-04f, -4.938521864e-04f, 1.493966020e-03f, -3.462580126e-03f, 6.919071194e-03f,
+    -1.258612402e-02f, 2.161329863e-02f, -3.631147087e-02f, 6.304285211e-02f, -1.301321970e-01f, 9.547579634e-01f,
+    1.856057758e-01f, -7.762535455e-02f, 4.326424166e-02f, -2.567624252e-02f, 1.512660662e-02f, -8.507289009e-03f,
+    4.412533508e-03f, -2.016348211e-03f, 7.440660517e-04f, -1.689165179e-04f, -4.970468825e-04f, 1.504526608e-03f,
+    -3.488088196e-03f, 6.971307645e-03f, -1.268262095e-02f, 2.178039753e-02f, -3.659222067e-02f, 6.352266511e-02f,
+    -1.310548480e-01f, 9.539115011e-01f, 1.875601850e-01f, -7.837042478e-02f, 4.367096837e-02f, -2.591686691e-02f,
+    1.526905736e-02f, -8.588251383e-03f, 4.455225565e-03f, -2.036361888e-03f, 7.517922528e-04f, -1.708968087e-04f,
+    -5.002135701e-04f, 1.515015705e-03f, -3.513446169e-03f, 7.023263678e-03f, -1.277863107e-02f, 2.194668345e-02f,
+    -3.687160943e-02f, 6.400001827e-02f, -1.319716071e-01f, 9.530575435e-01f, 1.895176463e-01f, -7.911510796e-02f,
+    4.407729972e-02f, -2.615723849e-02f, 1.541137062e-02f, -8.669151612e-03f, 4.497898185e-03f, -2.056376084e-03f,
+    7.595251008e-04f, -1.728829860e-04f, -5.033522570e-04f, 1.525433224e-03f, -3.538653724e-03f, 7.074938510e-03f,
+    -1.287415280e-02f, 2.211215356e-02f, -3.714963250e-02f, 6.447490477e-02f, -1.328824718e-01f, 9.521961034e-01f,
+    1.914781368e-01f, -7.985938580e-02f, 4.448322511e-02f, -2.639735089e-02f, 1.555354260e-02f, -8.749987509e-03f,
+    4.540550205e-03f, -2.076390256e-03f, 7.672643878e-04f, -1.748750006e-04f, -5.064629519e-04f, 1.535779079e-03f,
+    -3.563710542e-03f, 7.126331366e-03f, -1.296918457e-02f, 2.227680507e-02f, -3.742628528e-02f, 6.494731787e-02f,
+    -1.337874397e-01f, 9.513271937e-01f, 1.934416334e-01f, -8.060323998e-02f, 4.488873396e-02f, -2.663719771e-02f,
+    1.569556946e-02f, -8.830756884e-03f, 4.583180465e-03f, -2.096403856e-03f, 7.750099050e-04f, -1.768728029e-04f,
+    -5.095456647e-04f, 1.546053188e-03f, -3.588616310e-03f, 7.177441481e-03f, -1.306372485e-02f, 2.244063519e-02f,
+    -3.770156319e-02f, 6.541725091e-02f, -1.346865086e-01f, 9.504508275e-01f, 1.954081130e-01f, -8.134665214e-02f,
+    4.529381566e-02f, -2.687677258e-02f, 1.583744739e-02f, -8.911457545e-03f, 4.625787799e-03f, -2.116416338e-03f,
+    7.827614428e-04f, -1.788763428e-04f, -5.126004057e-04f, 1.556255470e-03f, -3.613370718e-03f, 7.228268097e-03f,
+    -1.315777209e-02f, 2.260364119e-02f, -3.797546173e-02f, 6.588469727e-02f, -1.355796765e-01f, 9.495670180e-01f,
+    1.973775524e-01f, -8.208960391e-02f, 4.569845962e-02f, -2.711606911e-02f, 1.597917257e-02f, -8.992087298e-03f,
+    4.668371042e-03f, -2.136427152e-03f, 7.905187908e-04f, -1.808855697e-04f, -5.156271863e-04f, 1.566385847e-03f,
+    -3.637973464e-03f, 7.278810467e-03f, -1.325132480e-02f, 2.276582034e-02f, -3.824797640e-02f, 6.634965043e-02f,
+    -1.364669412e-01f, 9.486757784e-01f, 1.993499284e-01f, -8.283207690e-02f, 4.610265521e-02f, -2.735508091e-02f,
+    1.612074116e-02f, -9.072643946e-03f, 4.710929025e-03f, -2.156435747e-03f, 7.982817376e-04f, -1.829004327e-04f,
+    -5.186260189e-04f, 1.576444242e-03f, -3.662424249e-03f, 7.329067850e-03f, -1.334438146e-02f, 2.292716994e-02f,
+    -3.851910277e-02f, 6.681210392e-02f, -1.373483009e-01f, 9.477771221e-01f, 2.013252176e-01f, -8.357405269e-02f,
+    4.650639182e-02f, -2.759380157e-02f, 1.626214933e-02f, -9.153125291e-03f, 4.753460579e-03f, -2.176441572e-03f,
+    8.060500710e-04f, -1.849208804e-04f, -5.215969166e-04f, 1.586430581e-03f, -3.686722777e-03f, 7.379039516e-03f,
+    -1.343694059e-02f, 2.308768732e-02f, -3.878883644e-02f, 6.727205134e-02f, -1.382237538e-01f, 9.468710625e-01f,
+    2.033033967e-01f, -8.431551281e-02f, 4.690965881e-02f, -2.783222472e-02f, 1.640339326e-02f, -9.233529131e-03f,
+    4.795964532e-03f, -2.196444075e-03f, 8.138235781e-04f, -1.869468609e-04f, -5.245398933e-04f, 1.596344794e-03f,
+    -3.710868759e-03f, 7.428724743e-03f, -1.352900073e-02f, 2.324736983e-02f, -3.905717304e-02f, 6.772948637e-02f,
+    -1.390932982e-01f, 9.459576133e-01f, 2.052844421e-01f, -8.505643881e-02f, 4.731244557e-02f, -2.807034394e-02f,
+    1.654446911e-02f, -9.313853264e-03f, 4.838439710e-03f, -2.216442700e-03f, 8.216020448e-04f, -1.889783220e-04f,
+    -5.274549639e-04f, 1.606186810e-03f, -3.734861912e-03f, 7.478122820e-03f, -1.362056042e-02f, 2.340621485e-02f,
+    -3.932410826e-02f, 6.818440275e-02f, -1.399569324e-01f, 9.450367882e-01f, 2.072683304e-01f, -8.579681217e-02f,
+    4.771474145e-02f, -2.830815283e-02f, 1.668537305e-02f, -9.394095485e-03f, 4.880884940e-03f, -2.236436892e-03f,
+    8.293852565e-04f, -1.910152109e-04f, -5.303421442e-04f, 1.615956562e-03f, -3.758701954e-03f, 7.527233041e-03f,
+    -1.371161823e-02f, 2.356421978e-02f, -3.958963782e-02f, 6.863679429e-02f, -1.408146550e-01f, 9.441086010e-01f,
+    2.092550380e-01f, -8.653661437e-02f, 4.811653581e-02f, -2.854564499e-02f, 1.682610122e-02f, -9.474253586e-03f,
+    4.923299042e-03f, -2.256426094e-03f, 8.371729977e-04f, -1.930574744e-04f, -5.332014506e-04f, 1.625653986e-03f,
+    -3.782388612e-03f, 7.576054713e-03f, -1.380217272e-02f, 2.372138205e-02f, -3.985375749e-02f, 6.908665489e-02f,
+    -1.416664646e-01f, 9.431730655e-01f, 2.112445411e-01f, -8.727582688e-02f, 4.851781799e-02f, -2.878281401e-02f,
+    1.696664981e-02f, -9.554325359e-03f, 4.965680840e-03f, -2.276409748e-03f, 8.449650520e-04f, -1.951050591e-04f,
+    -5.360329006e-04f, 1.635279019e-03f, -3.805921613e-03f, 7.624587148e-03f, -1.389222250e-02f, 2.387769911e-02f,
+    -4.011646307e-02f, 6.953397848e-02f, -1.425123599e-01f, 9.422301959e-01f, 2.132368160e-01f, -8.801443111e-02f,
+    4.891857735e-02f, -2.901965348e-02f, 1.710701495e-02f, -9.634308593e-03f, 5.008029154e-03f, -2.296387294e-03f,
+    8.527612021e-04f, -1.971579108e-04f, -5.388365124e-04f, 1.644831600e-03f, -3.829300694e-03f, 7.672829671e-03f,
+    -1.398176616e-02f, 2.403316844e-02f, -4.037775041e-02f, 6.997875909e-02f, -1.433523396e-01f, 9.412800063e-01f,
+    2.152318390e-01f, -8.875240848e-02f, 4.931880322e-02f, -2.925615699e-02f, 1.724719281e-02f, -9.714201076e-03f,
+    5.050342800e-03f, -2.316358171e-03f, 8.605612301e-04f, -1.992159752e-04f, -5.416123052e-04f, 1.654311672e-03f,
+    -3.852525592e-03f, 7.720781611e-03f, -1.407080234e-02f, 2.418778754e-02f, -4.063761539e-02f, 7.042099081e-02f,
+    -1.441864028e-01f, 9.403225108e-01f, 2.172295861e-01f, -8.948974037e-02f, 4.971848495e-02f, -2.949231812e-02f,
+    1.738717955e-02f, -9.794000593e-03f, 5.092620596e-03f, -2.336321818e-03f, 8.683649170e-04f, -2.012791973e-04f,
+    -5.443602989e-04f, 1.663719179e-03f, -3.875596052e-03f, 7.768442310e-03f, -1.415932967e-02f, 2.434155394e-02f,
+    -4.089605395e-02f, 7.086066780e-02f, -1.450145484e-01f, 9.393577240e-01f, 2.192300334e-01f, -9.022640814e-02f,
+    5.011761186e-02f, -2.972813047e-02f, 1.752697131e-02f, -9.873704929e-03f, 5.134861358e-03f, -2.356277671e-03f,
+    8.761720433e-04f, -2.033475219e-04f, -5.470805142e-04f, 1.673054066e-03f, -3.898511822e-03f, 7.815811118e-03f,
+    -1.424734680e-02f, 2.449446520e-02f, -4.115306205e-02f, 7.129778430e-02f, -1.458367756e-01f, 9.383856601e-01f,
+    2.212331569e-01f, -9.096239313e-02f, 5.051617328e-02f, -2.996358761e-02f, 1.766656424e-02f, -9.953311866e-03f,
+    5.177063897e-03f, -2.376225166e-03f, 8.839823884e-04f, -2.054208931e-04f, -5.497729728e-04f, 1.682316283e-03f,
+    -3.921272656e-03f, 7.862887393e-03f, -1.433485241e-02f, 2.464651889e-02f, -4.140863571e-02f, 7.173233459e-02f,
+    -1.466530836e-01f, 9.374063338e-01f, 2.232389325e-01f, -9.169767666e-02f, 5.091415854e-02f, -3.019868313e-02f,
+    1.780595451e-02f, -1.003281918e-02f, 5.219227028e-03f, -2.396163736e-03f, 8.917957311e-04f, -2.074992548e-04f,
+    -5.524376971e-04f, 1.691505781e-03f, -3.943878312e-03f, 7.909670501e-03f, -1.442184517e-02f, 2.479771262e-02f,
+    -4.166277098e-02f, 7.216431305e-02f, -1.474634717e-01f, 9.364197598e-01f, 2.252473361e-01f, -9.243224003e-02f,
+    5.131155696e-02f, -3.043341061e-02f, 1.794513824e-02f, -1.011222466e-02f, 5.261349559e-03f, -2.416092816e-03f,
+    8.996118493e-04f, -2.095825504e-04f, -5.550747103e-04f, 1.700622512e-03f, -3.966328552e-03f, 7.956159819e-03f,
+    -1.450832379e-02f, 2.494804402e-02f, -4.191546395e-02f, 7.259371411e-02f, -1.482679394e-01f, 9.354259529e-01f,
+    2.272583435e-01f, -9.316606450e-02f, 5.170835785e-02f, -3.066776362e-02f, 1.808411160e-02f, -1.019152608e-02f,
+    5.303430300e-03f, -2.436011837e-03f, 9.074305201e-04f, -2.116707229e-04f, -5.576840365e-04f, 1.709666432e-03f,
+    -3.988623145e-03f, 8.002354732e-03f, -1.459428698e-02f, 2.509751074e-02f, -4.216671076e-02f, 7.302053229e-02f,
+    -1.490664862e-01f, 9.344249279e-01f, 2.292719305e-01f, -9.389913134e-02f, 5.210455052e-02f, -3.090173575e-02f,
+    1.822287073e-02f, -1.027072122e-02f, 5.345468059e-03f, -2.455920230e-03f, 9.152515198e-04f, -2.137637147e-04f,
+    -5.602657007e-04f, 1.718637498e-03f, -4.010761863e-03f, 8.048254634e-03f, -1.467973347e-02f, 2.524611047e-02f,
+    -4.241650759e-02f, 7.344476215e-02f, -1.498591117e-01f, 9.334166998e-01f, 2.312880726e-01f, -9.463142179e-02f,
+    5.250012430e-02f, -3.113532058e-02f, 1.836141177e-02f, -1.034980784e-02f, 5.387461642e-03f, -2.475817425e-03f,
+    9.230746241e-04f, -2.158614680e-04f, -5.628197285e-04f, 1.727535670e-03f, -4.032744482e-03f, 8.093858928e-03f,
+    -1.476466201e-02f, 2.539384090e-02f, -4.266485065e-02f, 7.386639836e-02f, -1.506458157e-01f, 9.324012837e-01f,
+    2.333067455e-01f, -9.536291704e-02f, 5.289506848e-02f, -3.136851168e-02f, 1.849973087e-02f, -1.042878373e-02f,
+    5.429409854e-03f, -2.495702849e-03f, 9.308996076e-04f, -2.179639244e-04f, -5.653461465e-04f, 1.736360909e-03f,
+    -4.054570784e-03f, 8.139167025e-03f, -1.484907136e-02f, 2.554069978e-02f, -4.291173621e-02f, 7.428543561e-02f,
+    -1.514265981e-01f, 9.313786948e-01f, 2.353279247e-01f, -9.609359831e-02f, 5.328937238e-02f, -3.160130263e-02f,
+    1.863782417e-02f, -1.050764665e-02f, 5.471311498e-03f, -2.515575931e-03f, 9.387262445e-04f, -2.200710253e-04f,
+    -5.678449820e-04f, 1.745113180e-03f, -4.076240557e-03f, 8.184178345e-03f, -1.493296029e-02f, 2.568668486e-02f,
+    -4.315716057e-02f, 7.470186871e-02f, -1.522014587e-01f, 9.303489485e-01f, 2.373515857e-01f, -9.682344677e-02f,
+    5.368302529e-02f, -3.183368701e-02f, 1.877568781e-02f, -1.058639439e-02f, 5.513165377e-03f, -2.535436097e-03f,
+    9.465543078e-04f, -2.221827113e-04f, -5.703162631e-04f, 1.753792449e-03f, -4.097753590e-03f, 8.228892318e-03f,
+    -1.501632760e-02f, 2.583179392e-02f, -4.340112006e-02f, 7.511569250e-02f, -1.529703977e-01f, 9.293120601e-01f,
+    2.393777040e-01f, -9.755244357e-02f, 5.407601652e-02f, -3.206565839e-02f, 1.891331795e-02f, -1.066502470e-02f,
+    5.554970292e-03f, -2.555282771e-03f, 9.543835700e-04f, -2.242989229e-04f, -5.727600188e-04f, 1.762398685e-03f,
+    -4.119109681e-03f, 8.273308383e-03f, -1.509917209e-02f, 2.597602476e-02f, -4.364361108e-02f, 7.552690191e-02f,
+    -1.537334152e-01f, 9.282680451e-01f, 2.414062548e-01f, -9.828056985e-02f, 5.446833538e-02f, -3.229721035e-02f,
+    1.905071071e-02f, -1.074353536e-02f, 5.596725042e-03f, -2.575115379e-03f, 9.622138029e-04f, -2.264196001e-04f,
+    -5.751762788e-04f, 1.770931857e-03f, -4.140308629e-03f, 8.317425986e-03f, -1.518149259e-02f, 2.611937523e-02f,
+    -4.388463006e-02f, 7.593549193e-02f, -1.544905114e-01f, 9.272169193e-01f, 2.434372135e-01f, -9.900780674e-02f,
+    5.485997115e-02f, -3.252833647e-02f, 1.918786223e-02f, -1.082192413e-02f, 5.638428426e-03f, -2.594933342e-03f,
+    9.700447773e-04f, -2.285446823e-04f, -5.775650737e-04f, 1.779391940e-03f, -4.161350240e-03f, 8.361244584e-03f,
+    -1.526328794e-02f, 2.626184318e-02f, -4.412417345e-02f, 7.634145764e-02f, -1.552416867e-01f, 9.261586982e-01f,
+    2.454705552e-01f, -9.973413533e-02f, 5.525091313e-02f, -3.275903033e-02f, 1.932476867e-02f, -1.090018879e-02f,
+    5.680079242e-03f, -2.614736083e-03f, 9.778762635e-04f, -2.306741088e-04f, -5.799264348e-04f, 1.787778907e-03f,
+    -4.182234324e-03f, 8.404763640e-03f, -1.534455698e-02f, 2.640342649e-02f, -4.436223777e-02f, 7.674479415e-02f,
+    -1.559869417e-01f, 9.250933978e-01f, 2.475062552e-01f, -1.004595367e-01f, 5.564115063e-02f, -3.298928551e-02f,
+    1.946142616e-02f, -1.097832709e-02f, 5.721676284e-03f, -2.634523023e-03f, 9.857080309e-04f, -2.328078182e-04f,
+    -5.822603942e-04f, 1.796092736e-03f, -4.202960696e-03f, 8.447982630e-03f, -1.542529859e-02f, 2.654412308e-02f,
+    -4.459881957e-02f, 7.714549668e-02f, -1.567262767e-01f, 9.240210339e-01f, 2.495442886e-01f, -1.011839919e-01f,
+    5.603067294e-02f, -3.321909557e-02f, 1.959783085e-02f, -1.105633681e-02f, 5.763218350e-03f, -2.654293582e-03f,
+    9.935398481e-04f, -2.349457488e-04f, -5.845669847e-04f, 1.804333406e-03f, -4.223529175e-03f, 8.490901036e-03f,
+    -1.550551165e-02f, 2.668393088e-02f, -4.483391545e-02f, 7.754356049e-02f, -1.574596926e-01f, 9.229416227e-01f,
+    2.515846303e-01f, -1.019074821e-01f, 5.641946935e-02f, -3.344845411e-02f, 1.973397886e-02f, -1.113421571e-02f,
+    5.804704232e-03f, -2.674047178e-03f, 1.001371483e-03f, -2.370878384e-04f, -5.868462401e-04f, 1.812500900e-03f,
+    -4.243939585e-03f, 8.533518348e-03f, -1.558519506e-02f, 2.682284785e-02f, -4.506752204e-02f, 7.793898094e-02f,
+    -1.581871900e-01f, 9.218551802e-01f, 2.536272555e-01f, -1.026299882e-01f, 5.680752916e-02f, -3.367735471e-02f,
+    1.986986635e-02f, -1.121196155e-02f, 5.846132723e-03f, -2.693783230e-03f, 1.009202703e-03f, -2.392340244e-04f,
+    -5.890981948e-04f, 1.820595199e-03f, -4.264191755e-03f, 8.575834069e-03f, -1.566434774e-02f, 2.696087197e-02f,
+    -4.529963601e-02f, 7.833175342e-02f, -1.589087698e-01f, 9.207617227e-01f, 2.556721389e-01f, -1.033514912e-01f,
+    5.719484167e-02f, -3.390579094e-02f, 2.000548945e-02f, -1.128957210e-02f, 5.887502615e-03f, -2.713501154e-03f,
+    1.017033275e-03f, -2.413842439e-04f, -5.913228840e-04f, 1.828616290e-03f, -4.284285518e-03f, 8.617847705e-03f,
+    -1.574296862e-02f, 2.709800127e-02f, -4.553025409e-02f, 7.872187343e-02f, -1.596244331e-01f, 9.196612664e-01f,
+    2.577192555e-01f, -1.040719723e-01f, 5.758139617e-02f, -3.413375639e-02f, 2.014084431e-02f, -1.136704512e-02f,
+    5.928812700e-03f, -2.733200366e-03f, 1.024862964e-03f, -2.435384334e-04f, -5.935203437e-04f, 1.836564162e-03f,
+    -4.304220712e-03f, 8.659558777e-03f, -1.582105663e-02f, 2.723423378e-02f, -4.575937302e-02f, 7.910933652e-02f,
+    -1.603341809e-01f, 9.185538280e-01f, 2.597685801e-01f, -1.047914123e-01f, 5.796718196e-02f, -3.436124464e-02f,
+    2.027592707e-02f, -1.144437836e-02f, 5.970061767e-03f, -2.752880282e-03f, 1.032691535e-03f, -2.456965292e-04f,
+    -5.956906107e-04f, 1.844438803e-03f, -4.323997180e-03f, 8.700966809e-03f, -1.589861076e-02f, 2.736956755e-02f,
+    -4.598698963e-02f, 7.949413829e-02f, -1.610380143e-01f, 9.174394239e-01f, 2.618200874e-01f, -1.055097922e-01f,
+    5.835218834e-02f, -3.458824929e-02f, 2.041073386e-02f, -1.152156960e-02f, 6.011248605e-03f, -2.772540314e-03f,
+    1.040518753e-03f, -2.478584669e-04f, -5.978337224e-04f, 1.852240207e-03f, -4.343614770e-03f, 8.742071339e-03f,
+    -1.597562996e-02f, 2.750400069e-02f, -4.621310074e-02f, 7.987627445e-02f, -1.617359346e-01f, 9.163180707e-01f,
+    2.638737521e-01f, -1.062270930e-01f, 5.873640460e-02f, -3.481476392e-02f, 2.054526083e-02f, -1.159861659e-02f,
+    6.052372001e-03f, -2.792179877e-03f, 1.048344381e-03f, -2.500241819e-04f, -5.999497172e-04f, 1.859968367e-03f,
+    -4.363073333e-03f, 8.782871911e-03f, -1.605211324e-02f, 2.763753130e-02f, -4.643770325e-02f, 8.025574075e-02f,
+    -1.624279433e-01f, 9.151897852e-01f, 2.659295489e-01f, -1.069432956e-01f, 5.911982005e-02f, -3.504078211e-02f,
+    2.067950413e-02f, -1.167551709e-02f, 6.093430745e-03f, -2.811798383e-03f, 1.056168182e-03f, -2.521936091e-04f,
+    -6.020386341e-04f, 1.867623280e-03f, -4.382372726e-03f, 8.823368078e-03f, -1.612805959e-02f, 2.777015752e-02f,
+    -4.666079408e-02f, 8.063253303e-02f, -1.631140417e-01f, 9.140545843e-01f, 2.679874523e-01f, -1.076583810e-01f,
+    5.950242399e-02f, -3.526629747e-02f, 2.081345990e-02f, -1.175226887e-02f, 6.134423620e-03f, -2.831395241e-03f,
+    1.063989919e-03f, -2.543666831e-04f, -6.041005128e-04f, 1.875204944e-03f, -4.401512811e-03f, 8.863559403e-03f,
+    -1.620346806e-02f, 2.790187753e-02f, -4.688237020e-02f, 8.100664717e-02f, -1.637942315e-01f, 9.129124850e-01f,
+    2.700474368e-01f, -1.083723300e-01f, 5.988420571e-02f, -3.549130358e-02f, 2.094712428e-02f, -1.182886968e-02f,
+    6.175349414e-03f, -2.850969864e-03f, 1.071809353e-03f, -2.565433379e-04f, -6.061353939e-04f, 1.882713360e-03f,
+    -4.420493452e-03f, 8.903445455e-03f, -1.627833766e-02f, 2.803268950e-02f, -4.710242862e-02f, 8.137807915e-02f,
+    -1.644685143e-01f, 9.117635041e-01f, 2.721094770e-01f, -1.090851237e-01f, 6.026515454e-02f, -3.571579405e-02f,
+    2.108049342e-02f, -1.190531728e-02f, 6.216206910e-03f, -2.870521661e-03f, 1.079626244e-03f, -2.587235072e-04f,
+    -6.081433186e-04f, 1.890148531e-03f, -4.439314522e-03f, 8.943025816e-03f, -1.635266746e-02f, 2.816259167e-02f,
+    -4.732096639e-02f, 8.174682500e-02f, -1.651368920e-01f, 9.106076590e-01f, 2.741735471e-01f, -1.097967428e-01f,
+    6.064525977e-02f, -3.593976247e-02f, 2.121356346e-02f, -1.198160944e-02f, 6.256994893e-03f, -2.890050040e-03f,
+    1.087440354e-03f, -2.609071242e-04f, -6.101243290e-04f, 1.897510462e-03f, -4.457975894e-03f, 8.982300074e-03f,
+    -1.642645653e-02f, 2.829158226e-02f, -4.753798062e-02f, 8.211288083e-02f, -1.657993663e-01f, 9.094449668e-01f,
+    2.762396216e-01f, -1.105071683e-01f, 6.102451072e-02f, -3.616320245e-02f, 2.134633056e-02f, -1.205774391e-02f,
+    6.297712146e-03f, -2.909554408e-03f, 1.095251441e-03f, -2.630941219e-04f, -6.120784677e-04f, 1.904799159e-03f,
+    -4.476477449e-03f, 9.021267827e-03f, -1.649970395e-02f, 2.841965956e-02f, -4.775346842e-02f, 8.247624282e-02f,
+    -1.664559394e-01f, 9.082754449e-01f, 2.783076747e-01f, -1.112163810e-01f, 6.140289670e-02f, -3.638610760e-02f,
+    2.147879086e-02f, -1.213371845e-02f, 6.338357451e-03f, -2.929034174e-03f, 1.103059265e-03f, -2.652844326e-04f,
+    -6.140057783e-04f, 1.912014631e-03f, -4.494819071e-03f, 9.059928680e-03f, -1.657240882e-02f, 2.854682185e-02f,
+    -4.796742699e-02f, 8.283690721e-02f, -1.671066131e-01f, 9.070991108e-01f, 2.803776807e-01f, -1.119243618e-01f,
+    6.178040703e-02f, -3.660847151e-02f, 2.161094051e-02f, -1.220953083e-02f, 6.378929591e-03f, -2.948488743e-03f,
+    1.110863582e-03f, -2.674779885e-04f, -6.159063049e-04f, 1.919156890e-03f, -4.513000648e-03f, 9.098282248e-03f,
+    -1.664457026e-02f, 2.867306745e-02f, -4.817985355e-02f, 8.319487031e-02f, -1.677513898e-01f, 9.059159820e-01f,
+    2.824496138e-01f, -1.126310914e-01f, 6.215703102e-02f, -3.683028781e-02f, 2.174277567e-02f, -1.228517879e-02f,
+    6.419427346e-03f, -2.967917520e-03f, 1.118664153e-03f, -2.696747211e-04f, -6.177800925e-04f, 1.926225949e-03f,
+    -4.531022076e-03f, 9.136328156e-03f, -1.671618739e-02f, 2.879839471e-02f, -4.839074534e-02f, 8.355012850e-02f,
+    -1.683902718e-01f, 9.047260761e-01f, 2.845234481e-01f, -1.133365509e-01f, 6.253275801e-02f, -3.705155011e-02f,
+    2.187429249e-02f, -1.236066010e-02f, 6.459849498e-03f, -2.987319910e-03f, 1.126460731e-03f, -2.718745617e-04f,
+    -6.196271867e-04f, 1.933221823e-03f, -4.548883250e-03f, 9.174066036e-03f, -1.678725937e-02f, 2.892280200e-02f,
+    -4.860009969e-02f, 8.390267825e-02f, -1.690232613e-01f, 9.035294108e-01f, 2.865991577e-01f, -1.140407209e-01f,
+    6.290757732e-02f, -3.727225202e-02f, 2.200548713e-02f, -1.243597253e-02f, 6.500194825e-03f, -3.006695318e-03f,
+    1.134253075e-03f, -2.740774410e-04f, -6.214476338e-04f, 1.940144529e-03f, -4.566584075e-03f, 9.211495530e-03f,
+    -1.685778536e-02f, 2.904628771e-02f, -4.880791393e-02f, 8.425251607e-02f, -1.696503608e-01f, 9.023260041e-01f,
+    2.886767165e-01f, -1.147435823e-01f, 6.328147828e-02f, -3.749238718e-02f, 2.213635573e-02f, -1.251111383e-02f,
+    6.540462109e-03f, -3.026043145e-03f, 1.142040940e-03f, -2.762832896e-04f, -6.232414809e-04f, 1.946994086e-03f,
+    -4.584124457e-03f, 9.248616288e-03f, -1.692776453e-02f, 2.916885027e-02f, -4.901418545e-02f, 8.459963854e-02f,
+    -1.702715731e-01f, 9.011158739e-01f, 2.907560987e-01f, -1.154451159e-01f, 6.365445024e-02f, -3.771194921e-02f,
+    2.226689447e-02f, -1.258608175e-02f, 6.580650128e-03f, -3.045362794e-03f, 1.149824080e-03f, -2.784920374e-04f,
+    -6.250087758e-04f, 1.953770517e-03f, -4.601504308e-03f, 9.285427967e-03f, -1.699719608e-02f, 2.929048813e-02f,
+    -4.921891168e-02f, 8.494404234e-02f, -1.708869006e-01f, 8.998990381e-01f, 2.928372780e-01f, -1.161453024e-01f,
+    6.402648252e-02f, -3.793093173e-02f, 2.239709950e-02f, -1.266087407e-02f, 6.620757660e-03f, -3.064653667e-03f,
+    1.157602250e-03f, -2.807036140e-04f, -6.267495670e-04f, 1.960473844e-03f, -4.618723544e-03f, 9.321930238e-03f,
+    -1.706607921e-02f, 2.941119975e-02f, -4.942209009e-02f, 8.528572419e-02f, -1.714963462e-01f, 8.986755149e-01f,
+    2.949202284e-01f, -1.168441228e-01f, 6.439756448e-02f, -3.814932839e-02f, 2.252696698e-02f, -1.273548855e-02f,
+    6.660783483e-03f, -3.083915166e-03f, 1.165375203e-03f, -2.829179486e-04f, -6.284639036e-04f, 1.967104093e-03f,
+    -4.635782087e-03f, 9.358122774e-03f, -1.713441315e-02f, 2.953098365e-02f, -4.962371820e-02f, 8.562468088e-02f,
+    -1.720999128e-01f, 8.974453225e-01f, 2.970049237e-01f, -1.175415576e-01f, 6.476768548e-02f, -3.836713283e-02f,
+    2.265649308e-02f, -1.280992293e-02f, 6.700726376e-03f, -3.103146689e-03f, 1.173142694e-03f, -2.851349701e-04f,
+    -6.301518355e-04f, 1.973661292e-03f, -4.652679861e-03f, 9.394005263e-03f, -1.720219714e-02f, 2.964983833e-02f,
+    -4.982379355e-02f, 8.596090929e-02f, -1.726976034e-01f, 8.962084793e-01f, 2.990913376e-01f, -1.182375878e-01f,
+    6.513683486e-02f, -3.858433869e-02f, 2.278567397e-02f, -1.288417500e-02f, 6.740585116e-03f, -3.122347636e-03f,
+    1.180904473e-03f, -2.873546069e-04f, -6.318134133e-04f, 1.980145469e-03f, -4.669416797e-03f, 9.429577397e-03f,
+    -1.726943043e-02f, 2.976776237e-02f, -5.002231376e-02f, 8.629440635e-02f, -1.732894209e-01f, 8.949650037e-01f,
+    3.011794438e-01f, -1.189321941e-01f, 6.550500199e-02f, -3.880093961e-02f, 2.291450582e-02f, -1.295824250e-02f,
+    6.780358479e-03f, -3.141517407e-03f, 1.188660293e-03f, -2.895767870e-04f, -6.334486883e-04f, 1.986556658e-03f,
+    -4.685992829e-03f, 9.464838879e-03f, -1.733611229e-02f, 2.988475431e-02f, -5.021927644e-02f, 8.662516906e-02f,
+    -1.738753687e-01f, 8.937149142e-01f, 3.032692161e-01f, -1.196253571e-01f, 6.587217624e-02f, -3.901692926e-02f,
+    2.304298479e-02f, -1.303212321e-02f, 6.820045243e-03f, -3.160655400e-03f, 1.196409905e-03f, -2.918014379e-04f,
+    -6.350577123e-04f, 1.992894890e-03f, -4.702407896e-03f, 9.499789420e-03f, -1.740224200e-02f, 3.000081279e-02f,
+    -5.041467929e-02f, 8.695319450e-02f, -1.744554499e-01f, 8.924582293e-01f, 3.053606280e-01f, -1.203170577e-01f,
+    6.623834698e-02f, -3.923230129e-02f, 2.317110707e-02f, -1.310581489e-02f, 6.859644184e-03f, -3.179761011e-03f,
+    1.204153059e-03f, -2.940284870e-04f, -6.366405380e-04f, 1.999160202e-03f, -4.718661941e-03f, 9.534428741e-03f,
+    -1.746781887e-02f, 3.011593640e-02f, -5.060852003e-02f, 8.727847981e-02f, -1.750296679e-01f, 8.911949678e-01f,
+    3.074536531e-01f, -1.210072767e-01f, 6.660350361e-02f, -3.944704936e-02f, 2.329886884e-02f, -1.317931529e-02f,
+    6.899154077e-03f, -3.198833639e-03f, 1.211889507e-03f, -2.962578611e-04f, -6.381972187e-04f, 2.005352631e-03f,
+    -4.734754912e-03f, 9.568756570e-03f, -1.753284222e-02f, 3.023012382e-02f, -5.080079642e-02f, 8.760102219e-02f,
+    -1.755980262e-01f, 8.899251485e-01f, 3.095482649e-01f, -1.216959946e-01f, 6.696763550e-02f, -3.966116715e-02f,
+    2.342626626e-02f, -1.325262220e-02f, 6.938573699e-03f, -3.217872679e-03f, 1.219618997e-03f, -2.984894865e-04f,
+    -6.397278083e-04f, 2.011472217e-03f, -4.750686762e-03f, 9.602772645e-03f, -1.759731136e-02f, 3.034337372e-02f,
+    -5.099150626e-02f, 8.792081894e-02f, -1.761605283e-01f, 8.886487903e-01f, 3.116444368e-01f, -1.223831923e-01f,
+    6.733073205e-02f, -3.987464833e-02f, 2.355329553e-02f, -1.332573337e-02f, 6.977901827e-03f, -3.236877528e-03f,
+    1.227341278e-03f, -3.007232895e-04f, -6.412323615e-04f, 2.017519002e-03f, -4.766457448e-03f, 9.636476710e-03f,
+    -1.766122566e-02f, 3.045568481e-02f, -5.118064741e-02f, 8.823786740e-02f, -1.767171779e-01f, 8.873659121e-01f,
+    3.137421424e-01f, -1.230688505e-01f, 6.769278266e-02f, -4.008748659e-02f, 2.367995283e-02f, -1.339864658e-02f,
+    7.017137234e-03f, -3.255847580e-03f, 1.235056098e-03f, -3.029591955e-04f, -6.427109336e-04f, 2.023493029e-03f,
+    -4.782066930e-03f, 9.669868522e-03f, -1.772458446e-02f, 3.056705580e-02f, -5.136821775e-02f, 8.855216498e-02f,
+    -1.772679788e-01f, 8.860765331e-01f, 3.158413549e-01f, -1.237529499e-01f, 6.805377676e-02f, -4.029967560e-02f,
+    2.380623435e-02f, -1.347135959e-02f, 7.056278697e-03f, -3.274782231e-03f, 1.242763206e-03f, -3.051971300e-04f,
+    -6.441635805e-04f, 2.029394343e-03f, -4.797515175e-03f, 9.702947843e-03f, -1.778738715e-02f, 3.067748547e-02f,
+    -5.155421521e-02f, 8.886370917e-02f, -1.778129348e-01f, 8.847806723e-01f, 3.179420477e-01f, -1.244354712e-01f,
+    6.841370374e-02f, -4.051120907e-02f, 2.393213628e-02f, -1.354387017e-02f, 7.095324992e-03f, -3.293680873e-03f,
+    1.250462348e-03f, -3.074370177e-04f, -6.455903588e-04f, 2.035222992e-03f, -4.812802153e-03f, 9.735714445e-03f,
+    -1.784963312e-02f, 3.078697258e-02f, -5.173863777e-02f, 8.917249752e-02f, -1.783520498e-01f, 8.834783491e-01f,
+    3.200441941e-01f, -1.251163951e-01f, 6.877255305e-02f, -4.072208069e-02f, 2.405765483e-02f, -1.361617609e-02f,
+    7.134274894e-03f, -3.312542902e-03f, 1.258153271e-03f, -3.096787833e-04f, -6.469913259e-04f, 2.040979026e-03f,
+    -4.827927838e-03f, 9.768168109e-03f, -1.791132178e-02f, 3.089551595e-02f, -5.192148344e-02f, 8.947852766e-02f,
+    -1.788853280e-01f, 8.821695828e-01f, 3.221477673e-01f, -1.257957023e-01f, 6.913031412e-02f, -4.093228417e-02f,
+    2.418278618e-02f, -1.368827513e-02f, 7.173127177e-03f, -3.331367710e-03f, 1.265835721e-03f, -3.119223508e-04f,
+    -6.483665396e-04f, 2.046662495e-03f, -4.842892210e-03f, 9.800308624e-03f, -1.797245255e-02f, 3.100311441e-02f,
+    -5.210275028e-02f, 8.978179728e-02f, -1.794127734e-01f, 8.808543928e-01f, 3.242527404e-01f, -1.264733735e-01f,
+    6.948697638e-02f, -4.114181322e-02f, 2.430752654e-02f, -1.376016505e-02f, 7.211880618e-03f, -3.350154689e-03f,
+    1.273509444e-03f, -3.141676439e-04f, -6.497160585e-04f, 2.052273454e-03f, -4.857695252e-03f, 9.832135787e-03f,
+    -1.803302486e-02f, 3.110976682e-02f, -5.228243639e-02f, 9.008230413e-02f, -1.799343902e-01f, 8.795327987e-01f,
+    3.263590867e-01f, -1.271493894e-01f, 6.984252930e-02f, -4.135066156e-02f, 2.443187212e-02f, -1.383184364e-02f,
+    7.250533992e-03f, -3.368903232e-03f, 1.281174184e-03f, -3.164145861e-04f, -6.510399418e-04f, 2.057811957e-03f,
+    -4.872336951e-03f, 9.863649406e-03f, -1.809303818e-02f, 3.121547205e-02f, -5.246053990e-02f, 9.038004604e-02f,
+    -1.804501830e-01f, 8.782048201e-01f, 3.284667792e-01f, -1.278237306e-01f, 7.019696233e-02f, -4.155882292e-02f,
+    2.455581912e-02f, -1.390330867e-02f, 7.289086074e-03f, -3.387612731e-03f, 1.288829687e-03f, -3.186631002e-04f,
+    -6.523382493e-04f, 2.063278062e-03f, -4.886817301e-03f, 9.894849295e-03f, -1.815249197e-02f, 3.132022902e-02f,
+    -5.263705899e-02f, 9.067502091e-02f, -1.809601559e-01f, 8.768704767e-01f, 3.305757910e-01f, -1.284963780e-01f,
+    7.055026495e-02f, -4.176629102e-02f, 2.467936377e-02f, -1.397455791e-02f, 7.327535640e-03f, -3.406282576e-03f,
+    1.296475696e-03f, -3.209131090e-04f, -6.536110415e-04f, 2.068671827e-03f, -4.901136299e-03f, 9.925735278e-03f,
+    -1.821138570e-02f, 3.142403667e-02f, -5.281199189e-02f, 9.096722669e-02f, -1.814643137e-01f, 8.755297884e-01f,
+    3.326860950e-01f, -1.291673121e-01f, 7.090242664e-02f, -4.197305962e-02f, 2.480250227e-02f, -1.404558915e-02f,
+    7.365881466e-03f, -3.424912159e-03f, 1.304111955e-03f, -3.231645346e-04f, -6.548583795e-04f, 2.073993315e-03f,
+    -4.915293944e-03f, 9.956307187e-03f, -1.826971890e-02f, 3.152689394e-02f, -5.298533687e-02f, 9.125666143e-02f,
+    -1.819626608e-01f, 8.741827749e-01f, 3.347976643e-01f, -1.298365137e-01f, 7.125343688e-02f, -4.217912246e-02f,
+    2.492523085e-02f, -1.411640017e-02f, 7.404122328e-03f, -3.443500870e-03f, 1.311738206e-03f, -3.254172988e-04f,
+    -6.560803250e-04f, 2.079242587e-03f, -4.929290243e-03f, 9.986564862e-03f, -1.832749105e-02f, 3.162879983e-02f,
+    -5.315709222e-02f, 9.154332323e-02f, -1.824552021e-01f, 8.728294564e-01f, 3.369104717e-01f, -1.305039633e-01f,
+    7.160328519e-02f, -4.238447328e-02f, 2.504754574e-02f, -1.418698875e-02f, 7.442257002e-03f, -3.462048099e-03f,
+    1.319354192e-03f, -3.276713233e-04f, -6.572769403e-04f, 2.084419710e-03f, -4.943125205e-03f, 1.001650815e-02f,
+    -1.838470170e-02f, 3.172975335e-02f, -5.332725630e-02f, 9.182721023e-02f, -1.829419423e-01f, 8.714698529e-01f,
+    3.390244901e-01f, -1.311696418e-01f, 7.195196106e-02f, -4.258910587e-02f, 2.516944316e-02f, -1.425735267e-02f,
+    7.480284264e-03f, -3.480553236e-03f, 1.326959655e-03f, -3.299265290e-04f, -6.584482884e-04f, 2.089524749e-03f,
+    -4.956798844e-03f, 1.004613692e-02f, -1.844135039e-02f, 3.182975353e-02f, -5.349582750e-02f, 9.210832070e-02f,
+    -1.834228864e-01f, 8.701039845e-01f, 3.411396924e-01f, -1.318335298e-01f, 7.229945403e-02f, -4.279301399e-02f,
+    2.529091936e-02f, -1.432748971e-02f, 7.518202891e-03f, -3.499015670e-03f, 1.334554337e-03f, -3.321828367e-04f,
+    -6.595944328e-04f, 2.094557773e-03f, -4.970311180e-03f, 1.007545102e-02f, -1.849743668e-02f, 3.192879943e-02f,
+    -5.366280424e-02f, 9.238665291e-02f, -1.838980393e-01f, 8.687318715e-01f, 3.432560514e-01f, -1.324956080e-01f,
+    7.264575363e-02f, -4.299619141e-02f, 2.541197056e-02f, -1.439739768e-02f, 7.556011661e-03f, -3.517434789e-03f,
+    1.342137978e-03f, -3.344401669e-04f, -6.607154378e-04f, 2.099518853e-03f, -4.983662235e-03f, 1.010445034e-02f,
+    -1.855296015e-02f, 3.202689014e-02f, -5.382818501e-02f, 9.266220526e-02f, -1.843674062e-01f, 8.673535343e-01f,
+    3.453735397e-01f, -1.331558570e-01f, 7.299084939e-02f, -4.319863192e-02f, 2.553259301e-02f, -1.446707435e-02f,
+    7.593709350e-03f, -3.535809984e-03f, 1.349710319e-03f, -3.366984394e-04f, -6.618113680e-04f, 2.104408062e-03f,
+    -4.996852035e-03f, 1.013313475e-02f, -1.860792038e-02f, 3.212402478e-02f, -5.399196830e-02f, 9.293497616e-02f,
+    -1.848309922e-01f, 8.659689932e-01f, 3.474921302e-01f, -1.338142575e-01f, 7.333473089e-02f, -4.340032933e-02f,
+    2.565278296e-02f, -1.453651752e-02f, 7.631294736e-03f, -3.554140641e-03f, 1.357271100e-03f, -3.389575739e-04f,
+    -6.628822889e-04f, 2.109225473e-03f, -5.009880613e-03f, 1.016150416e-02f, -1.866231697e-02f, 3.222020248e-02f,
+    -5.415415268e-02f, 9.320496414e-02f, -1.852888026e-01f, 8.645782688e-01f, 3.496117955e-01f, -1.344707902e-01f,
+    7.367738768e-02f, -4.360127743e-02f, 2.577253666e-02f, -1.460572497e-02f, 7.668766598e-03f, -3.572426149e-03f,
+    1.364820061e-03f, -3.412174898e-04f, -6.639282664e-04f, 2.113971163e-03f, -5.022748004e-03f, 1.018955845e-02f,
+    -1.871614956e-02f, 3.231542240e-02f, -5.431473675e-02f, 9.347216776e-02f, -1.857408429e-01f, 8.631813816e-01f,
+    3.517325081e-01f, -1.351254359e-01f, 7.401880935e-02f, -4.380147004e-02f, 2.589185037e-02f, -1.467469452e-02f,
+    7.706123714e-03f, -3.590665895e-03f, 1.372356940e-03f, -3.434781059e-04f, -6.649493671e-04f, 2.118645210e-03f,
+    -5.035454248e-03f, 1.021729754e-02f, -1.876941777e-02f, 3.240968374e-02f, -5.447371913e-02f, 9.373658566e-02f,
+    -1.861871185e-01f, 8.617783525e-01f, 3.538542408e-01f, -1.357781751e-01f, 7.435898548e-02f, -4.400090099e-02f,
+    2.601072035e-02f, -1.474342394e-02f, 7.743364863e-03f, -3.608859268e-03f, 1.379881477e-03f, -3.457393408e-04f,
+    -6.659456581e-04f, 2.123247693e-03f, -5.047999390e-03f, 1.024472135e-02f, -1.882212126e-02f, 3.250298570e-02f,
+    -5.463109852e-02f, 9.399821656e-02f, -1.866276349e-01f, 8.603692021e-01f, 3.559769660e-01f, -1.364289886e-01f,
+    7.469790569e-02f, -4.419956409e-02f, 2.612914287e-02f, -1.481191105e-02f, 7.780488825e-03f, -3.627005654e-03f,
+    1.387393409e-03f, -3.480011127e-04f, -6.669172071e-04f, 2.127778695e-03f, -5.060383478e-03f, 1.027182980e-02f,
+    -1.887425968e-02f, 3.259532753e-02f, -5.478687362e-02f, 9.425705922e-02f, -1.870623978e-01f, 8.589539512e-01f,
+    3.581006563e-01f, -1.370778570e-01f, 7.503555959e-02f, -4.439745319e-02f, 2.624711420e-02f, -1.488015364e-02f,
+    7.817494379e-03f, -3.645104440e-03f, 1.394892475e-03f, -3.502633394e-04f, -6.678640825e-04f, 2.132238299e-03f,
+    -5.072606565e-03f, 1.029862282e-02f, -1.892583272e-02f, 3.268670848e-02f, -5.494104321e-02f, 9.451311249e-02f,
+    -1.874914130e-01f, 8.575326210e-01f, 3.602252841e-01f, -1.377247611e-01f, 7.537193681e-02f, -4.459456215e-02f,
+    2.636463062e-02f, -1.494814953e-02f, 7.854380308e-03f, -3.663155014e-03f, 1.402378411e-03f, -3.525259385e-04f,
+    -6.687863530e-04f, 2.136626591e-03f, -5.084668708e-03f, 1.032510035e-02f, -1.897684008e-02f, 3.277712786e-02f,
+    -5.509360609e-02f, 9.476637527e-02f, -1.879146864e-01f, 8.561052323e-01f, 3.623508219e-01f, -1.383696815e-01f,
+    7.570702700e-02f, -4.479088482e-02f, 2.648168841e-02f, -1.501589650e-02f, 7.891145392e-03f, -3.681156761e-03f,
+    1.409850955e-03f, -3.547888270e-04f, -6.696840883e-04f, 2.140943657e-03f, -5.096569969e-03f, 1.035126236e-02f,
+    -1.902728147e-02f, 3.286658497e-02f, -5.524456110e-02f, 9.501684655e-02f, -1.883322238e-01f, 8.546718063e-01f,
+    3.644772421e-01f, -1.390125990e-01f, 7.604081981e-02f, -4.498641507e-02f, 2.659828386e-02f, -1.508339239e-02f,
+    7.927788413e-03f, -3.699109069e-03f, 1.417309844e-03f, -3.570519217e-04f, -6.705573582e-04f, 2.145189587e-03f,
+    -5.108310412e-03f, 1.037710879e-02f, -1.907715660e-02f, 3.295507915e-02f, -5.539390712e-02f, 9.526452536e-02f,
+    -1.887440313e-01f, 8.532323642e-01f, 3.666045169e-01f, -1.396534942e-01f, 7.637330492e-02f, -4.518114678e-02f,
+    2.671441326e-02f, -1.515063499e-02f, 7.964308154e-03f, -3.717011323e-03f, 1.424754812e-03f, -3.593151392e-04f,
+    -6.714062333e-04f, 2.149364472e-03f, -5.119890108e-03f, 1.040263961e-02f, -1.912646523e-02f, 3.304260977e-02f,
+    -5.554164308e-02f, 9.550941082e-02f, -1.891501150e-01f, 8.517869273e-01f, 3.687326189e-01f, -1.402923479e-01f,
+    7.670447201e-02f, -4.537507384e-02f, 2.683007292e-02f, -1.521762212e-02f, 8.000703399e-03f, -3.734862910e-03f,
+    1.432185597e-03f, -3.615783954e-04f, -6.722307848e-04f, 2.153468403e-03f, -5.131309130e-03f, 1.042785480e-02f,
+    -1.917520710e-02f, 3.312917622e-02f, -5.568776795e-02f, 9.575150210e-02f, -1.895504812e-01f, 8.503355170e-01f,
+    3.708615202e-01f, -1.409291407e-01f, 7.703431078e-02f, -4.556819014e-02f, 2.694525914e-02f, -1.528435159e-02f,
+    8.036972931e-03f, -3.752663216e-03f, 1.439601933e-03f, -3.638416061e-04f, -6.730310843e-04f, 2.157501476e-03f,
+    -5.142567558e-03f, 1.045275434e-02f, -1.922338199e-02f, 3.321477792e-02f, -5.583228074e-02f, 9.599079845e-02f,
+    -1.899451361e-01f, 8.488781546e-01f, 3.729911930e-01f, -1.415638534e-01f, 7.736281096e-02f, -4.576048961e-02f,
+    2.705996822e-02f, -1.535082123e-02f, 8.073115536e-03f, -3.770411626e-03f, 1.447003556e-03f, -3.661046868e-04f,
+    -6.738072041e-04f, 2.161463787e-03f, -5.153665472e-03f, 1.047733823e-02f, -1.927098968e-02f, 3.329941430e-02f,
+    -5.597518050e-02f, 9.622729917e-02f, -1.903340862e-01f, 8.474148617e-01f, 3.751216097e-01f, -1.421964667e-01f,
+    7.768996226e-02f, -4.595196615e-02f, 2.717419650e-02f, -1.541702886e-02f, 8.109129999e-03f, -3.788107526e-03f,
+    1.454390199e-03f, -3.683675524e-04f, -6.745592169e-04f, 2.165355434e-03f, -5.164602960e-03f, 1.050160647e-02f,
+    -1.931802997e-02f, 3.338308483e-02f, -5.611646632e-02f, 9.646100364e-02f, -1.907173380e-01f, 8.459456600e-01f,
+    3.772527424e-01f, -1.428269613e-01f, 7.801575443e-02f, -4.614261371e-02f, 2.728794028e-02f, -1.548297231e-02f,
+    8.145015108e-03f, -3.805750303e-03f, 1.461761598e-03f, -3.706301178e-04f, -6.752871960e-04f, 2.169176516e-03f,
+    -5.175380111e-03f, 1.052555905e-02f, -1.936450268e-02f, 3.346578900e-02f, -5.625613733e-02f, 9.669191131e-02f,
+    -1.910948980e-01f, 8.444705712e-01f, 3.793845632e-01f, -1.434553180e-01f, 7.834017725e-02f, -4.633242621e-02f,
+    2.740119591e-02f, -1.554864939e-02f, 8.180769649e-03f, -3.823339341e-03f, 1.469117485e-03f, -3.728922972e-04f,
+    -6.759912153e-04f, 2.172927135e-03f, -5.185997022e-03f, 1.054919601e-02f, -1.941040763e-02f, 3.354752633e-02f,
+    -5.639419270e-02f, 9.692002168e-02f, -1.914667729e-01f, 8.429896169e-01f, 3.815170443e-01f, -1.440815175e-01f,
+    7.866322047e-02f, -4.652139762e-02f, 2.751395971e-02f, -1.561405794e-02f, 8.216392411e-03f, -3.840874027e-03f,
+    1.476457594e-03f, -3.751540048e-04f, -6.766713492e-04f, 2.176607394e-03f, -5.196453791e-03f, 1.057251737e-02f,
+    -1.945574467e-02f, 3.362829636e-02f, -5.653063164e-02f, 9.714533433e-02f, -1.918329695e-01f, 8.415028192e-01f,
+    3.836501577e-01f, -1.447055406e-01f, 7.898487390e-02f, -4.670952190e-02f, 2.762622803e-02f, -1.567919580e-02f,
+    8.251882185e-03f, -3.858353746e-03f, 1.483781660e-03f, -3.774151543e-04f, -6.773276725e-04f, 2.180217399e-03f,
+    -5.206750520e-03f, 1.059552315e-02f, -1.950051366e-02f, 3.370809865e-02f, -5.666545342e-02f, 9.736784889e-02f,
+    -1.921934946e-01f, 8.400101998e-01f, 3.857838755e-01f, -1.453273679e-01f, 7.930512734e-02f, -4.689679302e-02f,
+    2.773799721e-02f, -1.574406080e-02f, 8.287237759e-03f, -3.875777883e-03f, 1.491089413e-03f, -3.796756590e-04f,
+    -6.779602607e-04f, 2.183757255e-03f, -5.216887317e-03f, 1.061821341e-02f, -1.954471447e-02f, 3.378693280e-02f,
+    -5.679865732e-02f, 9.758756508e-02f, -1.925483552e-01f, 8.385117809e-01f, 3.879181698e-01f, -1.459469804e-01f,
+    7.962397062e-02f, -4.708320498e-02f, 2.784926362e-02f, -1.580865078e-02f, 8.322457927e-03f, -3.893145825e-03f,
+    1.498380587e-03f, -3.819354319e-04f, -6.785691897e-04f, 2.187227072e-03f, -5.226864293e-03f, 1.064058818e-02f,
+    -1.958834700e-02f, 3.386479842e-02f, -5.693024269e-02f, 9.780448266e-02f, -1.928975583e-01f, 8.370075846e-01f,
+    3.900530124e-01f, -1.465643587e-01f, 7.994139359e-02f, -4.726875177e-02f, 2.796002361e-02f, -1.587296359e-02f,
+    8.357541479e-03f, -3.910456957e-03f, 1.505654914e-03f, -3.841943859e-04f, -6.791545360e-04f, 2.190626959e-03f,
+    -5.236681564e-03f, 1.066264754e-02f, -1.963141113e-02f, 3.394169515e-02f, -5.706020889e-02f, 9.801860148e-02f,
+    -1.932411111e-01f, 8.354976329e-01f, 3.921883753e-01f, -1.471794836e-01f, 8.025738609e-02f, -4.745342740e-02f,
+    2.807027355e-02f, -1.593699706e-02f, 8.392487211e-03f, -3.927710664e-03f, 1.512912125e-03f, -3.864524334e-04f,
+    -6.797163766e-04f, 2.193957029e-03f, -5.246339248e-03f, 1.068439154e-02f, -1.967390680e-02f, 3.401762266e-02f,
+    -5.718855534e-02f, 9.822992144e-02f, -1.935790208e-01f, 8.339819482e-01f, 3.943242306e-01f, -1.477923359e-01f,
+    8.057193802e-02f, -4.763722589e-02f, 2.818000982e-02f, -1.600074906e-02f, 8.427293916e-03f, -3.944906333e-03f,
+    1.520151952e-03f, -3.887094863e-04f, -6.802547888e-04f, 2.197217395e-03f, -5.255837470e-03f, 1.070582026e-02f,
+    -1.971583394e-02f, 3.409258064e-02f, -5.731528151e-02f, 9.843844251e-02f, -1.939112946e-01f, 8.324605529e-01f,
+    3.964605500e-01f, -1.484028964e-01f, 8.088503925e-02f, -4.782014129e-02f, 2.828922880e-02f, -1.606421742e-02f,
+    8.461960392e-03f, -3.962043349e-03f, 1.527374127e-03f, -3.909654564e-04f, -6.807698508e-04f, 2.200408172e-03f,
+    -5.265176356e-03f, 1.072693378e-02f, -1.975719249e-02f, 3.416656879e-02f, -5.744038689e-02f, 9.864416473e-02f,
+    -1.942379400e-01f, 8.309334693e-01f, 3.985973054e-01f, -1.490111459e-01f, 8.119667972e-02f, -4.800216763e-02f,
+    2.839792688e-02f, -1.612740002e-02f, 8.496485434e-03f, -3.979121099e-03f, 1.534578379e-03f, -3.932202553e-04f,
+    -6.812616409e-04f, 2.203529478e-03f, -5.274356038e-03f, 1.074773220e-02f, -1.979798242e-02f, 3.423958687e-02f,
+    -5.756387102e-02f, 9.884708818e-02f, -1.945589645e-01f, 8.294007199e-01f, 4.007344687e-01f, -1.496170653e-01f,
+    8.150684934e-02f, -4.818329898e-02f, 2.850610046e-02f, -1.619029470e-02f, 8.530867842e-03f, -3.996138968e-03f,
+    1.541764440e-03f, -3.954737939e-04f, -6.817302381e-04f, 2.206581431e-03f, -5.283376652e-03f, 1.076821561e-02f,
+    -1.983820369e-02f, 3.431163464e-02f, -5.768573347e-02f, 9.904721305e-02f, -1.948743756e-01f, 8.278623272e-01f,
+    4.028720117e-01f, -1.502206354e-01f, 8.181553806e-02f, -4.836352942e-02f, 2.861374593e-02f, -1.625289933e-02f,
+    8.565106415e-03f, -4.013096342e-03f, 1.548932040e-03f, -3.977259832e-04f, -6.821757219e-04f, 2.209564151e-03f,
+    -5.292238337e-03f, 1.078838411e-02f, -1.987785631e-02f, 3.438271188e-02f, -5.780597387e-02f, 9.924453955e-02f,
+    -1.951841810e-01f, 8.263183141e-01f, 4.050099061e-01f, -1.508218369e-01f, 8.212273586e-02f, -4.854285302e-02f,
+    2.872085972e-02f, -1.631521178e-02f, 8.599199954e-03f, -4.029992608e-03f, 1.556080909e-03f, -3.999767336e-04f,
+    -6.825981721e-04f, 2.212477760e-03f, -5.300941236e-03f, 1.080823783e-02f, -1.991694028e-02f, 3.445281842e-02f,
+    -5.792459188e-02f, 9.943906800e-02f, -1.954883884e-01f, 8.247687031e-01f, 4.071481237e-01f, -1.514206509e-01f,
+    8.242843272e-02f, -4.872126389e-02f, 2.882743825e-02f, -1.637722992e-02f, 8.633147261e-03f, -4.046827153e-03f,
+    1.563210776e-03f, -4.022259553e-04f, -6.829976693e-04f, 2.215322382e-03f, -5.309485498e-03f, 1.082777688e-02f,
+    -1.995545561e-02f, 3.452195408e-02f, -5.804158720e-02f, 9.963079874e-02f, -1.957870057e-01f, 8.232135171e-01f,
+    4.092866362e-01f, -1.520170580e-01f, 8.273261865e-02f, -4.889875613e-02f, 2.893347792e-02f, -1.643895162e-02f,
+    8.666947141e-03f, -4.063599363e-03f, 1.570321371e-03f, -4.044735581e-04f, -6.833742943e-04f, 2.218098143e-03f,
+    -5.317871273e-03f, 1.084700139e-02f, -1.999340236e-02f, 3.459011873e-02f, -5.815695956e-02f, 9.981973219e-02f,
+    -1.960800409e-01f, 8.216527789e-01f, 4.114254153e-01f, -1.526110393e-01f, 8.303528366e-02f, -4.907532389e-02f,
+    2.903897519e-02f, -1.650037476e-02f, 8.700598399e-03f, -4.080308625e-03f, 1.577412424e-03f, -4.067194517e-04f,
+    -6.837281284e-04f, 2.220805168e-03f, -5.326098716e-03f, 1.086591151e-02f, -2.003078055e-02f, 3.465731227e-02f,
+    -5.827070875e-02f, 1.000058689e-01f, -1.963675018e-01f, 8.200865115e-01f, 4.135644327e-01f, -1.532025755e-01f,
+    8.333641781e-02f, -4.925096128e-02f, 2.914392650e-02f, -1.656149722e-02f, 8.734099840e-03f, -4.096954326e-03f,
+    1.584483662e-03f, -4.089635452e-04f, -6.840592535e-04f, 2.223443588e-03f, -5.334167988e-03f, 1.088450738e-02f,
+    -2.006759026e-02f, 3.472353459e-02f, -5.838283459e-02f, 1.001892093e-01f, -1.966493967e-01f, 8.185147380e-01f,
+    4.157036600e-01f, -1.537916477e-01f, 8.363601117e-02f, -4.942566247e-02f, 2.924832829e-02f, -1.662231689e-02f,
+    8.767450274e-03f, -4.113535853e-03f, 1.591534816e-03f, -4.112057477e-04f, -6.843677519e-04f, 2.226013531e-03f,
+    -5.342079252e-03f, 1.090278916e-02f, -2.010383157e-02f, 3.478878565e-02f, -5.849333693e-02f, 1.003697541e-01f,
+    -1.969257336e-01f, 8.169374814e-01f, 4.178430688e-01f, -1.543782366e-01f, 8.393405381e-02f, -4.959942163e-02f,
+    2.935217702e-02f, -1.668283166e-02f, 8.800648509e-03f, -4.130052595e-03f, 1.598565613e-03f, -4.134459678e-04f,
+    -6.846537062e-04f, 2.228515130e-03f, -5.349832674e-03f, 1.092075700e-02f, -2.013950456e-02f, 3.485306539e-02f,
+    -5.860221569e-02f, 1.005475040e-01f, -1.971965210e-01f, 8.153547649e-01f, 4.199826307e-01f, -1.549623233e-01f,
+    8.423053584e-02f, -4.977223292e-02f, 2.945546916e-02f, -1.674303942e-02f, 8.833693357e-03f, -4.146503939e-03f,
+    1.605575781e-03f, -4.156841138e-04f, -6.849171998e-04f, 2.230948519e-03f, -5.357428426e-03f, 1.093841108e-02f,
+    -2.017460935e-02f, 3.491637381e-02f, -5.870947079e-02f, 1.007224597e-01f, -1.974617671e-01f, 8.137666118e-01f,
+    4.221223173e-01f, -1.555438887e-01f, 8.452544740e-02f, -4.994409056e-02f, 2.955820119e-02f, -1.680293806e-02f,
+    8.866583631e-03f, -4.162889274e-03f, 1.612565050e-03f, -4.179200939e-04f, -6.851583163e-04f, 2.233313831e-03f,
+    -5.364866682e-03f, 1.095575158e-02f, -2.020914606e-02f, 3.497871092e-02f, -5.881510223e-02f, 1.008946220e-01f,
+    -1.977214803e-01f, 8.121730453e-01f, 4.242621002e-01f, -1.561229137e-01f, 8.481877862e-02f, -5.011498875e-02f,
+    2.966036958e-02f, -1.686252550e-02f, 8.899318146e-03f, -4.179207987e-03f, 1.619533145e-03f, -4.201538159e-04f,
+    -6.853771396e-04f, 2.235611205e-03f, -5.372147622e-03f, 1.097277868e-02f, -2.024311482e-02f, 3.504007675e-02f,
+    -5.891911001e-02f, 1.010639919e-01f, -1.979756693e-01f, 8.105740889e-01f, 4.264019507e-01f, -1.566993793e-01f,
+    8.511051968e-02f, -5.028492171e-02f, 2.976197083e-02f, -1.692179963e-02f, 8.931895716e-03f, -4.195459468e-03f,
+    1.626479796e-03f, -4.223851871e-04f, -6.855737545e-04f, 2.237840777e-03f, -5.379271428e-03f, 1.098949258e-02f,
+    -2.027651578e-02f, 3.510047135e-02f, -5.902149420e-02f, 1.012305701e-01f, -1.982243427e-01f, 8.089697661e-01f,
+    4.285418405e-01f, -1.572732665e-01f, 8.540066076e-02f, -5.045388368e-02f, 2.986300143e-02f, -1.698075836e-02f,
+    8.964315160e-03f, -4.211643106e-03f, 1.633404730e-03f, -4.246141148e-04f, -6.857482458e-04f, 2.240002688e-03f,
+    -5.386238286e-03f, 1.100589347e-02f, -2.030934910e-02f, 3.515989482e-02f, -5.912225490e-02f, 1.013943578e-01f,
+    -1.984675090e-01f, 8.073601004e-01f, 4.306817410e-01f, -1.578445563e-01f, 8.568919209e-02f, -5.062186891e-02f,
+    2.996345790e-02f, -1.703939962e-02f, 8.996575298e-03f, -4.227758291e-03f, 1.640307673e-03f, -4.268405059e-04f,
+    -6.859006989e-04f, 2.242097080e-03f, -5.393048388e-03f, 1.102198158e-02f, -2.034161497e-02f, 3.521834726e-02f,
+    -5.922139225e-02f, 1.015553561e-01f, -1.987051773e-01f, 8.057451153e-01f, 4.328216237e-01f, -1.584132297e-01f,
+    8.597610389e-02f, -5.078887168e-02f, 3.006333676e-02f, -1.709772132e-02f, 9.028674950e-03f, -4.243804412e-03f,
+    1.647188353e-03f, -4.290642671e-04f, -6.860311997e-04f, 2.244124094e-03f, -5.399701927e-03f, 1.103775710e-02f,
+    -2.037331358e-02f, 3.527582880e-02f, -5.931890643e-02f, 1.017135659e-01f, -1.989373562e-01f, 8.041248347e-01f,
+    4.349614599e-01f, -1.589792678e-01f, 8.626138642e-02f, -5.095488627e-02f, 3.016263452e-02f, -1.715572138e-02f,
+    9.060612940e-03f, -4.259780860e-03f, 1.654046498e-03f, -4.312853047e-04f, -6.861398344e-04f, 2.246083875e-03f,
+    -5.406199100e-03f, 1.105322028e-02f, -2.040444513e-02f, 3.533233959e-02f, -5.941479765e-02f, 1.018689886e-01f,
+    -1.991640547e-01f, 8.024992822e-01f, 4.371012212e-01f, -1.595426516e-01f, 8.654502996e-02f, -5.111990697e-02f,
+    3.026134772e-02f, -1.721339774e-02f, 9.092388092e-03f, -4.275687026e-03f, 1.660881832e-03f, -4.335035247e-04f,
+    -6.862266898e-04f, 2.247976570e-03f, -5.412540111e-03f, 1.106837134e-02f, -2.043500985e-02f, 3.538787982e-02f,
+    -5.950906617e-02f, 1.020216254e-01f, -1.993852820e-01f, 8.008684816e-01f, 4.392408788e-01f, -1.601033622e-01f,
+    8.682702482e-02f, -5.128392811e-02f, 3.035947292e-02f, -1.727074832e-02f, 9.123999234e-03f, -4.291522301e-03f,
+    1.667694084e-03f, -4.357188329e-04f, -6.862918528e-04f, 2.249802326e-03f, -5.418725165e-03f, 1.108321053e-02f,
+    -2.046500797e-02f, 3.544244969e-02f, -5.960171229e-02f, 1.021714776e-01f, -1.996010471e-01f, 7.992324569e-01f,
+    4.413804041e-01f, -1.606613806e-01f, 8.710736132e-02f, -5.144694401e-02f, 3.045700665e-02f, -1.732777106e-02f,
+    9.155445193e-03f, -4.307286076e-03f, 1.674482979e-03f, -4.379311350e-04f, -6.863354109e-04f, 2.251561291e-03f,
+    -5.424754470e-03f, 1.109773809e-02f, -2.049443974e-02f, 3.549604943e-02f, -5.969273634e-02f, 1.023185466e-01f,
+    -1.998113593e-01f, 7.975912321e-01f, 4.435197685e-01f, -1.612166880e-01f, 8.738602981e-02f, -5.160894901e-02f,
+    3.055394549e-02f, -1.738446390e-02f, 9.186724802e-03f, -4.322977744e-03f, 1.681248245e-03f, -4.401403360e-04f,
+    -6.863574521e-04f, 2.253253617e-03f, -5.430628240e-03f, 1.111195427e-02f, -2.052330542e-02f, 3.554867929e-02f,
+    -5.978213871e-02f, 1.024628338e-01f, -2.000162278e-01f, 7.959448311e-01f, 4.456589433e-01f, -1.617692656e-01f,
+    8.766302066e-02f, -5.176993749e-02f, 3.065028600e-02f, -1.744082480e-02f, 9.217836891e-03f, -4.338596697e-03f,
+    1.687989606e-03f, -4.423463411e-04f, -6.863580647e-04f, 2.254879455e-03f, -5.436346691e-03f, 1.112585935e-02f,
+    -2.055160529e-02f, 3.560033954e-02f, -5.986991980e-02f, 1.026043407e-01f, -2.002156620e-01f, 7.942932780e-01f,
+    4.477978998e-01f, -1.623190943e-01f, 8.793832427e-02f, -5.192990382e-02f, 3.074602477e-02f, -1.749685170e-02f,
+    9.248780296e-03f, -4.354142329e-03f, 1.694706789e-03f, -4.445490549e-04f, -6.863373374e-04f, 2.256438960e-03f,
+    -5.441910044e-03f, 1.113945359e-02f, -2.057933964e-02f, 3.565103048e-02f, -5.995608007e-02f, 1.027430690e-01f,
+    -2.004096713e-01f, 7.926365971e-01f, 4.499366093e-01f, -1.628661555e-01f, 8.821193106e-02f, -5.208884239e-02f,
+    3.084115839e-02f, -1.755254255e-02f, 9.279553854e-03f, -4.369614033e-03f, 1.701399520e-03f, -4.467483818e-04f,
+    -6.862953592e-04f, 2.257932285e-03f, -5.447318524e-03f, 1.115273727e-02f, -2.060650877e-02f, 3.570075244e-02f,
+    -6.004062001e-02f, 1.028790202e-01f, -2.005982654e-01f, 7.909748126e-01f, 4.520750431e-01f, -1.634104303e-01f,
+    8.848383148e-02f, -5.224674762e-02f, 3.093568345e-02f, -1.760789533e-02f, 9.310156403e-03f, -4.385011204e-03f,
+    1.708067525e-03f, -4.489442261e-04f, -6.862322196e-04f, 2.259359588e-03f, -5.452572358e-03f, 1.116571068e-02f,
+    -2.063311302e-02f, 3.574950577e-02f, -6.012354015e-02f, 1.030121960e-01f, -2.007814538e-01f, 7.893079487e-01f,
+    4.542131724e-01f, -1.639518999e-01f, 8.875401599e-02f, -5.240361394e-02f, 3.102959657e-02f, -1.766290800e-02f,
+    9.340586784e-03f, -4.400333236e-03f, 1.714710530e-03f, -4.511364917e-04f, -6.861480085e-04f, 2.260721026e-03f,
+    -5.457671777e-03f, 1.117837411e-02f, -2.065915270e-02f, 3.579729083e-02f, -6.020484106e-02f, 1.031425982e-01f,
+    -2.009592463e-01f, 7.876360299e-01f, 4.563509685e-01f, -1.644905454e-01f, 8.902247510e-02f, -5.255943578e-02f,
+    3.112289437e-02f, -1.771757852e-02f, 9.370843839e-03f, -4.415579525e-03f, 1.721328260e-03f, -4.533250822e-04f,
+    -6.860428162e-04f, 2.262016759e-03f, -5.462617018e-03f, 1.119072787e-02f, -2.068462817e-02f, 3.584410801e-02f,
+    -6.028452336e-02f, 1.032702287e-01f, -2.011316526e-01f, 7.859590806e-01f, 4.584884025e-01f, -1.650263483e-01f,
+    8.928919931e-02f, -5.271420762e-02f, 3.121557348e-02f, -1.777190488e-02f, 9.400926415e-03f, -4.430749466e-03f,
+    1.727920440e-03f, -4.555099011e-04f, -6.859167331e-04f, 2.263246948e-03f, -5.467408318e-03f, 1.120277225e-02f,
+    -2.070953978e-02f, 3.588995775e-02f, -6.036258769e-02f, 1.033950892e-01f, -2.012986826e-01f, 7.842771252e-01f,
+    4.606254457e-01f, -1.655592897e-01f, 8.955417919e-02f, -5.286792392e-02f, 3.130763053e-02f, -1.782588506e-02f,
+    9.430833359e-03f, -4.445842457e-03f, 1.734486797e-03f, -4.576908516e-04f, -6.857698505e-04f, 2.264411755e-03f,
+    -5.472045920e-03f, 1.121450759e-02f, -2.073388792e-02f, 3.593484048e-02f, -6.043903473e-02f, 1.035171818e-01f,
+    -2.014603462e-01f, 7.825901884e-01f, 4.627620693e-01f, -1.660893509e-01f, 8.981740530e-02f, -5.302057920e-02f,
+    3.139906218e-02f, -1.787951704e-02f, 9.460563520e-03f, -4.460857894e-03f, 1.741027055e-03f, -4.598678366e-04f,
+    -6.856022595e-04f, 2.265511344e-03f, -5.476530071e-03f, 1.122593420e-02f, -2.075767296e-02f, 3.597875665e-02f,
+    -6.051386521e-02f, 1.036365084e-01f, -2.016166536e-01f, 7.808982949e-01f, 4.648982444e-01f, -1.666165132e-01f,
+    9.007886824e-02f, -5.317216796e-02f, 3.148986510e-02f, -1.793279881e-02f, 9.490115750e-03f, -4.475795176e-03f,
+    1.747540940e-03f, -4.620407587e-04f, -6.854140519e-04f, 2.266545880e-03f, -5.480861020e-03f, 1.123705242e-02f,
+    -2.078089532e-02f, 3.602170678e-02f, -6.058707990e-02f, 1.037530711e-01f, -2.017676147e-01f, 7.792014692e-01f,
+    4.670339423e-01f, -1.671407580e-01f, 9.033855863e-02f, -5.332268473e-02f, 3.158003594e-02f, -1.798572839e-02f,
+    9.519488904e-03f, -4.490653701e-03f, 1.754028178e-03f, -4.642095204e-04f, -6.852053198e-04f, 2.267515529e-03f,
+    -5.485039020e-03f, 1.124786258e-02f, -2.080355540e-02f, 3.606369135e-02f, -6.065867960e-02f, 1.038668721e-01f,
+    -2.019132399e-01f, 7.774997362e-01f, 4.691691339e-01f, -1.676620666e-01f, 9.059646713e-02f, -5.347212406e-02f,
+    3.166957139e-02f, -1.803830376e-02f, 9.548681838e-03f, -4.505432869e-03f, 1.760488492e-03f, -4.663740239e-04f,
+    -6.849761556e-04f, 2.268420461e-03f, -5.489064328e-03f, 1.125836503e-02f, -2.082565364e-02f, 3.610471092e-02f,
+    -6.072866514e-02f, 1.039779134e-01f, -2.020535393e-01f, 7.757931206e-01f, 4.713037905e-01f, -1.681804203e-01f,
+    9.085258441e-02f, -5.362048053e-02f, 3.175846815e-02f, -1.809052294e-02f, 9.577693412e-03f, -4.520132079e-03f,
+    1.766921610e-03f, -4.685341712e-04f, -6.847266521e-04f, 2.269260843e-03f, -5.492937205e-03f, 1.126856012e-02f,
+    -2.084719047e-02f, 3.614476604e-02f, -6.079703741e-02f, 1.040861975e-01f, -2.021885233e-01f, 7.740816475e-01f,
+    4.734378832e-01f, -1.686958007e-01f, 9.110690118e-02f, -5.376774871e-02f, 3.184672291e-02f, -1.814238394e-02f,
+    9.606522486e-03f, -4.534750732e-03f, 1.773327255e-03f, -4.706898639e-04f, -6.844569024e-04f, 2.270036848e-03f,
+    -5.496657914e-03f, 1.127844822e-02f, -2.086816637e-02f, 3.618385729e-02f, -6.086379732e-02f, 1.041917265e-01f,
+    -2.023182024e-01f, 7.723653416e-01f, 4.755713831e-01f, -1.692081891e-01f, 9.135940817e-02f, -5.391392321e-02f,
+    3.193433239e-02f, -1.819388478e-02f, 9.635167925e-03f, -4.549288230e-03f, 1.779705154e-03f, -4.728410036e-04f,
+    -6.841669999e-04f, 2.270748646e-03f, -5.500226723e-03f, 1.128802969e-02f, -2.088858179e-02f, 3.622198527e-02f,
+    -6.092894582e-02f, 1.042945028e-01f, -2.024425871e-01f, 7.706442282e-01f, 4.777042613e-01f, -1.697175670e-01f,
+    9.161009614e-02f, -5.405899866e-02f, 3.202129332e-02f, -1.824502349e-02f, 9.663628596e-03f, -4.563743975e-03f,
+    1.786055031e-03f, -4.749874916e-04f, -6.838570385e-04f, 2.271396412e-03f, -5.503643903e-03f, 1.129730491e-02f,
+    -2.090843722e-02f, 3.625915063e-02f, -6.099248391e-02f, 1.043945289e-01f, -2.025616879e-01f, 7.689183321e-01f,
+    4.798364889e-01f, -1.702239158e-01f, 9.185895587e-02f, -5.420296969e-02f, 3.210760242e-02f, -1.829579810e-02f,
+    9.691903368e-03f, -4.578117370e-03f, 1.792376611e-03f, -4.771292288e-04f, -6.835271123e-04f, 2.271980321e-03f,
+    -5.506909729e-03f, 1.130627426e-02f, -2.092773315e-02f, 3.629535400e-02f, -6.105441263e-02f, 1.044918073e-01f,
+    -2.026755155e-01f, 7.671876787e-01f, 4.819680369e-01f, -1.707272171e-01f, 9.210597819e-02f, -5.434583097e-02f,
+    3.219325645e-02f, -1.834620664e-02f, 9.719991111e-03f, -4.592407819e-03f, 1.798669620e-03f, -4.792661161e-04f,
+    -6.831773157e-04f, 2.272500549e-03f, -5.510024478e-03f, 1.131493814e-02f, -2.094647011e-02f, 3.633059606e-02f,
+    -6.111473303e-02f, 1.045863405e-01f, -2.027840808e-01f, 7.654522930e-01f, 4.840988764e-01f, -1.712274524e-01f,
+    9.235115394e-02f, -5.448757717e-02f, 3.227825217e-02f, -1.839624717e-02f, 9.747890701e-03f, -4.606614726e-03f,
+    1.804933782e-03f, -4.813980540e-04f, -6.828077436e-04f, 2.272957274e-03f, -5.512988431e-03f, 1.132329693e-02f,
+    -2.096464860e-02f, 3.636487751e-02f, -6.117344622e-02f, 1.046781311e-01f, -2.028873944e-01f, 7.637122003e-01f,
+    4.862289784e-01f, -1.717246032e-01f, 9.259447399e-02f, -5.462820299e-02f, 3.236258633e-02f, -1.844591772e-02f,
+    9.775601014e-03f, -4.620737498e-03f, 1.811168824e-03f, -4.835249431e-04f, -6.824184909e-04f, 2.273350674e-03f,
+    -5.515801874e-03f, 1.133135105e-02f, -2.098226917e-02f, 3.639819907e-02f, -6.123055336e-02f, 1.047671818e-01f,
+    -2.029854674e-01f, 7.619674260e-01f, 4.883583141e-01f, -1.722186511e-01f, 9.283592925e-02f, -5.476770315e-02f,
+    3.244625573e-02f, -1.849521636e-02f, 9.803120930e-03f, -4.634775540e-03f, 1.817374470e-03f, -4.856466833e-04f,
+    -6.820096532e-04f, 2.273680930e-03f, -5.518465095e-03f, 1.133910091e-02f, -2.099933238e-02f, 3.643056149e-02f,
+    -6.128605561e-02f, 1.048534954e-01f, -2.030783106e-01f, 7.602179954e-01f, 4.904868543e-01f, -1.727095777e-01f,
+    9.307551063e-02f, -5.490607239e-02f, 3.252925715e-02f, -1.854414115e-02f, 9.830449331e-03f, -4.648728260e-03f,
+    1.823550445e-03f, -4.877631747e-04f, -6.815813262e-04f, 2.273948223e-03f, -5.520978385e-03f, 1.134654692e-02f,
+    -2.101583878e-02f, 3.646196553e-02f, -6.133995420e-02f, 1.049370745e-01f, -2.031659352e-01f, 7.584639340e-01f,
+    4.926145702e-01f, -1.731973647e-01f, 9.331320912e-02f, -5.504330546e-02f, 3.261158740e-02f, -1.859269015e-02f,
+    9.857585102e-03f, -4.662595066e-03f, 1.829696476e-03f, -4.898743170e-04f, -6.811336058e-04f, 2.274152737e-03f,
+    -5.523342040e-03f, 1.135368951e-02f, -2.103178895e-02f, 3.649241198e-02f, -6.139225039e-02f, 1.050179221e-01f,
+    -2.032483523e-01f, 7.567052673e-01f, 4.947414328e-01f, -1.736819936e-01f, 9.354901569e-02f, -5.517939713e-02f,
+    3.269324329e-02f, -1.864086144e-02f, 9.884527132e-03f, -4.676375367e-03f, 1.835812287e-03f, -4.919800097e-04f,
+    -6.806665884e-04f, 2.274294655e-03f, -5.525556358e-03f, 1.136052912e-02f, -2.104718348e-02f, 3.652190166e-02f,
+    -6.144294546e-02f, 1.050960411e-01f, -2.033255731e-01f, 7.549420209e-01f, 4.968674130e-01f, -1.741634463e-01f,
+    9.378292136e-02f, -5.531434221e-02f, 3.277422165e-02f, -1.868865309e-02f, 9.911274310e-03f, -4.690068573e-03f,
+    1.841897603e-03f, -4.940801521e-04f, -6.801803707e-04f, 2.274374164e-03f, -5.527621640e-03f, 1.136706618e-02f,
+    -2.106202297e-02f, 3.655043539e-02f, -6.149204075e-02f, 1.051714344e-01f, -2.033976089e-01f, 7.531742203e-01f,
+    4.989924819e-01f, -1.746417044e-01f, 9.401491719e-02f, -5.544813552e-02f, 3.285451932e-02f, -1.873606320e-02f,
+    9.937825531e-03f, -4.703674096e-03f, 1.847952151e-03f, -4.961746435e-04f, -6.796750495e-04f, 2.274391450e-03f,
+    -5.529538193e-03f, 1.137330114e-02f, -2.107630805e-02f, 3.657801404e-02f, -6.153953763e-02f, 1.052441051e-01f,
+    -2.034644710e-01f, 7.514018912e-01f, 5.011166104e-01f, -1.751167496e-01f, 9.424499426e-02f, -5.558077188e-02f,
+    3.293413315e-02f, -1.878308985e-02f, 9.964179690e-03f, -4.717191347e-03f, 1.853975656e-03f, -4.982633827e-04f,
+    -6.791507221e-04f, 2.274346701e-03f, -5.531306324e-03f, 1.137923446e-02f, -2.109003934e-02f, 3.660463849e-02f,
+    -6.158543750e-02f, 1.053140562e-01f, -2.035261710e-01f, 7.496250593e-01f, 5.032397696e-01f, -1.755885638e-01f,
+    9.447314367e-02f, -5.571224615e-02f, 3.301305999e-02f, -1.882973114e-02f, 9.990335688e-03f, -4.730619739e-03f,
+    1.859967843e-03f, -5.003462684e-04f, -6.786074859e-04f, 2.274240106e-03f, -5.532926346e-03f, 1.138486660e-02f,
+    -2.110321748e-02f, 3.663030963e-02f, -6.162974180e-02f, 1.053812909e-01f, -2.035827202e-01f, 7.478437506e-01f,
+    5.053619304e-01f, -1.760571288e-01f, 9.469935658e-02f, -5.584255321e-02f, 3.309129674e-02f, -1.887598519e-02f,
+    1.001629243e-02f, -4.743958686e-03f, 1.865928439e-03f, -5.024231992e-04f, -6.780454387e-04f, 2.274071856e-03f,
+    -5.534398573e-03f, 1.139019803e-02f, -2.111584314e-02f, 3.665502839e-02f, -6.167245202e-02f, 1.054458124e-01f,
+    -2.036341304e-01f, 7.460579907e-01f, 5.074830638e-01f, -1.765224263e-01f, 9.492362415e-02f, -5.597168796e-02f,
+    3.316884026e-02f, -1.892185010e-02f, 1.004204881e-02f, -4.757207603e-03f, 1.871857170e-03f, -5.044940734e-04f,
+    -6.774646787e-04f, 2.273842143e-03f, -5.535723324e-03f, 1.139522922e-02f, -2.112791697e-02f, 3.667879573e-02f,
+    -6.171356966e-02f, 1.055076240e-01f, -2.036804131e-01f, 7.442678056e-01f, 5.096031408e-01f, -1.769844383e-01f,
+    9.514593760e-02f, -5.609964532e-02f, 3.324568747e-02f, -1.896732399e-02f, 1.006760375e-02f, -4.770365906e-03f,
+    1.877753761e-03f, -5.065587893e-04f, -6.768653039e-04f, 2.273551161e-03f, -5.536900920e-03f, 1.139996065e-02f,
+    -2.113943967e-02f, 3.670161261e-02f, -6.175309628e-02f, 1.055667289e-01f, -2.037215801e-01f, 7.424732212e-01f,
+    5.117221323e-01f, -1.774431466e-01f, 9.536628815e-02f, -5.622642023e-02f, 3.332183528e-02f, -1.901240498e-02f,
+    1.009295615e-02f, -4.783433013e-03f, 1.883617939e-03f, -5.086172448e-04f, -6.762474132e-04f, 2.273199103e-03f,
+    -5.537931687e-03f, 1.140439282e-02f, -2.115041193e-02f, 3.672348002e-02f, -6.179103347e-02f, 1.056231306e-01f,
+    -2.037576432e-01f, 7.406742636e-01f, 5.138400093e-01f, -1.778985332e-01f, 9.558466707e-02f, -5.635200764e-02f,
+    3.339728060e-02f, -1.905709122e-02f, 1.011810494e-02f, -4.796408342e-03f, 1.889449430e-03f, -5.106693377e-04f,
+    -6.756111053e-04f, 2.272786164e-03f, -5.538815953e-03f, 1.140852622e-02f, -2.116083445e-02f, 3.674439898e-02f,
+    -6.182738285e-02f, 1.056768324e-01f, -2.037886144e-01f, 7.388709588e-01f, 5.159567428e-01f, -1.783505800e-01f,
+    9.580106568e-02f, -5.647640255e-02f, 3.347202038e-02f, -1.910138083e-02f, 1.014304902e-02f, -4.809291312e-03f,
+    1.895247960e-03f, -5.127149656e-04f, -6.749564793e-04f, 2.272312542e-03f, -5.539554048e-03f, 1.141236135e-02f,
+    -2.117070796e-02f, 3.676437052e-02f, -6.186214609e-02f, 1.057278380e-01f, -2.038145055e-01f, 7.370633329e-01f,
+    5.180723037e-01f, -1.787992690e-01f, 9.601547529e-02f, -5.659959995e-02f, 3.354605156e-02f, -1.914527196e-02f,
+    1.016778733e-02f, -4.822081343e-03f, 1.901013257e-03f, -5.147540260e-04f, -6.742836345e-04f, 2.271778435e-03f,
+    -5.540146309e-03f, 1.141589872e-02f, -2.118003318e-02f, 3.678339571e-02f, -6.189532489e-02f, 1.057761507e-01f,
+    -2.038353287e-01f, 7.352514121e-01f, 5.201866630e-01f, -1.792445823e-01f, 9.622788729e-02f, -5.672159487e-02f,
+    3.361937112e-02f, -1.918876277e-02f, 1.019231877e-02f, -4.834777857e-03f, 1.906745046e-03f, -5.167864162e-04f,
+    -6.735926707e-04f, 2.271184042e-03f, -5.540593071e-03f, 1.141913885e-02f, -2.118881087e-02f, 3.680147562e-02f,
+    -6.192692096e-02f, 1.058217743e-01f, -2.038510959e-01f, 7.334352227e-01f, 5.222997916e-01f, -1.796865019e-01f,
+    9.643829306e-02f, -5.684238236e-02f, 3.369197602e-02f, -1.923185141e-02f, 1.021664229e-02f, -4.847380277e-03f,
+    1.912443055e-03f, -5.188120333e-04f, -6.728836876e-04f, 2.270529563e-03f, -5.540894677e-03f, 1.142208227e-02f,
+    -2.119704179e-02f, 3.681861135e-02f, -6.195693610e-02f, 1.058647123e-01f, -2.038618195e-01f, 7.316147908e-01f,
+    5.244116606e-01f, -1.801250099e-01f, 9.664668404e-02f, -5.696195749e-02f, 3.376386325e-02f, -1.927453606e-02f,
+    1.024075681e-02f, -4.859888027e-03f, 1.918107012e-03f, -5.208307742e-04f, -6.721567853e-04f, 2.269815199e-03f,
+    -5.541051471e-03f, 1.142472950e-02f, -2.120472670e-02f, 3.683480404e-02f, -6.198537210e-02f, 1.059049686e-01f,
+    -2.038675116e-01f, 7.297901429e-01f, 5.265222407e-01f, -1.805600884e-01f, 9.685305171e-02f, -5.708031534e-02f,
+    3.383502982e-02f, -1.931681488e-02f, 1.026466126e-02f, -4.872300532e-03f, 1.923736642e-03f, -5.228425358e-04f,
+    -6.714120642e-04f, 2.269041154e-03f, -5.541063799e-03f, 1.142708107e-02f, -2.121186638e-02f, 3.685005482e-02f,
+    -6.201223080e-02f, 1.059425468e-01f, -2.038681846e-01f, 7.279613053e-01f, 5.286315031e-01f, -1.809917196e-01f,
+    9.705738754e-02f, -5.719745104e-02f, 3.390547275e-02f, -1.935868606e-02f, 1.028835459e-02f, -4.884617218e-03f,
+    1.929331675e-03f, -5.248472147e-04f, -6.706496248e-04f, 2.268207631e-03f, -5.540932012e-03f, 1.142913754e-02f,
+    -2.121846165e-02f, 3.686436487e-02f, -6.203751409e-02f, 1.059774508e-01f, -2.038638508e-01f, 7.261283044e-01f,
+    5.307394186e-01f, -1.814198856e-01f, 9.725968309e-02f, -5.731335971e-02f, 3.397518905e-02f, -1.940014778e-02f,
+    1.031183573e-02f, -4.896837514e-03f, 1.934891837e-03f, -5.268447073e-04f, -6.698695679e-04f, 2.267314835e-03f,
+    -5.540656463e-03f, 1.143089945e-02f, -2.122451330e-02f, 3.687773537e-02f, -6.206122387e-02f, 1.060096846e-01f,
+    -2.038545228e-01f, 7.242911667e-01f, 5.328459582e-01f, -1.818445688e-01f, 9.745992992e-02f, -5.742803653e-02f,
+    3.404417577e-02f, -1.944119824e-02f, 1.033510363e-02f, -4.908960847e-03f, 1.940416857e-03f, -5.288349100e-04f,
+    -6.690719946e-04f, 2.266362972e-03f, -5.540237509e-03f, 1.143236737e-02f, -2.123002216e-02f, 3.689016754e-02f,
+    -6.208336210e-02f, 1.060392520e-01f, -2.038402130e-01f, 7.224499187e-01f, 5.349510929e-01f, -1.822657513e-01f,
+    9.765811963e-02f, -5.754147666e-02f, 3.411242997e-02f, -1.948183565e-02f, 1.035815723e-02f, -4.920986649e-03f,
+    1.945906462e-03f, -5.308177190e-04f, -6.682570061e-04f, 2.265352250e-03f, -5.539675510e-03f, 1.143354184e-02f,
+    -2.123498906e-02f, 3.690166260e-02f, -6.210393076e-02f, 1.060661570e-01f, -2.038209342e-01f, 7.206045871e-01f,
+    5.370547936e-01f, -1.826834155e-01f, 9.785424387e-02f, -5.765367531e-02f, 3.417994872e-02f, -1.952205821e-02f,
+    1.038099549e-02f, -4.932914350e-03f, 1.951360382e-03f, -5.327930302e-04f, -6.674247037e-04f, 2.264282877e-03f,
+    -5.538970828e-03f, 1.143442345e-02f, -2.123941485e-02f, 3.691222183e-02f, -6.212293187e-02f, 1.060904037e-01f,
+    -2.037966988e-01f, 7.187551984e-01f, 5.391570313e-01f, -1.830975436e-01f, 9.804829429e-02f, -5.776462771e-02f,
+    3.424672910e-02f, -1.956186414e-02f, 1.040361736e-02f, -4.944743383e-03f, 1.956778344e-03f, -5.347607397e-04f,
+    -6.665751893e-04f, 2.263155061e-03f, -5.538123829e-03f, 1.143501277e-02f, -2.124330039e-02f, 3.692184648e-02f,
+    -6.214036749e-02f, 1.061119963e-01f, -2.037675198e-01f, 7.169017793e-01f, 5.412577769e-01f, -1.835081181e-01f,
+    9.824026262e-02f, -5.787432911e-02f, 3.431276821e-02f, -1.960125166e-02f, 1.042602180e-02f, -4.956473184e-03f,
+    1.962160078e-03f, -5.367207431e-04f, -6.657085646e-04f, 2.261969015e-03f, -5.537134882e-03f, 1.143531038e-02f,
+    -2.124664654e-02f, 3.693053786e-02f, -6.215623970e-02f, 1.061309388e-01f, -2.037334100e-01f, 7.150443566e-01f,
+    5.433570014e-01f, -1.839151214e-01f, 9.843014059e-02f, -5.798277479e-02f, 3.437806316e-02f, -1.964021902e-02f,
+    1.044820778e-02f, -4.968103186e-03f, 1.967505313e-03f, -5.386729360e-04f, -6.648249318e-04f, 2.260724949e-03f,
+    -5.536004358e-03f, 1.143531688e-02f, -2.124945420e-02f, 3.693829729e-02f, -6.217055063e-02f, 1.061472356e-01f,
+    -2.036943821e-01f, 7.131829570e-01f, 5.454546758e-01f, -1.843185359e-01f, 9.861791999e-02f, -5.808996004e-02f,
+    3.444261107e-02f, -1.967876444e-02f, 1.047017425e-02f, -4.979632827e-03f, 1.972813779e-03f, -5.406172140e-04f,
+    -6.639243931e-04f, 2.259423077e-03f, -5.534732632e-03f, 1.143503285e-02f, -2.125172426e-02f, 3.694512611e-02f,
+    -6.218330244e-02f, 1.061608908e-01f, -2.036504492e-01f, 7.113176074e-01f, 5.475507711e-01f, -1.847183441e-01f,
+    9.880359263e-02f, -5.819588018e-02f, 3.450640908e-02f, -1.971688618e-02f, 1.049192019e-02f, -4.991061546e-03f,
+    1.978085204e-03f, -5.425534723e-04f, -6.630070509e-04f, 2.258063611e-03f, -5.533320082e-03f, 1.143445890e-02f,
+    -2.125345762e-02f, 3.695102567e-02f, -6.219449733e-02f, 1.061719088e-01f, -2.036016243e-01f, 7.094483345e-01f,
+    5.496452582e-01f, -1.851145285e-01f, 9.898715035e-02f, -5.830053055e-02f, 3.456945434e-02f, -1.975458249e-02f,
+    1.051344456e-02f, -5.002388781e-03f, 1.983319319e-03f, -5.444816063e-04f, -6.620730080e-04f, 2.256646768e-03f,
+    -5.531767087e-03f, 1.143359564e-02f, -2.125465521e-02f, 3.695599736e-02f, -6.220413753e-02f, 1.061802941e-01f,
+    -2.035479205e-01f, 7.075751654e-01f, 5.517381081e-01f, -1.855070716e-01f, 9.916858506e-02f, -5.840390654e-02f,
+    3.463174403e-02f, -1.979185164e-02f, 1.053474635e-02f, -5.013613974e-03f, 1.988515854e-03f, -5.464015110e-04f,
+    -6.611223672e-04f, 2.255172762e-03f, -5.530074033e-03f, 1.143244369e-02f, -2.125531795e-02f, 3.696004259e-02f,
+    -6.221222530e-02f, 1.061860510e-01f, -2.034893510e-01f, 7.056981269e-01f, 5.538292918e-01f, -1.858959561e-01f,
+    9.934788867e-02f, -5.850600352e-02f, 3.469327532e-02f, -1.982869189e-02f, 1.055582454e-02f, -5.024736567e-03f,
+    1.993674541e-03f, -5.483130814e-04f, -6.601552314e-04f, 2.253641811e-03f, -5.528241305e-03f, 1.143100366e-02f,
+    -2.125544680e-02f, 3.696316278e-02f, -6.221876293e-02f, 1.061891840e-01f, -2.034259289e-01f, 7.038172461e-01f,
+    5.559187803e-01f, -1.862811647e-01f, 9.952505315e-02f, -5.860681692e-02f, 3.475404542e-02f, -1.986510154e-02f,
+    1.057667811e-02f, -5.035756006e-03f, 1.998795109e-03f, -5.502162124e-04f, -6.591717040e-04f, 2.252054134e-03f,
+    -5.526269292e-03f, 1.142927618e-02f, -2.125504271e-02f, 3.696535938e-02f, -6.222375278e-02f, 1.061896977e-01f,
+    -2.033576676e-01f, 7.019325500e-01f, 5.580065447e-01f, -1.866626799e-01f, 9.970007050e-02f, -5.870634217e-02f,
+    3.481405152e-02f, -1.990107886e-02f, 1.059730605e-02f, -5.046671734e-03f, 2.003877290e-03f, -5.521107988e-04f,
+    -6.581718882e-04f, 2.250409947e-03f, -5.524158387e-03f, 1.142726190e-02f, -2.125410665e-02f, 3.696663384e-02f,
+    -6.222719719e-02f, 1.061875967e-01f, -2.032845804e-01f, 7.000440658e-01f, 5.600925558e-01f, -1.870404845e-01f,
+    9.987293274e-02f, -5.880457475e-02f, 3.487329087e-02f, -1.993662214e-02f, 1.061770735e-02f, -5.057483199e-03f,
+    2.008920815e-03f, -5.539967351e-04f, -6.571558877e-04f, 2.248709473e-03f, -5.521908985e-03f, 1.142496144e-02f,
+    -2.125263959e-02f, 3.696698766e-02f, -6.222909858e-02f, 1.061828857e-01f, -2.032066809e-01f, 6.981518205e-01f,
+    5.621767849e-01f, -1.874145612e-01f, 1.000436320e-01f, -5.890151014e-02f, 3.493176069e-02f, -1.997172970e-02f,
+    1.063788100e-02f, -5.068189849e-03f, 2.013925418e-03f, -5.558739160e-04f, -6.561238061e-04f, 2.246952932e-03f,
+    -5.519521483e-03f, 1.142237546e-02f, -2.125064254e-02f, 3.696642235e-02f, -6.222945938e-02f, 1.061755693e-01f,
+    -2.031239823e-01f, 6.962558413e-01f, 5.642592027e-01f, -1.877848929e-01f, 1.002121603e-01f, -5.899714386e-02f,
+    3.498945824e-02f, -2.000639985e-02f, 1.065782601e-02f, -5.078791136e-03f, 2.018890829e-03f, -5.577422358e-04f,
+    -6.550757472e-04f, 2.245140546e-03f, -5.516996283e-03f, 1.141950460e-02f, -2.124811649e-02f, 3.696493943e-02f,
+    -6.222828205e-02f, 1.061656524e-01f, -2.030364984e-01f, 6.943561555e-01f, 5.663397805e-01f, -1.881514623e-01f,
+    1.003785098e-01f, -5.909147146e-02f, 3.504638080e-02f, -2.004063090e-02f, 1.067754138e-02f, -5.089286509e-03f,
+    2.023816781e-03f, -5.596015890e-04f, -6.540118153e-04f, 2.243272538e-03f, -5.514333788e-03f, 1.141634953e-02f,
+    -2.124506245e-02f, 3.696254045e-02f, -6.222556912e-02f, 1.061531397e-01f, -2.029442428e-01f, 6.924527903e-01f,
+    5.684184893e-01f, -1.885142524e-01f, 1.005426728e-01f, -5.918448849e-02f, 3.510252565e-02f, -2.007442119e-02f,
+    1.069702612e-02f, -5.099675423e-03f, 2.028703008e-03f, -5.614518697e-04f, -6.529321143e-04f, 2.241349132e-03f,
+    -5.511534404e-03f, 1.141291092e-02f, -2.124148147e-02f, 3.695922699e-02f, -6.222132310e-02f, 1.061380361e-01f,
+    -2.028472291e-01f, 6.905457730e-01f, 5.704953000e-01f, -1.888732461e-01f, 1.007046414e-01f, -5.927619054e-02f,
+    3.515789009e-02f, -2.010776904e-02f, 1.071627924e-02f, -5.109957333e-03f, 2.033549242e-03f, -5.632929721e-04f,
+    -6.518367487e-04f, 2.239370553e-03f, -5.508598541e-03f, 1.140918942e-02f, -2.123737457e-02f, 3.695500063e-02f,
+    -6.221554658e-02f, 1.061203465e-01f, -2.027454712e-01f, 6.886351310e-01f, 5.725701839e-01f, -1.892284263e-01f,
+    1.008644080e-01f, -5.936657324e-02f, 3.521247143e-02f, -2.014067282e-02f, 1.073529976e-02f, -5.120131694e-03f,
+    2.038355218e-03f, -5.651247904e-04f, -6.507258229e-04f, 2.237337026e-03f, -5.505526610e-03f, 1.140518573e-02f,
+    -2.123274280e-02f, 3.694986298e-02f, -6.220824215e-02f, 1.061000760e-01f, -2.026389827e-01f, 6.867208916e-01f,
+    5.746431119e-01f, -1.895797760e-01f, 1.010219648e-01f, -5.945563222e-02f, 3.526626701e-02f, -2.017313085e-02f,
+    1.075408669e-02f, -5.130197966e-03f, 2.043120669e-03f, -5.669472183e-04f, -6.495994415e-04f, 2.235248780e-03f,
+    -5.502319027e-03f, 1.140090052e-02f, -2.122758724e-02f, 3.694381567e-02f, -6.219941246e-02f, 1.060772295e-01f,
+    -2.025277777e-01f, 6.848030824e-01f, 5.767140551e-01f, -1.899272784e-01f, 1.011773042e-01f, -5.954336316e-02f,
+    3.531927417e-02f, -2.020514152e-02f, 1.077263906e-02f, -5.140155607e-03f, 2.047845331e-03f, -5.687601500e-04f,
+    -6.484577093e-04f, 2.233106042e-03f, -5.498976207e-03f, 1.139633449e-02f, -2.122190895e-02f, 3.693686036e-02f,
+    -6.218906018e-02f, 1.060518121e-01f, -2.024118700e-01f, 6.828817306e-01f, 5.787829847e-01f, -1.902709164e-01f,
+    1.013304185e-01f, -5.962976175e-02f, 3.537149028e-02f, -2.023670320e-02f, 1.079095591e-02f, -5.150004079e-03f,
+    2.052528938e-03f, -5.705634791e-04f, -6.473007312e-04f, 2.230909040e-03f, -5.495498572e-03f, 1.139148832e-02f,
+    -2.121570901e-02f, 3.692899871e-02f, -6.217718802e-02f, 1.060238290e-01f, -2.022912738e-01f, 6.809568640e-01f,
+    5.808498718e-01f, -1.906106732e-01f, 1.014813002e-01f, -5.971482370e-02f, 3.542291271e-02f, -2.026781425e-02f,
+    1.080903625e-02f, -5.159742845e-03f, 2.057171225e-03f, -5.723570994e-04f, -6.461286121e-04f, 2.228658004e-03f,
+    -5.491886543e-03f, 1.138636272e-02f, -2.120898854e-02f, 3.692023242e-02f, -6.216379870e-02f, 1.059932853e-01f,
+    -2.021660029e-01f, 6.790285099e-01f, 5.829146874e-01f, -1.909465321e-01f, 1.016299418e-01f, -5.979854476e-02f,
+    3.547353886e-02f, -2.029847306e-02f, 1.082687913e-02f, -5.169371370e-03f, 2.061771929e-03f, -5.741409047e-04f,
+    -6.449414572e-04f, 2.226353165e-03f, -5.488140547e-03f, 1.138095840e-02f, -2.120174862e-02f, 3.691056319e-02f,
+    -6.214889500e-02f, 1.059601863e-01f, -2.020360717e-01f, 6.770966961e-01f, 5.849774028e-01f, -1.912784761e-01f,
+    1.017763357e-01f, -5.988092071e-02f, 3.552336613e-02f, -2.032867805e-02f, 1.084448360e-02f, -5.178889121e-03f,
+    2.066330786e-03f, -5.759147884e-04f, -6.437393718e-04f, 2.223994754e-03f, -5.484261012e-03f, 1.137527607e-02f,
+    -2.119399039e-02f, 3.689999276e-02f, -6.213247973e-02f, 1.059245372e-01f, -2.019014943e-01f, 6.751614500e-01f,
+    5.870379891e-01f, -1.916064886e-01f, 1.019204745e-01f, -5.996194734e-02f, 3.557239195e-02f, -2.035842760e-02f,
+    1.086184869e-02f, -5.188295567e-03f, 2.070847531e-03f, -5.776786442e-04f, -6.425224613e-04f, 2.221583003e-03f,
+    -5.480248367e-03f, 1.136931645e-02f, -2.118571497e-02f, 3.688852288e-02f, -6.211455572e-02f, 1.058863435e-01f,
+    -2.017622850e-01f, 6.732227994e-01f, 5.890964174e-01f, -1.919305529e-01f, 1.020623508e-01f, -6.004162048e-02f,
+    3.562061377e-02f, -2.038772014e-02f, 1.087897345e-02f, -5.197590176e-03f, 2.075321904e-03f, -5.794323655e-04f,
+    -6.412908310e-04f, 2.219118147e-03f, -5.476103047e-03f, 1.136308027e-02f, -2.117692351e-02f, 3.687615532e-02f,
+    -6.209512584e-02f, 1.058456104e-01f, -2.016184580e-01f, 6.712807720e-01f, 5.911526590e-01f, -1.922506524e-01f,
+    1.022019572e-01f, -6.011993599e-02f, 3.566802903e-02f, -2.041655408e-02f, 1.089585695e-02f, -5.206772421e-03f,
+    2.079753640e-03f, -5.811758458e-04f, -6.400445867e-04f, 2.216600419e-03f, -5.471825487e-03f, 1.135656825e-02f,
+    -2.116761716e-02f, 3.686289186e-02f, -6.207419299e-02f, 1.058023434e-01f, -2.014700279e-01f, 6.693353955e-01f,
+    5.932066850e-01f, -1.925667704e-01f, 1.023392864e-01f, -6.019688973e-02f, 3.571463522e-02f, -2.044492786e-02f,
+    1.091249823e-02f, -5.215841776e-03f, 2.084142479e-03f, -5.829089783e-04f, -6.387838339e-04f, 2.214030053e-03f,
+    -5.467416125e-03f, 1.134978113e-02f, -2.115779708e-02f, 3.684873432e-02f, -6.205176011e-02f, 1.057565481e-01f,
+    -2.013170089e-01f, 6.673866977e-01f, 5.952584667e-01f, -1.928788905e-01f, 1.024743312e-01f, -6.027247761e-02f,
+    3.576042982e-02f, -2.047283993e-02f, 1.092889637e-02f, -5.224797717e-03f, 2.088488159e-03f, -5.846316565e-04f,
+    -6.375086786e-04f, 2.211407287e-03f, -5.462875403e-03f, 1.134271965e-02f, -2.114746445e-02f, 3.683368453e-02f,
+    -6.202783015e-02f, 1.057082299e-01f, -2.011594157e-01f, 6.654347063e-01f, 5.973079752e-01f, -1.931869960e-01f,
+    1.026070841e-01f, -6.034669558e-02f, 3.580541033e-02f, -2.050028872e-02f, 1.094505042e-02f, -5.233639720e-03f,
+    2.092790419e-03f, -5.863437737e-04f, -6.362192265e-04f, 2.208732356e-03f, -5.458203765e-03f, 1.133538457e-02f,
+    -2.113662045e-02f, 3.681774434e-02f, -6.200240613e-02f, 1.056573944e-01f, -2.009972628e-01f, 6.634794493e-01f,
+    5.993551819e-01f, -1.934910706e-01f, 1.027375381e-01f, -6.041953958e-02f, 3.584957429e-02f, -2.052727270e-02f,
+    1.096095947e-02f, -5.242367265e-03f, 2.097048999e-03f, -5.880452229e-04f, -6.349155837e-04f, 2.206005499e-03f,
+    -5.453401655e-03f, 1.132777663e-02f, -2.112526629e-02f, 3.680091560e-02f, -6.197549106e-02f, 1.056040474e-01f,
+    -2.008305649e-01f, 6.615209544e-01f, 6.014000581e-01f, -1.937910979e-01f, 1.028656860e-01f, -6.049100561e-02f,
+    3.589291922e-02f, -2.055379035e-02f, 1.097662259e-02f, -5.250979834e-03f, 2.101263638e-03f, -5.897358975e-04f,
+    -6.335978561e-04f, 2.203226953e-03f, -5.448469523e-03f, 1.131989660e-02f, -2.111340317e-02f, 3.678320022e-02f,
+    -6.194708801e-02f, 1.055481944e-01f, -2.006593366e-01f, 6.595592497e-01f, 6.034425748e-01f, -1.940870614e-01f,
+    1.029915207e-01f, -6.056108968e-02f, 3.593544269e-02f, -2.057984013e-02f, 1.099203887e-02f, -5.259476908e-03f,
+    2.105434078e-03f, -5.914156906e-04f, -6.322661501e-04f, 2.200396957e-03f, -5.443407820e-03f, 1.131174523e-02f,
+    -2.110103232e-02f, 3.676460009e-02f, -6.191720008e-02f, 1.054898412e-01f, -2.004835927e-01f, 6.575943630e-01f,
+    6.054827036e-01f, -1.943789449e-01f, 1.031150350e-01f, -6.062978784e-02f, 3.597714227e-02f, -2.060542053e-02f,
+    1.100720737e-02f, -5.267857974e-03f, 2.109560060e-03f, -5.930844953e-04f, -6.309205718e-04f, 2.197515753e-03f,
+    -5.438216998e-03f, 1.130332331e-02f, -2.108815495e-02f, 3.674511715e-02f, -6.188583038e-02f, 1.054289936e-01f,
+    -2.003033479e-01f, 6.556263223e-01f, 6.075204157e-01f, -1.946667322e-01f, 1.032362220e-01f, -6.069709616e-02f,
+    3.601801554e-02f, -2.063053005e-02f, 1.102212721e-02f, -5.276122518e-03f, 2.113641325e-03f, -5.947422048e-04f,
+    -6.295612274e-04f, 2.194583580e-03f, -5.432897516e-03f, 1.129463160e-02f, -2.107477232e-02f, 3.672475333e-02f,
+    -6.185298208e-02f, 1.053656574e-01f, -2.001186172e-01f, 6.536551556e-01f, 6.095556825e-01f, -1.949504069e-01f,
+    1.033550747e-01f, -6.076301073e-02f, 3.605806011e-02f, -2.065516720e-02f, 1.103679747e-02f, -5.284270029e-03f,
+    2.117677616e-03f, -5.963887120e-04f, -6.281882235e-04f, 2.191600680e-03f, -5.427449829e-03f, 1.128567089e-02f,
+    -2.106088567e-02f, 3.670351061e-02f, -6.181865836e-02f, 1.052998386e-01f, -1.999294156e-01f, 6.516808911e-01f,
+    6.115884753e-01f, -1.952299530e-01f, 1.034715861e-01f, -6.082752768e-02f, 3.609727361e-02f, -2.067933048e-02f,
+    1.105121726e-02f, -5.292299997e-03f, 2.121668676e-03f, -5.980239100e-04f, -6.268016663e-04f, 2.188567296e-03f,
+    -5.421874400e-03f, 1.127644196e-02f, -2.104649627e-02f, 3.668139096e-02f, -6.178286244e-02f, 1.052315430e-01f,
+    -1.997357578e-01f, 6.497035566e-01f, 6.136187655e-01f, -1.955053542e-01f, 1.035857492e-01f, -6.089064317e-02f,
+    3.613565367e-02f, -2.070301844e-02f, 1.106538567e-02f, -5.300211917e-03f, 2.125614248e-03f, -5.996476920e-04f,
+    -6.254016625e-04f, 2.185483670e-03f, -5.416171692e-03f, 1.126694561e-02f, -2.103160539e-02f, 3.665839638e-02f,
+    -6.174559758e-02f, 1.051607766e-01f, -1.995376591e-01f, 6.477231804e-01f, 6.156465245e-01f, -1.957765947e-01f,
+    1.036975574e-01f, -6.095235339e-02f, 3.617319795e-02f, -2.072622959e-02f, 1.107930182e-02f, -5.308005282e-03f,
+    2.129514076e-03f, -6.012599508e-04f, -6.239883186e-04f, 2.182350047e-03f, -5.410342169e-03f, 1.125718263e-02f,
+    -2.101621432e-02f, 3.663452889e-02f, -6.170686704e-02f, 1.050875455e-01f, -1.993351345e-01f, 6.457397905e-01f,
+    6.176717237e-01f, -1.960436583e-01f, 1.038070036e-01f, -6.101265454e-02f, 3.620990413e-02f, -2.074896249e-02f,
+    1.109296483e-02f, -5.315679590e-03f, 2.133367904e-03f, -6.028605795e-04f, -6.225617412e-04f, 2.179166671e-03f,
+    -5.404386300e-03f, 1.124715384e-02f, -2.100032434e-02f, 3.660979054e-02f, -6.166667415e-02f, 1.050118558e-01f,
+    -1.991281991e-01f, 6.437534152e-01f, 6.196943346e-01f, -1.963065290e-01f, 1.039140813e-01f, -6.107154286e-02f,
+    3.624576989e-02f, -2.077121569e-02f, 1.110637381e-02f, -5.323234340e-03f, 2.137175479e-03f, -6.044494712e-04f,
+    -6.211220371e-04f, 2.175933788e-03f, -5.398304556e-03f, 1.123686003e-02f, -2.098393677e-02f, 3.658418338e-02f,
+    -6.162502225e-02f, 1.049337135e-01f, -1.989168682e-01f, 6.417640826e-01f, 6.217143286e-01f, -1.965651911e-01f,
+    1.040187835e-01f, -6.112901464e-02f, 3.628079295e-02f, -2.079298774e-02f, 1.111952789e-02f, -5.330669032e-03f,
+    2.140936545e-03f, -6.060265188e-04f, -6.196693128e-04f, 2.172651643e-03f, -5.392097409e-03f, 1.122630202e-02f,
+    -2.096705292e-02f, 3.655770949e-02f, -6.158191471e-02f, 1.048531249e-01f, -1.987011570e-01f, 6.397718209e-01f,
+    6.237316773e-01f, -1.968196285e-01f, 1.041211037e-01f, -6.118506615e-02f, 3.631497104e-02f, -2.081427724e-02f,
+    1.113242619e-02f, -5.337983170e-03f, 2.144650849e-03f, -6.075916152e-04f, -6.182036752e-04f, 2.169320484e-03f,
+    -5.385765333e-03f, 1.121548063e-02f, -2.094967411e-02f, 3.653037095e-02f, -6.153735494e-02f, 1.047700962e-01f,
+    -1.984810809e-01f, 6.377766584e-01f, 6.257463521e-01f, -1.970698256e-01f, 1.042210353e-01f, -6.123969375e-02f,
+    3.634830188e-02f, -2.083508275e-02f, 1.114506786e-02f, -5.345176259e-03f, 2.148318139e-03f, -6.091446537e-04f,
+    -6.167252311e-04f, 2.165940558e-03f, -5.379308806e-03f, 1.120439668e-02f, -2.093180169e-02f, 3.650216989e-02f,
+    -6.149134636e-02f, 1.046846336e-01f, -1.982566553e-01f, 6.357786234e-01f, 6.277583247e-01f, -1.973157665e-01f,
+    1.043185715e-01f, -6.129289377e-02f, 3.638078326e-02f, -2.085540287e-02f, 1.115745203e-02f, -5.352247806e-03f,
+    2.151938161e-03f, -6.106855271e-04f, -6.152340874e-04f, 2.162512113e-03f, -5.372728307e-03f, 1.119305101e-02f,
+    -2.091343699e-02f, 3.647310843e-02f, -6.144389245e-02f, 1.045967434e-01f, -1.980278955e-01f, 6.337777442e-01f,
+    6.297675665e-01f, -1.975574355e-01f, 1.044137060e-01f, -6.134466261e-02f, 3.641241294e-02f, -2.087523621e-02f,
+    1.116957784e-02f, -5.359197322e-03f, 2.155510665e-03f, -6.122141284e-04f, -6.137303509e-04f, 2.159035399e-03f,
+    -5.366024317e-03f, 1.118144445e-02f, -2.089458137e-02f, 3.644318873e-02f, -6.139499669e-02f, 1.045064321e-01f,
+    -1.977948170e-01f, 6.317740491e-01f, 6.317740491e-01f, -1.977948170e-01f, 1.045064321e-01f, -6.139499669e-02f,
+    3.644318873e-02f, -2.089458137e-02f, 1.118144445e-02f, -5.366024317e-03f, 2.159035399e-03f, -6.137303509e-04f,
+    -6.122141284e-04f, 2.155510665e-03f, -5.359197322e-03f, 1.116957784e-02f, -2.087523621e-02f, 3.641241294e-02f,
+    -6.134466261e-02f, 1.044137060e-01f, -1.975574355e-01f, 6.297675665e-01f, 6.337777442e-01f, -1.980278955e-01f,
+    1.045967434e-01f, -6.144389245e-02f, 3.647310843e-02f, -2.091343699e-02f, 1.119305101e-02f, -5.372728307e-03f,
+    2.162512113e-03f, -6.152340874e-04f, -6.106855271e-04f, 2.151938161e-03f, -5.352247806e-03f, 1.115745203e-02f,
+    -2.085540287e-02f, 3.638078326e-02f, -6.129289377e-02f, 1.043185715e-01f, -1.973157665e-01f, 6.277583247e-01f,
+    6.357786234e-01f, -1.982566553e-01f, 1.046846336e-01f, -6.149134636e-02f, 3.650216989e-02f, -2.093180169e-02f,
+    1.120439668e-02f, -5.379308806e-03f, 2.165940558e-03f, -6.167252311e-04f, -6.091446537e-04f, 2.148318139e-03f,
+    -5.345176259e-03f, 1.114506786e-02f, -2.083508275e-02f, 3.634830188e-02f, -6.123969375e-02f, 1.042210353e-01f,
+    -1.970698256e-01f, 6.257463521e-01f, 6.377766584e-01f, -1.984810809e-01f, 1.047700962e-01f, -6.153735494e-02f,
+    3.653037095e-02f, -2.094967411e-02f, 1.121548063e-02f, -5.385765333e-03f, 2.169320484e-03f, -6.182036752e-04f,
+    -6.075916152e-04f, 2.144650849e-03f, -5.337983170e-03f, 1.113242619e-02f, -2.081427724e-02f, 3.631497104e-02f,
+    -6.118506615e-02f, 1.041211037e-01f, -1.968196285e-01f, 6.237316773e-01f, 6.397718209e-01f, -1.987011570e-01f,
+    1.048531249e-01f, -6.158191471e-02f, 3.655770949e-02f, -2.096705292e-02f, 1.122630202e-02f, -5.392097409e-03f,
+    2.172651643e-03f, -6.196693128e-04f, -6.060265188e-04f, 2.140936545e-03f, -5.330669032e-03f, 1.111952789e-02f,
+    -2.079298774e-02f, 3.628079295e-02f, -6.112901464e-02f, 1.040187835e-01f, -1.965651911e-01f, 6.217143286e-01f,
+    6.417640826e-01f, -1.989168682e-01f, 1.049337135e-01f, -6.162502225e-02f, 3.658418338e-02f, -2.098393677e-02f,
+    1.123686003e-02f, -5.398304556e-03f, 2.175933788e-03f, -6.211220371e-04f, -6.044494712e-04f, 2.137175479e-03f,
+    -5.323234340e-03f, 1.110637381e-02f, -2.077121569e-02f, 3.624576989e-02f, -6.107154286e-02f, 1.039140813e-01f,
+    -1.963065290e-01f, 6.196943346e-01f, 6.437534152e-01f, -1.991281991e-01f, 1.050118558e-01f, -6.166667415e-02f,
+    3.660979054e-02f, -2.100032434e-02f, 1.124715384e-02f, -5.404386300e-03f, 2.179166671e-03f, -6.225617412e-04f,
+    -6.028605795e-04f, 2.133367904e-03f, -5.315679590e-03f, 1.109296483e-02f, -2.074896249e-02f, 3.620990413e-02f,
+    -6.101265454e-02f, 1.038070036e-01f, -1.960436583e-01f, 6.176717237e-01f, 6.457397905e-01f, -1.993351345e-01f,
+    1.050875455e-01f, -6.170686704e-02f, 3.663452889e-02f, -2.101621432e-02f, 1.125718263e-02f, -5.410342169e-03f,
+    2.182350047e-03f, -6.239883186e-04f, -6.012599508e-04f, 2.129514076e-03f, -5.308005282e-03f, 1.107930182e-02f,
+    -2.072622959e-02f, 3.617319795e-02f, -6.095235339e-02f, 1.036975574e-01f, -1.957765947e-01f, 6.156465245e-01f,
+    6.477231804e-01f, -1.995376591e-01f, 1.051607766e-01f, -6.174559758e-02f, 3.665839638e-02f, -2.103160539e-02f,
+    1.126694561e-02f, -5.416171692e-03f, 2.185483670e-03f, -6.254016625e-04f, -5.996476920e-04f, 2.125614248e-03f,
+    -5.300211917e-03f, 1.106538567e-02f, -2.070301844e-02f, 3.613565367e-02f, -6.089064317e-02f, 1.035857492e-01f,
+    -1.955053542e-01f, 6.136187655e-01f, 6.497035566e-01f, -1.997357578e-01f, 1.052315430e-01f, -6.178286244e-02f,
+    3.668139096e-02f, -2.104649627e-02f, 1.127644196e-02f, -5.421874400e-03f, 2.188567296e-03f, -6.268016663e-04f,
+    -5.980239100e-04f, 2.121668676e-03f, -5.292299997e-03f, 1.105121726e-02f, -2.067933048e-02f, 3.609727361e-02f,
+    -6.082752768e-02f, 1.034715861e-01f, -1.952299530e-01f, 6.115884753e-01f, 6.516808911e-01f, -1.999294156e-01f,
+    1.052998386e-01f, -6.181865836e-02f, 3.670351061e-02f, -2.106088567e-02f, 1.128567089e-02f, -5.427449829e-03f,
+    2.191600680e-03f, -6.281882235e-04f, -5.963887120e-04f, 2.117677616e-03f, -5.284270029e-03f, 1.103679747e-02f,
+    -2.065516720e-02f, 3.605806011e-02f, -6.076301073e-02f, 1.033550747e-01f, -1.949504069e-01f, 6.095556825e-01f,
+    6.536551556e-01f, -2.001186172e-01f, 1.053656574e-01f, -6.185298208e-02f, 3.672475333e-02f, -2.107477232e-02f,
+    1.129463160e-02f, -5.432897516e-03f, 2.194583580e-03f, -6.295612274e-04f, -5.947422048e-04f, 2.113641325e-03f,
+    -5.276122518e-03f, 1.102212721e-02f, -2.063053005e-02f, 3.601801554e-02f, -6.069709616e-02f, 1.032362220e-01f,
+    -1.946667322e-01f, 6.075204157e-01f, 6.556263223e-01f, -2.003033479e-01f, 1.054289936e-01f, -6.188583038e-02f,
+    3.674511715e-02f, -2.108815495e-02f, 1.130332331e-02f, -5.438216998e-03f, 2.197515753e-03f, -6.309205718e-04f,
+    -5.930844953e-04f, 2.109560060e-03f, -5.267857974e-03f, 1.100720737e-02f, -2.060542053e-02f, 3.597714227e-02f,
+    -6.062978784e-02f, 1.031150350e-01f, -1.943789449e-01f, 6.054827036e-01f, 6.575943630e-01f, -2.004835927e-01f,
+    1.054898412e-01f, -6.191720008e-02f, 3.676460009e-02f, -2.110103232e-02f, 1.131174523e-02f, -5.443407820e-03f,
+    2.200396957e-03f, -6.322661501e-04f, -5.914156906e-04f, 2.105434078e-03f, -5.259476908e-03f, 1.099203887e-02f,
+    -2.057984013e-02f, 3.593544269e-02f, -6.056108968e-02f, 1.029915207e-01f, -1.940870614e-01f, 6.034425748e-01f,
+    6.595592497e-01f, -2.006593366e-01f, 1.055481944e-01f, -6.194708801e-02f, 3.678320022e-02f, -2.111340317e-02f,
+    1.131989660e-02f, -5.448469523e-03f, 2.203226953e-03f, -6.335978561e-04f, -5.897358975e-04f, 2.101263638e-03f,
+    -5.250979834e-03f, 1.097662259e-02f, -2.055379035e-02f, 3.589291922e-02f, -6.049100561e-02f, 1.028656860e-01f,
+    -1.937910979e-01f, 6.014000581e-01f, 6.615209544e-01f, -2.008305649e-01f, 1.056040474e-01f, -6.197549106e-02f,
+    3.680091560e-02f, -2.112526629e-02f, 1.132777663e-02f, -5.453401655e-03f, 2.206005499e-03f, -6.349155837e-04f,
+    -5.880452229e-04f, 2.097048999e-03f, -5.242367265e-03f, 1.096095947e-02f, -2.052727270e-02f, 3.584957429e-02f,
+    -6.041953958e-02f, 1.027375381e-01f, -1.934910706e-01f, 5.993551819e-01f, 6.634794493e-01f, -2.009972628e-01f,
+    1.056573944e-01f, -6.200240613e-02f, 3.681774434e-02f, -2.113662045e-02f, 1.133538457e-02f, -5.458203765e-03f,
+    2.208732356e-03f, -6.362192265e-04f, -5.863437737e-04f, 2.092790419e-03f, -5.233639720e-03f, 1.094505042e-02f,
+    -2.050028872e-02f, 3.580541033e-02f, -6.034669558e-02f, 1.026070841e-01f, -1.931869960e-01f, 5.973079752e-01f,
+    6.654347063e-01f, -2.011594157e-01f, 1.057082299e-01f, -6.202783015e-02f, 3.683368453e-02f, -2.114746445e-02f,
+    1.134271965e-02f, -5.462875403e-03f, 2.211407287e-03f, -6.375086786e-04f, -5.846316565e-04f, 2.088488159e-03f,
+    -5.224797717e-03f, 1.092889637e-02f, -2.047283993e-02f, 3.576042982e-02f, -6.027247761e-02f, 1.024743312e-01f,
+    -1.928788905e-01f, 5.952584667e-01f, 6.673866977e-01f, -2.013170089e-01f, 1.057565481e-01f, -6.205176011e-02f,
+    3.684873432e-02f, -2.115779708e-02f, 1.134978113e-02f, -5.467416125e-03f, 2.214030053e-03f, -6.387838339e-04f,
+    -5.829089783e-04f, 2.084142479e-03f, -5.215841776e-03f, 1.091249823e-02f, -2.044492786e-02f, 3.571463522e-02f,
+    -6.019688973e-02f, 1.023392864e-01f, -1.925667704e-01f, 5.932066850e-01f, 6.693353955e-01f, -2.014700279e-01f,
+    1.058023434e-01f, -6.207419299e-02f, 3.686289186e-02f, -2.116761716e-02f, 1.135656825e-02f, -5.471825487e-03f,
+    2.216600419e-03f, -6.400445867e-04f, -5.811758458e-04f, 2.079753640e-03f, -5.206772421e-03f, 1.089585695e-02f,
+    -2.041655408e-02f, 3.566802903e-02f, -6.011993599e-02f, 1.022019572e-01f, -1.922506524e-01f, 5.911526590e-01f,
+    6.712807720e-01f, -2.016184580e-01f, 1.058456104e-01f, -6.209512584e-02f, 3.687615532e-02f, -2.117692351e-02f,
+    1.136308027e-02f, -5.476103047e-03f, 2.219118147e-03f, -6.412908310e-04f, -5.794323655e-04f, 2.075321904e-03f,
+    -5.197590176e-03f, 1.087897345e-02f, -2.038772014e-02f, 3.562061377e-02f, -6.004162048e-02f, 1.020623508e-01f,
+    -1.919305529e-01f, 5.890964174e-01f, 6.732227994e-01f, -2.017622850e-01f, 1.058863435e-01f, -6.211455572e-02f,
+    3.688852288e-02f, -2.118571497e-02f, 1.136931645e-02f, -5.480248367e-03f, 2.221583003e-03f, -6.425224613e-04f,
+    -5.776786442e-04f, 2.070847531e-03f, -5.188295567e-03f, 1.086184869e-02f, -2.035842760e-02f, 3.557239195e-02f,
+    -5.996194734e-02f, 1.019204745e-01f, -1.916064886e-01f, 5.870379891e-01f, 6.751614500e-01f, -2.019014943e-01f,
+    1.059245372e-01f, -6.213247973e-02f, 3.689999276e-02f, -2.119399039e-02f, 1.137527607e-02f, -5.484261012e-03f,
+    2.223994754e-03f, -6.437393718e-04f, -5.759147884e-04f, 2.066330786e-03f, -5.178889121e-03f, 1.084448360e-02f,
+    -2.032867805e-02f, 3.552336613e-02f, -5.988092071e-02f, 1.017763357e-01f, -1.912784761e-01f, 5.849774028e-01f,
+    6.770966961e-01f, -2.020360717e-01f, 1.059601863e-01f, -6.214889500e-02f, 3.691056319e-02f, -2.120174862e-02f,
+    1.138095840e-02f, -5.488140547e-03f, 2.226353165e-03f, -6.449414572e-04f, -5.741409047e-04f, 2.061771929e-03f,
+    -5.169371370e-03f, 1.082687913e-02f, -2.029847306e-02f, 3.547353886e-02f, -5.979854476e-02f, 1.016299418e-01f,
+    -1.909465321e-01f, 5.829146874e-01f, 6.790285099e-01f, -2.021660029e-01f, 1.059932853e-01f, -6.216379870e-02f,
+    3.692023242e-02f, -2.120898854e-02f, 1.138636272e-02f, -5.491886543e-03f, 2.228658004e-03f, -6.461286121e-04f,
+    -5.723570994e-04f, 2.057171225e-03f, -5.159742845e-03f, 1.080903625e-02f, -2.026781425e-02f, 3.542291271e-02f,
+    -5.971482370e-02f, 1.014813002e-01f, -1.906106732e-01f, 5.808498718e-01f, 6.809568640e-01f, -2.022912738e-01f,
+    1.060238290e-01f, -6.217718802e-02f, 3.692899871e-02f, -2.121570901e-02f, 1.139148832e-02f, -5.495498572e-03f,
+    2.230909040e-03f, -6.473007312e-04f, -5.705634791e-04f, 2.052528938e-03f, -5.150004079e-03f, 1.079095591e-02f,
+    -2.023670320e-02f, 3.537149028e-02f, -5.962976175e-02f, 1.013304185e-01f, -1.902709164e-01f, 5.787829847e-01f,
+    6.828817306e-01f, -2.024118700e-01f, 1.060518121e-01f, -6.218906018e-02f, 3.693686036e-02f, -2.122190895e-02f,
+    1.139633449e-02f, -5.498976207e-03f, 2.233106042e-03f, -6.484577093e-04f, -5.687601500e-04f, 2.047845331e-03f,
+    -5.140155607e-03f, 1.077263906e-02f, -2.020514152e-02f, 3.531927417e-02f, -5.954336316e-02f, 1.011773042e-01f,
+    -1.899272784e-01f, 5.767140551e-01f, 6.848030824e-01f, -2.025277777e-01f, 1.060772295e-01f, -6.219941246e-02f,
+    3.694381567e-02f, -2.122758724e-02f, 1.140090052e-02f, -5.502319027e-03f, 2.235248780e-03f, -6.495994415e-04f,
+    -5.669472183e-04f, 2.043120669e-03f, -5.130197966e-03f, 1.075408669e-02f, -2.017313085e-02f, 3.526626701e-02f,
+    -5.945563222e-02f, 1.010219648e-01f, -1.895797760e-01f, 5.746431119e-01f, 6.867208916e-01f, -2.026389827e-01f,
+    1.061000760e-01f, -6.220824215e-02f, 3.694986298e-02f, -2.123274280e-02f, 1.140518573e-02f, -5.505526610e-03f,
+    2.237337026e-03f, -6.507258229e-04f, -5.651247904e-04f, 2.038355218e-03f, -5.120131694e-03f, 1.073529976e-02f,
+    -2.014067282e-02f, 3.521247143e-02f, -5.936657324e-02f, 1.008644080e-01f, -1.892284263e-01f, 5.725701839e-01f,
+    6.886351310e-01f, -2.027454712e-01f, 1.061203465e-01f, -6.221554658e-02f, 3.695500063e-02f, -2.123737457e-02f,
+    1.140918942e-02f, -5.508598541e-03f, 2.239370553e-03f, -6.518367487e-04f, -5.632929721e-04f, 2.033549242e-03f,
+    -5.109957333e-03f, 1.071627924e-02f, -2.010776904e-02f, 3.515789009e-02f, -5.927619054e-02f, 1.007046414e-01f,
+    -1.888732461e-01f, 5.704953000e-01f, 6.905457730e-01f, -2.028472291e-01f, 1.061380361e-01f, -6.222132310e-02f,
+    3.695922699e-02f, -2.124148147e-02f, 1.141291092e-02f, -5.511534404e-03f, 2.241349132e-03f, -6.529321143e-04f,
+    -5.614518697e-04f, 2.028703008e-03f, -5.099675423e-03f, 1.069702612e-02f, -2.007442119e-02f, 3.510252565e-02f,
+    -5.918448849e-02f, 1.005426728e-01f, -1.885142524e-01f, 5.684184893e-01f, 6.924527903e-01f, -2.029442428e-01f,
+    1.061531397e-01f, -6.222556912e-02f, 3.696254045e-02f, -2.124506245e-02f, 1.141634953e-02f, -5.514333788e-03f,
+    2.243272538e-03f, -6.540118153e-04f, -5.596015890e-04f, 2.023816781e-03f, -5.089286509e-03f, 1.067754138e-02f,
+    -2.004063090e-02f, 3.504638080e-02f, -5.909147146e-02f, 1.003785098e-01f, -1.881514623e-01f, 5.663397805e-01f,
+    6.943561555e-01f, -2.030364984e-01f, 1.061656524e-01f, -6.222828205e-02f, 3.696493943e-02f, -2.124811649e-02f,
+    1.141950460e-02f, -5.516996283e-03f, 2.245140546e-03f, -6.550757472e-04f, -5.577422358e-04f, 2.018890829e-03f,
+    -5.078791136e-03f, 1.065782601e-02f, -2.000639985e-02f, 3.498945824e-02f, -5.899714386e-02f, 1.002121603e-01f,
+    -1.877848929e-01f, 5.642592027e-01f, 6.962558413e-01f, -2.031239823e-01f, 1.061755693e-01f, -6.222945938e-02f,
+    3.696642235e-02f, -2.125064254e-02f, 1.142237546e-02f, -5.519521483e-03f, 2.246952932e-03f, -6.561238061e-04f,
+    -5.558739160e-04f, 2.013925418e-03f, -5.068189849e-03f, 1.063788100e-02f, -1.997172970e-02f, 3.493176069e-02f,
+    -5.890151014e-02f, 1.000436320e-01f, -1.874145612e-01f, 5.621767849e-01f, 6.981518205e-01f, -2.032066809e-01f,
+    1.061828857e-01f, -6.222909858e-02f, 3.696698766e-02f, -2.125263959e-02f, 1.142496144e-02f, -5.521908985e-03f,
+    2.248709473e-03f, -6.571558877e-04f, -5.539967351e-04f, 2.008920815e-03f, -5.057483199e-03f, 1.061770735e-02f,
+    -1.993662214e-02f, 3.487329087e-02f, -5.880457475e-02f, 9.987293274e-02f, -1.870404845e-01f, 5.600925558e-01f,
+    7.000440658e-01f, -2.032845804e-01f, 1.061875967e-01f, -6.222719719e-02f, 3.696663384e-02f, -2.125410665e-02f,
+    1.142726190e-02f, -5.524158387e-03f, 2.250409947e-03f, -6.581718882e-04f, -5.521107988e-04f, 2.003877290e-03f,
+    -5.046671734e-03f, 1.059730605e-02f, -1.990107886e-02f, 3.481405152e-02f, -5.870634217e-02f, 9.970007050e-02f,
+    -1.866626799e-01f, 5.580065447e-01f, 7.019325500e-01f, -2.033576676e-01f, 1.061896977e-01f, -6.222375278e-02f,
+    3.696535938e-02f, -2.125504271e-02f, 1.142927618e-02f, -5.526269292e-03f, 2.252054134e-03f, -6.591717040e-04f,
+    -5.502162124e-04f, 1.998795109e-03f, -5.035756006e-03f, 1.057667811e-02f, -1.986510154e-02f, 3.475404542e-02f,
+    -5.860681692e-02f, 9.952505315e-02f, -1.862811647e-01f, 5.559187803e-01f, 7.038172461e-01f, -2.034259289e-01f,
+    1.061891840e-01f, -6.221876293e-02f, 3.696316278e-02f, -2.125544680e-02f, 1.143100366e-02f, -5.528241305e-03f,
+    2.253641811e-03f, -6.601552314e-04f, -5.483130814e-04f, 1.993674541e-03f, -5.024736567e-03f, 1.055582454e-02f,
+    -1.982869189e-02f, 3.469327532e-02f, -5.850600352e-02f, 9.934788867e-02f, -1.858959561e-01f, 5.538292918e-01f,
+    7.056981269e-01f, -2.034893510e-01f, 1.061860510e-01f, -6.221222530e-02f, 3.696004259e-02f, -2.125531795e-02f,
+    1.143244369e-02f, -5.530074033e-03f, 2.255172762e-03f, -6.611223672e-04f, -5.464015110e-04f, 1.988515854e-03f,
+    -5.013613974e-03f, 1.053474635e-02f, -1.979185164e-02f, 3.463174403e-02f, -5.840390654e-02f, 9.916858506e-02f,
+    -1.855070716e-01f, 5.517381081e-01f, 7.075751654e-01f, -2.035479205e-01f, 1.061802941e-01f, -6.220413753e-02f,
+    3.695599736e-02f, -2.125465521e-02f, 1.143359564e-02f, -5.531767087e-03f, 2.256646768e-03f, -6.620730080e-04f,
+    -5.444816063e-04f, 1.983319319e-03f, -5.002388781e-03f, 1.051344456e-02f, -1.975458249e-02f, 3.456945434e-02f,
+    -5.830053055e-02f, 9.898715035e-02f, -1.851145285e-01f, 5.496452582e-01f, 7.094483345e-01f, -2.036016243e-01f,
+    1.061719088e-01f, -6.219449733e-02f, 3.695102567e-02f, -2.125345762e-02f, 1.143445890e-02f, -5.533320082e-03f,
+    2.258063611e-03f, -6.630070509e-04f, -5.425534723e-04f, 1.978085204e-03f, -4.991061546e-03f, 1.049192019e-02f,
+    -1.971688618e-02f, 3.450640908e-02f, -5.819588018e-02f, 9.880359263e-02f, -1.847183441e-01f, 5.475507711e-01f,
+    7.113176074e-01f, -2.036504492e-01f, 1.061608908e-01f, -6.218330244e-02f, 3.694512611e-02f, -2.125172426e-02f,
+    1.143503285e-02f, -5.534732632e-03f, 2.259423077e-03f, -6.639243931e-04f, -5.406172140e-04f, 1.972813779e-03f,
+    -4.979632827e-03f, 1.047017425e-02f, -1.967876444e-02f, 3.444261107e-02f, -5.808996004e-02f, 9.861791999e-02f,
+    -1.843185359e-01f, 5.454546758e-01f, 7.131829570e-01f, -2.036943821e-01f, 1.061472356e-01f, -6.217055063e-02f,
+    3.693829729e-02f, -2.124945420e-02f, 1.143531688e-02f, -5.536004358e-03f, 2.260724949e-03f, -6.648249318e-04f,
+    -5.386729360e-04f, 1.967505313e-03f, -4.968103186e-03f, 1.044820778e-02f, -1.964021902e-02f, 3.437806316e-02f,
+    -5.798277479e-02f, 9.843014059e-02f, -1.839151214e-01f, 5.433570014e-01f, 7.150443566e-01f, -2.037334100e-01f,
+    1.061309388e-01f, -6.215623970e-02f, 3.693053786e-02f, -2.124664654e-02f, 1.143531038e-02f, -5.537134882e-03f,
+    2.261969015e-03f, -6.657085646e-04f, -5.367207431e-04f, 1.962160078e-03f, -4.956473184e-03f, 1.042602180e-02f,
+    -1.960125166e-02f, 3.431276821e-02f, -5.787432911e-02f, 9.824026262e-02f, -1.835081181e-01f, 5.412577769e-01f,
+    7.169017793e-01f, -2.037675198e-01f, 1.061119963e-01f, -6.214036749e-02f, 3.692184648e-02f, -2.124330039e-02f,
+    1.143501277e-02f, -5.538123829e-03f, 2.263155061e-03f, -6.665751893e-04f, -5.347607397e-04f, 1.956778344e-03f,
+    -4.944743383e-03f, 1.040361736e-02f, -1.956186414e-02f, 3.424672910e-02f, -5.776462771e-02f, 9.804829429e-02f,
+    -1.830975436e-01f, 5.391570313e-01f, 7.187551984e-01f, -2.037966988e-01f, 1.060904037e-01f, -6.212293187e-02f,
+    3.691222183e-02f, -2.123941485e-02f, 1.143442345e-02f, -5.538970828e-03f, 2.264282877e-03f, -6.674247037e-04f,
+    -5.327930302e-04f, 1.951360382e-03f, -4.932914350e-03f, 1.038099549e-02f, -1.952205821e-02f, 3.417994872e-02f,
+    -5.765367531e-02f, 9.785424387e-02f, -1.826834155e-01f, 5.370547936e-01f, 7.206045871e-01f, -2.038209342e-01f,
+    1.060661570e-01f, -6.210393076e-02f, 3.690166260e-02f, -2.123498906e-02f, 1.143354184e-02f, -5.539675510e-03f,
+    2.265352250e-03f, -6.682570061e-04f, -5.308177190e-04f, 1.945906462e-03f, -4.920986649e-03f, 1.035815723e-02f,
+    -1.948183565e-02f, 3.411242997e-02f, -5.754147666e-02f, 9.765811963e-02f, -1.822657513e-01f, 5.349510929e-01f,
+    7.224499187e-01f, -2.038402130e-01f, 1.060392520e-01f, -6.208336210e-02f, 3.689016754e-02f, -2.123002216e-02f,
+    1.143236737e-02f, -5.540237509e-03f, 2.266362972e-03f, -6.690719946e-04f, -5.288349100e-04f, 1.940416857e-03f,
+    -4.908960847e-03f, 1.033510363e-02f, -1.944119824e-02f, 3.404417577e-02f, -5.742803653e-02f, 9.745992992e-02f,
+    -1.818445688e-01f, 5.328459582e-01f, 7.242911667e-01f, -2.038545228e-01f, 1.060096846e-01f, -6.206122387e-02f,
+    3.687773537e-02f, -2.122451330e-02f, 1.143089945e-02f, -5.540656463e-03f, 2.267314835e-03f, -6.698695679e-04f,
+    -5.268447073e-04f, 1.934891837e-03f, -4.896837514e-03f, 1.031183573e-02f, -1.940014778e-02f, 3.397518905e-02f,
+    -5.731335971e-02f, 9.725968309e-02f, -1.814198856e-01f, 5.307394186e-01f, 7.261283044e-01f, -2.038638508e-01f,
+    1.059774508e-01f, -6.203751409e-02f, 3.686436487e-02f, -2.121846165e-02f, 1.142913754e-02f, -5.540932012e-03f,
+    2.268207631e-03f, -6.706496248e-04f, -5.248472147e-04f, 1.929331675e-03f, -4.884617218e-03f, 1.028835459e-02f,
+    -1.935868606e-02f, 3.390547275e-02f, -5.719745104e-02f, 9.705738754e-02f, -1.809917196e-01f, 5.286315031e-01f,
+    7.279613053e-01f, -2.038681846e-01f, 1.059425468e-01f, -6.201223080e-02f, 3.685005482e-02f, -2.121186638e-02f,
+    1.142708107e-02f, -5.541063799e-03f, 2.269041154e-03f, -6.714120642e-04f, -5.228425358e-04f, 1.923736642e-03f,
+    -4.872300532e-03f, 1.026466126e-02f, -1.931681488e-02f, 3.383502982e-02f, -5.708031534e-02f, 9.685305171e-02f,
+    -1.805600884e-01f, 5.265222407e-01f, 7.297901429e-01f, -2.038675116e-01f, 1.059049686e-01f, -6.198537210e-02f,
+    3.683480404e-02f, -2.120472670e-02f, 1.142472950e-02f, -5.541051471e-03f, 2.269815199e-03f, -6.721567853e-04f,
+    -5.208307742e-04f, 1.918107012e-03f, -4.859888027e-03f, 1.024075681e-02f, -1.927453606e-02f, 3.376386325e-02f,
+    -5.696195749e-02f, 9.664668404e-02f, -1.801250099e-01f, 5.244116606e-01f, 7.316147908e-01f, -2.038618195e-01f,
+    1.058647123e-01f, -6.195693610e-02f, 3.681861135e-02f, -2.119704179e-02f, 1.142208227e-02f, -5.540894677e-03f,
+    2.270529563e-03f, -6.728836876e-04f, -5.188120333e-04f, 1.912443055e-03f, -4.847380277e-03f, 1.021664229e-02f,
+    -1.923185141e-02f, 3.369197602e-02f, -5.684238236e-02f, 9.643829306e-02f, -1.796865019e-01f, 5.222997916e-01f,
+    7.334352227e-01f, -2.038510959e-01f, 1.058217743e-01f, -6.192692096e-02f, 3.680147562e-02f, -2.118881087e-02f,
+    1.141913885e-02f, -5.540593071e-03f, 2.271184042e-03f, -6.735926707e-04f, -5.167864162e-04f, 1.906745046e-03f,
+    -4.834777857e-03f, 1.019231877e-02f, -1.918876277e-02f, 3.361937112e-02f, -5.672159487e-02f, 9.622788729e-02f,
+    -1.792445823e-01f, 5.201866630e-01f, 7.352514121e-01f, -2.038353287e-01f, 1.057761507e-01f, -6.189532489e-02f,
+    3.678339571e-02f, -2.118003318e-02f, 1.141589872e-02f, -5.540146309e-03f, 2.271778435e-03f, -6.742836345e-04f,
+    -5.147540260e-04f, 1.901013257e-03f, -4.822081343e-03f, 1.016778733e-02f, -1.914527196e-02f, 3.354605156e-02f,
+    -5.659959995e-02f, 9.601547529e-02f, -1.787992690e-01f, 5.180723037e-01f, 7.370633329e-01f, -2.038145055e-01f,
+    1.057278380e-01f, -6.186214609e-02f, 3.676437052e-02f, -2.117070796e-02f, 1.141236135e-02f, -5.539554048e-03f,
+    2.272312542e-03f, -6.749564793e-04f, -5.127149656e-04f, 1.895247960e-03f, -4.809291312e-03f, 1.014304902e-02f,
+    -1.910138083e-02f, 3.347202038e-02f, -5.647640255e-02f, 9.580106568e-02f, -1.783505800e-01f, 5.159567428e-01f,
+    7.388709588e-01f, -2.037886144e-01f, 1.056768324e-01f, -6.182738285e-02f, 3.674439898e-02f, -2.116083445e-02f,
+    1.140852622e-02f, -5.538815953e-03f, 2.272786164e-03f, -6.756111053e-04f, -5.106693377e-04f, 1.889449430e-03f,
+    -4.796408342e-03f, 1.011810494e-02f, -1.905709122e-02f, 3.339728060e-02f, -5.635200764e-02f, 9.558466707e-02f,
+    -1.778985332e-01f, 5.138400093e-01f, 7.406742636e-01f, -2.037576432e-01f, 1.056231306e-01f, -6.179103347e-02f,
+    3.672348002e-02f, -2.115041193e-02f, 1.140439282e-02f, -5.537931687e-03f, 2.273199103e-03f, -6.762474132e-04f,
+    -5.086172448e-04f, 1.883617939e-03f, -4.783433013e-03f, 1.009295615e-02f, -1.901240498e-02f, 3.332183528e-02f,
+    -5.622642023e-02f, 9.536628815e-02f, -1.774431466e-01f, 5.117221323e-01f, 7.424732212e-01f, -2.037215801e-01f,
+    1.055667289e-01f, -6.175309628e-02f, 3.670161261e-02f, -2.113943967e-02f, 1.139996065e-02f, -5.536900920e-03f,
+    2.273551161e-03f, -6.768653039e-04f, -5.065587893e-04f, 1.877753761e-03f, -4.770365906e-03f, 1.006760375e-02f,
+    -1.896732399e-02f, 3.324568747e-02f, -5.609964532e-02f, 9.514593760e-02f, -1.769844383e-01f, 5.096031408e-01f,
+    7.442678056e-01f, -2.036804131e-01f, 1.055076240e-01f, -6.171356966e-02f, 3.667879573e-02f, -2.112791697e-02f,
+    1.139522922e-02f, -5.535723324e-03f, 2.273842143e-03f, -6.774646787e-04f, -5.044940734e-04f, 1.871857170e-03f,
+    -4.757207603e-03f, 1.004204881e-02f, -1.892185010e-02f, 3.316884026e-02f, -5.597168796e-02f, 9.492362415e-02f,
+    -1.765224263e-01f, 5.074830638e-01f, 7.460579907e-01f, -2.036341304e-01f, 1.054458124e-01f, -6.167245202e-02f,
+    3.665502839e-02f, -2.111584314e-02f, 1.139019803e-02f, -5.534398573e-03f, 2.274071856e-03f, -6.780454387e-04f,
+    -5.024231992e-04f, 1.865928439e-03f, -4.743958686e-03f, 1.001629243e-02f, -1.887598519e-02f, 3.309129674e-02f,
+    -5.584255321e-02f, 9.469935658e-02f, -1.760571288e-01f, 5.053619304e-01f, 7.478437506e-01f, -2.035827202e-01f,
+    1.053812909e-01f, -6.162974180e-02f, 3.663030963e-02f, -2.110321748e-02f, 1.138486660e-02f, -5.532926346e-03f,
+    2.274240106e-03f, -6.786074859e-04f, -5.003462684e-04f, 1.859967843e-03f, -4.730619739e-03f, 9.990335688e-03f,
+    -1.882973114e-02f, 3.301305999e-02f, -5.571224615e-02f, 9.447314367e-02f, -1.755885638e-01f, 5.032397696e-01f,
+    7.496250593e-01f, -2.035261710e-01f, 1.053140562e-01f, -6.158543750e-02f, 3.660463849e-02f, -2.109003934e-02f,
+    1.137923446e-02f, -5.531306324e-03f, 2.274346701e-03f, -6.791507221e-04f, -4.982633827e-04f, 1.853975656e-03f,
+    -4.717191347e-03f, 9.964179690e-03f, -1.878308985e-02f, 3.293413315e-02f, -5.558077188e-02f, 9.424499426e-02f,
+    -1.751167496e-01f, 5.011166104e-01f, 7.514018912e-01f, -2.034644710e-01f, 1.052441051e-01f, -6.153953763e-02f,
+    3.657801404e-02f, -2.107630805e-02f, 1.137330114e-02f, -5.529538193e-03f, 2.274391450e-03f, -6.796750495e-04f,
+    -4.961746435e-04f, 1.847952151e-03f, -4.703674096e-03f, 9.937825531e-03f, -1.873606320e-02f, 3.285451932e-02f,
+    -5.544813552e-02f, 9.401491719e-02f, -1.746417044e-01f, 4.989924819e-01f, 7.531742203e-01f, -2.033976089e-01f,
+    1.051714344e-01f, -6.149204075e-02f, 3.655043539e-02f, -2.106202297e-02f, 1.136706618e-02f, -5.527621640e-03f,
+    2.274374164e-03f, -6.801803707e-04f, -4.940801521e-04f, 1.841897603e-03f, -4.690068573e-03f, 9.911274310e-03f,
+    -1.868865309e-02f, 3.277422165e-02f, -5.531434221e-02f, 9.378292136e-02f, -1.741634463e-01f, 4.968674130e-01f,
+    7.549420209e-01f, -2.033255731e-01f, 1.050960411e-01f, -6.144294546e-02f, 3.652190166e-02f, -2.104718348e-02f,
+    1.136052912e-02f, -5.525556358e-03f, 2.274294655e-03f, -6.806665884e-04f, -4.919800097e-04f, 1.835812287e-03f,
+    -4.676375367e-03f, 9.884527132e-03f, -1.864086144e-02f, 3.269324329e-02f, -5.517939713e-02f, 9.354901569e-02f,
+    -1.736819936e-01f, 4.947414328e-01f, 7.567052673e-01f, -2.032483523e-01f, 1.050179221e-01f, -6.139225039e-02f,
+    3.649241198e-02f, -2.103178895e-02f, 1.135368951e-02f, -5.523342040e-03f, 2.274152737e-03f, -6.811336058e-04f,
+    -4.898743170e-04f, 1.829696476e-03f, -4.662595066e-03f, 9.857585102e-03f, -1.859269015e-02f, 3.261158740e-02f,
+    -5.504330546e-02f, 9.331320912e-02f, -1.731973647e-01f, 4.926145702e-01f, 7.584639340e-01f, -2.031659352e-01f,
+    1.049370745e-01f, -6.133995420e-02f, 3.646196553e-02f, -2.101583878e-02f, 1.134654692e-02f, -5.520978385e-03f,
+    2.273948223e-03f, -6.815813262e-04f, -4.877631747e-04f, 1.823550445e-03f, -4.648728260e-03f, 9.830449331e-03f,
+    -1.854414115e-02f, 3.252925715e-02f, -5.490607239e-02f, 9.307551063e-02f, -1.727095777e-01f, 4.904868543e-01f,
+    7.602179954e-01f, -2.030783106e-01f, 1.048534954e-01f, -6.128605561e-02f, 3.643056149e-02f, -2.099933238e-02f,
+    1.133910091e-02f, -5.518465095e-03f, 2.273680930e-03f, -6.820096532e-04f, -4.856466833e-04f, 1.817374470e-03f,
+    -4.634775540e-03f, 9.803120930e-03f, -1.849521636e-02f, 3.244625573e-02f, -5.476770315e-02f, 9.283592925e-02f,
+    -1.722186511e-01f, 4.883583141e-01f, 7.619674260e-01f, -2.029854674e-01f, 1.047671818e-01f, -6.123055336e-02f,
+    3.639819907e-02f, -2.098226917e-02f, 1.133135105e-02f, -5.515801874e-03f, 2.273350674e-03f, -6.824184909e-04f,
+    -4.835249431e-04f, 1.811168824e-03f, -4.620737498e-03f, 9.775601014e-03f, -1.844591772e-02f, 3.236258633e-02f,
+    -5.462820299e-02f, 9.259447399e-02f, -1.717246032e-01f, 4.862289784e-01f, 7.637122003e-01f, -2.028873944e-01f,
+    1.046781311e-01f, -6.117344622e-02f, 3.636487751e-02f, -2.096464860e-02f, 1.132329693e-02f, -5.512988431e-03f,
+    2.272957274e-03f, -6.828077436e-04f, -4.813980540e-04f, 1.804933782e-03f, -4.606614726e-03f, 9.747890701e-03f,
+    -1.839624717e-02f, 3.227825217e-02f, -5.448757717e-02f, 9.235115394e-02f, -1.712274524e-01f, 4.840988764e-01f,
+    7.654522930e-01f, -2.027840808e-01f, 1.045863405e-01f, -6.111473303e-02f, 3.633059606e-02f, -2.094647011e-02f,
+    1.131493814e-02f, -5.510024478e-03f, 2.272500549e-03f, -6.831773157e-04f, -4.792661161e-04f, 1.798669620e-03f,
+    -4.592407819e-03f, 9.719991111e-03f, -1.834620664e-02f, 3.219325645e-02f, -5.434583097e-02f, 9.210597819e-02f,
+    -1.707272171e-01f, 4.819680369e-01f, 7.671876787e-01f, -2.026755155e-01f, 1.044918073e-01f, -6.105441263e-02f,
+    3.629535400e-02f, -2.092773315e-02f, 1.130627426e-02f, -5.506909729e-03f, 2.271980321e-03f, -6.835271123e-04f,
+    -4.771292288e-04f, 1.792376611e-03f, -4.578117370e-03f, 9.691903368e-03f, -1.829579810e-02f, 3.210760242e-02f,
+    -5.420296969e-02f, 9.185895587e-02f, -1.702239158e-01f, 4.798364889e-01f, 7.689183321e-01f, -2.025616879e-01f,
+    1.043945289e-01f, -6.099248391e-02f, 3.625915063e-02f, -2.090843722e-02f, 1.129730491e-02f, -5.503643903e-03f,
+    2.271396412e-03f, -6.838570385e-04f, -4.749874916e-04f, 1.786055031e-03f, -4.563743975e-03f, 9.663628596e-03f,
+    -1.824502349e-02f, 3.202129332e-02f, -5.405899866e-02f, 9.161009614e-02f, -1.697175670e-01f, 4.777042613e-01f,
+    7.706442282e-01f, -2.024425871e-01f, 1.042945028e-01f, -6.092894582e-02f, 3.622198527e-02f, -2.088858179e-02f,
+    1.128802969e-02f, -5.500226723e-03f, 2.270748646e-03f, -6.841669999e-04f, -4.728410036e-04f, 1.779705154e-03f,
+    -4.549288230e-03f, 9.635167925e-03f, -1.819388478e-02f, 3.193433239e-02f, -5.391392321e-02f, 9.135940817e-02f,
+    -1.692081891e-01f, 4.755713831e-01f, 7.723653416e-01f, -2.023182024e-01f, 1.041917265e-01f, -6.086379732e-02f,
+    3.618385729e-02f, -2.086816637e-02f, 1.127844822e-02f, -5.496657914e-03f, 2.270036848e-03f, -6.844569024e-04f,
+    -4.706898639e-04f, 1.773327255e-03f, -4.534750732e-03f, 9.606522486e-03f, -1.814238394e-02f, 3.184672291e-02f,
+    -5.376774871e-02f, 9.110690118e-02f, -1.686958007e-01f, 4.734378832e-01f, 7.740816475e-01f, -2.021885233e-01f,
+    1.040861975e-01f, -6.079703741e-02f, 3.614476604e-02f, -2.084719047e-02f, 1.126856012e-02f, -5.492937205e-03f,
+    2.269260843e-03f, -6.847266521e-04f, -4.685341712e-04f, 1.766921610e-03f, -4.520132079e-03f, 9.577693412e-03f,
+    -1.809052294e-02f, 3.175846815e-02f, -5.362048053e-02f, 9.085258441e-02f, -1.681804203e-01f, 4.713037905e-01f,
+    7.757931206e-01f, -2.020535393e-01f, 1.039779134e-01f, -6.072866514e-02f, 3.610471092e-02f, -2.082565364e-02f,
+    1.125836503e-02f, -5.489064328e-03f, 2.268420461e-03f, -6.849761556e-04f, -4.663740239e-04f, 1.760488492e-03f,
+    -4.505432869e-03f, 9.548681838e-03f, -1.803830376e-02f, 3.166957139e-02f, -5.347212406e-02f, 9.059646713e-02f,
+    -1.676620666e-01f, 4.691691339e-01f, 7.774997362e-01f, -2.019132399e-01f, 1.038668721e-01f, -6.065867960e-02f,
+    3.606369135e-02f, -2.080355540e-02f, 1.124786258e-02f, -5.485039020e-03f, 2.267515529e-03f, -6.852053198e-04f,
+    -4.642095204e-04f, 1.754028178e-03f, -4.490653701e-03f, 9.519488904e-03f, -1.798572839e-02f, 3.158003594e-02f,
+    -5.332268473e-02f, 9.033855863e-02f, -1.671407580e-01f, 4.670339423e-01f, 7.792014692e-01f, -2.017676147e-01f,
+    1.037530711e-01f, -6.058707990e-02f, 3.602170678e-02f, -2.078089532e-02f, 1.123705242e-02f, -5.480861020e-03f,
+    2.266545880e-03f, -6.854140519e-04f, -4.620407587e-04f, 1.747540940e-03f, -4.475795176e-03f, 9.490115750e-03f,
+    -1.793279881e-02f, 3.148986510e-02f, -5.317216796e-02f, 9.007886824e-02f, -1.666165132e-01f, 4.648982444e-01f,
+    7.808982949e-01f, -2.016166536e-01f, 1.036365084e-01f, -6.051386521e-02f, 3.597875665e-02f, -2.075767296e-02f,
+    1.122593420e-02f, -5.476530071e-03f, 2.265511344e-03f, -6.856022595e-04f, -4.598678366e-04f, 1.741027055e-03f,
+    -4.460857894e-03f, 9.460563520e-03f, -1.787951704e-02f, 3.139906218e-02f, -5.302057920e-02f, 8.981740530e-02f,
+    -1.660893509e-01f, 4.627620693e-01f, 7.825901884e-01f, -2.014603462e-01f, 1.035171818e-01f, -6.043903473e-02f,
+    3.593484048e-02f, -2.073388792e-02f, 1.121450759e-02f, -5.472045920e-03f, 2.264411755e-03f, -6.857698505e-04f,
+    -4.576908516e-04f, 1.734486797e-03f, -4.445842457e-03f, 9.430833359e-03f, -1.782588506e-02f, 3.130763053e-02f,
+    -5.286792392e-02f, 8.955417919e-02f, -1.655592897e-01f, 4.606254457e-01f, 7.842771252e-01f, -2.012986826e-01f,
+    1.033950892e-01f, -6.036258769e-02f, 3.588995775e-02f, -2.070953978e-02f, 1.120277225e-02f, -5.467408318e-03f,
+    2.263246948e-03f, -6.859167331e-04f, -4.555099011e-04f, 1.727920440e-03f, -4.430749466e-03f, 9.400926415e-03f,
+    -1.777190488e-02f, 3.121557348e-02f, -5.271420762e-02f, 8.928919931e-02f, -1.650263483e-01f, 4.584884025e-01f,
+    7.859590806e-01f, -2.011316526e-01f, 1.032702287e-01f, -6.028452336e-02f, 3.584410801e-02f, -2.068462817e-02f,
+    1.119072787e-02f, -5.462617018e-03f, 2.262016759e-03f, -6.860428162e-04f, -4.533250822e-04f, 1.721328260e-03f,
+    -4.415579525e-03f, 9.370843839e-03f, -1.771757852e-02f, 3.112289437e-02f, -5.255943578e-02f, 8.902247510e-02f,
+    -1.644905454e-01f, 4.563509685e-01f, 7.876360299e-01f, -2.009592463e-01f, 1.031425982e-01f, -6.020484106e-02f,
+    3.579729083e-02f, -2.065915270e-02f, 1.117837411e-02f, -5.457671777e-03f, 2.260721026e-03f, -6.861480085e-04f,
+    -4.511364917e-04f, 1.714710530e-03f, -4.400333236e-03f, 9.340586784e-03f, -1.766290800e-02f, 3.102959657e-02f,
+    -5.240361394e-02f, 8.875401599e-02f, -1.639518999e-01f, 4.542131724e-01f, 7.893079487e-01f, -2.007814538e-01f,
+    1.030121960e-01f, -6.012354015e-02f, 3.574950577e-02f, -2.063311302e-02f, 1.116571068e-02f, -5.452572358e-03f,
+    2.259359588e-03f, -6.862322196e-04f, -4.489442261e-04f, 1.708067525e-03f, -4.385011204e-03f, 9.310156403e-03f,
+    -1.760789533e-02f, 3.093568345e-02f, -5.224674762e-02f, 8.848383148e-02f, -1.634104303e-01f, 4.520750431e-01f,
+    7.909748126e-01f, -2.005982654e-01f, 1.028790202e-01f, -6.004062001e-02f, 3.570075244e-02f, -2.060650877e-02f,
+    1.115273727e-02f, -5.447318524e-03f, 2.257932285e-03f, -6.862953592e-04f, -4.467483818e-04f, 1.701399520e-03f,
+    -4.369614033e-03f, 9.279553854e-03f, -1.755254255e-02f, 3.084115839e-02f, -5.208884239e-02f, 8.821193106e-02f,
+    -1.628661555e-01f, 4.499366093e-01f, 7.926365971e-01f, -2.004096713e-01f, 1.027430690e-01f, -5.995608007e-02f,
+    3.565103048e-02f, -2.057933964e-02f, 1.113945359e-02f, -5.441910044e-03f, 2.256438960e-03f, -6.863373374e-04f,
+    -4.445490549e-04f, 1.694706789e-03f, -4.354142329e-03f, 9.248780296e-03f, -1.749685170e-02f, 3.074602477e-02f,
+    -5.192990382e-02f, 8.793832427e-02f, -1.623190943e-01f, 4.477978998e-01f, 7.942932780e-01f, -2.002156620e-01f,
+    1.026043407e-01f, -5.986991980e-02f, 3.560033954e-02f, -2.055160529e-02f, 1.112585935e-02f, -5.436346691e-03f,
+    2.254879455e-03f, -6.863580647e-04f, -4.423463411e-04f, 1.687989606e-03f, -4.338596697e-03f, 9.217836891e-03f,
+    -1.744082480e-02f, 3.065028600e-02f, -5.176993749e-02f, 8.766302066e-02f, -1.617692656e-01f, 4.456589433e-01f,
+    7.959448311e-01f, -2.000162278e-01f, 1.024628338e-01f, -5.978213871e-02f, 3.554867929e-02f, -2.052330542e-02f,
+    1.111195427e-02f, -5.430628240e-03f, 2.253253617e-03f, -6.863574521e-04f, -4.401403360e-04f, 1.681248245e-03f,
+    -4.322977744e-03f, 9.186724802e-03f, -1.738446390e-02f, 3.055394549e-02f, -5.160894901e-02f, 8.738602981e-02f,
+    -1.612166880e-01f, 4.435197685e-01f, 7.975912321e-01f, -1.998113593e-01f, 1.023185466e-01f, -5.969273634e-02f,
+    3.549604943e-02f, -2.049443974e-02f, 1.109773809e-02f, -5.424754470e-03f, 2.251561291e-03f, -6.863354109e-04f,
+    -4.379311350e-04f, 1.674482979e-03f, -4.307286076e-03f, 9.155445193e-03f, -1.732777106e-02f, 3.045700665e-02f,
+    -5.144694401e-02f, 8.710736132e-02f, -1.606613806e-01f, 4.413804041e-01f, 7.992324569e-01f, -1.996010471e-01f,
+    1.021714776e-01f, -5.960171229e-02f, 3.544244969e-02f, -2.046500797e-02f, 1.108321053e-02f, -5.418725165e-03f,
+    2.249802326e-03f, -6.862918528e-04f, -4.357188329e-04f, 1.667694084e-03f, -4.291522301e-03f, 9.123999234e-03f,
+    -1.727074832e-02f, 3.035947292e-02f, -5.128392811e-02f, 8.682702482e-02f, -1.601033622e-01f, 4.392408788e-01f,
+    8.008684816e-01f, -1.993852820e-01f, 1.020216254e-01f, -5.950906617e-02f, 3.538787982e-02f, -2.043500985e-02f,
+    1.106837134e-02f, -5.412540111e-03f, 2.247976570e-03f, -6.862266898e-04f, -4.335035247e-04f, 1.660881832e-03f,
+    -4.275687026e-03f, 9.092388092e-03f, -1.721339774e-02f, 3.026134772e-02f, -5.111990697e-02f, 8.654502996e-02f,
+    -1.595426516e-01f, 4.371012212e-01f, 8.024992822e-01f, -1.991640547e-01f, 1.018689886e-01f, -5.941479765e-02f,
+    3.533233959e-02f, -2.040444513e-02f, 1.105322028e-02f, -5.406199100e-03f, 2.246083875e-03f, -6.861398344e-04f,
+    -4.312853047e-04f, 1.654046498e-03f, -4.259780860e-03f, 9.060612940e-03f, -1.715572138e-02f, 3.016263452e-02f,
+    -5.095488627e-02f, 8.626138642e-02f, -1.589792678e-01f, 4.349614599e-01f, 8.041248347e-01f, -1.989373562e-01f,
+    1.017135659e-01f, -5.931890643e-02f, 3.527582880e-02f, -2.037331358e-02f, 1.103775710e-02f, -5.399701927e-03f,
+    2.244124094e-03f, -6.860311997e-04f, -4.290642671e-04f, 1.647188353e-03f, -4.243804412e-03f, 9.028674950e-03f,
+    -1.709772132e-02f, 3.006333676e-02f, -5.078887168e-02f, 8.597610389e-02f, -1.584132297e-01f, 4.328216237e-01f,
+    8.057451153e-01f, -1.987051773e-01f, 1.015553561e-01f, -5.922139225e-02f, 3.521834726e-02f, -2.034161497e-02f,
+    1.102198158e-02f, -5.393048388e-03f, 2.242097080e-03f, -6.859006989e-04f, -4.268405059e-04f, 1.640307673e-03f,
+    -4.227758291e-03f, 8.996575298e-03f, -1.703939962e-02f, 2.996345790e-02f, -5.062186891e-02f, 8.568919209e-02f,
+    -1.578445563e-01f, 4.306817410e-01f, 8.073601004e-01f, -1.984675090e-01f, 1.013943578e-01f, -5.912225490e-02f,
+    3.515989482e-02f, -2.030934910e-02f, 1.100589347e-02f, -5.386238286e-03f, 2.240002688e-03f, -6.857482458e-04f,
+    -4.246141148e-04f, 1.633404730e-03f, -4.211643106e-03f, 8.964315160e-03f, -1.698075836e-02f, 2.986300143e-02f,
+    -5.045388368e-02f, 8.540066076e-02f, -1.572732665e-01f, 4.285418405e-01f, 8.089697661e-01f, -1.982243427e-01f,
+    1.012305701e-01f, -5.902149420e-02f, 3.510047135e-02f, -2.027651578e-02f, 1.098949258e-02f, -5.379271428e-03f,
+    2.237840777e-03f, -6.855737545e-04f, -4.223851871e-04f, 1.626479796e-03f, -4.195459468e-03f, 8.931895716e-03f,
+    -1.692179963e-02f, 2.976197083e-02f, -5.028492171e-02f, 8.511051968e-02f, -1.566993793e-01f, 4.264019507e-01f,
+    8.105740889e-01f, -1.979756693e-01f, 1.010639919e-01f, -5.891911001e-02f, 3.504007675e-02f, -2.024311482e-02f,
+    1.097277868e-02f, -5.372147622e-03f, 2.235611205e-03f, -6.853771396e-04f, -4.201538159e-04f, 1.619533145e-03f,
+    -4.179207987e-03f, 8.899318146e-03f, -1.686252550e-02f, 2.966036958e-02f, -5.011498875e-02f, 8.481877862e-02f,
+    -1.561229137e-01f, 4.242621002e-01f, 8.121730453e-01f, -1.977214803e-01f, 1.008946220e-01f, -5.881510223e-02f,
+    3.497871092e-02f, -2.020914606e-02f, 1.095575158e-02f, -5.364866682e-03f, 2.233313831e-03f, -6.851583163e-04f,
+    -4.179200939e-04f, 1.612565050e-03f, -4.162889274e-03f, 8.866583631e-03f, -1.680293806e-02f, 2.955820119e-02f,
+    -4.994409056e-02f, 8.452544740e-02f, -1.555438887e-01f, 4.221223173e-01f, 8.137666118e-01f, -1.974617671e-01f,
+    1.007224597e-01f, -5.870947079e-02f, 3.491637381e-02f, -2.017460935e-02f, 1.093841108e-02f, -5.357428426e-03f,
+    2.230948519e-03f, -6.849171998e-04f, -4.156841138e-04f, 1.605575781e-03f, -4.146503939e-03f, 8.833693357e-03f,
+    -1.674303942e-02f, 2.945546916e-02f, -4.977223292e-02f, 8.423053584e-02f, -1.549623233e-01f, 4.199826307e-01f,
+    8.153547649e-01f, -1.971965210e-01f, 1.005475040e-01f, -5.860221569e-02f, 3.485306539e-02f, -2.013950456e-02f,
+    1.092075700e-02f, -5.349832674e-03f, 2.228515130e-03f, -6.846537062e-04f, -4.134459678e-04f, 1.598565613e-03f,
+    -4.130052595e-03f, 8.800648509e-03f, -1.668283166e-02f, 2.935217702e-02f, -4.959942163e-02f, 8.393405381e-02f,
+    -1.543782366e-01f, 4.178430688e-01f, 8.169374814e-01f, -1.969257336e-01f, 1.003697541e-01f, -5.849333693e-02f,
+    3.478878565e-02f, -2.010383157e-02f, 1.090278916e-02f, -5.342079252e-03f, 2.226013531e-03f, -6.843677519e-04f,
+    -4.112057477e-04f, 1.591534816e-03f, -4.113535853e-03f, 8.767450274e-03f, -1.662231689e-02f, 2.924832829e-02f,
+    -4.942566247e-02f, 8.363601117e-02f, -1.537916477e-01f, 4.157036600e-01f, 8.185147380e-01f, -1.966493967e-01f,
+    1.001892093e-01f, -5.838283459e-02f, 3.472353459e-02f, -2.006759026e-02f, 1.088450738e-02f, -5.334167988e-03f,
+    2.223443588e-03f, -6.840592535e-04f, -4.089635452e-04f, 1.584483662e-03f, -4.096954326e-03f, 8.734099840e-03f,
+    -1.656149722e-02f, 2.914392650e-02f, -4.925096128e-02f, 8.333641781e-02f, -1.532025755e-01f, 4.135644327e-01f,
+    8.200865115e-01f, -1.963675018e-01f, 1.000058689e-01f, -5.827070875e-02f, 3.465731227e-02f, -2.003078055e-02f,
+    1.086591151e-02f, -5.326098716e-03f, 2.220805168e-03f, -6.837281284e-04f, -4.067194517e-04f, 1.577412424e-03f,
+    -4.080308625e-03f, 8.700598399e-03f, -1.650037476e-02f, 2.903897519e-02f, -4.907532389e-02f, 8.303528366e-02f,
+    -1.526110393e-01f, 4.114254153e-01f, 8.216527789e-01f, -1.960800409e-01f, 9.981973219e-02f, -5.815695956e-02f,
+    3.459011873e-02f, -1.999340236e-02f, 1.084700139e-02f, -5.317871273e-03f, 2.218098143e-03f, -6.833742943e-04f,
+    -4.044735581e-04f, 1.570321371e-03f, -4.063599363e-03f, 8.666947141e-03f, -1.643895162e-02f, 2.893347792e-02f,
+    -4.889875613e-02f, 8.273261865e-02f, -1.520170580e-01f, 4.092866362e-01f, 8.232135171e-01f, -1.957870057e-01f,
+    9.963079874e-02f, -5.804158720e-02f, 3.452195408e-02f, -1.995545561e-02f, 1.082777688e-02f, -5.309485498e-03f,
+    2.215322382e-03f, -6.829976693e-04f, -4.022259553e-04f, 1.563210776e-03f, -4.046827153e-03f, 8.633147261e-03f,
+    -1.637722992e-02f, 2.882743825e-02f, -4.872126389e-02f, 8.242843272e-02f, -1.514206509e-01f, 4.071481237e-01f,
+    8.247687031e-01f, -1.954883884e-01f, 9.943906800e-02f, -5.792459188e-02f, 3.445281842e-02f, -1.991694028e-02f,
+    1.080823783e-02f, -5.300941236e-03f, 2.212477760e-03f, -6.825981721e-04f, -3.999767336e-04f, 1.556080909e-03f,
+    -4.029992608e-03f, 8.599199954e-03f, -1.631521178e-02f, 2.872085972e-02f, -4.854285302e-02f, 8.212273586e-02f,
+    -1.508218369e-01f, 4.050099061e-01f, 8.263183141e-01f, -1.951841810e-01f, 9.924453955e-02f, -5.780597387e-02f,
+    3.438271188e-02f, -1.987785631e-02f, 1.078838411e-02f, -5.292238337e-03f, 2.209564151e-03f, -6.821757219e-04f,
+    -3.977259832e-04f, 1.548932040e-03f, -4.013096342e-03f, 8.565106415e-03f, -1.625289933e-02f, 2.861374593e-02f,
+    -4.836352942e-02f, 8.181553806e-02f, -1.502206354e-01f, 4.028720117e-01f, 8.278623272e-01f, -1.948743756e-01f,
+    9.904721305e-02f, -5.768573347e-02f, 3.431163464e-02f, -1.983820369e-02f, 1.076821561e-02f, -5.283376652e-03f,
+    2.206581431e-03f, -6.817302381e-04f, -3.954737939e-04f, 1.541764440e-03f, -3.996138968e-03f, 8.530867842e-03f,
+    -1.619029470e-02f, 2.850610046e-02f, -4.818329898e-02f, 8.150684934e-02f, -1.496170653e-01f, 4.007344687e-01f,
+    8.294007199e-01f, -1.945589645e-01f, 9.884708818e-02f, -5.756387102e-02f, 3.423958687e-02f, -1.979798242e-02f,
+    1.074773220e-02f, -5.274356038e-03f, 2.203529478e-03f, -6.812616409e-04f, -3.932202553e-04f, 1.534578379e-03f,
+    -3.979121099e-03f, 8.496485434e-03f, -1.612740002e-02f, 2.839792688e-02f, -4.800216763e-02f, 8.119667972e-02f,
+    -1.490111459e-01f, 3.985973054e-01f, 8.309334693e-01f, -1.942379400e-01f, 9.864416473e-02f, -5.744038689e-02f,
+    3.416656879e-02f, -1.975719249e-02f, 1.072693378e-02f, -5.265176356e-03f, 2.200408172e-03f, -6.807698508e-04f,
+    -3.909654564e-04f, 1.527374127e-03f, -3.962043349e-03f, 8.461960392e-03f, -1.606421742e-02f, 2.828922880e-02f,
+    -4.782014129e-02f, 8.088503925e-02f, -1.484028964e-01f, 3.964605500e-01f, 8.324605529e-01f, -1.939112946e-01f,
+    9.843844251e-02f, -5.731528151e-02f, 3.409258064e-02f, -1.971583394e-02f, 1.070582026e-02f, -5.255837470e-03f,
+    2.197217395e-03f, -6.802547888e-04f, -3.887094863e-04f, 1.520151952e-03f, -3.944906333e-03f, 8.427293916e-03f,
+    -1.600074906e-02f, 2.818000982e-02f, -4.763722589e-02f, 8.057193802e-02f, -1.477923359e-01f, 3.943242306e-01f,
+    8.339819482e-01f, -1.935790208e-01f, 9.822992144e-02f, -5.718855534e-02f, 3.401762266e-02f, -1.967390680e-02f,
+    1.068439154e-02f, -5.246339248e-03f, 2.193957029e-03f, -6.797163766e-04f, -3.864524334e-04f, 1.512912125e-03f,
+    -3.927710664e-03f, 8.392487211e-03f, -1.593699706e-02f, 2.807027355e-02f, -4.745342740e-02f, 8.025738609e-02f,
+    -1.471794836e-01f, 3.921883753e-01f, 8.354976329e-01f, -1.932411111e-01f, 9.801860148e-02f, -5.706020889e-02f,
+    3.394169515e-02f, -1.963141113e-02f, 1.066264754e-02f, -5.236681564e-03f, 2.190626959e-03f, -6.791545360e-04f,
+    -3.841943859e-04f, 1.505654914e-03f, -3.910456957e-03f, 8.357541479e-03f, -1.587296359e-02f, 2.796002361e-02f,
+    -4.726875177e-02f, 7.994139359e-02f, -1.465643587e-01f, 3.900530124e-01f, 8.370075846e-01f, -1.928975583e-01f,
+    9.780448266e-02f, -5.693024269e-02f, 3.386479842e-02f, -1.958834700e-02f, 1.064058818e-02f, -5.226864293e-03f,
+    2.187227072e-03f, -6.785691897e-04f, -3.819354319e-04f, 1.498380587e-03f, -3.893145825e-03f, 8.322457927e-03f,
+    -1.580865078e-02f, 2.784926362e-02f, -4.708320498e-02f, 7.962397062e-02f, -1.459469804e-01f, 3.879181698e-01f,
+    8.385117809e-01f, -1.925483552e-01f, 9.758756508e-02f, -5.679865732e-02f, 3.378693280e-02f, -1.954471447e-02f,
+    1.061821341e-02f, -5.216887317e-03f, 2.183757255e-03f, -6.779602607e-04f, -3.796756590e-04f, 1.491089413e-03f,
+    -3.875777883e-03f, 8.287237759e-03f, -1.574406080e-02f, 2.773799721e-02f, -4.689679302e-02f, 7.930512734e-02f,
+    -1.453273679e-01f, 3.857838755e-01f, 8.400101998e-01f, -1.921934946e-01f, 9.736784889e-02f, -5.666545342e-02f,
+    3.370809865e-02f, -1.950051366e-02f, 1.059552315e-02f, -5.206750520e-03f, 2.180217399e-03f, -6.773276725e-04f,
+    -3.774151543e-04f, 1.483781660e-03f, -3.858353746e-03f, 8.251882185e-03f, -1.567919580e-02f, 2.762622803e-02f,
+    -4.670952190e-02f, 7.898487390e-02f, -1.447055406e-01f, 3.836501577e-01f, 8.415028192e-01f, -1.918329695e-01f,
+    9.714533433e-02f, -5.653063164e-02f, 3.362829636e-02f, -1.945574467e-02f, 1.057251737e-02f, -5.196453791e-03f,
+    2.176607394e-03f, -6.766713492e-04f, -3.751540048e-04f, 1.476457594e-03f, -3.840874027e-03f, 8.216392411e-03f,
+    -1.561405794e-02f, 2.751395971e-02f, -4.652139762e-02f, 7.866322047e-02f, -1.440815175e-01f, 3.815170443e-01f,
+    8.429896169e-01f, -1.914667729e-01f, 9.692002168e-02f, -5.639419270e-02f, 3.354752633e-02f, -1.941040763e-02f,
+    1.054919601e-02f, -5.185997022e-03f, 2.172927135e-03f, -6.759912153e-04f, -3.728922972e-04f, 1.469117485e-03f,
+    -3.823339341e-03f, 8.180769649e-03f, -1.554864939e-02f, 2.740119591e-02f, -4.633242621e-02f, 7.834017725e-02f,
+    -1.434553180e-01f, 3.793845632e-01f, 8.444705712e-01f, -1.910948980e-01f, 9.669191131e-02f, -5.625613733e-02f,
+    3.346578900e-02f, -1.936450268e-02f, 1.052555905e-02f, -5.175380111e-03f, 2.169176516e-03f, -6.752871960e-04f,
+    -3.706301178e-04f, 1.461761598e-03f, -3.805750303e-03f, 8.145015108e-03f, -1.548297231e-02f, 2.728794028e-02f,
+    -4.614261371e-02f, 7.801575443e-02f, -1.428269613e-01f, 3.772527424e-01f, 8.459456600e-01f, -1.907173380e-01f,
+    9.646100364e-02f, -5.611646632e-02f, 3.338308483e-02f, -1.931802997e-02f, 1.050160647e-02f, -5.164602960e-03f,
+    2.165355434e-03f, -6.745592169e-04f, -3.683675524e-04f, 1.454390199e-03f, -3.788107526e-03f, 8.109129999e-03f,
+    -1.541702886e-02f, 2.717419650e-02f, -4.595196615e-02f, 7.768996226e-02f, -1.421964667e-01f, 3.751216097e-01f,
+    8.474148617e-01f, -1.903340862e-01f, 9.622729917e-02f, -5.597518050e-02f, 3.329941430e-02f, -1.927098968e-02f,
+    1.047733823e-02f, -5.153665472e-03f, 2.161463787e-03f, -6.738072041e-04f, -3.661046868e-04f, 1.447003556e-03f,
+    -3.770411626e-03f, 8.073115536e-03f, -1.535082123e-02f, 2.705996822e-02f, -4.576048961e-02f, 7.736281096e-02f,
+    -1.415638534e-01f, 3.729911930e-01f, 8.488781546e-01f, -1.899451361e-01f, 9.599079845e-02f, -5.583228074e-02f,
+    3.321477792e-02f, -1.922338199e-02f, 1.045275434e-02f, -5.142567558e-03f, 2.157501476e-03f, -6.730310843e-04f,
+    -3.638416061e-04f, 1.439601933e-03f, -3.752663216e-03f, 8.036972931e-03f, -1.528435159e-02f, 2.694525914e-02f,
+    -4.556819014e-02f, 7.703431078e-02f, -1.409291407e-01f, 3.708615202e-01f, 8.503355170e-01f, -1.895504812e-01f,
+    9.575150210e-02f, -5.568776795e-02f, 3.312917622e-02f, -1.917520710e-02f, 1.042785480e-02f, -5.131309130e-03f,
+    2.153468403e-03f, -6.722307848e-04f, -3.615783954e-04f, 1.432185597e-03f, -3.734862910e-03f, 8.000703399e-03f,
+    -1.521762212e-02f, 2.683007292e-02f, -4.537507384e-02f, 7.670447201e-02f, -1.402923479e-01f, 3.687326189e-01f,
+    8.517869273e-01f, -1.891501150e-01f, 9.550941082e-02f, -5.554164308e-02f, 3.304260977e-02f, -1.912646523e-02f,
+    1.040263961e-02f, -5.119890108e-03f, 2.149364472e-03f, -6.714062333e-04f, -3.593151392e-04f, 1.424754812e-03f,
+    -3.717011323e-03f, 7.964308154e-03f, -1.515063499e-02f, 2.671441326e-02f, -4.518114678e-02f, 7.637330492e-02f,
+    -1.396534942e-01f, 3.666045169e-01f, 8.532323642e-01f, -1.887440313e-01f, 9.526452536e-02f, -5.539390712e-02f,
+    3.295507915e-02f, -1.907715660e-02f, 1.037710879e-02f, -5.108310412e-03f, 2.145189587e-03f, -6.705573582e-04f,
+    -3.570519217e-04f, 1.417309844e-03f, -3.699109069e-03f, 7.927788413e-03f, -1.508339239e-02f, 2.659828386e-02f,
+    -4.498641507e-02f, 7.604081981e-02f, -1.390125990e-01f, 3.644772421e-01f, 8.546718063e-01f, -1.883322238e-01f,
+    9.501684655e-02f, -5.524456110e-02f, 3.286658497e-02f, -1.902728147e-02f, 1.035126236e-02f, -5.096569969e-03f,
+    2.140943657e-03f, -6.696840883e-04f, -3.547888270e-04f, 1.409850955e-03f, -3.681156761e-03f, 7.891145392e-03f,
+    -1.501589650e-02f, 2.648168841e-02f, -4.479088482e-02f, 7.570702700e-02f, -1.383696815e-01f, 3.623508219e-01f,
+    8.561052323e-01f, -1.879146864e-01f, 9.476637527e-02f, -5.509360609e-02f, 3.277712786e-02f, -1.897684008e-02f,
+    1.032510035e-02f, -5.084668708e-03f, 2.136626591e-03f, -6.687863530e-04f, -3.525259385e-04f, 1.402378411e-03f,
+    -3.663155014e-03f, 7.854380308e-03f, -1.494814953e-02f, 2.636463062e-02f, -4.459456215e-02f, 7.537193681e-02f,
+    -1.377247611e-01f, 3.602252841e-01f, 8.575326210e-01f, -1.874914130e-01f, 9.451311249e-02f, -5.494104321e-02f,
+    3.268670848e-02f, -1.892583272e-02f, 1.029862282e-02f, -5.072606565e-03f, 2.132238299e-03f, -6.678640825e-04f,
+    -3.502633394e-04f, 1.394892475e-03f, -3.645104440e-03f, 7.817494379e-03f, -1.488015364e-02f, 2.624711420e-02f,
+    -4.439745319e-02f, 7.503555959e-02f, -1.370778570e-01f, 3.581006563e-01f, 8.589539512e-01f, -1.870623978e-01f,
+    9.425705922e-02f, -5.478687362e-02f, 3.259532753e-02f, -1.887425968e-02f, 1.027182980e-02f, -5.060383478e-03f,
+    2.127778695e-03f, -6.669172071e-04f, -3.480011127e-04f, 1.387393409e-03f, -3.627005654e-03f, 7.780488825e-03f,
+    -1.481191105e-02f, 2.612914287e-02f, -4.419956409e-02f, 7.469790569e-02f, -1.364289886e-01f, 3.559769660e-01f,
+    8.603692021e-01f, -1.866276349e-01f, 9.399821656e-02f, -5.463109852e-02f, 3.250298570e-02f, -1.882212126e-02f,
+    1.024472135e-02f, -5.047999390e-03f, 2.123247693e-03f, -6.659456581e-04f, -3.457393408e-04f, 1.379881477e-03f,
+    -3.608859268e-03f, 7.743364863e-03f, -1.474342394e-02f, 2.601072035e-02f, -4.400090099e-02f, 7.435898548e-02f,
+    -1.357781751e-01f, 3.538542408e-01f, 8.617783525e-01f, -1.861871185e-01f, 9.373658566e-02f, -5.447371913e-02f,
+    3.240968374e-02f, -1.876941777e-02f, 1.021729754e-02f, -5.035454248e-03f, 2.118645210e-03f, -6.649493671e-04f,
+    -3.434781059e-04f, 1.372356940e-03f, -3.590665895e-03f, 7.706123714e-03f, -1.467469452e-02f, 2.589185037e-02f,
+    -4.380147004e-02f, 7.401880935e-02f, -1.351254359e-01f, 3.517325081e-01f, 8.631813816e-01f, -1.857408429e-01f,
+    9.347216776e-02f, -5.431473675e-02f, 3.231542240e-02f, -1.871614956e-02f, 1.018955845e-02f, -5.022748004e-03f,
+    2.113971163e-03f, -6.639282664e-04f, -3.412174898e-04f, 1.364820061e-03f, -3.572426149e-03f, 7.668766598e-03f,
+    -1.460572497e-02f, 2.577253666e-02f, -4.360127743e-02f, 7.367738768e-02f, -1.344707902e-01f, 3.496117955e-01f,
+    8.645782688e-01f, -1.852888026e-01f, 9.320496414e-02f, -5.415415268e-02f, 3.222020248e-02f, -1.866231697e-02f,
+    1.016150416e-02f, -5.009880613e-03f, 2.109225473e-03f, -6.628822889e-04f, -3.389575739e-04f, 1.357271100e-03f,
+    -3.554140641e-03f, 7.631294736e-03f, -1.453651752e-02f, 2.565278296e-02f, -4.340032933e-02f, 7.333473089e-02f,
+    -1.338142575e-01f, 3.474921302e-01f, 8.659689932e-01f, -1.848309922e-01f, 9.293497616e-02f, -5.399196830e-02f,
+    3.212402478e-02f, -1.860792038e-02f, 1.013313475e-02f, -4.996852035e-03f, 2.104408062e-03f, -6.618113680e-04f,
+    -3.366984394e-04f, 1.349710319e-03f, -3.535809984e-03f, 7.593709350e-03f, -1.446707435e-02f, 2.553259301e-02f,
+    -4.319863192e-02f, 7.299084939e-02f, -1.331558570e-01f, 3.453735397e-01f, 8.673535343e-01f, -1.843674062e-01f,
+    9.266220526e-02f, -5.382818501e-02f, 3.202689014e-02f, -1.855296015e-02f, 1.010445034e-02f, -4.983662235e-03f,
+    2.099518853e-03f, -6.607154378e-04f, -3.344401669e-04f, 1.342137978e-03f, -3.517434789e-03f, 7.556011661e-03f,
+    -1.439739768e-02f, 2.541197056e-02f, -4.299619141e-02f, 7.264575363e-02f, -1.324956080e-01f, 3.432560514e-01f,
+    8.687318715e-01f, -1.838980393e-01f, 9.238665291e-02f, -5.366280424e-02f, 3.192879943e-02f, -1.849743668e-02f,
+    1.007545102e-02f, -4.970311180e-03f, 2.094557773e-03f, -6.595944328e-04f, -3.321828367e-04f, 1.334554337e-03f,
+    -3.499015670e-03f, 7.518202891e-03f, -1.432748971e-02f, 2.529091936e-02f, -4.279301399e-02f, 7.229945403e-02f,
+    -1.318335298e-01f, 3.411396924e-01f, 8.701039845e-01f, -1.834228864e-01f, 9.210832070e-02f, -5.349582750e-02f,
+    3.182975353e-02f, -1.844135039e-02f, 1.004613692e-02f, -4.956798844e-03f, 2.089524749e-03f, -6.584482884e-04f,
+    -3.299265290e-04f, 1.326959655e-03f, -3.480553236e-03f, 7.480284264e-03f, -1.425735267e-02f, 2.516944316e-02f,
+    -4.258910587e-02f, 7.195196106e-02f, -1.311696418e-01f, 3.390244901e-01f, 8.714698529e-01f, -1.829419423e-01f,
+    9.182721023e-02f, -5.332725630e-02f, 3.172975335e-02f, -1.838470170e-02f, 1.001650815e-02f, -4.943125205e-03f,
+    2.084419710e-03f, -6.572769403e-04f, -3.276713233e-04f, 1.319354192e-03f, -3.462048099e-03f, 7.442257002e-03f,
+    -1.418698875e-02f, 2.504754574e-02f, -4.238447328e-02f, 7.160328519e-02f, -1.305039633e-01f, 3.369104717e-01f,
+    8.728294564e-01f, -1.824552021e-01f, 9.154332323e-02f, -5.315709222e-02f, 3.162879983e-02f, -1.832749105e-02f,
+    9.986564862e-03f, -4.929290243e-03f, 2.079242587e-03f, -6.560803250e-04f, -3.254172988e-04f, 1.311738206e-03f,
+    -3.443500870e-03f, 7.404122328e-03f, -1.411640017e-02f, 2.492523085e-02f, -4.217912246e-02f, 7.125343688e-02f,
+    -1.298365137e-01f, 3.347976643e-01f, 8.741827749e-01f, -1.819626608e-01f, 9.125666143e-02f, -5.298533687e-02f,
+    3.152689394e-02f, -1.826971890e-02f, 9.956307187e-03f, -4.915293944e-03f, 2.073993315e-03f, -6.548583795e-04f,
+    -3.231645346e-04f, 1.304111955e-03f, -3.424912159e-03f, 7.365881466e-03f, -1.404558915e-02f, 2.480250227e-02f,
+    -4.197305962e-02f, 7.090242664e-02f, -1.291673121e-01f, 3.326860950e-01f, 8.755297884e-01f, -1.814643137e-01f,
+    9.096722669e-02f, -5.281199189e-02f, 3.142403667e-02f, -1.821138570e-02f, 9.925735278e-03f, -4.901136299e-03f,
+    2.068671827e-03f, -6.536110415e-04f, -3.209131090e-04f, 1.296475696e-03f, -3.406282576e-03f, 7.327535640e-03f,
+    -1.397455791e-02f, 2.467936377e-02f, -4.176629102e-02f, 7.055026495e-02f, -1.284963780e-01f, 3.305757910e-01f,
+    8.768704767e-01f, -1.809601559e-01f, 9.067502091e-02f, -5.263705899e-02f, 3.132022902e-02f, -1.815249197e-02f,
+    9.894849295e-03f, -4.886817301e-03f, 2.063278062e-03f, -6.523382493e-04f, -3.186631002e-04f, 1.288829687e-03f,
+    -3.387612731e-03f, 7.289086074e-03f, -1.390330867e-02f, 2.455581912e-02f, -4.155882292e-02f, 7.019696233e-02f,
+    -1.278237306e-01f, 3.284667792e-01f, 8.782048201e-01f, -1.804501830e-01f, 9.038004604e-02f, -5.246053990e-02f,
+    3.121547205e-02f, -1.809303818e-02f, 9.863649406e-03f, -4.872336951e-03f, 2.057811957e-03f, -6.510399418e-04f,
+    -3.164145861e-04f, 1.281174184e-03f, -3.368903232e-03f, 7.250533992e-03f, -1.383184364e-02f, 2.443187212e-02f,
+    -4.135066156e-02f, 6.984252930e-02f, -1.271493894e-01f, 3.263590867e-01f, 8.795327987e-01f, -1.799343902e-01f,
+    9.008230413e-02f, -5.228243639e-02f, 3.110976682e-02f, -1.803302486e-02f, 9.832135787e-03f, -4.857695252e-03f,
+    2.052273454e-03f, -6.497160585e-04f, -3.141676439e-04f, 1.273509444e-03f, -3.350154689e-03f, 7.211880618e-03f,
+    -1.376016505e-02f, 2.430752654e-02f, -4.114181322e-02f, 6.948697638e-02f, -1.264733735e-01f, 3.242527404e-01f,
+    8.808543928e-01f, -1.794127734e-01f, 8.978179728e-02f, -5.210275028e-02f, 3.100311441e-02f, -1.797245255e-02f,
+    9.800308624e-03f, -4.842892210e-03f, 2.046662495e-03f, -6.483665396e-04f, -3.119223508e-04f, 1.265835721e-03f,
+    -3.331367710e-03f, 7.173127177e-03f, -1.368827513e-02f, 2.418278618e-02f, -4.093228417e-02f, 6.913031412e-02f,
+    -1.257957023e-01f, 3.221477673e-01f, 8.821695828e-01f, -1.788853280e-01f, 8.947852766e-02f, -5.192148344e-02f,
+    3.089551595e-02f, -1.791132178e-02f, 9.768168109e-03f, -4.827927838e-03f, 2.040979026e-03f, -6.469913259e-04f,
+    -3.096787833e-04f, 1.258153271e-03f, -3.312542902e-03f, 7.134274894e-03f, -1.361617609e-02f, 2.405765483e-02f,
+    -4.072208069e-02f, 6.877255305e-02f, -1.251163951e-01f, 3.200441941e-01f, 8.834783491e-01f, -1.783520498e-01f,
+    8.917249752e-02f, -5.173863777e-02f, 3.078697258e-02f, -1.784963312e-02f, 9.735714445e-03f, -4.812802153e-03f,
+    2.035222992e-03f, -6.455903588e-04f, -3.074370177e-04f, 1.250462348e-03f, -3.293680873e-03f, 7.095324992e-03f,
+    -1.354387017e-02f, 2.393213628e-02f, -4.051120907e-02f, 6.841370374e-02f, -1.244354712e-01f, 3.179420477e-01f,
+    8.847806723e-01f, -1.778129348e-01f, 8.886370917e-02f, -5.155421521e-02f, 3.067748547e-02f, -1.778738715e-02f,
+    9.702947843e-03f, -4.797515175e-03f, 2.029394343e-03f, -6.441635805e-04f, -3.051971300e-04f, 1.242763206e-03f,
+    -3.274782231e-03f, 7.056278697e-03f, -1.347135959e-02f, 2.380623435e-02f, -4.029967560e-02f, 6.805377676e-02f,
+    -1.237529499e-01f, 3.158413549e-01f, 8.860765331e-01f, -1.772679788e-01f, 8.855216498e-02f, -5.136821775e-02f,
+    3.056705580e-02f, -1.772458446e-02f, 9.669868522e-03f, -4.782066930e-03f, 2.023493029e-03f, -6.427109336e-04f,
+    -3.029591955e-04f, 1.235056098e-03f, -3.255847580e-03f, 7.017137234e-03f, -1.339864658e-02f, 2.367995283e-02f,
+    -4.008748659e-02f, 6.769278266e-02f, -1.230688505e-01f, 3.137421424e-01f, 8.873659121e-01f, -1.767171779e-01f,
+    8.823786740e-02f, -5.118064741e-02f, 3.045568481e-02f, -1.766122566e-02f, 9.636476710e-03f, -4.766457448e-03f,
+    2.017519002e-03f, -6.412323615e-04f, -3.007232895e-04f, 1.227341278e-03f, -3.236877528e-03f, 6.977901827e-03f,
+    -1.332573337e-02f, 2.355329553e-02f, -3.987464833e-02f, 6.733073205e-02f, -1.223831923e-01f, 3.116444368e-01f,
+    8.886487903e-01f, -1.761605283e-01f, 8.792081894e-02f, -5.099150626e-02f, 3.034337372e-02f, -1.759731136e-02f,
+    9.602772645e-03f, -4.750686762e-03f, 2.011472217e-03f, -6.397278083e-04f, -2.984894865e-04f, 1.219618997e-03f,
+    -3.217872679e-03f, 6.938573699e-03f, -1.325262220e-02f, 2.342626626e-02f, -3.966116715e-02f, 6.696763550e-02f,
+    -1.216959946e-01f, 3.095482649e-01f, 8.899251485e-01f, -1.755980262e-01f, 8.760102219e-02f, -5.080079642e-02f,
+    3.023012382e-02f, -1.753284222e-02f, 9.568756570e-03f, -4.734754912e-03f, 2.005352631e-03f, -6.381972187e-04f,
+    -2.962578611e-04f, 1.211889507e-03f, -3.198833639e-03f, 6.899154077e-03f, -1.317931529e-02f, 2.329886884e-02f,
+    -3.944704936e-02f, 6.660350361e-02f, -1.210072767e-01f, 3.074536531e-01f, 8.911949678e-01f, -1.750296679e-01f,
+    8.727847981e-02f, -5.060852003e-02f, 3.011593640e-02f, -1.746781887e-02f, 9.534428741e-03f, -4.718661941e-03f,
+    1.999160202e-03f, -6.366405380e-04f, -2.940284870e-04f, 1.204153059e-03f, -3.179761011e-03f, 6.859644184e-03f,
+    -1.310581489e-02f, 2.317110707e-02f, -3.923230129e-02f, 6.623834698e-02f, -1.203170577e-01f, 3.053606280e-01f,
+    8.924582293e-01f, -1.744554499e-01f, 8.695319450e-02f, -5.041467929e-02f, 3.000081279e-02f, -1.740224200e-02f,
+    9.499789420e-03f, -4.702407896e-03f, 1.992894890e-03f, -6.350577123e-04f, -2.918014379e-04f, 1.196409905e-03f,
+    -3.160655400e-03f, 6.820045243e-03f, -1.303212321e-02f, 2.304298479e-02f, -3.901692926e-02f, 6.587217624e-02f,
+    -1.196253571e-01f, 3.032692161e-01f, 8.937149142e-01f, -1.738753687e-01f, 8.662516906e-02f, -5.021927644e-02f,
+    2.988475431e-02f, -1.733611229e-02f, 9.464838879e-03f, -4.685992829e-03f, 1.986556658e-03f, -6.334486883e-04f,
+    -2.895767870e-04f, 1.188660293e-03f, -3.141517407e-03f, 6.780358479e-03f, -1.295824250e-02f, 2.291450582e-02f,
+    -3.880093961e-02f, 6.550500199e-02f, -1.189321941e-01f, 3.011794438e-01f, 8.949650037e-01f, -1.732894209e-01f,
+    8.629440635e-02f, -5.002231376e-02f, 2.976776237e-02f, -1.726943043e-02f, 9.429577397e-03f, -4.669416797e-03f,
+    1.980145469e-03f, -6.318134133e-04f, -2.873546069e-04f, 1.180904473e-03f, -3.122347636e-03f, 6.740585116e-03f,
+    -1.288417500e-02f, 2.278567397e-02f, -3.858433869e-02f, 6.513683486e-02f, -1.182375878e-01f, 2.990913376e-01f,
+    8.962084793e-01f, -1.726976034e-01f, 8.596090929e-02f, -4.982379355e-02f, 2.964983833e-02f, -1.720219714e-02f,
+    9.394005263e-03f, -4.652679861e-03f, 1.973661292e-03f, -6.301518355e-04f, -2.851349701e-04f, 1.173142694e-03f,
+    -3.103146689e-03f, 6.700726376e-03f, -1.280992293e-02f, 2.265649308e-02f, -3.836713283e-02f, 6.476768548e-02f,
+    -1.175415576e-01f, 2.970049237e-01f, 8.974453225e-01f, -1.720999128e-01f, 8.562468088e-02f, -4.962371820e-02f,
+    2.953098365e-02f, -1.713441315e-02f, 9.358122774e-03f, -4.635782087e-03f, 1.967104093e-03f, -6.284639036e-04f,
+    -2.829179486e-04f, 1.165375203e-03f, -3.083915166e-03f, 6.660783483e-03f, -1.273548855e-02f, 2.252696698e-02f,
+    -3.814932839e-02f, 6.439756448e-02f, -1.168441228e-01f, 2.949202284e-01f, 8.986755149e-01f, -1.714963462e-01f,
+    8.528572419e-02f, -4.942209009e-02f, 2.941119975e-02f, -1.706607921e-02f, 9.321930238e-03f, -4.618723544e-03f,
+    1.960473844e-03f, -6.267495670e-04f, -2.807036140e-04f, 1.157602250e-03f, -3.064653667e-03f, 6.620757660e-03f,
+    -1.266087407e-02f, 2.239709950e-02f, -3.793093173e-02f, 6.402648252e-02f, -1.161453024e-01f, 2.928372780e-01f,
+    8.998990381e-01f, -1.708869006e-01f, 8.494404234e-02f, -4.921891168e-02f, 2.929048813e-02f, -1.699719608e-02f,
+    9.285427967e-03f, -4.601504308e-03f, 1.953770517e-03f, -6.250087758e-04f, -2.784920374e-04f, 1.149824080e-03f,
+    -3.045362794e-03f, 6.580650128e-03f, -1.258608175e-02f, 2.226689447e-02f, -3.771194921e-02f, 6.365445024e-02f,
+    -1.154451159e-01f, 2.907560987e-01f, 9.011158739e-01f, -1.702715731e-01f, 8.459963854e-02f, -4.901418545e-02f,
+    2.916885027e-02f, -1.692776453e-02f, 9.248616288e-03f, -4.584124457e-03f, 1.946994086e-03f, -6.232414809e-04f,
+    -2.762832896e-04f, 1.142040940e-03f, -3.026043145e-03f, 6.540462109e-03f, -1.251111383e-02f, 2.213635573e-02f,
+    -3.749238718e-02f, 6.328147828e-02f, -1.147435823e-01f, 2.886767165e-01f, 9.023260041e-01f, -1.696503608e-01f,
+    8.425251607e-02f, -4.880791393e-02f, 2.904628771e-02f, -1.685778536e-02f, 9.211495530e-03f, -4.566584075e-03f,
+    1.940144529e-03f, -6.214476338e-04f, -2.740774410e-04f, 1.134253075e-03f, -3.006695318e-03f, 6.500194825e-03f,
+    -1.243597253e-02f, 2.200548713e-02f, -3.727225202e-02f, 6.290757732e-02f, -1.140407209e-01f, 2.865991577e-01f,
+    9.035294108e-01f, -1.690232613e-01f, 8.390267825e-02f, -4.860009969e-02f, 2.892280200e-02f, -1.678725937e-02f,
+    9.174066036e-03f, -4.548883250e-03f, 1.933221823e-03f, -6.196271867e-04f, -2.718745617e-04f, 1.126460731e-03f,
+    -2.987319910e-03f, 6.459849498e-03f, -1.236066010e-02f, 2.187429249e-02f, -3.705155011e-02f, 6.253275801e-02f,
+    -1.133365509e-01f, 2.845234481e-01f, 9.047260761e-01f, -1.683902718e-01f, 8.355012850e-02f, -4.839074534e-02f,
+    2.879839471e-02f, -1.671618739e-02f, 9.136328156e-03f, -4.531022076e-03f, 1.926225949e-03f, -6.177800925e-04f,
+    -2.696747211e-04f, 1.118664153e-03f, -2.967917520e-03f, 6.419427346e-03f, -1.228517879e-02f, 2.174277567e-02f,
+    -3.683028781e-02f, 6.215703102e-02f, -1.126310914e-01f, 2.824496138e-01f, 9.059159820e-01f, -1.677513898e-01f,
+    8.319487031e-02f, -4.817985355e-02f, 2.867306745e-02f, -1.664457026e-02f, 9.098282248e-03f, -4.513000648e-03f,
+    1.919156890e-03f, -6.159063049e-04f, -2.674779885e-04f, 1.110863582e-03f, -2.948488743e-03f, 6.378929591e-03f,
+    -1.220953083e-02f, 2.161094051e-02f, -3.660847151e-02f, 6.178040703e-02f, -1.119243618e-01f, 2.803776807e-01f,
+    9.070991108e-01f, -1.671066131e-01f, 8.283690721e-02f, -4.796742699e-02f, 2.854682185e-02f, -1.657240882e-02f,
+    9.059928680e-03f, -4.494819071e-03f, 1.912014631e-03f, -6.140057783e-04f, -2.652844326e-04f, 1.103059265e-03f,
+    -2.929034174e-03f, 6.338357451e-03f, -1.213371845e-02f, 2.147879086e-02f, -3.638610760e-02f, 6.140289670e-02f,
+    -1.112163810e-01f, 2.783076747e-01f, 9.082754449e-01f, -1.664559394e-01f, 8.247624282e-02f, -4.775346842e-02f,
+    2.841965956e-02f, -1.649970395e-02f, 9.021267827e-03f, -4.476477449e-03f, 1.904799159e-03f, -6.120784677e-04f,
+    -2.630941219e-04f, 1.095251441e-03f, -2.909554408e-03f, 6.297712146e-03f, -1.205774391e-02f, 2.134633056e-02f,
+    -3.616320245e-02f, 6.102451072e-02f, -1.105071683e-01f, 2.762396216e-01f, 9.094449668e-01f, -1.657993663e-01f,
+    8.211288083e-02f, -4.753798062e-02f, 2.829158226e-02f, -1.642645653e-02f, 8.982300074e-03f, -4.457975894e-03f,
+    1.897510462e-03f, -6.101243290e-04f, -2.609071242e-04f, 1.087440354e-03f, -2.890050040e-03f, 6.256994893e-03f,
+    -1.198160944e-02f, 2.121356346e-02f, -3.593976247e-02f, 6.064525977e-02f, -1.097967428e-01f, 2.741735471e-01f,
+    9.106076590e-01f, -1.651368920e-01f, 8.174682500e-02f, -4.732096639e-02f, 2.816259167e-02f, -1.635266746e-02f,
+    8.943025816e-03f, -4.439314522e-03f, 1.890148531e-03f, -6.081433186e-04f, -2.587235072e-04f, 1.079626244e-03f,
+    -2.870521661e-03f, 6.216206910e-03f, -1.190531728e-02f, 2.108049342e-02f, -3.571579405e-02f, 6.026515454e-02f,
+    -1.090851237e-01f, 2.721094770e-01f, 9.117635041e-01f, -1.644685143e-01f, 8.137807915e-02f, -4.710242862e-02f,
+    2.803268950e-02f, -1.627833766e-02f, 8.903445455e-03f, -4.420493452e-03f, 1.882713360e-03f, -6.061353939e-04f,
+    -2.565433379e-04f, 1.071809353e-03f, -2.850969864e-03f, 6.175349414e-03f, -1.182886968e-02f, 2.094712428e-02f,
+    -3.549130358e-02f, 5.988420571e-02f, -1.083723300e-01f, 2.700474368e-01f, 9.129124850e-01f, -1.637942315e-01f,
+    8.100664717e-02f, -4.688237020e-02f, 2.790187753e-02f, -1.620346806e-02f, 8.863559403e-03f, -4.401512811e-03f,
+    1.875204944e-03f, -6.041005128e-04f, -2.543666831e-04f, 1.063989919e-03f, -2.831395241e-03f, 6.134423620e-03f,
+    -1.175226887e-02f, 2.081345990e-02f, -3.526629747e-02f, 5.950242399e-02f, -1.076583810e-01f, 2.679874523e-01f,
+    9.140545843e-01f, -1.631140417e-01f, 8.063253303e-02f, -4.666079408e-02f, 2.777015752e-02f, -1.612805959e-02f,
+    8.823368078e-03f, -4.382372726e-03f, 1.867623280e-03f, -6.020386341e-04f, -2.521936091e-04f, 1.056168182e-03f,
+    -2.811798383e-03f, 6.093430745e-03f, -1.167551709e-02f, 2.067950413e-02f, -3.504078211e-02f, 5.911982005e-02f,
+    -1.069432956e-01f, 2.659295489e-01f, 9.151897852e-01f, -1.624279433e-01f, 8.025574075e-02f, -4.643770325e-02f,
+    2.763753130e-02f, -1.605211324e-02f, 8.782871911e-03f, -4.363073333e-03f, 1.859968367e-03f, -5.999497172e-04f,
+    -2.500241819e-04f, 1.048344381e-03f, -2.792179877e-03f, 6.052372001e-03f, -1.159861659e-02f, 2.054526083e-02f,
+    -3.481476392e-02f, 5.873640460e-02f, -1.062270930e-01f, 2.638737521e-01f, 9.163180707e-01f, -1.617359346e-01f,
+    7.987627445e-02f, -4.621310074e-02f, 2.750400069e-02f, -1.597562996e-02f, 8.742071339e-03f, -4.343614770e-03f,
+    1.852240207e-03f, -5.978337224e-04f, -2.478584669e-04f, 1.040518753e-03f, -2.772540314e-03f, 6.011248605e-03f,
+    -1.152156960e-02f, 2.041073386e-02f, -3.458824929e-02f, 5.835218834e-02f, -1.055097922e-01f, 2.618200874e-01f,
+    9.174394239e-01f, -1.610380143e-01f, 7.949413829e-02f, -4.598698963e-02f, 2.736956755e-02f, -1.589861076e-02f,
+    8.700966809e-03f, -4.323997180e-03f, 1.844438803e-03f, -5.956906107e-04f, -2.456965292e-04f, 1.032691535e-03f,
+    -2.752880282e-03f, 5.970061767e-03f, -1.144437836e-02f, 2.027592707e-02f, -3.436124464e-02f, 5.796718196e-02f,
+    -1.047914123e-01f, 2.597685801e-01f, 9.185538280e-01f, -1.603341809e-01f, 7.910933652e-02f, -4.575937302e-02f,
+    2.723423378e-02f, -1.582105663e-02f, 8.659558777e-03f, -4.304220712e-03f, 1.836564162e-03f, -5.935203437e-04f,
+    -2.435384334e-04f, 1.024862964e-03f, -2.733200366e-03f, 5.928812700e-03f, -1.136704512e-02f, 2.014084431e-02f,
+    -3.413375639e-02f, 5.758139617e-02f, -1.040719723e-01f, 2.577192555e-01f, 9.196612664e-01f, -1.596244331e-01f,
+    7.872187343e-02f, -4.553025409e-02f, 2.709800127e-02f, -1.574296862e-02f, 8.617847705e-03f, -4.284285518e-03f,
+    1.828616290e-03f, -5.913228840e-04f, -2.413842439e-04f, 1.017033275e-03f, -2.713501154e-03f, 5.887502615e-03f,
+    -1.128957210e-02f, 2.000548945e-02f, -3.390579094e-02f, 5.719484167e-02f, -1.033514912e-01f, 2.556721389e-01f,
+    9.207617227e-01f, -1.589087698e-01f, 7.833175342e-02f, -4.529963601e-02f, 2.696087197e-02f, -1.566434774e-02f,
+    8.575834069e-03f, -4.264191755e-03f, 1.820595199e-03f, -5.890981948e-04f, -2.392340244e-04f, 1.009202703e-03f,
+    -2.693783230e-03f, 5.846132723e-03f, -1.121196155e-02f, 1.986986635e-02f, -3.367735471e-02f, 5.680752916e-02f,
+    -1.026299882e-01f, 2.536272555e-01f, 9.218551802e-01f, -1.581871900e-01f, 7.793898094e-02f, -4.506752204e-02f,
+    2.682284785e-02f, -1.558519506e-02f, 8.533518348e-03f, -4.243939585e-03f, 1.812500900e-03f, -5.868462401e-04f,
+    -2.370878384e-04f, 1.001371483e-03f, -2.674047178e-03f, 5.804704232e-03f, -1.113421571e-02f, 1.973397886e-02f,
+    -3.344845411e-02f, 5.641946935e-02f, -1.019074821e-01f, 2.515846303e-01f, 9.229416227e-01f, -1.574596926e-01f,
+    7.754356049e-02f, -4.483391545e-02f, 2.668393088e-02f, -1.550551165e-02f, 8.490901036e-03f, -4.223529175e-03f,
+    1.804333406e-03f, -5.845669847e-04f, -2.349457488e-04f, 9.935398481e-04f, -2.654293582e-03f, 5.763218350e-03f,
+    -1.105633681e-02f, 1.959783085e-02f, -3.321909557e-02f, 5.603067294e-02f, -1.011839919e-01f, 2.495442886e-01f,
+    9.240210339e-01f, -1.567262767e-01f, 7.714549668e-02f, -4.459881957e-02f, 2.654412308e-02f, -1.542529859e-02f,
+    8.447982630e-03f, -4.202960696e-03f, 1.796092736e-03f, -5.822603942e-04f, -2.328078182e-04f, 9.857080309e-04f,
+    -2.634523023e-03f, 5.721676284e-03f, -1.097832709e-02f, 1.946142616e-02f, -3.298928551e-02f, 5.564115063e-02f,
+    -1.004595367e-01f, 2.475062552e-01f, 9.250933978e-01f, -1.559869417e-01f, 7.674479415e-02f, -4.436223777e-02f,
+    2.640342649e-02f, -1.534455698e-02f, 8.404763640e-03f, -4.182234324e-03f, 1.787778907e-03f, -5.799264348e-04f,
+    -2.306741088e-04f, 9.778762635e-04f, -2.614736083e-03f, 5.680079242e-03f, -1.090018879e-02f, 1.932476867e-02f,
+    -3.275903033e-02f, 5.525091313e-02f, -9.973413533e-02f, 2.454705552e-01f, 9.261586982e-01f, -1.552416867e-01f,
+    7.634145764e-02f, -4.412417345e-02f, 2.626184318e-02f, -1.526328794e-02f, 8.361244584e-03f, -4.161350240e-03f,
+    1.779391940e-03f, -5.775650737e-04f, -2.285446823e-04f, 9.700447773e-04f, -2.594933342e-03f, 5.638428426e-03f,
+    -1.082192413e-02f, 1.918786223e-02f, -3.252833647e-02f, 5.485997115e-02f, -9.900780674e-02f, 2.434372135e-01f,
+    9.272169193e-01f, -1.544905114e-01f, 7.593549193e-02f, -4.388463006e-02f, 2.611937523e-02f, -1.518149259e-02f,
+    8.317425986e-03f, -4.140308629e-03f, 1.770931857e-03f, -5.751762788e-04f, -2.264196001e-04f, 9.622138029e-04f,
+    -2.575115379e-03f, 5.596725042e-03f, -1.074353536e-02f, 1.905071071e-02f, -3.229721035e-02f, 5.446833538e-02f,
+    -9.828056985e-02f, 2.414062548e-01f, 9.282680451e-01f, -1.537334152e-01f, 7.552690191e-02f, -4.364361108e-02f,
+    2.597602476e-02f, -1.509917209e-02f, 8.273308383e-03f, -4.119109681e-03f, 1.762398685e-03f, -5.727600188e-04f,
+    -2.242989229e-04f, 9.543835700e-04f, -2.555282771e-03f, 5.554970292e-03f, -1.066502470e-02f, 1.891331795e-02f,
+    -3.206565839e-02f, 5.407601652e-02f, -9.755244357e-02f, 2.393777040e-01f, 9.293120601e-01f, -1.529703977e-01f,
+    7.511569250e-02f, -4.340112006e-02f, 2.583179392e-02f, -1.501632760e-02f, 8.228892318e-03f, -4.097753590e-03f,
+    1.753792449e-03f, -5.703162631e-04f, -2.221827113e-04f, 9.465543078e-04f, -2.535436097e-03f, 5.513165377e-03f,
+    -1.058639439e-02f, 1.877568781e-02f, -3.183368701e-02f, 5.368302529e-02f, -9.682344677e-02f, 2.373515857e-01f,
+    9.303489485e-01f, -1.522014587e-01f, 7.470186871e-02f, -4.315716057e-02f, 2.568668486e-02f, -1.493296029e-02f,
+    8.184178345e-03f, -4.076240557e-03f, 1.745113180e-03f, -5.678449820e-04f, -2.200710253e-04f, 9.387262445e-04f,
+    -2.515575931e-03f, 5.471311498e-03f, -1.050764665e-02f, 1.863782417e-02f, -3.160130263e-02f, 5.328937238e-02f,
+    -9.609359831e-02f, 2.353279247e-01f, 9.313786948e-01f, -1.514265981e-01f, 7.428543561e-02f, -4.291173621e-02f,
+    2.554069978e-02f, -1.484907136e-02f, 8.139167025e-03f, -4.054570784e-03f, 1.736360909e-03f, -5.653461465e-04f,
+    -2.179639244e-04f, 9.308996076e-04f, -2.495702849e-03f, 5.429409854e-03f, -1.042878373e-02f, 1.849973087e-02f,
+    -3.136851168e-02f, 5.289506848e-02f, -9.536291704e-02f, 2.333067455e-01f, 9.324012837e-01f, -1.506458157e-01f,
+    7.386639836e-02f, -4.266485065e-02f, 2.539384090e-02f, -1.476466201e-02f, 8.093858928e-03f, -4.032744482e-03f,
+    1.727535670e-03f, -5.628197285e-04f, -2.158614680e-04f, 9.230746241e-04f, -2.475817425e-03f, 5.387461642e-03f,
+    -1.034980784e-02f, 1.836141177e-02f, -3.113532058e-02f, 5.250012430e-02f, -9.463142179e-02f, 2.312880726e-01f,
+    9.334166998e-01f, -1.498591117e-01f, 7.344476215e-02f, -4.241650759e-02f, 2.524611047e-02f, -1.467973347e-02f,
+    8.048254634e-03f, -4.010761863e-03f, 1.718637498e-03f, -5.602657007e-04f, -2.137637147e-04f, 9.152515198e-04f,
+    -2.455920230e-03f, 5.345468059e-03f, -1.027072122e-02f, 1.822287073e-02f, -3.090173575e-02f, 5.210455052e-02f,
+    -9.389913134e-02f, 2.292719305e-01f, 9.344249279e-01f, -1.490664862e-01f, 7.302053229e-02f, -4.216671076e-02f,
+    2.509751074e-02f, -1.459428698e-02f, 8.002354732e-03f, -3.988623145e-03f, 1.709666432e-03f, -5.576840365e-04f,
+    -2.116707229e-04f, 9.074305201e-04f, -2.436011837e-03f, 5.303430300e-03f, -1.019152608e-02f, 1.808411160e-02f,
+    -3.066776362e-02f, 5.170835785e-02f, -9.316606450e-02f, 2.272583435e-01f, 9.354259529e-01f, -1.482679394e-01f,
+    7.259371411e-02f, -4.191546395e-02f, 2.494804402e-02f, -1.450832379e-02f, 7.956159819e-03f, -3.966328552e-03f,
+    1.700622512e-03f, -5.550747103e-04f, -2.095825504e-04f, 8.996118493e-04f, -2.416092816e-03f, 5.261349559e-03f,
+    -1.011222466e-02f, 1.794513824e-02f, -3.043341061e-02f, 5.131155696e-02f, -9.243224003e-02f, 2.252473361e-01f,
+    9.364197598e-01f, -1.474634717e-01f, 7.216431305e-02f, -4.166277098e-02f, 2.479771262e-02f, -1.442184517e-02f,
+    7.909670501e-03f, -3.943878312e-03f, 1.691505781e-03f, -5.524376971e-04f, -2.074992548e-04f, 8.917957311e-04f,
+    -2.396163736e-03f, 5.219227028e-03f, -1.003281918e-02f, 1.780595451e-02f, -3.019868313e-02f, 5.091415854e-02f,
+    -9.169767666e-02f, 2.232389325e-01f, 9.374063338e-01f, -1.466530836e-01f, 7.173233459e-02f, -4.140863571e-02f,
+    2.464651889e-02f, -1.433485241e-02f, 7.862887393e-03f, -3.921272656e-03f, 1.682316283e-03f, -5.497729728e-04f,
+    -2.054208931e-04f, 8.839823884e-04f, -2.376225166e-03f, 5.177063897e-03f, -9.953311866e-03f, 1.766656424e-02f,
+    -2.996358761e-02f, 5.051617328e-02f, -9.096239313e-02f, 2.212331569e-01f, 9.383856601e-01f, -1.458367756e-01f,
+    7.129778430e-02f, -4.115306205e-02f, 2.449446520e-02f, -1.424734680e-02f, 7.815811118e-03f, -3.898511822e-03f,
+    1.673054066e-03f, -5.470805142e-04f, -2.033475219e-04f, 8.761720433e-04f, -2.356277671e-03f, 5.134861358e-03f,
+    -9.873704929e-03f, 1.752697131e-02f, -2.972813047e-02f, 5.011761186e-02f, -9.022640814e-02f, 2.192300334e-01f,
+    9.393577240e-01f, -1.450145484e-01f, 7.086066780e-02f, -4.089605395e-02f, 2.434155394e-02f, -1.415932967e-02f,
+    7.768442310e-03f, -3.875596052e-03f, 1.663719179e-03f, -5.443602989e-04f, -2.012791973e-04f, 8.683649170e-04f,
+    -2.336321818e-03f, 5.092620596e-03f, -9.794000593e-03f, 1.738717955e-02f, -2.949231812e-02f, 4.971848495e-02f,
+    -8.948974037e-02f, 2.172295861e-01f, 9.403225108e-01f, -1.441864028e-01f, 7.042099081e-02f, -4.063761539e-02f,
+    2.418778754e-02f, -1.407080234e-02f, 7.720781611e-03f, -3.852525592e-03f, 1.654311672e-03f, -5.416123052e-04f,
+    -1.992159752e-04f, 8.605612301e-04f, -2.316358171e-03f, 5.050342800e-03f, -9.714201076e-03f, 1.724719281e-02f,
+    -2.925615699e-02f, 4.931880322e-02f, -8.875240848e-02f, 2.152318390e-01f, 9.412800063e-01f, -1.433523396e-01f,
+    6.997875909e-02f, -4.037775041e-02f, 2.403316844e-02f, -1.398176616e-02f, 7.672829671e-03f, -3.829300694e-03f,
+    1.644831600e-03f, -5.388365124e-04f, -1.971579108e-04f, 8.527612021e-04f, -2.296387294e-03f, 5.008029154e-03f,
+    -9.634308593e-03f, 1.710701495e-02f, -2.901965348e-02f, 4.891857735e-02f, -8.801443111e-02f, 2.132368160e-01f,
+    9.422301959e-01f, -1.425123599e-01f, 6.953397848e-02f, -4.011646307e-02f, 2.387769911e-02f, -1.389222250e-02f,
+    7.624587148e-03f, -3.805921613e-03f, 1.635279019e-03f, -5.360329006e-04f, -1.951050591e-04f, 8.449650520e-04f,
+    -2.276409748e-03f, 4.965680840e-03f, -9.554325359e-03f, 1.696664981e-02f, -2.878281401e-02f, 4.851781799e-02f,
+    -8.727582688e-02f, 2.112445411e-01f, 9.431730655e-01f, -1.416664646e-01f, 6.908665489e-02f, -3.985375749e-02f,
+    2.372138205e-02f, -1.380217272e-02f, 7.576054713e-03f, -3.782388612e-03f, 1.625653986e-03f, -5.332014506e-04f,
+    -1.930574744e-04f, 8.371729977e-04f, -2.256426094e-03f, 4.923299042e-03f, -9.474253586e-03f, 1.682610122e-02f,
+    -2.854564499e-02f, 4.811653581e-02f, -8.653661437e-02f, 2.092550380e-01f, 9.441086010e-01f, -1.408146550e-01f,
+    6.863679429e-02f, -3.958963782e-02f, 2.356421978e-02f, -1.371161823e-02f, 7.527233041e-03f, -3.758701954e-03f,
+    1.615956562e-03f, -5.303421442e-04f, -1.910152109e-04f, 8.293852565e-04f, -2.236436892e-03f, 4.880884940e-03f,
+    -9.394095485e-03f, 1.668537305e-02f, -2.830815283e-02f, 4.771474145e-02f, -8.579681217e-02f, 2.072683304e-01f,
+    9.450367882e-01f, -1.399569324e-01f, 6.818440275e-02f, -3.932410826e-02f, 2.340621485e-02f, -1.362056042e-02f,
+    7.478122820e-03f, -3.734861912e-03f, 1.606186810e-03f, -5.274549639e-04f, -1.889783220e-04f, 8.216020448e-04f,
+    -2.216442700e-03f, 4.838439710e-03f, -9.313853264e-03f, 1.654446911e-02f, -2.807034394e-02f, 4.731244557e-02f,
+    -8.505643881e-02f, 2.052844421e-01f, 9.459576133e-01f, -1.390932982e-01f, 6.772948637e-02f, -3.905717304e-02f,
+    2.324736983e-02f, -1.352900073e-02f, 7.428724743e-03f, -3.710868759e-03f, 1.596344794e-03f, -5.245398933e-04f,
+    -1.869468609e-04f, 8.138235781e-04f, -2.196444075e-03f, 4.795964532e-03f, -9.233529131e-03f, 1.640339326e-02f,
+    -2.783222472e-02f, 4.690965881e-02f, -8.431551281e-02f, 2.033033967e-01f, 9.468710625e-01f, -1.382237538e-01f,
+    6.727205134e-02f, -3.878883644e-02f, 2.308768732e-02f, -1.343694059e-02f, 7.379039516e-03f, -3.686722777e-03f,
+    1.586430581e-03f, -5.215969166e-04f, -1.849208804e-04f, 8.060500710e-04f, -2.176441572e-03f, 4.753460579e-03f,
+    -9.153125291e-03f, 1.626214933e-02f, -2.759380157e-02f, 4.650639182e-02f, -8.357405269e-02f, 2.013252176e-01f,
+    9.477771221e-01f, -1.373483009e-01f, 6.681210392e-02f, -3.851910277e-02f, 2.292716994e-02f, -1.334438146e-02f,
+    7.329067850e-03f, -3.662424249e-03f, 1.576444242e-03f, -5.186260189e-04f, -1.829004327e-04f, 7.982817376e-04f,
+    -2.156435747e-03f, 4.710929025e-03f, -9.072643946e-03f, 1.612074116e-02f, -2.735508091e-02f, 4.610265521e-02f,
+    -8.283207690e-02f, 1.993499284e-01f, 9.486757784e-01f, -1.364669412e-01f, 6.634965043e-02f, -3.824797640e-02f,
+    2.276582034e-02f, -1.325132480e-02f, 7.278810467e-03f, -3.637973464e-03f, 1.566385847e-03f, -5.156271863e-04f,
+    -1.808855697e-04f, 7.905187908e-04f, -2.136427152e-03f, 4.668371042e-03f, -8.992087298e-03f, 1.597917257e-02f,
+    -2.711606911e-02f, 4.569845962e-02f, -8.208960391e-02f, 1.973775524e-01f, 9.495670180e-01f, -1.355796765e-01f,
+    6.588469727e-02f, -3.797546173e-02f, 2.260364119e-02f, -1.315777209e-02f, 7.228268097e-03f, -3.613370718e-03f,
+    1.556255470e-03f, -5.126004057e-04f, -1.788763428e-04f, 7.827614428e-04f, -2.116416338e-03f, 4.625787799e-03f,
+    -8.911457545e-03f, 1.583744739e-02f, -2.687677258e-02f, 4.529381566e-02f, -8.134665214e-02f, 1.954081130e-01f,
+    9.504508275e-01f, -1.346865086e-01f, 6.541725091e-02f, -3.770156319e-02f, 2.244063519e-02f, -1.306372485e-02f,
+    7.177441481e-03f, -3.588616310e-03f, 1.546053188e-03f, -5.095456647e-04f, -1.768728029e-04f, 7.750099050e-04f,
+    -2.096403856e-03f, 4.583180465e-03f, -8.830756884e-03f, 1.569556946e-02f, -2.663719771e-02f, 4.488873396e-02f,
+    -8.060323998e-02f, 1.934416334e-01f, 9.513271937e-01f, -1.337874397e-01f, 6.494731787e-02f, -3.742628528e-02f,
+    2.227680507e-02f, -1.296918457e-02f, 7.126331366e-03f, -3.563710542e-03f, 1.535779079e-03f, -5.064629519e-04f,
+    -1.748750006e-04f, 7.672643878e-04f, -2.076390256e-03f, 4.540550205e-03f, -8.749987509e-03f, 1.555354260e-02f,
+    -2.639735089e-02f, 4.448322511e-02f, -7.985938580e-02f, 1.914781368e-01f, 9.521961034e-01f, -1.328824718e-01f,
+    6.447490477e-02f, -3.714963250e-02f, 2.211215356e-02f, -1.287415280e-02f, 7.074938510e-03f, -3.538653724e-03f,
+    1.525433224e-03f, -5.033522570e-04f, -1.728829860e-04f, 7.595251008e-04f, -2.056376084e-03f, 4.497898185e-03f,
+    -8.669151612e-03f, 1.541137062e-02f, -2.615723849e-02f, 4.407729972e-02f, -7.911510796e-02f, 1.895176463e-01f,
+    9.530575435e-01f, -1.319716071e-01f, 6.400001827e-02f, -3.687160943e-02f, 2.194668345e-02f, -1.277863107e-02f,
+    7.023263678e-03f, -3.513446169e-03f, 1.515015705e-03f, -5.002135701e-04f, -1.708968087e-04f, 7.517922528e-04f,
+    -2.036361888e-03f, 4.455225565e-03f, -8.588251383e-03f, 1.526905736e-02f, -2.591686691e-02f, 4.367096837e-02f,
+    -7.837042478e-02f, 1.875601850e-01f, 9.539115011e-01f, -1.310548480e-01f, 6.352266511e-02f, -3.659222067e-02f,
+    2.178039753e-02f, -1.268262095e-02f, 6.971307645e-03f, -3.488088196e-03f, 1.504526608e-03f, -4.970468825e-04f,
+    -1.689165179e-04f, 7.440660517e-04f, -2.016348211e-03f, 4.412533508e-03f, -8.507289009e-03f, 1.512660662e-02f,
+    -2.567624252e-02f, 4.326424166e-02f, -7.762535455e-02f, 1.856057758e-01f, 9.547579634e-01f, -1.301321970e-01f,
+    6.304285211e-02f, -3.631147087e-02f, 2.161329863e-02f, -1.258612402e-02f, 6.919071194e-03f, -3.462580126e-03f,
+    1.493966020e-03f, -4.938521864e-04f, -1.669421625e-04f, 7.363467045e-04f, -1.996335598e-03f, 4.369823170e-03f,
+    -8.426266676e-03f, 1.498402222e-02f, -2.543537169e-02f, 4.285713015e-02f, -7.687991554e-02f, 1.836544417e-01f,
+    9.555969176e-01f, -1.292036565e-01f, 6.256058614e-02f, -3.602936470e-02f, 2.144538959e-02f, -1.248914185e-02f,
+    6.866555120e-03f, -3.436922288e-03f, 1.483334031e-03f, -4.906294747e-04f, -1.649737908e-04f, 7.286344173e-04f,
+    -1.976324590e-03f, 4.327095710e-03f, -8.345186565e-03f, 1.484130797e-02f, -2.519426079e-02f, 4.244964442e-02f,
+    -7.613412598e-02f, 1.817062055e-01f, 9.564283513e-01f, -1.282692293e-01f, 6.207587416e-02f, -3.574590690e-02f,
+    2.127667328e-02f, -1.239167607e-02f, 6.813760221e-03f, -3.411115014e-03f, 1.472630734e-03f, -4.873787413e-04f,
+    -1.630114507e-04f, 7.209293954e-04f, -1.956315728e-03f, 4.284352280e-03f, -8.264050856e-03f, 1.469846768e-02f,
+    -2.495291619e-02f, 4.204179503e-02f, -7.538800409e-02f, 1.797610899e-01f, 9.572522518e-01f, -1.273289179e-01f,
+    6.158872317e-02f, -3.546110224e-02f, 2.110715261e-02f, -1.229372828e-02f, 6.760687310e-03f, -3.385158642e-03f,
+    1.461856223e-03f, -4.840999809e-04f, -1.610551897e-04f, 7.132318432e-04f, -1.936309551e-03f, 4.241594034e-03f,
+    -8.182861727e-03f, 1.455550515e-02f, -2.471134425e-02f, 4.163359252e-02f, -7.464156805e-02f, 1.778191176e-01f,
+    9.580686068e-01f, -1.263827254e-01f, 6.109914028e-02f, -3.517495551e-02f, 2.093683049e-02f, -1.219530013e-02f,
+    6.707337205e-03f, -3.359053513e-03f, 1.451010594e-03f, -4.807931893e-04f, -1.591050547e-04f, 7.055419641e-04f,
+    -1.916306597e-03f, 4.198822122e-03f, -8.101621352e-03f, 1.441242419e-02f, -2.446955133e-02f, 4.122504745e-02f,
+    -7.389483602e-02f, 1.758803113e-01f, 9.588774041e-01f, -1.254306547e-01f, 6.060713263e-02f, -3.488747157e-02f,
+    2.076570988e-02f, -1.209639327e-02f, 6.653710733e-03f, -3.332799975e-03f, 1.440093947e-03f, -4.774583630e-04f,
+    -1.571610924e-04f, 6.978599608e-04f, -1.896307402e-03f, 4.156037692e-03f, -8.020331904e-03f, 1.426922858e-02f,
+    -2.422754377e-02f, 4.081617035e-02f, -7.314782611e-02f, 1.739446934e-01f, 9.596786314e-01f, -1.244727088e-01f,
+    6.011270744e-02f, -3.459865532e-02f, 2.059379373e-02f, -1.199700936e-02f, 6.599808732e-03f, -3.306398380e-03f,
+    1.429106383e-03f, -4.740954995e-04f, -1.552233489e-04f, 6.901860349e-04f, -1.876312501e-03f, 4.113241891e-03f,
+    -7.938995550e-03f, 1.412592214e-02f, -2.398532793e-02f, 4.040697173e-02f, -7.240055644e-02f, 1.720122864e-01f,
+    9.604722768e-01f, -1.235088909e-01f, 5.961587202e-02f, -3.430851166e-02f, 2.042108506e-02f, -1.189715008e-02f,
+    6.545632047e-03f, -3.279849083e-03f, 1.418048005e-03f, -4.707045971e-04f, -1.532918699e-04f, 6.825203873e-04f,
+    -1.856322427e-03f, 4.070435862e-03f, -7.857614458e-03f, 1.398250864e-02f, -2.374291015e-02f, 3.999746212e-02f,
+    -7.165304506e-02f, 1.700831128e-01f, 9.612583283e-01f, -1.225392043e-01f, 5.911663372e-02f, -3.401704558e-02f,
+    2.024758688e-02f, -1.179681713e-02f, 6.491181532e-03f, -3.253152446e-03f, 1.406918919e-03f, -4.672856550e-04f,
+    -1.513667007e-04f, 6.748632178e-04f, -1.836337712e-03f, 4.027620747e-03f, -7.776190790e-03f, 1.383899187e-02f,
+    -2.350029676e-02f, 3.958765203e-02f, -7.090531002e-02f, 1.681571947e-01f, 9.620367741e-01f, -1.215636524e-01f,
+    5.861499997e-02f, -3.372426209e-02f, 2.007330224e-02f, -1.169601223e-02f, 6.436458051e-03f, -3.226308835e-03f,
+    1.395719235e-03f, -4.638386736e-04f, -1.494478862e-04f, 6.672147255e-04f, -1.816358886e-03f, 3.984797686e-03f,
+    -7.694726709e-03f, 1.369537562e-02f, -2.325749410e-02f, 3.917755194e-02f, -7.015736932e-02f, 1.662345546e-01f,
+    9.628076025e-01f, -1.205822386e-01f, 5.811097827e-02f, -3.343016622e-02f, 1.989823420e-02f, -1.159473709e-02f,
+    6.381462475e-03f, -3.199318621e-03f, 1.384449062e-03f, -4.603636537e-04f, -1.475354707e-04f, 6.595751084e-04f,
+    -1.796386479e-03f, 3.941967816e-03f, -7.613224370e-03f, 1.355166367e-02f, -2.301450849e-02f, 3.876717235e-02f,
+    -6.940924094e-02f, 1.643152145e-01f, 9.635708019e-01f, -1.195949665e-01f, 5.760457620e-02f, -3.313476308e-02f,
+    1.972238587e-02f, -1.149299346e-02f, 6.326195686e-03f, -3.172182179e-03f, 1.373108513e-03f, -4.568605976e-04f,
+    -1.456294981e-04f, 6.519445637e-04f, -1.776421016e-03f, 3.899132273e-03f, -7.531685928e-03f, 1.340785979e-02f,
+    -2.277134627e-02f, 3.835652373e-02f, -6.866094282e-02f, 1.623991965e-01f, 9.643263608e-01f, -1.186018398e-01f,
+    5.709580139e-02f, -3.283805779e-02f, 1.954576036e-02f, -1.139078309e-02f, 6.270658573e-03f, -3.144899891e-03f,
+    1.361697703e-03f, -4.533295080e-04f, -1.437300120e-04f, 6.443232878e-04f, -1.756463024e-03f, 3.856292189e-03f,
+    -7.450113536e-03f, 1.326396775e-02f, -2.252801373e-02f, 3.794561654e-02f, -6.791249289e-02f, 1.604865226e-01f,
+    9.650742679e-01f, -1.176028624e-01f, 5.658466154e-02f, -3.254005552e-02f, 1.936836081e-02f, -1.128810776e-02f,
+    6.214852033e-03f, -3.117472141e-03f, 1.350216751e-03f, -4.497703888e-04f, -1.418370554e-04f, 6.367114758e-04f,
+    -1.736513027e-03f, 3.813448694e-03f, -7.368509341e-03f, 1.311999133e-02f, -2.228451719e-02f, 3.753446124e-02f,
+    -6.716390902e-02f, 1.585772148e-01f, 9.658145119e-01f, -1.165980381e-01f, 5.607116443e-02f, -3.224076148e-02f,
+    1.919019040e-02f, -1.118496925e-02f, 6.158776975e-03f, -3.089899319e-03f, 1.338665775e-03f, -4.461832448e-04f,
+    -1.399506710e-04f, 6.291093223e-04f, -1.716571548e-03f, 3.770602918e-03f, -7.286875489e-03f, 1.297593429e-02f,
+    -2.204086296e-02f, 3.712306828e-02f, -6.641520906e-02f, 1.566712950e-01f, 9.665470817e-01f, -1.155873710e-01f,
+    5.555531789e-02f, -3.194018092e-02f, 1.901125231e-02f, -1.108136936e-02f, 6.102434314e-03f, -3.062181820e-03f,
+    1.327044899e-03f, -4.425680816e-04f, -1.380709009e-04f, 6.215170207e-04f, -1.696639106e-03f, 3.727755986e-03f,
+    -7.205214121e-03f, 1.283180038e-02f, -2.179705734e-02f, 3.671144807e-02f, -6.566641085e-02f, 1.547687848e-01f,
+    9.672719662e-01f, -1.145708651e-01f, 5.503712985e-02f, -3.163831913e-02f, 1.883154977e-02f, -1.097730991e-02f,
+    6.045824975e-03f, -3.034320045e-03f, 1.315354246e-03f, -4.389249060e-04f, -1.361977869e-04f, 6.139347637e-04f,
+    -1.676716223e-03f, 3.684909021e-03f, -7.123527376e-03f, 1.268759336e-02f, -2.155310661e-02f, 3.629961105e-02f,
+    -6.491753216e-02f, 1.528697061e-01f, 9.679891546e-01f, -1.135485246e-01f, 5.451660828e-02f, -3.133518143e-02f,
+    1.865108601e-02f, -1.087279273e-02f, 5.988949891e-03f, -3.006314396e-03f, 1.303593944e-03f, -4.352537253e-04f,
+    -1.343313703e-04f, 6.063627427e-04f, -1.656803415e-03f, 3.642063144e-03f, -7.041817391e-03f, 1.254331698e-02f,
+    -2.130901706e-02f, 3.588756762e-02f, -6.416859075e-02f, 1.509740805e-01f, 9.686986361e-01f, -1.125203540e-01f,
+    5.399376122e-02f, -3.103077320e-02f, 1.846986429e-02f, -1.076781966e-02f, 5.931810005e-03f, -2.978165284e-03f,
+    1.291764122e-03f, -4.315545481e-04f, -1.324716919e-04f, 5.988011486e-04f, -1.636901199e-03f, 3.599219475e-03f,
+    -6.960086295e-03f, 1.239897500e-02f, -2.106479498e-02f, 3.547532818e-02f, -6.341960435e-02f, 1.490819294e-01f,
+    9.694003999e-01f, -1.114863576e-01f, 5.346859679e-02f, -3.072509985e-02f, 1.828788792e-02f, -1.066239257e-02f,
+    5.874406267e-03f, -2.949873123e-03f, 1.279864911e-03f, -4.278273839e-04f, -1.306187922e-04f, 5.912501711e-04f,
+    -1.617010089e-03f, 3.556379129e-03f, -6.878336219e-03f, 1.225457113e-02f, -2.082044662e-02f, 3.506290311e-02f,
+    -6.267059063e-02f, 1.471932744e-01f, 9.700944356e-01f, -1.104465400e-01f, 5.294112318e-02f, -3.041816681e-02f,
+    1.810516020e-02f, -1.055651333e-02f, 5.816739636e-03f, -2.921438331e-03f, 1.267896446e-03f, -4.240722429e-04f,
+    -1.287727112e-04f, 5.837099990e-04f, -1.597130598e-03f, 3.513543220e-03f, -6.796569287e-03f, 1.211010914e-02f,
+    -2.057597827e-02f, 3.465030279e-02f, -6.192156727e-02f, 1.453081369e-01f, 9.707807327e-01f, -1.094009058e-01f,
+    5.241134863e-02f, -3.010997958e-02f, 1.792168447e-02f, -1.045018383e-02f, 5.758811082e-03f, -2.892861332e-03f,
+    1.255858862e-03f, -4.202891365e-04f, -1.269334884e-04f, 5.761808201e-04f, -1.577263238e-03f, 3.470712859e-03f,
+    -6.714787622e-03f, 1.196559274e-02f, -2.033139617e-02f, 3.423753757e-02f, -6.117255187e-02f, 1.434265382e-01f,
+    9.714592808e-01f, -1.083494597e-01f, 5.187928147e-02f, -2.980054369e-02f, 1.773746409e-02f, -1.034340597e-02f,
+    5.700621581e-03f, -2.864142554e-03f, 1.243752298e-03f, -4.164780769e-04f, -1.251011629e-04f, 5.686628215e-04f,
+    -1.557408517e-03f, 3.427889155e-03f, -6.632993340e-03f, 1.182102567e-02f, -2.008670657e-02f, 3.382461779e-02f,
+    -6.042356203e-02f, 1.415484995e-01f, 9.721300698e-01f, -1.072922067e-01f, 5.134493008e-02f, -2.948986470e-02f,
+    1.755250245e-02f, -1.023618168e-02f, 5.642172119e-03f, -2.835282431e-03f, 1.231576896e-03f, -4.126390773e-04f,
+    -1.232757733e-04f, 5.611561890e-04f, -1.537566945e-03f, 3.385073215e-03f, -6.551188557e-03f, 1.167641164e-02f,
+    -1.984191573e-02f, 3.341155380e-02f, -5.967461530e-02f, 1.396740419e-01f, 9.727930895e-01f, -1.062291517e-01f,
+    5.080830291e-02f, -2.917794821e-02f, 1.736680296e-02f, -1.012851288e-02f, 5.583463690e-03f, -2.806281401e-03f,
+    1.219332798e-03f, -4.087721518e-04f, -1.214573579e-04f, 5.536611077e-04f, -1.517739026e-03f, 3.342266141e-03f,
+    -6.469375382e-03f, 1.153175438e-02f, -1.959702988e-02f, 3.299835592e-02f, -5.892572920e-02f, 1.378031866e-01f,
+    9.734483299e-01f, -1.051602996e-01f, 5.026940850e-02f, -2.886479987e-02f, 1.718036905e-02f, -1.002040153e-02f,
+    5.524497298e-03f, -2.777139906e-03f, 1.207020150e-03f, -4.048773155e-04f, -1.196459545e-04f, 5.461777616e-04f,
+    -1.497925267e-03f, 3.299469034e-03f, -6.387555925e-03f, 1.138705759e-02f, -1.935205525e-02f, 3.258503443e-02f,
+    -5.817692120e-02f, 1.359359546e-01f, 9.740957813e-01f, -1.040856558e-01f, 4.972825543e-02f, -2.855042536e-02f,
+    1.699320418e-02f, -9.911849590e-03f, 5.465273954e-03f, -2.747858394e-03f, 1.194639101e-03f, -4.009545845e-04f,
+    -1.178416004e-04f, 5.387063339e-04f, -1.478126168e-03f, 3.256682993e-03f, -6.305732286e-03f, 1.124232498e-02f,
+    -1.910699805e-02f, 3.217159965e-02f, -5.742820876e-02f, 1.340723667e-01f, 9.747354338e-01f, -1.030052255e-01f,
+    4.918485235e-02f, -2.823483040e-02f, 1.680531183e-02f, -9.802859037e-03f, 5.405794679e-03f, -2.718437318e-03f,
+    1.182189800e-03f, -3.970039758e-04f, -1.160443325e-04f, 5.312470067e-04f, -1.458342233e-03f, 3.213909113e-03f,
+    -6.223906567e-03f, 1.109756026e-02f, -1.886186451e-02f, 3.175806185e-02f, -5.667960929e-02f, 1.322124438e-01f,
+    9.753672778e-01f, -1.019190141e-01f, 4.863920800e-02f, -2.791802076e-02f, 1.661669551e-02f, -9.693431864e-03f,
+    5.346060502e-03f, -2.688877134e-03f, 1.169672400e-03f, -3.930255073e-04f, -1.142541872e-04f, 5.237999612e-04f,
+    -1.438573960e-03f, 3.171148488e-03f, -6.142080862e-03f, 1.095276712e-02f, -1.861666082e-02f, 3.134443129e-02f,
+    -5.593114017e-02f, 1.303562067e-01f, 9.759913038e-01f, -1.008270270e-01f, 4.809133117e-02f, -2.760000224e-02f,
+    1.642735874e-02f, -9.583570079e-03f, 5.286072460e-03f, -2.659178304e-03f, 1.157087057e-03f, -3.890191980e-04f,
+    -1.124712006e-04f, 5.163653775e-04f, -1.418821847e-03f, 3.128402207e-03f, -6.060257264e-03f, 1.080794925e-02f,
+    -1.837139320e-02f, 3.093071822e-02f, -5.518281873e-02f, 1.285036760e-01f, 9.766075024e-01f, -9.972926981e-02f,
+    4.754123071e-02f, -2.728078067e-02f, 1.623730508e-02f, -9.473275703e-03f, 5.225831601e-03f, -2.629341296e-03f,
+    1.144433927e-03f, -3.849850677e-04f, -1.106954083e-04f, 5.089434349e-04f, -1.399086390e-03f, 3.085671359e-03f,
+    -5.978437860e-03f, 1.066311033e-02f, -1.812606782e-02f, 3.051693288e-02f, -5.443466227e-02f, 1.266548723e-01f,
+    9.772158644e-01f, -9.862574829e-02f, 4.698891555e-02f, -2.696036193e-02f, 1.604653811e-02f, -9.362550772e-03f,
+    5.165338978e-03f, -2.599366579e-03f, 1.131713172e-03f, -3.809231374e-04f, -1.089268454e-04f, 5.015343116e-04f,
+    -1.379368082e-03f, 3.042957027e-03f, -5.896624733e-03f, 1.051825405e-02f, -1.788069086e-02f, 3.010308548e-02f,
+    -5.368668806e-02f, 1.248098161e-01f, 9.778163804e-01f, -9.751646822e-02f, 4.643439469e-02f, -2.663875193e-02f,
+    1.585506142e-02f, -9.251397336e-03f, 5.104595656e-03f, -2.569254632e-03f, 1.118924952e-03f, -3.768334287e-04f,
+    -1.071655466e-04f, 4.941381850e-04f, -1.359667418e-03f, 3.000260294e-03f, -5.814819965e-03f, 1.037338408e-02f,
+    -1.763526851e-02f, 2.968918624e-02f, -5.293891333e-02f, 1.229685279e-01f, 9.784090416e-01f, -9.640143551e-02f,
+    4.587767720e-02f, -2.631595664e-02f, 1.566287864e-02f, -9.139817462e-03f, 5.043602707e-03f, -2.539005935e-03f,
+    1.106069432e-03f, -3.727159646e-04f, -1.054115462e-04f, 4.867552313e-04f, -1.339984887e-03f, 2.957582239e-03f,
+    -5.733025629e-03f, 1.022850408e-02f, -1.738980691e-02f, 2.927524534e-02f, -5.219135527e-02f, 1.211310280e-01f,
+    9.789938390e-01f, -9.528065617e-02f, 4.531877219e-02f, -2.599198204e-02f, 1.546999342e-02f, -9.027813228e-03f,
+    4.982361212e-03f, -2.508620973e-03f, 1.093146781e-03f, -3.685707688e-04f, -1.036648780e-04f, 4.793856259e-04f,
+    -1.320320978e-03f, 2.914923939e-03f, -5.651243798e-03f, 1.008361772e-02f, -1.714431224e-02f, 2.886127295e-02f,
+    -5.144403104e-02f, 1.192973366e-01f, 9.795707637e-01f, -9.415413632e-02f, 4.475768887e-02f, -2.566683417e-02f,
+    1.527640942e-02f, -8.915386729e-03f, 4.920872259e-03f, -2.478100237e-03f, 1.080157165e-03f, -3.643978660e-04f,
+    -1.019255754e-04f, 4.720295431e-04f, -1.300676179e-03f, 2.872286467e-03f, -5.569476539e-03f, 9.938728650e-03f,
+    -1.689879063e-02f, 2.844727924e-02f, -5.069695774e-02f, 1.174674740e-01f, 9.801398071e-01f, -9.302188218e-02f,
+    4.419443649e-02f, -2.534051909e-02f, 1.508213034e-02f, -8.802540073e-03f, 4.859136948e-03f, -2.447444223e-03f,
+    1.067100758e-03f, -3.601972821e-04f, -1.001936713e-04f, 4.646871562e-04f, -1.281050975e-03f, 2.829670893e-03f,
+    -5.487725915e-03f, 9.793840527e-03f, -1.665324822e-02f, 2.803327434e-02f, -4.995015245e-02f, 1.156414602e-01f,
+    9.807009606e-01f, -9.188390009e-02f, 4.362902439e-02f, -2.501304292e-02f, 1.488715989e-02f, -8.689275381e-03f,
+    4.797156383e-03f, -2.416653430e-03f, 1.053977734e-03f, -3.559690435e-04f, -9.846919834e-05f, 4.573586377e-04f,
+    -1.261445849e-03f, 2.787078286e-03f, -5.405993985e-03f, 9.648956990e-03f, -1.640769113e-02f, 2.761926838e-02f,
+    -4.920363220e-02f, 1.138193152e-01f, 9.812542158e-01f, -9.074019649e-02f, 4.306146196e-02f, -2.468441179e-02f,
+    1.469150182e-02f, -8.575594793e-03f, 4.734931681e-03f, -2.385728364e-03f, 1.040788268e-03f, -3.517131782e-04f,
+    -9.675218846e-05f, 4.500441588e-04f, -1.241861284e-03f, 2.744509710e-03f, -5.324282803e-03f, 9.504081678e-03f,
+    -1.616212550e-02f, 2.720527147e-02f, -4.845741401e-02f, 1.120010590e-01f, 9.817995642e-01f, -8.959077791e-02f,
+    4.249175866e-02f, -2.435463190e-02f, 1.449515989e-02f, -8.461500458e-03f, 4.672463965e-03f, -2.354669533e-03f,
+    1.027532541e-03f, -3.474297147e-04f, -9.504267336e-05f, 4.427438899e-04f, -1.222297758e-03f, 2.701966227e-03f,
+    -5.242594419e-03f, 9.359218221e-03f, -1.591655742e-02f, 2.679129370e-02f, -4.771151482e-02f, 1.101867114e-01f,
+    9.823369977e-01f, -8.843565100e-02f, 4.191992403e-02f, -2.402370946e-02f, 1.429813789e-02f, -8.346994542e-03f,
+    4.609754366e-03f, -2.323477453e-03f, 1.014210731e-03f, -3.431186828e-04f, -9.334068424e-05f, 4.354580006e-04f,
+    -1.202755751e-03f, 2.659448896e-03f, -5.160930879e-03f, 9.214370244e-03f, -1.567099300e-02f, 2.637734515e-02f,
+    -4.696595156e-02f, 1.083762922e-01f, 9.828665083e-01f, -8.727482252e-02f, 4.134596765e-02f, -2.369165073e-02f,
+    1.410043962e-02f, -8.232079225e-03f, 4.546804026e-03f, -2.292152642e-03f, 1.000823025e-03f, -3.387801130e-04f,
+    -9.164625187e-05f, 4.281866590e-04f, -1.183235738e-03f, 2.616958773e-03f, -5.079294224e-03f, 9.069541366e-03f,
+    -1.542543832e-02f, 2.596343589e-02f, -4.622074110e-02f, 1.065698210e-01f, 9.833880878e-01f, -8.610829933e-02f,
+    4.076989920e-02f, -2.335846202e-02f, 1.390206892e-02f, -8.116756700e-03f, 4.483614093e-03f, -2.260695624e-03f,
+    9.873696060e-04f, -3.344140371e-04f, -8.995940657e-05f, 4.209300326e-04f, -1.163738194e-03f, 2.574496912e-03f,
+    -4.997686491e-03f, 8.924735198e-03f, -1.517989947e-02f, 2.554957594e-02f, -4.547590028e-02f, 1.047673175e-01f,
+    9.839017285e-01f, -8.493608838e-02f, 4.019172838e-02f, -2.302414965e-02f, 1.370302964e-02f, -8.001029177e-03f,
+    4.420185724e-03f, -2.229106927e-03f, 9.738506641e-04f, -3.300204876e-04f, -8.828017825e-05f, 4.136882878e-04f,
+    -1.144263592e-03f, 2.532064361e-03f, -4.916109712e-03f, 8.779955345e-03f, -1.493438250e-02f, 2.513577533e-02f,
+    -4.473144591e-02f, 1.029688011e-01f, 9.844074225e-01f, -8.375819675e-02f, 3.961146501e-02f, -2.268872000e-02f,
+    1.350332567e-02f, -7.884898876e-03f, 4.356520086e-03f, -2.197387085e-03f, 9.602663894e-04f, -3.255994982e-04f,
+    -8.660859637e-05f, 4.064615899e-04f, -1.124812401e-03f, 2.489662168e-03f, -4.834565914e-03f, 8.635205405e-03f,
+    -1.468889350e-02f, 2.472204407e-02f, -4.398739473e-02f, 1.011742912e-01f, 9.849051624e-01f, -8.257463162e-02f,
+    3.902911894e-02f, -2.235217948e-02f, 1.330296090e-02f, -7.768368034e-03f, 4.292618353e-03f, -2.165536637e-03f,
+    9.466169749e-04f, -3.211511036e-04f, -8.494468995e-05f, 3.992501033e-04f, -1.105385092e-03f, 2.447291377e-03f,
+    -4.753057120e-03f, 8.490488971e-03f, -1.444343849e-02f, 2.430839216e-02f, -4.324376347e-02f, 9.938380723e-02f,
+    9.853949405e-01f, -8.138540026e-02f, 3.844470009e-02f, -2.201453453e-02f, 1.310193926e-02f, -7.651438902e-03f,
+    4.228481708e-03f, -2.133556124e-03f, 9.329026162e-04f, -3.166753393e-04f, -8.328848759e-05f, 3.920539914e-04f,
+    -1.085982130e-03f, 2.404953029e-03f, -4.671585349e-03f, 8.345809625e-03f, -1.419802353e-02f, 2.389482955e-02f,
+    -4.250056880e-02f, 9.759736837e-02f, 9.858767495e-01f, -8.019051005e-02f, 3.785821845e-02f, -2.167579165e-02f,
+    1.290026469e-02f, -7.534113744e-03f, 4.164111341e-03f, -2.101446093e-03f, 9.191235111e-04f, -3.121722421e-04f,
+    -8.164001745e-05f, 3.848734164e-04f, -1.066603982e-03f, 2.362648160e-03f, -4.590152613e-03f, 8.201170947e-03f,
+    -1.395265463e-02f, 2.348136620e-02f, -4.175782735e-02f, 9.581499379e-02f, 9.863505822e-01f, -7.898996850e-02f,
+    3.726968409e-02f, -2.133595735e-02f, 1.269794116e-02f, -7.416394837e-03f, 4.099508452e-03f, -2.069207098e-03f,
+    9.052798597e-04f, -3.076418495e-04f, -7.999930725e-05f, 3.777085398e-04f, -1.047251109e-03f, 2.320377806e-03f,
+    -4.508760922e-03f, 8.056576506e-03f, -1.370733782e-02f, 2.306801204e-02f, -4.101555572e-02f, 9.403670256e-02f,
+    9.868164313e-01f, -7.778378319e-02f, 3.667910712e-02f, -2.099503818e-02f, 1.249497267e-02f, -7.298284475e-03f,
+    4.034674249e-03f, -2.036839695e-03f, 8.913718646e-04f, -3.030842002e-04f, -7.836638430e-05f, 3.705595218e-04f,
+    -1.027923973e-03f, 2.278142998e-03f, -4.427412279e-03f, 7.912029866e-03f, -1.346207910e-02f, 2.265477699e-02f,
+    -4.027377045e-02f, 9.226251367e-02f, 9.872742898e-01f, -7.657196183e-02f, 3.608649772e-02f, -2.065304076e-02f,
+    1.229136323e-02f, -7.179784963e-03f, 3.969609949e-03f, -2.004344446e-03f, 8.773997308e-04f, -2.984993339e-04f,
+    -7.674127545e-05f, 3.634265217e-04f, -1.008623034e-03f, 2.235944764e-03f, -4.346108684e-03f, 7.767534583e-03f,
+    -1.321688447e-02f, 2.224167095e-02f, -3.953248806e-02f, 9.049244601e-02f, 9.877241510e-01f, -7.535451222e-02f,
+    3.549186616e-02f, -2.030997170e-02f, 1.208711687e-02f, -7.060898621e-03f, 3.904316775e-03f, -1.971721916e-03f,
+    8.633636656e-04f, -2.938872913e-04f, -7.512400713e-05f, 3.563096978e-04f, -9.893487492e-04f, 2.193784129e-03f,
+    -4.264852129e-03f, 7.623094207e-03f, -1.297175991e-02f, 2.182870379e-02f, -3.879172500e-02f, 8.872651839e-02f,
+    9.881660078e-01f, -7.413144227e-02f, 3.489522275e-02f, -1.996583768e-02f, 1.188223767e-02f, -6.941627783e-03f,
+    3.838795962e-03f, -1.938972677e-03f, 8.492638787e-04f, -2.892481139e-04f, -7.351460535e-05f, 3.492092074e-04f,
+    -9.701015734e-04f, 2.151662114e-03f, -4.183644605e-03f, 7.478712278e-03f, -1.272671139e-02f, 2.141588536e-02f,
+    -3.805149769e-02f, 8.696474953e-02f, 9.885998538e-01f, -7.290276000e-02f, 3.429657787e-02f, -1.962064540e-02f,
+    1.167672968e-02f, -6.821974797e-03f, 3.773048749e-03f, -1.906097305e-03f, 8.351005823e-04f, -2.845818446e-04f,
+    -7.191309567e-05f, 3.421252066e-04f, -9.508819603e-04f, 2.109579739e-03f, -4.102488096e-03f, 7.334392331e-03f,
+    -1.248174489e-02f, 2.100322551e-02f, -3.731182252e-02f, 8.520715807e-02f, 9.890256824e-01f, -7.166847354e-02f,
+    3.369594197e-02f, -1.927440162e-02f, 1.147059703e-02f, -6.701942025e-03f, 3.707076386e-03f, -1.873096379e-03f,
+    8.208739908e-04f, -2.798885270e-04f, -7.031950324e-05f, 3.350578507e-04f, -9.316903615e-04f, 2.067538018e-03f,
+    -4.021384580e-03f, 7.190137893e-03f, -1.223686633e-02f, 2.059073405e-02f, -3.657271582e-02f, 8.345376254e-02f,
+    9.894434871e-01f, -7.042859110e-02f, 3.309332557e-02f, -1.892711309e-02f, 1.126384384e-02f, -6.581531840e-03f,
+    3.640880132e-03f, -1.839970485e-03f, 8.065843210e-04f, -2.751682059e-04f, -6.873385277e-05f, 3.280072938e-04f,
+    -9.125272265e-04f, 2.025537963e-03f, -3.940336032e-03f, 7.045952482e-03f, -1.199208168e-02f, 2.017842078e-02f,
+    -3.583419388e-02f, 8.170458141e-02f, 9.898532617e-01f, -6.918312102e-02f, 3.248873923e-02f, -1.857878665e-02f,
+    1.105647425e-02f, -6.460746633e-03f, 3.574461252e-03f, -1.806720213e-03f, 7.922317923e-04f, -2.704209270e-04f,
+    -6.715616853e-05f, 3.209736891e-04f, -8.933930031e-04f, 1.983580583e-03f, -3.859344420e-03f, 6.901839610e-03f,
+    -1.174739684e-02f, 1.976629548e-02f, -3.509627294e-02f, 7.995963304e-02f, 9.902549999e-01f, -6.793207174e-02f,
+    3.188219360e-02f, -1.822942914e-02f, 1.084849244e-02f, -6.339588805e-03f, 3.507821020e-03f, -1.773346156e-03f,
+    7.778166262e-04f, -2.656467370e-04f, -6.558647439e-05f, 3.139571887e-04f, -8.742881368e-04f, 1.941666883e-03f,
+    -3.778411708e-03f, 6.757802780e-03f, -1.150281775e-02f, 1.935436790e-02f, -3.435896920e-02f, 7.821893571e-02f,
+    9.906486957e-01f, -6.667545179e-02f, 3.127369938e-02f, -1.787904744e-02f, 1.063990260e-02f, -6.218060773e-03f,
+    3.440960718e-03f, -1.739848914e-03f, 7.633390468e-04f, -2.608456838e-04f, -6.402479377e-05f, 3.069579437e-04f,
+    -8.552130712e-04f, 1.899797866e-03f, -3.697539855e-03f, 6.613845488e-03f, -1.125835029e-02f, 1.894264779e-02f,
+    -3.362229883e-02f, 7.648250761e-02f, 9.910343431e-01f, -6.541326982e-02f, 3.066326735e-02f, -1.752764849e-02f,
+    1.043070893e-02f, -6.096164966e-03f, 3.373881639e-03f, -1.706229090e-03f, 7.487992805e-04f, -2.560178162e-04f,
+    -6.247114967e-05f, 2.999761040e-04f, -8.361682479e-04f, 1.857974529e-03f, -3.616730814e-03f, 6.469971222e-03f,
+    -1.101400036e-02f, 1.853114485e-02f, -3.288627793e-02f, 7.475036683e-02f, 9.914119365e-01f, -6.414553459e-02f,
+    3.005090834e-02f, -1.717523925e-02f, 1.022091568e-02f, -5.973903828e-03f, 3.306585079e-03f, -1.672487293e-03f,
+    7.341975559e-04f, -2.511631840e-04f, -6.092556466e-05f, 2.930118189e-04f, -8.171541068e-04f, 1.816197868e-03f,
+    -3.535986532e-03f, 6.326183463e-03f, -1.076977384e-02f, 1.811986878e-02f, -3.215092258e-02f, 7.302253138e-02f,
+    9.917814699e-01f, -6.287225494e-02f, 2.943663325e-02f, -1.682182670e-02f, 1.001052711e-02f, -5.851279814e-03f,
+    3.239072347e-03f, -1.638624135e-03f, 7.195341043e-04f, -2.462818381e-04f, -5.938806090e-05f, 2.860652361e-04f,
+    -7.981710853e-04f, 1.774468874e-03f, -3.455308952e-03f, 6.182485680e-03f, -1.052567660e-02f, 1.770882926e-02f,
+    -3.141624879e-02f, 7.129901918e-02f, 9.921429380e-01f, -6.159343984e-02f, 2.882045304e-02f, -1.646741788e-02f,
+    9.799547494e-03f, -5.728295396e-03f, 3.171344757e-03f, -1.604640235e-03f, 7.048091591e-04f, -2.413738304e-04f,
+    -5.785866010e-05f, 2.791365026e-04f, -7.792196191e-04f, 1.732788537e-03f, -3.374700012e-03f, 6.038881339e-03f,
+    -1.028171448e-02f, 1.729803593e-02f, -3.068227253e-02f, 6.957984806e-02f, 9.924963352e-01f, -6.030909836e-02f,
+    2.820237873e-02f, -1.611201985e-02f, 9.587981130e-03f, -5.604953056e-03f, 3.103403632e-03f, -1.570536214e-03f,
+    6.900229563e-04f, -2.364392138e-04f, -5.633738357e-05f, 2.722257644e-04f, -7.603001419e-04f, 1.691157841e-03f,
+    -3.294161644e-03f, 5.895373895e-03f, -1.003789334e-02f, 1.688749843e-02f, -2.994900974e-02f, 6.786503576e-02f,
+    9.928416562e-01f, -5.901923965e-02f, 2.758242142e-02f, -1.575563972e-02f, 9.375832343e-03f, -5.481255292e-03f,
+    3.035250304e-03f, -1.536312699e-03f, 6.751757341e-04f, -2.314780423e-04f, -5.482425219e-05f, 2.653331663e-04f,
+    -7.414130851e-04f, 1.649577767e-03f, -3.213695773e-03f, 5.751966794e-03f, -9.794218987e-03f, 1.647722637e-02f,
+    -2.921647631e-02f, 6.615459991e-02f, 9.931788957e-01f, -5.772387299e-02f, 2.696059225e-02f, -1.539828462e-02f,
+    9.163105476e-03f, -5.357204614e-03f, 2.966886113e-03f, -1.501970321e-03f, 6.602677333e-04f, -2.264903709e-04f,
+    -5.331928641e-05f, 2.584588521e-04f, -7.225588783e-04f, 1.608049294e-03f, -3.133304321e-03f, 5.608663476e-03f,
+    -9.550697248e-03f, 1.606722932e-02f, -2.848468806e-02f, 6.444855808e-02f, 9.935080488e-01f, -5.642300777e-02f,
+    2.633690245e-02f, -1.503996173e-02f, 8.949804896e-03f, -5.232803545e-03f, 2.898312405e-03f, -1.467509717e-03f,
+    6.452991967e-04f, -2.214762555e-04f, -5.182250625e-05f, 2.516029645e-04f, -7.037379491e-04f, 1.566573395e-03f,
+    -3.052989202e-03f, 5.465467371e-03f, -9.307333923e-03f, 1.565751687e-02f, -2.775366078e-02f, 6.274692773e-02f,
+    9.938291105e-01f, -5.511665345e-02f, 2.571136329e-02f, -1.468067825e-02f, 8.735934988e-03f, -5.108054622e-03f,
+    2.829530536e-03f, -1.432931527e-03f, 6.302703699e-04f, -2.164357534e-04f, -5.033393134e-05f, 2.447656453e-04f,
+    -6.849507228e-04f, 1.525151043e-03f, -2.972752328e-03f, 5.322381901e-03f, -9.064134801e-03f, 1.524809854e-02f,
+    -2.702341023e-02f, 6.104972622e-02f, 9.941420758e-01f, -5.380481964e-02f, 2.508398612e-02f, -1.432044143e-02f,
+    8.521500160e-03f, -4.982960395e-03f, 2.760541870e-03f, -1.398236396e-03f, 6.151815006e-04f, -2.113689225e-04f,
+    -4.885358086e-05f, 2.379470351e-04f, -6.661976229e-04f, 1.483783203e-03f, -2.892595601e-03f, 5.179410479e-03f,
+    -8.821105657e-03f, 1.483898386e-02f, -2.629395209e-02f, 5.935697085e-02f, 9.944469401e-01f, -5.248751601e-02f,
+    2.445478233e-02f, -1.395925854e-02f, 8.306504841e-03f, -4.857523428e-03f, 2.691347779e-03f, -1.363424974e-03f,
+    6.000328389e-04f, -2.062758221e-04f, -4.738147359e-05f, 2.311472736e-04f, -6.474790706e-04f, 1.442470841e-03f,
+    -2.812520920e-03f, 5.036556509e-03f, -8.578252253e-03f, 1.443018233e-02f, -2.556530201e-02f, 5.766867878e-02f,
+    9.947436988e-01f, -5.116475236e-02f, 2.382376341e-02f, -1.359713689e-02f, 8.090953481e-03f, -4.731746295e-03f,
+    2.621949641e-03f, -1.328497915e-03f, 5.848246374e-04f, -2.011565122e-04f, -4.591762787e-05f, 2.243664993e-04f,
+    -6.287954852e-04f, 1.401214916e-03f, -2.732530178e-03f, 4.893823389e-03f, -8.335580338e-03f, 1.402170341e-02f,
+    -2.483747560e-02f, 5.598486714e-02f, 9.950323474e-01f, -4.983653859e-02f, 2.319094087e-02f, -1.323408384e-02f,
+    7.874850551e-03f, -4.605631586e-03f, 2.552348844e-03f, -1.293455879e-03f, 5.695571509e-04f, -1.960110543e-04f,
+    -4.446206164e-05f, 2.176048498e-04f, -6.101472839e-04f, 1.360016386e-03f, -2.652625261e-03f, 4.751214504e-03f,
+    -8.093095647e-03f, 1.361355657e-02f, -2.411048840e-02f, 5.430555290e-02f, 9.953128816e-01f, -4.850288470e-02f,
+    2.255632632e-02f, -1.287010675e-02f, 7.658200543e-03f, -4.479181905e-03f, 2.482546784e-03f, -1.258299529e-03f,
+    5.542306367e-04f, -1.908395104e-04f, -4.301479242e-05f, 2.108624615e-04f, -5.915348818e-04f, 1.318876202e-03f,
+    -2.572808053e-03f, 4.608733233e-03f, -7.850803901e-03f, 1.320575122e-02f, -2.338435593e-02f, 5.263075298e-02f,
+    9.955852971e-01f, -4.716380079e-02f, 2.191993140e-02f, -1.250521306e-02f, 7.441007969e-03f, -4.352399865e-03f,
+    2.412544863e-03f, -1.223029532e-03f, 5.388453545e-04f, -1.856419439e-04f, -4.157583731e-05f, 2.041394698e-04f,
+    -5.729586918e-04f, 1.277795315e-03f, -2.493080426e-03f, 4.466382945e-03f, -7.608710807e-03f, 1.279829677e-02f,
+    -2.265909362e-02f, 5.096048421e-02f, 9.958495898e-01f, -4.581929708e-02f, 2.128176783e-02f, -1.213941020e-02f,
+    7.223277363e-03f, -4.225288096e-03f, 2.342344494e-03f, -1.187646561e-03f, 5.234015662e-04f, -1.804184193e-04f,
+    -4.014521299e-05f, 1.974360091e-04f, -5.544191248e-04f, 1.236774670e-03f, -2.413444252e-03f, 4.324167000e-03f,
+    -7.366822059e-03f, 1.239120260e-02f, -2.193471689e-02f, 4.929476330e-02f, 9.961057557e-01f, -4.446938388e-02f,
+    2.064184740e-02f, -1.177270566e-02f, 7.005013279e-03f, -4.097849237e-03f, 2.271947094e-03f, -1.152151294e-03f,
+    5.078995361e-04f, -1.751690018e-04f, -3.872293574e-05f, 1.907522128e-04f, -5.359165896e-04f, 1.195815210e-03f,
+    -2.333901394e-03f, 4.182088751e-03f, -7.125143335e-03f, 1.198447807e-02f, -2.121124111e-02f, 4.763360687e-02f,
+    9.963537911e-01f, -4.311407160e-02f, 2.000018195e-02f, -1.140510695e-02f, 6.786220292e-03f, -3.970085944e-03f,
+    2.201354091e-03f, -1.116544412e-03f, 4.923395311e-04f, -1.698937581e-04f, -3.730902141e-05f, 1.840882130e-04f,
+    -5.174514928e-04f, 1.154917872e-03f, -2.254453709e-03f, 4.040151537e-03f, -6.883680300e-03f, 1.157813250e-02f,
+    -2.048868156e-02f, 4.597703148e-02f, 9.965936920e-01f, -4.175337076e-02f, 1.935678337e-02f, -1.103662164e-02f,
+    6.566902997e-03f, -3.842000883e-03f, 2.130566920e-03f, -1.080826601e-03f, 4.767218201e-04f, -1.645927554e-04f,
+    -3.590348545e-05f, 1.774441409e-04f, -4.990242391e-04f, 1.114083592e-03f, -2.175103050e-03f, 3.898358694e-03f,
+    -6.642438606e-03f, 1.117217521e-02f, -1.976705352e-02f, 4.432505355e-02f, 9.968254550e-01f, -4.038729198e-02f,
+    1.871166363e-02f, -1.066725730e-02f, 6.347066009e-03f, -3.713596732e-03f, 2.059587023e-03f, -1.044998552e-03f,
+    4.610466746e-04f, -1.592660625e-04f, -3.450634289e-05f, 1.708201267e-04f, -4.806352309e-04f, 1.073313300e-03f,
+    -2.095851262e-03f, 3.756713543e-03f, -6.401423886e-03f, 1.076661548e-02f, -1.904637220e-02f, 4.267768945e-02f,
+    9.970490765e-01f, -3.901584599e-02f, 1.806483477e-02f, -1.029702155e-02f, 6.126713965e-03f, -3.584876185e-03f,
+    1.988415851e-03f, -1.009060959e-03f, 4.453143684e-04f, -1.539137490e-04f, -3.311760835e-05f, 1.642162995e-04f,
+    -4.622848683e-04f, 1.032607925e-03f, -2.016700185e-03f, 3.615219399e-03f, -6.160641764e-03f, 1.036146257e-02f,
+    -1.832665274e-02f, 4.103495541e-02f, 9.972645532e-01f, -3.763904363e-02f, 1.741630886e-02f, -9.925922052e-03f,
+    5.905851520e-03f, -3.455841947e-03f, 1.917054860e-03f, -9.730145228e-04f, 4.295251776e-04f, -1.485358854e-04f,
+    -3.173729603e-05f, 1.576327872e-04f, -4.439735497e-04f, 9.919683880e-04f, -1.937651653e-03f, 3.473879567e-03f,
+    -5.920097846e-03f, 9.956725711e-03f, -1.760791026e-02f, 3.939686760e-02f, 9.974718818e-01f, -3.625689581e-02f,
+    1.676609805e-02f, -9.553966480e-03f, 5.684483352e-03f, -3.326496734e-03f, 1.845505518e-03f, -9.368599470e-04f,
+    4.136793807e-04f, -1.431325436e-04f, -3.036541975e-05f, 1.510697169e-04f, -4.257016709e-04f, 9.513956104e-04f,
+    -1.858707493e-03f, 3.332697341e-03f, -5.679797723e-03f, 9.552414111e-03f, -1.689015981e-02f, 3.776344208e-02f,
+    9.976710591e-01f, -3.486941358e-02f, 1.611421456e-02f, -9.181162558e-03f, 5.462614156e-03f, -3.196843276e-03f,
+    1.773769297e-03f, -9.005979401e-04f, 3.977772587e-04f, -1.377037962e-04f, -2.900199290e-05f, 1.445272144e-04f,
+    -4.074696260e-04f, 9.108905077e-04f, -1.779869526e-03f, 3.191676009e-03f, -5.439746972e-03f, 9.148536955e-03f,
+    -1.617341641e-02f, 3.613469483e-02f, 9.978620823e-01f, -3.347660807e-02f, 1.546067065e-02f, -8.807518035e-03f,
+    5.240248650e-03f, -3.066884316e-03f, 1.701847679e-03f, -8.642292153e-04f, 3.818190946e-04f, -1.322497172e-04f,
+    -2.764702846e-05f, 1.380054045e-04f, -3.892778064e-04f, 8.704539919e-04f, -1.701139568e-03f, 3.050818844e-03f,
+    -5.199951155e-03f, 8.745103400e-03f, -1.545769501e-02f, 3.451064171e-02f, 9.980449484e-01f, -3.207849052e-02f,
+    1.480547865e-02f, -8.433040698e-03f, 5.017391569e-03f, -2.936622609e-03f, 1.629742152e-03f, -8.277544898e-04f,
+    3.658051741e-04f, -1.267703814e-04f, -2.630053901e-05f, 1.315044110e-04f, -3.711266019e-04f, 8.300869714e-04f,
+    -1.622519427e-03f, 2.910129114e-03f, -4.960415818e-03f, 8.342122581e-03f, -1.474301051e-02f, 3.289129850e-02f,
+    9.982196546e-01f, -3.067507228e-02f, 1.414865095e-02f, -8.057738362e-03f, 4.794047670e-03f, -2.806060922e-03f,
+    1.557454213e-03f, -7.911744855e-04f, 3.497357850e-04f, -1.212658646e-04f, -2.496253673e-05f, 1.250243566e-04f,
+    -3.530163998e-04f, 7.897903505e-04f, -1.544010907e-03f, 2.769610076e-03f, -4.721146493e-03f, 7.939603602e-03f,
+    -1.402937777e-02f, 3.127668089e-02f, 9.983861984e-01f, -2.926636479e-02f, 1.349020001e-02f, -7.681618879e-03f,
+    4.570221729e-03f, -2.675202034e-03f, 1.484985366e-03f, -7.544899289e-04f, 3.336112175e-04f, -1.157362441e-04f,
+    -2.363303339e-05f, 1.185653630e-04f, -3.349475853e-04f, 7.495650300e-04f, -1.465615804e-03f, 2.629264975e-03f,
+    -4.482148695e-03f, 7.537555547e-03f, -1.331681158e-02f, 2.966680447e-02f, 9.985445772e-01f, -2.785237960e-02f,
+    1.283013834e-02f, -7.304690131e-03f, 4.345918542e-03f, -2.544048738e-03f, 1.412337122e-03f, -7.177015504e-04f,
+    3.174317643e-04f, -1.101815977e-04f, -2.231204035e-05f, 1.121275507e-04f, -3.169205415e-04f, 7.094119064e-04f,
+    -1.387335908e-03f, 2.489097049e-03f, -4.243427924e-03f, 7.135987468e-03f, -1.260532670e-02f, 2.806168472e-02f,
+    9.986947886e-01f, -2.643312836e-02f, 1.216847850e-02f, -6.926960032e-03f, 4.121142923e-03f, -2.412603838e-03f,
+    1.339511000e-03f, -6.808100854e-04f, 3.011977202e-04f, -1.046020046e-04f, -2.099956859e-05f, 1.057110392e-04f,
+    -2.989356490e-04f, 6.693318726e-04f, -1.309173002e-03f, 2.349109523e-03f, -4.004989666e-03f, 6.734908396e-03f,
+    -1.189493783e-02f, 2.646133703e-02f, 9.988368304e-01f, -2.500862281e-02f, 1.150523313e-02f, -6.548436529e-03f,
+    3.895899707e-03f, -2.280870150e-03f, 1.266508528e-03f, -6.438162732e-04f, 2.849093825e-04f, -9.899754502e-05f,
+    -1.969562865e-05f, 9.931594694e-05f, -2.809932867e-04f, 6.293258175e-04f, -1.231128864e-03f, 2.209305616e-03f,
+    -3.766839388e-03f, 6.334327332e-03f, -1.118565960e-02f, 2.486577671e-02f, 9.989707005e-01f, -2.357887482e-02f,
+    1.084041492e-02f, -6.169127602e-03f, 3.670193749e-03f, -2.148850503e-03f, 1.193331238e-03f, -6.067208579e-04f,
+    2.685670507e-04f, -9.336830016e-05f, -1.840023071e-05f, 9.294239136e-05f, -2.630938310e-04f, 5.893946261e-04f,
+    -1.153205265e-03f, 2.069688533e-03f, -3.528982543e-03f, 5.934253251e-03f, -1.047750662e-02f, 2.327501896e-02f,
+    9.990963968e-01f, -2.214389634e-02f, 1.017403661e-02f, -5.789041261e-03f, 3.444029922e-03f, -2.016547737e-03f,
+    1.119980674e-03f, -5.695245875e-04f, 2.521710268e-04f, -8.771435233e-05f, -1.711338453e-05f, 8.659048872e-05f,
+    -2.452376561e-04f, 5.495391795e-04f, -1.075403969e-03f, 1.930261471e-03f, -3.291424569e-03f, 5.534695103e-03f,
+    -9.770493417e-03f, 2.168907889e-02f, 9.992139174e-01f, -2.070369942e-02f, 9.506111024e-03f, -5.408185549e-03f,
+    3.217413118e-03f, -1.883964705e-03f, 1.046458383e-03f, -5.322282148e-04f, 2.357216150e-04f, -8.203578489e-05f,
+    -1.583509948e-05f, 8.026035427e-05f, -2.274251341e-04f, 5.097603546e-04f, -9.977267336e-04f, 1.791027616e-03f,
+    -3.054170887e-03f, 5.135661809e-03f, -9.064634482e-03f, 2.010797149e-02f, 9.993232606e-01f, -1.925829623e-02f,
+    8.836651017e-03f, -5.026568541e-03f, 2.990348249e-03f, -1.751104272e-03f, 9.727659223e-04f, -4.948324968e-04f,
+    2.192191219e-04f, -7.633268227e-05f, -1.456538452e-05f, 7.395210217e-05f, -2.096566349e-04f, 4.700590247e-04f,
+    -9.201753107e-04f, 1.651990144e-03f, -2.817226900e-03f, 4.737162264e-03f, -8.359944247e-03f, 1.853171168e-02f,
+    9.994244248e-01f, -1.780769902e-02f, 8.165669520e-03f, -4.644198342e-03f, 2.762840245e-03f, -1.617969313e-03f,
+    8.989048559e-04f, -4.573381946e-04f, 2.026638563e-04f, -7.060512997e-05f, -1.330424822e-05f, 6.766584553e-05f,
+    -1.919325259e-04f, 4.304360588e-04f, -8.427514449e-04f, 1.513152220e-03f, -2.580597997e-03f, 4.339205335e-03f,
+    -7.656437092e-03f, 1.696031428e-02f, 9.995174084e-01f, -1.635192016e-02f, 7.493179517e-03f, -4.261083090e-03f,
+    2.534894056e-03f, -1.484562719e-03f, 8.248767547e-04f, -4.197460741e-04f, 1.860561294e-04f, -6.485321453e-05f,
+    -1.205169878e-05f, 6.140169638e-05f, -1.742531728e-04f, 3.908923222e-04f, -7.654568743e-04f, 1.374516999e-03f,
+    -2.344289551e-03f, 3.941799862e-03f, -6.954127344e-03f, 1.539379399e-02f, 9.996022100e-01f, -1.489097211e-02f,
+    6.819194053e-03f, -3.877230953e-03f, 2.306514651e-03f, -1.350887388e-03f, 7.506831974e-04f, -3.820569051e-04f,
+    1.693962547e-04f, -5.907702359e-05f, -1.080774396e-05f, 5.515976570e-05f, -1.566189386e-04f, 3.514286758e-04f,
+    -6.882933303e-04f, 1.236087627e-03f, -2.108306915e-03f, 3.544954658e-03f, -6.253029272e-03f, 1.383216544e-02f,
+    9.996788284e-01f, -1.342486743e-02f, 6.143726229e-03f, -3.492650132e-03f, 2.077707017e-03f, -1.216946233e-03f,
+    6.763257698e-04f, -3.442714619e-04f, 1.526845480e-04f, -5.327664582e-05f, -9.572391166e-06f, 4.894016336e-05f,
+    -1.390301843e-04f, 3.120459769e-04f, -6.112625379e-04f, 1.097867236e-03f, -1.872655430e-03f, 3.148678506e-03f,
+    -5.553157097e-03f, 1.227544315e-02f, 9.997472624e-01f, -1.195361879e-02f, 5.466789204e-03f, -3.107348855e-03f,
+    1.848476158e-03f, -1.082742178e-03f, 6.018060650e-04f, -3.063905230e-04f, 1.359213276e-04f, -4.745217097e-05f,
+    -8.345647394e-06f, 4.274299821e-05f, -1.214872685e-04f, 2.727450784e-04f, -5.343662150e-04f, 9.598589504e-04f,
+    -1.637340416e-03f, 2.752980163e-03f, -4.854524980e-03f, 1.072364154e-02f, 9.998075110e-01f, -1.047723896e-02f,
+    4.788396197e-03f, -2.721335385e-03f, 1.618827101e-03f, -9.482781582e-04f, 5.271256833e-04f, -2.684148712e-04f,
+    1.191069137e-04f, -4.160368988e-05f, -7.127519254e-06f, 3.656837800e-05f, -1.039905479e-04f, 2.335268293e-04f,
+    -4.576060731e-04f, 8.220658827e-04f, -1.402367179e-03f, 2.357868357e-03f, -4.157147030e-03f, 9.176774929e-03f,
+    9.998595733e-01f, -8.995740789e-03f, 4.108560484e-03f, -2.334618013e-03f, 1.388764887e-03f, -8.135571204e-04f,
+    4.522862324e-04f, -2.303452938e-04f, 1.022416292e-04f, -3.573129442e-05f, -5.918012969e-06f, 3.041640941e-05f,
+    -8.654037658e-05f, 1.943920745e-04f, -3.809838167e-04f, 6.844911349e-04f, -1.167741007e-03f, 1.963351789e-03f,
+    -3.461037301e-03f, 7.634857546e-03f, 9.999034485e-01f, -7.509137258e-03f, 3.427295396e-03f, -1.947205061e-03f,
+    1.158294577e-03f, -6.785820234e-04f, 3.772893271e-04f, -1.921825819e-04f, 8.532579903e-05f, -2.983507754e-05f,
+    -4.717134371e-06f, 2.428719806e-05f, -6.913710655e-05f, 1.553416549e-04f, -3.045011437e-04f, 5.471377980e-04f,
+    -9.334671706e-04f, 1.569439129e-03f, -2.766209793e-03f, 6.097903516e-03f, 9.999391360e-01f, -6.017441431e-03f,
+    2.744614324e-03f, -1.559104882e-03f, 9.274212502e-04f, -5.433558371e-04f, 3.021365892e-04f, -1.539275312e-04f,
+    6.835975055e-05f, -2.391513327e-05f, -3.524888906e-06f, 1.818084850e-05f, -5.178108754e-05f, 1.163764071e-04f,
+    -2.281597449e-04f, 4.100089522e-04f, -6.995509239e-04f, 1.176139021e-03f, -2.072678448e-03f, 4.565926867e-03f,
+    9.999666352e-01f, -4.520666475e-03f, 2.060530716e-03f, -1.170325859e-03f, 6.961500049e-04f, -4.078815431e-04f,
+    2.268296478e-04f, -1.155809416e-04f, 5.134381336e-05f, -1.797155669e-05f, -2.341281635e-06f, 1.209746421e-05f,
+    -3.447266701e-05f, 7.749716371e-05f, -1.519613044e-04f, 2.731076669e-04f, -4.659975035e-04f, 7.834600779e-04f,
+    -1.380457156e-03f, 3.038941528e-03f, 9.999859458e-01f, -3.018825656e-03f, 1.375058076e-03f, -7.808764047e-04f,
+    4.644859562e-04f, -2.721621343e-04f, 1.513701392e-04f, -7.714361695e-05f, 3.427831937e-05f, -1.200444395e-05f,
+    -1.166317236e-06f, 6.037147600e-06f, -1.721219019e-05f, 3.870475325e-05f, -7.590749934e-05f, 1.364370004e-04f,
+    -2.328121283e-04f, 3.914108858e-04f, -6.895597472e-04f, 1.516961329e-03f, 9.999970674e-01f, -1.511932342e-03f,
+    6.882099649e-04f, -3.907649608e-04f, 2.324342375e-04f, -1.362006148e-04f, 7.575970646e-05f, -3.861636562e-05f,
+    1.716360277e-05f, -6.013892295e-06f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_22050[] = {
+    -4.708765277e-05f, -1.535275944e-03f, 4.451000428e-03f, -4.783234399e-03f, -3.521118763e-03f, 2.074507636e-02f,
+    -3.331628841e-02f, 1.681955656e-02f, 4.593909610e-02f, -1.441893480e-01f, 2.364930829e-01f, 7.257322364e-01f,
+    2.364930829e-01f, -1.441893480e-01f, 4.593909610e-02f, 1.681955656e-02f, -3.331628841e-02f, 2.074507636e-02f,
+    -3.521118763e-03f, -4.783234399e-03f, 4.451000428e-03f, -1.535275944e-03f, -4.708765277e-05f, 1.568453234e-04f,
+    -4.106477076e-05f, -1.541776733e-03f, 4.438481347e-03f, -4.726119830e-03f, -3.613787665e-03f, 2.078757120e-02f,
+    -3.316911752e-02f, 1.641805011e-02f, 4.639714952e-02f, -1.440792864e-01f, 2.342779938e-01f, 7.257246215e-01f,
+    2.387094517e-01f, -1.442917591e-01f, 4.547713178e-02f, 1.722120519e-02f, -3.346197896e-02f, 2.070127773e-02f,
+    -3.427952430e-03f, -4.840274802e-03f, 4.463304776e-03f, -1.528644772e-03f, -5.314893500e-05f, 1.586732629e-04f,
+    -3.508066450e-05f, -1.548152932e-03f, 4.425765364e-03f, -4.668952162e-03f, -3.705968103e-03f, 2.082883908e-02f,
+    -3.302059993e-02f, 1.601676908e-02f, 4.685144566e-02f, -1.439621323e-01f, 2.320651158e-01f, 7.257044264e-01f,
+    2.409278956e-01f, -1.443870144e-01f, 4.501143864e-02f, 1.762303549e-02f, -3.360629887e-02f, 2.065625006e-02f,
+    -3.334305450e-03f, -4.897254888e-03f, 4.475409065e-03f, -1.521888643e-03f, -5.924858162e-05f, 1.605067088e-04f,
+    -2.913551167e-05f, -1.554404760e-03f, 4.412854024e-03f, -4.611734783e-03f, -3.797656568e-03f, 2.086888128e-02f,
+    -3.287074716e-02f, 1.561573378e-02f, 4.730197231e-02f, -1.438379174e-01f, 2.298545086e-01f, 7.256716520e-01f,
+    2.431483545e-01f, -1.444750832e-01f, 4.454202960e-02f, 1.802502697e-02f, -3.374923678e-02f, 2.060999227e-02f,
+    -3.240181452e-03f, -4.954171246e-03f, 4.487311773e-03f, -1.515007360e-03f, -6.538640305e-05f, 1.623455227e-04f,
+    -2.322948611e-05f, -1.560532443e-03f, 4.399748874e-03f, -4.554471072e-03f, -3.888849589e-03f, 2.090769916e-02f,
+    -3.271957074e-02f, 1.521496447e-02f, 4.774871750e-02f, -1.437066735e-01f, 2.276462316e-01f, 7.256262995e-01f,
+    2.453707683e-01f, -1.445559348e-01f, 4.406891779e-02f, 1.842715906e-02f, -3.389078137e-02f, 2.056250333e-02f,
+    -3.145584103e-03f, -5.011020456e-03f, 4.499011383e-03f, -1.508000733e-03f, -7.156220587e-05f, 1.641895649e-04f,
+    -1.736275785e-05f, -1.566536215e-03f, 4.386451471e-03f, -4.497164401e-03f, -3.979543733e-03f, 2.094529415e-02f,
+    -3.256708227e-02f, 1.481448132e-02f, 4.819166946e-02f, -1.435684325e-01f, 2.254403443e-01f, 7.255683704e-01f,
+    2.475950764e-01f, -1.446295388e-01f, 4.359211656e-02f, 1.882941114e-02f, -3.403092138e-02f, 2.051378228e-02f,
+    -3.050517107e-03f, -5.067799092e-03f, 4.510506384e-03f, -1.500868581e-03f, -7.777579281e-05f, 1.660386939e-04f,
+    -1.153549310e-05f, -1.572416315e-03f, 4.372963372e-03f, -4.439818130e-03f, -4.069735607e-03f, 2.098166772e-02f,
+    -3.241329337e-02f, 1.441430443e-02f, 4.863081667e-02f, -1.434232266e-01f, 2.232369059e-01f, 7.254978668e-01f,
+    2.498212184e-01f, -1.446958648e-01f, 4.311163948e-02f, 1.923176251e-02f, -3.416964556e-02f, 2.046382824e-02f,
+    -2.954984205e-03f, -5.124503717e-03f, 4.521795273e-03f, -1.493610728e-03f, -8.402696276e-05f, 1.678927671e-04f,
+    -5.747854276e-06f, -1.578172989e-03f, 4.359286144e-03f, -4.382435610e-03f, -4.159421853e-03f, 2.101682142e-02f,
+    -3.225821572e-02f, 1.401445385e-02f, 4.906614781e-02f, -1.432710881e-01f, 2.210359753e-01f, 7.254147909e-01f,
+    2.520491336e-01f, -1.447548829e-01f, 4.262750034e-02f, 1.963419244e-02f, -3.430694274e-02f, 2.041264036e-02f,
+    -2.858989177e-03f, -5.181130889e-03f, 4.532876551e-03f, -1.486227006e-03f, -9.031551073e-05f, 1.697516403e-04f,
+    -7.877451662e-19f, -1.583806492e-03f, 4.345421356e-03f, -4.325020185e-03f, -4.248599154e-03f, 2.105075687e-02f,
+    -3.210186101e-02f, 1.361494955e-02f, 4.949765177e-02f, -1.431120497e-01f, 2.188376115e-01f, 7.253191457e-01f,
+    2.542787613e-01f, -1.448065632e-01f, 4.213971315e-02f, 2.003668012e-02f, -3.444280179e-02f, 2.036021788e-02f,
+    -2.762535839e-03f, -5.237677157e-03f, 4.543748727e-03f, -1.478717256e-03f, -9.664122788e-05f, 1.716151678e-04f,
+    5.707914901e-06f, -1.589317082e-03f, 4.331370584e-03f, -4.267575187e-03f, -4.337264231e-03f, 2.108347572e-02f,
+    -3.194424098e-02f, 1.321581143e-02f, 4.992531769e-02f, -1.429461441e-01f, 2.166418731e-01f, 7.252109343e-01f,
+    2.565100404e-01f, -1.448508761e-01f, 4.164829214e-02f, 2.043920469e-02f, -3.457721162e-02f, 2.030656011e-02f,
+    -2.665628044e-03f, -5.294139064e-03f, 4.554410316e-03f, -1.471081323e-03f, -1.030039015e-04f, 1.734832026e-04f,
+    1.137573938e-05f, -1.594705026e-03f, 4.317135406e-03f, -4.210103939e-03f, -4.425413844e-03f, 2.111497972e-02f,
+    -3.178536742e-02f, 1.281705931e-02f, 5.034913491e-02f, -1.427734042e-01f, 2.144488188e-01f, 7.250901604e-01f,
+    2.587429099e-01f, -1.448877921e-01f, 4.115325177e-02f, 2.084174523e-02f, -3.471016117e-02f, 2.025166640e-02f,
+    -2.568269682e-03f, -5.350513146e-03f, 4.564859839e-03f, -1.463319062e-03f, -1.094033151e-04f, 1.753555962e-04f,
+    1.700332615e-05f, -1.599970599e-03f, 4.302717409e-03f, -4.152609754e-03f, -4.513044790e-03f, 2.114527064e-02f,
+    -3.162525213e-02f, 1.241871296e-02f, 5.076909299e-02f, -1.425938632e-01f, 2.122585068e-01f, 7.249568278e-01f,
+    2.609773087e-01f, -1.449172822e-01f, 4.065460669e-02f, 2.124428077e-02f, -3.484163947e-02f, 2.019553620e-02f,
+    -2.470464682e-03f, -5.406795931e-03f, 4.575095827e-03f, -1.455430334e-03f, -1.158392481e-04f, 1.772321986e-04f,
+    2.259053170e-05f, -1.605114078e-03f, 4.288118180e-03f, -4.095095934e-03f, -4.600153907e-03f, 2.117435035e-02f,
+    -3.146390695e-02f, 1.202079205e-02f, 5.118518172e-02f, -1.424075543e-01f, 2.100709954e-01f, 7.248109411e-01f,
+    2.632131753e-01f, -1.449393172e-01f, 4.015237179e-02f, 2.164679027e-02f, -3.497163556e-02f, 2.013816898e-02f,
+    -2.372217006e-03f, -5.462983942e-03f, 4.585116814e-03f, -1.447415008e-03f, -1.223114762e-04f, 1.791128587e-04f,
+    2.813721627e-05f, -1.610135751e-03f, 4.273339313e-03f, -4.037565772e-03f, -4.686738069e-03f, 2.120222076e-02f,
+    -3.130134377e-02f, 1.162331620e-02f, 5.159739111e-02f, -1.422145110e-01f, 2.078863426e-01f, 7.246525050e-01f,
+    2.654504484e-01f, -1.449538686e-01f, 3.964656219e-02f, 2.204925266e-02f, -3.510013856e-02f, 2.007956433e-02f,
+    -2.273530656e-03f, -5.519073694e-03f, 4.594921343e-03f, -1.439272960e-03f, -1.288197713e-04f, 1.809974235e-04f,
+    3.364324384e-05f, -1.615035909e-03f, 4.258382407e-03f, -3.980022550e-03f, -4.772794192e-03f, 2.122888383e-02f,
+    -3.113757450e-02f, 1.122630494e-02f, 5.200571137e-02f, -1.420147671e-01f, 2.057046062e-01f, 7.244815249e-01f,
+    2.676890664e-01f, -1.449609077e-01f, 3.913719320e-02f, 2.245164681e-02f, -3.522713762e-02f, 2.001972186e-02f,
+    -2.174409669e-03f, -5.575061696e-03f, 4.604507963e-03f, -1.431004074e-03f, -1.353639012e-04f, 1.828857390e-04f,
+    3.910848212e-05f, -1.619814853e-03f, 4.243249063e-03f, -3.922469539e-03f, -4.858319228e-03f, 2.125434161e-02f,
+    -3.097261108e-02f, 1.082977772e-02f, 5.241013296e-02f, -1.418083563e-01f, 2.035258440e-01f, 7.242980062e-01f,
+    2.699289675e-01f, -1.449604062e-01f, 3.862428037e-02f, 2.285395151e-02f, -3.535262194e-02f, 1.995864126e-02f,
+    -2.074858119e-03f, -5.630944453e-03f, 4.613875233e-03f, -1.422608242e-03f, -1.419436300e-04f, 1.847776497e-04f,
+    4.453280256e-05f, -1.624472887e-03f, 4.227940889e-03f, -3.864909999e-03f, -4.943310169e-03f, 2.127859618e-02f,
+    -3.080646549e-02f, 1.043375393e-02f, 5.281064653e-02f, -1.415953126e-01f, 2.013501133e-01f, 7.241019550e-01f,
+    2.721700901e-01f, -1.449523360e-01f, 3.810783945e-02f, 2.325614554e-02f, -3.547658080e-02f, 1.989632230e-02f,
+    -1.974880116e-03f, -5.686718460e-03f, 4.623021717e-03f, -1.414085361e-03f, -1.485587177e-04f, 1.866729985e-04f,
+    4.991608031e-05f, -1.629010324e-03f, 4.212459495e-03f, -3.807347181e-03f, -5.027764048e-03f, 2.130164970e-02f,
+    -3.063914974e-02f, 1.003825286e-02f, 5.320724298e-02f, -1.413756703e-01f, 1.991774715e-01f, 7.238933777e-01f,
+    2.744123720e-01f, -1.449366694e-01f, 3.758788644e-02f, 2.365820761e-02f, -3.559900349e-02f, 1.983276481e-02f,
+    -1.874479806e-03f, -5.742380210e-03f, 4.631945987e-03f, -1.405435340e-03f, -1.552089207e-04f, 1.885716272e-04f,
+    5.525819424e-05f, -1.633427480e-03f, 4.196806494e-03f, -3.749784323e-03f, -5.111677933e-03f, 2.132350438e-02f,
+    -3.047067586e-02f, 9.643293763e-03f, 5.359991341e-02f, -1.411494637e-01f, 1.970079757e-01f, 7.236722812e-01f,
+    2.766557513e-01f, -1.449133786e-01f, 3.706443751e-02f, 2.406011638e-02f, -3.571987938e-02f, 1.976796867e-02f,
+    -1.773661373e-03f, -5.797926188e-03f, 4.640646623e-03f, -1.396658091e-03f, -1.618939912e-04f, 1.904733761e-04f,
+    6.055902690e-05f, -1.637724681e-03f, 4.180983507e-03f, -3.692224652e-03f, -5.195048935e-03f, 2.134416249e-02f,
+    -3.030105591e-02f, 9.248895766e-03f, 5.398864914e-02f, -1.409167275e-01f, 1.948416827e-01f, 7.234386727e-01f,
+    2.789001658e-01f, -1.448824362e-01f, 3.653750910e-02f, 2.446185045e-02f, -3.583919790e-02f, 1.970193385e-02f,
+    -1.672429034e-03f, -5.853352876e-03f, 4.649122212e-03f, -1.387753538e-03f, -1.686136778e-04f, 1.923780839e-04f,
+    6.581846453e-05f, -1.641902256e-03f, 4.164992153e-03f, -3.634671384e-03f, -5.277874201e-03f, 2.136362636e-02f,
+    -3.013030200e-02f, 8.855077942e-03f, 5.437344171e-02f, -1.406774962e-01f, 1.926786495e-01f, 7.231925598e-01f,
+    2.811455533e-01f, -1.448438151e-01f, 3.600711782e-02f, 2.486338841e-02f, -3.595694852e-02f, 1.963466037e-02f,
+    -1.570787043e-03f, -5.908656748e-03f, 4.657371350e-03f, -1.378721608e-03f, -1.753677249e-04f, 1.942855883e-04f,
+    7.103639706e-05f, -1.645960542e-03f, 4.148834060e-03f, -3.577127723e-03f, -5.360150920e-03f, 2.138189837e-02f,
+    -2.995842625e-02f, 8.461859279e-03f, 5.475428289e-02f, -1.404318047e-01f, 1.905189325e-01f, 7.229339505e-01f,
+    2.833918513e-01f, -1.447974883e-01f, 3.547328053e-02f, 2.526470876e-02f, -3.607312077e-02f, 1.956614833e-02f,
+    -1.468739692e-03f, -5.963834276e-03f, 4.665392640e-03f, -1.369562241e-03f, -1.821558731e-04f, 1.961957255e-04f,
+    7.621271806e-05f, -1.649899881e-03f, 4.132510856e-03f, -3.519596863e-03f, -5.441876318e-03f, 2.139898098e-02f,
+    -2.978544081e-02f, 8.069258682e-03f, 5.513116466e-02f, -1.401796882e-01f, 1.883625880e-01f, 7.226628534e-01f,
+    2.856389974e-01f, -1.447434291e-01f, 3.493601430e-02f, 2.566578999e-02f, -3.618770424e-02f, 1.949639790e-02f,
+    -1.366291304e-03f, -6.018881925e-03f, 4.673184694e-03f, -1.360275381e-03f, -1.889778594e-04f, 1.981083302e-04f,
+    8.134732477e-05f, -1.653720622e-03f, 4.116024173e-03f, -3.462081984e-03f, -5.523047661e-03f, 2.141487667e-02f,
+    -2.961135784e-02f, 7.677294977e-03f, 5.550407921e-02f, -1.399211818e-01f, 1.862096722e-01f, 7.223792771e-01f,
+    2.878869290e-01f, -1.446816110e-01f, 3.439533641e-02f, 2.606661053e-02f, -3.630068856e-02f, 1.942540930e-02f,
+    -1.263446242e-03f, -6.073796155e-03f, 4.680746131e-03f, -1.350860980e-03f, -1.958334164e-04f, 2.000232359e-04f,
+    8.644011805e-05f, -1.657423119e-03f, 4.099375647e-03f, -3.404586255e-03f, -5.603662255e-03f, 2.142958802e-02f,
+    -2.943618957e-02f, 7.285986903e-03f, 5.587301896e-02f, -1.396563208e-01f, 1.840602411e-01f, 7.220832310e-01f,
+    2.901355833e-01f, -1.446120079e-01f, 3.385126436e-02f, 2.646714876e-02f, -3.641206344e-02f, 1.935318282e-02f,
+    -1.160208902e-03f, -6.128573424e-03f, 4.688075580e-03f, -1.341319001e-03f, -2.027222732e-04f, 2.019402747e-04f,
+    9.149100241e-05f, -1.661007733e-03f, 4.082566917e-03f, -3.347112832e-03f, -5.683717444e-03f, 2.144311764e-02f,
+    -2.925994821e-02f, 6.895353119e-03f, 5.623797655e-02f, -1.393851409e-01f, 1.819143505e-01f, 7.217747247e-01f,
+    2.923848977e-01f, -1.445345936e-01f, 3.330381586e-02f, 2.686738303e-02f, -3.652181863e-02f, 1.927971884e-02f,
+    -1.056583715e-03f, -6.183210183e-03f, 4.695171677e-03f, -1.331649411e-03f, -2.096441547e-04f, 2.038592774e-04f,
+    9.649988596e-05f, -1.664474829e-03f, 4.065599625e-03f, -3.289664861e-03f, -5.763210612e-03f, 2.145546821e-02f,
+    -2.908264601e-02f, 6.505412200e-03f, 5.659894483e-02f, -1.391076777e-01f, 1.797720559e-01f, 7.214537682e-01f,
+    2.946348091e-01f, -1.444493424e-01f, 3.275300885e-02f, 2.726729165e-02f, -3.662994396e-02f, 1.920501779e-02f,
+    -9.525751466e-04f, -6.237702882e-03f, 4.702033067e-03f, -1.321852188e-03f, -2.165987821e-04f, 2.057800734e-04f,
+    1.014666804e-04f, -1.667824780e-03f, 4.048475416e-03f, -3.232245474e-03f, -5.842139182e-03f, 2.146664245e-02f,
+    -2.890429526e-02f, 6.116182633e-03f, 5.695591688e-02f, -1.388239670e-01f, 1.776334127e-01f, 7.211203719e-01f,
+    2.968852547e-01f, -1.443562288e-01f, 3.219886147e-02f, 2.766685287e-02f, -3.673642930e-02f, 1.912908017e-02f,
+    -8.481876992e-04f, -6.292047964e-03f, 4.708658404e-03f, -1.311927317e-03f, -2.235858727e-04f, 2.077024908e-04f,
+    1.063913011e-04f, -1.671057963e-03f, 4.031195936e-03f, -3.174857789e-03f, -5.920500618e-03f, 2.147664316e-02f,
+    -2.872490824e-02f, 5.727682822e-03f, 5.730888599e-02f, -1.385340449e-01f, 1.754984760e-01f, 7.207745467e-01f,
+    2.991361713e-01f, -1.442552276e-01f, 3.164139209e-02f, 2.806604492e-02f, -3.684126459e-02f, 1.905190655e-02f,
+    -7.434259085e-04f, -6.346241870e-03f, 4.715046350e-03f, -1.301874789e-03f, -2.306051398e-04f, 2.096263564e-04f,
+    1.112736670e-04f, -1.674174762e-03f, 4.013762837e-03f, -3.117504915e-03f, -5.998292421e-03f, 2.148547316e-02f,
+    -2.854449729e-02f, 5.339931084e-03f, 5.765784565e-02f, -1.382379476e-01f, 1.733673007e-01f, 7.204163037e-01f,
+    3.013874958e-01f, -1.441463136e-01f, 3.108061929e-02f, 2.846484599e-02f, -3.694443982e-02f, 1.897349757e-02f,
+    -6.382943450e-04f, -6.400281038e-03f, 4.721195576e-03f, -1.291694607e-03f, -2.376562928e-04f, 2.115514956e-04f,
+    1.161137004e-04f, -1.677175567e-03f, 3.996177770e-03f, -3.060189945e-03f, -6.075512134e-03f, 2.149313538e-02f,
+    -2.836307474e-02f, 4.952945648e-03f, 5.800278960e-02f, -1.379357112e-01f, 1.712399418e-01f, 7.200456547e-01f,
+    3.036391649e-01f, -1.440294620e-01f, 3.051656185e-02f, 2.886323424e-02f, -3.704594506e-02f, 1.889385395e-02f,
+    -5.327976137e-04f, -6.454161902e-03f, 4.727104764e-03f, -1.281386779e-03f, -2.447390372e-04f, 2.134777328e-04f,
+    1.209113274e-04f, -1.680060771e-03f, 3.978442392e-03f, -3.002915960e-03f, -6.152157336e-03f, 2.149963275e-02f,
+    -2.818065296e-02f, 4.566744656e-03f, 5.834371178e-02f, -1.376273723e-01f, 1.691164536e-01f, 7.196626117e-01f,
+    3.058911153e-01f, -1.439046484e-01f, 2.994923879e-02f, 2.926118776e-02f, -3.714577042e-02f, 1.881297644e-02f,
+    -4.269403537e-04f, -6.507880892e-03f, 4.732772603e-03f, -1.270951323e-03f, -2.518530748e-04f, 2.154048907e-04f,
+    1.256664777e-04f, -1.682830775e-03f, 3.960558361e-03f, -2.945686028e-03f, -6.228225650e-03f, 2.150496828e-02f,
+    -2.799724433e-02f, 4.181346161e-03f, 5.868060634e-02f, -1.373129676e-01f, 1.669968904e-01f, 7.192671869e-01f,
+    3.081432835e-01f, -1.437718485e-01f, 2.937866932e-02f, 2.965868464e-02f, -3.724390611e-02f, 1.873086591e-02f,
+    -3.207272382e-04f, -6.561434437e-03f, 4.738197791e-03f, -1.260388262e-03f, -2.589981032e-04f, 2.173327909e-04f,
+    1.303790841e-04f, -1.685485984e-03f, 3.942527335e-03f, -2.888503205e-03f, -6.303714734e-03f, 2.150914504e-02f,
+    -2.781286124e-02f, 3.796768127e-03f, 5.901346766e-02f, -1.369925336e-01f, 1.648813065e-01f, 7.188593934e-01f,
+    3.103956060e-01f, -1.436310380e-01f, 2.880487289e-02f, 3.005570293e-02f, -3.734034235e-02f, 1.864752327e-02f,
+    -2.141629746e-04f, -6.614818962e-03f, 4.743379037e-03f, -1.249697632e-03f, -2.661738163e-04f, 2.192612539e-04f,
+    1.350490835e-04f, -1.688026811e-03f, 3.924350977e-03f, -2.831370532e-03f, -6.378622288e-03f, 2.151216615e-02f,
+    -2.762751614e-02f, 3.413028428e-03f, 5.934229032e-02f, -1.366661075e-01f, 1.627697557e-01f, 7.184392443e-01f,
+    3.126480193e-01f, -1.434821934e-01f, 2.822786913e-02f, 3.045222062e-02f, -3.743506947e-02f, 1.856294949e-02f,
+    -1.072523037e-04f, -6.668030890e-03f, 4.748315058e-03f, -1.238879473e-03f, -2.733799040e-04f, 2.211900985e-04f,
+    1.396764158e-04f, -1.690453672e-03f, 3.906030951e-03f, -2.774291036e-03f, -6.452946052e-03f, 2.151403478e-02f,
+    -2.744122144e-02f, 3.030144847e-03f, 5.966706914e-02f, -1.363337260e-01f, 1.606622917e-01f, 7.180067531e-01f,
+    3.149004596e-01f, -1.433252910e-01f, 2.764767791e-02f, 3.084821571e-02f, -3.752807784e-02f, 1.847714565e-02f,
+    9.233383346e-18f, -6.721066642e-03f, 4.753004582e-03f, -1.227933837e-03f, -2.806160525e-04f, 2.231191426e-04f,
+    1.442610247e-04f, -1.692766988e-03f, 3.887568923e-03f, -2.717267733e-03f, -6.526683804e-03f, 2.151475414e-02f,
+    -2.725398961e-02f, 2.648135076e-03f, 5.998779913e-02f, -1.359954266e-01f, 1.585589680e-01f, 7.175619339e-01f,
+    3.171528633e-01f, -1.431603075e-01f, 2.706431931e-02f, 3.124366614e-02f, -3.761935791e-02f, 1.839011285e-02f,
+    1.075891284e-04f, -6.773922636e-03f, 4.757446344e-03f, -1.216860780e-03f, -2.878819439e-04f, 2.250482028e-04f,
+    1.488028572e-04f, -1.694967187e-03f, 3.868966561e-03f, -2.660303622e-03f, -6.599833362e-03f, 2.151432753e-02f,
+    -2.706583313e-02f, 2.267016716e-03f, 6.030447553e-02f, -1.356512465e-01f, 1.564598377e-01f, 7.171048011e-01f,
+    3.194051665e-01f, -1.429872198e-01f, 2.647781361e-02f, 3.163854983e-02f, -3.770890019e-02f, 1.830185229e-02f,
+    2.155102404e-04f, -6.826595288e-03f, 4.761639093e-03f, -1.205660370e-03f, -2.951772565e-04f, 2.269770943e-04f,
+    1.533018639e-04f, -1.697054701e-03f, 3.850225535e-03f, -2.603401691e-03f, -6.672392583e-03f, 2.151275827e-02f,
+    -2.687676447e-02f, 1.886807272e-03f, 6.061709379e-02f, -1.353012230e-01f, 1.543649539e-01f, 7.166353695e-01f,
+    3.216573053e-01f, -1.428060053e-01f, 2.588818131e-02f, 3.203284466e-02f, -3.779669526e-02f, 1.821236525e-02f,
+    3.237584617e-04f, -6.879081015e-03f, 4.765581585e-03f, -1.194332681e-03f, -3.025016647e-04f, 2.289056312e-04f,
+    1.577579988e-04f, -1.699029969e-03f, 3.831347515e-03f, -2.546564913e-03f, -6.744359366e-03f, 2.151004974e-02f,
+    -2.668679615e-02f, 1.507524160e-03f, 6.092564958e-02f, -1.349453940e-01f, 1.522743694e-01f, 7.161536543e-01f,
+    3.239092159e-01f, -1.426166413e-01f, 2.529544311e-02f, 3.242652850e-02f, -3.788273376e-02f, 1.812165304e-02f,
+    4.323288849e-04f, -6.931376228e-03f, 4.769272586e-03f, -1.182877797e-03f, -3.098548392e-04f, 2.308336263e-04f,
+    1.621712191e-04f, -1.700893433e-03f, 3.812334174e-03f, -2.489796245e-03f, -6.815731646e-03f, 2.150620538e-02f,
+    -2.649594068e-02f, 1.129184700e-03f, 6.123013876e-02f, -1.345837969e-01f, 1.501881368e-01f, 7.156596709e-01f,
+    3.261608340e-01f, -1.424191056e-01f, 2.469961994e-02f, 3.281957918e-02f, -3.796700640e-02f, 1.802971707e-02f,
+    5.412165704e-04f, -6.983477341e-03f, 4.772710872e-03f, -1.171295811e-03f, -3.172364465e-04f, 2.327608912e-04f,
+    1.665414859e-04f, -1.702645541e-03f, 3.793187186e-03f, -2.433098632e-03f, -6.886507400e-03f, 2.150122869e-02f,
+    -2.630421059e-02f, 7.518061154e-04f, 6.153055745e-02f, -1.342164699e-01f, 1.481063085e-01f, 7.151534355e-01f,
+    3.284120958e-01f, -1.422133762e-01f, 2.410073293e-02f, 3.321197451e-02f, -3.804950398e-02f, 1.793655882e-02f,
+    6.504165454e-04f, -7.035380764e-03f, 4.775895232e-03f, -1.159586821e-03f, -3.246461495e-04f, 2.346872364e-04f,
+    1.708687632e-04f, -1.704286746e-03f, 3.773908227e-03f, -2.376475005e-03f, -6.956684643e-03f, 2.149512319e-02f,
+    -2.611161844e-02f, 3.754055375e-04f, 6.182690194e-02f, -1.338434507e-01f, 1.460289364e-01f, 7.146349642e-01f,
+    3.306629370e-01f, -1.419994314e-01f, 2.349880342e-02f, 3.360369226e-02f, -3.813021734e-02f, 1.784217984e-02f,
+    7.599238053e-04f, -7.087082908e-03f, 4.778824462e-03f, -1.147750937e-03f, -3.320836071e-04f, 2.366124709e-04f,
+    1.751530187e-04f, -1.705817506e-03f, 3.754498973e-03f, -2.319928278e-03f, -7.026261431e-03f, 2.148789249e-02f,
+    -2.591817676e-02f, 1.933476961e-17f, 6.211916875e-02f, -1.334647775e-01f, 1.439560726e-01f, 7.141042740e-01f,
+    3.329132935e-01f, -1.417772495e-01f, 2.289385295e-02f, 3.399471021e-02f, -3.820913740e-02f, 1.774658172e-02f,
+    8.697333130e-04f, -7.138580182e-03f, 4.781497371e-03f, -1.135788276e-03f, -3.395484745e-04f, 2.385364028e-04f,
+    1.793942233e-04f, -1.707238284e-03f, 3.734961100e-03f, -2.263461354e-03f, -7.095235859e-03f, 2.147954021e-02f,
+    -2.572389815e-02f, -3.743935597e-04f, 6.240735461e-02f, -1.330804886e-01f, 1.418877687e-01f, 7.135613819e-01f,
+    3.351631009e-01f, -1.415468095e-01f, 2.228590330e-02f, 3.438500609e-02f, -3.828625516e-02f, 1.764976617e-02f,
+    9.798399995e-04f, -7.189868996e-03f, 4.783912776e-03f, -1.123698963e-03f, -3.470404028e-04f, 2.404588390e-04f,
+    1.835923514e-04f, -1.708549548e-03f, 3.715296288e-03f, -2.207077116e-03f, -7.163606061e-03f, 2.147007007e-02f,
+    -2.552879516e-02f, -7.477583013e-04f, 6.269145647e-02f, -1.326906223e-01f, 1.398240760e-01f, 7.130063055e-01f,
+    3.374122951e-01f, -1.413080904e-01f, 2.167497642e-02f, 3.477455760e-02f, -3.836156169e-02f, 1.755173494e-02f,
+    1.090238764e-03f, -7.240945758e-03f, 4.786069507e-03f, -1.111483134e-03f, -3.545590396e-04f, 2.423795851e-04f,
+    1.877473807e-04f, -1.709751770e-03f, 3.695506217e-03f, -2.150778438e-03f, -7.231370209e-03f, 2.145948579e-02f,
+    -2.533288040e-02f, -1.120077482e-03f, 6.297147148e-02f, -1.322952172e-01f, 1.377650458e-01f, 7.124390626e-01f,
+    3.396608115e-01f, -1.410610715e-01f, 2.106109449e-02f, 3.516334246e-02f, -3.843504812e-02f, 1.745248984e-02f,
+    1.200924474e-03f, -7.291806877e-03f, 4.787966404e-03f, -1.099140931e-03f, -3.621040282e-04f, 2.442984456e-04f,
+    1.918592922e-04f, -1.710845428e-03f, 3.675592565e-03f, -2.094568176e-03f, -7.298526519e-03f, 2.144779118e-02f,
+    -2.513616647e-02f, -1.491334459e-03f, 6.324739702e-02f, -1.318943118e-01f, 1.357107291e-01f, 7.118596716e-01f,
+    3.419085859e-01f, -1.408057323e-01f, 2.044427990e-02f, 3.555133833e-02f, -3.850670566e-02f, 1.735203279e-02f,
+    1.311891966e-03f, -7.342448762e-03f, 4.789602318e-03f, -1.086672506e-03f, -3.696750086e-04f, 2.462152238e-04f,
+    1.959280701e-04f, -1.711831005e-03f, 3.655557013e-03f, -2.038449169e-03f, -7.365073241e-03f, 2.143499007e-02f,
+    -2.493866596e-02f, -1.861512687e-03f, 6.351923064e-02f, -1.314879449e-01f, 1.336611765e-01f, 7.112681511e-01f,
+    3.441555537e-01f, -1.405420527e-01f, 1.982455523e-02f, 3.593852288e-02f, -3.857652561e-02f, 1.725036574e-02f,
+    1.423136044e-03f, -7.392867823e-03f, 4.790976110e-03f, -1.074078018e-03f, -3.772716165e-04f, 2.481297220e-04f,
+    1.999537020e-04f, -1.712708986e-03f, 3.635401244e-03f, -1.982424245e-03f, -7.431008669e-03f, 2.142108635e-02f,
+    -2.474039150e-02f, -2.230595719e-03f, 6.378697016e-02f, -1.310761552e-01f, 1.316164384e-01f, 7.106645202e-01f,
+    3.464016504e-01f, -1.402700129e-01f, 1.920194329e-02f, 3.632487373e-02f, -3.864449932e-02f, 1.714749074e-02f,
+    1.534651483e-03f, -7.443060468e-03f, 4.792086653e-03f, -1.061357638e-03f, -3.848934840e-04f, 2.500417412e-04f,
+    2.039361788e-04f, -1.713479863e-03f, 3.615126937e-03f, -1.926496215e-03f, -7.496331132e-03f, 2.140608398e-02f,
+    -2.454135571e-02f, -2.598567212e-03f, 6.405061356e-02f, -1.306589818e-01f, 1.295765652e-01f, 7.100487984e-01f,
+    3.486468116e-01f, -1.399895932e-01f, 1.857646708e-02f, 3.671036852e-02f, -3.871061822e-02f, 1.704340990e-02f,
+    1.646433026e-03f, -7.493023110e-03f, 4.792932833e-03f, -1.048511542e-03f, -3.925402395e-04f, 2.519510814e-04f,
+    2.078754947e-04f, -1.714144133e-03f, 3.594735776e-03f, -1.870667872e-03f, -7.561039003e-03f, 2.138998693e-02f,
+    -2.434157122e-02f, -2.965410921e-03f, 6.431015905e-02f, -1.302364638e-01f, 1.275416068e-01f, 7.094210055e-01f,
+    3.508909726e-01f, -1.397007743e-01f, 1.794814981e-02f, 3.709498486e-02f, -3.877487383e-02f, 1.693812540e-02f,
+    1.758475385e-03f, -7.542752159e-03f, 4.793513544e-03f, -1.035539917e-03f, -4.002115074e-04f, 2.538575415e-04f,
+    2.117716470e-04f, -1.714702296e-03f, 3.574229442e-03f, -1.814941998e-03f, -7.625130691e-03f, 2.137279924e-02f,
+    -2.414105067e-02f, -3.331110704e-03f, 6.456560505e-02f, -1.298086403e-01f, 1.255116129e-01f, 7.087811618e-01f,
+    3.531340687e-01f, -1.394035371e-01f, 1.731701489e-02f, 3.747870034e-02f, -3.883725773e-02f, 1.683163948e-02f,
+    1.870773242e-03f, -7.592244028e-03f, 4.793827693e-03f, -1.022442958e-03f, -4.079069083e-04f, 2.557609191e-04f,
+    2.156246362e-04f, -1.715154856e-03f, 3.553609617e-03f, -1.759321356e-03f, -7.688604646e-03f, 2.135452501e-02f,
+    -2.393980669e-02f, -3.695650518e-03f, 6.481695018e-02f, -1.293755506e-01f, 1.234866330e-01f, 7.081292879e-01f,
+    3.553760354e-01f, -1.390978628e-01f, 1.668308594e-02f, 3.786149254e-02f, -3.889776158e-02f, 1.672395448e-02f,
+    1.983321249e-03f, -7.641495133e-03f, 4.793874200e-03f, -1.009220869e-03f, -4.156260591e-04f, 2.576610110e-04f,
+    2.194344663e-04f, -1.715502323e-03f, 3.532877984e-03f, -1.703808694e-03f, -7.751459355e-03f, 2.133516836e-02f,
+    -2.373785194e-02f, -4.059014427e-03f, 6.506419328e-02f, -1.289372342e-01f, 1.214667164e-01f, 7.074654046e-01f,
+    3.576168080e-01f, -1.387837330e-01f, 1.604638679e-02f, 3.824333904e-02f, -3.895637713e-02f, 1.661507280e-02f,
+    2.096114028e-03f, -7.690501888e-03f, 4.793651994e-03f, -9.958738626e-04f, -4.233685729e-04f, 2.595576128e-04f,
+    2.232011441e-04f, -1.715745212e-03f, 3.512036225e-03f, -1.648406745e-03f, -7.813693348e-03f, 2.131473347e-02f,
+    -2.353519906e-02f, -4.421186594e-03f, 6.530733339e-02f, -1.284937305e-01f, 1.194519121e-01f, 7.067895335e-01f,
+    3.598563217e-01f, -1.384611294e-01f, 1.540694145e-02f, 3.862421739e-02f, -3.901309620e-02f, 1.650499688e-02f,
+    2.209146172e-03f, -7.739260711e-03f, 4.793160018e-03f, -9.824021604e-04f, -4.311340591e-04f, 2.614505190e-04f,
+    2.269246798e-04f, -1.715884039e-03f, 3.491086021e-03f, -1.593118226e-03f, -7.875305190e-03f, 2.129322457e-02f,
+    -2.333186071e-02f, -4.782151289e-03f, 6.554636976e-02f, -1.280450791e-01f, 1.174422687e-01f, 7.061016963e-01f,
+    3.620945117e-01f, -1.381300340e-01f, 1.476477416e-02f, 3.900410516e-02f, -3.906791068e-02f, 1.639372929e-02f,
+    2.322412242e-03f, -7.787768022e-03f, 4.792397226e-03f, -9.688059927e-04f, -4.389221232e-04f, 2.633395230e-04f,
+    2.306050868e-04f, -1.715919327e-03f, 3.470029055e-03f, -1.537945836e-03f, -7.936293489e-03f, 2.127064594e-02f,
+    -2.312784954e-02f, -5.141892884e-03f, 6.578130184e-02f, -1.275913198e-01f, 1.154378348e-01f, 7.054019151e-01f,
+    3.643313134e-01f, -1.377904292e-01f, 1.411990935e-02f, 3.938297987e-02f, -3.912081256e-02f, 1.628127262e-02f,
+    2.435906773e-03f, -7.836020244e-03f, 4.791362583e-03f, -9.550855989e-04f, -4.467323670e-04f, 2.652244173e-04f,
+    2.342423815e-04f, -1.715851603e-03f, 3.448867007e-03f, -1.482892259e-03f, -7.996656888e-03f, 2.124700189e-02f,
+    -2.292317821e-02f, -5.500395856e-03f, 6.601212931e-02f, -1.271324923e-01f, 1.134386587e-01f, 7.046902124e-01f,
+    3.665666619e-01f, -1.374422976e-01f, 1.347237165e-02f, 3.976081906e-02f, -3.917179388e-02f, 1.616762955e-02f,
+    2.549624267e-03f, -7.884013801e-03f, 4.790055068e-03f, -9.412412272e-04f, -4.545643885e-04f, 2.671049933e-04f,
+    2.378365835e-04f, -1.715681397e-03f, 3.427601559e-03f, -1.427960165e-03f, -8.056394074e-03f, 2.122229678e-02f,
+    -2.271785938e-02f, -5.857644788e-03f, 6.623885201e-02f, -1.266686367e-01f, 1.114447882e-01f, 7.039666111e-01f,
+    3.688004923e-01f, -1.370856221e-01f, 1.282218589e-02f, 4.013760027e-02f, -3.922084679e-02f, 1.605280285e-02f,
+    2.663559200e-03f, -7.931745119e-03f, 4.788473671e-03f, -9.272731347e-04f, -4.624177822e-04f, 2.689810414e-04f,
+    2.413877155e-04f, -1.715409244e-03f, 3.406234390e-03f, -1.373152204e-03f, -8.115503769e-03f, 2.119653503e-02f,
+    -2.251190571e-02f, -6.213624368e-03f, 6.646147003e-02f, -1.261997928e-01f, 1.094562711e-01f, 7.032311345e-01f,
+    3.710327399e-01f, -1.367203859e-01f, 1.216937711e-02f, 4.051330102e-02f, -3.926796351e-02f, 1.593679532e-02f,
+    2.777706020e-03f, -7.979210630e-03f, 4.786617395e-03f, -9.131815874e-04f, -4.702921385e-04f, 2.708523509e-04f,
+    2.448958031e-04f, -1.715035682e-03f, 3.384767179e-03f, -1.318471011e-03f, -8.173984735e-03f, 2.116972109e-02f,
+    -2.230532986e-02f, -6.568319391e-03f, 6.667998365e-02f, -1.257260009e-01f, 1.074731549e-01f, 7.024838062e-01f,
+    3.732633398e-01f, -1.363465724e-01f, 1.151397054e-02f, 4.088789883e-02f, -3.931313634e-02f, 1.581960988e-02f,
+    2.892059143e-03f, -8.026406767e-03f, 4.784485255e-03f, -8.989668603e-04f, -4.781870445e-04f, 2.727187103e-04f,
+    2.483608754e-04f, -1.714561255e-03f, 3.363201606e-03f, -1.263919205e-03f, -8.231835775e-03f, 2.114185947e-02f,
+    -2.209814448e-02f, -6.921714760e-03f, 6.689439334e-02f, -1.252473010e-01f, 1.054954868e-01f, 7.017246502e-01f,
+    3.754922271e-01f, -1.359641654e-01f, 1.085599160e-02f, 4.126137122e-02f, -3.935635766e-02f, 1.570124949e-02f,
+    3.006612959e-03f, -8.073329965e-03f, 4.782076279e-03f, -8.846292374e-04f, -4.861020832e-04f, 2.745799070e-04f,
+    2.517829640e-04f, -1.713986508e-03f, 3.341539347e-03f, -1.209499387e-03f, -8.289055727e-03f, 2.111295470e-02f,
+    -2.189036224e-02f, -7.273795482e-03f, 6.710469979e-02f, -1.247637335e-01f, 1.035233136e-01f, 7.009536910e-01f,
+    3.777193370e-01f, -1.355731490e-01f, 1.019546594e-02f, 4.163369570e-02f, -3.939761995e-02f, 1.558171718e-02f,
+    3.121361831e-03f, -8.119976666e-03f, 4.779389506e-03f, -8.701690118e-04f, -4.940368342e-04f, 2.764357274e-04f,
+    2.551621040e-04f, -1.713311993e-03f, 3.319782081e-03f, -1.155214143e-03f, -8.345643471e-03f, 2.108301137e-02f,
+    -2.168199578e-02f, -7.624546674e-03f, 6.731090389e-02f, -1.242753388e-01f, 1.015566821e-01f, 7.001709533e-01f,
+    3.799446045e-01f, -1.351735073e-01f, 9.532419377e-03f, 4.200484980e-02f, -3.943691575e-02f, 1.546101608e-02f,
+    3.236300093e-03f, -8.166343313e-03f, 4.776423990e-03f, -8.555864855e-04f, -5.019908733e-04f, 2.782859570e-04f,
+    2.584983333e-04f, -1.712538263e-03f, 3.297931481e-03f, -1.101066040e-03f, -8.401597925e-03f, 2.105203412e-02f,
+    -2.147305777e-02f, -7.973953563e-03f, 6.751300673e-02f, -1.237821573e-01f, 9.959563873e-02f, 6.993764621e-01f,
+    3.821679648e-01f, -1.347652252e-01f, 8.866877934e-03f, 4.237481102e-02f, -3.947423769e-02f, 1.533914936e-02f,
+    3.351422050e-03f, -8.212426354e-03f, 4.773178796e-03f, -8.408819695e-04f, -5.099637726e-04f, 2.801303803e-04f,
+    2.617916927e-04f, -1.711665877e-03f, 3.275989222e-03f, -1.047057631e-03f, -8.456918045e-03f, 2.102002761e-02f,
+    -2.126356084e-02f, -8.322001481e-03f, 6.771100960e-02f, -1.232842296e-01f, 9.764022955e-02f, 6.985702431e-01f,
+    3.843893529e-01f, -1.343482874e-01f, 8.198867832e-03f, 4.274355689e-02f, -3.950957851e-02f, 1.521612028e-02f,
+    3.466721983e-03f, -8.258222241e-03f, 4.769653004e-03f, -8.260557841e-04f, -5.179551006e-04f, 2.819687810e-04f,
+    2.650422261e-04f, -1.710695397e-03f, 3.253956979e-03f, -9.931914489e-04f, -8.511602827e-03f, 2.098699657e-02f,
+    -2.105351764e-02f, -8.668675872e-03f, 6.790491399e-02f, -1.227815963e-01f, 9.569050046e-02f, 6.977523222e-01f,
+    3.866087040e-01f, -1.339226792e-01f, 7.528415488e-03f, 4.311106492e-02f, -3.954293101e-02f, 1.509193216e-02f,
+    3.582194143e-03f, -8.303727432e-03f, 4.765845704e-03f, -8.111082583e-04f, -5.259644223e-04f, 2.838009417e-04f,
+    2.682499804e-04f, -1.709627387e-03f, 3.231836421e-03f, -9.394700108e-04f, -8.565651304e-03f, 2.095294576e-02f,
+    -2.084294081e-02f, -9.013962289e-03f, 6.809472161e-02f, -1.222742981e-01f, 9.374649707e-02f, 6.969227255e-01f,
+    3.888259532e-01f, -1.334883861e-01f, 6.855547511e-03f, 4.347731265e-02f, -3.957428807e-02f, 1.496658841e-02f,
+    3.697832757e-03f, -8.348938386e-03f, 4.761756003e-03f, -7.960397306e-04f, -5.339912987e-04f, 2.856266442e-04f,
+    2.714150054e-04f, -1.708462417e-03f, 3.209629219e-03f, -8.858958167e-04f, -8.619062548e-03f, 2.091787997e-02f,
+    -2.063184299e-02f, -9.357846395e-03f, 6.828043433e-02f, -1.217623758e-01f, 9.180826471e-02f, 6.960814796e-01f,
+    3.910410355e-01f, -1.330453939e-01f, 6.180290706e-03f, 4.384227760e-02f, -3.960364268e-02f, 1.484009250e-02f,
+    3.813632022e-03f, -8.393851571e-03f, 4.757383019e-03f, -7.808505484e-04f, -5.420352875e-04f, 2.874456695e-04f,
+    2.745373537e-04f, -1.707201059e-03f, 3.187337043e-03f, -8.324713491e-04f, -8.671835670e-03f, 2.088180405e-02f,
+    -2.042023680e-02f, -9.700313965e-03f, 6.846205426e-02f, -1.212458702e-01f, 8.987584845e-02f, 6.952286116e-01f,
+    3.932538861e-01f, -1.325936886e-01f, 5.502672072e-03f, 4.420593732e-02f, -3.963098791e-02f, 1.471244797e-02f,
+    3.929586112e-03f, -8.438463457e-03f, 4.752725882e-03f, -7.655410683e-04f, -5.500959427e-04f, 2.892577975e-04f,
+    2.776170809e-04f, -1.705843890e-03f, 3.164961558e-03f, -7.791990729e-04f, -8.723969819e-03f, 2.084472288e-02f,
+    -2.020813487e-02f, -1.004135088e-02f, 6.863958369e-02f, -1.207248225e-01f, 8.794929307e-02f, 6.943641489e-01f,
+    3.954644401e-01f, -1.321332567e-01f, 4.822718797e-03f, 4.456826935e-02f, -3.965631691e-02f, 1.458365844e-02f,
+    4.045689172e-03f, -8.482770521e-03f, 4.747783738e-03f, -7.501116559e-04f, -5.581728147e-04f, 2.910628074e-04f,
+    2.806542455e-04f, -1.704391488e-03f, 3.142504429e-03f, -7.260814360e-04f, -8.775464182e-03f, 2.080664138e-02f,
+    -1.999554980e-02f, -1.038094315e-02f, 6.881302511e-02f, -1.201992734e-01f, 8.602864309e-02f, 6.934881190e-01f,
+    3.976726326e-01f, -1.316640847e-01f, 4.140458264e-03f, 4.492925123e-02f, -3.967962293e-02f, 1.445372759e-02f,
+    4.161935324e-03f, -8.526769245e-03f, 4.742555746e-03f, -7.345626861e-04f, -5.662654504e-04f, 2.928604776e-04f,
+    2.836489088e-04f, -1.702844437e-03f, 3.119967320e-03f, -6.731208682e-04f, -8.826317986e-03f, 2.076756453e-02f,
+    -1.978249420e-02f, -1.071907686e-02f, 6.898238121e-02f, -1.196692642e-01f, 8.411394275e-02f, 6.926005501e-01f,
+    3.998783987e-01f, -1.311861598e-01f, 3.455918047e-03f, 4.528886054e-02f, -3.970089929e-02f, 1.432265917e-02f,
+    4.278318662e-03f, -8.570456116e-03f, 4.737041078e-03f, -7.188945430e-04f, -5.743733929e-04f, 2.946505855e-04f,
+    2.866011350e-04f, -1.701203323e-03f, 3.097351893e-03f, -6.203197821e-04f, -8.876530494e-03f, 2.072749732e-02f,
+    -1.956898067e-02f, -1.105573826e-02f, 6.914765487e-02f, -1.191348360e-01f, 8.220523600e-02f, 6.917014707e-01f,
+    4.020816737e-01f, -1.306994691e-01f, 2.769125907e-03f, 4.564707485e-02f, -3.972013942e-02f, 1.419045704e-02f,
+    4.394833257e-03f, -8.613827629e-03f, 4.731238920e-03f, -7.031076199e-04f, -5.824961820e-04f, 2.964329077e-04f,
+    2.895109909e-04f, -1.699468735e-03f, 3.074659806e-03f, -5.676805723e-04f, -8.926101007e-03f, 2.068644480e-02f,
+    -1.935502179e-02f, -1.139091366e-02f, 6.930884917e-02f, -1.185960301e-01f, 8.030256653e-02f, 6.907909095e-01f,
+    4.042823926e-01f, -1.302040002e-01f, 2.080109797e-03f, 4.600387175e-02f, -3.973733684e-02f, 1.405712507e-02f,
+    4.511473152e-03f, -8.656880283e-03f, 4.725148471e-03f, -6.872023192e-04f, -5.906333540e-04f, 2.982072200e-04f,
+    2.923785464e-04f, -1.697641266e-03f, 3.051892715e-03f, -5.152056156e-04f, -8.975028867e-03f, 2.064441205e-02f,
+    -1.914063014e-02f, -1.172458952e-02f, 6.946596739e-02f, -1.180528876e-01f, 7.840597774e-02f, 6.898688957e-01f,
+    4.064804906e-01f, -1.296997411e-01f, 1.388897859e-03f, 4.635922884e-02f, -3.975248514e-02f, 1.392266726e-02f,
+    4.628232369e-03f, -8.699610584e-03f, 4.718768946e-03f, -6.711790526e-04f, -5.987844414e-04f, 2.999732977e-04f,
+    2.952038741e-04f, -1.695721512e-03f, 3.029052277e-03f, -4.628972710e-04f, -9.023313450e-03f, 2.060140420e-02f,
+    -1.892581830e-02f, -1.205675239e-02f, 6.961901301e-02f, -1.175054501e-01f, 7.651551275e-02f, 6.889354589e-01f,
+    4.086759030e-01f, -1.291866799e-01f, 6.955184214e-04f, 4.671312373e-02f, -3.976557803e-02f, 1.378708764e-02f,
+    4.745104902e-03f, -8.742015046e-03f, 4.712099573e-03f, -6.550382410e-04f, -6.069489735e-04f, 3.017309148e-04f,
+    2.979870491e-04f, -1.693710071e-03f, 3.006140143e-03f, -4.107578797e-04f, -9.070954172e-03f, 2.055742641e-02f,
+    -1.871059880e-02f, -1.238738896e-02f, 6.976798969e-02f, -1.169537589e-01f, 7.463121440e-02f, 6.879906288e-01f,
+    4.108685650e-01f, -1.286648051e-01f, -2.394967054e-17f, 4.706553406e-02f, -3.977660929e-02f, 1.365039034e-02f,
+    4.862084723e-03f, -8.784090188e-03f, 4.705139593e-03f, -6.387803145e-04f, -6.151264758e-04f, 3.034798449e-04f,
+    3.007281497e-04f, -1.691607546e-03f, 2.983157963e-03f, -3.587897644e-04f, -9.117950488e-03f, 2.051248388e-02f,
+    -1.849498419e-02f, -1.271648602e-02f, 6.991290128e-02f, -1.163978554e-01f, 7.275312525e-02f, 6.870344358e-01f,
+    4.130584119e-01f, -1.281341054e-01f, -6.976287033e-04f, 4.741643747e-02f, -3.978557279e-02f, 1.351257954e-02f,
+    4.979165779e-03f, -8.825832538e-03f, 4.697888263e-03f, -6.224057126e-04f, -6.233164707e-04f, 3.052198608e-04f,
+    3.034272564e-04f, -1.689414542e-03f, 2.960107384e-03f, -3.069952303e-04f, -9.164301887e-03f, 2.046658184e-02f,
+    -1.827898702e-02f, -1.304403046e-02f, 7.005375185e-02f, -1.158377814e-01f, 7.088128756e-02f, 6.860669104e-01f,
+    4.152453789e-01f, -1.275945700e-01f, -1.397338801e-03f, 4.776581163e-02f, -3.979246252e-02f, 1.337365950e-02f,
+    5.096341993e-03f, -8.867238628e-03f, 4.690344854e-03f, -6.059148839e-04f, -6.315184770e-04f, 3.069507345e-04f,
+    3.060844529e-04f, -1.687131667e-03f, 2.936990051e-03f, -2.553765638e-04f, -9.210007900e-03f, 2.041972556e-02f,
+    -1.806261978e-02f, -1.337000931e-02f, 7.019054563e-02f, -1.152735782e-01f, 6.901574333e-02f, 6.850880835e-01f,
+    4.174294014e-01f, -1.270461883e-01f, -2.099101222e-03f, 4.811363422e-02f, -3.979727254e-02f, 1.323363457e-02f,
+    5.213607265e-03f, -8.908305002e-03f, 4.682508651e-03f, -5.893082864e-04f, -6.397320098e-04f, 3.086722373e-04f,
+    3.086998251e-04f, -1.684759531e-03f, 2.913807607e-03f, -2.039360335e-04f, -9.255068092e-03f, 2.037192036e-02f,
+    -1.784589498e-02f, -1.369440970e-02f, 7.032328706e-02f, -1.147052877e-01f, 6.715653423e-02f, 6.840979866e-01f,
+    4.196104147e-01f, -1.264889500e-01f, -2.802886710e-03f, 4.845988295e-02f, -3.979999701e-02f, 1.309250914e-02f,
+    5.330955471e-03f, -8.949028209e-03f, 4.674378952e-03f, -5.725863873e-04f, -6.479565812e-04f, 3.103841397e-04f,
+    3.112734618e-04f, -1.682298749e-03f, 2.890561690e-03f, -1.526758895e-04f, -9.299482066e-03f, 2.032317159e-02f,
+    -1.762882512e-02f, -1.401721889e-02f, 7.045198077e-02f, -1.141329515e-01f, 6.530370169e-02f, 6.830966512e-01f,
+    4.217883542e-01f, -1.259228451e-01f, -3.508665828e-03f, 4.880453555e-02f, -3.980063019e-02f, 1.295028769e-02f,
+    5.448380467e-03f, -8.989404805e-03f, 4.665955074e-03f, -5.557496631e-04f, -6.561916996e-04f, 3.120862117e-04f,
+    3.138054546e-04f, -1.679749936e-03f, 2.867253937e-03f, -1.015983635e-04f, -9.343249465e-03f, 2.027348463e-02f,
+    -1.741142266e-02f, -1.433842425e-02f, 7.057663158e-02f, -1.135566114e-01f, 6.345728682e-02f, 6.820841093e-01f,
+    4.239631554e-01f, -1.253478639e-01f, -4.216408956e-03f, 4.914756976e-02f, -3.979916643e-02f, 1.280697477e-02f,
+    5.565876083e-03f, -9.029431357e-03f, 4.657236343e-03f, -5.387985998e-04f, -6.644368702e-04f, 3.137782225e-04f,
+    3.162958973e-04f, -1.677113712e-03f, 2.843885980e-03f, -5.070566873e-05f, -9.386369967e-03f, 2.022286489e-02f,
+    -1.719370006e-02f, -1.465801325e-02f, 7.069724450e-02f, -1.129763092e-01f, 6.161733044e-02f, 6.810603932e-01f,
+    4.261347537e-01f, -1.247639971e-01f, -4.926086292e-03f, 4.948896337e-02f, -3.979560017e-02f, 1.266257500e-02f,
+    5.683436127e-03f, -9.069104438e-03f, 4.648222106e-03f, -5.217336924e-04f, -6.726915947e-04f, 3.154599407e-04f,
+    3.187448867e-04f, -1.674390699e-03f, 2.820459451e-03f, -5.220347540e-18f, -9.428843286e-03f, 2.017131783e-02f,
+    -1.697566976e-02f, -1.497597350e-02f, 7.081382471e-02f, -1.123920867e-01f, 5.978387309e-02f, 6.800255358e-01f,
+    4.283030846e-01f, -1.241712356e-01f, -5.637667857e-03f, 4.982869417e-02f, -3.978992597e-02f, 1.251709307e-02f,
+    5.801054387e-03f, -9.108420632e-03f, 4.638911719e-03f, -5.045554454e-04f, -6.809553715e-04f, 3.171311342e-04f,
+    3.211525219e-04f, -1.671581521e-03f, 2.796975976e-03f, 5.051646657e-05f, -9.470669175e-03f, 2.011884895e-02f,
+    -1.675734418e-02f, -1.529229273e-02f, 7.092637760e-02f, -1.118039859e-01f, 5.795695501e-02f, 6.789795700e-01f,
+    4.304680837e-01f, -1.235695707e-01f, -6.351123491e-03f, 5.016673998e-02f, -3.978213845e-02f, 1.237053375e-02f,
+    5.918724628e-03f, -9.147376530e-03f, 4.629304558e-03f, -4.872643726e-04f, -6.892276958e-04f, 3.187915703e-04f,
+    3.235189046e-04f, -1.668686806e-03f, 2.773437180e-03f, 1.008415735e-04f, -9.511847424e-03f, 2.006546376e-02f,
+    -1.653873574e-02f, -1.560695876e-02f, 7.103490874e-02f, -1.112120486e-01f, 5.613661615e-02f, 6.779225292e-01f,
+    4.326296867e-01f, -1.229589940e-01f, -7.066422855e-03f, 5.050307866e-02f, -3.977223236e-02f, 1.222290186e-02f,
+    6.036440592e-03f, -9.185968732e-03f, 4.619400010e-03f, -4.698609973e-04f, -6.975080592e-04f, 3.204410156e-04f,
+    3.258441391e-04f, -1.665707183e-03f, 2.749844682e-03f, 1.509731820e-04f, -9.552377859e-03f, 2.001116782e-02f,
+    -1.631985681e-02f, -1.591995955e-02f, 7.113942390e-02f, -1.106163170e-01f, 5.432289615e-02f, 6.768544472e-01f,
+    4.347878291e-01f, -1.223394972e-01f, -7.783535434e-03f, 5.083768810e-02f, -3.976020254e-02f, 1.207420231e-02f,
+    6.154196003e-03f, -9.224193849e-03f, 4.609197480e-03f, -4.523458517e-04f, -7.057959503e-04f, 3.220792363e-04f,
+    3.281283321e-04f, -1.662643284e-03f, 2.726200099e-03f, 2.009091721e-04f, -9.592260343e-03f, 1.995596673e-02f,
+    -1.610071978e-02f, -1.623128319e-02f, 7.123992900e-02f, -1.100168330e-01f, 5.251583437e-02f, 6.757753581e-01f,
+    4.369424466e-01f, -1.217110727e-01f, -8.502430536e-03f, 5.117054620e-02f, -3.974604392e-02f, 1.192444008e-02f,
+    6.271984562e-03f, -9.262048500e-03f, 4.598696387e-03f, -4.347194779e-04f, -7.140908544e-04f, 3.237059979e-04f,
+    3.303715930e-04f, -1.659495744e-03f, 2.702505046e-03f, 2.506474425e-04f, -9.631494776e-03f, 1.989986611e-02f,
+    -1.588133697e-02f, -1.654091785e-02f, 7.133643018e-02f, -1.094136387e-01f, 5.071546986e-02f, 6.746852962e-01f,
+    4.390934752e-01f, -1.210737130e-01f, -9.223077294e-03f, 5.150163090e-02f, -3.972975153e-02f, 1.177362022e-02f,
+    6.389799949e-03f, -9.299529314e-03f, 4.587896166e-03f, -4.169824269e-04f, -7.223922533e-04f, 3.253210653e-04f,
+    3.325740334e-04f, -1.656265199e-03f, 2.678761132e-03f, 3.001859112e-04f, -9.670081093e-03f, 1.984287161e-02f,
+    -1.566172073e-02f, -1.684885186e-02f, 7.142893374e-02f, -1.088067762e-01f, 4.892184138e-02f, 6.735842963e-01f,
+    4.412408505e-01f, -1.204274109e-01f, -9.945444668e-03f, 5.183092019e-02f, -3.971132051e-02f, 1.162174785e-02f,
+    6.507635824e-03f, -9.336632930e-03f, 4.576796267e-03f, -3.991352593e-04f, -7.306996258e-04f, 3.269242029e-04f,
+    3.347357674e-04f, -1.652952289e-03f, 2.654969963e-03f, 3.495225146e-04f, -9.708019268e-03f, 1.978498893e-02f,
+    -1.544188337e-02f, -1.715507363e-02f, 7.151744619e-02f, -1.081962876e-01f, 4.713498739e-02f, 6.724723935e-01f,
+    4.433845085e-01f, -1.197721595e-01f, -1.066950144e-02f, 5.215839207e-02f, -3.969074610e-02f, 1.146882815e-02f,
+    6.625485828e-03f, -9.373355999e-03f, 4.565396157e-03f, -3.811785449e-04f, -7.390124475e-04f, 3.285151746e-04f,
+    3.368569118e-04f, -1.649557655e-03f, 2.631133142e-03f, 3.986552086e-04f, -9.745309308e-03f, 1.972622379e-02f,
+    -1.522183716e-02f, -1.745957174e-02f, 7.160197420e-02f, -1.075822152e-01f, 4.535494604e-02f, 6.713496234e-01f,
+    4.455243851e-01f, -1.191079523e-01f, -1.139521623e-02f, 5.248402458e-02f, -3.966802361e-02f, 1.131486639e-02f,
+    6.743343581e-03f, -9.409695179e-03f, 4.553695315e-03f, -3.631128631e-04f, -7.473301906e-04f, 3.300937437e-04f,
+    3.389375853e-04f, -1.646081941e-03f, 2.607252267e-03f, 4.475819678e-04f, -9.781951260e-03f, 1.966658193e-02f,
+    -1.500159437e-02f, -1.776233484e-02f, 7.168252463e-02f, -1.069646010e-01f, 4.358175518e-02f, 6.702160216e-01f,
+    4.476604164e-01f, -1.184347831e-01f, -1.212255747e-02f, 5.280779581e-02f, -3.964314851e-02f, 1.115986789e-02f,
+    6.861202684e-03f, -9.445647143e-03f, 4.541693240e-03f, -3.449388025e-04f, -7.556523245e-04f, 3.316596731e-04f,
+    3.409779094e-04f, -1.642525793e-03f, 2.583328934e-03f, 4.963007861e-04f, -9.817945204e-03f, 1.960606916e-02f,
+    -1.478116725e-02f, -1.806335172e-02f, 7.175910451e-02f, -1.063434874e-01f, 4.181545236e-02f, 6.690716242e-01f,
+    4.497925383e-01f, -1.177526460e-01f, -1.285149343e-02f, 5.312968386e-02f, -3.961611630e-02f, 1.100383806e-02f,
+    6.979056719e-03f, -9.481208570e-03f, 4.529389444e-03f, -3.266569609e-04f, -7.639783151e-04f, 3.332127251e-04f,
+    3.429780078e-04f, -1.638889857e-03f, 2.559364732e-03f, 5.448096766e-04f, -9.853291257e-03f, 1.954469128e-02f,
+    -1.456056802e-02f, -1.836261130e-02f, 7.183172107e-02f, -1.057189167e-01f, 4.005607484e-02f, 6.679164678e-01f,
+    4.519206872e-01f, -1.170615355e-01f, -1.358199222e-02f, 5.344966690e-02f, -3.958692265e-02f, 1.084678237e-02f,
+    7.096899249e-03f, -9.516376154e-03f, 4.516783457e-03f, -3.082679459e-04f, -7.723076253e-04f, 3.347526617e-04f,
+    3.449380065e-04f, -1.635174786e-03f, 2.535361249e-03f, 5.931066714e-04f, -9.887989572e-03f, 1.948245414e-02f,
+    -1.433980886e-02f, -1.866010261e-02f, 7.190038170e-02f, -1.050909310e-01f, 3.830365953e-02f, 6.667505890e-01f,
+    4.540447991e-01f, -1.163614462e-01f, -1.431402177e-02f, 5.376772313e-02f, -3.955556329e-02f, 1.068870637e-02f,
+    7.214723819e-03f, -9.551146599e-03f, 4.503874822e-03f, -2.897723741e-04f, -7.806397149e-04f, 3.362792444e-04f,
+    3.468580338e-04f, -1.631381229e-03f, 2.511320066e-03f, 6.411898222e-04f, -9.922040338e-03f, 1.941936361e-02f,
+    -1.411890195e-02f, -1.895581481e-02f, 7.196509399e-02f, -1.044595728e-01f, 3.655824309e-02f, 6.655740251e-01f,
+    4.561648104e-01f, -1.156523733e-01f, -1.504754984e-02f, 5.408383076e-02f, -3.952203406e-02f, 1.052961566e-02f,
+    7.332523953e-03f, -9.585516620e-03f, 4.490663102e-03f, -2.711708715e-04f, -7.889740408e-04f, 3.377922340e-04f,
+    3.487382204e-04f, -1.627509841e-03f, 2.487242762e-03f, 6.890571997e-04f, -9.955443779e-03f, 1.935542561e-02f,
+    -1.389785944e-02f, -1.924973716e-02f, 7.202586568e-02f, -1.038248843e-01f, 3.481986183e-02f, 6.643868134e-01f,
+    4.582806575e-01f, -1.149343121e-01f, -1.578254404e-02f, 5.439796809e-02f, -3.948633092e-02f, 1.036951593e-02f,
+    7.450293162e-03f, -9.619482945e-03f, 4.477147873e-03f, -2.524640737e-04f, -7.973100565e-04f, 3.392913914e-04f,
+    3.505786992e-04f, -1.623561278e-03f, 2.463130911e-03f, 7.367068940e-04f, -9.988200154e-03f, 1.929064607e-02f,
+    -1.367669345e-02f, -1.954185907e-02f, 7.208270471e-02f, -1.031869079e-01f, 3.308855177e-02f, 6.631889916e-01f,
+    4.603922768e-01f, -1.142072583e-01f, -1.651897179e-02f, 5.471011343e-02f, -3.944844991e-02f, 1.020841294e-02f,
+    7.568024935e-03f, -9.653042313e-03f, 4.463328728e-03f, -2.336526255e-04f, -8.056472128e-04f, 3.407764766e-04f,
+    3.523796053e-04f, -1.619536197e-03f, 2.438986082e-03f, 7.841370148e-04f, -1.002030976e-02f, 1.922503094e-02f,
+    -1.345541607e-02f, -1.983217005e-02f, 7.213561918e-02f, -1.025456859e-01f, 3.136434862e-02f, 6.619805980e-01f,
+    4.624996049e-01f, -1.134712081e-01f, -1.725680037e-02f, 5.502024515e-02f, -3.940838720e-02f, 1.004631251e-02f,
+    7.685712745e-03f, -9.686191476e-03f, 4.449205277e-03f, -2.147371810e-04f, -8.139849572e-04f, 3.422472496e-04f,
+    3.541410760e-04f, -1.615435258e-03f, 2.414809840e-03f, 8.313456912e-04f, -1.005177292e-02f, 1.915858623e-02f,
+    -1.323403937e-02f, -2.012065974e-02f, 7.218461738e-02f, -1.019012608e-01f, 2.964728778e-02f, 6.607616708e-01f,
+    4.646025784e-01f, -1.127261577e-01f, -1.799599689e-02f, 5.532834165e-02f, -3.936613904e-02f, 9.883220520e-03f,
+    7.803350048e-03f, -9.718927197e-03f, 4.434777146e-03f, -1.957184039e-04f, -8.223227346e-04f, 3.437034698e-04f,
+    3.558632510e-04f, -1.611259121e-03f, 2.390603744e-03f, 8.783310715e-04f, -1.008259001e-02f, 1.909131795e-02f,
+    -1.301257538e-02f, -2.040731791e-02f, 7.222970777e-02f, -1.012536750e-01f, 2.793740434e-02f, 6.595322489e-01f,
+    4.667011340e-01f, -1.119721038e-01f, -1.873652827e-02f, 5.563438139e-02f, -3.932170180e-02f, 9.719142948e-03f,
+    7.920930285e-03f, -9.751246254e-03f, 4.420043979e-03f, -1.765969669e-04f, -8.306599865e-04f, 3.451448964e-04f,
+    3.575462719e-04f, -1.607008449e-03f, 2.366369352e-03f, 9.250913238e-04f, -1.011276143e-02f, 1.902323216e-02f,
+    -1.279103613e-02f, -2.069213444e-02f, 7.227089896e-02f, -1.006029709e-01f, 2.623473306e-02f, 6.582923713e-01f,
+    4.687952085e-01f, -1.112090435e-01f, -1.947836132e-02f, 5.593834288e-02f, -3.927507197e-02f, 9.554085823e-03f,
+    8.038446878e-03f, -9.783145437e-03f, 4.405005433e-03f, -1.573735524e-04f, -8.389961517e-04f, 3.465712882e-04f,
+    3.591902827e-04f, -1.602683908e-03f, 2.342108213e-03f, 9.716246359e-04f, -1.014228761e-02f, 1.895433492e-02f,
+    -1.256943359e-02f, -2.097509933e-02f, 7.230819978e-02f, -9.994919080e-02f, 2.453930841e-02f, 6.570420774e-01f,
+    4.708847387e-01f, -1.104369741e-01f, -2.022146266e-02f, 5.624020467e-02f, -3.922624611e-02f, 9.388055245e-03f,
+    8.155893234e-03f, -9.814621548e-03f, 4.389661185e-03f, -1.380488520e-04f, -8.473306662e-04f, 3.479824038e-04f,
+    3.607954293e-04f, -1.598286161e-03f, 2.317821873e-03f, 1.017929215e-03f, -1.017116901e-02f, 1.888463234e-02f,
+    -1.234777972e-02f, -2.125620272e-02f, 7.234161918e-02f, -9.929237726e-02f, 2.285116454e-02f, 6.557814069e-01f,
+    4.729696618e-01f, -1.096558932e-01f, -2.096579874e-02f, 5.653994536e-02f, -3.917522091e-02f, 9.221057387e-03f,
+    8.273262745e-03f, -9.845671403e-03f, 4.374010928e-03f, -1.186235666e-04f, -8.556629629e-04f, 3.493780012e-04f,
+    3.623618598e-04f, -1.593815878e-03f, 2.293511874e-03f, 1.064003287e-03f, -1.019940615e-02f, 1.881413054e-02f,
+    -1.212608644e-02f, -2.153543486e-02f, 7.237116632e-02f, -9.863257269e-02f, 2.117033528e-02f, 6.545103998e-01f,
+    4.750499147e-01f, -1.088657989e-01f, -2.171133587e-02f, 5.683754361e-02f, -3.912199317e-02f, 9.053098489e-03f,
+    8.390548786e-03f, -9.876291834e-03f, 4.358054370e-03f, -9.909840653e-05f, -8.639924720e-04f, 3.507578386e-04f,
+    3.638897245e-04f, -1.589273727e-03f, 2.269179752e-03f, 1.109845100e-03f, -1.022699957e-02f, 1.874283569e-02f,
+    -1.190436566e-02f, -2.181278613e-02f, 7.239685051e-02f, -9.796981953e-02f, 1.949685414e-02f, 6.532290964e-01f,
+    4.771254346e-01f, -1.080666895e-01f, -2.245804021e-02f, 5.713297813e-02f, -3.906655979e-02f, 8.884184861e-03f,
+    8.507744718e-03f, -9.906479682e-03f, 4.341791238e-03f, -7.947409146e-05f, -8.723186207e-04f, 3.521216736e-04f,
+    3.653791757e-04f, -1.584660378e-03f, 2.244827038e-03f, 1.155452920e-03f, -1.025394983e-02f, 1.867075396e-02f,
+    -1.168262924e-02f, -2.208824703e-02f, 7.241868123e-02f, -9.730416023e-02f, 1.783075433e-02f, 6.519375373e-01f,
+    4.791961588e-01f, -1.072585636e-01f, -2.320587774e-02f, 5.742622768e-02f, -3.900891778e-02f, 8.714322881e-03f,
+    8.624843888e-03f, -9.936231807e-03f, 4.325221276e-03f, -5.975135034e-05f, -8.806408335e-04f, 3.534692637e-04f,
+    3.668303676e-04f, -1.579976503e-03f, 2.220455257e-03f, 1.200825032e-03f, -1.028025755e-02f, 1.859789156e-02f,
+    -1.146088900e-02f, -2.236180817e-02f, 7.243666813e-02f, -9.663563724e-02f, 1.617206874e-02f, 6.506357637e-01f,
+    4.812620247e-01f, -1.064414202e-01f, -2.395481432e-02f, 5.771727108e-02f, -3.894906426e-02f, 8.543518995e-03f,
+    8.741839627e-03f, -9.965545080e-03f, 4.308344243e-03f, -3.993092144e-05f, -8.889585321e-04f, 3.548003662e-04f,
+    3.682434565e-04f, -1.575222774e-03f, 2.196065932e-03f, 1.245959742e-03f, -1.030592336e-02f, 1.852425470e-02f,
+    -1.123915675e-02f, -2.263346032e-02f, 7.245082104e-02f, -9.596429302e-02f, 1.452082991e-02f, 6.493238166e-01f,
+    4.833229698e-01f, -1.056152586e-01f, -2.470481562e-02f, 5.800608719e-02f, -3.888699646e-02f, 8.371779720e-03f,
+    8.858725251e-03f, -9.994416387e-03f, 4.291159917e-03f, -2.001355236e-05f, -8.972711356e-04f, 3.561147381e-04f,
+    3.696186009e-04f, -1.570399867e-03f, 2.171660577e-03f, 1.290855377e-03f, -1.033094794e-02f, 1.844984966e-02f,
+    -1.101744427e-02f, -2.290319433e-02f, 7.246114993e-02f, -9.529017001e-02f, 1.287707011e-02f, 6.480017377e-01f,
+    4.853789316e-01f, -1.047800785e-01f, -2.545584718e-02f, 5.829265496e-02f, -3.882271171e-02f, 8.199111638e-03f,
+    8.975494066e-03f, -1.002284263e-02f, 4.273668093e-03f, 2.414118675e-18f, -9.055780600e-04f, 3.574121363e-04f,
+    3.709559609e-04f, -1.565508456e-03f, 2.147240702e-03f, 1.335510281e-03f, -1.035533200e-02f, 1.837468271e-02f,
+    -1.079576328e-02f, -2.317100121e-02f, 7.246766496e-02f, -9.461331065e-02f, 1.124082125e-02f, 6.466695689e-01f,
+    4.874298479e-01f, -1.039358798e-01f, -2.620787439e-02f, 5.857695336e-02f, -3.875620745e-02f, 8.025521403e-03f,
+    9.092139362e-03f, -1.005082073e-02f, 4.255868582e-03f, 2.010896944e-05f, -9.138787191e-04f, 3.586923176e-04f,
+    3.722556988e-04f, -1.560549218e-03f, 2.122807813e-03f, 1.379922819e-03f, -1.037907628e-02f, 1.829876014e-02f,
+    -1.057412549e-02f, -2.343687208e-02f, 7.247037644e-02f, -9.393375739e-02f, 9.612114945e-03f, 6.453273524e-01f,
+    4.894756566e-01f, -1.030826629e-01f, -2.696086248e-02f, 5.885896146e-02f, -3.868748126e-02f, 7.851015734e-03f,
+    9.208654414e-03f, -1.007834761e-02f, 4.237761214e-03f, 4.031258048e-05f, -9.221725236e-04f, 3.599550386e-04f,
+    3.735179787e-04f, -1.555522832e-03f, 2.098363409e-03f, 1.424091378e-03f, -1.040218156e-02f, 1.822208828e-02f,
+    -1.035254258e-02f, -2.370079818e-02f, 7.246929485e-02f, -9.325155265e-02f, 7.990982474e-03f, 6.439751306e-01f,
+    4.915162954e-01f, -1.022204283e-01f, -2.771477653e-02f, 5.913865835e-02f, -3.861653079e-02f, 7.675601419e-03f,
+    9.325032488e-03f, -1.010542022e-02f, 4.219345836e-03f, 6.061004836e-05f, -9.304588817e-04f, 3.612000557e-04f,
+    3.747429668e-04f, -1.550429974e-03f, 2.073908983e-03f, 1.468014361e-03f, -1.042464865e-02f, 1.814467348e-02f,
+    -1.013102617e-02f, -2.396277087e-02f, 7.246443083e-02f, -9.256673887e-02f, 6.377454800e-03f, 6.426129464e-01f,
+    4.935517025e-01f, -1.013491771e-01f, -2.846958149e-02f, 5.941602322e-02f, -3.854335383e-02f, 7.499285314e-03f,
+    9.441266836e-03f, -1.013203552e-02f, 4.200622312e-03f, 8.100057907e-05f, -9.387371991e-04f, 3.624271253e-04f,
+    3.759308309e-04f, -1.545271327e-03f, 2.049446023e-03f, 1.511690195e-03f, -1.044647839e-02f, 1.806652211e-02f,
+    -9.909587858e-03f, -2.422278166e-02f, 7.245579518e-02f, -9.187935845e-02f, 4.771562563e-03f, 6.412408428e-01f,
+    4.955818161e-01f, -1.004689106e-01f, -2.922524214e-02f, 5.969103530e-02f, -3.846794826e-02f, 7.322074340e-03f,
+    9.557350697e-03f, -1.015819050e-02f, 4.181590522e-03f, 1.014833693e-04f, -9.470068788e-04f, 3.636360038e-04f,
+    3.770817409e-04f, -1.540047569e-03f, 2.024976012e-03f, 1.555117324e-03f, -1.046767165e-02f, 1.798764056e-02f,
+    -9.688239220e-03f, -2.448082216e-02f, 7.244339887e-02f, -9.118945379e-02f, 3.173336078e-03f, 6.398588634e-01f,
+    4.976065744e-01f, -9.957963035e-02f, -2.998172314e-02f, 5.996367390e-02f, -3.839031209e-02f, 7.143975489e-03f,
+    9.673277300e-03f, -1.018388214e-02f, 4.162250368e-03f, 1.220576066e-04f, -9.552673213e-04f, 3.648264473e-04f,
+    3.781958683e-04f, -1.534759383e-03f, 2.000500428e-03f, 1.598294213e-03f, -1.048822934e-02f, 1.790803523e-02f,
+    -9.466991778e-03f, -2.473688411e-02f, 7.242725301e-02f, -9.049706727e-02f, 1.582805334e-03f, 6.384670517e-01f,
+    4.996259158e-01f, -9.868133835e-02f, -3.073898899e-02f, 6.023391837e-02f, -3.831044344e-02f, 6.964995817e-03f,
+    9.789039861e-03f, -1.020910746e-02f, 4.142601765e-03f, 1.427224693e-04f, -9.635179244e-04f, 3.659982121e-04f,
+    3.792733867e-04f, -1.529407451e-03f, 1.976020739e-03f, 1.641219347e-03f, -1.050815241e-02f, 1.782771257e-02f,
+    -9.245857024e-03f, -2.499095939e-02f, 7.240736889e-02f, -8.980224128e-02f, 2.714333592e-17f, 6.370654517e-01f,
+    5.016397790e-01f, -9.777403693e-02f, -3.149700405e-02f, 6.050174816e-02f, -3.822834052e-02f, 6.785142449e-03f,
+    9.904631585e-03f, -1.023386349e-02f, 4.122644650e-03f, 1.634771262e-04f, -9.717580837e-04f, 3.671510543e-04f,
+    3.803144711e-04f, -1.523992457e-03f, 1.951538412e-03f, 1.683891232e-03f, -1.052744182e-02f, 1.774667902e-02f,
+    -9.024846414e-03f, -2.524303998e-02f, 7.238375794e-02f, -8.910501814e-02f, -1.575050586e-03f, 6.356541078e-01f,
+    5.036481025e-01f, -9.685772871e-02f, -3.225573254e-02f, 6.076714276e-02f, -3.814400168e-02f, 6.604422575e-03f,
+    1.002004567e-02f, -1.025814726e-02f, 4.102378973e-03f, 1.843207374e-04f, -9.799871922e-04f, 3.682847301e-04f,
+    3.813192987e-04f, -1.518515085e-03f, 1.927054906e-03f, 1.726308392e-03f, -1.054609859e-02f, 1.766494107e-02f,
+    -8.803971364e-03f, -2.549311801e-02f, 7.235643176e-02f, -8.840544021e-02f, -3.142317408e-03f, 6.342330645e-01f,
+    5.056508252e-01f, -9.593241668e-02f, -3.301513854e-02f, 6.103008176e-02f, -3.805742538e-02f, 6.422843452e-03f,
+    1.013527529e-02f, -1.028195585e-02f, 4.081804707e-03f, 2.052524535e-04f, -9.882046403e-04f, 3.693989957e-04f,
+    3.822880481e-04f, -1.512976019e-03f, 1.902571672e-03f, 1.768469372e-03f, -1.056412375e-02f, 1.758250519e-02f,
+    -8.583243252e-03f, -2.574118571e-02f, 7.232540211e-02f, -8.770354978e-02f, -4.701771781e-03f, 6.328023667e-01f,
+    5.076478860e-01f, -9.499810414e-02f, -3.377518600e-02f, 6.129054479e-02f, -3.796861019e-02f, 6.240412403e-03f,
+    1.025031364e-02f, -1.030528632e-02f, 4.060921840e-03f, 2.262714160e-04f, -9.964098161e-04f, 3.704936074e-04f,
+    3.832208997e-04f, -1.507375945e-03f, 1.878090159e-03f, 1.810372739e-03f, -1.058151837e-02f, 1.749937792e-02f,
+    -8.362673419e-03f, -2.598723546e-02f, 7.229068088e-02f, -8.699938914e-02f, -6.253385345e-03f, 6.313620596e-01f,
+    5.096392239e-01f, -9.405479475e-02f, -3.453583872e-02f, 6.154851156e-02f, -3.787755477e-02f, 6.057136818e-03f,
+    1.036515386e-02f, -1.032813577e-02f, 4.039730377e-03f, 2.473767571e-04f, -1.004602106e-03f, 3.715683214e-04f,
+    3.841180357e-04f, -1.501715548e-03f, 1.853611807e-03f, 1.852017077e-03f, -1.059828355e-02f, 1.741556577e-02f,
+    -8.142273165e-03f, -2.623125976e-02f, 7.225228015e-02f, -8.629300055e-02f, -7.797130069e-03f, 6.299121885e-01f,
+    5.116247783e-01f, -9.310249249e-02f, -3.529706036e-02f, 6.180396188e-02f, -3.778425794e-02f, 5.873024151e-03f,
+    1.047978912e-02f, -1.035050133e-02f, 4.018230345e-03f, 2.685676003e-04f, -1.012780892e-03f, 3.726228940e-04f,
+    3.849796399e-04f, -1.495995516e-03f, 1.829138050e-03f, 1.893400992e-03f, -1.061442042e-02f, 1.733107530e-02f,
+    -7.922053752e-03f, -2.647325122e-02f, 7.221021211e-02f, -8.558442625e-02f, -9.332978251e-03f, 6.284527993e-01f,
+    5.136044884e-01f, -9.214120168e-02f, -3.605881447e-02f, 6.205687559e-02f, -3.768871860e-02f, 5.688081923e-03f,
+    1.059421257e-02f, -1.037238011e-02f, 3.996421786e-03f, 2.898430595e-04f, -1.020945556e-03f, 3.736570819e-04f,
+    3.858058978e-04f, -1.490216536e-03f, 1.804670317e-03f, 1.934523109e-03f, -1.062993016e-02f, 1.724591307e-02f,
+    -7.702026402e-03f, -2.671320259e-02f, 7.216448913e-02f, -8.487370844e-02f, -1.086090252e-02f, 6.269839380e-01f,
+    5.155782937e-01f, -9.117092699e-02f, -3.682106444e-02f, 6.230723265e-02f, -3.759093578e-02f, 5.502317720e-03f,
+    1.070841734e-02f, -1.039376926e-02f, 3.974304761e-03f, 3.112022398e-04f, -1.029095478e-03f, 3.746706414e-04f,
+    3.865969963e-04f, -1.484379295e-03f, 1.780210029e-03f, 1.975382074e-03f, -1.064481396e-02f, 1.716008568e-02f,
+    -7.482202293e-03f, -2.695110674e-02f, 7.211512374e-02f, -8.416088929e-02f, -1.238087583e-02f, 6.255056508e-01f,
+    5.175461339e-01f, -9.019167341e-02f, -3.758377353e-02f, 6.255501306e-02f, -3.749090862e-02f, 5.315739192e-03f,
+    1.082239656e-02f, -1.041466597e-02f, 3.951879349e-03f, 3.326442370e-04f, -1.037230033e-03f, 3.756633295e-04f,
+    3.873531242e-04f, -1.478484480e-03f, 1.755758602e-03f, 2.015976553e-03f, -1.065907304e-02f, 1.707359972e-02f,
+    -7.262592566e-03f, -2.718695667e-02f, 7.206212859e-02f, -8.344601096e-02f, -1.389287147e-02f, 6.240179843e-01f,
+    5.195079488e-01f, -8.920344627e-02f, -3.834690489e-02f, 6.280019692e-02f, -3.738863639e-02f, 5.128354056e-03f,
+    1.093614335e-02f, -1.043506740e-02f, 3.929145649e-03f, 3.541681381e-04f, -1.045348595e-03f, 3.766349029e-04f,
+    3.880744717e-04f, -1.472532782e-03f, 1.731317444e-03f, 2.056305232e-03f, -1.067270866e-02f, 1.698646182e-02f,
+    -7.043208318e-03f, -2.742074551e-02f, 7.200551650e-02f, -8.272911554e-02f, -1.539686307e-02f, 6.225209855e-01f,
+    5.214636782e-01f, -8.820625126e-02f, -3.911042153e-02f, 6.304276440e-02f, -3.728411844e-02f, 4.940170091e-03f,
+    1.104965083e-02f, -1.045497077e-02f, 3.906103776e-03f, 3.757730208e-04f, -1.053450538e-03f, 3.775851187e-04f,
+    3.887612306e-04f, -1.466524887e-03f, 1.706887958e-03f, 2.096366817e-03f, -1.068572212e-02f, 1.689867861e-02f,
+    -6.824060605e-03f, -2.765246649e-02f, 7.194530044e-02f, -8.201024511e-02f, -1.689282456e-02f, 6.210147013e-01f,
+    5.234132624e-01f, -8.720009438e-02f, -3.987428631e-02f, 6.328269575e-02f, -3.717735429e-02f, 4.751195143e-03f,
+    1.116291210e-02f, -1.047437330e-02f, 3.882753866e-03f, 3.974579540e-04f, -1.061535231e-03f, 3.785137342e-04f,
+    3.894135942e-04f, -1.460461485e-03f, 1.682471539e-03f, 2.136160034e-03f, -1.069811473e-02f, 1.681025674e-02f,
+    -6.605160440e-03f, -2.788211300e-02f, 7.188149350e-02f, -8.128944172e-02f, -1.838073025e-02f, 6.194991793e-01f,
+    5.253566414e-01f, -8.618498199e-02f, -4.063846200e-02f, 6.351997131e-02f, -3.706834352e-02f, 4.561437119e-03f,
+    1.127592027e-02f, -1.049327224e-02f, 3.859096071e-03f, 4.192219975e-04f, -1.069602041e-03f, 3.794205069e-04f,
+    3.900317573e-04f, -1.454343265e-03f, 1.658069577e-03f, 2.175683631e-03f, -1.070988785e-02f, 1.672120288e-02f,
+    -6.386518793e-03f, -2.810967854e-02f, 7.181410894e-02f, -8.056674734e-02f, -1.986055474e-02f, 6.179744671e-01f,
+    5.272937558e-01f, -8.516092078e-02f, -4.140291122e-02f, 6.375457150e-02f, -3.695708588e-02f, 4.370903993e-03f,
+    1.138866842e-02f, -1.051166484e-02f, 3.835130564e-03f, 4.410642021e-04f, -1.077650335e-03f, 3.803051944e-04f,
+    3.906159163e-04f, -1.448170917e-03f, 1.633683455e-03f, 2.214936372e-03f, -1.072104286e-02f, 1.663152372e-02f,
+    -6.168146589e-03f, -2.833515674e-02f, 7.174316017e-02f, -7.984220395e-02f, -2.133227298e-02f, 6.164406126e-01f,
+    5.292245461e-01f, -8.412791777e-02f, -4.216759648e-02f, 6.398647681e-02f, -3.684358120e-02f, 4.179603801e-03f,
+    1.150114965e-02f, -1.052954839e-02f, 3.810857534e-03f, 4.629836097e-04f, -1.085679477e-03f, 3.811675549e-04f,
+    3.911662689e-04f, -1.441945129e-03f, 1.609314547e-03f, 2.253917047e-03f, -1.073158116e-02f, 1.654122595e-02f,
+    -5.950054711e-03f, -2.855854134e-02f, 7.166866073e-02f, -7.911585346e-02f, -2.279586026e-02f, 6.148976642e-01f,
+    5.311489530e-01f, -8.308598035e-02f, -4.293248014e-02f, 6.421566784e-02f, -3.672782944e-02f, 3.987544642e-03f,
+    1.161335704e-02f, -1.054692018e-02f, 3.786277191e-03f, 4.849792532e-04f, -1.093688828e-03f, 3.820073465e-04f,
+    3.916830144e-04f, -1.435666592e-03f, 1.584964222e-03f, 2.292624460e-03f, -1.074150421e-02f, 1.645031628e-02f,
+    -5.732253996e-03f, -2.877982622e-02f, 7.159062429e-02f, -7.838773773e-02f, -2.425129219e-02f, 6.133456702e-01f,
+    5.330669173e-01f, -8.203511622e-02f, -4.369752448e-02f, 6.444212525e-02f, -3.660983068e-02f, 3.794734678e-03f,
+    1.172528366e-02f, -1.056377755e-02f, 3.761389763e-03f, 5.070501566e-04f, -1.101677748e-03f, 3.828243279e-04f,
+    3.921663533e-04f, -1.429335994e-03f, 1.560633842e-03f, 2.331057440e-03f, -1.075081347e-02f, 1.635880145e-02f,
+    -5.514755239e-03f, -2.899900540e-02f, 7.150906470e-02f, -7.765789860e-02f, -2.569854473e-02f, 6.117846795e-01f,
+    5.349783802e-01f, -8.097533344e-02f, -4.446269162e-02f, 6.466582981e-02f, -3.648958512e-02f, 3.601182134e-03f,
+    1.183692259e-02f, -1.058011784e-02f, 3.736195497e-03f, 5.291953353e-04f, -1.109645594e-03f, 3.836182580e-04f,
+    3.926164876e-04f, -1.422954027e-03f, 1.536324763e-03f, 2.369214834e-03f, -1.075951044e-02f, 1.626668818e-02f,
+    -5.297569185e-03f, -2.921607300e-02f, 7.142399591e-02f, -7.692637783e-02f, -2.713759417e-02f, 6.102147410e-01f,
+    5.368832828e-01f, -7.990664039e-02f, -4.522794359e-02f, 6.488676236e-02f, -3.636709307e-02f, 3.406895299e-03f,
+    1.194826688e-02f, -1.059593840e-02f, 3.710694659e-03f, 5.514137954e-04f, -1.117591724e-03f, 3.843888960e-04f,
+    3.930336208e-04f, -1.416521378e-03f, 1.512038331e-03f, 2.407095509e-03f, -1.076759665e-02f, 1.617398324e-02f,
+    -5.080706537e-03f, -2.943102327e-02f, 7.133543203e-02f, -7.619321715e-02f, -2.856841713e-02f, 6.086359040e-01f,
+    5.387815665e-01f, -7.882904581e-02f, -4.599324229e-02f, 6.510490385e-02f, -3.624235498e-02f, 3.211882522e-03f,
+    1.205930961e-02f, -1.061123662e-02f, 3.684887532e-03f, 5.737045344e-04f, -1.125515490e-03f, 3.851360016e-04f,
+    3.934179575e-04f, -1.410038737e-03f, 1.487775888e-03f, 2.444698353e-03f, -1.077507367e-02f, 1.608069339e-02f,
+    -4.864177949e-03f, -2.964385060e-02f, 7.124338731e-02f, -7.545845825e-02f, -2.999099057e-02f, 6.070482181e-01f,
+    5.406731730e-01f, -7.774255877e-02f, -4.675854950e-02f, 6.532023530e-02f, -3.611537139e-02f, 3.016152215e-03f,
+    1.217004384e-02f, -1.062600991e-02f, 3.658774420e-03f, 5.960665411e-04f, -1.133416245e-03f, 3.858593348e-04f,
+    3.937697038e-04f, -1.403506794e-03f, 1.463538767e-03f, 2.482022273e-03f, -1.078194308e-02f, 1.598682540e-02f,
+    -4.647994030e-03f, -2.985454950e-02f, 7.114787614e-02f, -7.472214275e-02f, -3.140529179e-02f, 6.054517330e-01f,
+    5.425580438e-01f, -7.664718869e-02f, -4.752382689e-02f, 6.553273784e-02f, -3.598614298e-02f, 2.819712851e-03f,
+    1.228046261e-02f, -1.064025568e-02f, 3.632355646e-03f, 6.184987952e-04f, -1.141293339e-03f, 3.865586560e-04f,
+    3.940890670e-04f, -1.396926237e-03f, 1.439328295e-03f, 2.519066199e-03f, -1.078820650e-02f, 1.589238607e-02f,
+    -4.432165341e-03f, -3.006311460e-02f, 7.104891303e-02f, -7.398431221e-02f, -3.281129841e-02f, 6.038464989e-01f,
+    5.444361210e-01f, -7.554294532e-02f, -4.828903602e-02f, 6.574239268e-02f, -3.585467054e-02f, 2.622572965e-03f,
+    1.239055898e-02f, -1.065397140e-02f, 3.605631552e-03f, 6.410002681e-04f, -1.149146121e-03f, 3.872337261e-04f,
+    3.943762557e-04f, -1.390297755e-03f, 1.415145791e-03f, 2.555829077e-03f, -1.079386558e-02f, 1.579738219e-02f,
+    -4.216702395e-03f, -3.026954066e-02f, 7.094651263e-02f, -7.324500815e-02f, -3.420898842e-02f, 6.022325660e-01f,
+    5.463073466e-01f, -7.442983877e-02f, -4.905413834e-02f, 6.594918113e-02f, -3.572095499e-02f, 2.424741153e-03f,
+    1.250032601e-02f, -1.066715452e-02f, 3.578602498e-03f, 6.635699221e-04f, -1.156973938e-03f, 3.878843064e-04f,
+    3.946314797e-04f, -1.383622037e-03f, 1.390992567e-03f, 2.592309876e-03f, -1.079892200e-02f, 1.570182059e-02f,
+    -4.001615658e-03f, -3.047382256e-02f, 7.084068974e-02f, -7.250427203e-02f, -3.559834012e-02f, 6.006099849e-01f,
+    5.481716628e-01f, -7.330787947e-02f, -4.981909518e-02f, 6.615308460e-02f, -3.558499735e-02f, 2.226226072e-03f,
+    1.260975673e-02f, -1.067980254e-02f, 3.551268864e-03f, 6.862067111e-04f, -1.164776135e-03f, 3.885101588e-04f,
+    3.948549502e-04f, -1.376899771e-03f, 1.366869928e-03f, 2.628507584e-03f, -1.080337745e-02f, 1.560570807e-02f,
+    -3.786915546e-03f, -3.067595532e-02f, 7.073145928e-02f, -7.176214524e-02f, -3.697933216e-02f, 5.989788064e-01f,
+    5.500290122e-01f, -7.217707820e-02f, -5.058386777e-02f, 6.635408459e-02f, -3.544679880e-02f, 2.027036438e-03f,
+    1.271884419e-02f, -1.069191296e-02f, 3.523631049e-03f, 7.089095800e-04f, -1.172552056e-03f, 3.891110455e-04f,
+    3.950468794e-04f, -1.370131644e-03f, 1.342779171e-03f, 2.664421210e-03f, -1.080723367e-02f, 1.550905149e-02f,
+    -3.572612428e-03f, -3.087593407e-02f, 7.061883629e-02f, -7.101866913e-02f, -3.835194351e-02f, 5.973390815e-01f,
+    5.518793374e-01f, -7.103744608e-02f, -5.134841723e-02f, 6.655216271e-02f, -3.530636060e-02f, 1.827181028e-03f,
+    1.282758144e-02f, -1.070348333e-02f, 3.495689472e-03f, 7.316774654e-04f, -1.180301041e-03f, 3.896867293e-04f,
+    3.952074807e-04f, -1.363318345e-03f, 1.318721586e-03f, 2.700049782e-03f, -1.081049242e-02f, 1.541185767e-02f,
+    -3.358716621e-03f, -3.107375407e-02f, 7.050283598e-02f, -7.027388495e-02f, -3.971615351e-02f, 5.956908616e-01f,
+    5.537225811e-01f, -6.988899458e-02f, -5.211270457e-02f, 6.674730065e-02f, -3.516368415e-02f, 1.626668679e-03f,
+    1.293596151e-02f, -1.071451120e-02f, 3.467444569e-03f, 7.545092951e-04f, -1.188022433e-03f, 3.902369737e-04f,
+    3.953369688e-04f, -1.356460559e-03f, 1.294698454e-03f, 2.735392350e-03f, -1.081315549e-02f, 1.531413347e-02f,
+    -3.145238395e-03f, -3.126941071e-02f, 7.038347365e-02f, -6.952783394e-02f, -4.107194181e-02f, 5.940341981e-01f,
+    5.555586865e-01f, -6.873173551e-02f, -5.287669070e-02f, 6.693948021e-02f, -3.501877096e-02f, 1.425508288e-03f,
+    1.304397745e-02f, -1.072499415e-02f, 3.438896799e-03f, 7.774039886e-04f, -1.195715569e-03f, 3.907615425e-04f,
+    3.954355595e-04f, -1.349558973e-03f, 1.270711052e-03f, 2.770447980e-03f, -1.081522470e-02f, 1.521588575e-02f,
+    -2.932187968e-03f, -3.146289951e-02f, 7.026076475e-02f, -6.878055722e-02f, -4.241928842e-02f, 5.923691430e-01f,
+    5.573875967e-01f, -6.756568101e-02f, -5.364033642e-02f, 6.712868329e-02f, -3.487162269e-02f, 1.223708810e-03f,
+    1.315162231e-02f, -1.073492978e-02f, 3.410046637e-03f, 8.003604565e-04f, -1.203379786e-03f, 3.912602003e-04f,
+    3.955034695e-04f, -1.342614273e-03f, 1.246760645e-03f, 2.805215764e-03f, -1.081670188e-02f, 1.511712139e-02f,
+    -2.719575506e-03f, -3.165421610e-02f, 7.013472484e-02f, -6.803209588e-02f, -4.375817368e-02f, 5.906957482e-01f,
+    5.592092551e-01f, -6.639084357e-02f, -5.440360244e-02f, 6.731489191e-02f, -3.472224108e-02f, 1.021279260e-03f,
+    1.325888911e-02f, -1.074431572e-02f, 3.380894579e-03f, 8.233776011e-04f, -1.211014421e-03f, 3.917327123e-04f,
+    3.955409168e-04f, -1.335627143e-03f, 1.222848494e-03f, 2.839694808e-03f, -1.081758891e-02f, 1.501784726e-02f,
+    -2.507411127e-03f, -3.184335624e-02f, 7.000536963e-02f, -6.728249091e-02f, -4.508857827e-02f, 5.890140660e-01f,
+    5.610236053e-01f, -6.520723603e-02f, -5.516644936e-02f, 6.749808817e-02f, -3.457062803e-02f, 8.182287100e-04f,
+    1.336577090e-02f, -1.075314962e-02f, 3.351441141e-03f, 8.464543164e-04f, -1.218618808e-03f, 3.921788441e-04f,
+    3.955481205e-04f, -1.328598270e-03f, 1.198975850e-03f, 2.873884242e-03f, -1.081788768e-02f, 1.491807024e-02f,
+    -2.295704897e-03f, -3.203031582e-02f, 6.987271494e-02f, -6.653178327e-02f, -4.641048321e-02f, 5.873241488e-01f,
+    5.628305911e-01f, -6.401487157e-02f, -5.592883770e-02f, 6.767825429e-02f, -3.441678554e-02f, 6.145662914e-04f,
+    1.347226073e-02f, -1.076142915e-02f, 3.321686857e-03f, 8.695894876e-04f, -1.226192280e-03f, 3.925983622e-04f,
+    3.955253005e-04f, -1.321528335e-03f, 1.175143958e-03f, 2.907783215e-03f, -1.081760012e-02f, 1.481779724e-02f,
+    -2.084466827e-03f, -3.221509086e-02f, 6.973677671e-02f, -6.578001382e-02f, -4.772386985e-02f, 5.856260496e-01f,
+    5.646301566e-01f, -6.281376369e-02f, -5.669072784e-02f, 6.785537258e-02f, -3.426071574e-02f, 4.103011931e-04f,
+    1.357835164e-02f, -1.076915200e-02f, 3.291632281e-03f, 8.927819918e-04f, -1.233734168e-03f, 3.929910338e-04f,
+    3.954726780e-04f, -1.314418023e-03f, 1.151354054e-03f, 2.941390896e-03f, -1.081672819e-02f, 1.471703514e-02f,
+    -1.873706880e-03f, -3.239767750e-02f, 6.959757103e-02f, -6.502722333e-02f, -4.902871991e-02f, 5.839198211e-01f,
+    5.664222458e-01f, -6.160392625e-02f, -5.745208012e-02f, 6.802942548e-02f, -3.410242088e-02f, 2.054426614e-04f,
+    1.368403666e-02f, -1.077631590e-02f, 3.261277988e-03f, 9.160306977e-04f, -1.241243803e-03f, 3.933566265e-04f,
+    3.953904749e-04f, -1.307268016e-03f, 1.127607366e-03f, 2.974706473e-03f, -1.081527385e-02f, 1.461579087e-02f,
+    -1.663434962e-03f, -3.257807199e-02f, 6.945511408e-02f, -6.427345254e-02f, -5.032501542e-02f, 5.822055166e-01f,
+    5.682068033e-01f, -6.038537347e-02f, -5.821285474e-02f, 6.820039552e-02f, -3.394190334e-02f, -1.414687729e-17f,
+    1.378930885e-02f, -1.078291858e-02f, 3.230624570e-03f, 9.393344656e-04f, -1.248720513e-03f, 3.936949089e-04f,
+    3.952789144e-04f, -1.300078995e-03f, 1.103905116e-03f, 3.007729155e-03f, -1.081323911e-02f, 1.451407132e-02f,
+    -1.453660930e-03f, -3.275627072e-02f, 6.930942217e-02f, -6.351874208e-02f, -5.161273877e-02f, 5.804831895e-01f,
+    5.699837736e-01f, -5.915811987e-02f, -5.897301184e-02f, 6.836826534e-02f, -3.377916561e-02f, -2.060174309e-04f,
+    1.389416126e-02f, -1.078895782e-02f, 3.199672641e-03f, 9.626921475e-04f, -1.256163627e-03f, 3.940056502e-04f,
+    3.951382204e-04f, -1.292851640e-03f, 1.080248515e-03f, 3.040458170e-03f, -1.081062601e-02f, 1.441188343e-02f,
+    -1.244394585e-03f, -3.293227021e-02f, 6.916051175e-02f, -6.276313250e-02f, -5.289187268e-02f, 5.787528936e-01f,
+    5.717531015e-01f, -5.792218035e-02f, -5.973251144e-02f, 6.853301772e-02f, -3.361421032e-02f, -4.126002145e-04f,
+    1.399858693e-02f, -1.079443142e-02f, 3.168422835e-03f, 9.861025873e-04f, -1.263572471e-03f, 3.942886206e-04f,
+    3.949686177e-04f, -1.285586633e-03f, 1.056638769e-03f, 3.072892768e-03f, -1.080743659e-02f, 1.430923411e-02f,
+    -1.035645675e-03f, -3.310606709e-02f, 6.900839937e-02f, -6.200666430e-02f, -5.416240022e-02f, 5.770146826e-01f,
+    5.735147321e-01f, -5.667757013e-02f, -6.049131349e-02f, 6.869463550e-02f, -3.344704020e-02f, -6.197388780e-04f,
+    1.410257893e-02f, -1.079933717e-02f, 3.136875802e-03f, 1.009564621e-03f, -1.270946371e-03f, 3.945435907e-04f,
+    3.947703323e-04f, -1.278284650e-03f, 1.033077075e-03f, 3.105032215e-03f, -1.080367294e-02f, 1.420613030e-02f,
+    -8.274238926e-04f, -3.327765813e-02f, 6.885310169e-02f, -6.124937785e-02f, -5.542430478e-02f, 5.752686106e-01f,
+    5.752686106e-01f, -5.542430478e-02f, -6.124937785e-02f, 6.885310169e-02f, -3.327765813e-02f, -8.274238926e-04f,
+    1.420613030e-02f, -1.080367294e-02f, 3.105032215e-03f, 1.033077075e-03f, -1.278284650e-03f, 3.947703323e-04f,
+    3.945435907e-04f, -1.270946371e-03f, 1.009564621e-03f, 3.136875802e-03f, -1.079933717e-02f, 1.410257893e-02f,
+    -6.197388780e-04f, -3.344704020e-02f, 6.869463550e-02f, -6.049131349e-02f, -5.667757013e-02f, 5.735147321e-01f,
+    5.770146826e-01f, -5.416240022e-02f, -6.200666430e-02f, 6.900839937e-02f, -3.310606709e-02f, -1.035645675e-03f,
+    1.430923411e-02f, -1.080743659e-02f, 3.072892768e-03f, 1.056638769e-03f, -1.285586633e-03f, 3.949686177e-04f,
+    3.942886206e-04f, -1.263572471e-03f, 9.861025873e-04f, 3.168422835e-03f, -1.079443142e-02f, 1.399858693e-02f,
+    -4.126002145e-04f, -3.361421032e-02f, 6.853301772e-02f, -5.973251144e-02f, -5.792218035e-02f, 5.717531015e-01f,
+    5.787528936e-01f, -5.289187268e-02f, -6.276313250e-02f, 6.916051175e-02f, -3.293227021e-02f, -1.244394585e-03f,
+    1.441188343e-02f, -1.081062601e-02f, 3.040458170e-03f, 1.080248515e-03f, -1.292851640e-03f, 3.951382204e-04f,
+    3.940056502e-04f, -1.256163627e-03f, 9.626921475e-04f, 3.199672641e-03f, -1.078895782e-02f, 1.389416126e-02f,
+    -2.060174309e-04f, -3.377916561e-02f, 6.836826534e-02f, -5.897301184e-02f, -5.915811987e-02f, 5.699837736e-01f,
+    5.804831895e-01f, -5.161273877e-02f, -6.351874208e-02f, 6.930942217e-02f, -3.275627072e-02f, -1.453660930e-03f,
+    1.451407132e-02f, -1.081323911e-02f, 3.007729155e-03f, 1.103905116e-03f, -1.300078995e-03f, 3.952789144e-04f,
+    3.936949089e-04f, -1.248720513e-03f, 9.393344656e-04f, 3.230624570e-03f, -1.078291858e-02f, 1.378930885e-02f,
+    -1.414687729e-17f, -3.394190334e-02f, 6.820039552e-02f, -5.821285474e-02f, -6.038537347e-02f, 5.682068033e-01f,
+    5.822055166e-01f, -5.032501542e-02f, -6.427345254e-02f, 6.945511408e-02f, -3.257807199e-02f, -1.663434962e-03f,
+    1.461579087e-02f, -1.081527385e-02f, 2.974706473e-03f, 1.127607366e-03f, -1.307268016e-03f, 3.953904749e-04f,
+    3.933566265e-04f, -1.241243803e-03f, 9.160306977e-04f, 3.261277988e-03f, -1.077631590e-02f, 1.368403666e-02f,
+    2.054426614e-04f, -3.410242088e-02f, 6.802942548e-02f, -5.745208012e-02f, -6.160392625e-02f, 5.664222458e-01f,
+    5.839198211e-01f, -4.902871991e-02f, -6.502722333e-02f, 6.959757103e-02f, -3.239767750e-02f, -1.873706880e-03f,
+    1.471703514e-02f, -1.081672819e-02f, 2.941390896e-03f, 1.151354054e-03f, -1.314418023e-03f, 3.954726780e-04f,
+    3.929910338e-04f, -1.233734168e-03f, 8.927819918e-04f, 3.291632281e-03f, -1.076915200e-02f, 1.357835164e-02f,
+    4.103011931e-04f, -3.426071574e-02f, 6.785537258e-02f, -5.669072784e-02f, -6.281376369e-02f, 5.646301566e-01f,
+    5.856260496e-01f, -4.772386985e-02f, -6.578001382e-02f, 6.973677671e-02f, -3.221509086e-02f, -2.084466827e-03f,
+    1.481779724e-02f, -1.081760012e-02f, 2.907783215e-03f, 1.175143958e-03f, -1.321528335e-03f, 3.955253005e-04f,
+    3.925983622e-04f, -1.226192280e-03f, 8.695894876e-04f, 3.321686857e-03f, -1.076142915e-02f, 1.347226073e-02f,
+    6.145662914e-04f, -3.441678554e-02f, 6.767825429e-02f, -5.592883770e-02f, -6.401487157e-02f, 5.628305911e-01f,
+    5.873241488e-01f, -4.641048321e-02f, -6.653178327e-02f, 6.987271494e-02f, -3.203031582e-02f, -2.295704897e-03f,
+    1.491807024e-02f, -1.081788768e-02f, 2.873884242e-03f, 1.198975850e-03f, -1.328598270e-03f, 3.955481205e-04f,
+    3.921788441e-04f, -1.218618808e-03f, 8.464543164e-04f, 3.351441141e-03f, -1.075314962e-02f, 1.336577090e-02f,
+    8.182287100e-04f, -3.457062803e-02f, 6.749808817e-02f, -5.516644936e-02f, -6.520723603e-02f, 5.610236053e-01f,
+    5.890140660e-01f, -4.508857827e-02f, -6.728249091e-02f, 7.000536963e-02f, -3.184335624e-02f, -2.507411127e-03f,
+    1.501784726e-02f, -1.081758891e-02f, 2.839694808e-03f, 1.222848494e-03f, -1.335627143e-03f, 3.955409168e-04f,
+    3.917327123e-04f, -1.211014421e-03f, 8.233776011e-04f, 3.380894579e-03f, -1.074431572e-02f, 1.325888911e-02f,
+    1.021279260e-03f, -3.472224108e-02f, 6.731489191e-02f, -5.440360244e-02f, -6.639084357e-02f, 5.592092551e-01f,
+    5.906957482e-01f, -4.375817368e-02f, -6.803209588e-02f, 7.013472484e-02f, -3.165421610e-02f, -2.719575506e-03f,
+    1.511712139e-02f, -1.081670188e-02f, 2.805215764e-03f, 1.246760645e-03f, -1.342614273e-03f, 3.955034695e-04f,
+    3.912602003e-04f, -1.203379786e-03f, 8.003604565e-04f, 3.410046637e-03f, -1.073492978e-02f, 1.315162231e-02f,
+    1.223708810e-03f, -3.487162269e-02f, 6.712868329e-02f, -5.364033642e-02f, -6.756568101e-02f, 5.573875967e-01f,
+    5.923691430e-01f, -4.241928842e-02f, -6.878055722e-02f, 7.026076475e-02f, -3.146289951e-02f, -2.932187968e-03f,
+    1.521588575e-02f, -1.081522470e-02f, 2.770447980e-03f, 1.270711052e-03f, -1.349558973e-03f, 3.954355595e-04f,
+    3.907615425e-04f, -1.195715569e-03f, 7.774039886e-04f, 3.438896799e-03f, -1.072499415e-02f, 1.304397745e-02f,
+    1.425508288e-03f, -3.501877096e-02f, 6.693948021e-02f, -5.287669070e-02f, -6.873173551e-02f, 5.555586865e-01f,
+    5.940341981e-01f, -4.107194181e-02f, -6.952783394e-02f, 7.038347365e-02f, -3.126941071e-02f, -3.145238395e-03f,
+    1.531413347e-02f, -1.081315549e-02f, 2.735392350e-03f, 1.294698454e-03f, -1.356460559e-03f, 3.953369688e-04f,
+    3.902369737e-04f, -1.188022433e-03f, 7.545092951e-04f, 3.467444569e-03f, -1.071451120e-02f, 1.293596151e-02f,
+    1.626668679e-03f, -3.516368415e-02f, 6.674730065e-02f, -5.211270457e-02f, -6.988899458e-02f, 5.537225811e-01f,
+    5.956908616e-01f, -3.971615351e-02f, -7.027388495e-02f, 7.050283598e-02f, -3.107375407e-02f, -3.358716621e-03f,
+    1.541185767e-02f, -1.081049242e-02f, 2.700049782e-03f, 1.318721586e-03f, -1.363318345e-03f, 3.952074807e-04f,
+    3.896867293e-04f, -1.180301041e-03f, 7.316774654e-04f, 3.495689472e-03f, -1.070348333e-02f, 1.282758144e-02f,
+    1.827181028e-03f, -3.530636060e-02f, 6.655216271e-02f, -5.134841723e-02f, -7.103744608e-02f, 5.518793374e-01f,
+    5.973390815e-01f, -3.835194351e-02f, -7.101866913e-02f, 7.061883629e-02f, -3.087593407e-02f, -3.572612428e-03f,
+    1.550905149e-02f, -1.080723367e-02f, 2.664421210e-03f, 1.342779171e-03f, -1.370131644e-03f, 3.950468794e-04f,
+    3.891110455e-04f, -1.172552056e-03f, 7.089095800e-04f, 3.523631049e-03f, -1.069191296e-02f, 1.271884419e-02f,
+    2.027036438e-03f, -3.544679880e-02f, 6.635408459e-02f, -5.058386777e-02f, -7.217707820e-02f, 5.500290122e-01f,
+    5.989788064e-01f, -3.697933216e-02f, -7.176214524e-02f, 7.073145928e-02f, -3.067595532e-02f, -3.786915546e-03f,
+    1.560570807e-02f, -1.080337745e-02f, 2.628507584e-03f, 1.366869928e-03f, -1.376899771e-03f, 3.948549502e-04f,
+    3.885101588e-04f, -1.164776135e-03f, 6.862067111e-04f, 3.551268864e-03f, -1.067980254e-02f, 1.260975673e-02f,
+    2.226226072e-03f, -3.558499735e-02f, 6.615308460e-02f, -4.981909518e-02f, -7.330787947e-02f, 5.481716628e-01f,
+    6.006099849e-01f, -3.559834012e-02f, -7.250427203e-02f, 7.084068974e-02f, -3.047382256e-02f, -4.001615658e-03f,
+    1.570182059e-02f, -1.079892200e-02f, 2.592309876e-03f, 1.390992567e-03f, -1.383622037e-03f, 3.946314797e-04f,
+    3.878843064e-04f, -1.156973938e-03f, 6.635699221e-04f, 3.578602498e-03f, -1.066715452e-02f, 1.250032601e-02f,
+    2.424741153e-03f, -3.572095499e-02f, 6.594918113e-02f, -4.905413834e-02f, -7.442983877e-02f, 5.463073466e-01f,
+    6.022325660e-01f, -3.420898842e-02f, -7.324500815e-02f, 7.094651263e-02f, -3.026954066e-02f, -4.216702395e-03f,
+    1.579738219e-02f, -1.079386558e-02f, 2.555829077e-03f, 1.415145791e-03f, -1.390297755e-03f, 3.943762557e-04f,
+    3.872337261e-04f, -1.149146121e-03f, 6.410002681e-04f, 3.605631552e-03f, -1.065397140e-02f, 1.239055898e-02f,
+    2.622572965e-03f, -3.585467054e-02f, 6.574239268e-02f, -4.828903602e-02f, -7.554294532e-02f, 5.444361210e-01f,
+    6.038464989e-01f, -3.281129841e-02f, -7.398431221e-02f, 7.104891303e-02f, -3.006311460e-02f, -4.432165341e-03f,
+    1.589238607e-02f, -1.078820650e-02f, 2.519066199e-03f, 1.439328295e-03f, -1.396926237e-03f, 3.940890670e-04f,
+    3.865586560e-04f, -1.141293339e-03f, 6.184987952e-04f, 3.632355646e-03f, -1.064025568e-02f, 1.228046261e-02f,
+    2.819712851e-03f, -3.598614298e-02f, 6.553273784e-02f, -4.752382689e-02f, -7.664718869e-02f, 5.425580438e-01f,
+    6.054517330e-01f, -3.140529179e-02f, -7.472214275e-02f, 7.114787614e-02f, -2.985454950e-02f, -4.647994030e-03f,
+    1.598682540e-02f, -1.078194308e-02f, 2.482022273e-03f, 1.463538767e-03f, -1.403506794e-03f, 3.937697038e-04f,
+    3.858593348e-04f, -1.133416245e-03f, 5.960665411e-04f, 3.658774420e-03f, -1.062600991e-02f, 1.217004384e-02f,
+    3.016152215e-03f, -3.611537139e-02f, 6.532023530e-02f, -4.675854950e-02f, -7.774255877e-02f, 5.406731730e-01f,
+    6.070482181e-01f, -2.999099057e-02f, -7.545845825e-02f, 7.124338731e-02f, -2.964385060e-02f, -4.864177949e-03f,
+    1.608069339e-02f, -1.077507367e-02f, 2.444698353e-03f, 1.487775888e-03f, -1.410038737e-03f, 3.934179575e-04f,
+    3.851360016e-04f, -1.125515490e-03f, 5.737045344e-04f, 3.684887532e-03f, -1.061123662e-02f, 1.205930961e-02f,
+    3.211882522e-03f, -3.624235498e-02f, 6.510490385e-02f, -4.599324229e-02f, -7.882904581e-02f, 5.387815665e-01f,
+    6.086359040e-01f, -2.856841713e-02f, -7.619321715e-02f, 7.133543203e-02f, -2.943102327e-02f, -5.080706537e-03f,
+    1.617398324e-02f, -1.076759665e-02f, 2.407095509e-03f, 1.512038331e-03f, -1.416521378e-03f, 3.930336208e-04f,
+    3.843888960e-04f, -1.117591724e-03f, 5.514137954e-04f, 3.710694659e-03f, -1.059593840e-02f, 1.194826688e-02f,
+    3.406895299e-03f, -3.636709307e-02f, 6.488676236e-02f, -4.522794359e-02f, -7.990664039e-02f, 5.368832828e-01f,
+    6.102147410e-01f, -2.713759417e-02f, -7.692637783e-02f, 7.142399591e-02f, -2.921607300e-02f, -5.297569185e-03f,
+    1.626668818e-02f, -1.075951044e-02f, 2.369214834e-03f, 1.536324763e-03f, -1.422954027e-03f, 3.926164876e-04f,
+    3.836182580e-04f, -1.109645594e-03f, 5.291953353e-04f, 3.736195497e-03f, -1.058011784e-02f, 1.183692259e-02f,
+    3.601182134e-03f, -3.648958512e-02f, 6.466582981e-02f, -4.446269162e-02f, -8.097533344e-02f, 5.349783802e-01f,
+    6.117846795e-01f, -2.569854473e-02f, -7.765789860e-02f, 7.150906470e-02f, -2.899900540e-02f, -5.514755239e-03f,
+    1.635880145e-02f, -1.075081347e-02f, 2.331057440e-03f, 1.560633842e-03f, -1.429335994e-03f, 3.921663533e-04f,
+    3.828243279e-04f, -1.101677748e-03f, 5.070501566e-04f, 3.761389763e-03f, -1.056377755e-02f, 1.172528366e-02f,
+    3.794734678e-03f, -3.660983068e-02f, 6.444212525e-02f, -4.369752448e-02f, -8.203511622e-02f, 5.330669173e-01f,
+    6.133456702e-01f, -2.425129219e-02f, -7.838773773e-02f, 7.159062429e-02f, -2.877982622e-02f, -5.732253996e-03f,
+    1.645031628e-02f, -1.074150421e-02f, 2.292624460e-03f, 1.584964222e-03f, -1.435666592e-03f, 3.916830144e-04f,
+    3.820073465e-04f, -1.093688828e-03f, 4.849792532e-04f, 3.786277191e-03f, -1.054692018e-02f, 1.161335704e-02f,
+    3.987544642e-03f, -3.672782944e-02f, 6.421566784e-02f, -4.293248014e-02f, -8.308598035e-02f, 5.311489530e-01f,
+    6.148976642e-01f, -2.279586026e-02f, -7.911585346e-02f, 7.166866073e-02f, -2.855854134e-02f, -5.950054711e-03f,
+    1.654122595e-02f, -1.073158116e-02f, 2.253917047e-03f, 1.609314547e-03f, -1.441945129e-03f, 3.911662689e-04f,
+    3.811675549e-04f, -1.085679477e-03f, 4.629836097e-04f, 3.810857534e-03f, -1.052954839e-02f, 1.150114965e-02f,
+    4.179603801e-03f, -3.684358120e-02f, 6.398647681e-02f, -4.216759648e-02f, -8.412791777e-02f, 5.292245461e-01f,
+    6.164406126e-01f, -2.133227298e-02f, -7.984220395e-02f, 7.174316017e-02f, -2.833515674e-02f, -6.168146589e-03f,
+    1.663152372e-02f, -1.072104286e-02f, 2.214936372e-03f, 1.633683455e-03f, -1.448170917e-03f, 3.906159163e-04f,
+    3.803051944e-04f, -1.077650335e-03f, 4.410642021e-04f, 3.835130564e-03f, -1.051166484e-02f, 1.138866842e-02f,
+    4.370903993e-03f, -3.695708588e-02f, 6.375457150e-02f, -4.140291122e-02f, -8.516092078e-02f, 5.272937558e-01f,
+    6.179744671e-01f, -1.986055474e-02f, -8.056674734e-02f, 7.181410894e-02f, -2.810967854e-02f, -6.386518793e-03f,
+    1.672120288e-02f, -1.070988785e-02f, 2.175683631e-03f, 1.658069577e-03f, -1.454343265e-03f, 3.900317573e-04f,
+    3.794205069e-04f, -1.069602041e-03f, 4.192219975e-04f, 3.859096071e-03f, -1.049327224e-02f, 1.127592027e-02f,
+    4.561437119e-03f, -3.706834352e-02f, 6.351997131e-02f, -4.063846200e-02f, -8.618498199e-02f, 5.253566414e-01f,
+    6.194991793e-01f, -1.838073025e-02f, -8.128944172e-02f, 7.188149350e-02f, -2.788211300e-02f, -6.605160440e-03f,
+    1.681025674e-02f, -1.069811473e-02f, 2.136160034e-03f, 1.682471539e-03f, -1.460461485e-03f, 3.894135942e-04f,
+    3.785137342e-04f, -1.061535231e-03f, 3.974579540e-04f, 3.882753866e-03f, -1.047437330e-02f, 1.116291210e-02f,
+    4.751195143e-03f, -3.717735429e-02f, 6.328269575e-02f, -3.987428631e-02f, -8.720009438e-02f, 5.234132624e-01f,
+    6.210147013e-01f, -1.689282456e-02f, -8.201024511e-02f, 7.194530044e-02f, -2.765246649e-02f, -6.824060605e-03f,
+    1.689867861e-02f, -1.068572212e-02f, 2.096366817e-03f, 1.706887958e-03f, -1.466524887e-03f, 3.887612306e-04f,
+    3.775851187e-04f, -1.053450538e-03f, 3.757730208e-04f, 3.906103776e-03f, -1.045497077e-02f, 1.104965083e-02f,
+    4.940170091e-03f, -3.728411844e-02f, 6.304276440e-02f, -3.911042153e-02f, -8.820625126e-02f, 5.214636782e-01f,
+    6.225209855e-01f, -1.539686307e-02f, -8.272911554e-02f, 7.200551650e-02f, -2.742074551e-02f, -7.043208318e-03f,
+    1.698646182e-02f, -1.067270866e-02f, 2.056305232e-03f, 1.731317444e-03f, -1.472532782e-03f, 3.880744717e-04f,
+    3.766349029e-04f, -1.045348595e-03f, 3.541681381e-04f, 3.929145649e-03f, -1.043506740e-02f, 1.093614335e-02f,
+    5.128354056e-03f, -3.738863639e-02f, 6.280019692e-02f, -3.834690489e-02f, -8.920344627e-02f, 5.195079488e-01f,
+    6.240179843e-01f, -1.389287147e-02f, -8.344601096e-02f, 7.206212859e-02f, -2.718695667e-02f, -7.262592566e-03f,
+    1.707359972e-02f, -1.065907304e-02f, 2.015976553e-03f, 1.755758602e-03f, -1.478484480e-03f, 3.873531242e-04f,
+    3.756633295e-04f, -1.037230033e-03f, 3.326442370e-04f, 3.951879349e-03f, -1.041466597e-02f, 1.082239656e-02f,
+    5.315739192e-03f, -3.749090862e-02f, 6.255501306e-02f, -3.758377353e-02f, -9.019167341e-02f, 5.175461339e-01f,
+    6.255056508e-01f, -1.238087583e-02f, -8.416088929e-02f, 7.211512374e-02f, -2.695110674e-02f, -7.482202293e-03f,
+    1.716008568e-02f, -1.064481396e-02f, 1.975382074e-03f, 1.780210029e-03f, -1.484379295e-03f, 3.865969963e-04f,
+    3.746706414e-04f, -1.029095478e-03f, 3.112022398e-04f, 3.974304761e-03f, -1.039376926e-02f, 1.070841734e-02f,
+    5.502317720e-03f, -3.759093578e-02f, 6.230723265e-02f, -3.682106444e-02f, -9.117092699e-02f, 5.155782937e-01f,
+    6.269839380e-01f, -1.086090252e-02f, -8.487370844e-02f, 7.216448913e-02f, -2.671320259e-02f, -7.702026402e-03f,
+    1.724591307e-02f, -1.062993016e-02f, 1.934523109e-03f, 1.804670317e-03f, -1.490216536e-03f, 3.858058978e-04f,
+    3.736570819e-04f, -1.020945556e-03f, 2.898430595e-04f, 3.996421786e-03f, -1.037238011e-02f, 1.059421257e-02f,
+    5.688081923e-03f, -3.768871860e-02f, 6.205687559e-02f, -3.605881447e-02f, -9.214120168e-02f, 5.136044884e-01f,
+    6.284527993e-01f, -9.332978251e-03f, -8.558442625e-02f, 7.221021211e-02f, -2.647325122e-02f, -7.922053752e-03f,
+    1.733107530e-02f, -1.061442042e-02f, 1.893400992e-03f, 1.829138050e-03f, -1.495995516e-03f, 3.849796399e-04f,
+    3.726228940e-04f, -1.012780892e-03f, 2.685676003e-04f, 4.018230345e-03f, -1.035050133e-02f, 1.047978912e-02f,
+    5.873024151e-03f, -3.778425794e-02f, 6.180396188e-02f, -3.529706036e-02f, -9.310249249e-02f, 5.116247783e-01f,
+    6.299121885e-01f, -7.797130069e-03f, -8.629300055e-02f, 7.225228015e-02f, -2.623125976e-02f, -8.142273165e-03f,
+    1.741556577e-02f, -1.059828355e-02f, 1.852017077e-03f, 1.853611807e-03f, -1.501715548e-03f, 3.841180357e-04f,
+    3.715683214e-04f, -1.004602106e-03f, 2.473767571e-04f, 4.039730377e-03f, -1.032813577e-02f, 1.036515386e-02f,
+    6.057136818e-03f, -3.787755477e-02f, 6.154851156e-02f, -3.453583872e-02f, -9.405479475e-02f, 5.096392239e-01f,
+    6.313620596e-01f, -6.253385345e-03f, -8.699938914e-02f, 7.229068088e-02f, -2.598723546e-02f, -8.362673419e-03f,
+    1.749937792e-02f, -1.058151837e-02f, 1.810372739e-03f, 1.878090159e-03f, -1.507375945e-03f, 3.832208997e-04f,
+    3.704936074e-04f, -9.964098161e-04f, 2.262714160e-04f, 4.060921840e-03f, -1.030528632e-02f, 1.025031364e-02f,
+    6.240412403e-03f, -3.796861019e-02f, 6.129054479e-02f, -3.377518600e-02f, -9.499810414e-02f, 5.076478860e-01f,
+    6.328023667e-01f, -4.701771781e-03f, -8.770354978e-02f, 7.232540211e-02f, -2.574118571e-02f, -8.583243252e-03f,
+    1.758250519e-02f, -1.056412375e-02f, 1.768469372e-03f, 1.902571672e-03f, -1.512976019e-03f, 3.822880481e-04f,
+    3.693989957e-04f, -9.882046403e-04f, 2.052524535e-04f, 4.081804707e-03f, -1.028195585e-02f, 1.013527529e-02f,
+    6.422843452e-03f, -3.805742538e-02f, 6.103008176e-02f, -3.301513854e-02f, -9.593241668e-02f, 5.056508252e-01f,
+    6.342330645e-01f, -3.142317408e-03f, -8.840544021e-02f, 7.235643176e-02f, -2.549311801e-02f, -8.803971364e-03f,
+    1.766494107e-02f, -1.054609859e-02f, 1.726308392e-03f, 1.927054906e-03f, -1.518515085e-03f, 3.813192987e-04f,
+    3.682847301e-04f, -9.799871922e-04f, 1.843207374e-04f, 4.102378973e-03f, -1.025814726e-02f, 1.002004567e-02f,
+    6.604422575e-03f, -3.814400168e-02f, 6.076714276e-02f, -3.225573254e-02f, -9.685772871e-02f, 5.036481025e-01f,
+    6.356541078e-01f, -1.575050586e-03f, -8.910501814e-02f, 7.238375794e-02f, -2.524303998e-02f, -9.024846414e-03f,
+    1.774667902e-02f, -1.052744182e-02f, 1.683891232e-03f, 1.951538412e-03f, -1.523992457e-03f, 3.803144711e-04f,
+    3.671510543e-04f, -9.717580837e-04f, 1.634771262e-04f, 4.122644650e-03f, -1.023386349e-02f, 9.904631585e-03f,
+    6.785142449e-03f, -3.822834052e-02f, 6.050174816e-02f, -3.149700405e-02f, -9.777403693e-02f, 5.016397790e-01f,
+    6.370654517e-01f, 2.714333592e-17f, -8.980224128e-02f, 7.240736889e-02f, -2.499095939e-02f, -9.245857024e-03f,
+    1.782771257e-02f, -1.050815241e-02f, 1.641219347e-03f, 1.976020739e-03f, -1.529407451e-03f, 3.792733867e-04f,
+    3.659982121e-04f, -9.635179244e-04f, 1.427224693e-04f, 4.142601765e-03f, -1.020910746e-02f, 9.789039861e-03f,
+    6.964995817e-03f, -3.831044344e-02f, 6.023391837e-02f, -3.073898899e-02f, -9.868133835e-02f, 4.996259158e-01f,
+    6.384670517e-01f, 1.582805334e-03f, -9.049706727e-02f, 7.242725301e-02f, -2.473688411e-02f, -9.466991778e-03f,
+    1.790803523e-02f, -1.048822934e-02f, 1.598294213e-03f, 2.000500428e-03f, -1.534759383e-03f, 3.781958683e-04f,
+    3.648264473e-04f, -9.552673213e-04f, 1.220576066e-04f, 4.162250368e-03f, -1.018388214e-02f, 9.673277300e-03f,
+    7.143975489e-03f, -3.839031209e-02f, 5.996367390e-02f, -2.998172314e-02f, -9.957963035e-02f, 4.976065744e-01f,
+    6.398588634e-01f, 3.173336078e-03f, -9.118945379e-02f, 7.244339887e-02f, -2.448082216e-02f, -9.688239220e-03f,
+    1.798764056e-02f, -1.046767165e-02f, 1.555117324e-03f, 2.024976012e-03f, -1.540047569e-03f, 3.770817409e-04f,
+    3.636360038e-04f, -9.470068788e-04f, 1.014833693e-04f, 4.181590522e-03f, -1.015819050e-02f, 9.557350697e-03f,
+    7.322074340e-03f, -3.846794826e-02f, 5.969103530e-02f, -2.922524214e-02f, -1.004689106e-01f, 4.955818161e-01f,
+    6.412408428e-01f, 4.771562563e-03f, -9.187935845e-02f, 7.245579518e-02f, -2.422278166e-02f, -9.909587858e-03f,
+    1.806652211e-02f, -1.044647839e-02f, 1.511690195e-03f, 2.049446023e-03f, -1.545271327e-03f, 3.759308309e-04f,
+    3.624271253e-04f, -9.387371991e-04f, 8.100057907e-05f, 4.200622312e-03f, -1.013203552e-02f, 9.441266836e-03f,
+    7.499285314e-03f, -3.854335383e-02f, 5.941602322e-02f, -2.846958149e-02f, -1.013491771e-01f, 4.935517025e-01f,
+    6.426129464e-01f, 6.377454800e-03f, -9.256673887e-02f, 7.246443083e-02f, -2.396277087e-02f, -1.013102617e-02f,
+    1.814467348e-02f, -1.042464865e-02f, 1.468014361e-03f, 2.073908983e-03f, -1.550429974e-03f, 3.747429668e-04f,
+    3.612000557e-04f, -9.304588817e-04f, 6.061004836e-05f, 4.219345836e-03f, -1.010542022e-02f, 9.325032488e-03f,
+    7.675601419e-03f, -3.861653079e-02f, 5.913865835e-02f, -2.771477653e-02f, -1.022204283e-01f, 4.915162954e-01f,
+    6.439751306e-01f, 7.990982474e-03f, -9.325155265e-02f, 7.246929485e-02f, -2.370079818e-02f, -1.035254258e-02f,
+    1.822208828e-02f, -1.040218156e-02f, 1.424091378e-03f, 2.098363409e-03f, -1.555522832e-03f, 3.735179787e-04f,
+    3.599550386e-04f, -9.221725236e-04f, 4.031258048e-05f, 4.237761214e-03f, -1.007834761e-02f, 9.208654414e-03f,
+    7.851015734e-03f, -3.868748126e-02f, 5.885896146e-02f, -2.696086248e-02f, -1.030826629e-01f, 4.894756566e-01f,
+    6.453273524e-01f, 9.612114945e-03f, -9.393375739e-02f, 7.247037644e-02f, -2.343687208e-02f, -1.057412549e-02f,
+    1.829876014e-02f, -1.037907628e-02f, 1.379922819e-03f, 2.122807813e-03f, -1.560549218e-03f, 3.722556988e-04f,
+    3.586923176e-04f, -9.138787191e-04f, 2.010896944e-05f, 4.255868582e-03f, -1.005082073e-02f, 9.092139362e-03f,
+    8.025521403e-03f, -3.875620745e-02f, 5.857695336e-02f, -2.620787439e-02f, -1.039358798e-01f, 4.874298479e-01f,
+    6.466695689e-01f, 1.124082125e-02f, -9.461331065e-02f, 7.246766496e-02f, -2.317100121e-02f, -1.079576328e-02f,
+    1.837468271e-02f, -1.035533200e-02f, 1.335510281e-03f, 2.147240702e-03f, -1.565508456e-03f, 3.709559609e-04f,
+    3.574121363e-04f, -9.055780600e-04f, 2.414118675e-18f, 4.273668093e-03f, -1.002284263e-02f, 8.975494066e-03f,
+    8.199111638e-03f, -3.882271171e-02f, 5.829265496e-02f, -2.545584718e-02f, -1.047800785e-01f, 4.853789316e-01f,
+    6.480017377e-01f, 1.287707011e-02f, -9.529017001e-02f, 7.246114993e-02f, -2.290319433e-02f, -1.101744427e-02f,
+    1.844984966e-02f, -1.033094794e-02f, 1.290855377e-03f, 2.171660577e-03f, -1.570399867e-03f, 3.696186009e-04f,
+    3.561147381e-04f, -8.972711356e-04f, -2.001355236e-05f, 4.291159917e-03f, -9.994416387e-03f, 8.858725251e-03f,
+    8.371779720e-03f, -3.888699646e-02f, 5.800608719e-02f, -2.470481562e-02f, -1.056152586e-01f, 4.833229698e-01f,
+    6.493238166e-01f, 1.452082991e-02f, -9.596429302e-02f, 7.245082104e-02f, -2.263346032e-02f, -1.123915675e-02f,
+    1.852425470e-02f, -1.030592336e-02f, 1.245959742e-03f, 2.196065932e-03f, -1.575222774e-03f, 3.682434565e-04f,
+    3.548003662e-04f, -8.889585321e-04f, -3.993092144e-05f, 4.308344243e-03f, -9.965545080e-03f, 8.741839627e-03f,
+    8.543518995e-03f, -3.894906426e-02f, 5.771727108e-02f, -2.395481432e-02f, -1.064414202e-01f, 4.812620247e-01f,
+    6.506357637e-01f, 1.617206874e-02f, -9.663563724e-02f, 7.243666813e-02f, -2.236180817e-02f, -1.146088900e-02f,
+    1.859789156e-02f, -1.028025755e-02f, 1.200825032e-03f, 2.220455257e-03f, -1.579976503e-03f, 3.668303676e-04f,
+    3.534692637e-04f, -8.806408335e-04f, -5.975135034e-05f, 4.325221276e-03f, -9.936231807e-03f, 8.624843888e-03f,
+    8.714322881e-03f, -3.900891778e-02f, 5.742622768e-02f, -2.320587774e-02f, -1.072585636e-01f, 4.791961588e-01f,
+    6.519375373e-01f, 1.783075433e-02f, -9.730416023e-02f, 7.241868123e-02f, -2.208824703e-02f, -1.168262924e-02f,
+    1.867075396e-02f, -1.025394983e-02f, 1.155452920e-03f, 2.244827038e-03f, -1.584660378e-03f, 3.653791757e-04f,
+    3.521216736e-04f, -8.723186207e-04f, -7.947409146e-05f, 4.341791238e-03f, -9.906479682e-03f, 8.507744718e-03f,
+    8.884184861e-03f, -3.906655979e-02f, 5.713297813e-02f, -2.245804021e-02f, -1.080666895e-01f, 4.771254346e-01f,
+    6.532290964e-01f, 1.949685414e-02f, -9.796981953e-02f, 7.239685051e-02f, -2.181278613e-02f, -1.190436566e-02f,
+    1.874283569e-02f, -1.022699957e-02f, 1.109845100e-03f, 2.269179752e-03f, -1.589273727e-03f, 3.638897245e-04f,
+    3.507578386e-04f, -8.639924720e-04f, -9.909840653e-05f, 4.358054370e-03f, -9.876291834e-03f, 8.390548786e-03f,
+    9.053098489e-03f, -3.912199317e-02f, 5.683754361e-02f, -2.171133587e-02f, -1.088657989e-01f, 4.750499147e-01f,
+    6.545103998e-01f, 2.117033528e-02f, -9.863257269e-02f, 7.237116632e-02f, -2.153543486e-02f, -1.212608644e-02f,
+    1.881413054e-02f, -1.019940615e-02f, 1.064003287e-03f, 2.293511874e-03f, -1.593815878e-03f, 3.623618598e-04f,
+    3.493780012e-04f, -8.556629629e-04f, -1.186235666e-04f, 4.374010928e-03f, -9.845671403e-03f, 8.273262745e-03f,
+    9.221057387e-03f, -3.917522091e-02f, 5.653994536e-02f, -2.096579874e-02f, -1.096558932e-01f, 4.729696618e-01f,
+    6.557814069e-01f, 2.285116454e-02f, -9.929237726e-02f, 7.234161918e-02f, -2.125620272e-02f, -1.234777972e-02f,
+    1.888463234e-02f, -1.017116901e-02f, 1.017929215e-03f, 2.317821873e-03f, -1.598286161e-03f, 3.607954293e-04f,
+    3.479824038e-04f, -8.473306662e-04f, -1.380488520e-04f, 4.389661185e-03f, -9.814621548e-03f, 8.155893234e-03f,
+    9.388055245e-03f, -3.922624611e-02f, 5.624020467e-02f, -2.022146266e-02f, -1.104369741e-01f, 4.708847387e-01f,
+    6.570420774e-01f, 2.453930841e-02f, -9.994919080e-02f, 7.230819978e-02f, -2.097509933e-02f, -1.256943359e-02f,
+    1.895433492e-02f, -1.014228761e-02f, 9.716246359e-04f, 2.342108213e-03f, -1.602683908e-03f, 3.591902827e-04f,
+    3.465712882e-04f, -8.389961517e-04f, -1.573735524e-04f, 4.405005433e-03f, -9.783145437e-03f, 8.038446878e-03f,
+    9.554085823e-03f, -3.927507197e-02f, 5.593834288e-02f, -1.947836132e-02f, -1.112090435e-01f, 4.687952085e-01f,
+    6.582923713e-01f, 2.623473306e-02f, -1.006029709e-01f, 7.227089896e-02f, -2.069213444e-02f, -1.279103613e-02f,
+    1.902323216e-02f, -1.011276143e-02f, 9.250913238e-04f, 2.366369352e-03f, -1.607008449e-03f, 3.575462719e-04f,
+    3.451448964e-04f, -8.306599865e-04f, -1.765969669e-04f, 4.420043979e-03f, -9.751246254e-03f, 7.920930285e-03f,
+    9.719142948e-03f, -3.932170180e-02f, 5.563438139e-02f, -1.873652827e-02f, -1.119721038e-01f, 4.667011340e-01f,
+    6.595322489e-01f, 2.793740434e-02f, -1.012536750e-01f, 7.222970777e-02f, -2.040731791e-02f, -1.301257538e-02f,
+    1.909131795e-02f, -1.008259001e-02f, 8.783310715e-04f, 2.390603744e-03f, -1.611259121e-03f, 3.558632510e-04f,
+    3.437034698e-04f, -8.223227346e-04f, -1.957184039e-04f, 4.434777146e-03f, -9.718927197e-03f, 7.803350048e-03f,
+    9.883220520e-03f, -3.936613904e-02f, 5.532834165e-02f, -1.799599689e-02f, -1.127261577e-01f, 4.646025784e-01f,
+    6.607616708e-01f, 2.964728778e-02f, -1.019012608e-01f, 7.218461738e-02f, -2.012065974e-02f, -1.323403937e-02f,
+    1.915858623e-02f, -1.005177292e-02f, 8.313456912e-04f, 2.414809840e-03f, -1.615435258e-03f, 3.541410760e-04f,
+    3.422472496e-04f, -8.139849572e-04f, -2.147371810e-04f, 4.449205277e-03f, -9.686191476e-03f, 7.685712745e-03f,
+    1.004631251e-02f, -3.940838720e-02f, 5.502024515e-02f, -1.725680037e-02f, -1.134712081e-01f, 4.624996049e-01f,
+    6.619805980e-01f, 3.136434862e-02f, -1.025456859e-01f, 7.213561918e-02f, -1.983217005e-02f, -1.345541607e-02f,
+    1.922503094e-02f, -1.002030976e-02f, 7.841370148e-04f, 2.438986082e-03f, -1.619536197e-03f, 3.523796053e-04f,
+    3.407764766e-04f, -8.056472128e-04f, -2.336526255e-04f, 4.463328728e-03f, -9.653042313e-03f, 7.568024935e-03f,
+    1.020841294e-02f, -3.944844991e-02f, 5.471011343e-02f, -1.651897179e-02f, -1.142072583e-01f, 4.603922768e-01f,
+    6.631889916e-01f, 3.308855177e-02f, -1.031869079e-01f, 7.208270471e-02f, -1.954185907e-02f, -1.367669345e-02f,
+    1.929064607e-02f, -9.988200154e-03f, 7.367068940e-04f, 2.463130911e-03f, -1.623561278e-03f, 3.505786992e-04f,
+    3.392913914e-04f, -7.973100565e-04f, -2.524640737e-04f, 4.477147873e-03f, -9.619482945e-03f, 7.450293162e-03f,
+    1.036951593e-02f, -3.948633092e-02f, 5.439796809e-02f, -1.578254404e-02f, -1.149343121e-01f, 4.582806575e-01f,
+    6.643868134e-01f, 3.481986183e-02f, -1.038248843e-01f, 7.202586568e-02f, -1.924973716e-02f, -1.389785944e-02f,
+    1.935542561e-02f, -9.955443779e-03f, 6.890571997e-04f, 2.487242762e-03f, -1.627509841e-03f, 3.487382204e-04f,
+    3.377922340e-04f, -7.889740408e-04f, -2.711708715e-04f, 4.490663102e-03f, -9.585516620e-03f, 7.332523953e-03f,
+    1.052961566e-02f, -3.952203406e-02f, 5.408383076e-02f, -1.504754984e-02f, -1.156523733e-01f, 4.561648104e-01f,
+    6.655740251e-01f, 3.655824309e-02f, -1.044595728e-01f, 7.196509399e-02f, -1.895581481e-02f, -1.411890195e-02f,
+    1.941936361e-02f, -9.922040338e-03f, 6.411898222e-04f, 2.511320066e-03f, -1.631381229e-03f, 3.468580338e-04f,
+    3.362792444e-04f, -7.806397149e-04f, -2.897723741e-04f, 4.503874822e-03f, -9.551146599e-03f, 7.214723819e-03f,
+    1.068870637e-02f, -3.955556329e-02f, 5.376772313e-02f, -1.431402177e-02f, -1.163614462e-01f, 4.540447991e-01f,
+    6.667505890e-01f, 3.830365953e-02f, -1.050909310e-01f, 7.190038170e-02f, -1.866010261e-02f, -1.433980886e-02f,
+    1.948245414e-02f, -9.887989572e-03f, 5.931066714e-04f, 2.535361249e-03f, -1.635174786e-03f, 3.449380065e-04f,
+    3.347526617e-04f, -7.723076253e-04f, -3.082679459e-04f, 4.516783457e-03f, -9.516376154e-03f, 7.096899249e-03f,
+    1.084678237e-02f, -3.958692265e-02f, 5.344966690e-02f, -1.358199222e-02f, -1.170615355e-01f, 4.519206872e-01f,
+    6.679164678e-01f, 4.005607484e-02f, -1.057189167e-01f, 7.183172107e-02f, -1.836261130e-02f, -1.456056802e-02f,
+    1.954469128e-02f, -9.853291257e-03f, 5.448096766e-04f, 2.559364732e-03f, -1.638889857e-03f, 3.429780078e-04f,
+    3.332127251e-04f, -7.639783151e-04f, -3.266569609e-04f, 4.529389444e-03f, -9.481208570e-03f, 6.979056719e-03f,
+    1.100383806e-02f, -3.961611630e-02f, 5.312968386e-02f, -1.285149343e-02f, -1.177526460e-01f, 4.497925383e-01f,
+    6.690716242e-01f, 4.181545236e-02f, -1.063434874e-01f, 7.175910451e-02f, -1.806335172e-02f, -1.478116725e-02f,
+    1.960606916e-02f, -9.817945204e-03f, 4.963007861e-04f, 2.583328934e-03f, -1.642525793e-03f, 3.409779094e-04f,
+    3.316596731e-04f, -7.556523245e-04f, -3.449388025e-04f, 4.541693240e-03f, -9.445647143e-03f, 6.861202684e-03f,
+    1.115986789e-02f, -3.964314851e-02f, 5.280779581e-02f, -1.212255747e-02f, -1.184347831e-01f, 4.476604164e-01f,
+    6.702160216e-01f, 4.358175518e-02f, -1.069646010e-01f, 7.168252463e-02f, -1.776233484e-02f, -1.500159437e-02f,
+    1.966658193e-02f, -9.781951260e-03f, 4.475819678e-04f, 2.607252267e-03f, -1.646081941e-03f, 3.389375853e-04f,
+    3.300937437e-04f, -7.473301906e-04f, -3.631128631e-04f, 4.553695315e-03f, -9.409695179e-03f, 6.743343581e-03f,
+    1.131486639e-02f, -3.966802361e-02f, 5.248402458e-02f, -1.139521623e-02f, -1.191079523e-01f, 4.455243851e-01f,
+    6.713496234e-01f, 4.535494604e-02f, -1.075822152e-01f, 7.160197420e-02f, -1.745957174e-02f, -1.522183716e-02f,
+    1.972622379e-02f, -9.745309308e-03f, 3.986552086e-04f, 2.631133142e-03f, -1.649557655e-03f, 3.368569118e-04f,
+    3.285151746e-04f, -7.390124475e-04f, -3.811785449e-04f, 4.565396157e-03f, -9.373355999e-03f, 6.625485828e-03f,
+    1.146882815e-02f, -3.969074610e-02f, 5.215839207e-02f, -1.066950144e-02f, -1.197721595e-01f, 4.433845085e-01f,
+    6.724723935e-01f, 4.713498739e-02f, -1.081962876e-01f, 7.151744619e-02f, -1.715507363e-02f, -1.544188337e-02f,
+    1.978498893e-02f, -9.708019268e-03f, 3.495225146e-04f, 2.654969963e-03f, -1.652952289e-03f, 3.347357674e-04f,
+    3.269242029e-04f, -7.306996258e-04f, -3.991352593e-04f, 4.576796267e-03f, -9.336632930e-03f, 6.507635824e-03f,
+    1.162174785e-02f, -3.971132051e-02f, 5.183092019e-02f, -9.945444668e-03f, -1.204274109e-01f, 4.412408505e-01f,
+    6.735842963e-01f, 4.892184138e-02f, -1.088067762e-01f, 7.142893374e-02f, -1.684885186e-02f, -1.566172073e-02f,
+    1.984287161e-02f, -9.670081093e-03f, 3.001859112e-04f, 2.678761132e-03f, -1.656265199e-03f, 3.325740334e-04f,
+    3.253210653e-04f, -7.223922533e-04f, -4.169824269e-04f, 4.587896166e-03f, -9.299529314e-03f, 6.389799949e-03f,
+    1.177362022e-02f, -3.972975153e-02f, 5.150163090e-02f, -9.223077294e-03f, -1.210737130e-01f, 4.390934752e-01f,
+    6.746852962e-01f, 5.071546986e-02f, -1.094136387e-01f, 7.133643018e-02f, -1.654091785e-02f, -1.588133697e-02f,
+    1.989986611e-02f, -9.631494776e-03f, 2.506474425e-04f, 2.702505046e-03f, -1.659495744e-03f, 3.303715930e-04f,
+    3.237059979e-04f, -7.140908544e-04f, -4.347194779e-04f, 4.598696387e-03f, -9.262048500e-03f, 6.271984562e-03f,
+    1.192444008e-02f, -3.974604392e-02f, 5.117054620e-02f, -8.502430536e-03f, -1.217110727e-01f, 4.369424466e-01f,
+    6.757753581e-01f, 5.251583437e-02f, -1.100168330e-01f, 7.123992900e-02f, -1.623128319e-02f, -1.610071978e-02f,
+    1.995596673e-02f, -9.592260343e-03f, 2.009091721e-04f, 2.726200099e-03f, -1.662643284e-03f, 3.281283321e-04f,
+    3.220792363e-04f, -7.057959503e-04f, -4.523458517e-04f, 4.609197480e-03f, -9.224193849e-03f, 6.154196003e-03f,
+    1.207420231e-02f, -3.976020254e-02f, 5.083768810e-02f, -7.783535434e-03f, -1.223394972e-01f, 4.347878291e-01f,
+    6.768544472e-01f, 5.432289615e-02f, -1.106163170e-01f, 7.113942390e-02f, -1.591995955e-02f, -1.631985681e-02f,
+    2.001116782e-02f, -9.552377859e-03f, 1.509731820e-04f, 2.749844682e-03f, -1.665707183e-03f, 3.258441391e-04f,
+    3.204410156e-04f, -6.975080592e-04f, -4.698609973e-04f, 4.619400010e-03f, -9.185968732e-03f, 6.036440592e-03f,
+    1.222290186e-02f, -3.977223236e-02f, 5.050307866e-02f, -7.066422855e-03f, -1.229589940e-01f, 4.326296867e-01f,
+    6.779225292e-01f, 5.613661615e-02f, -1.112120486e-01f, 7.103490874e-02f, -1.560695876e-02f, -1.653873574e-02f,
+    2.006546376e-02f, -9.511847424e-03f, 1.008415735e-04f, 2.773437180e-03f, -1.668686806e-03f, 3.235189046e-04f,
+    3.187915703e-04f, -6.892276958e-04f, -4.872643726e-04f, 4.629304558e-03f, -9.147376530e-03f, 5.918724628e-03f,
+    1.237053375e-02f, -3.978213845e-02f, 5.016673998e-02f, -6.351123491e-03f, -1.235695707e-01f, 4.304680837e-01f,
+    6.789795700e-01f, 5.795695501e-02f, -1.118039859e-01f, 7.092637760e-02f, -1.529229273e-02f, -1.675734418e-02f,
+    2.011884895e-02f, -9.470669175e-03f, 5.051646657e-05f, 2.796975976e-03f, -1.671581521e-03f, 3.211525219e-04f,
+    3.171311342e-04f, -6.809553715e-04f, -5.045554454e-04f, 4.638911719e-03f, -9.108420632e-03f, 5.801054387e-03f,
+    1.251709307e-02f, -3.978992597e-02f, 4.982869417e-02f, -5.637667857e-03f, -1.241712356e-01f, 4.283030846e-01f,
+    6.800255358e-01f, 5.978387309e-02f, -1.123920867e-01f, 7.081382471e-02f, -1.497597350e-02f, -1.697566976e-02f,
+    2.017131783e-02f, -9.428843286e-03f, -5.220347540e-18f, 2.820459451e-03f, -1.674390699e-03f, 3.187448867e-04f,
+    3.154599407e-04f, -6.726915947e-04f, -5.217336924e-04f, 4.648222106e-03f, -9.069104438e-03f, 5.683436127e-03f,
+    1.266257500e-02f, -3.979560017e-02f, 4.948896337e-02f, -4.926086292e-03f, -1.247639971e-01f, 4.261347537e-01f,
+    6.810603932e-01f, 6.161733044e-02f, -1.129763092e-01f, 7.069724450e-02f, -1.465801325e-02f, -1.719370006e-02f,
+    2.022286489e-02f, -9.386369967e-03f, -5.070566873e-05f, 2.843885980e-03f, -1.677113712e-03f, 3.162958973e-04f,
+    3.137782225e-04f, -6.644368702e-04f, -5.387985998e-04f, 4.657236343e-03f, -9.029431357e-03f, 5.565876083e-03f,
+    1.280697477e-02f, -3.979916643e-02f, 4.914756976e-02f, -4.216408956e-03f, -1.253478639e-01f, 4.239631554e-01f,
+    6.820841093e-01f, 6.345728682e-02f, -1.135566114e-01f, 7.057663158e-02f, -1.433842425e-02f, -1.741142266e-02f,
+    2.027348463e-02f, -9.343249465e-03f, -1.015983635e-04f, 2.867253937e-03f, -1.679749936e-03f, 3.138054546e-04f,
+    3.120862117e-04f, -6.561916996e-04f, -5.557496631e-04f, 4.665955074e-03f, -8.989404805e-03f, 5.448380467e-03f,
+    1.295028769e-02f, -3.980063019e-02f, 4.880453555e-02f, -3.508665828e-03f, -1.259228451e-01f, 4.217883542e-01f,
+    6.830966512e-01f, 6.530370169e-02f, -1.141329515e-01f, 7.045198077e-02f, -1.401721889e-02f, -1.762882512e-02f,
+    2.032317159e-02f, -9.299482066e-03f, -1.526758895e-04f, 2.890561690e-03f, -1.682298749e-03f, 3.112734618e-04f,
+    3.103841397e-04f, -6.479565812e-04f, -5.725863873e-04f, 4.674378952e-03f, -8.949028209e-03f, 5.330955471e-03f,
+    1.309250914e-02f, -3.979999701e-02f, 4.845988295e-02f, -2.802886710e-03f, -1.264889500e-01f, 4.196104147e-01f,
+    6.840979866e-01f, 6.715653423e-02f, -1.147052877e-01f, 7.032328706e-02f, -1.369440970e-02f, -1.784589498e-02f,
+    2.037192036e-02f, -9.255068092e-03f, -2.039360335e-04f, 2.913807607e-03f, -1.684759531e-03f, 3.086998251e-04f,
+    3.086722373e-04f, -6.397320098e-04f, -5.893082864e-04f, 4.682508651e-03f, -8.908305002e-03f, 5.213607265e-03f,
+    1.323363457e-02f, -3.979727254e-02f, 4.811363422e-02f, -2.099101222e-03f, -1.270461883e-01f, 4.174294014e-01f,
+    6.850880835e-01f, 6.901574333e-02f, -1.152735782e-01f, 7.019054563e-02f, -1.337000931e-02f, -1.806261978e-02f,
+    2.041972556e-02f, -9.210007900e-03f, -2.553765638e-04f, 2.936990051e-03f, -1.687131667e-03f, 3.060844529e-04f,
+    3.069507345e-04f, -6.315184770e-04f, -6.059148839e-04f, 4.690344854e-03f, -8.867238628e-03f, 5.096341993e-03f,
+    1.337365950e-02f, -3.979246252e-02f, 4.776581163e-02f, -1.397338801e-03f, -1.275945700e-01f, 4.152453789e-01f,
+    6.860669104e-01f, 7.088128756e-02f, -1.158377814e-01f, 7.005375185e-02f, -1.304403046e-02f, -1.827898702e-02f,
+    2.046658184e-02f, -9.164301887e-03f, -3.069952303e-04f, 2.960107384e-03f, -1.689414542e-03f, 3.034272564e-04f,
+    3.052198608e-04f, -6.233164707e-04f, -6.224057126e-04f, 4.697888263e-03f, -8.825832538e-03f, 4.979165779e-03f,
+    1.351257954e-02f, -3.978557279e-02f, 4.741643747e-02f, -6.976287033e-04f, -1.281341054e-01f, 4.130584119e-01f,
+    6.870344358e-01f, 7.275312525e-02f, -1.163978554e-01f, 6.991290128e-02f, -1.271648602e-02f, -1.849498419e-02f,
+    2.051248388e-02f, -9.117950488e-03f, -3.587897644e-04f, 2.983157963e-03f, -1.691607546e-03f, 3.007281497e-04f,
+    3.034798449e-04f, -6.151264758e-04f, -6.387803145e-04f, 4.705139593e-03f, -8.784090188e-03f, 4.862084723e-03f,
+    1.365039034e-02f, -3.977660929e-02f, 4.706553406e-02f, -2.394967054e-17f, -1.286648051e-01f, 4.108685650e-01f,
+    6.879906288e-01f, 7.463121440e-02f, -1.169537589e-01f, 6.976798969e-02f, -1.238738896e-02f, -1.871059880e-02f,
+    2.055742641e-02f, -9.070954172e-03f, -4.107578797e-04f, 3.006140143e-03f, -1.693710071e-03f, 2.979870491e-04f,
+    3.017309148e-04f, -6.069489735e-04f, -6.550382410e-04f, 4.712099573e-03f, -8.742015046e-03f, 4.745104902e-03f,
+    1.378708764e-02f, -3.976557803e-02f, 4.671312373e-02f, 6.955184214e-04f, -1.291866799e-01f, 4.086759030e-01f,
+    6.889354589e-01f, 7.651551275e-02f, -1.175054501e-01f, 6.961901301e-02f, -1.205675239e-02f, -1.892581830e-02f,
+    2.060140420e-02f, -9.023313450e-03f, -4.628972710e-04f, 3.029052277e-03f, -1.695721512e-03f, 2.952038741e-04f,
+    2.999732977e-04f, -5.987844414e-04f, -6.711790526e-04f, 4.718768946e-03f, -8.699610584e-03f, 4.628232369e-03f,
+    1.392266726e-02f, -3.975248514e-02f, 4.635922884e-02f, 1.388897859e-03f, -1.296997411e-01f, 4.064804906e-01f,
+    6.898688957e-01f, 7.840597774e-02f, -1.180528876e-01f, 6.946596739e-02f, -1.172458952e-02f, -1.914063014e-02f,
+    2.064441205e-02f, -8.975028867e-03f, -5.152056156e-04f, 3.051892715e-03f, -1.697641266e-03f, 2.923785464e-04f,
+    2.982072200e-04f, -5.906333540e-04f, -6.872023192e-04f, 4.725148471e-03f, -8.656880283e-03f, 4.511473152e-03f,
+    1.405712507e-02f, -3.973733684e-02f, 4.600387175e-02f, 2.080109797e-03f, -1.302040002e-01f, 4.042823926e-01f,
+    6.907909095e-01f, 8.030256653e-02f, -1.185960301e-01f, 6.930884917e-02f, -1.139091366e-02f, -1.935502179e-02f,
+    2.068644480e-02f, -8.926101007e-03f, -5.676805723e-04f, 3.074659806e-03f, -1.699468735e-03f, 2.895109909e-04f,
+    2.964329077e-04f, -5.824961820e-04f, -7.031076199e-04f, 4.731238920e-03f, -8.613827629e-03f, 4.394833257e-03f,
+    1.419045704e-02f, -3.972013942e-02f, 4.564707485e-02f, 2.769125907e-03f, -1.306994691e-01f, 4.020816737e-01f,
+    6.917014707e-01f, 8.220523600e-02f, -1.191348360e-01f, 6.914765487e-02f, -1.105573826e-02f, -1.956898067e-02f,
+    2.072749732e-02f, -8.876530494e-03f, -6.203197821e-04f, 3.097351893e-03f, -1.701203323e-03f, 2.866011350e-04f,
+    2.946505855e-04f, -5.743733929e-04f, -7.188945430e-04f, 4.737041078e-03f, -8.570456116e-03f, 4.278318662e-03f,
+    1.432265917e-02f, -3.970089929e-02f, 4.528886054e-02f, 3.455918047e-03f, -1.311861598e-01f, 3.998783987e-01f,
+    6.926005501e-01f, 8.411394275e-02f, -1.196692642e-01f, 6.898238121e-02f, -1.071907686e-02f, -1.978249420e-02f,
+    2.076756453e-02f, -8.826317986e-03f, -6.731208682e-04f, 3.119967320e-03f, -1.702844437e-03f, 2.836489088e-04f,
+    2.928604776e-04f, -5.662654504e-04f, -7.345626861e-04f, 4.742555746e-03f, -8.526769245e-03f, 4.161935324e-03f,
+    1.445372759e-02f, -3.967962293e-02f, 4.492925123e-02f, 4.140458264e-03f, -1.316640847e-01f, 3.976726326e-01f,
+    6.934881190e-01f, 8.602864309e-02f, -1.201992734e-01f, 6.881302511e-02f, -1.038094315e-02f, -1.999554980e-02f,
+    2.080664138e-02f, -8.775464182e-03f, -7.260814360e-04f, 3.142504429e-03f, -1.704391488e-03f, 2.806542455e-04f,
+    2.910628074e-04f, -5.581728147e-04f, -7.501116559e-04f, 4.747783738e-03f, -8.482770521e-03f, 4.045689172e-03f,
+    1.458365844e-02f, -3.965631691e-02f, 4.456826935e-02f, 4.822718797e-03f, -1.321332567e-01f, 3.954644401e-01f,
+    6.943641489e-01f, 8.794929307e-02f, -1.207248225e-01f, 6.863958369e-02f, -1.004135088e-02f, -2.020813487e-02f,
+    2.084472288e-02f, -8.723969819e-03f, -7.791990729e-04f, 3.164961558e-03f, -1.705843890e-03f, 2.776170809e-04f,
+    2.892577975e-04f, -5.500959427e-04f, -7.655410683e-04f, 4.752725882e-03f, -8.438463457e-03f, 3.929586112e-03f,
+    1.471244797e-02f, -3.963098791e-02f, 4.420593732e-02f, 5.502672072e-03f, -1.325936886e-01f, 3.932538861e-01f,
+    6.952286116e-01f, 8.987584845e-02f, -1.212458702e-01f, 6.846205426e-02f, -9.700313965e-03f, -2.042023680e-02f,
+    2.088180405e-02f, -8.671835670e-03f, -8.324713491e-04f, 3.187337043e-03f, -1.707201059e-03f, 2.745373537e-04f,
+    2.874456695e-04f, -5.420352875e-04f, -7.808505484e-04f, 4.757383019e-03f, -8.393851571e-03f, 3.813632022e-03f,
+    1.484009250e-02f, -3.960364268e-02f, 4.384227760e-02f, 6.180290706e-03f, -1.330453939e-01f, 3.910410355e-01f,
+    6.960814796e-01f, 9.180826471e-02f, -1.217623758e-01f, 6.828043433e-02f, -9.357846395e-03f, -2.063184299e-02f,
+    2.091787997e-02f, -8.619062548e-03f, -8.858958167e-04f, 3.209629219e-03f, -1.708462417e-03f, 2.714150054e-04f,
+    2.856266442e-04f, -5.339912987e-04f, -7.960397306e-04f, 4.761756003e-03f, -8.348938386e-03f, 3.697832757e-03f,
+    1.496658841e-02f, -3.957428807e-02f, 4.347731265e-02f, 6.855547511e-03f, -1.334883861e-01f, 3.888259532e-01f,
+    6.969227255e-01f, 9.374649707e-02f, -1.222742981e-01f, 6.809472161e-02f, -9.013962289e-03f, -2.084294081e-02f,
+    2.095294576e-02f, -8.565651304e-03f, -9.394700108e-04f, 3.231836421e-03f, -1.709627387e-03f, 2.682499804e-04f,
+    2.838009417e-04f, -5.259644223e-04f, -8.111082583e-04f, 4.765845704e-03f, -8.303727432e-03f, 3.582194143e-03f,
+    1.509193216e-02f, -3.954293101e-02f, 4.311106492e-02f, 7.528415488e-03f, -1.339226792e-01f, 3.866087040e-01f,
+    6.977523222e-01f, 9.569050046e-02f, -1.227815963e-01f, 6.790491399e-02f, -8.668675872e-03f, -2.105351764e-02f,
+    2.098699657e-02f, -8.511602827e-03f, -9.931914489e-04f, 3.253956979e-03f, -1.710695397e-03f, 2.650422261e-04f,
+    2.819687810e-04f, -5.179551006e-04f, -8.260557841e-04f, 4.769653004e-03f, -8.258222241e-03f, 3.466721983e-03f,
+    1.521612028e-02f, -3.950957851e-02f, 4.274355689e-02f, 8.198867832e-03f, -1.343482874e-01f, 3.843893529e-01f,
+    6.985702431e-01f, 9.764022955e-02f, -1.232842296e-01f, 6.771100960e-02f, -8.322001481e-03f, -2.126356084e-02f,
+    2.102002761e-02f, -8.456918045e-03f, -1.047057631e-03f, 3.275989222e-03f, -1.711665877e-03f, 2.617916927e-04f,
+    2.801303803e-04f, -5.099637726e-04f, -8.408819695e-04f, 4.773178796e-03f, -8.212426354e-03f, 3.351422050e-03f,
+    1.533914936e-02f, -3.947423769e-02f, 4.237481102e-02f, 8.866877934e-03f, -1.347652252e-01f, 3.821679648e-01f,
+    6.993764621e-01f, 9.959563873e-02f, -1.237821573e-01f, 6.751300673e-02f, -7.973953563e-03f, -2.147305777e-02f,
+    2.105203412e-02f, -8.401597925e-03f, -1.101066040e-03f, 3.297931481e-03f, -1.712538263e-03f, 2.584983333e-04f,
+    2.782859570e-04f, -5.019908733e-04f, -8.555864855e-04f, 4.776423990e-03f, -8.166343313e-03f, 3.236300093e-03f,
+    1.546101608e-02f, -3.943691575e-02f, 4.200484980e-02f, 9.532419377e-03f, -1.351735073e-01f, 3.799446045e-01f,
+    7.001709533e-01f, 1.015566821e-01f, -1.242753388e-01f, 6.731090389e-02f, -7.624546674e-03f, -2.168199578e-02f,
+    2.108301137e-02f, -8.345643471e-03f, -1.155214143e-03f, 3.319782081e-03f, -1.713311993e-03f, 2.551621040e-04f,
+    2.764357274e-04f, -4.940368342e-04f, -8.701690118e-04f, 4.779389506e-03f, -8.119976666e-03f, 3.121361831e-03f,
+    1.558171718e-02f, -3.939761995e-02f, 4.163369570e-02f, 1.019546594e-02f, -1.355731490e-01f, 3.777193370e-01f,
+    7.009536910e-01f, 1.035233136e-01f, -1.247637335e-01f, 6.710469979e-02f, -7.273795482e-03f, -2.189036224e-02f,
+    2.111295470e-02f, -8.289055727e-03f, -1.209499387e-03f, 3.341539347e-03f, -1.713986508e-03f, 2.517829640e-04f,
+    2.745799070e-04f, -4.861020832e-04f, -8.846292374e-04f, 4.782076279e-03f, -8.073329965e-03f, 3.006612959e-03f,
+    1.570124949e-02f, -3.935635766e-02f, 4.126137122e-02f, 1.085599160e-02f, -1.359641654e-01f, 3.754922271e-01f,
+    7.017246502e-01f, 1.054954868e-01f, -1.252473010e-01f, 6.689439334e-02f, -6.921714760e-03f, -2.209814448e-02f,
+    2.114185947e-02f, -8.231835775e-03f, -1.263919205e-03f, 3.363201606e-03f, -1.714561255e-03f, 2.483608754e-04f,
+    2.727187103e-04f, -4.781870445e-04f, -8.989668603e-04f, 4.784485255e-03f, -8.026406767e-03f, 2.892059143e-03f,
+    1.581960988e-02f, -3.931313634e-02f, 4.088789883e-02f, 1.151397054e-02f, -1.363465724e-01f, 3.732633398e-01f,
+    7.024838062e-01f, 1.074731549e-01f, -1.257260009e-01f, 6.667998365e-02f, -6.568319391e-03f, -2.230532986e-02f,
+    2.116972109e-02f, -8.173984735e-03f, -1.318471011e-03f, 3.384767179e-03f, -1.715035682e-03f, 2.448958031e-04f,
+    2.708523509e-04f, -4.702921385e-04f, -9.131815874e-04f, 4.786617395e-03f, -7.979210630e-03f, 2.777706020e-03f,
+    1.593679532e-02f, -3.926796351e-02f, 4.051330102e-02f, 1.216937711e-02f, -1.367203859e-01f, 3.710327399e-01f,
+    7.032311345e-01f, 1.094562711e-01f, -1.261997928e-01f, 6.646147003e-02f, -6.213624368e-03f, -2.251190571e-02f,
+    2.119653503e-02f, -8.115503769e-03f, -1.373152204e-03f, 3.406234390e-03f, -1.715409244e-03f, 2.413877155e-04f,
+    2.689810414e-04f, -4.624177822e-04f, -9.272731347e-04f, 4.788473671e-03f, -7.931745119e-03f, 2.663559200e-03f,
+    1.605280285e-02f, -3.922084679e-02f, 4.013760027e-02f, 1.282218589e-02f, -1.370856221e-01f, 3.688004923e-01f,
+    7.039666111e-01f, 1.114447882e-01f, -1.266686367e-01f, 6.623885201e-02f, -5.857644788e-03f, -2.271785938e-02f,
+    2.122229678e-02f, -8.056394074e-03f, -1.427960165e-03f, 3.427601559e-03f, -1.715681397e-03f, 2.378365835e-04f,
+    2.671049933e-04f, -4.545643885e-04f, -9.412412272e-04f, 4.790055068e-03f, -7.884013801e-03f, 2.549624267e-03f,
+    1.616762955e-02f, -3.917179388e-02f, 3.976081906e-02f, 1.347237165e-02f, -1.374422976e-01f, 3.665666619e-01f,
+    7.046902124e-01f, 1.134386587e-01f, -1.271324923e-01f, 6.601212931e-02f, -5.500395856e-03f, -2.292317821e-02f,
+    2.124700189e-02f, -7.996656888e-03f, -1.482892259e-03f, 3.448867007e-03f, -1.715851603e-03f, 2.342423815e-04f,
+    2.652244173e-04f, -4.467323670e-04f, -9.550855989e-04f, 4.791362583e-03f, -7.836020244e-03f, 2.435906773e-03f,
+    1.628127262e-02f, -3.912081256e-02f, 3.938297987e-02f, 1.411990935e-02f, -1.377904292e-01f, 3.643313134e-01f,
+    7.054019151e-01f, 1.154378348e-01f, -1.275913198e-01f, 6.578130184e-02f, -5.141892884e-03f, -2.312784954e-02f,
+    2.127064594e-02f, -7.936293489e-03f, -1.537945836e-03f, 3.470029055e-03f, -1.715919327e-03f, 2.306050868e-04f,
+    2.633395230e-04f, -4.389221232e-04f, -9.688059927e-04f, 4.792397226e-03f, -7.787768022e-03f, 2.322412242e-03f,
+    1.639372929e-02f, -3.906791068e-02f, 3.900410516e-02f, 1.476477416e-02f, -1.381300340e-01f, 3.620945117e-01f,
+    7.061016963e-01f, 1.174422687e-01f, -1.280450791e-01f, 6.554636976e-02f, -4.782151289e-03f, -2.333186071e-02f,
+    2.129322457e-02f, -7.875305190e-03f, -1.593118226e-03f, 3.491086021e-03f, -1.715884039e-03f, 2.269246798e-04f,
+    2.614505190e-04f, -4.311340591e-04f, -9.824021604e-04f, 4.793160018e-03f, -7.739260711e-03f, 2.209146172e-03f,
+    1.650499688e-02f, -3.901309620e-02f, 3.862421739e-02f, 1.540694145e-02f, -1.384611294e-01f, 3.598563217e-01f,
+    7.067895335e-01f, 1.194519121e-01f, -1.284937305e-01f, 6.530733339e-02f, -4.421186594e-03f, -2.353519906e-02f,
+    2.131473347e-02f, -7.813693348e-03f, -1.648406745e-03f, 3.512036225e-03f, -1.715745212e-03f, 2.232011441e-04f,
+    2.595576128e-04f, -4.233685729e-04f, -9.958738626e-04f, 4.793651994e-03f, -7.690501888e-03f, 2.096114028e-03f,
+    1.661507280e-02f, -3.895637713e-02f, 3.824333904e-02f, 1.604638679e-02f, -1.387837330e-01f, 3.576168080e-01f,
+    7.074654046e-01f, 1.214667164e-01f, -1.289372342e-01f, 6.506419328e-02f, -4.059014427e-03f, -2.373785194e-02f,
+    2.133516836e-02f, -7.751459355e-03f, -1.703808694e-03f, 3.532877984e-03f, -1.715502323e-03f, 2.194344663e-04f,
+    2.576610110e-04f, -4.156260591e-04f, -1.009220869e-03f, 4.793874200e-03f, -7.641495133e-03f, 1.983321249e-03f,
+    1.672395448e-02f, -3.889776158e-02f, 3.786149254e-02f, 1.668308594e-02f, -1.390978628e-01f, 3.553760354e-01f,
+    7.081292879e-01f, 1.234866330e-01f, -1.293755506e-01f, 6.481695018e-02f, -3.695650518e-03f, -2.393980669e-02f,
+    2.135452501e-02f, -7.688604646e-03f, -1.759321356e-03f, 3.553609617e-03f, -1.715154856e-03f, 2.156246362e-04f,
+    2.557609191e-04f, -4.079069083e-04f, -1.022442958e-03f, 4.793827693e-03f, -7.592244028e-03f, 1.870773242e-03f,
+    1.683163948e-02f, -3.883725773e-02f, 3.747870034e-02f, 1.731701489e-02f, -1.394035371e-01f, 3.531340687e-01f,
+    7.087811618e-01f, 1.255116129e-01f, -1.298086403e-01f, 6.456560505e-02f, -3.331110704e-03f, -2.414105067e-02f,
+    2.137279924e-02f, -7.625130691e-03f, -1.814941998e-03f, 3.574229442e-03f, -1.714702296e-03f, 2.117716470e-04f,
+    2.538575415e-04f, -4.002115074e-04f, -1.035539917e-03f, 4.793513544e-03f, -7.542752159e-03f, 1.758475385e-03f,
+    1.693812540e-02f, -3.877487383e-02f, 3.709498486e-02f, 1.794814981e-02f, -1.397007743e-01f, 3.508909726e-01f,
+    7.094210055e-01f, 1.275416068e-01f, -1.302364638e-01f, 6.431015905e-02f, -2.965410921e-03f, -2.434157122e-02f,
+    2.138998693e-02f, -7.561039003e-03f, -1.870667872e-03f, 3.594735776e-03f, -1.714144133e-03f, 2.078754947e-04f,
+    2.519510814e-04f, -3.925402395e-04f, -1.048511542e-03f, 4.792932833e-03f, -7.493023110e-03f, 1.646433026e-03f,
+    1.704340990e-02f, -3.871061822e-02f, 3.671036852e-02f, 1.857646708e-02f, -1.399895932e-01f, 3.486468116e-01f,
+    7.100487984e-01f, 1.295765652e-01f, -1.306589818e-01f, 6.405061356e-02f, -2.598567212e-03f, -2.454135571e-02f,
+    2.140608398e-02f, -7.496331132e-03f, -1.926496215e-03f, 3.615126937e-03f, -1.713479863e-03f, 2.039361788e-04f,
+    2.500417412e-04f, -3.848934840e-04f, -1.061357638e-03f, 4.792086653e-03f, -7.443060468e-03f, 1.534651483e-03f,
+    1.714749074e-02f, -3.864449932e-02f, 3.632487373e-02f, 1.920194329e-02f, -1.402700129e-01f, 3.464016504e-01f,
+    7.106645202e-01f, 1.316164384e-01f, -1.310761552e-01f, 6.378697016e-02f, -2.230595719e-03f, -2.474039150e-02f,
+    2.142108635e-02f, -7.431008669e-03f, -1.982424245e-03f, 3.635401244e-03f, -1.712708986e-03f, 1.999537020e-04f,
+    2.481297220e-04f, -3.772716165e-04f, -1.074078018e-03f, 4.790976110e-03f, -7.392867823e-03f, 1.423136044e-03f,
+    1.725036574e-02f, -3.857652561e-02f, 3.593852288e-02f, 1.982455523e-02f, -1.405420527e-01f, 3.441555537e-01f,
+    7.112681511e-01f, 1.336611765e-01f, -1.314879449e-01f, 6.351923064e-02f, -1.861512687e-03f, -2.493866596e-02f,
+    2.143499007e-02f, -7.365073241e-03f, -2.038449169e-03f, 3.655557013e-03f, -1.711831005e-03f, 1.959280701e-04f,
+    2.462152238e-04f, -3.696750086e-04f, -1.086672506e-03f, 4.789602318e-03f, -7.342448762e-03f, 1.311891966e-03f,
+    1.735203279e-02f, -3.850670566e-02f, 3.555133833e-02f, 2.044427990e-02f, -1.408057323e-01f, 3.419085859e-01f,
+    7.118596716e-01f, 1.357107291e-01f, -1.318943118e-01f, 6.324739702e-02f, -1.491334459e-03f, -2.513616647e-02f,
+    2.144779118e-02f, -7.298526519e-03f, -2.094568176e-03f, 3.675592565e-03f, -1.710845428e-03f, 1.918592922e-04f,
+    2.442984456e-04f, -3.621040282e-04f, -1.099140931e-03f, 4.787966404e-03f, -7.291806877e-03f, 1.200924474e-03f,
+    1.745248984e-02f, -3.843504812e-02f, 3.516334246e-02f, 2.106109449e-02f, -1.410610715e-01f, 3.396608115e-01f,
+    7.124390626e-01f, 1.377650458e-01f, -1.322952172e-01f, 6.297147148e-02f, -1.120077482e-03f, -2.533288040e-02f,
+    2.145948579e-02f, -7.231370209e-03f, -2.150778438e-03f, 3.695506217e-03f, -1.709751770e-03f, 1.877473807e-04f,
+    2.423795851e-04f, -3.545590396e-04f, -1.111483134e-03f, 4.786069507e-03f, -7.240945758e-03f, 1.090238764e-03f,
+    1.755173494e-02f, -3.836156169e-02f, 3.477455760e-02f, 2.167497642e-02f, -1.413080904e-01f, 3.374122951e-01f,
+    7.130063055e-01f, 1.398240760e-01f, -1.326906223e-01f, 6.269145647e-02f, -7.477583013e-04f, -2.552879516e-02f,
+    2.147007007e-02f, -7.163606061e-03f, -2.207077116e-03f, 3.715296288e-03f, -1.708549548e-03f, 1.835923514e-04f,
+    2.404588390e-04f, -3.470404028e-04f, -1.123698963e-03f, 4.783912776e-03f, -7.189868996e-03f, 9.798399995e-04f,
+    1.764976617e-02f, -3.828625516e-02f, 3.438500609e-02f, 2.228590330e-02f, -1.415468095e-01f, 3.351631009e-01f,
+    7.135613819e-01f, 1.418877687e-01f, -1.330804886e-01f, 6.240735461e-02f, -3.743935597e-04f, -2.572389815e-02f,
+    2.147954021e-02f, -7.095235859e-03f, -2.263461354e-03f, 3.734961100e-03f, -1.707238284e-03f, 1.793942233e-04f,
+    2.385364028e-04f, -3.395484745e-04f, -1.135788276e-03f, 4.781497371e-03f, -7.138580182e-03f, 8.697333130e-04f,
+    1.774658172e-02f, -3.820913740e-02f, 3.399471021e-02f, 2.289385295e-02f, -1.417772495e-01f, 3.329132935e-01f,
+    7.141042740e-01f, 1.439560726e-01f, -1.334647775e-01f, 6.211916875e-02f, 1.933476961e-17f, -2.591817676e-02f,
+    2.148789249e-02f, -7.026261431e-03f, -2.319928278e-03f, 3.754498973e-03f, -1.705817506e-03f, 1.751530187e-04f,
+    2.366124709e-04f, -3.320836071e-04f, -1.147750937e-03f, 4.778824462e-03f, -7.087082908e-03f, 7.599238053e-04f,
+    1.784217984e-02f, -3.813021734e-02f, 3.360369226e-02f, 2.349880342e-02f, -1.419994314e-01f, 3.306629370e-01f,
+    7.146349642e-01f, 1.460289364e-01f, -1.338434507e-01f, 6.182690194e-02f, 3.754055375e-04f, -2.611161844e-02f,
+    2.149512319e-02f, -6.956684643e-03f, -2.376475005e-03f, 3.773908227e-03f, -1.704286746e-03f, 1.708687632e-04f,
+    2.346872364e-04f, -3.246461495e-04f, -1.159586821e-03f, 4.775895232e-03f, -7.035380764e-03f, 6.504165454e-04f,
+    1.793655882e-02f, -3.804950398e-02f, 3.321197451e-02f, 2.410073293e-02f, -1.422133762e-01f, 3.284120958e-01f,
+    7.151534355e-01f, 1.481063085e-01f, -1.342164699e-01f, 6.153055745e-02f, 7.518061154e-04f, -2.630421059e-02f,
+    2.150122869e-02f, -6.886507400e-03f, -2.433098632e-03f, 3.793187186e-03f, -1.702645541e-03f, 1.665414859e-04f,
+    2.327608912e-04f, -3.172364465e-04f, -1.171295811e-03f, 4.772710872e-03f, -6.983477341e-03f, 5.412165704e-04f,
+    1.802971707e-02f, -3.796700640e-02f, 3.281957918e-02f, 2.469961994e-02f, -1.424191056e-01f, 3.261608340e-01f,
+    7.156596709e-01f, 1.501881368e-01f, -1.345837969e-01f, 6.123013876e-02f, 1.129184700e-03f, -2.649594068e-02f,
+    2.150620538e-02f, -6.815731646e-03f, -2.489796245e-03f, 3.812334174e-03f, -1.700893433e-03f, 1.621712191e-04f,
+    2.308336263e-04f, -3.098548392e-04f, -1.182877797e-03f, 4.769272586e-03f, -6.931376228e-03f, 4.323288849e-04f,
+    1.812165304e-02f, -3.788273376e-02f, 3.242652850e-02f, 2.529544311e-02f, -1.426166413e-01f, 3.239092159e-01f,
+    7.161536543e-01f, 1.522743694e-01f, -1.349453940e-01f, 6.092564958e-02f, 1.507524160e-03f, -2.668679615e-02f,
+    2.151004974e-02f, -6.744359366e-03f, -2.546564913e-03f, 3.831347515e-03f, -1.699029969e-03f, 1.577579988e-04f,
+    2.289056312e-04f, -3.025016647e-04f, -1.194332681e-03f, 4.765581585e-03f, -6.879081015e-03f, 3.237584617e-04f,
+    1.821236525e-02f, -3.779669526e-02f, 3.203284466e-02f, 2.588818131e-02f, -1.428060053e-01f, 3.216573053e-01f,
+    7.166353695e-01f, 1.543649539e-01f, -1.353012230e-01f, 6.061709379e-02f, 1.886807272e-03f, -2.687676447e-02f,
+    2.151275827e-02f, -6.672392583e-03f, -2.603401691e-03f, 3.850225535e-03f, -1.697054701e-03f, 1.533018639e-04f,
+    2.269770943e-04f, -2.951772565e-04f, -1.205660370e-03f, 4.761639093e-03f, -6.826595288e-03f, 2.155102404e-04f,
+    1.830185229e-02f, -3.770890019e-02f, 3.163854983e-02f, 2.647781361e-02f, -1.429872198e-01f, 3.194051665e-01f,
+    7.171048011e-01f, 1.564598377e-01f, -1.356512465e-01f, 6.030447553e-02f, 2.267016716e-03f, -2.706583313e-02f,
+    2.151432753e-02f, -6.599833362e-03f, -2.660303622e-03f, 3.868966561e-03f, -1.694967187e-03f, 1.488028572e-04f,
+    2.250482028e-04f, -2.878819439e-04f, -1.216860780e-03f, 4.757446344e-03f, -6.773922636e-03f, 1.075891284e-04f,
+    1.839011285e-02f, -3.761935791e-02f, 3.124366614e-02f, 2.706431931e-02f, -1.431603075e-01f, 3.171528633e-01f,
+    7.175619339e-01f, 1.585589680e-01f, -1.359954266e-01f, 5.998779913e-02f, 2.648135076e-03f, -2.725398961e-02f,
+    2.151475414e-02f, -6.526683804e-03f, -2.717267733e-03f, 3.887568923e-03f, -1.692766988e-03f, 1.442610247e-04f,
+    2.231191426e-04f, -2.806160525e-04f, -1.227933837e-03f, 4.753004582e-03f, -6.721066642e-03f, 9.233383346e-18f,
+    1.847714565e-02f, -3.752807784e-02f, 3.084821571e-02f, 2.764767791e-02f, -1.433252910e-01f, 3.149004596e-01f,
+    7.180067531e-01f, 1.606622917e-01f, -1.363337260e-01f, 5.966706914e-02f, 3.030144847e-03f, -2.744122144e-02f,
+    2.151403478e-02f, -6.452946052e-03f, -2.774291036e-03f, 3.906030951e-03f, -1.690453672e-03f, 1.396764158e-04f,
+    2.211900985e-04f, -2.733799040e-04f, -1.238879473e-03f, 4.748315058e-03f, -6.668030890e-03f, -1.072523037e-04f,
+    1.856294949e-02f, -3.743506947e-02f, 3.045222062e-02f, 2.822786913e-02f, -1.434821934e-01f, 3.126480193e-01f,
+    7.184392443e-01f, 1.627697557e-01f, -1.366661075e-01f, 5.934229032e-02f, 3.413028428e-03f, -2.762751614e-02f,
+    2.151216615e-02f, -6.378622288e-03f, -2.831370532e-03f, 3.924350977e-03f, -1.688026811e-03f, 1.350490835e-04f,
+    2.192612539e-04f, -2.661738163e-04f, -1.249697632e-03f, 4.743379037e-03f, -6.614818962e-03f, -2.141629746e-04f,
+    1.864752327e-02f, -3.734034235e-02f, 3.005570293e-02f, 2.880487289e-02f, -1.436310380e-01f, 3.103956060e-01f,
+    7.188593934e-01f, 1.648813065e-01f, -1.369925336e-01f, 5.901346766e-02f, 3.796768127e-03f, -2.781286124e-02f,
+    2.150914504e-02f, -6.303714734e-03f, -2.888503205e-03f, 3.942527335e-03f, -1.685485984e-03f, 1.303790841e-04f,
+    2.173327909e-04f, -2.589981032e-04f, -1.260388262e-03f, 4.738197791e-03f, -6.561434437e-03f, -3.207272382e-04f,
+    1.873086591e-02f, -3.724390611e-02f, 2.965868464e-02f, 2.937866932e-02f, -1.437718485e-01f, 3.081432835e-01f,
+    7.192671869e-01f, 1.669968904e-01f, -1.373129676e-01f, 5.868060634e-02f, 4.181346161e-03f, -2.799724433e-02f,
+    2.150496828e-02f, -6.228225650e-03f, -2.945686028e-03f, 3.960558361e-03f, -1.682830775e-03f, 1.256664777e-04f,
+    2.154048907e-04f, -2.518530748e-04f, -1.270951323e-03f, 4.732772603e-03f, -6.507880892e-03f, -4.269403537e-04f,
+    1.881297644e-02f, -3.714577042e-02f, 2.926118776e-02f, 2.994923879e-02f, -1.439046484e-01f, 3.058911153e-01f,
+    7.196626117e-01f, 1.691164536e-01f, -1.376273723e-01f, 5.834371178e-02f, 4.566744656e-03f, -2.818065296e-02f,
+    2.149963275e-02f, -6.152157336e-03f, -3.002915960e-03f, 3.978442392e-03f, -1.680060771e-03f, 1.209113274e-04f,
+    2.134777328e-04f, -2.447390372e-04f, -1.281386779e-03f, 4.727104764e-03f, -6.454161902e-03f, -5.327976137e-04f,
+    1.889385395e-02f, -3.704594506e-02f, 2.886323424e-02f, 3.051656185e-02f, -1.440294620e-01f, 3.036391649e-01f,
+    7.200456547e-01f, 1.712399418e-01f, -1.379357112e-01f, 5.800278960e-02f, 4.952945648e-03f, -2.836307474e-02f,
+    2.149313538e-02f, -6.075512134e-03f, -3.060189945e-03f, 3.996177770e-03f, -1.677175567e-03f, 1.161137004e-04f,
+    2.115514956e-04f, -2.376562928e-04f, -1.291694607e-03f, 4.721195576e-03f, -6.400281038e-03f, -6.382943450e-04f,
+    1.897349757e-02f, -3.694443982e-02f, 2.846484599e-02f, 3.108061929e-02f, -1.441463136e-01f, 3.013874958e-01f,
+    7.204163037e-01f, 1.733673007e-01f, -1.382379476e-01f, 5.765784565e-02f, 5.339931084e-03f, -2.854449729e-02f,
+    2.148547316e-02f, -5.998292421e-03f, -3.117504915e-03f, 4.013762837e-03f, -1.674174762e-03f, 1.112736670e-04f,
+    2.096263564e-04f, -2.306051398e-04f, -1.301874789e-03f, 4.715046350e-03f, -6.346241870e-03f, -7.434259085e-04f,
+    1.905190655e-02f, -3.684126459e-02f, 2.806604492e-02f, 3.164139209e-02f, -1.442552276e-01f, 2.991361713e-01f,
+    7.207745467e-01f, 1.754984760e-01f, -1.385340449e-01f, 5.730888599e-02f, 5.727682822e-03f, -2.872490824e-02f,
+    2.147664316e-02f, -5.920500618e-03f, -3.174857789e-03f, 4.031195936e-03f, -1.671057963e-03f, 1.063913011e-04f,
+    2.077024908e-04f, -2.235858727e-04f, -1.311927317e-03f, 4.708658404e-03f, -6.292047964e-03f, -8.481876992e-04f,
+    1.912908017e-02f, -3.673642930e-02f, 2.766685287e-02f, 3.219886147e-02f, -1.443562288e-01f, 2.968852547e-01f,
+    7.211203719e-01f, 1.776334127e-01f, -1.388239670e-01f, 5.695591688e-02f, 6.116182633e-03f, -2.890429526e-02f,
+    2.146664245e-02f, -5.842139182e-03f, -3.232245474e-03f, 4.048475416e-03f, -1.667824780e-03f, 1.014666804e-04f,
+    2.057800734e-04f, -2.165987821e-04f, -1.321852188e-03f, 4.702033067e-03f, -6.237702882e-03f, -9.525751466e-04f,
+    1.920501779e-02f, -3.662994396e-02f, 2.726729165e-02f, 3.275300885e-02f, -1.444493424e-01f, 2.946348091e-01f,
+    7.214537682e-01f, 1.797720559e-01f, -1.391076777e-01f, 5.659894483e-02f, 6.505412200e-03f, -2.908264601e-02f,
+    2.145546821e-02f, -5.763210612e-03f, -3.289664861e-03f, 4.065599625e-03f, -1.664474829e-03f, 9.649988596e-05f,
+    2.038592774e-04f, -2.096441547e-04f, -1.331649411e-03f, 4.695171677e-03f, -6.183210183e-03f, -1.056583715e-03f,
+    1.927971884e-02f, -3.652181863e-02f, 2.686738303e-02f, 3.330381586e-02f, -1.445345936e-01f, 2.923848977e-01f,
+    7.217747247e-01f, 1.819143505e-01f, -1.393851409e-01f, 5.623797655e-02f, 6.895353119e-03f, -2.925994821e-02f,
+    2.144311764e-02f, -5.683717444e-03f, -3.347112832e-03f, 4.082566917e-03f, -1.661007733e-03f, 9.149100241e-05f,
+    2.019402747e-04f, -2.027222732e-04f, -1.341319001e-03f, 4.688075580e-03f, -6.128573424e-03f, -1.160208902e-03f,
+    1.935318282e-02f, -3.641206344e-02f, 2.646714876e-02f, 3.385126436e-02f, -1.446120079e-01f, 2.901355833e-01f,
+    7.220832310e-01f, 1.840602411e-01f, -1.396563208e-01f, 5.587301896e-02f, 7.285986903e-03f, -2.943618957e-02f,
+    2.142958802e-02f, -5.603662255e-03f, -3.404586255e-03f, 4.099375647e-03f, -1.657423119e-03f, 8.644011805e-05f,
+    2.000232359e-04f, -1.958334164e-04f, -1.350860980e-03f, 4.680746131e-03f, -6.073796155e-03f, -1.263446242e-03f,
+    1.942540930e-02f, -3.630068856e-02f, 2.606661053e-02f, 3.439533641e-02f, -1.446816110e-01f, 2.878869290e-01f,
+    7.223792771e-01f, 1.862096722e-01f, -1.399211818e-01f, 5.550407921e-02f, 7.677294977e-03f, -2.961135784e-02f,
+    2.141487667e-02f, -5.523047661e-03f, -3.462081984e-03f, 4.116024173e-03f, -1.653720622e-03f, 8.134732477e-05f,
+    1.981083302e-04f, -1.889778594e-04f, -1.360275381e-03f, 4.673184694e-03f, -6.018881925e-03f, -1.366291304e-03f,
+    1.949639790e-02f, -3.618770424e-02f, 2.566578999e-02f, 3.493601430e-02f, -1.447434291e-01f, 2.856389974e-01f,
+    7.226628534e-01f, 1.883625880e-01f, -1.401796882e-01f, 5.513116466e-02f, 8.069258682e-03f, -2.978544081e-02f,
+    2.139898098e-02f, -5.441876318e-03f, -3.519596863e-03f, 4.132510856e-03f, -1.649899881e-03f, 7.621271806e-05f,
+    1.961957255e-04f, -1.821558731e-04f, -1.369562241e-03f, 4.665392640e-03f, -5.963834276e-03f, -1.468739692e-03f,
+    1.956614833e-02f, -3.607312077e-02f, 2.526470876e-02f, 3.547328053e-02f, -1.447974883e-01f, 2.833918513e-01f,
+    7.229339505e-01f, 1.905189325e-01f, -1.404318047e-01f, 5.475428289e-02f, 8.461859279e-03f, -2.995842625e-02f,
+    2.138189837e-02f, -5.360150920e-03f, -3.577127723e-03f, 4.148834060e-03f, -1.645960542e-03f, 7.103639706e-05f,
+    1.942855883e-04f, -1.753677249e-04f, -1.378721608e-03f, 4.657371350e-03f, -5.908656748e-03f, -1.570787043e-03f,
+    1.963466037e-02f, -3.595694852e-02f, 2.486338841e-02f, 3.600711782e-02f, -1.448438151e-01f, 2.811455533e-01f,
+    7.231925598e-01f, 1.926786495e-01f, -1.406774962e-01f, 5.437344171e-02f, 8.855077942e-03f, -3.013030200e-02f,
+    2.136362636e-02f, -5.277874201e-03f, -3.634671384e-03f, 4.164992153e-03f, -1.641902256e-03f, 6.581846453e-05f,
+    1.923780839e-04f, -1.686136778e-04f, -1.387753538e-03f, 4.649122212e-03f, -5.853352876e-03f, -1.672429034e-03f,
+    1.970193385e-02f, -3.583919790e-02f, 2.446185045e-02f, 3.653750910e-02f, -1.448824362e-01f, 2.789001658e-01f,
+    7.234386727e-01f, 1.948416827e-01f, -1.409167275e-01f, 5.398864914e-02f, 9.248895766e-03f, -3.030105591e-02f,
+    2.134416249e-02f, -5.195048935e-03f, -3.692224652e-03f, 4.180983507e-03f, -1.637724681e-03f, 6.055902690e-05f,
+    1.904733761e-04f, -1.618939912e-04f, -1.396658091e-03f, 4.640646623e-03f, -5.797926188e-03f, -1.773661373e-03f,
+    1.976796867e-02f, -3.571987938e-02f, 2.406011638e-02f, 3.706443751e-02f, -1.449133786e-01f, 2.766557513e-01f,
+    7.236722812e-01f, 1.970079757e-01f, -1.411494637e-01f, 5.359991341e-02f, 9.643293763e-03f, -3.047067586e-02f,
+    2.132350438e-02f, -5.111677933e-03f, -3.749784323e-03f, 4.196806494e-03f, -1.633427480e-03f, 5.525819424e-05f,
+    1.885716272e-04f, -1.552089207e-04f, -1.405435340e-03f, 4.631945987e-03f, -5.742380210e-03f, -1.874479806e-03f,
+    1.983276481e-02f, -3.559900349e-02f, 2.365820761e-02f, 3.758788644e-02f, -1.449366694e-01f, 2.744123720e-01f,
+    7.238933777e-01f, 1.991774715e-01f, -1.413756703e-01f, 5.320724298e-02f, 1.003825286e-02f, -3.063914974e-02f,
+    2.130164970e-02f, -5.027764048e-03f, -3.807347181e-03f, 4.212459495e-03f, -1.629010324e-03f, 4.991608031e-05f,
+    1.866729985e-04f, -1.485587177e-04f, -1.414085361e-03f, 4.623021717e-03f, -5.686718460e-03f, -1.974880116e-03f,
+    1.989632230e-02f, -3.547658080e-02f, 2.325614554e-02f, 3.810783945e-02f, -1.449523360e-01f, 2.721700901e-01f,
+    7.241019550e-01f, 2.013501133e-01f, -1.415953126e-01f, 5.281064653e-02f, 1.043375393e-02f, -3.080646549e-02f,
+    2.127859618e-02f, -4.943310169e-03f, -3.864909999e-03f, 4.227940889e-03f, -1.624472887e-03f, 4.453280256e-05f,
+    1.847776497e-04f, -1.419436300e-04f, -1.422608242e-03f, 4.613875233e-03f, -5.630944453e-03f, -2.074858119e-03f,
+    1.995864126e-02f, -3.535262194e-02f, 2.285395151e-02f, 3.862428037e-02f, -1.449604062e-01f, 2.699289675e-01f,
+    7.242980062e-01f, 2.035258440e-01f, -1.418083563e-01f, 5.241013296e-02f, 1.082977772e-02f, -3.097261108e-02f,
+    2.125434161e-02f, -4.858319228e-03f, -3.922469539e-03f, 4.243249063e-03f, -1.619814853e-03f, 3.910848212e-05f,
+    1.828857390e-04f, -1.353639012e-04f, -1.431004074e-03f, 4.604507963e-03f, -5.575061696e-03f, -2.174409669e-03f,
+    2.001972186e-02f, -3.522713762e-02f, 2.245164681e-02f, 3.913719320e-02f, -1.449609077e-01f, 2.676890664e-01f,
+    7.244815249e-01f, 2.057046062e-01f, -1.420147671e-01f, 5.200571137e-02f, 1.122630494e-02f, -3.113757450e-02f,
+    2.122888383e-02f, -4.772794192e-03f, -3.980022550e-03f, 4.258382407e-03f, -1.615035909e-03f, 3.364324384e-05f,
+    1.809974235e-04f, -1.288197713e-04f, -1.439272960e-03f, 4.594921343e-03f, -5.519073694e-03f, -2.273530656e-03f,
+    2.007956433e-02f, -3.510013856e-02f, 2.204925266e-02f, 3.964656219e-02f, -1.449538686e-01f, 2.654504484e-01f,
+    7.246525050e-01f, 2.078863426e-01f, -1.422145110e-01f, 5.159739111e-02f, 1.162331620e-02f, -3.130134377e-02f,
+    2.120222076e-02f, -4.686738069e-03f, -4.037565772e-03f, 4.273339313e-03f, -1.610135751e-03f, 2.813721627e-05f,
+    1.791128587e-04f, -1.223114762e-04f, -1.447415008e-03f, 4.585116814e-03f, -5.462983942e-03f, -2.372217006e-03f,
+    2.013816898e-02f, -3.497163556e-02f, 2.164679027e-02f, 4.015237179e-02f, -1.449393172e-01f, 2.632131753e-01f,
+    7.248109411e-01f, 2.100709954e-01f, -1.424075543e-01f, 5.118518172e-02f, 1.202079205e-02f, -3.146390695e-02f,
+    2.117435035e-02f, -4.600153907e-03f, -4.095095934e-03f, 4.288118180e-03f, -1.605114078e-03f, 2.259053170e-05f,
+    1.772321986e-04f, -1.158392481e-04f, -1.455430334e-03f, 4.575095827e-03f, -5.406795931e-03f, -2.470464682e-03f,
+    2.019553620e-02f, -3.484163947e-02f, 2.124428077e-02f, 4.065460669e-02f, -1.449172822e-01f, 2.609773087e-01f,
+    7.249568278e-01f, 2.122585068e-01f, -1.425938632e-01f, 5.076909299e-02f, 1.241871296e-02f, -3.162525213e-02f,
+    2.114527064e-02f, -4.513044790e-03f, -4.152609754e-03f, 4.302717409e-03f, -1.599970599e-03f, 1.700332615e-05f,
+    1.753555962e-04f, -1.094033151e-04f, -1.463319062e-03f, 4.564859839e-03f, -5.350513146e-03f, -2.568269682e-03f,
+    2.025166640e-02f, -3.471016117e-02f, 2.084174523e-02f, 4.115325177e-02f, -1.448877921e-01f, 2.587429099e-01f,
+    7.250901604e-01f, 2.144488188e-01f, -1.427734042e-01f, 5.034913491e-02f, 1.281705931e-02f, -3.178536742e-02f,
+    2.111497972e-02f, -4.425413844e-03f, -4.210103939e-03f, 4.317135406e-03f, -1.594705026e-03f, 1.137573938e-05f,
+    1.734832026e-04f, -1.030039015e-04f, -1.471081323e-03f, 4.554410316e-03f, -5.294139064e-03f, -2.665628044e-03f,
+    2.030656011e-02f, -3.457721162e-02f, 2.043920469e-02f, 4.164829214e-02f, -1.448508761e-01f, 2.565100404e-01f,
+    7.252109343e-01f, 2.166418731e-01f, -1.429461441e-01f, 4.992531769e-02f, 1.321581143e-02f, -3.194424098e-02f,
+    2.108347572e-02f, -4.337264231e-03f, -4.267575187e-03f, 4.331370584e-03f, -1.589317082e-03f, 5.707914901e-06f,
+    1.716151678e-04f, -9.664122788e-05f, -1.478717256e-03f, 4.543748727e-03f, -5.237677157e-03f, -2.762535839e-03f,
+    2.036021788e-02f, -3.444280179e-02f, 2.003668012e-02f, 4.213971315e-02f, -1.448065632e-01f, 2.542787613e-01f,
+    7.253191457e-01f, 2.188376115e-01f, -1.431120497e-01f, 4.949765177e-02f, 1.361494955e-02f, -3.210186101e-02f,
+    2.105075687e-02f, -4.248599154e-03f, -4.325020185e-03f, 4.345421356e-03f, -1.583806492e-03f, -7.877451662e-19f,
+    1.697516403e-04f, -9.031551073e-05f, -1.486227006e-03f, 4.532876551e-03f, -5.181130889e-03f, -2.858989177e-03f,
+    2.041264036e-02f, -3.430694274e-02f, 1.963419244e-02f, 4.262750034e-02f, -1.447548829e-01f, 2.520491336e-01f,
+    7.254147909e-01f, 2.210359753e-01f, -1.432710881e-01f, 4.906614781e-02f, 1.401445385e-02f, -3.225821572e-02f,
+    2.101682142e-02f, -4.159421853e-03f, -4.382435610e-03f, 4.359286144e-03f, -1.578172989e-03f, -5.747854276e-06f,
+    1.678927671e-04f, -8.402696276e-05f, -1.493610728e-03f, 4.521795273e-03f, -5.124503717e-03f, -2.954984205e-03f,
+    2.046382824e-02f, -3.416964556e-02f, 1.923176251e-02f, 4.311163948e-02f, -1.446958648e-01f, 2.498212184e-01f,
+    7.254978668e-01f, 2.232369059e-01f, -1.434232266e-01f, 4.863081667e-02f, 1.441430443e-02f, -3.241329337e-02f,
+    2.098166772e-02f, -4.069735607e-03f, -4.439818130e-03f, 4.372963372e-03f, -1.572416315e-03f, -1.153549310e-05f,
+    1.660386939e-04f, -7.777579281e-05f, -1.500868581e-03f, 4.510506384e-03f, -5.067799092e-03f, -3.050517107e-03f,
+    2.051378228e-02f, -3.403092138e-02f, 1.882941114e-02f, 4.359211656e-02f, -1.446295388e-01f, 2.475950764e-01f,
+    7.255683704e-01f, 2.254403443e-01f, -1.435684325e-01f, 4.819166946e-02f, 1.481448132e-02f, -3.256708227e-02f,
+    2.094529415e-02f, -3.979543733e-03f, -4.497164401e-03f, 4.386451471e-03f, -1.566536215e-03f, -1.736275785e-05f,
+    1.641895649e-04f, -7.156220587e-05f, -1.508000733e-03f, 4.499011383e-03f, -5.011020456e-03f, -3.145584103e-03f,
+    2.056250333e-02f, -3.389078137e-02f, 1.842715906e-02f, 4.406891779e-02f, -1.445559348e-01f, 2.453707683e-01f,
+    7.256262995e-01f, 2.276462316e-01f, -1.437066735e-01f, 4.774871750e-02f, 1.521496447e-02f, -3.271957074e-02f,
+    2.090769916e-02f, -3.888849589e-03f, -4.554471072e-03f, 4.399748874e-03f, -1.560532443e-03f, -2.322948611e-05f,
+    1.623455227e-04f, -6.538640305e-05f, -1.515007360e-03f, 4.487311773e-03f, -4.954171246e-03f, -3.240181452e-03f,
+    2.060999227e-02f, -3.374923678e-02f, 1.802502697e-02f, 4.454202960e-02f, -1.444750832e-01f, 2.431483545e-01f,
+    7.256716520e-01f, 2.298545086e-01f, -1.438379174e-01f, 4.730197231e-02f, 1.561573378e-02f, -3.287074716e-02f,
+    2.086888128e-02f, -3.797656568e-03f, -4.611734783e-03f, 4.412854024e-03f, -1.554404760e-03f, -2.913551167e-05f,
+    1.605067088e-04f, -5.924858162e-05f, -1.521888643e-03f, 4.475409065e-03f, -4.897254888e-03f, -3.334305450e-03f,
+    2.065625006e-02f, -3.360629887e-02f, 1.762303549e-02f, 4.501143864e-02f, -1.443870144e-01f, 2.409278956e-01f,
+    7.257044264e-01f, 2.320651158e-01f, -1.439621323e-01f, 4.685144566e-02f, 1.601676908e-02f, -3.302059993e-02f,
+    2.082883908e-02f, -3.705968103e-03f, -4.668952162e-03f, 4.425765364e-03f, -1.548152932e-03f, -3.508066450e-05f,
+    1.586732629e-04f, -5.314893500e-05f, -1.528644772e-03f, 4.463304776e-03f, -4.840274802e-03f, -3.427952430e-03f,
+    2.070127773e-02f, -3.346197896e-02f, 1.722120519e-02f, 4.547713178e-02f, -1.442917591e-01f, 2.387094517e-01f,
+    7.257246215e-01f, 2.342779938e-01f, -1.440792864e-01f, 4.639714952e-02f, 1.641805011e-02f, -3.316911752e-02f,
+    2.078757120e-02f, -3.613787665e-03f, -4.726119830e-03f, 4.438481347e-03f, -1.541776733e-03f, -4.106477076e-05f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_32000[] = {
+    3.715210237e-04f, -7.640802211e-19f, -1.419608987e-03f, 2.027924383e-18f, 3.705999978e-03f, -4.073809505e-18f,
+    -8.003099927e-03f, 6.878276445e-18f, 1.542700203e-02f, -1.021292518e-17f, -2.788836496e-02f, 1.365812152e-17f,
+    4.983168746e-02f, -1.667973206e-17f, -9.724290663e-02f, 1.875171746e-17f, 3.152367328e-01f, 4.999620744e-01f,
+    3.152367328e-01f, 1.875171746e-17f, -9.724290663e-02f, -1.667973206e-17f, 4.983168746e-02f, 1.365812152e-17f,
+    -2.788836496e-02f, -1.021292518e-17f, 1.542700203e-02f, 6.878276445e-18f, -8.003099927e-03f, -4.073809505e-18f,
+    3.705999978e-03f, 2.027924383e-18f, -1.419608987e-03f, -7.640802211e-19f, 3.715210237e-04f, 1.449376686e-19f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_44100[] = {
+    1.974019649e-04f, -2.354182265e-05f, -6.391967202e-04f, -7.675726411e-04f, 5.165824982e-04f, 2.225310810e-03f,
+    1.552648237e-03f, -2.391413658e-03f, -5.402296203e-03f, -1.760409547e-03f, 7.103669667e-03f, 1.037165541e-02f,
+    -4.137471559e-04f, -1.665672649e-02f, -1.664024514e-02f, 8.409062553e-03f, 3.442948077e-02f, 2.296759319e-02f,
+    -3.062729529e-02f, -7.208853829e-02f, -2.771451088e-02f, 1.182364779e-01f, 2.876587849e-01f, 3.628352360e-01f,
+    2.876587849e-01f, 1.182364779e-01f, -2.771451088e-02f, -7.208853829e-02f, -3.062729529e-02f, 2.296759319e-02f,
+    3.442948077e-02f, 8.409062553e-03f, -1.664024514e-02f, -1.665672649e-02f, -4.137471559e-04f, 1.037165541e-02f,
+    7.103669667e-03f, -1.760409547e-03f, -5.402296203e-03f, -2.391413658e-03f, 1.552648237e-03f, 2.225310810e-03f,
+    5.165824982e-04f, -7.675726411e-04f, -6.391967202e-04f, -2.354182265e-05f, 1.974019649e-04f, 7.841598744e-05f,
+    1.972884039e-04f, -2.053065674e-05f, -6.355266864e-04f, -7.708234646e-04f, 5.048248084e-04f, 2.219053833e-03f,
+    1.568569949e-03f, -2.362860967e-03f, -5.400123191e-03f, -1.806741708e-03f, 7.051883118e-03f, 1.039291054e-02f,
+    -3.098955272e-04f, -1.658316249e-02f, -1.672492807e-02f, 8.208333927e-03f, 3.435020949e-02f, 2.319662165e-02f,
+    -3.024820316e-02f, -7.203357811e-02f, -2.834117094e-02f, 1.171291349e-01f, 2.867815084e-01f, 3.628317610e-01f,
+    2.885316310e-01f, 1.193446772e-01f, -2.708348010e-02f, -7.213980550e-02f, -3.100594235e-02f, 2.273665151e-02f,
+    3.450710463e-02f, 8.609877659e-03f, -1.655442716e-02f, -1.672958088e-02f, -5.178664333e-04f, 1.034976744e-02f,
+    7.155219410e-03f, -1.713831914e-03f, -5.404173239e-03f, -2.419933647e-03f, 1.536575739e-03f, 2.231464503e-03f,
+    5.283638643e-04f, -7.642580372e-04f, -6.428474337e-04f, -2.657223017e-05f, 1.975009353e-04f, 7.932995201e-05f,
+    1.971607265e-04f, -1.753887167e-05f, -6.318388443e-04f, -7.740120086e-04f, 4.930923500e-04f, 2.212698416e-03f,
+    1.584343334e-03f, -2.334281689e-03f, -5.397665133e-03f, -1.852829754e-03f, 6.999876297e-03f, 1.041355233e-02f,
+    -2.063172858e-04f, -1.650892516e-02f, -1.680850468e-02f, 8.007717681e-03f, 3.426936223e-02f, 2.342377217e-02f,
+    -2.986874268e-02f, -7.197507231e-02f, -2.896350176e-02f, 1.160228959e-01f, 2.859003556e-01f, 3.628219985e-01f,
+    2.894005431e-01f, 1.204539168e-01f, -2.644813849e-02f, -7.218749566e-02f, -3.138417939e-02f, 2.250384527e-02f,
+    3.458313537e-02f, 8.810784013e-03f, -1.646750624e-02f, -1.680175024e-02f, -6.222491027e-04f, 1.032726501e-02f,
+    7.206541753e-03f, -1.667013901e-03f, -5.405763103e-03f, -2.448423547e-03f, 1.520355674e-03f, 2.237518199e-03f,
+    5.401692337e-04f, -7.608809578e-04f, -6.464796480e-04f, -2.962182400e-05f, 1.975855617e-04f, 8.024667169e-05f,
+    1.970190470e-04f, -1.456655628e-05f, -6.281335318e-04f, -7.771383825e-04f, 4.813857094e-04f, 2.206245327e-03f,
+    1.599968057e-03f, -2.305677519e-03f, -5.394923111e-03f, -1.898671928e-03f, 6.947652675e-03f, 1.043358143e-02f,
+    -1.030171975e-04f, -1.643402024e-02f, -1.689097355e-02f, 7.807223966e-03f, 3.418694751e-02f, 2.364903865e-02f,
+    -2.948893393e-02f, -7.191303667e-02f, -2.958149557e-02f, 1.149177908e-01f, 2.850153539e-01f, 3.628059489e-01f,
+    2.902654942e-01f, 1.215641665e-01f, -2.580849437e-02f, -7.223159334e-02f, -3.176198621e-02f, 2.226918093e-02f,
+    3.465756467e-02f, 9.011771366e-03f, -1.637948399e-02f, -1.687322888e-02f, -7.268903146e-04f, 1.030414759e-02f,
+    7.257633230e-03f, -1.619957322e-03f, -5.407064754e-03f, -2.476881652e-03f, 1.503988411e-03f, 2.243471136e-03f,
+    5.519980075e-04f, -7.574413045e-04f, -6.500930238e-04f, -3.269050946e-05f, 1.976557315e-04f, 8.116607732e-05f,
+    1.968634800e-04f, -1.161379748e-05f, -6.244110865e-04f, -7.802026991e-04f, 4.697054690e-04f, 2.199695343e-03f,
+    1.615443790e-03f, -2.277050144e-03f, -5.391898216e-03f, -1.944266496e-03f, 6.895215729e-03f, 1.045299852e-02f,
+    -7.074014505e-18f, -1.635845350e-02f, -1.697233330e-02f, 7.606862900e-03f, 3.410297390e-02f, 2.387241511e-02f,
+    -2.910879696e-02f, -7.184748707e-02f, -3.019514476e-02f, 1.138138493e-01f, 2.841265309e-01f, 3.627836127e-01f,
+    2.911264573e-01f, 1.226753962e-01f, -2.516455622e-02f, -7.227208318e-02f, -3.213934256e-02f, 2.203266504e-02f,
+    3.473038425e-02f, 9.212829442e-03f, -1.629036210e-02f, -1.694401114e-02f, -8.317851922e-04f, 1.028041466e-02f,
+    7.308490379e-03f, -1.572664008e-03f, -5.408077166e-03f, -2.505306251e-03f, 1.487474324e-03f, 2.249322556e-03f,
+    5.638495832e-04f, -7.539389824e-04f, -6.536872211e-04f, -3.577818995e-05f, 1.977113321e-04f, 8.208809899e-05f,
+    1.966941407e-04f, -8.680680298e-06f, -6.206718452e-04f, -7.832050749e-04f, 4.580522071e-04f, 2.193049238e-03f,
+    1.630770218e-03f, -2.248401248e-03f, -5.388591554e-03f, -1.989611742e-03f, 6.842568934e-03f, 1.047180430e-02f,
+    1.027295971e-04f, -1.628223073e-02f, -1.705258262e-02f, 7.406644568e-03f, 3.401745004e-02f, 2.409389565e-02f,
+    -2.872835176e-02f, -7.177843947e-02f, -3.080444188e-02f, 1.127111011e-01f, 2.832339140e-01f, 3.627549905e-01f,
+    2.919834057e-01f, 1.237875757e-01f, -2.451633272e-02f, -7.230894995e-02f, -3.251622816e-02f, 2.179430426e-02f,
+    3.480158591e-02f, 9.413947931e-03f, -1.620014233e-02f, -1.701409139e-02f, -9.369288320e-04f, 1.025606573e-02f,
+    7.359109740e-03f, -1.525135810e-03f, -5.408799325e-03f, -2.533695633e-03f, 1.470813801e-03f, 2.255071703e-03f,
+    5.757233540e-04f, -7.503739000e-04f, -6.572618998e-04f, -3.888476695e-05f, 1.977522516e-04f, 8.301266607e-05f,
+    1.965111444e-04f, -5.767287832e-06f, -6.169161441e-04f, -7.861456293e-04f, 4.464264979e-04f, 2.186307792e-03f,
+    1.645947034e-03f, -2.219732513e-03f, -5.385004242e-03f, -2.034705968e-03f, 6.789715770e-03f, 1.048999951e-02f,
+    2.051669124e-04f, -1.620535775e-02f, -1.713172027e-02f, 7.206579021e-03f, 3.393038460e-02f, 2.431347450e-02f,
+    -2.834761826e-02f, -7.170590996e-02f, -3.140937967e-02f, 1.116095758e-01f, 2.823375312e-01f, 3.627200835e-01f,
+    2.928363126e-01f, 1.249006749e-01f, -2.386383270e-02f, -7.234217849e-02f, -3.289262269e-02f, 2.155410538e-02f,
+    3.487116148e-02f, 9.615116493e-03f, -1.610882648e-02f, -1.708346400e-02f, -1.042316304e-03f, 1.023110036e-02f,
+    7.409487858e-03f, -1.477374596e-03f, -5.409230230e-03f, -2.562048079e-03f, 1.454007238e-03f, 2.260717824e-03f,
+    5.876187094e-04f, -7.467459695e-04f, -6.608167190e-04f, -4.201013999e-05f, 1.977783786e-04f, 8.393970720e-05f,
+    1.963146070e-04f, -2.873701295e-06f, -6.131443190e-04f, -7.890244856e-04f, 4.348289114e-04f, 2.179471788e-03f,
+    1.660973943e-03f, -2.191045612e-03f, -5.381137409e-03f, -2.079547496e-03f, 6.736659714e-03f, 1.050758492e-02f,
+    3.073072931e-04f, -1.612784038e-02f, -1.720974506e-02f, 7.006676274e-03f, 3.384178634e-02f, 2.453114601e-02f,
+    -2.796661639e-02f, -7.162991470e-02f, -3.200995104e-02f, 1.105093028e-01f, 2.814374101e-01f, 3.626788927e-01f,
+    2.936851514e-01f, 1.260146634e-01f, -2.320706515e-02f, -7.237175379e-02f, -3.326850578e-02f, 2.131207526e-02f,
+    3.493910289e-02f, 9.816324760e-03f, -1.601641644e-02f, -1.715212339e-02f, -1.147942651e-03f, 1.020551813e-02f,
+    7.459621278e-03f, -1.429382254e-03f, -5.409368893e-03f, -2.590361869e-03f, 1.437055041e-03f, 2.266260171e-03f,
+    5.995350349e-04f, -7.430551068e-04f, -6.643513377e-04f, -4.515420671e-05f, 1.977896020e-04f, 8.486915032e-05f,
+    1.961046446e-04f, -3.938420066e-19f, -6.093567049e-04f, -7.918417701e-04f, 4.232600135e-04f, 2.172542010e-03f,
+    1.675850657e-03f, -2.162342216e-03f, -5.376992196e-03f, -2.124134667e-03f, 6.683404247e-03f, 1.052456134e-02f,
+    4.091461147e-04f, -1.604968446e-02f, -1.728665588e-02f, 6.806946308e-03f, 3.375166404e-02f, 2.474690463e-02f,
+    -2.758536598e-02f, -7.155046994e-02f, -3.260614905e-02f, 1.094103115e-01f, 2.805335789e-01f, 3.626314195e-01f,
+    2.945298957e-01f, 1.271295108e-01f, -2.254603926e-02f, -7.239766090e-02f, -3.364385704e-02f, 2.106822091e-02f,
+    3.500540208e-02f, 1.001756233e-02f, -1.592291412e-02f, -1.722006399e-02f, -1.253802889e-03f, 1.017931865e-02f,
+    7.509506550e-03f, -1.381160691e-03f, -5.409214340e-03f, -2.618635277e-03f, 1.419957627e-03f, 2.271697997e-03f,
+    6.114717120e-04f, -7.393012313e-04f, -6.678654143e-04f, -4.831686280e-05f, 1.977858114e-04f, 8.580092263e-05f,
+    1.958813737e-04f, 2.853738631e-06f, -6.055536362e-04f, -7.945976127e-04f, 4.117203657e-04f, 2.165519244e-03f,
+    1.690576900e-03f, -2.133623991e-03f, -5.372569757e-03f, -2.168465842e-03f, 6.629952849e-03f, 1.054092960e-02f,
+    5.106787819e-04f, -1.597089587e-02f, -1.736245166e-02f, 6.607399071e-03f, 3.366002655e-02f, 2.496074490e-02f,
+    -2.720388684e-02f, -7.146759206e-02f, -3.319796695e-02f, 1.083126313e-01f, 2.796260655e-01f, 3.625776654e-01f,
+    2.953705191e-01f, 1.282451866e-01f, -2.188076436e-02f, -7.241988501e-02f, -3.401865602e-02f, 2.082254944e-02f,
+    3.507005111e-02f, 1.021881879e-02f, -1.582832155e-02f, -1.728728025e-02f, -1.359892011e-03f, 1.015250158e-02f,
+    7.559140227e-03f, -1.332711832e-03f, -5.408765610e-03f, -2.646866575e-03f, 1.402715423e-03f, 2.277030559e-03f,
+    6.234281184e-04f, -7.354842660e-04f, -6.713586069e-04f, -5.149800199e-05f, 1.977668968e-04f, 8.673495062e-05f,
+    1.956449112e-04f, 5.687439066e-06f, -6.017354465e-04f, -7.972921464e-04f, 4.002105255e-04f, 2.158404280e-03f,
+    1.705152404e-03f, -2.104892598e-03f, -5.367871258e-03f, -2.212539400e-03f, 6.576309002e-03f, 1.055669056e-02f,
+    6.119007282e-04f, -1.589148049e-02f, -1.743713139e-02f, 6.408044473e-03f, 3.356688277e-02f, 2.517266151e-02f,
+    -2.682219874e-02f, -7.138129749e-02f, -3.378539817e-02f, 1.072162915e-01f, 2.787148980e-01f, 3.625176322e-01f,
+    2.962069954e-01f, 1.293616604e-01f, -2.121124998e-02f, -7.243841139e-02f, -3.439288227e-02f, 2.057506804e-02f,
+    3.513304206e-02f, 1.042008366e-02f, -1.573264077e-02f, -1.735376665e-02f, -1.466204980e-03f, 1.012506658e-02f,
+    7.608518868e-03f, -1.284037620e-03f, -5.408021755e-03f, -2.675054032e-03f, 1.385328864e-03f, 2.282257119e-03f,
+    6.354036280e-04f, -7.316041377e-04f, -6.748305734e-04f, -5.469751612e-05f, 1.977327488e-04f, 8.767116008e-05f,
+    1.953953742e-04f, 8.501027653e-06f, -5.979024688e-04f, -7.999255075e-04f, 3.887310463e-04f, 2.151197910e-03f,
+    1.719576913e-03f, -2.076149692e-03f, -5.362897874e-03f, -2.256353740e-03f, 6.522476187e-03f, 1.057184511e-02f,
+    7.128074161e-04f, -1.581144421e-02f, -1.751069415e-02f, 6.208892387e-03f, 3.347224167e-02f, 2.538264923e-02f,
+    -2.644032138e-02f, -7.129160279e-02f, -3.436843629e-02f, 1.061213212e-01f, 2.778001048e-01f, 3.624513219e-01f,
+    2.970392984e-01f, 1.304789015e-01f, -2.053750579e-02f, -7.245322545e-02f, -3.476651526e-02f, 2.032578406e-02f,
+    3.519436709e-02f, 1.062134647e-02f, -1.563587391e-02f, -1.741951768e-02f, -1.572736737e-03f, 1.009701338e-02f,
+    7.657639032e-03f, -1.235140018e-03f, -5.406981841e-03f, -2.703195911e-03f, 1.367798398e-03f, 2.287376940e-03f,
+    6.473976106e-04f, -7.276607767e-04f, -6.782809710e-04f, -5.791529507e-05f, 1.976832584e-04f, 8.860947606e-05f,
+    1.951328804e-04f, 1.129443262e-05f, -5.940550354e-04f, -8.024978358e-04f, 3.772824769e-04f, 2.143900927e-03f,
+    1.733850178e-03f, -2.047396923e-03f, -5.357650795e-03f, -2.299907281e-03f, 6.468457886e-03f, 1.058639418e-02f,
+    8.133943378e-04f, -1.573079296e-02f, -1.758313905e-02f, 6.009952652e-03f, 3.337611223e-02f, 2.559070294e-02f,
+    -2.605827441e-02f, -7.119852458e-02f, -3.494707508e-02f, 1.050277494e-01f, 2.768817141e-01f, 3.623787366e-01f,
+    2.978674023e-01f, 1.315968793e-01f, -1.985954165e-02f, -7.246431267e-02f, -3.513953446e-02f, 2.007470491e-02f,
+    3.525401842e-02f, 1.082259672e-02f, -1.553802316e-02f, -1.748452789e-02f, -1.679482194e-03f, 1.006834171e-02f,
+    7.706497286e-03f, -1.186021006e-03f, -5.405644947e-03f, -2.731290474e-03f, 1.350124480e-03f, 2.292389289e-03f,
+    6.594094326e-04f, -7.236541174e-04f, -6.817094571e-04f, -6.115122678e-05f, 1.976183172e-04f, 8.954982293e-05f,
+    1.948575474e-04f, 1.406758408e-05f, -5.901934779e-04f, -8.050092741e-04f, 3.658653622e-04f, 2.136514128e-03f,
+    1.747971962e-03f, -2.018635938e-03f, -5.352131220e-03f, -2.343198460e-03f, 6.414257580e-03f, 1.060033872e-02f,
+    9.136570145e-04f, -1.564953267e-02f, -1.765446528e-02f, 5.811235068e-03f, 3.327850353e-02f, 2.579681766e-02f,
+    -2.567607745e-02f, -7.110207960e-02f, -3.552130846e-02f, 1.039356052e-01f, 2.759597544e-01f, 3.622998787e-01f,
+    2.986912810e-01f, 1.327155631e-01f, -1.917736758e-02f, -7.247165867e-02f, -3.551191930e-02f, 1.982183815e-02f,
+    3.531198833e-02f, 1.102382385e-02f, -1.543909077e-02f, -1.754879181e-02f, -1.786436240e-03f, 1.003905136e-02f,
+    7.755090198e-03f, -1.136682582e-03f, -5.404010168e-03f, -2.759335979e-03f, 1.332307577e-03f, 2.297293438e-03f,
+    6.714384562e-04f, -7.195840974e-04f, -6.851156884e-04f, -6.440519724e-05f, 1.975378175e-04f, 9.049212433e-05f,
+    1.945694933e-04f, 1.682041400e-05f, -5.863181270e-04f, -8.074599686e-04f, 3.544802426e-04f, 2.129038311e-03f,
+    1.761942037e-03f, -1.989868376e-03f, -5.346340362e-03f, -2.386225734e-03f, 6.359878751e-03f, 1.061367972e-02f,
+    1.013590997e-03f, -1.556766929e-02f, -1.772467208e-02f, 5.612749400e-03f, 3.317942467e-02f, 2.600098848e-02f,
+    -2.529375005e-02f, -7.100228465e-02f, -3.609113054e-02f, 1.028449175e-01f, 2.750342543e-01f, 3.622147507e-01f,
+    2.995109089e-01f, 1.338349221e-01f, -1.849099378e-02f, -7.247524917e-02f, -3.588364916e-02f, 1.956719142e-02f,
+    3.536826917e-02f, 1.122501730e-02f, -1.533907905e-02f, -1.761230402e-02f, -1.893593738e-03f, 1.000914214e-02f,
+    7.803414343e-03f, -1.087126765e-03f, -5.402076609e-03f, -2.787330682e-03f, 1.314348166e-03f, 2.302088662e-03f,
+    6.834840401e-04f, -7.154506584e-04f, -6.884993216e-04f, -6.767709052e-05f, 1.974416519e-04f, 9.143630321e-05f,
+    1.942688367e-04f, 1.955285622e-05f, -5.824293127e-04f, -8.098500684e-04f, 3.431276543e-04f, 2.121474277e-03f,
+    1.775760184e-03f, -1.961095873e-03f, -5.340279443e-03f, -2.428987579e-03f, 6.305324879e-03f, 1.062641818e-02f,
+    1.113191867e-03f, -1.548520879e-02f, -1.779375875e-02f, 5.414505372e-03f, 3.307888480e-02f, 2.620321062e-02f,
+    -2.491131170e-02f, -7.089915665e-02f, -3.665653559e-02f, 1.017557151e-01f, 2.741052423e-01f, 3.621233554e-01f,
+    3.003262602e-01f, 1.349549255e-01f, -1.780043061e-02f, -7.247507000e-02f, -3.625470342e-02f, 1.931077249e-02f,
+    3.542285336e-02f, 1.142616649e-02f, -1.523799037e-02f, -1.767505912e-02f, -2.000949527e-03f, 9.978613887e-03f,
+    7.851466300e-03f, -1.037355588e-03f, -5.399843393e-03f, -2.815272833e-03f, 1.296246732e-03f, 2.306774238e-03f,
+    6.955455392e-04f, -7.112537457e-04f, -6.918600131e-04f, -7.096678872e-05f, 1.973297139e-04f, 9.238228181e-05f,
+    1.939556960e-04f, 2.226484644e-05f, -5.785273642e-04f, -8.121797261e-04f, 3.318081293e-04f, 2.113822828e-03f,
+    1.789426194e-03f, -1.932320058e-03f, -5.333949697e-03f, -2.471482492e-03f, 6.250599446e-03f, 1.063855516e-02f,
+    1.212455235e-03f, -1.540215716e-02f, -1.786172467e-02f, 5.216512674e-03f, 3.297689315e-02f, 2.640347941e-02f,
+    -2.452878187e-02f, -7.079271258e-02f, -3.721751806e-02f, 1.006680266e-01f, 2.731727473e-01f, 3.620256959e-01f,
+    3.011373096e-01f, 1.360755424e-01f, -1.710568860e-02f, -7.247110709e-02f, -3.662506138e-02f, 1.905258921e-02f,
+    3.547573337e-02f, 1.162726080e-02f, -1.513582717e-02f, -1.773705175e-02f, -2.108498421e-03f, 9.947466481e-03f,
+    7.899242653e-03f, -9.873711059e-04f, -5.397309654e-03f, -2.843160681e-03f, 1.278003774e-03f, 2.311349448e-03f,
+    7.076223047e-04f, -7.069933086e-04f, -6.951974191e-04f, -7.427417202e-05f, 1.972018973e-04f, 9.332998168e-05f,
+    1.936301902e-04f, 2.495632223e-05f, -5.746126100e-04f, -8.144490974e-04f, 3.205221949e-04f, 2.106084770e-03f,
+    1.802939869e-03f, -1.903542556e-03f, -5.327352369e-03f, -2.513708987e-03f, 6.195705929e-03f, 1.065009173e-02f,
+    1.311376742e-03f, -1.531852038e-02f, -1.792856925e-02f, 5.018780953e-03f, 3.287345895e-02f, 2.660179030e-02f,
+    -2.414617994e-02f, -7.068296953e-02f, -3.777407257e-02f, 9.958188078e-02f, 2.722367980e-01f, 3.619217751e-01f,
+    3.019440316e-01f, 1.371967417e-01f, -1.640677845e-02f, -7.246334651e-02f, -3.699470237e-02f, 1.879264958e-02f,
+    3.552690175e-02f, 1.182828958e-02f, -1.503259196e-02f, -1.779827656e-02f, -2.216235209e-03f, 9.915699832e-03f,
+    7.946739990e-03f, -9.371753904e-04f, -5.394474542e-03f, -2.870992473e-03f, 1.259619796e-03f, 2.315813579e-03f,
+    7.197136839e-04f, -7.026693000e-04f, -6.985111954e-04f, -7.759911864e-05f, 1.970580966e-04f, 9.427932368e-05f,
+    1.932924385e-04f, 2.762722299e-05f, -5.706853776e-04f, -8.166583409e-04f, 3.092703746e-04f, 2.098260909e-03f,
+    1.816301018e-03f, -1.874764984e-03f, -5.320488715e-03f, -2.555665599e-03f, 6.140647809e-03f, 1.066102898e-02f,
+    1.409952059e-03f, -1.523430449e-02f, -1.799429199e-02f, 4.821319820e-03f, 3.276859152e-02f, 2.679813882e-02f,
+    -2.376352526e-02f, -7.056994466e-02f, -3.832619390e-02f, 9.849730612e-02f, 2.712974233e-01f, 3.618115966e-01f,
+    3.027464010e-01f, 1.383184926e-01f, -1.570371103e-02f, -7.245177441e-02f, -3.736360564e-02f, 1.853096168e-02f,
+    3.557635111e-02f, 1.202924217e-02f, -1.492828730e-02f, -1.785872822e-02f, -2.324154656e-03f, 9.883313885e-03f,
+    7.993954907e-03f, -8.867705310e-04f, -5.391337220e-03f, -2.898766452e-03f, 1.241095317e-03f, 2.320165920e-03f,
+    7.318190208e-04f, -6.982816767e-04f, -7.018009980e-04f, -8.094150484e-05f, 1.968982070e-04f, 9.523022795e-05f,
+    1.929425602e-04f, 3.027748997e-05f, -5.667459936e-04f, -8.188076185e-04f, 2.980531871e-04f, 2.090352053e-03f,
+    1.829509462e-03f, -1.845988956e-03f, -5.313360003e-03f, -2.597350884e-03f, 6.085428561e-03f, 1.067136807e-02f,
+    1.508176887e-03f, -1.514951550e-02f, -1.805889243e-02f, 4.624138846e-03f, 3.266230022e-02f, 2.699252063e-02f,
+    -2.338083711e-02f, -7.045365523e-02f, -3.887387702e-02f, 9.741433106e-02f, 2.703546522e-01f, 3.616951638e-01f,
+    3.035443925e-01f, 1.394407639e-01f, -1.499649738e-02f, -7.243637709e-02f, -3.773175045e-02f, 1.826753371e-02f,
+    3.562407414e-02f, 1.223010787e-02f, -1.482291580e-02f, -1.791840145e-02f, -2.432251503e-03f, 9.850308616e-03f,
+    8.040884002e-03f, -8.361586353e-04f, -5.387896866e-03f, -2.926480858e-03f, 1.222430862e-03f, 2.324405763e-03f,
+    7.439376554e-04f, -6.938303993e-04f, -7.050664825e-04f, -8.430120494e-05f, 1.967221242e-04f, 9.618261396e-05f,
+    1.925806751e-04f, 3.290706627e-05f, -5.627947840e-04f, -8.208970952e-04f, 2.868711470e-04f, 2.082359013e-03f,
+    1.842565030e-03f, -1.817216080e-03f, -5.305967510e-03f, -2.638763413e-03f, 6.030051662e-03f, 1.068111013e-02f,
+    1.606046960e-03f, -1.506415946e-02f, -1.812237017e-02f, 4.427247563e-03f, 3.255459444e-02f, 2.718493150e-02f,
+    -2.299813472e-02f, -7.033411858e-02f, -3.941711706e-02f, 9.633298397e-02f, 2.694085138e-01f, 3.615724806e-01f,
+    3.043379813e-01f, 1.405635245e-01f, -1.428514871e-02f, -7.241714093e-02f, -3.809911599e-02f, 1.800237397e-02f,
+    3.567006356e-02f, 1.243087598e-02f, -1.471648017e-02f, -1.797729097e-02f, -2.540520467e-03f, 9.816684036e-03f,
+    8.087523882e-03f, -7.853418292e-04f, -5.384152673e-03f, -2.954133929e-03f, 1.203626968e-03f, 2.328532407e-03f,
+    7.560689245e-04f, -6.893154324e-04f, -7.083073045e-04f, -8.767809132e-05f, 1.965297446e-04f, 9.713640051e-05f,
+    1.922069029e-04f, 3.551589683e-05f, -5.588320738e-04f, -8.229269389e-04f, 2.757247644e-04f, 2.074282601e-03f,
+    1.855467562e-03f, -1.788447957e-03f, -5.298312526e-03f, -2.679901782e-03f, 5.974520586e-03f, 1.069025638e-02f,
+    1.703558039e-03f, -1.497824242e-02f, -1.818472489e-02f, 4.230655461e-03f, 3.244548362e-02f, 2.737536731e-02f,
+    -2.261543726e-02f, -7.021135212e-02f, -3.995590931e-02f, 9.525329309e-02f, 2.684590373e-01f, 3.614435510e-01f,
+    3.051271425e-01f, 1.416867433e-01f, -1.356967639e-02f, -7.239405245e-02f, -3.846568146e-02f, 1.773549087e-02f,
+    3.571431221e-02f, 1.263153576e-02f, -1.460898315e-02f, -1.803539156e-02f, -2.648956243e-03f, 9.782440190e-03f,
+    8.133871159e-03f, -7.343222561e-04f, -5.380103846e-03f, -2.981723900e-03f, 1.184684184e-03f, 2.332545153e-03f,
+    7.682121609e-04f, -6.847367443e-04f, -7.115231195e-04f, -9.107203441e-05f, 1.963209653e-04f, 9.809150568e-05f,
+    1.918213637e-04f, 3.810392840e-05f, -5.548581869e-04f, -8.248973206e-04f, 2.646145451e-04f, 2.066123631e-03f,
+    1.868216906e-03f, -1.759686182e-03f, -5.290396348e-03f, -2.720764603e-03f, 5.918838805e-03f, 1.069880801e-02f,
+    1.800705919e-03f, -1.489177046e-02f, -1.824595631e-02f, 4.034371990e-03f, 3.233497728e-02f, 2.756382404e-02f,
+    -2.223276385e-02f, -7.008537337e-02f, -4.049024925e-02f, 9.417528659e-02f, 2.675062520e-01f, 3.613083790e-01f,
+    3.059118512e-01f, 1.428103889e-01f, -1.285009196e-02f, -7.236709828e-02f, -3.883142602e-02f, 1.746689295e-02f,
+    3.575681297e-02f, 1.283207644e-02f, -1.450042756e-02f, -1.809269799e-02f, -2.757553500e-03f, 9.747577155e-03f,
+    8.179922451e-03f, -6.831020774e-04f, -5.375749607e-03f, -3.009249003e-03f, 1.165603064e-03f, 2.336443306e-03f,
+    7.803666940e-04f, -6.800943073e-04f, -7.147135827e-04f, -9.448290266e-05f, 1.960956839e-04f, 9.904784689e-05f,
+    1.914241777e-04f, 4.067110956e-05f, -5.508734464e-04f, -8.268084143e-04f, 2.535409905e-04f, 2.057882918e-03f,
+    1.880812921e-03f, -1.730932346e-03f, -5.282220286e-03f, -2.761350508e-03f, 5.863009791e-03f, 1.070676630e-02f,
+    1.897486424e-03f, -1.480474967e-02f, -1.830606422e-02f, 3.838406561e-03f, 3.222308493e-02f, 2.775029779e-02f,
+    -2.185013355e-02f, -6.995619990e-02f, -4.102013252e-02f, 9.309899252e-02f, 2.665501872e-01f, 3.611669690e-01f,
+    3.066920830e-01f, 1.439344301e-01f, -1.212640714e-02f, -7.233626516e-02f, -3.919632881e-02f, 1.719658882e-02f,
+    3.579755879e-02f, 1.303248725e-02f, -1.439081627e-02f, -1.814920510e-02f, -2.866306886e-03f, 9.712095044e-03f,
+    8.225674381e-03f, -6.316834721e-04f, -5.371089192e-03f, -3.036707471e-03f, 1.146384177e-03f, 2.340226176e-03f,
+    7.925318499e-04f, -6.753880977e-04f, -7.178783497e-04f, -9.791056260e-05f, 1.958537989e-04f, 1.000053409e-04f,
+    1.910154653e-04f, 4.321739073e-05f, -5.468781747e-04f, -8.286603969e-04f, 2.425045973e-04f, 2.049561281e-03f,
+    1.893255473e-03f, -1.702188032e-03f, -5.273785662e-03f, -2.801658150e-03f, 5.807037010e-03f, 1.071413251e-02f,
+    1.993895411e-03f, -1.471718613e-02f, -1.836504846e-02f, 3.642768542e-03f, 3.210981617e-02f, 2.793478475e-02f,
+    -2.146756534e-02f, -6.982384940e-02f, -4.154555493e-02f, 9.202443887e-02f, 2.655908724e-01f, 3.610193257e-01f,
+    3.074678132e-01f, 1.450588355e-01f, -1.139863381e-02f, -7.230153995e-02f, -3.956036894e-02f, 1.692458723e-02f,
+    3.583654268e-02f, 1.323275737e-02f, -1.428015223e-02f, -1.820490772e-02f, -2.975211026e-03f, 9.675994002e-03f,
+    8.271123580e-03f, -5.800686369e-04f, -5.366121853e-03f, -3.064097531e-03f, 1.127028099e-03f, 2.343893075e-03f,
+    8.047069508e-04f, -6.706180956e-04f, -7.210170755e-04f, -1.013548788e-04f, 1.955952093e-04f, 1.009639037e-04f,
+    1.905953473e-04f, 4.574272411e-05f, -5.428726929e-04f, -8.304534485e-04f, 2.315058581e-04f, 2.041159538e-03f,
+    1.905544441e-03f, -1.673454819e-03f, -5.265093804e-03f, -2.841686200e-03f, 5.750923930e-03f, 1.072090794e-02f,
+    2.089928767e-03f, -1.462908596e-02f, -1.842290894e-02f, 3.447467260e-03f, 3.199518063e-02f, 2.811728124e-02f,
+    -2.108507818e-02f, -6.968833959e-02f, -4.206651248e-02f, 9.095165348e-02f, 2.646283370e-01f, 3.608654538e-01f,
+    3.082390176e-01f, 1.461835739e-01f, -1.066678400e-02f, -7.226290963e-02f, -3.992352548e-02f, 1.665089704e-02f,
+    3.587375776e-02f, 1.343287599e-02f, -1.416843845e-02f, -1.825980074e-02f, -3.084260520e-03f, 9.639274210e-03f,
+    8.316266687e-03f, -5.282597861e-04f, -5.360846853e-03f, -3.091417408e-03f, 1.107535418e-03f, 2.347443323e-03f,
+    8.168913157e-04f, -6.657842851e-04f, -7.241294156e-04f, -1.048157139e-04f, 1.953198148e-04f, 1.019234508e-04f,
+    1.901639443e-04f, 4.824706374e-05f, -5.388573212e-04f, -8.321877519e-04f, 2.205452610e-04f, 2.032678508e-03f,
+    1.917679710e-03f, -1.644734278e-03f, -5.256146053e-03f, -2.881433351e-03f, 5.694674013e-03f, 1.072709394e-02f,
+    2.185582410e-03f, -1.454045527e-02f, -1.847964562e-02f, 3.252512000e-03f, 3.187918798e-02f, 2.829778369e-02f,
+    -2.070269094e-02f, -6.954968833e-02f, -4.258300131e-02f, 8.988066414e-02f, 2.636626106e-01f, 3.607053583e-01f,
+    3.090056719e-01f, 1.473086136e-01f, -9.930869942e-03f, -7.222036131e-02f, -4.028577752e-02f, 1.637552718e-02f,
+    3.590919717e-02f, 1.363283226e-02f, -1.405567797e-02f, -1.831387906e-02f, -3.193449949e-03f, 9.601935880e-03f,
+    8.361100346e-03f, -4.762591516e-04f, -5.355263475e-03f, -3.118665328e-03f, 1.087906731e-03f, 2.350876240e-03f,
+    8.290842601e-04f, -6.608866544e-04f, -7.272150253e-04f, -1.082929285e-04f, 1.950275159e-04f, 1.028838969e-04f,
+    1.897213772e-04f, 5.073036543e-05f, -5.348323789e-04f, -8.338634929e-04f, 2.096232894e-04f, 2.024119015e-03f,
+    1.929661176e-03f, -1.616027974e-03f, -5.246943759e-03f, -2.920898312e-03f, 5.638290720e-03f, 1.073269187e-02f,
+    2.280852291e-03f, -1.445130022e-02f, -1.853525852e-02f, 3.057912003e-03f, 3.176184792e-02f, 2.847628862e-02f,
+    -2.032042243e-02f, -6.940791350e-02f, -4.309501775e-02f, 8.881149850e-02f, 2.626937230e-01f, 3.605390442e-01f,
+    3.097677520e-01f, 1.484339233e-01f, -9.190904008e-03f, -7.217388221e-02f, -4.064710409e-02f, 1.609848674e-02f,
+    3.594285416e-02f, 1.383261530e-02f, -1.394187395e-02f, -1.836713762e-02f, -3.302773869e-03f, 9.563979262e-03f,
+    8.405621209e-03f, -4.240689826e-04f, -5.349371013e-03f, -3.145839513e-03f, 1.068142645e-03f, 2.354191154e-03f,
+    8.412850960e-04f, -6.559251955e-04f, -7.302735600e-04f, -1.117863813e-04f, 1.947182138e-04f, 1.038451560e-04f,
+    1.892677672e-04f, 5.319258681e-05f, -5.307981844e-04f, -8.354808600e-04f, 1.987404226e-04f, 2.015481881e-03f,
+    1.941488745e-03f, -1.587337468e-03f, -5.237488283e-03f, -2.960079816e-03f, 5.581777511e-03f, 1.073770311e-02f,
+    2.375734392e-03f, -1.436162693e-02f, -1.858974774e-02f, 2.863676471e-03f, 3.164317023e-02f, 2.865279267e-02f,
+    -1.993829142e-02f, -6.926303310e-02f, -4.360255830e-02f, 8.774418414e-02f, 2.617217040e-01f, 3.603665171e-01f,
+    3.105252341e-01f, 1.495594714e-01f, -8.446898746e-03f, -7.212345966e-02f, -4.100748421e-02f, 1.581978487e-02f,
+    3.597472203e-02f, 1.403221424e-02f, -1.382702956e-02f, -1.841957137e-02f, -3.412226816e-03f, 9.525404637e-03f,
+    8.449825936e-03f, -3.716915458e-04f, -5.343168778e-03f, -3.172938182e-03f, 1.048243778e-03f, 2.357387395e-03f,
+    8.534931321e-04f, -6.508999046e-04f, -7.333046750e-04f, -1.152959291e-04f, 1.943918105e-04f, 1.048071416e-04f,
+    1.888032354e-04f, 5.563368728e-05f, -5.267550547e-04f, -8.370400449e-04f, 1.878971352e-04f, 2.006767931e-03f,
+    1.953162331e-03f, -1.558664312e-03f, -5.227780995e-03f, -2.998976612e-03f, 5.525137838e-03f, 1.074212909e-02f,
+    2.470224726e-03f, -1.427144157e-02f, -1.864311341e-02f, 2.669814558e-03f, 3.152316470e-02f, 2.882729258e-02f,
+    -1.955631659e-02f, -6.911506518e-02f, -4.410561961e-02f, 8.667874851e-02f, 2.607465832e-01f, 3.601877825e-01f,
+    3.112780942e-01f, 1.506852263e-01f, -7.698866871e-03f, -7.206908113e-02f, -4.136689689e-02f, 1.553943086e-02f,
+    3.600479417e-02f, 1.423161817e-02f, -1.371114806e-02f, -1.847117533e-02f, -3.521803302e-03f, 9.486212322e-03f,
+    8.493711192e-03f, -3.191291251e-04f, -5.336656096e-03f, -3.199959555e-03f, 1.028210757e-03f, 2.360464299e-03f,
+    8.657076738e-04f, -6.458107817e-04f, -7.363080258e-04f, -1.188214268e-04f, 1.940482084e-04f, 1.057697663e-04f,
+    1.883279031e-04f, 5.805362804e-05f, -5.227033061e-04f, -8.385412417e-04f, 1.770938972e-04f, 1.997977991e-03f,
+    1.964681858e-03f, -1.530010052e-03f, -5.217823274e-03f, -3.037587471e-03f, 5.468375153e-03f, 1.074597125e-02f,
+    2.564319340e-03f, -1.418075030e-02f, -1.869535573e-02f, 2.476335380e-03f, 3.140184117e-02f, 2.899978522e-02f,
+    -1.917451657e-02f, -6.896402789e-02f, -4.460419853e-02f, 8.561521897e-02f, 2.597683907e-01f, 3.600028461e-01f,
+    3.120263087e-01f, 1.518111565e-01f, -6.946821264e-03f, -7.201073420e-02f, -4.172532111e-02f, 1.525743409e-02f,
+    3.603306402e-02f, 1.443081616e-02f, -1.359423277e-02f, -1.852194450e-02f, -3.631497820e-03f, 9.446402668e-03f,
+    8.537273653e-03f, -2.663840217e-04f, -5.329832308e-03f, -3.226901848e-03f, 1.008044220e-03f, 2.363421205e-03f,
+    8.779280231e-04f, -6.406578312e-04f, -7.392832682e-04f, -1.223627271e-04f, 1.936873112e-04f, 1.067329424e-04f,
+    1.878418917e-04f, 6.045237205e-05f, -5.186432537e-04f, -8.399846477e-04f, 1.663311743e-04f, 1.989112888e-03f,
+    1.976047260e-03f, -1.501376229e-03f, -5.207616510e-03f, -3.075911183e-03f, 5.411492906e-03f, 1.074923107e-02f,
+    2.658014311e-03f, -1.408955929e-02f, -1.874647496e-02f, 2.283248004e-03f, 3.127920952e-02f, 2.917026755e-02f,
+    -1.879290994e-02f, -6.880993943e-02f, -4.509829206e-02f, 8.455362279e-02f, 2.587871565e-01f, 3.598117139e-01f,
+    3.127698540e-01f, 1.529372301e-01f, -6.190774970e-03f, -7.194840659e-02f, -4.208273583e-02f, 1.497380406e-02f,
+    3.605952512e-02f, 1.462979728e-02f, -1.347628708e-02f, -1.857187396e-02f, -3.741304841e-03f, 9.405976060e-03f,
+    8.580510003e-03f, -2.134585539e-04f, -5.322696770e-03f, -3.253763277e-03f, 9.877448144e-04f, 2.366257457e-03f,
+    8.901534786e-04f, -6.354410611e-04f, -7.422300578e-04f, -1.259196810e-04f, 1.933090228e-04f, 1.076965812e-04f,
+    1.873453229e-04f, 6.282988405e-05f, -5.145752115e-04f, -8.413704627e-04f, 1.556094277e-04f, 1.980173450e-03f,
+    1.987258478e-03f, -1.472764377e-03f, -5.197162102e-03f, -3.113946557e-03f, 5.354494540e-03f, 1.075191005e-02f,
+    2.751305749e-03f, -1.399787475e-02f, -1.879647141e-02f, 2.090561456e-03f, 3.115527967e-02f, 2.933873664e-02f,
+    -1.841151519e-02f, -6.865281810e-02f, -4.558789738e-02f, 8.349398710e-02f, 2.578029107e-01f, 3.596143920e-01f,
+    3.135087069e-01f, 1.540634156e-01f, -5.430741200e-03f, -7.188208612e-02f, -4.243911999e-02f, 1.468855037e-02f,
+    3.608417106e-02f, 1.482855056e-02f, -1.335731443e-02f, -1.862095879e-02f, -3.851218813e-03f, 9.364932919e-03f,
+    8.623416931e-03f, -1.603550570e-04f, -5.315248855e-03f, -3.280542056e-03f, 9.673131982e-04f, 2.368972405e-03f,
+    9.023833357e-04f, -6.301604840e-04f, -7.451480506e-04f, -1.294921374e-04f, 1.929132483e-04f, 1.086605936e-04f,
+    1.868383181e-04f, 6.518613054e-05f, -5.104994925e-04f, -8.426988894e-04f, 1.449291138e-04f, 1.971160506e-03f,
+    1.998315464e-03f, -1.444176022e-03f, -5.186461459e-03f, -3.151692423e-03f, 5.297383496e-03f, 1.075400971e-02f,
+    2.844189797e-03f, -1.390570287e-02f, -1.884534547e-02f, 1.898284716e-03f, 3.103006159e-02f, 2.950518967e-02f,
+    -1.803035076e-02f, -6.849268225e-02f, -4.607301183e-02f, 8.243633895e-02f, 2.568156833e-01f, 3.594108869e-01f,
+    3.142428439e-01f, 1.551896811e-01f, -4.666733334e-03f, -7.181176074e-02f, -4.279445254e-02f, 1.440168273e-02f,
+    3.610699552e-02f, 1.502706502e-02f, -1.323731831e-02f, -1.866919412e-02f, -3.961234166e-03f, 9.323273698e-03f,
+    8.665991137e-03f, -1.070758835e-04f, -5.307487951e-03f, -3.307236397e-03f, 9.467500390e-04f, 2.371565402e-03f,
+    9.146168868e-04f, -6.248161162e-04f, -7.480369027e-04f, -1.330799434e-04f, 1.924998934e-04f, 1.096248897e-04f,
+    1.863209992e-04f, 6.752107978e-05f, -5.064164085e-04f, -8.439701332e-04f, 1.342906848e-04f, 1.962074888e-03f,
+    2.009218179e-03f, -1.415612684e-03f, -5.175515996e-03f, -3.189147629e-03f, 5.240163210e-03f, 1.075553161e-02f,
+    2.936662630e-03f, -1.381304984e-02f, -1.889309756e-02f, 1.706426721e-03f, 3.090356528e-02f, 2.966962393e-02f,
+    -1.764943502e-02f, -6.832955031e-02f, -4.655363292e-02f, 8.138070529e-02f, 2.558255046e-01f, 3.592012050e-01f,
+    3.149722420e-01f, 1.563159950e-01f, -3.898764913e-03f, -7.173741855e-02f, -4.314871238e-02f, 1.411321095e-02f,
+    3.612799225e-02f, 1.522532967e-02f, -1.311630232e-02f, -1.871657509e-02f, -4.071345309e-03f, 9.280998888e-03f,
+    8.708229330e-03f, -5.362340243e-05f, -5.299413459e-03f, -3.333844511e-03f, 9.260560148e-04f, 2.374035807e-03f,
+    9.268534207e-04f, -6.194079782e-04f, -7.508962705e-04f, -1.366829440e-04f, 1.920688647e-04f, 1.105893791e-04f,
+    1.857934878e-04f, 6.983470176e-05f, -5.023262702e-04f, -8.451844022e-04f, 1.236945882e-04f, 1.952917427e-03f,
+    2.019966594e-03f, -1.387075878e-03f, -5.164327142e-03f, -3.226311045e-03f, 5.182837116e-03f, 1.075647734e-02f,
+    3.028720455e-03f, -1.371992189e-02f, -1.893972818e-02f, 1.514996361e-03f, 3.077580077e-02f, 2.983203681e-02f,
+    -1.726878628e-02f, -6.816344079e-02f, -4.702975833e-02f, 8.032711293e-02f, 2.548324049e-01f, 3.589853532e-01f,
+    3.156968782e-01f, 1.574423252e-01f, -3.126849644e-03f, -7.165904775e-02f, -4.350187842e-02f, 1.382314495e-02f,
+    3.614715508e-02f, 1.542333351e-02f, -1.299427006e-02f, -1.876309689e-02f, -4.181546628e-03f, 9.238109012e-03f,
+    8.750128227e-03f, 4.616459898e-18f, -5.291024800e-03f, -3.360364609e-03f, 9.052318134e-04f, 2.376382981e-03f,
+    9.390922233e-04f, -6.139360948e-04f, -7.537258104e-04f, -1.403009823e-04f, 1.916200694e-04f, 1.115539706e-04f,
+    1.852559057e-04f, 7.212696824e-05f, -4.982293872e-04f, -8.463419070e-04f, 1.131412669e-04f, 1.943688954e-03f,
+    2.030560686e-03f, -1.358567110e-03f, -5.152896333e-03f, -3.263181559e-03f, 5.125408642e-03f, 1.075684851e-02f,
+    3.120359512e-03f, -1.362632525e-02f, -1.898523788e-02f, 1.324002480e-03f, 3.064677814e-02f, 2.999242582e-02f,
+    -1.688842277e-02f, -6.799437226e-02f, -4.750138592e-02f, 7.927558860e-02f, 2.538364145e-01f, 3.587633384e-01f,
+    3.164167296e-01f, 1.585686401e-01f, -2.351001401e-03f, -7.157663666e-02f, -4.385392953e-02f, 1.353149476e-02f,
+    3.616447790e-02f, 1.562106550e-02f, -1.287122525e-02f, -1.880875475e-02f, -4.291832494e-03f, 9.194604628e-03f,
+    8.791684553e-03f, 5.379192104e-05f, -5.282321407e-03f, -3.386794901e-03f, 8.842781328e-04f, 2.378606294e-03f,
+    9.513325773e-04f, -6.084004949e-04f, -7.565251793e-04f, -1.439338995e-04f, 1.911534158e-04f, 1.125185726e-04f,
+    1.847083750e-04f, 7.439785270e-05f, -4.941260679e-04f, -8.474428612e-04f, 1.026311592e-04f, 1.934390305e-03f,
+    2.041000444e-03f, -1.330087881e-03f, -5.141225011e-03f, -3.299758079e-03f, 5.067881210e-03f, 1.075664675e-02f,
+    3.211576075e-03f, -1.353226614e-02f, -1.902962726e-02f, 1.133453879e-03f, 3.051650751e-02f, 3.015078858e-02f,
+    -1.650836267e-02f, -6.782236336e-02f, -4.796851371e-02f, 7.822615892e-02f, 2.528375640e-01f, 3.585351677e-01f,
+    3.171317736e-01f, 1.596949076e-01f, -1.571234218e-03f, -7.149017376e-02f, -4.420484459e-02f, 1.323827051e-02f,
+    3.617995470e-02f, 1.581851460e-02f, -1.274717163e-02f, -1.885354391e-02f, -4.402197252e-03f, 9.150486331e-03f,
+    8.832895043e-03f, 1.077499412e-04f, -5.273302731e-03f, -3.413133593e-03f, 8.631956812e-04f, 2.380705119e-03f,
+    9.635737622e-04f, -6.028012113e-04f, -7.592940342e-04f, -1.475815348e-04f, 1.906688129e-04f, 1.134830926e-04f,
+    1.841510174e-04f, 7.664733036e-05f, -4.900166195e-04f, -8.484874807e-04f, 9.216469906e-05f, 1.925022312e-03f,
+    2.051285866e-03f, -1.301639682e-03f, -5.129314632e-03f, -3.336039533e-03f, 5.010258241e-03f, 1.075587372e-02f,
+    3.302366449e-03f, -1.343775080e-02f, -1.907289698e-02f, 9.433593083e-04f, 3.038499902e-02f, 3.030712278e-02f,
+    -1.612862407e-02f, -6.764743281e-02f, -4.843113989e-02f, 7.717885037e-02f, 2.518358837e-01f, 3.583008484e-01f,
+    3.178419877e-01f, 1.608210958e-01f, -7.875622963e-04f, -7.139964762e-02f, -4.455460247e-02f, 1.294348245e-02f,
+    3.619357952e-02f, 1.601566977e-02f, -1.262211304e-02f, -1.889745965e-02f, -4.512635233e-03f, 9.105754750e-03f,
+    8.873756444e-03f, 1.618716246e-04f, -5.263968239e-03f, -3.439378893e-03f, 8.419851764e-04f, 2.382678832e-03f,
+    9.758150546e-04f, -5.971382814e-04f, -7.620320327e-04f, -1.512437255e-04f, 1.901661705e-04f, 1.144474378e-04f,
+    1.835839549e-04f, 7.887537814e-05f, -4.859013480e-04f, -8.494759842e-04f, 8.174231564e-05f, 1.915585811e-03f,
+    2.061416958e-03f, -1.273224001e-03f, -5.117166657e-03f, -3.372024870e-03f, 4.952543148e-03f, 1.075453112e-02f,
+    3.392726974e-03f, -1.334278550e-02f, -1.911504777e-02f, 7.537274759e-04f, 3.025226286e-02f, 3.046142628e-02f,
+    -1.574922502e-02f, -6.746959939e-02f, -4.888926281e-02f, 7.613368935e-02f, 2.508314043e-01f, 3.580603882e-01f,
+    3.185473493e-01f, 1.619471728e-01f, 1.357229102e-17f, -7.130504697e-02f, -4.490318199e-02f, 1.264714091e-02f,
+    3.620534651e-02f, 1.621251992e-02f, -1.249605335e-02f, -1.894049730e-02f, -4.623140745e-03f, 9.060410547e-03f,
+    8.914265509e-03f, 2.161545186e-04f, -5.254317413e-03f, -3.465529008e-03f, 8.206473467e-04f, 2.384526817e-03f,
+    9.880557279e-04f, -5.914117464e-04f, -7.647388323e-04f, -1.549203071e-04f, 1.896453993e-04f, 1.154115145e-04f,
+    1.830073094e-04f, 8.108197469e-05f, -4.817805583e-04f, -8.504085929e-04f, 7.136443358e-05f, 1.906081638e-03f,
+    2.071393734e-03f, -1.244842317e-03f, -5.104782557e-03f, -3.407713057e-03f, 4.894739340e-03f, 1.075262066e-02f,
+    3.482654021e-03f, -1.324737647e-02f, -1.915608040e-02f, 5.645670405e-04f, 3.011830926e-02f, 3.061369698e-02f,
+    -1.537018347e-02f, -6.728888194e-02f, -4.934288100e-02f, 7.509070214e-02f, 2.498241564e-01f, 3.578137948e-01f,
+    3.192478363e-01f, 1.630731065e-01f, 7.914381439e-04f, -7.120636066e-02f, -4.525056202e-02f, 1.234925636e-02f,
+    3.621524987e-02f, 1.640905398e-02f, -1.236899650e-02f, -1.898265222e-02f, -4.733708080e-03f, 9.014454422e-03f,
+    8.954419003e-03f, 2.705961545e-04f, -5.244349752e-03f, -3.491582144e-03f, 7.991829302e-04f, 2.386248462e-03f,
+    1.000295053e-03f, -5.856216521e-04f, -7.674140913e-04f, -1.586111128e-04f, 1.891064110e-04f, 1.163752286e-04f,
+    1.824212030e-04f, 8.326710037e-05f, -4.776545540e-04f, -8.512855305e-04f, 6.103147294e-05f, 1.896510630e-03f,
+    2.081216220e-03f, -1.216496100e-03f, -5.092163812e-03f, -3.443103080e-03f, 4.836850222e-03f, 1.075014407e-02f,
+    3.572143996e-03f, -1.315152998e-02f, -1.919599571e-02f, 3.758866144e-04f, 2.998314846e-02f, 3.076393294e-02f,
+    -1.499151732e-02f, -6.710529938e-02f, -4.979199315e-02f, 7.404991489e-02f, 2.488141707e-01f, 3.575610761e-01f,
+    3.199434265e-01f, 1.641988650e-01f, 1.586737445e-03f, -7.110357765e-02f, -4.559672137e-02f, 1.204983934e-02f,
+    3.622328390e-02f, 1.660526085e-02f, -1.224094652e-02f, -1.902391978e-02f, -4.844331509e-03f, 8.967887108e-03f,
+    8.994213699e-03f, 3.251940470e-04f, -5.234064770e-03f, -3.517536506e-03f, 7.775926750e-04f, 2.387843159e-03f,
+    1.012532296e-03f, -5.797680481e-04f, -7.700574680e-04f, -1.623159742e-04f, 1.885491179e-04f, 1.173384852e-04f,
+    1.818257576e-04f, 8.543073724e-05f, -4.735236375e-04f, -8.521070232e-04f, 5.074384914e-05f, 1.886873622e-03f,
+    2.090884448e-03f, -1.188186816e-03f, -5.079311908e-03f, -3.478193947e-03f, 4.778879191e-03f, 1.074710314e-02f,
+    3.661193338e-03f, -1.305525230e-02f, -1.923479459e-02f, 1.876947620e-04f, 2.984679076e-02f, 3.091213230e-02f,
+    -1.461324440e-02f, -6.691887067e-02f, -5.023659813e-02f, 7.301135367e-02f, 2.478014780e-01f, 3.573022402e-01f,
+    3.206340980e-01f, 1.653244160e-01f, 2.385883051e-03f, -7.099668706e-02f, -4.594163886e-02f, 1.174890052e-02f,
+    3.622944295e-02f, 1.680112942e-02f, -1.211190746e-02f, -1.906429541e-02f, -4.955005284e-03f, 8.920709374e-03f,
+    9.033646384e-03f, 3.799456948e-04f, -5.223461999e-03f, -3.543390298e-03f, 7.558773392e-04f, 2.389310307e-03f,
+    1.024766723e-03f, -5.738509887e-04f, -7.726686213e-04f, -1.660347208e-04f, 1.879734334e-04f, 1.183011889e-04f,
+    1.812210952e-04f, 8.757286903e-05f, -4.693881099e-04f, -8.528732999e-04f, 4.050197302e-05f, 1.877171454e-03f,
+    2.100398460e-03f, -1.159915923e-03f, -5.066228342e-03f, -3.512984685e-03f, 4.720829641e-03f, 1.074349965e-02f,
+    3.749798519e-03f, -1.295854971e-02f, -1.927247798e-02f, 9.666982960e-18f, 2.970924649e-02f, 3.105829332e-02f,
+    -1.423538244e-02f, -6.672961488e-02f, -5.067669497e-02f, 7.197504440e-02f, 2.467861090e-01f, 3.570372954e-01f,
+    3.213198290e-01f, 1.664497276e-01f, 3.188859946e-03f, -7.088567813e-02f, -4.628529330e-02f, 1.144645066e-02f,
+    3.623372148e-02f, 1.699664857e-02f, -1.198188347e-02f, -1.910377458e-02f, -5.065723642e-03f, 8.872922025e-03f,
+    9.072713852e-03f, 4.348485804e-04f, -5.212540986e-03f, -3.569141726e-03f, 7.340376911e-04f, 2.390649309e-03f,
+    1.036997594e-03f, -5.678705320e-04f, -7.752472106e-04f, -1.697671802e-04f, 1.873792719e-04f, 1.192632438e-04f,
+    1.806073376e-04f, 8.969348117e-05f, -4.652482710e-04f, -8.535845918e-04f, 3.030625077e-05f, 1.867404964e-03f,
+    2.109758307e-03f, -1.131684870e-03f, -5.052914618e-03f, -3.547474340e-03f, 4.662704959e-03f, 1.073933542e-02f,
+    3.837956044e-03f, -1.286142849e-02f, -1.930904690e-02f, -1.871892031e-04f, 2.957052599e-02f, 3.120241434e-02f,
+    -1.385794914e-02f, -6.653755109e-02f, -5.111228285e-02f, 7.094101289e-02f, 2.457680947e-01f, 3.567662503e-01f,
+    3.220005977e-01f, 1.675747676e-01f, 3.995652954e-03f, -7.077054022e-02f, -4.662766350e-02f, 1.114250064e-02f,
+    3.623611402e-02f, 1.719180718e-02f, -1.185087873e-02f, -1.914235276e-02f, -5.176480798e-03f, 8.824525900e-03f,
+    9.111412910e-03f, 4.899001703e-04f, -5.201301295e-03f, -3.594788993e-03f, 7.120745088e-04f, 2.391859574e-03f,
+    1.049224170e-03f, -5.618267408e-04f, -7.777928956e-04f, -1.735131782e-04f, 1.867665484e-04f, 1.202245532e-04f,
+    1.799846068e-04f, 9.179256077e-05f, -4.611044194e-04f, -8.542411324e-04f, 2.015708400e-05f, 1.857574990e-03f,
+    2.118964049e-03f, -1.103495101e-03f, -5.039372248e-03f, -3.581661978e-03f, 4.604508526e-03f, 1.073461229e-02f,
+    3.925662454e-03f, -1.276389492e-02f, -1.934450239e-02f, -3.738644272e-04f, 2.943063967e-02f, 3.134449384e-02f,
+    -1.348096210e-02f, -6.634269848e-02f, -5.154336115e-02f, 6.990928487e-02f, 2.447474661e-01f, 3.564891136e-01f,
+    3.226763827e-01f, 1.686995039e-01f, 4.806246736e-03f, -7.065126284e-02f, -4.696872826e-02f, 1.083706143e-02f,
+    3.623661517e-02f, 1.738659409e-02f, -1.171889751e-02f, -1.918002550e-02f, -5.287270953e-03f, 8.775521873e-03f,
+    9.149740373e-03f, 5.450979151e-04f, -5.189742506e-03f, -3.620330304e-03f, 6.899885804e-04f, 2.392940515e-03f,
+    1.061445705e-03f, -5.557196819e-04f, -7.803053365e-04f, -1.772725385e-04f, 1.861351791e-04f, 1.211850201e-04f,
+    1.793530247e-04f, 9.387009661e-05f, -4.569568525e-04f, -8.548431579e-04f, 1.005486963e-05f, 1.847682371e-03f,
+    2.128015755e-03f, -1.075348050e-03f, -5.025602751e-03f, -3.615546686e-03f, 4.546243718e-03f, 1.072933213e-02f,
+    4.012914322e-03f, -1.266595529e-02f, -1.937884558e-02f, -5.600173013e-04f, 2.928959793e-02f, 3.148453038e-02f,
+    -1.310443885e-02f, -6.614507628e-02f, -5.196992939e-02f, 6.887988590e-02f, 2.437242541e-01f, 3.562058942e-01f,
+    3.233471626e-01f, 1.698239042e-01f, 5.620625791e-03f, -7.052783563e-02f, -4.730846636e-02f, 1.053014410e-02f,
+    3.623521962e-02f, 1.758099815e-02f, -1.158594413e-02f, -1.921678836e-02f, -5.398088287e-03f, 8.725910856e-03f,
+    9.187693072e-03f, 6.004392495e-04f, -5.177864216e-03f, -3.645763863e-03f, 6.677807039e-04f, 2.393891553e-03f,
+    1.073661453e-03f, -5.495494264e-04f, -7.827841941e-04f, -1.810450829e-04f, 1.854850811e-04f, 1.221445466e-04f,
+    1.787127130e-04f, 9.592607911e-05f, -4.528058662e-04f, -8.553909068e-04f, 1.207104220e-18f, 1.837727947e-03f,
+    2.136913501e-03f, -1.047245146e-03f, -5.011607656e-03f, -3.649127568e-03f, 4.487913902e-03f, 1.072349684e-02f,
+    4.099708254e-03f, -1.256761591e-02f, -1.941207763e-02f, -7.456395033e-04f, 2.914741123e-02f, 3.162252264e-02f,
+    -1.272839686e-02f, -6.594470377e-02f, -5.239198727e-02f, 6.785284146e-02f, 2.426984898e-01f, 3.559166012e-01f,
+    3.240129163e-01f, 1.709479363e-01f, 6.438774460e-03f, -7.040024835e-02f, -4.764685660e-02f, 1.022175986e-02f,
+    3.623192213e-02f, 1.777500821e-02f, -1.145202297e-02f, -1.925263693e-02f, -5.508926966e-03f, 8.675693792e-03f,
+    9.225267844e-03f, 6.559215926e-04f, -5.165666038e-03f, -3.671087873e-03f, 6.454516875e-04f, 2.394712112e-03f,
+    1.085870663e-03f, -5.433160499e-04f, -7.852291297e-04f, -1.848306314e-04f, 1.848161722e-04f, 1.231030344e-04f,
+    1.780637936e-04f, 9.796050038e-05f, -4.486517551e-04f, -8.558846199e-04f, -1.000713724e-05f, 1.827712558e-03f,
+    2.145657374e-03f, -1.019187810e-03f, -4.997388499e-03f, -3.682403750e-03f, 4.429522442e-03f, 1.071710833e-02f,
+    4.186040892e-03f, -1.246888307e-02f, -1.944419977e-02f, -9.307227605e-04f, 2.900409006e-02f, 3.175846940e-02f,
+    -1.235285350e-02f, -6.574160031e-02f, -5.280953466e-02f, 6.682817690e-02f, 2.416702043e-01f, 3.556212438e-01f,
+    3.246736225e-01f, 1.720715681e-01f, 7.260676921e-03f, -7.026849091e-02f, -4.798387776e-02f, 9.911919970e-03f,
+    3.622671757e-02f, 1.796861309e-02f, -1.131713848e-02f, -1.928756686e-02f, -5.619781138e-03f, 8.624871664e-03f,
+    9.262461541e-03f, 7.115423478e-04f, -5.153147603e-03f, -3.696300540e-03f, 6.230023491e-04f, 2.395401623e-03f,
+    1.098072584e-03f, -5.370196322e-04f, -7.876398050e-04f, -1.886290020e-04f, 1.841283716e-04f, 1.240603846e-04f,
+    1.774063880e-04f, 9.997335412e-05f, -4.444948126e-04f, -8.563245404e-04f, -1.996615905e-05f, 1.817637044e-03f,
+    2.154247468e-03f, -9.911774532e-04f, -4.982946822e-03f, -3.715374378e-03f, 4.371072694e-03f, 1.071016856e-02f,
+    4.271908910e-03f, -1.236976308e-02f, -1.947521329e-02f, -1.115258850e-03f, 2.885964492e-02f, 3.189236954e-02f,
+    -1.197782609e-02f, -6.553578529e-02f, -5.322257158e-02f, 6.580591744e-02f, 2.406394289e-01f, 3.553198317e-01f,
+    3.253292604e-01f, 1.731947672e-01f, 8.086317192e-03f, -7.013255335e-02f, -4.831950863e-02f, 9.600635835e-03f,
+    3.621960087e-02f, 1.816180160e-02f, -1.118129516e-02f, -1.932157383e-02f, -5.730644933e-03f, 8.573445489e-03f,
+    9.299271026e-03f, 7.672989028e-04f, -5.140308558e-03f, -3.721400067e-03f, 6.004335165e-04f, 2.395959521e-03f,
+    1.110266461e-03f, -5.306602575e-04f, -7.900158826e-04f, -1.924400108e-04f, 1.834215991e-04f, 1.250164978e-04f,
+    1.767406179e-04f, 1.019646357e-04f, -4.403353305e-04f, -8.567109136e-04f, -2.987668707e-05f, 1.807502246e-03f,
+    2.162683886e-03f, -9.632154818e-04f, -4.968284175e-03f, -3.748038614e-03f, 4.312568007e-03f, 1.070267947e-02f,
+    4.357309019e-03f, -1.227026224e-02f, -1.950511951e-02f, -1.299239599e-03f, 2.871408636e-02f, 3.202422207e-02f,
+    -1.160333187e-02f, -6.532727819e-02f, -5.363109822e-02f, 6.478608819e-02f, 2.396061947e-01f, 3.550123744e-01f,
+    3.259798093e-01f, 1.743175014e-01f, 8.915679134e-03f, -6.999242585e-02f, -4.865372798e-02f, 9.287918946e-03f,
+    3.621056704e-02f, 1.835456256e-02f, -1.104449758e-02f, -1.935465354e-02f, -5.841512465e-03f, 8.521416317e-03f,
+    9.335693173e-03f, 8.231886302e-04f, -5.127148567e-03f, -3.746384659e-03f, 5.777460278e-04f, 2.396385247e-03f,
+    1.122451535e-03f, -5.242380143e-04f, -7.923570254e-04f, -1.962634720e-04f, 1.826957756e-04f, 1.259712739e-04f,
+    1.760666049e-04f, 1.039343422e-04f, -4.361735996e-04f, -8.570439874e-04f, -3.973834758e-05f, 1.797309003e-03f,
+    2.170966741e-03f, -9.353032931e-04f, -4.953402118e-03f, -3.780395645e-03f, 4.254011723e-03f, 1.069464308e-02f,
+    4.442237961e-03f, -1.217038687e-02f, -1.953391984e-02f, -1.482656885e-03f, 2.856742495e-02f, 3.215402607e-02f,
+    -1.122938799e-02f, -6.511609853e-02f, -5.403511495e-02f, 6.376871414e-02f, 2.385705330e-01f, 3.546988819e-01f,
+    3.266252486e-01f, 1.754397384e-01f, 9.748746447e-03f, -6.984809872e-02f, -4.898651459e-02f, 8.973780900e-03f,
+    3.619961118e-02f, 1.854688478e-02f, -1.090675038e-02f, -1.938680175e-02f, -5.952377835e-03f, 8.468785237e-03f,
+    9.371724870e-03f, 8.792088870e-04f, -5.113667311e-03f, -3.771252523e-03f, 5.549407304e-04f, 2.396678250e-03f,
+    1.134627047e-03f, -5.177529955e-04f, -7.946628971e-04f, -2.000991979e-04f, 1.819508231e-04f, 1.269246123e-04f,
+    1.753844702e-04f, 1.058824721e-04f, -4.320099091e-04f, -8.573240118e-04f, -4.955077154e-05f, 1.787058157e-03f,
+    2.179096153e-03f, -9.074422767e-04f, -4.938302214e-03f, -3.812444674e-03f, 4.195407177e-03f, 1.068606139e-02f,
+    4.526692514e-03f, -1.207014329e-02f, -1.956161571e-02f, -1.665502635e-03f, 2.841967129e-02f, 3.228178074e-02f,
+    -1.085601153e-02f, -6.490226588e-02f, -5.443462230e-02f, 6.275382015e-02f, 2.375324752e-01f, 3.543793641e-01f,
+    3.272655578e-01f, 1.765614458e-01f, 1.058550267e-02f, -6.969956241e-02f, -4.931784725e-02f, 8.658233395e-03f,
+    3.618672847e-02f, 1.873875705e-02f, -1.076805824e-02f, -1.941801425e-02f, -6.063235123e-03f, 8.415553373e-03f,
+    9.407363015e-03f, 9.353570150e-04f, -5.099864487e-03f, -3.796001863e-03f, 5.320184821e-04f, 2.396837982e-03f,
+    1.146792233e-03f, -5.112052984e-04f, -7.969331621e-04f, -2.039469988e-04f, 1.811866645e-04f, 1.278764120e-04f,
+    1.746943353e-04f, 1.078090257e-04f, -4.278445467e-04f, -8.575512391e-04f, -5.931359456e-05f, 1.776750548e-03f,
+    2.187072251e-03f, -8.796338147e-04f, -4.922986036e-03f, -3.844184925e-03f, 4.136757698e-03f, 1.067693644e-02f,
+    4.610669491e-03f, -1.196953781e-02f, -1.958820863e-02f, -1.847768830e-03f, 2.827083600e-02f, 3.240748539e-02f,
+    -1.048321950e-02f, -6.468579987e-02f, -5.482962095e-02f, 6.174143097e-02f, 2.364920527e-01f, 3.540538314e-01f,
+    3.279007166e-01f, 1.776825914e-01f, 1.142593119e-02f, -6.954680751e-02f, -4.964770474e-02f, 8.341288235e-03f,
+    3.617191418e-02f, 1.893016816e-02f, -1.062842592e-02f, -1.944828686e-02f, -6.174078399e-03f, 8.361721882e-03f,
+    9.442604520e-03f, 9.916303410e-04f, -5.085739811e-03f, -3.820630887e-03f, 5.089801503e-04f, 2.396863902e-03f,
+    1.158946328e-03f, -5.045950246e-04f, -7.991674852e-04f, -2.078066833e-04f, 1.804032237e-04f, 1.288265713e-04f,
+    1.739963213e-04f, 1.097140049e-04f, -4.236777989e-04f, -8.577259236e-04f, -6.902645692e-05f, 1.766387017e-03f,
+    2.194895172e-03f, -8.518792811e-04f, -4.907455165e-03f, -3.875615640e-03f, 4.078066605e-03f, 1.066727030e-02f,
+    4.694165738e-03f, -1.186857674e-02f, -1.961370014e-02f, -2.029447498e-03f, 2.812092973e-02f, 3.253113943e-02f,
+    -1.011102882e-02f, -6.446672020e-02f, -5.522011176e-02f, 6.073157121e-02f, 2.354492969e-01f, 3.537222942e-01f,
+    3.285307050e-01f, 1.788031428e-01f, 1.227001522e-02f, -6.938982474e-02f, -4.997606583e-02f, 8.022957321e-03f,
+    3.615516367e-02f, 1.912110689e-02f, -1.048785825e-02f, -1.947761545e-02f, -6.284901712e-03f, 8.307291961e-03f,
+    9.477446311e-03f, 1.048026177e-03f, -5.071293014e-03f, -3.845137803e-03f, 4.858266123e-04f, 2.396755474e-03f,
+    1.171088563e-03f, -4.979222802e-04f, -8.013655322e-04f, -2.116780580e-04f, 1.796004257e-04f, 1.297749878e-04f,
+    1.732905493e-04f, 1.115974130e-04f, -4.195099506e-04f, -8.578483219e-04f, -7.868900358e-05f, 1.755968405e-03f,
+    2.202565063e-03f, -8.241800419e-04f, -4.891711185e-03f, -3.906736082e-03f, 4.019337211e-03f, 1.065706506e-02f,
+    4.777178135e-03f, -1.176726642e-02f, -1.963809187e-02f, -2.210530722e-03f, 2.796996316e-02f, 3.265274236e-02f,
+    -9.739456350e-03f, -6.424504659e-02f, -5.560609574e-02f, 5.972426536e-02f, 2.344042393e-01f, 3.533847632e-01f,
+    3.291555028e-01f, 1.799230676e-01f, 1.311773784e-02f, -6.922860497e-02f, -5.030290932e-02f, 7.703252661e-03f,
+    3.613647237e-02f, 1.931156203e-02f, -1.034636008e-02f, -1.950599593e-02f, -6.395699101e-03f, 8.252264838e-03f,
+    9.511885324e-03f, 1.104541819e-03f, -5.056523846e-03f, -3.869520817e-03f, 4.625587552e-04f, 2.396512169e-03f,
+    1.183218168e-03f, -4.911871757e-04f, -8.035269696e-04f, -2.155609275e-04f, 1.787781965e-04f, 1.307215590e-04f,
+    1.725771403e-04f, 1.134592550e-04f, -4.153412856e-04f, -8.579186930e-04f, -8.830088417e-05f, 1.745495551e-03f,
+    2.210082077e-03f, -7.965374554e-04f, -4.875755689e-03f, -3.937545535e-03f, 3.960572823e-03f, 1.064632282e-02f,
+    4.859703600e-03f, -1.166561317e-02f, -1.966138546e-02f, -2.391010634e-03f, 2.781794701e-02f, 3.277229382e-02f,
+    -9.368518849e-03f, -6.402079885e-02f, -5.598757409e-02f, 5.871953779e-02f, 2.333569115e-01f, 3.530412491e-01f,
+    3.297750904e-01f, 1.810423334e-01f, 1.396908196e-02f, -6.906313921e-02f, -5.062821399e-02f, 7.382186361e-03f,
+    3.611583580e-02f, 1.950152234e-02f, -1.020393638e-02f, -1.953342424e-02f, -6.506464588e-03f, 8.196641781e-03f,
+    9.545918511e-03f, 1.161174549e-03f, -5.041432074e-03f, -3.893778141e-03f, 4.391774761e-04f, 2.396133463e-03f,
+    1.195334371e-03f, -4.843898260e-04f, -8.056514645e-04f, -2.194550947e-04f, 1.779364633e-04f, 1.316661815e-04f,
+    1.718562149e-04f, 1.152995376e-04f, -4.111720858e-04f, -8.579372975e-04f, -9.786175300e-05f, 1.734969298e-03f,
+    2.217446378e-03f, -7.689528716e-04f, -4.859590279e-03f, -3.968043299e-03f, 3.901776736e-03f, 1.063504572e-02f,
+    4.941739082e-03f, -1.156362331e-02f, -1.968358263e-02f, -2.570879420e-03f, 2.766489199e-02f, 3.288979350e-02f,
+    -8.998233010e-03f, -6.379399681e-02f, -5.636454815e-02f, 5.771741275e-02f, 2.323073450e-01f, 3.526917631e-01f,
+    3.303894480e-01f, 1.821609079e-01f, 1.482403033e-02f, -6.889341860e-02f, -5.095195865e-02f, 7.059770629e-03f,
+    3.609324957e-02f, 1.969097660e-02f, -1.006059213e-02f, -1.955989636e-02f, -6.617192180e-03f, 8.140424092e-03f,
+    9.579542835e-03f, 1.217921636e-03f, -5.026017481e-03f, -3.917907984e-03f, 4.156836817e-04f, 2.395618839e-03f,
+    1.207436395e-03f, -4.775303505e-04f, -8.077386850e-04f, -2.233603606e-04f, 1.770751540e-04f, 1.326087516e-04f,
+    1.711278939e-04f, 1.171182689e-04f, -4.070026319e-04f, -8.579043986e-04f, -1.073712691e-04f, 1.724390484e-03f,
+    2.224658136e-03f, -7.414276328e-04f, -4.843216559e-03f, -3.998228697e-03f, 3.842952241e-03f, 1.062323592e-02f,
+    5.023281566e-03f, -1.146130317e-02f, -1.970468516e-02f, -2.750129318e-03f, 2.751080887e-02f, 3.300524125e-02f,
+    -8.628615441e-03f, -6.356466037e-02f, -5.673701943e-02f, 5.671791435e-02f, 2.312555715e-01f, 3.523363162e-01f,
+    3.309985563e-01f, 1.832787585e-01f, 1.568256554e-02f, -6.871943442e-02f, -5.127412208e-02f, 6.736017775e-03f,
+    3.606870938e-02f, 1.987991357e-02f, -9.916332403e-03f, -1.958540833e-02f, -6.727875872e-03f, 8.083613108e-03f,
+    9.612755275e-03f, 1.274780331e-03f, -5.010279869e-03f, -3.941908559e-03f, 3.920782884e-04f, 2.394967785e-03f,
+    1.219523464e-03f, -4.706088730e-04f, -8.097882998e-04f, -2.272765242e-04f, 1.761941981e-04f, 1.335491649e-04f,
+    1.703922976e-04f, 1.189154587e-04f, -4.028332032e-04f, -8.578202613e-04f, -1.168290960e-04f, 1.713759950e-03f,
+    2.231717531e-03f, -7.139630727e-04f, -4.826636143e-03f, -4.028101070e-03f, 3.784102617e-03f, 1.061089559e-02f,
+    5.104328073e-03f, -1.135865908e-02f, -1.972469486e-02f, -2.928752618e-03f, 2.735570842e-02f, 3.311863697e-02f,
+    -8.259682670e-03f, -6.333280947e-02f, -5.710498960e-02f, 5.572106657e-02f, 2.302016226e-01f, 3.519749199e-01f,
+    3.316023957e-01f, 1.843958530e-01f, 1.654467003e-02f, -6.854117811e-02f, -5.159468309e-02f, 6.410940207e-03f,
+    3.604221100e-02f, 2.006832202e-02f, -9.771162317e-03f, -1.960995620e-02f, -6.838509642e-03f, 8.026210202e-03f,
+    9.645552822e-03f, 1.331747872e-03f, -4.994219056e-03f, -3.965778077e-03f, 3.683622226e-04f, 2.394179796e-03f,
+    1.231594796e-03f, -4.636255217e-04f, -8.117999787e-04f, -2.312033828e-04f, 1.752935257e-04f, 1.344873166e-04f,
+    1.696495465e-04f, 1.206911181e-04f, -3.986640774e-04f, -8.576851526e-04f, -1.262349022e-04f, 1.703078535e-03f,
+    2.238624750e-03f, -6.865605171e-04f, -4.809850650e-03f, -4.057659777e-03f, 3.725231139e-03f, 1.059802694e-02f,
+    5.184875657e-03f, -1.125569736e-02f, -1.974361361e-02f, -3.106741662e-03f, 2.719960144e-02f, 3.322998070e-02f,
+    -7.891451146e-03f, -6.309846409e-02f, -5.746846050e-02f, 5.472689327e-02f, 2.291455301e-01f, 3.516075859e-01f,
+    3.322009472e-01f, 1.855121589e-01f, 1.741032611e-02f, -6.835864124e-02f, -5.191362051e-02f, 6.084550437e-03f,
+    3.601375030e-02f, 2.025619070e-02f, -9.625087058e-03f, -1.963353608e-02f, -6.949087458e-03f, 7.968216785e-03f,
+    9.677932482e-03f, 1.388821484e-03f, -4.977834880e-03f, -3.989514754e-03f, 3.445364204e-04f, 2.393254371e-03f,
+    1.243649610e-03f, -4.565804294e-04f, -8.137733920e-04f, -2.351407316e-04f, 1.743730683e-04f, 1.354231014e-04f,
+    1.688997606e-04f, 1.224452600e-04f, -3.944955307e-04f, -8.574993418e-04f, -1.355883608e-04f, 1.692347080e-03f,
+    2.245379990e-03f, -6.592212836e-04f, -4.792861705e-03f, -4.086904199e-03f, 3.666341069e-03f, 1.058463220e-02f,
+    5.264921409e-03f, -1.115242433e-02f, -1.976144334e-02f, -3.284088846e-03f, 2.704249876e-02f, 3.333927258e-02f,
+    -7.523937233e-03f, -6.286164428e-02f, -5.782743413e-02f, 5.373541819e-02f, 2.280873256e-01f, 3.512343257e-01f,
+    3.327941918e-01f, 1.866276437e-01f, 1.827951588e-02f, -6.817181551e-02f, -5.223091314e-02f, 5.756861072e-03f,
+    3.598332325e-02f, 2.044350838e-02f, -9.478111872e-03f, -1.965614412e-02f, -7.059603271e-03f, 7.909634302e-03f,
+    9.709891275e-03f, 1.445998376e-03f, -4.961127193e-03f, -4.013116806e-03f, 3.206018273e-04f, 2.392191020e-03f,
+    1.255687122e-03f, -4.494737334e-04f, -8.157082113e-04f, -2.390883643e-04f, 1.734327583e-04f, 1.363564135e-04f,
+    1.681430599e-04f, 1.241778987e-04f, -3.903278378e-04f, -8.572630998e-04f, -1.448891493e-04f, 1.681566422e-03f,
+    2.251983453e-03f, -6.319466815e-04f, -4.775670939e-03f, -4.115833735e-03f, 3.607435664e-03f, 1.057071360e-02f,
+    5.344462453e-03f, -1.104884634e-02f, -1.977818601e-02f, -3.460786621e-03f, 2.688441122e-02f, 3.344651282e-02f,
+    -7.157157215e-03f, -6.262237012e-02f, -5.818191264e-02f, 5.274666492e-02f, 2.270270411e-01f, 3.508551515e-01f,
+    3.333821106e-01f, 1.877422750e-01f, 1.915222134e-02f, -6.798069278e-02f, -5.254653983e-02f, 5.427884824e-03f,
+    3.595092587e-02f, 2.063026380e-02f, -9.330242065e-03f, -1.967777650e-02f, -7.170051023e-03f, 7.850464234e-03f,
+    9.741426235e-03f, 1.503275744e-03f, -4.944095869e-03f, -4.036582451e-03f, 2.965593989e-04f, 2.390989253e-03f,
+    1.267706543e-03f, -4.423055753e-04f, -8.176041088e-04f, -2.430460723e-04f, 1.724725295e-04f, 1.372871465e-04f,
+    1.673795640e-04f, 1.258890502e-04f, -3.861612719e-04f, -8.569766998e-04f, -1.541369503e-04f, 1.670737400e-03f,
+    2.258435353e-03f, -6.047380116e-04f, -4.758279990e-03f, -4.144447804e-03f, 3.548518169e-03f, 1.055627343e-02f,
+    5.423495949e-03f, -1.094496969e-02f, -1.979384367e-02f, -3.636827488e-03f, 2.672534969e-02f, 3.355170177e-02f,
+    -6.791127291e-03f, -6.238066174e-02f, -5.853189837e-02f, 5.176065693e-02f, 2.259647084e-01f, 3.504700754e-01f,
+    3.339646849e-01f, 1.888560203e-01f, 2.002842430e-02f, -6.778526506e-02f, -5.286047941e-02f, 5.097634499e-03f,
+    3.591655431e-02f, 2.081644574e-02f, -9.181483004e-03f, -1.969842946e-02f, -7.280424640e-03f, 7.790708097e-03f,
+    9.772534411e-03f, 1.560650768e-03f, -4.926740795e-03f, -4.059909907e-03f, 2.724101003e-04f, 2.389648592e-03f,
+    1.279707085e-03f, -4.350761015e-04f, -8.194607578e-04f, -2.470136455e-04f, 1.714923165e-04f, 1.382151938e-04f,
+    1.666093926e-04f, 1.275787317e-04f, -3.819961047e-04f, -8.566404167e-04f, -1.633314509e-04f, 1.659860852e-03f,
+    2.264735910e-03f, -5.775965666e-04f, -4.740690501e-03f, -4.172745845e-03f, 3.489591823e-03f, 1.054131397e-02f,
+    5.502019093e-03f, -1.084080073e-02f, -1.980841840e-02f, -3.812204004e-03f, 2.656532506e-02f, 3.365483986e-02f,
+    -6.425863580e-03f, -6.213653932e-02f, -5.887739379e-02f, 5.077741757e-02f, 2.249003593e-01f, 3.500791097e-01f,
+    3.345418963e-01f, 1.899688473e-01f, 2.090810643e-02f, -6.758552448e-02f, -5.317271074e-02f, 4.766123007e-03f,
+    3.588020479e-02f, 2.100204293e-02f, -9.031840117e-03f, -1.971809926e-02f, -7.390718037e-03f, 7.730367446e-03f,
+    9.803212866e-03f, 1.618120617e-03f, -4.909061880e-03f, -4.083097397e-03f, 2.481549061e-04f, 2.388168561e-03f,
+    1.291687958e-03f, -4.277854626e-04f, -8.212778325e-04f, -2.509908718e-04f, 1.704920554e-04f, 1.391404479e-04f,
+    1.658326649e-04f, 1.292469622e-04f, -3.778326063e-04f, -8.562545275e-04f, -1.724723428e-04f, 1.648937616e-03f,
+    2.270885351e-03f, -5.505236305e-04f, -4.722904122e-03f, -4.200727315e-03f, 3.430659853e-03f, 1.052583753e-02f,
+    5.580029114e-03f, -1.073634576e-02f, -1.982191232e-02f, -3.986908781e-03f, 2.640434824e-02f, 3.375592762e-02f,
+    -6.061382113e-03f, -6.189002306e-02f, -5.921840156e-02f, 4.979697003e-02f, 2.238340258e-01f, 3.496822669e-01f,
+    3.351137263e-01f, 1.910807233e-01f, 2.179124925e-02f, -6.738146334e-02f, -5.348321269e-02f, 4.433363352e-03f,
+    3.584187361e-02f, 2.118704414e-02f, -8.881318892e-03f, -1.973678222e-02f, -7.500925117e-03f, 7.669443869e-03f,
+    9.833458680e-03f, 1.675682445e-03f, -4.891059049e-03f, -4.106143143e-03f, 2.237948008e-04f, 2.386548693e-03f,
+    1.303648368e-03f, -4.204338139e-04f, -8.230550082e-04f, -2.549775374e-04f, 1.694716831e-04f, 1.400628012e-04f,
+    1.650495000e-04f, 1.308937620e-04f, -3.736710454e-04f, -8.558193109e-04f, -1.815593226e-04f, 1.637968529e-03f,
+    2.276883913e-03f, -5.235204792e-04f, -4.704922507e-03f, -4.228391691e-03f, 3.371725479e-03f, 1.050984645e-02f,
+    5.657523279e-03f, -1.063161112e-02f, -1.983432763e-02f, -4.160934483e-03f, 2.624243015e-02f, 3.385496570e-02f,
+    -5.697698839e-03f, -6.164113324e-02f, -5.955492446e-02f, 4.881933739e-02f, 2.227657397e-01f, 3.492795597e-01f,
+    3.356801568e-01f, 1.921916161e-01f, 2.267783412e-02f, -6.717307407e-02f, -5.379196412e-02f, 4.099368639e-03f,
+    3.580155718e-02f, 2.137143813e-02f, -8.729924877e-03f, -1.975447469e-02f, -7.611039771e-03f, 7.607938992e-03f,
+    9.863268947e-03f, 1.733333390e-03f, -4.872732244e-03f, -4.129045371e-03f, 1.993307783e-04f, 2.384788527e-03f,
+    1.315587519e-03f, -4.130213152e-04f, -8.247919611e-04f, -2.589734265e-04f, 1.684311378e-04f, 1.409821455e-04f,
+    1.642600167e-04f, 1.325191530e-04f, -3.695116888e-04f, -8.553350476e-04f, -1.905920913e-04f, 1.626954426e-03f,
+    2.282731840e-03f, -4.965883797e-04f, -4.686747317e-03f, -4.255738469e-03f, 3.312791910e-03f, 1.049334309e-02f,
+    5.734498889e-03f, -1.052660313e-02f, -1.984566657e-02f, -4.334273830e-03f, 2.607958175e-02f, 3.395195483e-02f,
+    -5.334829623e-03f, -6.138989015e-02f, -5.988696548e-02f, 4.784454259e-02f, 2.216955331e-01f, 3.488710011e-01f,
+    3.362411698e-01f, 1.933014930e-01f, 2.356784226e-02f, -6.696034925e-02f, -5.409894393e-02f, 3.764152070e-03f,
+    3.575925198e-02f, 2.155521365e-02f, -8.577663681e-03f, -1.977117308e-02f, -7.721055877e-03f, 7.545854474e-03f,
+    9.892640777e-03f, 1.791070581e-03f, -4.854081426e-03f, -4.151802309e-03f, 1.747638421e-04f, 2.382887608e-03f,
+    1.327504615e-03f, -4.055481309e-04f, -8.264883685e-04f, -2.629783216e-04f, 1.673703591e-04f, 1.418983721e-04f,
+    1.634643337e-04f, 1.341231586e-04f, -3.653548022e-04f, -8.548020201e-04f, -1.995703549e-04f, 1.615896143e-03f,
+    2.288429384e-03f, -4.697285907e-04f, -4.668380216e-03f, -4.282767165e-03f, 3.253862346e-03f, 1.047632981e-02f,
+    5.810953279e-03f, -1.042132809e-02f, -1.985593141e-02f, -4.506919597e-03f, 2.591581400e-02f, 3.404689585e-02f,
+    -4.972790242e-03f, -6.113631413e-02f, -6.021452773e-02f, 4.687260843e-02f, 2.206234381e-01f, 3.484566041e-01f,
+    3.367967474e-01f, 1.944103217e-01f, 2.446125473e-02f, -6.674328160e-02f, -5.440413103e-02f, 3.427726945e-03f,
+    3.571495459e-02f, 2.173835946e-02f, -8.424540973e-03f, -1.978687382e-02f, -7.830967306e-03f, 7.483192014e-03f,
+    9.921571293e-03f, 1.848891129e-03f, -4.835106574e-03f, -4.174412186e-03f, 1.500950053e-04f, 2.380845488e-03f,
+    1.339398857e-03f, -3.980144299e-04f, -8.281439087e-04f, -2.669920032e-04f, 1.662892875e-04f, 1.428113718e-04f,
+    1.626625693e-04f, 1.357058035e-04f, -3.612006492e-04f, -8.542205125e-04f, -2.084938240e-04f, 1.604794516e-03f,
+    2.293976806e-03f, -4.429423622e-04f, -4.649822877e-03f, -4.309477314e-03f, 3.194939978e-03f, 1.045880903e-02f,
+    5.886883821e-03f, -1.031579233e-02f, -1.986512450e-02f, -4.678864612e-03f, 2.575113788e-02f, 3.413978969e-02f,
+    -4.611596389e-03f, -6.088042558e-02f, -6.053761450e-02f, 4.590355759e-02f, 2.195494866e-01f, 3.480363820e-01f,
+    3.373468720e-01f, 1.955180696e-01f, 2.535805244e-02f, -6.652186401e-02f, -5.470750433e-02f, 3.090106661e-03f,
+    3.566866169e-02f, 2.192086433e-02f, -8.270562480e-03f, -1.980157340e-02f, -7.940767912e-03f, 7.419953344e-03f,
+    9.950057638e-03f, 1.906792136e-03f, -4.815807686e-03f, -4.196873235e-03f, 1.253252905e-04f, 2.378661726e-03f,
+    1.351269442e-03f, -3.904203857e-04f, -8.297582614e-04f, -2.710142503e-04f, 1.651878648e-04f, 1.437210352e-04f,
+    1.618548417e-04f, 1.372671140e-04f, -3.570494923e-04f, -8.535908110e-04f, -2.173622136e-04f, 1.593650377e-03f,
+    2.299374372e-03f, -4.162309356e-04f, -4.631076976e-03f, -4.335868469e-03f, 3.136027985e-03f, 1.044078315e-02f,
+    5.962287924e-03f, -1.021000216e-02f, -1.987324822e-02f, -4.850101762e-03f, 2.558556440e-02f, 3.423063740e-02f,
+    -4.251263669e-03f, -6.062224491e-02f, -6.085622923e-02f, 4.493741259e-02f, 2.184737107e-01f, 3.476103481e-01f,
+    3.378915260e-01f, 1.966247044e-01f, 2.625821614e-02f, -6.629608950e-02f, -5.500904279e-02f, 2.751304711e-03f,
+    3.562037004e-02f, 2.210271701e-02f, -8.115733993e-03f, -1.981526835e-02f, -8.050451544e-03f, 7.356140233e-03f,
+    9.978096969e-03f, 1.964770686e-03f, -4.796184777e-03f, -4.219183691e-03f, 1.004557297e-04f, 2.376335885e-03f,
+    1.363115569e-03f, -3.827661762e-04f, -8.313311070e-04f, -2.750448399e-04f, 1.640660340e-04f, 1.446272521e-04f,
+    1.610412686e-04f, 1.388071178e-04f, -3.529015920e-04f, -8.529132034e-04f, -2.261752439e-04f, 1.582464560e-03f,
+    2.304622359e-03f, -3.895955435e-04f, -4.612144193e-03f, -4.361940204e-03f, 3.077129538e-03f, 1.042225462e-02f,
+    6.037163029e-03f, -1.010396388e-02f, -1.988030502e-02f, -5.020623985e-03f, 2.541910456e-02f, 3.431944011e-02f,
+    -3.891807603e-03f, -6.036179259e-02f, -6.117037553e-02f, 4.397419585e-02f, 2.173961426e-01f, 3.471785162e-01f,
+    3.384306921e-01f, 1.977301935e-01f, 2.716172645e-02f, -6.606595123e-02f, -5.530872535e-02f, 2.411334685e-03f,
+    3.557007650e-02f, 2.228390629e-02f, -7.960061357e-03f, -1.982795524e-02f, -8.160012037e-03f, 7.291754486e-03f,
+    1.000568646e-02f, 2.022823854e-03f, -4.776237880e-03f, -4.241341791e-03f, 7.548736465e-05f, 2.373867540e-03f,
+    1.374936432e-03f, -3.750519840e-04f, -8.328621274e-04f, -2.790835471e-04f, 1.629237393e-04f, 1.455299122e-04f,
+    1.602219677e-04f, 1.403258442e-04f, -3.487572073e-04f, -8.521879790e-04f, -2.349326392e-04f, 1.571237898e-03f,
+    2.309721050e-03f, -3.630374101e-04f, -4.593026216e-03f, -4.387692111e-03f, 3.018247797e-03f, 1.040322590e-02f,
+    6.111506614e-03f, -9.997683802e-03f, -1.988629738e-02f, -5.190424279e-03f, 2.525176942e-02f, 3.440619905e-02f,
+    -3.533243621e-03f, -6.009908910e-02f, -6.148005716e-02f, 4.301392961e-02f, 2.163168143e-01f, 3.467409001e-01f,
+    3.389643531e-01f, 1.988345046e-01f, 2.806856382e-02f, -6.583144252e-02f, -5.560653099e-02f, 2.070210269e-03f,
+    3.551777800e-02f, 2.246442092e-02f, -7.803550482e-03f, -1.983963069e-02f, -8.269443218e-03f, 7.226797944e-03f,
+    1.003282330e-02f, 2.080948701e-03f, -4.755967047e-03f, -4.263345776e-03f, 5.042124617e-05f, 2.371256267e-03f,
+    1.386731225e-03f, -3.672779965e-04f, -8.343510054e-04f, -2.831301454e-04f, 1.617609262e-04f, 1.464289046e-04f,
+    1.593970562e-04f, 1.418233235e-04f, -3.446165958e-04f, -8.514154292e-04f, -2.436341290e-04f, 1.559971221e-03f,
+    2.314670736e-03f, -3.365577504e-04f, -4.573724735e-03f, -4.413123803e-03f, 2.959385912e-03f, 1.038369946e-02f,
+    6.185316194e-03f, -9.891168226e-03f, -1.989122784e-02f, -5.359495695e-03f, 2.508357000e-02f, 3.449091557e-02f,
+    -3.175587067e-03f, -5.983415499e-02f, -6.178527803e-02f, 4.205663601e-02f, 2.152357581e-01f, 3.462975137e-01f,
+    3.394924921e-01f, 1.999376051e-01f, 2.897870858e-02f, -6.559255685e-02f, -5.590243870e-02f, 1.727945245e-03f,
+    3.546347158e-02f, 2.264424971e-02f, -7.646207333e-03f, -1.985029136e-02f, -8.378738903e-03f, 7.161272483e-03f,
+    1.005950469e-02f, 2.139142273e-03f, -4.735372347e-03f, -4.285193888e-03f, 2.525843469e-05f, 2.368501652e-03f,
+    1.398499140e-03f, -3.594444053e-04f, -8.357974253e-04f, -2.871844064e-04f, 1.605775414e-04f, 1.473241180e-04f,
+    1.585666510e-04f, 1.432995879e-04f, -3.404800132e-04f, -8.505958469e-04f, -2.522794472e-04f, 1.548665360e-03f,
+    2.319471715e-03f, -3.101577709e-04f, -4.554241448e-03f, -4.438234908e-03f, 2.900547021e-03f, 1.036367781e-02f,
+    6.258589318e-03f, -9.784423449e-03f, -1.989509898e-02f, -5.527831341e-03f, 2.491451739e-02f, 3.457359110e-02f,
+    -2.818853198e-03f, -5.956701082e-02f, -6.208604222e-02f, 4.110233703e-02f, 2.141530062e-01f, 3.458483712e-01f,
+    3.400150922e-01f, 2.010394626e-01f, 2.989214088e-02f, -6.534928782e-02f, -5.619642749e-02f, 1.384553489e-03f,
+    3.540715439e-02f, 2.282338141e-02f, -7.488037937e-03f, -1.985993395e-02f, -8.487892899e-03f, 7.095180017e-03f,
+    1.008572786e-02f, 2.197401607e-03f, -4.714453870e-03f, -4.306884373e-03f, -2.610191613e-18f, 2.365603289e-03f,
+    1.410239366e-03f, -3.515514068e-04f, -8.372010724e-04f, -2.912461001e-04f, 1.593735328e-04f, 1.482154407e-04f,
+    1.577308690e-04f, 1.447546708e-04f, -3.363477135e-04f, -8.497295264e-04f, -2.608683324e-04f, 1.537321144e-03f,
+    2.324124294e-03f, -2.838386691e-04f, -4.534578053e-03f, -4.463025077e-03f, 2.841734253e-03f, 1.034316347e-02f,
+    6.331323571e-03f, -9.677455761e-03f, -1.989791345e-02f, -5.695424381e-03f, 2.474462266e-02f, 3.465422715e-02f,
+    -2.463057178e-03f, -5.929767720e-02f, -6.238235396e-02f, 4.015105452e-02f, 2.130685907e-01f, 3.453934870e-01f,
+    3.405321367e-01f, 2.021400447e-01f, 3.080884074e-02f, -6.510162922e-02f, -5.648847641e-02f, 1.040048973e-03f,
+    3.534882363e-02f, 2.300180483e-02f, -7.329048378e-03f, -1.986855523e-02f, -8.596899005e-03f, 7.028522494e-03f,
+    1.011149005e-02f, 2.255723725e-03f, -4.693211721e-03f, -4.328415482e-03f, -2.535297880e-05f, 2.362560776e-03f,
+    1.421951091e-03f, -3.435992021e-04f, -8.385616334e-04f, -2.953149945e-04f, 1.581488497e-04f, 1.491027606e-04f,
+    1.568898264e-04f, 1.461886069e-04f, -3.322199494e-04f, -8.488167639e-04f, -2.694005278e-04f, 1.525939402e-03f,
+    2.328628786e-03f, -2.576016336e-04f, -4.514736257e-03f, -4.487493979e-03f, 2.782950726e-03f, 1.032215898e-02f,
+    6.403516573e-03f, -9.570271449e-03f, -1.989967392e-02f, -5.862268037e-03f, 2.457389689e-02f, 3.473282538e-02f,
+    -2.108214087e-03f, -5.902617476e-02f, -6.267421764e-02f, 3.920281018e-02f, 2.119825439e-01f, 3.449328756e-01f,
+    3.410436091e-01f, 2.032393189e-01f, 3.172878803e-02f, -6.484957496e-02f, -5.677856451e-02f, 6.944457641e-04f,
+    3.528847664e-02f, 2.317950877e-02f, -7.169244801e-03f, -1.987615197e-02f, -8.705751010e-03f, 6.961301899e-03f,
+    1.013678852e-02f, 2.314105637e-03f, -4.671646027e-03f, -4.349785465e-03f, -5.079941328e-05f, 2.359373719e-03f,
+    1.433633503e-03f, -3.355879967e-04f, -8.398787963e-04f, -2.993908560e-04f, 1.569034425e-04f, 1.499859652e-04f,
+    1.560436394e-04f, 1.476014324e-04f, -3.280969715e-04f, -8.478578571e-04f, -2.778757816e-04f, 1.514520961e-03f,
+    2.332985513e-03f, -2.314478442e-04f, -4.494717769e-03f, -4.511641300e-03f, 2.724199547e-03f, 1.030066689e-02f,
+    6.475165983e-03f, -9.462876795e-03f, -1.990038313e-02f, -6.028355587e-03f, 2.440235120e-02f, 3.480938750e-02f,
+    -1.754338912e-03f, -5.875252417e-02f, -6.296163781e-02f, 3.825762558e-02f, 2.108948981e-01f, 3.444665518e-01f,
+    3.415494933e-01f, 2.043372529e-01f, 3.265196248e-02f, -6.459311911e-02f, -5.706667087e-02f, 3.477580218e-04f,
+    3.522611082e-02f, 2.335648201e-02f, -7.008633408e-03f, -1.988272104e-02f, -8.814442693e-03f, 6.893520253e-03f,
+    1.016162054e-02f, 2.372544340e-03f, -4.649756930e-03f, -4.370992579e-03f, -7.633820572e-05f, 2.356041732e-03f,
+    1.445285786e-03f, -3.275180008e-04f, -8.411522502e-04f, -3.034734492e-04f, 1.556372630e-04f, 1.508649416e-04f,
+    1.551924236e-04f, 1.489931850e-04f, -3.239790291e-04f, -8.468531053e-04f, -2.862938462e-04f, 1.503066645e-03f,
+    2.337194803e-03f, -2.053784717e-04f, -4.474524303e-03f, -4.535466748e-03f, 2.665483811e-03f, 1.027868978e-02f,
+    6.546269491e-03f, -9.355278075e-03f, -1.990004387e-02f, -6.193680364e-03f, 2.422999670e-02f, 3.488391533e-02f,
+    -1.401446549e-03f, -5.847674614e-02f, -6.324461917e-02f, 3.731552215e-02f, 2.098056856e-01f, 3.439945303e-01f,
+    3.420497729e-01f, 2.054338143e-01f, 3.357834365e-02f, -6.433225590e-02f, -5.735277459e-02f, -1.197480798e-17f,
+    3.516172368e-02f, 2.353271339e-02f, -6.847220459e-03f, -1.988825931e-02f, -8.922967829e-03f, 6.825179612e-03f,
+    1.018598340e-02f, 2.431036820e-03f, -4.627544594e-03f, -4.392035083e-03f, -1.019682492e-04f, 2.352564434e-03f,
+    1.456907124e-03f, -3.193894293e-04f, -8.423816858e-04f, -3.075625369e-04f, 1.543502643e-04f, 1.517395766e-04f,
+    1.543362945e-04f, 1.503639035e-04f, -3.198663695e-04f, -8.458028093e-04f, -2.946544790e-04f, 1.491577281e-03f,
+    2.341256994e-03f, -1.793946778e-04f, -4.454157578e-03f, -4.558970048e-03f, 2.606806603e-03f, 1.025623025e-02f,
+    6.616824826e-03f, -9.247481558e-03f, -1.989865895e-02f, -6.358235762e-03f, 2.405684453e-02f, 3.495641080e-02f,
+    -1.049551807e-03f, -5.819886139e-02f, -6.352316657e-02f, 3.637652117e-02f, 2.087149386e-01f, 3.435168264e-01f,
+    3.425444322e-01f, 2.065289706e-01f, 3.450791099e-02f, -6.406697969e-02f, -5.763685481e-02f, -3.488139541e-04f,
+    3.509531281e-02f, 2.370819171e-02f, -6.685012274e-03f, -1.989276373e-02f, -9.031320182e-03f, 6.756282069e-03f,
+    1.020987442e-02f, 2.489580052e-03f, -4.605009198e-03f, -4.412911239e-03f, -1.276884274e-04f, 2.348941455e-03f,
+    1.468496699e-03f, -3.112025016e-04f, -8.435667950e-04f, -3.116578802e-04f, 1.530424009e-04f, 1.526097565e-04f,
+    1.534753673e-04f, 1.517136282e-04f, -3.157592385e-04f, -8.447072712e-04f, -3.029574420e-04f, 1.480053692e-03f,
+    2.345172427e-03f, -1.534976151e-04f, -4.433619314e-03f, -4.582150944e-03f, 2.548170996e-03f, 1.023329092e-02f,
+    6.686829752e-03f, -9.139493508e-03f, -1.989623126e-02f, -6.522015230e-03f, 2.388290581e-02f, 3.502687592e-02f,
+    -6.986694005e-04f, -5.791889068e-02f, -6.379728502e-02f, 3.544064378e-02f, 2.076226894e-01f, 3.430334552e-01f,
+    3.430334552e-01f, 2.076226894e-01f, 3.544064378e-02f, -6.379728502e-02f, -5.791889068e-02f, -6.986694005e-04f,
+    3.502687592e-02f, 2.388290581e-02f, -6.522015230e-03f, -1.989623126e-02f, -9.139493508e-03f, 6.686829752e-03f,
+    1.023329092e-02f, 2.548170996e-03f, -4.582150944e-03f, -4.433619314e-03f, -1.534976151e-04f, 2.345172427e-03f,
+    1.480053692e-03f, -3.029574420e-04f, -8.447072712e-04f, -3.157592385e-04f, 1.517136282e-04f, 1.534753673e-04f,
+    1.526097565e-04f, 1.530424009e-04f, -3.116578802e-04f, -8.435667950e-04f, -3.112025016e-04f, 1.468496699e-03f,
+    2.348941455e-03f, -1.276884274e-04f, -4.412911239e-03f, -4.605009198e-03f, 2.489580052e-03f, 1.020987442e-02f,
+    6.756282069e-03f, -9.031320182e-03f, -1.989276373e-02f, -6.685012274e-03f, 2.370819171e-02f, 3.509531281e-02f,
+    -3.488139541e-04f, -5.763685481e-02f, -6.406697969e-02f, 3.450791099e-02f, 2.065289706e-01f, 3.425444322e-01f,
+    3.435168264e-01f, 2.087149386e-01f, 3.637652117e-02f, -6.352316657e-02f, -5.819886139e-02f, -1.049551807e-03f,
+    3.495641080e-02f, 2.405684453e-02f, -6.358235762e-03f, -1.989865895e-02f, -9.247481558e-03f, 6.616824826e-03f,
+    1.025623025e-02f, 2.606806603e-03f, -4.558970048e-03f, -4.454157578e-03f, -1.793946778e-04f, 2.341256994e-03f,
+    1.491577281e-03f, -2.946544790e-04f, -8.458028093e-04f, -3.198663695e-04f, 1.503639035e-04f, 1.543362945e-04f,
+    1.517395766e-04f, 1.543502643e-04f, -3.075625369e-04f, -8.423816858e-04f, -3.193894293e-04f, 1.456907124e-03f,
+    2.352564434e-03f, -1.019682492e-04f, -4.392035083e-03f, -4.627544594e-03f, 2.431036820e-03f, 1.018598340e-02f,
+    6.825179612e-03f, -8.922967829e-03f, -1.988825931e-02f, -6.847220459e-03f, 2.353271339e-02f, 3.516172368e-02f,
+    -1.197480798e-17f, -5.735277459e-02f, -6.433225590e-02f, 3.357834365e-02f, 2.054338143e-01f, 3.420497729e-01f,
+    3.439945303e-01f, 2.098056856e-01f, 3.731552215e-02f, -6.324461917e-02f, -5.847674614e-02f, -1.401446549e-03f,
+    3.488391533e-02f, 2.422999670e-02f, -6.193680364e-03f, -1.990004387e-02f, -9.355278075e-03f, 6.546269491e-03f,
+    1.027868978e-02f, 2.665483811e-03f, -4.535466748e-03f, -4.474524303e-03f, -2.053784717e-04f, 2.337194803e-03f,
+    1.503066645e-03f, -2.862938462e-04f, -8.468531053e-04f, -3.239790291e-04f, 1.489931850e-04f, 1.551924236e-04f,
+    1.508649416e-04f, 1.556372630e-04f, -3.034734492e-04f, -8.411522502e-04f, -3.275180008e-04f, 1.445285786e-03f,
+    2.356041732e-03f, -7.633820572e-05f, -4.370992579e-03f, -4.649756930e-03f, 2.372544340e-03f, 1.016162054e-02f,
+    6.893520253e-03f, -8.814442693e-03f, -1.988272104e-02f, -7.008633408e-03f, 2.335648201e-02f, 3.522611082e-02f,
+    3.477580218e-04f, -5.706667087e-02f, -6.459311911e-02f, 3.265196248e-02f, 2.043372529e-01f, 3.415494933e-01f,
+    3.444665518e-01f, 2.108948981e-01f, 3.825762558e-02f, -6.296163781e-02f, -5.875252417e-02f, -1.754338912e-03f,
+    3.480938750e-02f, 2.440235120e-02f, -6.028355587e-03f, -1.990038313e-02f, -9.462876795e-03f, 6.475165983e-03f,
+    1.030066689e-02f, 2.724199547e-03f, -4.511641300e-03f, -4.494717769e-03f, -2.314478442e-04f, 2.332985513e-03f,
+    1.514520961e-03f, -2.778757816e-04f, -8.478578571e-04f, -3.280969715e-04f, 1.476014324e-04f, 1.560436394e-04f,
+    1.499859652e-04f, 1.569034425e-04f, -2.993908560e-04f, -8.398787963e-04f, -3.355879967e-04f, 1.433633503e-03f,
+    2.359373719e-03f, -5.079941328e-05f, -4.349785465e-03f, -4.671646027e-03f, 2.314105637e-03f, 1.013678852e-02f,
+    6.961301899e-03f, -8.705751010e-03f, -1.987615197e-02f, -7.169244801e-03f, 2.317950877e-02f, 3.528847664e-02f,
+    6.944457641e-04f, -5.677856451e-02f, -6.484957496e-02f, 3.172878803e-02f, 2.032393189e-01f, 3.410436091e-01f,
+    3.449328756e-01f, 2.119825439e-01f, 3.920281018e-02f, -6.267421764e-02f, -5.902617476e-02f, -2.108214087e-03f,
+    3.473282538e-02f, 2.457389689e-02f, -5.862268037e-03f, -1.989967392e-02f, -9.570271449e-03f, 6.403516573e-03f,
+    1.032215898e-02f, 2.782950726e-03f, -4.487493979e-03f, -4.514736257e-03f, -2.576016336e-04f, 2.328628786e-03f,
+    1.525939402e-03f, -2.694005278e-04f, -8.488167639e-04f, -3.322199494e-04f, 1.461886069e-04f, 1.568898264e-04f,
+    1.491027606e-04f, 1.581488497e-04f, -2.953149945e-04f, -8.385616334e-04f, -3.435992021e-04f, 1.421951091e-03f,
+    2.362560776e-03f, -2.535297880e-05f, -4.328415482e-03f, -4.693211721e-03f, 2.255723725e-03f, 1.011149005e-02f,
+    7.028522494e-03f, -8.596899005e-03f, -1.986855523e-02f, -7.329048378e-03f, 2.300180483e-02f, 3.534882363e-02f,
+    1.040048973e-03f, -5.648847641e-02f, -6.510162922e-02f, 3.080884074e-02f, 2.021400447e-01f, 3.405321367e-01f,
+    3.453934870e-01f, 2.130685907e-01f, 4.015105452e-02f, -6.238235396e-02f, -5.929767720e-02f, -2.463057178e-03f,
+    3.465422715e-02f, 2.474462266e-02f, -5.695424381e-03f, -1.989791345e-02f, -9.677455761e-03f, 6.331323571e-03f,
+    1.034316347e-02f, 2.841734253e-03f, -4.463025077e-03f, -4.534578053e-03f, -2.838386691e-04f, 2.324124294e-03f,
+    1.537321144e-03f, -2.608683324e-04f, -8.497295264e-04f, -3.363477135e-04f, 1.447546708e-04f, 1.577308690e-04f,
+    1.482154407e-04f, 1.593735328e-04f, -2.912461001e-04f, -8.372010724e-04f, -3.515514068e-04f, 1.410239366e-03f,
+    2.365603289e-03f, -2.610191613e-18f, -4.306884373e-03f, -4.714453870e-03f, 2.197401607e-03f, 1.008572786e-02f,
+    7.095180017e-03f, -8.487892899e-03f, -1.985993395e-02f, -7.488037937e-03f, 2.282338141e-02f, 3.540715439e-02f,
+    1.384553489e-03f, -5.619642749e-02f, -6.534928782e-02f, 2.989214088e-02f, 2.010394626e-01f, 3.400150922e-01f,
+    3.458483712e-01f, 2.141530062e-01f, 4.110233703e-02f, -6.208604222e-02f, -5.956701082e-02f, -2.818853198e-03f,
+    3.457359110e-02f, 2.491451739e-02f, -5.527831341e-03f, -1.989509898e-02f, -9.784423449e-03f, 6.258589318e-03f,
+    1.036367781e-02f, 2.900547021e-03f, -4.438234908e-03f, -4.554241448e-03f, -3.101577709e-04f, 2.319471715e-03f,
+    1.548665360e-03f, -2.522794472e-04f, -8.505958469e-04f, -3.404800132e-04f, 1.432995879e-04f, 1.585666510e-04f,
+    1.473241180e-04f, 1.605775414e-04f, -2.871844064e-04f, -8.357974253e-04f, -3.594444053e-04f, 1.398499140e-03f,
+    2.368501652e-03f, 2.525843469e-05f, -4.285193888e-03f, -4.735372347e-03f, 2.139142273e-03f, 1.005950469e-02f,
+    7.161272483e-03f, -8.378738903e-03f, -1.985029136e-02f, -7.646207333e-03f, 2.264424971e-02f, 3.546347158e-02f,
+    1.727945245e-03f, -5.590243870e-02f, -6.559255685e-02f, 2.897870858e-02f, 1.999376051e-01f, 3.394924921e-01f,
+    3.462975137e-01f, 2.152357581e-01f, 4.205663601e-02f, -6.178527803e-02f, -5.983415499e-02f, -3.175587067e-03f,
+    3.449091557e-02f, 2.508357000e-02f, -5.359495695e-03f, -1.989122784e-02f, -9.891168226e-03f, 6.185316194e-03f,
+    1.038369946e-02f, 2.959385912e-03f, -4.413123803e-03f, -4.573724735e-03f, -3.365577504e-04f, 2.314670736e-03f,
+    1.559971221e-03f, -2.436341290e-04f, -8.514154292e-04f, -3.446165958e-04f, 1.418233235e-04f, 1.593970562e-04f,
+    1.464289046e-04f, 1.617609262e-04f, -2.831301454e-04f, -8.343510054e-04f, -3.672779965e-04f, 1.386731225e-03f,
+    2.371256267e-03f, 5.042124617e-05f, -4.263345776e-03f, -4.755967047e-03f, 2.080948701e-03f, 1.003282330e-02f,
+    7.226797944e-03f, -8.269443218e-03f, -1.983963069e-02f, -7.803550482e-03f, 2.246442092e-02f, 3.551777800e-02f,
+    2.070210269e-03f, -5.560653099e-02f, -6.583144252e-02f, 2.806856382e-02f, 1.988345046e-01f, 3.389643531e-01f,
+    3.467409001e-01f, 2.163168143e-01f, 4.301392961e-02f, -6.148005716e-02f, -6.009908910e-02f, -3.533243621e-03f,
+    3.440619905e-02f, 2.525176942e-02f, -5.190424279e-03f, -1.988629738e-02f, -9.997683802e-03f, 6.111506614e-03f,
+    1.040322590e-02f, 3.018247797e-03f, -4.387692111e-03f, -4.593026216e-03f, -3.630374101e-04f, 2.309721050e-03f,
+    1.571237898e-03f, -2.349326392e-04f, -8.521879790e-04f, -3.487572073e-04f, 1.403258442e-04f, 1.602219677e-04f,
+    1.455299122e-04f, 1.629237393e-04f, -2.790835471e-04f, -8.328621274e-04f, -3.750519840e-04f, 1.374936432e-03f,
+    2.373867540e-03f, 7.548736465e-05f, -4.241341791e-03f, -4.776237880e-03f, 2.022823854e-03f, 1.000568646e-02f,
+    7.291754486e-03f, -8.160012037e-03f, -1.982795524e-02f, -7.960061357e-03f, 2.228390629e-02f, 3.557007650e-02f,
+    2.411334685e-03f, -5.530872535e-02f, -6.606595123e-02f, 2.716172645e-02f, 1.977301935e-01f, 3.384306921e-01f,
+    3.471785162e-01f, 2.173961426e-01f, 4.397419585e-02f, -6.117037553e-02f, -6.036179259e-02f, -3.891807603e-03f,
+    3.431944011e-02f, 2.541910456e-02f, -5.020623985e-03f, -1.988030502e-02f, -1.010396388e-02f, 6.037163029e-03f,
+    1.042225462e-02f, 3.077129538e-03f, -4.361940204e-03f, -4.612144193e-03f, -3.895955435e-04f, 2.304622359e-03f,
+    1.582464560e-03f, -2.261752439e-04f, -8.529132034e-04f, -3.529015920e-04f, 1.388071178e-04f, 1.610412686e-04f,
+    1.446272521e-04f, 1.640660340e-04f, -2.750448399e-04f, -8.313311070e-04f, -3.827661762e-04f, 1.363115569e-03f,
+    2.376335885e-03f, 1.004557297e-04f, -4.219183691e-03f, -4.796184777e-03f, 1.964770686e-03f, 9.978096969e-03f,
+    7.356140233e-03f, -8.050451544e-03f, -1.981526835e-02f, -8.115733993e-03f, 2.210271701e-02f, 3.562037004e-02f,
+    2.751304711e-03f, -5.500904279e-02f, -6.629608950e-02f, 2.625821614e-02f, 1.966247044e-01f, 3.378915260e-01f,
+    3.476103481e-01f, 2.184737107e-01f, 4.493741259e-02f, -6.085622923e-02f, -6.062224491e-02f, -4.251263669e-03f,
+    3.423063740e-02f, 2.558556440e-02f, -4.850101762e-03f, -1.987324822e-02f, -1.021000216e-02f, 5.962287924e-03f,
+    1.044078315e-02f, 3.136027985e-03f, -4.335868469e-03f, -4.631076976e-03f, -4.162309356e-04f, 2.299374372e-03f,
+    1.593650377e-03f, -2.173622136e-04f, -8.535908110e-04f, -3.570494923e-04f, 1.372671140e-04f, 1.618548417e-04f,
+    1.437210352e-04f, 1.651878648e-04f, -2.710142503e-04f, -8.297582614e-04f, -3.904203857e-04f, 1.351269442e-03f,
+    2.378661726e-03f, 1.253252905e-04f, -4.196873235e-03f, -4.815807686e-03f, 1.906792136e-03f, 9.950057638e-03f,
+    7.419953344e-03f, -7.940767912e-03f, -1.980157340e-02f, -8.270562480e-03f, 2.192086433e-02f, 3.566866169e-02f,
+    3.090106661e-03f, -5.470750433e-02f, -6.652186401e-02f, 2.535805244e-02f, 1.955180696e-01f, 3.373468720e-01f,
+    3.480363820e-01f, 2.195494866e-01f, 4.590355759e-02f, -6.053761450e-02f, -6.088042558e-02f, -4.611596389e-03f,
+    3.413978969e-02f, 2.575113788e-02f, -4.678864612e-03f, -1.986512450e-02f, -1.031579233e-02f, 5.886883821e-03f,
+    1.045880903e-02f, 3.194939978e-03f, -4.309477314e-03f, -4.649822877e-03f, -4.429423622e-04f, 2.293976806e-03f,
+    1.604794516e-03f, -2.084938240e-04f, -8.542205125e-04f, -3.612006492e-04f, 1.357058035e-04f, 1.626625693e-04f,
+    1.428113718e-04f, 1.662892875e-04f, -2.669920032e-04f, -8.281439087e-04f, -3.980144299e-04f, 1.339398857e-03f,
+    2.380845488e-03f, 1.500950053e-04f, -4.174412186e-03f, -4.835106574e-03f, 1.848891129e-03f, 9.921571293e-03f,
+    7.483192014e-03f, -7.830967306e-03f, -1.978687382e-02f, -8.424540973e-03f, 2.173835946e-02f, 3.571495459e-02f,
+    3.427726945e-03f, -5.440413103e-02f, -6.674328160e-02f, 2.446125473e-02f, 1.944103217e-01f, 3.367967474e-01f,
+    3.484566041e-01f, 2.206234381e-01f, 4.687260843e-02f, -6.021452773e-02f, -6.113631413e-02f, -4.972790242e-03f,
+    3.404689585e-02f, 2.591581400e-02f, -4.506919597e-03f, -1.985593141e-02f, -1.042132809e-02f, 5.810953279e-03f,
+    1.047632981e-02f, 3.253862346e-03f, -4.282767165e-03f, -4.668380216e-03f, -4.697285907e-04f, 2.288429384e-03f,
+    1.615896143e-03f, -1.995703549e-04f, -8.548020201e-04f, -3.653548022e-04f, 1.341231586e-04f, 1.634643337e-04f,
+    1.418983721e-04f, 1.673703591e-04f, -2.629783216e-04f, -8.264883685e-04f, -4.055481309e-04f, 1.327504615e-03f,
+    2.382887608e-03f, 1.747638421e-04f, -4.151802309e-03f, -4.854081426e-03f, 1.791070581e-03f, 9.892640777e-03f,
+    7.545854474e-03f, -7.721055877e-03f, -1.977117308e-02f, -8.577663681e-03f, 2.155521365e-02f, 3.575925198e-02f,
+    3.764152070e-03f, -5.409894393e-02f, -6.696034925e-02f, 2.356784226e-02f, 1.933014930e-01f, 3.362411698e-01f,
+    3.488710011e-01f, 2.216955331e-01f, 4.784454259e-02f, -5.988696548e-02f, -6.138989015e-02f, -5.334829623e-03f,
+    3.395195483e-02f, 2.607958175e-02f, -4.334273830e-03f, -1.984566657e-02f, -1.052660313e-02f, 5.734498889e-03f,
+    1.049334309e-02f, 3.312791910e-03f, -4.255738469e-03f, -4.686747317e-03f, -4.965883797e-04f, 2.282731840e-03f,
+    1.626954426e-03f, -1.905920913e-04f, -8.553350476e-04f, -3.695116888e-04f, 1.325191530e-04f, 1.642600167e-04f,
+    1.409821455e-04f, 1.684311378e-04f, -2.589734265e-04f, -8.247919611e-04f, -4.130213152e-04f, 1.315587519e-03f,
+    2.384788527e-03f, 1.993307783e-04f, -4.129045371e-03f, -4.872732244e-03f, 1.733333390e-03f, 9.863268947e-03f,
+    7.607938992e-03f, -7.611039771e-03f, -1.975447469e-02f, -8.729924877e-03f, 2.137143813e-02f, 3.580155718e-02f,
+    4.099368639e-03f, -5.379196412e-02f, -6.717307407e-02f, 2.267783412e-02f, 1.921916161e-01f, 3.356801568e-01f,
+    3.492795597e-01f, 2.227657397e-01f, 4.881933739e-02f, -5.955492446e-02f, -6.164113324e-02f, -5.697698839e-03f,
+    3.385496570e-02f, 2.624243015e-02f, -4.160934483e-03f, -1.983432763e-02f, -1.063161112e-02f, 5.657523279e-03f,
+    1.050984645e-02f, 3.371725479e-03f, -4.228391691e-03f, -4.704922507e-03f, -5.235204792e-04f, 2.276883913e-03f,
+    1.637968529e-03f, -1.815593226e-04f, -8.558193109e-04f, -3.736710454e-04f, 1.308937620e-04f, 1.650495000e-04f,
+    1.400628012e-04f, 1.694716831e-04f, -2.549775374e-04f, -8.230550082e-04f, -4.204338139e-04f, 1.303648368e-03f,
+    2.386548693e-03f, 2.237948008e-04f, -4.106143143e-03f, -4.891059049e-03f, 1.675682445e-03f, 9.833458680e-03f,
+    7.669443869e-03f, -7.500925117e-03f, -1.973678222e-02f, -8.881318892e-03f, 2.118704414e-02f, 3.584187361e-02f,
+    4.433363352e-03f, -5.348321269e-02f, -6.738146334e-02f, 2.179124925e-02f, 1.910807233e-01f, 3.351137263e-01f,
+    3.496822669e-01f, 2.238340258e-01f, 4.979697003e-02f, -5.921840156e-02f, -6.189002306e-02f, -6.061382113e-03f,
+    3.375592762e-02f, 2.640434824e-02f, -3.986908781e-03f, -1.982191232e-02f, -1.073634576e-02f, 5.580029114e-03f,
+    1.052583753e-02f, 3.430659853e-03f, -4.200727315e-03f, -4.722904122e-03f, -5.505236305e-04f, 2.270885351e-03f,
+    1.648937616e-03f, -1.724723428e-04f, -8.562545275e-04f, -3.778326063e-04f, 1.292469622e-04f, 1.658326649e-04f,
+    1.391404479e-04f, 1.704920554e-04f, -2.509908718e-04f, -8.212778325e-04f, -4.277854626e-04f, 1.291687958e-03f,
+    2.388168561e-03f, 2.481549061e-04f, -4.083097397e-03f, -4.909061880e-03f, 1.618120617e-03f, 9.803212866e-03f,
+    7.730367446e-03f, -7.390718037e-03f, -1.971809926e-02f, -9.031840117e-03f, 2.100204293e-02f, 3.588020479e-02f,
+    4.766123007e-03f, -5.317271074e-02f, -6.758552448e-02f, 2.090810643e-02f, 1.899688473e-01f, 3.345418963e-01f,
+    3.500791097e-01f, 2.249003593e-01f, 5.077741757e-02f, -5.887739379e-02f, -6.213653932e-02f, -6.425863580e-03f,
+    3.365483986e-02f, 2.656532506e-02f, -3.812204004e-03f, -1.980841840e-02f, -1.084080073e-02f, 5.502019093e-03f,
+    1.054131397e-02f, 3.489591823e-03f, -4.172745845e-03f, -4.740690501e-03f, -5.775965666e-04f, 2.264735910e-03f,
+    1.659860852e-03f, -1.633314509e-04f, -8.566404167e-04f, -3.819961047e-04f, 1.275787317e-04f, 1.666093926e-04f,
+    1.382151938e-04f, 1.714923165e-04f, -2.470136455e-04f, -8.194607578e-04f, -4.350761015e-04f, 1.279707085e-03f,
+    2.389648592e-03f, 2.724101003e-04f, -4.059909907e-03f, -4.926740795e-03f, 1.560650768e-03f, 9.772534411e-03f,
+    7.790708097e-03f, -7.280424640e-03f, -1.969842946e-02f, -9.181483004e-03f, 2.081644574e-02f, 3.591655431e-02f,
+    5.097634499e-03f, -5.286047941e-02f, -6.778526506e-02f, 2.002842430e-02f, 1.888560203e-01f, 3.339646849e-01f,
+    3.504700754e-01f, 2.259647084e-01f, 5.176065693e-02f, -5.853189837e-02f, -6.238066174e-02f, -6.791127291e-03f,
+    3.355170177e-02f, 2.672534969e-02f, -3.636827488e-03f, -1.979384367e-02f, -1.094496969e-02f, 5.423495949e-03f,
+    1.055627343e-02f, 3.548518169e-03f, -4.144447804e-03f, -4.758279990e-03f, -6.047380116e-04f, 2.258435353e-03f,
+    1.670737400e-03f, -1.541369503e-04f, -8.569766998e-04f, -3.861612719e-04f, 1.258890502e-04f, 1.673795640e-04f,
+    1.372871465e-04f, 1.724725295e-04f, -2.430460723e-04f, -8.176041088e-04f, -4.423055753e-04f, 1.267706543e-03f,
+    2.390989253e-03f, 2.965593989e-04f, -4.036582451e-03f, -4.944095869e-03f, 1.503275744e-03f, 9.741426235e-03f,
+    7.850464234e-03f, -7.170051023e-03f, -1.967777650e-02f, -9.330242065e-03f, 2.063026380e-02f, 3.595092587e-02f,
+    5.427884824e-03f, -5.254653983e-02f, -6.798069278e-02f, 1.915222134e-02f, 1.877422750e-01f, 3.333821106e-01f,
+    3.508551515e-01f, 2.270270411e-01f, 5.274666492e-02f, -5.818191264e-02f, -6.262237012e-02f, -7.157157215e-03f,
+    3.344651282e-02f, 2.688441122e-02f, -3.460786621e-03f, -1.977818601e-02f, -1.104884634e-02f, 5.344462453e-03f,
+    1.057071360e-02f, 3.607435664e-03f, -4.115833735e-03f, -4.775670939e-03f, -6.319466815e-04f, 2.251983453e-03f,
+    1.681566422e-03f, -1.448891493e-04f, -8.572630998e-04f, -3.903278378e-04f, 1.241778987e-04f, 1.681430599e-04f,
+    1.363564135e-04f, 1.734327583e-04f, -2.390883643e-04f, -8.157082113e-04f, -4.494737334e-04f, 1.255687122e-03f,
+    2.392191020e-03f, 3.206018273e-04f, -4.013116806e-03f, -4.961127193e-03f, 1.445998376e-03f, 9.709891275e-03f,
+    7.909634302e-03f, -7.059603271e-03f, -1.965614412e-02f, -9.478111872e-03f, 2.044350838e-02f, 3.598332325e-02f,
+    5.756861072e-03f, -5.223091314e-02f, -6.817181551e-02f, 1.827951588e-02f, 1.866276437e-01f, 3.327941918e-01f,
+    3.512343257e-01f, 2.280873256e-01f, 5.373541819e-02f, -5.782743413e-02f, -6.286164428e-02f, -7.523937233e-03f,
+    3.333927258e-02f, 2.704249876e-02f, -3.284088846e-03f, -1.976144334e-02f, -1.115242433e-02f, 5.264921409e-03f,
+    1.058463220e-02f, 3.666341069e-03f, -4.086904199e-03f, -4.792861705e-03f, -6.592212836e-04f, 2.245379990e-03f,
+    1.692347080e-03f, -1.355883608e-04f, -8.574993418e-04f, -3.944955307e-04f, 1.224452600e-04f, 1.688997606e-04f,
+    1.354231014e-04f, 1.743730683e-04f, -2.351407316e-04f, -8.137733920e-04f, -4.565804294e-04f, 1.243649610e-03f,
+    2.393254371e-03f, 3.445364204e-04f, -3.989514754e-03f, -4.977834880e-03f, 1.388821484e-03f, 9.677932482e-03f,
+    7.968216785e-03f, -6.949087458e-03f, -1.963353608e-02f, -9.625087058e-03f, 2.025619070e-02f, 3.601375030e-02f,
+    6.084550437e-03f, -5.191362051e-02f, -6.835864124e-02f, 1.741032611e-02f, 1.855121589e-01f, 3.322009472e-01f,
+    3.516075859e-01f, 2.291455301e-01f, 5.472689327e-02f, -5.746846050e-02f, -6.309846409e-02f, -7.891451146e-03f,
+    3.322998070e-02f, 2.719960144e-02f, -3.106741662e-03f, -1.974361361e-02f, -1.125569736e-02f, 5.184875657e-03f,
+    1.059802694e-02f, 3.725231139e-03f, -4.057659777e-03f, -4.809850650e-03f, -6.865605171e-04f, 2.238624750e-03f,
+    1.703078535e-03f, -1.262349022e-04f, -8.576851526e-04f, -3.986640774e-04f, 1.206911181e-04f, 1.696495465e-04f,
+    1.344873166e-04f, 1.752935257e-04f, -2.312033828e-04f, -8.117999787e-04f, -4.636255217e-04f, 1.231594796e-03f,
+    2.394179796e-03f, 3.683622226e-04f, -3.965778077e-03f, -4.994219056e-03f, 1.331747872e-03f, 9.645552822e-03f,
+    8.026210202e-03f, -6.838509642e-03f, -1.960995620e-02f, -9.771162317e-03f, 2.006832202e-02f, 3.604221100e-02f,
+    6.410940207e-03f, -5.159468309e-02f, -6.854117811e-02f, 1.654467003e-02f, 1.843958530e-01f, 3.316023957e-01f,
+    3.519749199e-01f, 2.302016226e-01f, 5.572106657e-02f, -5.710498960e-02f, -6.333280947e-02f, -8.259682670e-03f,
+    3.311863697e-02f, 2.735570842e-02f, -2.928752618e-03f, -1.972469486e-02f, -1.135865908e-02f, 5.104328073e-03f,
+    1.061089559e-02f, 3.784102617e-03f, -4.028101070e-03f, -4.826636143e-03f, -7.139630727e-04f, 2.231717531e-03f,
+    1.713759950e-03f, -1.168290960e-04f, -8.578202613e-04f, -4.028332032e-04f, 1.189154587e-04f, 1.703922976e-04f,
+    1.335491649e-04f, 1.761941981e-04f, -2.272765242e-04f, -8.097882998e-04f, -4.706088730e-04f, 1.219523464e-03f,
+    2.394967785e-03f, 3.920782884e-04f, -3.941908559e-03f, -5.010279869e-03f, 1.274780331e-03f, 9.612755275e-03f,
+    8.083613108e-03f, -6.727875872e-03f, -1.958540833e-02f, -9.916332403e-03f, 1.987991357e-02f, 3.606870938e-02f,
+    6.736017775e-03f, -5.127412208e-02f, -6.871943442e-02f, 1.568256554e-02f, 1.832787585e-01f, 3.309985563e-01f,
+    3.523363162e-01f, 2.312555715e-01f, 5.671791435e-02f, -5.673701943e-02f, -6.356466037e-02f, -8.628615441e-03f,
+    3.300524125e-02f, 2.751080887e-02f, -2.750129318e-03f, -1.970468516e-02f, -1.146130317e-02f, 5.023281566e-03f,
+    1.062323592e-02f, 3.842952241e-03f, -3.998228697e-03f, -4.843216559e-03f, -7.414276328e-04f, 2.224658136e-03f,
+    1.724390484e-03f, -1.073712691e-04f, -8.579043986e-04f, -4.070026319e-04f, 1.171182689e-04f, 1.711278939e-04f,
+    1.326087516e-04f, 1.770751540e-04f, -2.233603606e-04f, -8.077386850e-04f, -4.775303505e-04f, 1.207436395e-03f,
+    2.395618839e-03f, 4.156836817e-04f, -3.917907984e-03f, -5.026017481e-03f, 1.217921636e-03f, 9.579542835e-03f,
+    8.140424092e-03f, -6.617192180e-03f, -1.955989636e-02f, -1.006059213e-02f, 1.969097660e-02f, 3.609324957e-02f,
+    7.059770629e-03f, -5.095195865e-02f, -6.889341860e-02f, 1.482403033e-02f, 1.821609079e-01f, 3.303894480e-01f,
+    3.526917631e-01f, 2.323073450e-01f, 5.771741275e-02f, -5.636454815e-02f, -6.379399681e-02f, -8.998233010e-03f,
+    3.288979350e-02f, 2.766489199e-02f, -2.570879420e-03f, -1.968358263e-02f, -1.156362331e-02f, 4.941739082e-03f,
+    1.063504572e-02f, 3.901776736e-03f, -3.968043299e-03f, -4.859590279e-03f, -7.689528716e-04f, 2.217446378e-03f,
+    1.734969298e-03f, -9.786175300e-05f, -8.579372975e-04f, -4.111720858e-04f, 1.152995376e-04f, 1.718562149e-04f,
+    1.316661815e-04f, 1.779364633e-04f, -2.194550947e-04f, -8.056514645e-04f, -4.843898260e-04f, 1.195334371e-03f,
+    2.396133463e-03f, 4.391774761e-04f, -3.893778141e-03f, -5.041432074e-03f, 1.161174549e-03f, 9.545918511e-03f,
+    8.196641781e-03f, -6.506464588e-03f, -1.953342424e-02f, -1.020393638e-02f, 1.950152234e-02f, 3.611583580e-02f,
+    7.382186361e-03f, -5.062821399e-02f, -6.906313921e-02f, 1.396908196e-02f, 1.810423334e-01f, 3.297750904e-01f,
+    3.530412491e-01f, 2.333569115e-01f, 5.871953779e-02f, -5.598757409e-02f, -6.402079885e-02f, -9.368518849e-03f,
+    3.277229382e-02f, 2.781794701e-02f, -2.391010634e-03f, -1.966138546e-02f, -1.166561317e-02f, 4.859703600e-03f,
+    1.064632282e-02f, 3.960572823e-03f, -3.937545535e-03f, -4.875755689e-03f, -7.965374554e-04f, 2.210082077e-03f,
+    1.745495551e-03f, -8.830088417e-05f, -8.579186930e-04f, -4.153412856e-04f, 1.134592550e-04f, 1.725771403e-04f,
+    1.307215590e-04f, 1.787781965e-04f, -2.155609275e-04f, -8.035269696e-04f, -4.911871757e-04f, 1.183218168e-03f,
+    2.396512169e-03f, 4.625587552e-04f, -3.869520817e-03f, -5.056523846e-03f, 1.104541819e-03f, 9.511885324e-03f,
+    8.252264838e-03f, -6.395699101e-03f, -1.950599593e-02f, -1.034636008e-02f, 1.931156203e-02f, 3.613647237e-02f,
+    7.703252661e-03f, -5.030290932e-02f, -6.922860497e-02f, 1.311773784e-02f, 1.799230676e-01f, 3.291555028e-01f,
+    3.533847632e-01f, 2.344042393e-01f, 5.972426536e-02f, -5.560609574e-02f, -6.424504659e-02f, -9.739456350e-03f,
+    3.265274236e-02f, 2.796996316e-02f, -2.210530722e-03f, -1.963809187e-02f, -1.176726642e-02f, 4.777178135e-03f,
+    1.065706506e-02f, 4.019337211e-03f, -3.906736082e-03f, -4.891711185e-03f, -8.241800419e-04f, 2.202565063e-03f,
+    1.755968405e-03f, -7.868900358e-05f, -8.578483219e-04f, -4.195099506e-04f, 1.115974130e-04f, 1.732905493e-04f,
+    1.297749878e-04f, 1.796004257e-04f, -2.116780580e-04f, -8.013655322e-04f, -4.979222802e-04f, 1.171088563e-03f,
+    2.396755474e-03f, 4.858266123e-04f, -3.845137803e-03f, -5.071293014e-03f, 1.048026177e-03f, 9.477446311e-03f,
+    8.307291961e-03f, -6.284901712e-03f, -1.947761545e-02f, -1.048785825e-02f, 1.912110689e-02f, 3.615516367e-02f,
+    8.022957321e-03f, -4.997606583e-02f, -6.938982474e-02f, 1.227001522e-02f, 1.788031428e-01f, 3.285307050e-01f,
+    3.537222942e-01f, 2.354492969e-01f, 6.073157121e-02f, -5.522011176e-02f, -6.446672020e-02f, -1.011102882e-02f,
+    3.253113943e-02f, 2.812092973e-02f, -2.029447498e-03f, -1.961370014e-02f, -1.186857674e-02f, 4.694165738e-03f,
+    1.066727030e-02f, 4.078066605e-03f, -3.875615640e-03f, -4.907455165e-03f, -8.518792811e-04f, 2.194895172e-03f,
+    1.766387017e-03f, -6.902645692e-05f, -8.577259236e-04f, -4.236777989e-04f, 1.097140049e-04f, 1.739963213e-04f,
+    1.288265713e-04f, 1.804032237e-04f, -2.078066833e-04f, -7.991674852e-04f, -5.045950246e-04f, 1.158946328e-03f,
+    2.396863902e-03f, 5.089801503e-04f, -3.820630887e-03f, -5.085739811e-03f, 9.916303410e-04f, 9.442604520e-03f,
+    8.361721882e-03f, -6.174078399e-03f, -1.944828686e-02f, -1.062842592e-02f, 1.893016816e-02f, 3.617191418e-02f,
+    8.341288235e-03f, -4.964770474e-02f, -6.954680751e-02f, 1.142593119e-02f, 1.776825914e-01f, 3.279007166e-01f,
+    3.540538314e-01f, 2.364920527e-01f, 6.174143097e-02f, -5.482962095e-02f, -6.468579987e-02f, -1.048321950e-02f,
+    3.240748539e-02f, 2.827083600e-02f, -1.847768830e-03f, -1.958820863e-02f, -1.196953781e-02f, 4.610669491e-03f,
+    1.067693644e-02f, 4.136757698e-03f, -3.844184925e-03f, -4.922986036e-03f, -8.796338147e-04f, 2.187072251e-03f,
+    1.776750548e-03f, -5.931359456e-05f, -8.575512391e-04f, -4.278445467e-04f, 1.078090257e-04f, 1.746943353e-04f,
+    1.278764120e-04f, 1.811866645e-04f, -2.039469988e-04f, -7.969331621e-04f, -5.112052984e-04f, 1.146792233e-03f,
+    2.396837982e-03f, 5.320184821e-04f, -3.796001863e-03f, -5.099864487e-03f, 9.353570150e-04f, 9.407363015e-03f,
+    8.415553373e-03f, -6.063235123e-03f, -1.941801425e-02f, -1.076805824e-02f, 1.873875705e-02f, 3.618672847e-02f,
+    8.658233395e-03f, -4.931784725e-02f, -6.969956241e-02f, 1.058550267e-02f, 1.765614458e-01f, 3.272655578e-01f,
+    3.543793641e-01f, 2.375324752e-01f, 6.275382015e-02f, -5.443462230e-02f, -6.490226588e-02f, -1.085601153e-02f,
+    3.228178074e-02f, 2.841967129e-02f, -1.665502635e-03f, -1.956161571e-02f, -1.207014329e-02f, 4.526692514e-03f,
+    1.068606139e-02f, 4.195407177e-03f, -3.812444674e-03f, -4.938302214e-03f, -9.074422767e-04f, 2.179096153e-03f,
+    1.787058157e-03f, -4.955077154e-05f, -8.573240118e-04f, -4.320099091e-04f, 1.058824721e-04f, 1.753844702e-04f,
+    1.269246123e-04f, 1.819508231e-04f, -2.000991979e-04f, -7.946628971e-04f, -5.177529955e-04f, 1.134627047e-03f,
+    2.396678250e-03f, 5.549407304e-04f, -3.771252523e-03f, -5.113667311e-03f, 8.792088870e-04f, 9.371724870e-03f,
+    8.468785237e-03f, -5.952377835e-03f, -1.938680175e-02f, -1.090675038e-02f, 1.854688478e-02f, 3.619961118e-02f,
+    8.973780900e-03f, -4.898651459e-02f, -6.984809872e-02f, 9.748746447e-03f, 1.754397384e-01f, 3.266252486e-01f,
+    3.546988819e-01f, 2.385705330e-01f, 6.376871414e-02f, -5.403511495e-02f, -6.511609853e-02f, -1.122938799e-02f,
+    3.215402607e-02f, 2.856742495e-02f, -1.482656885e-03f, -1.953391984e-02f, -1.217038687e-02f, 4.442237961e-03f,
+    1.069464308e-02f, 4.254011723e-03f, -3.780395645e-03f, -4.953402118e-03f, -9.353032931e-04f, 2.170966741e-03f,
+    1.797309003e-03f, -3.973834758e-05f, -8.570439874e-04f, -4.361735996e-04f, 1.039343422e-04f, 1.760666049e-04f,
+    1.259712739e-04f, 1.826957756e-04f, -1.962634720e-04f, -7.923570254e-04f, -5.242380143e-04f, 1.122451535e-03f,
+    2.396385247e-03f, 5.777460278e-04f, -3.746384659e-03f, -5.127148567e-03f, 8.231886302e-04f, 9.335693173e-03f,
+    8.521416317e-03f, -5.841512465e-03f, -1.935465354e-02f, -1.104449758e-02f, 1.835456256e-02f, 3.621056704e-02f,
+    9.287918946e-03f, -4.865372798e-02f, -6.999242585e-02f, 8.915679134e-03f, 1.743175014e-01f, 3.259798093e-01f,
+    3.550123744e-01f, 2.396061947e-01f, 6.478608819e-02f, -5.363109822e-02f, -6.532727819e-02f, -1.160333187e-02f,
+    3.202422207e-02f, 2.871408636e-02f, -1.299239599e-03f, -1.950511951e-02f, -1.227026224e-02f, 4.357309019e-03f,
+    1.070267947e-02f, 4.312568007e-03f, -3.748038614e-03f, -4.968284175e-03f, -9.632154818e-04f, 2.162683886e-03f,
+    1.807502246e-03f, -2.987668707e-05f, -8.567109136e-04f, -4.403353305e-04f, 1.019646357e-04f, 1.767406179e-04f,
+    1.250164978e-04f, 1.834215991e-04f, -1.924400108e-04f, -7.900158826e-04f, -5.306602575e-04f, 1.110266461e-03f,
+    2.395959521e-03f, 6.004335165e-04f, -3.721400067e-03f, -5.140308558e-03f, 7.672989028e-04f, 9.299271026e-03f,
+    8.573445489e-03f, -5.730644933e-03f, -1.932157383e-02f, -1.118129516e-02f, 1.816180160e-02f, 3.621960087e-02f,
+    9.600635835e-03f, -4.831950863e-02f, -7.013255335e-02f, 8.086317192e-03f, 1.731947672e-01f, 3.253292604e-01f,
+    3.553198317e-01f, 2.406394289e-01f, 6.580591744e-02f, -5.322257158e-02f, -6.553578529e-02f, -1.197782609e-02f,
+    3.189236954e-02f, 2.885964492e-02f, -1.115258850e-03f, -1.947521329e-02f, -1.236976308e-02f, 4.271908910e-03f,
+    1.071016856e-02f, 4.371072694e-03f, -3.715374378e-03f, -4.982946822e-03f, -9.911774532e-04f, 2.154247468e-03f,
+    1.817637044e-03f, -1.996615905e-05f, -8.563245404e-04f, -4.444948126e-04f, 9.997335412e-05f, 1.774063880e-04f,
+    1.240603846e-04f, 1.841283716e-04f, -1.886290020e-04f, -7.876398050e-04f, -5.370196322e-04f, 1.098072584e-03f,
+    2.395401623e-03f, 6.230023491e-04f, -3.696300540e-03f, -5.153147603e-03f, 7.115423478e-04f, 9.262461541e-03f,
+    8.624871664e-03f, -5.619781138e-03f, -1.928756686e-02f, -1.131713848e-02f, 1.796861309e-02f, 3.622671757e-02f,
+    9.911919970e-03f, -4.798387776e-02f, -7.026849091e-02f, 7.260676921e-03f, 1.720715681e-01f, 3.246736225e-01f,
+    3.556212438e-01f, 2.416702043e-01f, 6.682817690e-02f, -5.280953466e-02f, -6.574160031e-02f, -1.235285350e-02f,
+    3.175846940e-02f, 2.900409006e-02f, -9.307227605e-04f, -1.944419977e-02f, -1.246888307e-02f, 4.186040892e-03f,
+    1.071710833e-02f, 4.429522442e-03f, -3.682403750e-03f, -4.997388499e-03f, -1.019187810e-03f, 2.145657374e-03f,
+    1.827712558e-03f, -1.000713724e-05f, -8.558846199e-04f, -4.486517551e-04f, 9.796050038e-05f, 1.780637936e-04f,
+    1.231030344e-04f, 1.848161722e-04f, -1.848306314e-04f, -7.852291297e-04f, -5.433160499e-04f, 1.085870663e-03f,
+    2.394712112e-03f, 6.454516875e-04f, -3.671087873e-03f, -5.165666038e-03f, 6.559215926e-04f, 9.225267844e-03f,
+    8.675693792e-03f, -5.508926966e-03f, -1.925263693e-02f, -1.145202297e-02f, 1.777500821e-02f, 3.623192213e-02f,
+    1.022175986e-02f, -4.764685660e-02f, -7.040024835e-02f, 6.438774460e-03f, 1.709479363e-01f, 3.240129163e-01f,
+    3.559166012e-01f, 2.426984898e-01f, 6.785284146e-02f, -5.239198727e-02f, -6.594470377e-02f, -1.272839686e-02f,
+    3.162252264e-02f, 2.914741123e-02f, -7.456395033e-04f, -1.941207763e-02f, -1.256761591e-02f, 4.099708254e-03f,
+    1.072349684e-02f, 4.487913902e-03f, -3.649127568e-03f, -5.011607656e-03f, -1.047245146e-03f, 2.136913501e-03f,
+    1.837727947e-03f, 1.207104220e-18f, -8.553909068e-04f, -4.528058662e-04f, 9.592607911e-05f, 1.787127130e-04f,
+    1.221445466e-04f, 1.854850811e-04f, -1.810450829e-04f, -7.827841941e-04f, -5.495494264e-04f, 1.073661453e-03f,
+    2.393891553e-03f, 6.677807039e-04f, -3.645763863e-03f, -5.177864216e-03f, 6.004392495e-04f, 9.187693072e-03f,
+    8.725910856e-03f, -5.398088287e-03f, -1.921678836e-02f, -1.158594413e-02f, 1.758099815e-02f, 3.623521962e-02f,
+    1.053014410e-02f, -4.730846636e-02f, -7.052783563e-02f, 5.620625791e-03f, 1.698239042e-01f, 3.233471626e-01f,
+    3.562058942e-01f, 2.437242541e-01f, 6.887988590e-02f, -5.196992939e-02f, -6.614507628e-02f, -1.310443885e-02f,
+    3.148453038e-02f, 2.928959793e-02f, -5.600173013e-04f, -1.937884558e-02f, -1.266595529e-02f, 4.012914322e-03f,
+    1.072933213e-02f, 4.546243718e-03f, -3.615546686e-03f, -5.025602751e-03f, -1.075348050e-03f, 2.128015755e-03f,
+    1.847682371e-03f, 1.005486963e-05f, -8.548431579e-04f, -4.569568525e-04f, 9.387009661e-05f, 1.793530247e-04f,
+    1.211850201e-04f, 1.861351791e-04f, -1.772725385e-04f, -7.803053365e-04f, -5.557196819e-04f, 1.061445705e-03f,
+    2.392940515e-03f, 6.899885804e-04f, -3.620330304e-03f, -5.189742506e-03f, 5.450979151e-04f, 9.149740373e-03f,
+    8.775521873e-03f, -5.287270953e-03f, -1.918002550e-02f, -1.171889751e-02f, 1.738659409e-02f, 3.623661517e-02f,
+    1.083706143e-02f, -4.696872826e-02f, -7.065126284e-02f, 4.806246736e-03f, 1.686995039e-01f, 3.226763827e-01f,
+    3.564891136e-01f, 2.447474661e-01f, 6.990928487e-02f, -5.154336115e-02f, -6.634269848e-02f, -1.348096210e-02f,
+    3.134449384e-02f, 2.943063967e-02f, -3.738644272e-04f, -1.934450239e-02f, -1.276389492e-02f, 3.925662454e-03f,
+    1.073461229e-02f, 4.604508526e-03f, -3.581661978e-03f, -5.039372248e-03f, -1.103495101e-03f, 2.118964049e-03f,
+    1.857574990e-03f, 2.015708400e-05f, -8.542411324e-04f, -4.611044194e-04f, 9.179256077e-05f, 1.799846068e-04f,
+    1.202245532e-04f, 1.867665484e-04f, -1.735131782e-04f, -7.777928956e-04f, -5.618267408e-04f, 1.049224170e-03f,
+    2.391859574e-03f, 7.120745088e-04f, -3.594788993e-03f, -5.201301295e-03f, 4.899001703e-04f, 9.111412910e-03f,
+    8.824525900e-03f, -5.176480798e-03f, -1.914235276e-02f, -1.185087873e-02f, 1.719180718e-02f, 3.623611402e-02f,
+    1.114250064e-02f, -4.662766350e-02f, -7.077054022e-02f, 3.995652954e-03f, 1.675747676e-01f, 3.220005977e-01f,
+    3.567662503e-01f, 2.457680947e-01f, 7.094101289e-02f, -5.111228285e-02f, -6.653755109e-02f, -1.385794914e-02f,
+    3.120241434e-02f, 2.957052599e-02f, -1.871892031e-04f, -1.930904690e-02f, -1.286142849e-02f, 3.837956044e-03f,
+    1.073933542e-02f, 4.662704959e-03f, -3.547474340e-03f, -5.052914618e-03f, -1.131684870e-03f, 2.109758307e-03f,
+    1.867404964e-03f, 3.030625077e-05f, -8.535845918e-04f, -4.652482710e-04f, 8.969348117e-05f, 1.806073376e-04f,
+    1.192632438e-04f, 1.873792719e-04f, -1.697671802e-04f, -7.752472106e-04f, -5.678705320e-04f, 1.036997594e-03f,
+    2.390649309e-03f, 7.340376911e-04f, -3.569141726e-03f, -5.212540986e-03f, 4.348485804e-04f, 9.072713852e-03f,
+    8.872922025e-03f, -5.065723642e-03f, -1.910377458e-02f, -1.198188347e-02f, 1.699664857e-02f, 3.623372148e-02f,
+    1.144645066e-02f, -4.628529330e-02f, -7.088567813e-02f, 3.188859946e-03f, 1.664497276e-01f, 3.213198290e-01f,
+    3.570372954e-01f, 2.467861090e-01f, 7.197504440e-02f, -5.067669497e-02f, -6.672961488e-02f, -1.423538244e-02f,
+    3.105829332e-02f, 2.970924649e-02f, 9.666982960e-18f, -1.927247798e-02f, -1.295854971e-02f, 3.749798519e-03f,
+    1.074349965e-02f, 4.720829641e-03f, -3.512984685e-03f, -5.066228342e-03f, -1.159915923e-03f, 2.100398460e-03f,
+    1.877171454e-03f, 4.050197302e-05f, -8.528732999e-04f, -4.693881099e-04f, 8.757286903e-05f, 1.812210952e-04f,
+    1.183011889e-04f, 1.879734334e-04f, -1.660347208e-04f, -7.726686213e-04f, -5.738509887e-04f, 1.024766723e-03f,
+    2.389310307e-03f, 7.558773392e-04f, -3.543390298e-03f, -5.223461999e-03f, 3.799456948e-04f, 9.033646384e-03f,
+    8.920709374e-03f, -4.955005284e-03f, -1.906429541e-02f, -1.211190746e-02f, 1.680112942e-02f, 3.622944295e-02f,
+    1.174890052e-02f, -4.594163886e-02f, -7.099668706e-02f, 2.385883051e-03f, 1.653244160e-01f, 3.206340980e-01f,
+    3.573022402e-01f, 2.478014780e-01f, 7.301135367e-02f, -5.023659813e-02f, -6.691887067e-02f, -1.461324440e-02f,
+    3.091213230e-02f, 2.984679076e-02f, 1.876947620e-04f, -1.923479459e-02f, -1.305525230e-02f, 3.661193338e-03f,
+    1.074710314e-02f, 4.778879191e-03f, -3.478193947e-03f, -5.079311908e-03f, -1.188186816e-03f, 2.090884448e-03f,
+    1.886873622e-03f, 5.074384914e-05f, -8.521070232e-04f, -4.735236375e-04f, 8.543073724e-05f, 1.818257576e-04f,
+    1.173384852e-04f, 1.885491179e-04f, -1.623159742e-04f, -7.700574680e-04f, -5.797680481e-04f, 1.012532296e-03f,
+    2.387843159e-03f, 7.775926750e-04f, -3.517536506e-03f, -5.234064770e-03f, 3.251940470e-04f, 8.994213699e-03f,
+    8.967887108e-03f, -4.844331509e-03f, -1.902391978e-02f, -1.224094652e-02f, 1.660526085e-02f, 3.622328390e-02f,
+    1.204983934e-02f, -4.559672137e-02f, -7.110357765e-02f, 1.586737445e-03f, 1.641988650e-01f, 3.199434265e-01f,
+    3.575610761e-01f, 2.488141707e-01f, 7.404991489e-02f, -4.979199315e-02f, -6.710529938e-02f, -1.499151732e-02f,
+    3.076393294e-02f, 2.998314846e-02f, 3.758866144e-04f, -1.919599571e-02f, -1.315152998e-02f, 3.572143996e-03f,
+    1.075014407e-02f, 4.836850222e-03f, -3.443103080e-03f, -5.092163812e-03f, -1.216496100e-03f, 2.081216220e-03f,
+    1.896510630e-03f, 6.103147294e-05f, -8.512855305e-04f, -4.776545540e-04f, 8.326710037e-05f, 1.824212030e-04f,
+    1.163752286e-04f, 1.891064110e-04f, -1.586111128e-04f, -7.674140913e-04f, -5.856216521e-04f, 1.000295053e-03f,
+    2.386248462e-03f, 7.991829302e-04f, -3.491582144e-03f, -5.244349752e-03f, 2.705961545e-04f, 8.954419003e-03f,
+    9.014454422e-03f, -4.733708080e-03f, -1.898265222e-02f, -1.236899650e-02f, 1.640905398e-02f, 3.621524987e-02f,
+    1.234925636e-02f, -4.525056202e-02f, -7.120636066e-02f, 7.914381439e-04f, 1.630731065e-01f, 3.192478363e-01f,
+    3.578137948e-01f, 2.498241564e-01f, 7.509070214e-02f, -4.934288100e-02f, -6.728888194e-02f, -1.537018347e-02f,
+    3.061369698e-02f, 3.011830926e-02f, 5.645670405e-04f, -1.915608040e-02f, -1.324737647e-02f, 3.482654021e-03f,
+    1.075262066e-02f, 4.894739340e-03f, -3.407713057e-03f, -5.104782557e-03f, -1.244842317e-03f, 2.071393734e-03f,
+    1.906081638e-03f, 7.136443358e-05f, -8.504085929e-04f, -4.817805583e-04f, 8.108197469e-05f, 1.830073094e-04f,
+    1.154115145e-04f, 1.896453993e-04f, -1.549203071e-04f, -7.647388323e-04f, -5.914117464e-04f, 9.880557279e-04f,
+    2.384526817e-03f, 8.206473467e-04f, -3.465529008e-03f, -5.254317413e-03f, 2.161545186e-04f, 8.914265509e-03f,
+    9.060410547e-03f, -4.623140745e-03f, -1.894049730e-02f, -1.249605335e-02f, 1.621251992e-02f, 3.620534651e-02f,
+    1.264714091e-02f, -4.490318199e-02f, -7.130504697e-02f, 1.357229102e-17f, 1.619471728e-01f, 3.185473493e-01f,
+    3.580603882e-01f, 2.508314043e-01f, 7.613368935e-02f, -4.888926281e-02f, -6.746959939e-02f, -1.574922502e-02f,
+    3.046142628e-02f, 3.025226286e-02f, 7.537274759e-04f, -1.911504777e-02f, -1.334278550e-02f, 3.392726974e-03f,
+    1.075453112e-02f, 4.952543148e-03f, -3.372024870e-03f, -5.117166657e-03f, -1.273224001e-03f, 2.061416958e-03f,
+    1.915585811e-03f, 8.174231564e-05f, -8.494759842e-04f, -4.859013480e-04f, 7.887537814e-05f, 1.835839549e-04f,
+    1.144474378e-04f, 1.901661705e-04f, -1.512437255e-04f, -7.620320327e-04f, -5.971382814e-04f, 9.758150546e-04f,
+    2.382678832e-03f, 8.419851764e-04f, -3.439378893e-03f, -5.263968239e-03f, 1.618716246e-04f, 8.873756444e-03f,
+    9.105754750e-03f, -4.512635233e-03f, -1.889745965e-02f, -1.262211304e-02f, 1.601566977e-02f, 3.619357952e-02f,
+    1.294348245e-02f, -4.455460247e-02f, -7.139964762e-02f, -7.875622963e-04f, 1.608210958e-01f, 3.178419877e-01f,
+    3.583008484e-01f, 2.518358837e-01f, 7.717885037e-02f, -4.843113989e-02f, -6.764743281e-02f, -1.612862407e-02f,
+    3.030712278e-02f, 3.038499902e-02f, 9.433593083e-04f, -1.907289698e-02f, -1.343775080e-02f, 3.302366449e-03f,
+    1.075587372e-02f, 5.010258241e-03f, -3.336039533e-03f, -5.129314632e-03f, -1.301639682e-03f, 2.051285866e-03f,
+    1.925022312e-03f, 9.216469906e-05f, -8.484874807e-04f, -4.900166195e-04f, 7.664733036e-05f, 1.841510174e-04f,
+    1.134830926e-04f, 1.906688129e-04f, -1.475815348e-04f, -7.592940342e-04f, -6.028012113e-04f, 9.635737622e-04f,
+    2.380705119e-03f, 8.631956812e-04f, -3.413133593e-03f, -5.273302731e-03f, 1.077499412e-04f, 8.832895043e-03f,
+    9.150486331e-03f, -4.402197252e-03f, -1.885354391e-02f, -1.274717163e-02f, 1.581851460e-02f, 3.617995470e-02f,
+    1.323827051e-02f, -4.420484459e-02f, -7.149017376e-02f, -1.571234218e-03f, 1.596949076e-01f, 3.171317736e-01f,
+    3.585351677e-01f, 2.528375640e-01f, 7.822615892e-02f, -4.796851371e-02f, -6.782236336e-02f, -1.650836267e-02f,
+    3.015078858e-02f, 3.051650751e-02f, 1.133453879e-03f, -1.902962726e-02f, -1.353226614e-02f, 3.211576075e-03f,
+    1.075664675e-02f, 5.067881210e-03f, -3.299758079e-03f, -5.141225011e-03f, -1.330087881e-03f, 2.041000444e-03f,
+    1.934390305e-03f, 1.026311592e-04f, -8.474428612e-04f, -4.941260679e-04f, 7.439785270e-05f, 1.847083750e-04f,
+    1.125185726e-04f, 1.911534158e-04f, -1.439338995e-04f, -7.565251793e-04f, -6.084004949e-04f, 9.513325773e-04f,
+    2.378606294e-03f, 8.842781328e-04f, -3.386794901e-03f, -5.282321407e-03f, 5.379192104e-05f, 8.791684553e-03f,
+    9.194604628e-03f, -4.291832494e-03f, -1.880875475e-02f, -1.287122525e-02f, 1.562106550e-02f, 3.616447790e-02f,
+    1.353149476e-02f, -4.385392953e-02f, -7.157663666e-02f, -2.351001401e-03f, 1.585686401e-01f, 3.164167296e-01f,
+    3.587633384e-01f, 2.538364145e-01f, 7.927558860e-02f, -4.750138592e-02f, -6.799437226e-02f, -1.688842277e-02f,
+    2.999242582e-02f, 3.064677814e-02f, 1.324002480e-03f, -1.898523788e-02f, -1.362632525e-02f, 3.120359512e-03f,
+    1.075684851e-02f, 5.125408642e-03f, -3.263181559e-03f, -5.152896333e-03f, -1.358567110e-03f, 2.030560686e-03f,
+    1.943688954e-03f, 1.131412669e-04f, -8.463419070e-04f, -4.982293872e-04f, 7.212696824e-05f, 1.852559057e-04f,
+    1.115539706e-04f, 1.916200694e-04f, -1.403009823e-04f, -7.537258104e-04f, -6.139360948e-04f, 9.390922233e-04f,
+    2.376382981e-03f, 9.052318134e-04f, -3.360364609e-03f, -5.291024800e-03f, 4.616459898e-18f, 8.750128227e-03f,
+    9.238109012e-03f, -4.181546628e-03f, -1.876309689e-02f, -1.299427006e-02f, 1.542333351e-02f, 3.614715508e-02f,
+    1.382314495e-02f, -4.350187842e-02f, -7.165904775e-02f, -3.126849644e-03f, 1.574423252e-01f, 3.156968782e-01f,
+    3.589853532e-01f, 2.548324049e-01f, 8.032711293e-02f, -4.702975833e-02f, -6.816344079e-02f, -1.726878628e-02f,
+    2.983203681e-02f, 3.077580077e-02f, 1.514996361e-03f, -1.893972818e-02f, -1.371992189e-02f, 3.028720455e-03f,
+    1.075647734e-02f, 5.182837116e-03f, -3.226311045e-03f, -5.164327142e-03f, -1.387075878e-03f, 2.019966594e-03f,
+    1.952917427e-03f, 1.236945882e-04f, -8.451844022e-04f, -5.023262702e-04f, 6.983470176e-05f, 1.857934878e-04f,
+    1.105893791e-04f, 1.920688647e-04f, -1.366829440e-04f, -7.508962705e-04f, -6.194079782e-04f, 9.268534207e-04f,
+    2.374035807e-03f, 9.260560148e-04f, -3.333844511e-03f, -5.299413459e-03f, -5.362340243e-05f, 8.708229330e-03f,
+    9.280998888e-03f, -4.071345309e-03f, -1.871657509e-02f, -1.311630232e-02f, 1.522532967e-02f, 3.612799225e-02f,
+    1.411321095e-02f, -4.314871238e-02f, -7.173741855e-02f, -3.898764913e-03f, 1.563159950e-01f, 3.149722420e-01f,
+    3.592012050e-01f, 2.558255046e-01f, 8.138070529e-02f, -4.655363292e-02f, -6.832955031e-02f, -1.764943502e-02f,
+    2.966962393e-02f, 3.090356528e-02f, 1.706426721e-03f, -1.889309756e-02f, -1.381304984e-02f, 2.936662630e-03f,
+    1.075553161e-02f, 5.240163210e-03f, -3.189147629e-03f, -5.175515996e-03f, -1.415612684e-03f, 2.009218179e-03f,
+    1.962074888e-03f, 1.342906848e-04f, -8.439701332e-04f, -5.064164085e-04f, 6.752107978e-05f, 1.863209992e-04f,
+    1.096248897e-04f, 1.924998934e-04f, -1.330799434e-04f, -7.480369027e-04f, -6.248161162e-04f, 9.146168868e-04f,
+    2.371565402e-03f, 9.467500390e-04f, -3.307236397e-03f, -5.307487951e-03f, -1.070758835e-04f, 8.665991137e-03f,
+    9.323273698e-03f, -3.961234166e-03f, -1.866919412e-02f, -1.323731831e-02f, 1.502706502e-02f, 3.610699552e-02f,
+    1.440168273e-02f, -4.279445254e-02f, -7.181176074e-02f, -4.666733334e-03f, 1.551896811e-01f, 3.142428439e-01f,
+    3.594108869e-01f, 2.568156833e-01f, 8.243633895e-02f, -4.607301183e-02f, -6.849268225e-02f, -1.803035076e-02f,
+    2.950518967e-02f, 3.103006159e-02f, 1.898284716e-03f, -1.884534547e-02f, -1.390570287e-02f, 2.844189797e-03f,
+    1.075400971e-02f, 5.297383496e-03f, -3.151692423e-03f, -5.186461459e-03f, -1.444176022e-03f, 1.998315464e-03f,
+    1.971160506e-03f, 1.449291138e-04f, -8.426988894e-04f, -5.104994925e-04f, 6.518613054e-05f, 1.868383181e-04f,
+    1.086605936e-04f, 1.929132483e-04f, -1.294921374e-04f, -7.451480506e-04f, -6.301604840e-04f, 9.023833357e-04f,
+    2.368972405e-03f, 9.673131982e-04f, -3.280542056e-03f, -5.315248855e-03f, -1.603550570e-04f, 8.623416931e-03f,
+    9.364932919e-03f, -3.851218813e-03f, -1.862095879e-02f, -1.335731443e-02f, 1.482855056e-02f, 3.608417106e-02f,
+    1.468855037e-02f, -4.243911999e-02f, -7.188208612e-02f, -5.430741200e-03f, 1.540634156e-01f, 3.135087069e-01f,
+    3.596143920e-01f, 2.578029107e-01f, 8.349398710e-02f, -4.558789738e-02f, -6.865281810e-02f, -1.841151519e-02f,
+    2.933873664e-02f, 3.115527967e-02f, 2.090561456e-03f, -1.879647141e-02f, -1.399787475e-02f, 2.751305749e-03f,
+    1.075191005e-02f, 5.354494540e-03f, -3.113946557e-03f, -5.197162102e-03f, -1.472764377e-03f, 1.987258478e-03f,
+    1.980173450e-03f, 1.556094277e-04f, -8.413704627e-04f, -5.145752115e-04f, 6.282988405e-05f, 1.873453229e-04f,
+    1.076965812e-04f, 1.933090228e-04f, -1.259196810e-04f, -7.422300578e-04f, -6.354410611e-04f, 8.901534786e-04f,
+    2.366257457e-03f, 9.877448144e-04f, -3.253763277e-03f, -5.322696770e-03f, -2.134585539e-04f, 8.580510003e-03f,
+    9.405976060e-03f, -3.741304841e-03f, -1.857187396e-02f, -1.347628708e-02f, 1.462979728e-02f, 3.605952512e-02f,
+    1.497380406e-02f, -4.208273583e-02f, -7.194840659e-02f, -6.190774970e-03f, 1.529372301e-01f, 3.127698540e-01f,
+    3.598117139e-01f, 2.587871565e-01f, 8.455362279e-02f, -4.509829206e-02f, -6.880993943e-02f, -1.879290994e-02f,
+    2.917026755e-02f, 3.127920952e-02f, 2.283248004e-03f, -1.874647496e-02f, -1.408955929e-02f, 2.658014311e-03f,
+    1.074923107e-02f, 5.411492906e-03f, -3.075911183e-03f, -5.207616510e-03f, -1.501376229e-03f, 1.976047260e-03f,
+    1.989112888e-03f, 1.663311743e-04f, -8.399846477e-04f, -5.186432537e-04f, 6.045237205e-05f, 1.878418917e-04f,
+    1.067329424e-04f, 1.936873112e-04f, -1.223627271e-04f, -7.392832682e-04f, -6.406578312e-04f, 8.779280231e-04f,
+    2.363421205e-03f, 1.008044220e-03f, -3.226901848e-03f, -5.329832308e-03f, -2.663840217e-04f, 8.537273653e-03f,
+    9.446402668e-03f, -3.631497820e-03f, -1.852194450e-02f, -1.359423277e-02f, 1.443081616e-02f, 3.603306402e-02f,
+    1.525743409e-02f, -4.172532111e-02f, -7.201073420e-02f, -6.946821264e-03f, 1.518111565e-01f, 3.120263087e-01f,
+    3.600028461e-01f, 2.597683907e-01f, 8.561521897e-02f, -4.460419853e-02f, -6.896402789e-02f, -1.917451657e-02f,
+    2.899978522e-02f, 3.140184117e-02f, 2.476335380e-03f, -1.869535573e-02f, -1.418075030e-02f, 2.564319340e-03f,
+    1.074597125e-02f, 5.468375153e-03f, -3.037587471e-03f, -5.217823274e-03f, -1.530010052e-03f, 1.964681858e-03f,
+    1.997977991e-03f, 1.770938972e-04f, -8.385412417e-04f, -5.227033061e-04f, 5.805362804e-05f, 1.883279031e-04f,
+    1.057697663e-04f, 1.940482084e-04f, -1.188214268e-04f, -7.363080258e-04f, -6.458107817e-04f, 8.657076738e-04f,
+    2.360464299e-03f, 1.028210757e-03f, -3.199959555e-03f, -5.336656096e-03f, -3.191291251e-04f, 8.493711192e-03f,
+    9.486212322e-03f, -3.521803302e-03f, -1.847117533e-02f, -1.371114806e-02f, 1.423161817e-02f, 3.600479417e-02f,
+    1.553943086e-02f, -4.136689689e-02f, -7.206908113e-02f, -7.698866871e-03f, 1.506852263e-01f, 3.112780942e-01f,
+    3.601877825e-01f, 2.607465832e-01f, 8.667874851e-02f, -4.410561961e-02f, -6.911506518e-02f, -1.955631659e-02f,
+    2.882729258e-02f, 3.152316470e-02f, 2.669814558e-03f, -1.864311341e-02f, -1.427144157e-02f, 2.470224726e-03f,
+    1.074212909e-02f, 5.525137838e-03f, -2.998976612e-03f, -5.227780995e-03f, -1.558664312e-03f, 1.953162331e-03f,
+    2.006767931e-03f, 1.878971352e-04f, -8.370400449e-04f, -5.267550547e-04f, 5.563368728e-05f, 1.888032354e-04f,
+    1.048071416e-04f, 1.943918105e-04f, -1.152959291e-04f, -7.333046750e-04f, -6.508999046e-04f, 8.534931321e-04f,
+    2.357387395e-03f, 1.048243778e-03f, -3.172938182e-03f, -5.343168778e-03f, -3.716915458e-04f, 8.449825936e-03f,
+    9.525404637e-03f, -3.412226816e-03f, -1.841957137e-02f, -1.382702956e-02f, 1.403221424e-02f, 3.597472203e-02f,
+    1.581978487e-02f, -4.100748421e-02f, -7.212345966e-02f, -8.446898746e-03f, 1.495594714e-01f, 3.105252341e-01f,
+    3.603665171e-01f, 2.617217040e-01f, 8.774418414e-02f, -4.360255830e-02f, -6.926303310e-02f, -1.993829142e-02f,
+    2.865279267e-02f, 3.164317023e-02f, 2.863676471e-03f, -1.858974774e-02f, -1.436162693e-02f, 2.375734392e-03f,
+    1.073770311e-02f, 5.581777511e-03f, -2.960079816e-03f, -5.237488283e-03f, -1.587337468e-03f, 1.941488745e-03f,
+    2.015481881e-03f, 1.987404226e-04f, -8.354808600e-04f, -5.307981844e-04f, 5.319258681e-05f, 1.892677672e-04f,
+    1.038451560e-04f, 1.947182138e-04f, -1.117863813e-04f, -7.302735600e-04f, -6.559251955e-04f, 8.412850960e-04f,
+    2.354191154e-03f, 1.068142645e-03f, -3.145839513e-03f, -5.349371013e-03f, -4.240689826e-04f, 8.405621209e-03f,
+    9.563979262e-03f, -3.302773869e-03f, -1.836713762e-02f, -1.394187395e-02f, 1.383261530e-02f, 3.594285416e-02f,
+    1.609848674e-02f, -4.064710409e-02f, -7.217388221e-02f, -9.190904008e-03f, 1.484339233e-01f, 3.097677520e-01f,
+    3.605390442e-01f, 2.626937230e-01f, 8.881149850e-02f, -4.309501775e-02f, -6.940791350e-02f, -2.032042243e-02f,
+    2.847628862e-02f, 3.176184792e-02f, 3.057912003e-03f, -1.853525852e-02f, -1.445130022e-02f, 2.280852291e-03f,
+    1.073269187e-02f, 5.638290720e-03f, -2.920898312e-03f, -5.246943759e-03f, -1.616027974e-03f, 1.929661176e-03f,
+    2.024119015e-03f, 2.096232894e-04f, -8.338634929e-04f, -5.348323789e-04f, 5.073036543e-05f, 1.897213772e-04f,
+    1.028838969e-04f, 1.950275159e-04f, -1.082929285e-04f, -7.272150253e-04f, -6.608866544e-04f, 8.290842601e-04f,
+    2.350876240e-03f, 1.087906731e-03f, -3.118665328e-03f, -5.355263475e-03f, -4.762591516e-04f, 8.361100346e-03f,
+    9.601935880e-03f, -3.193449949e-03f, -1.831387906e-02f, -1.405567797e-02f, 1.363283226e-02f, 3.590919717e-02f,
+    1.637552718e-02f, -4.028577752e-02f, -7.222036131e-02f, -9.930869942e-03f, 1.473086136e-01f, 3.090056719e-01f,
+    3.607053583e-01f, 2.636626106e-01f, 8.988066414e-02f, -4.258300131e-02f, -6.954968833e-02f, -2.070269094e-02f,
+    2.829778369e-02f, 3.187918798e-02f, 3.252512000e-03f, -1.847964562e-02f, -1.454045527e-02f, 2.185582410e-03f,
+    1.072709394e-02f, 5.694674013e-03f, -2.881433351e-03f, -5.256146053e-03f, -1.644734278e-03f, 1.917679710e-03f,
+    2.032678508e-03f, 2.205452610e-04f, -8.321877519e-04f, -5.388573212e-04f, 4.824706374e-05f, 1.901639443e-04f,
+    1.019234508e-04f, 1.953198148e-04f, -1.048157139e-04f, -7.241294156e-04f, -6.657842851e-04f, 8.168913157e-04f,
+    2.347443323e-03f, 1.107535418e-03f, -3.091417408e-03f, -5.360846853e-03f, -5.282597861e-04f, 8.316266687e-03f,
+    9.639274210e-03f, -3.084260520e-03f, -1.825980074e-02f, -1.416843845e-02f, 1.343287599e-02f, 3.587375776e-02f,
+    1.665089704e-02f, -3.992352548e-02f, -7.226290963e-02f, -1.066678400e-02f, 1.461835739e-01f, 3.082390176e-01f,
+    3.608654538e-01f, 2.646283370e-01f, 9.095165348e-02f, -4.206651248e-02f, -6.968833959e-02f, -2.108507818e-02f,
+    2.811728124e-02f, 3.199518063e-02f, 3.447467260e-03f, -1.842290894e-02f, -1.462908596e-02f, 2.089928767e-03f,
+    1.072090794e-02f, 5.750923930e-03f, -2.841686200e-03f, -5.265093804e-03f, -1.673454819e-03f, 1.905544441e-03f,
+    2.041159538e-03f, 2.315058581e-04f, -8.304534485e-04f, -5.428726929e-04f, 4.574272411e-05f, 1.905953473e-04f,
+    1.009639037e-04f, 1.955952093e-04f, -1.013548788e-04f, -7.210170755e-04f, -6.706180956e-04f, 8.047069508e-04f,
+    2.343893075e-03f, 1.127028099e-03f, -3.064097531e-03f, -5.366121853e-03f, -5.800686369e-04f, 8.271123580e-03f,
+    9.675994002e-03f, -2.975211026e-03f, -1.820490772e-02f, -1.428015223e-02f, 1.323275737e-02f, 3.583654268e-02f,
+    1.692458723e-02f, -3.956036894e-02f, -7.230153995e-02f, -1.139863381e-02f, 1.450588355e-01f, 3.074678132e-01f,
+    3.610193257e-01f, 2.655908724e-01f, 9.202443887e-02f, -4.154555493e-02f, -6.982384940e-02f, -2.146756534e-02f,
+    2.793478475e-02f, 3.210981617e-02f, 3.642768542e-03f, -1.836504846e-02f, -1.471718613e-02f, 1.993895411e-03f,
+    1.071413251e-02f, 5.807037010e-03f, -2.801658150e-03f, -5.273785662e-03f, -1.702188032e-03f, 1.893255473e-03f,
+    2.049561281e-03f, 2.425045973e-04f, -8.286603969e-04f, -5.468781747e-04f, 4.321739073e-05f, 1.910154653e-04f,
+    1.000053409e-04f, 1.958537989e-04f, -9.791056260e-05f, -7.178783497e-04f, -6.753880977e-04f, 7.925318499e-04f,
+    2.340226176e-03f, 1.146384177e-03f, -3.036707471e-03f, -5.371089192e-03f, -6.316834721e-04f, 8.225674381e-03f,
+    9.712095044e-03f, -2.866306886e-03f, -1.814920510e-02f, -1.439081627e-02f, 1.303248725e-02f, 3.579755879e-02f,
+    1.719658882e-02f, -3.919632881e-02f, -7.233626516e-02f, -1.212640714e-02f, 1.439344301e-01f, 3.066920830e-01f,
+    3.611669690e-01f, 2.665501872e-01f, 9.309899252e-02f, -4.102013252e-02f, -6.995619990e-02f, -2.185013355e-02f,
+    2.775029779e-02f, 3.222308493e-02f, 3.838406561e-03f, -1.830606422e-02f, -1.480474967e-02f, 1.897486424e-03f,
+    1.070676630e-02f, 5.863009791e-03f, -2.761350508e-03f, -5.282220286e-03f, -1.730932346e-03f, 1.880812921e-03f,
+    2.057882918e-03f, 2.535409905e-04f, -8.268084143e-04f, -5.508734464e-04f, 4.067110956e-05f, 1.914241777e-04f,
+    9.904784689e-05f, 1.960956839e-04f, -9.448290266e-05f, -7.147135827e-04f, -6.800943073e-04f, 7.803666940e-04f,
+    2.336443306e-03f, 1.165603064e-03f, -3.009249003e-03f, -5.375749607e-03f, -6.831020774e-04f, 8.179922451e-03f,
+    9.747577155e-03f, -2.757553500e-03f, -1.809269799e-02f, -1.450042756e-02f, 1.283207644e-02f, 3.575681297e-02f,
+    1.746689295e-02f, -3.883142602e-02f, -7.236709828e-02f, -1.285009196e-02f, 1.428103889e-01f, 3.059118512e-01f,
+    3.613083790e-01f, 2.675062520e-01f, 9.417528659e-02f, -4.049024925e-02f, -7.008537337e-02f, -2.223276385e-02f,
+    2.756382404e-02f, 3.233497728e-02f, 4.034371990e-03f, -1.824595631e-02f, -1.489177046e-02f, 1.800705919e-03f,
+    1.069880801e-02f, 5.918838805e-03f, -2.720764603e-03f, -5.290396348e-03f, -1.759686182e-03f, 1.868216906e-03f,
+    2.066123631e-03f, 2.646145451e-04f, -8.248973206e-04f, -5.548581869e-04f, 3.810392840e-05f, 1.918213637e-04f,
+    9.809150568e-05f, 1.963209653e-04f, -9.107203441e-05f, -7.115231195e-04f, -6.847367443e-04f, 7.682121609e-04f,
+    2.332545153e-03f, 1.184684184e-03f, -2.981723900e-03f, -5.380103846e-03f, -7.343222561e-04f, 8.133871159e-03f,
+    9.782440190e-03f, -2.648956243e-03f, -1.803539156e-02f, -1.460898315e-02f, 1.263153576e-02f, 3.571431221e-02f,
+    1.773549087e-02f, -3.846568146e-02f, -7.239405245e-02f, -1.356967639e-02f, 1.416867433e-01f, 3.051271425e-01f,
+    3.614435510e-01f, 2.684590373e-01f, 9.525329309e-02f, -3.995590931e-02f, -7.021135212e-02f, -2.261543726e-02f,
+    2.737536731e-02f, 3.244548362e-02f, 4.230655461e-03f, -1.818472489e-02f, -1.497824242e-02f, 1.703558039e-03f,
+    1.069025638e-02f, 5.974520586e-03f, -2.679901782e-03f, -5.298312526e-03f, -1.788447957e-03f, 1.855467562e-03f,
+    2.074282601e-03f, 2.757247644e-04f, -8.229269389e-04f, -5.588320738e-04f, 3.551589683e-05f, 1.922069029e-04f,
+    9.713640051e-05f, 1.965297446e-04f, -8.767809132e-05f, -7.083073045e-04f, -6.893154324e-04f, 7.560689245e-04f,
+    2.328532407e-03f, 1.203626968e-03f, -2.954133929e-03f, -5.384152673e-03f, -7.853418292e-04f, 8.087523882e-03f,
+    9.816684036e-03f, -2.540520467e-03f, -1.797729097e-02f, -1.471648017e-02f, 1.243087598e-02f, 3.567006356e-02f,
+    1.800237397e-02f, -3.809911599e-02f, -7.241714093e-02f, -1.428514871e-02f, 1.405635245e-01f, 3.043379813e-01f,
+    3.615724806e-01f, 2.694085138e-01f, 9.633298397e-02f, -3.941711706e-02f, -7.033411858e-02f, -2.299813472e-02f,
+    2.718493150e-02f, 3.255459444e-02f, 4.427247563e-03f, -1.812237017e-02f, -1.506415946e-02f, 1.606046960e-03f,
+    1.068111013e-02f, 6.030051662e-03f, -2.638763413e-03f, -5.305967510e-03f, -1.817216080e-03f, 1.842565030e-03f,
+    2.082359013e-03f, 2.868711470e-04f, -8.208970952e-04f, -5.627947840e-04f, 3.290706627e-05f, 1.925806751e-04f,
+    9.618261396e-05f, 1.967221242e-04f, -8.430120494e-05f, -7.050664825e-04f, -6.938303993e-04f, 7.439376554e-04f,
+    2.324405763e-03f, 1.222430862e-03f, -2.926480858e-03f, -5.387896866e-03f, -8.361586353e-04f, 8.040884002e-03f,
+    9.850308616e-03f, -2.432251503e-03f, -1.791840145e-02f, -1.482291580e-02f, 1.223010787e-02f, 3.562407414e-02f,
+    1.826753371e-02f, -3.773175045e-02f, -7.243637709e-02f, -1.499649738e-02f, 1.394407639e-01f, 3.035443925e-01f,
+    3.616951638e-01f, 2.703546522e-01f, 9.741433106e-02f, -3.887387702e-02f, -7.045365523e-02f, -2.338083711e-02f,
+    2.699252063e-02f, 3.266230022e-02f, 4.624138846e-03f, -1.805889243e-02f, -1.514951550e-02f, 1.508176887e-03f,
+    1.067136807e-02f, 6.085428561e-03f, -2.597350884e-03f, -5.313360003e-03f, -1.845988956e-03f, 1.829509462e-03f,
+    2.090352053e-03f, 2.980531871e-04f, -8.188076185e-04f, -5.667459936e-04f, 3.027748997e-05f, 1.929425602e-04f,
+    9.523022795e-05f, 1.968982070e-04f, -8.094150484e-05f, -7.018009980e-04f, -6.982816767e-04f, 7.318190208e-04f,
+    2.320165920e-03f, 1.241095317e-03f, -2.898766452e-03f, -5.391337220e-03f, -8.867705310e-04f, 7.993954907e-03f,
+    9.883313885e-03f, -2.324154656e-03f, -1.785872822e-02f, -1.492828730e-02f, 1.202924217e-02f, 3.557635111e-02f,
+    1.853096168e-02f, -3.736360564e-02f, -7.245177441e-02f, -1.570371103e-02f, 1.383184926e-01f, 3.027464010e-01f,
+    3.618115966e-01f, 2.712974233e-01f, 9.849730612e-02f, -3.832619390e-02f, -7.056994466e-02f, -2.376352526e-02f,
+    2.679813882e-02f, 3.276859152e-02f, 4.821319820e-03f, -1.799429199e-02f, -1.523430449e-02f, 1.409952059e-03f,
+    1.066102898e-02f, 6.140647809e-03f, -2.555665599e-03f, -5.320488715e-03f, -1.874764984e-03f, 1.816301018e-03f,
+    2.098260909e-03f, 3.092703746e-04f, -8.166583409e-04f, -5.706853776e-04f, 2.762722299e-05f, 1.932924385e-04f,
+    9.427932368e-05f, 1.970580966e-04f, -7.759911864e-05f, -6.985111954e-04f, -7.026693000e-04f, 7.197136839e-04f,
+    2.315813579e-03f, 1.259619796e-03f, -2.870992473e-03f, -5.394474542e-03f, -9.371753904e-04f, 7.946739990e-03f,
+    9.915699832e-03f, -2.216235209e-03f, -1.779827656e-02f, -1.503259196e-02f, 1.182828958e-02f, 3.552690175e-02f,
+    1.879264958e-02f, -3.699470237e-02f, -7.246334651e-02f, -1.640677845e-02f, 1.371967417e-01f, 3.019440316e-01f,
+    3.619217751e-01f, 2.722367980e-01f, 9.958188078e-02f, -3.777407257e-02f, -7.068296953e-02f, -2.414617994e-02f,
+    2.660179030e-02f, 3.287345895e-02f, 5.018780953e-03f, -1.792856925e-02f, -1.531852038e-02f, 1.311376742e-03f,
+    1.065009173e-02f, 6.195705929e-03f, -2.513708987e-03f, -5.327352369e-03f, -1.903542556e-03f, 1.802939869e-03f,
+    2.106084770e-03f, 3.205221949e-04f, -8.144490974e-04f, -5.746126100e-04f, 2.495632223e-05f, 1.936301902e-04f,
+    9.332998168e-05f, 1.972018973e-04f, -7.427417202e-05f, -6.951974191e-04f, -7.069933086e-04f, 7.076223047e-04f,
+    2.311349448e-03f, 1.278003774e-03f, -2.843160681e-03f, -5.397309654e-03f, -9.873711059e-04f, 7.899242653e-03f,
+    9.947466481e-03f, -2.108498421e-03f, -1.773705175e-02f, -1.513582717e-02f, 1.162726080e-02f, 3.547573337e-02f,
+    1.905258921e-02f, -3.662506138e-02f, -7.247110709e-02f, -1.710568860e-02f, 1.360755424e-01f, 3.011373096e-01f,
+    3.620256959e-01f, 2.731727473e-01f, 1.006680266e-01f, -3.721751806e-02f, -7.079271258e-02f, -2.452878187e-02f,
+    2.640347941e-02f, 3.297689315e-02f, 5.216512674e-03f, -1.786172467e-02f, -1.540215716e-02f, 1.212455235e-03f,
+    1.063855516e-02f, 6.250599446e-03f, -2.471482492e-03f, -5.333949697e-03f, -1.932320058e-03f, 1.789426194e-03f,
+    2.113822828e-03f, 3.318081293e-04f, -8.121797261e-04f, -5.785273642e-04f, 2.226484644e-05f, 1.939556960e-04f,
+    9.238228181e-05f, 1.973297139e-04f, -7.096678872e-05f, -6.918600131e-04f, -7.112537457e-04f, 6.955455392e-04f,
+    2.306774238e-03f, 1.296246732e-03f, -2.815272833e-03f, -5.399843393e-03f, -1.037355588e-03f, 7.851466300e-03f,
+    9.978613887e-03f, -2.000949527e-03f, -1.767505912e-02f, -1.523799037e-02f, 1.142616649e-02f, 3.542285336e-02f,
+    1.931077249e-02f, -3.625470342e-02f, -7.247507000e-02f, -1.780043061e-02f, 1.349549255e-01f, 3.003262602e-01f,
+    3.621233554e-01f, 2.741052423e-01f, 1.017557151e-01f, -3.665653559e-02f, -7.089915665e-02f, -2.491131170e-02f,
+    2.620321062e-02f, 3.307888480e-02f, 5.414505372e-03f, -1.779375875e-02f, -1.548520879e-02f, 1.113191867e-03f,
+    1.062641818e-02f, 6.305324879e-03f, -2.428987579e-03f, -5.340279443e-03f, -1.961095873e-03f, 1.775760184e-03f,
+    2.121474277e-03f, 3.431276543e-04f, -8.098500684e-04f, -5.824293127e-04f, 1.955285622e-05f, 1.942688367e-04f,
+    9.143630321e-05f, 1.974416519e-04f, -6.767709052e-05f, -6.884993216e-04f, -7.154506584e-04f, 6.834840401e-04f,
+    2.302088662e-03f, 1.314348166e-03f, -2.787330682e-03f, -5.402076609e-03f, -1.087126765e-03f, 7.803414343e-03f,
+    1.000914214e-02f, -1.893593738e-03f, -1.761230402e-02f, -1.533907905e-02f, 1.122501730e-02f, 3.536826917e-02f,
+    1.956719142e-02f, -3.588364916e-02f, -7.247524917e-02f, -1.849099378e-02f, 1.338349221e-01f, 2.995109089e-01f,
+    3.622147507e-01f, 2.750342543e-01f, 1.028449175e-01f, -3.609113054e-02f, -7.100228465e-02f, -2.529375005e-02f,
+    2.600098848e-02f, 3.317942467e-02f, 5.612749400e-03f, -1.772467208e-02f, -1.556766929e-02f, 1.013590997e-03f,
+    1.061367972e-02f, 6.359878751e-03f, -2.386225734e-03f, -5.346340362e-03f, -1.989868376e-03f, 1.761942037e-03f,
+    2.129038311e-03f, 3.544802426e-04f, -8.074599686e-04f, -5.863181270e-04f, 1.682041400e-05f, 1.945694933e-04f,
+    9.049212433e-05f, 1.975378175e-04f, -6.440519724e-05f, -6.851156884e-04f, -7.195840974e-04f, 6.714384562e-04f,
+    2.297293438e-03f, 1.332307577e-03f, -2.759335979e-03f, -5.404010168e-03f, -1.136682582e-03f, 7.755090198e-03f,
+    1.003905136e-02f, -1.786436240e-03f, -1.754879181e-02f, -1.543909077e-02f, 1.102382385e-02f, 3.531198833e-02f,
+    1.982183815e-02f, -3.551191930e-02f, -7.247165867e-02f, -1.917736758e-02f, 1.327155631e-01f, 2.986912810e-01f,
+    3.622998787e-01f, 2.759597544e-01f, 1.039356052e-01f, -3.552130846e-02f, -7.110207960e-02f, -2.567607745e-02f,
+    2.579681766e-02f, 3.327850353e-02f, 5.811235068e-03f, -1.765446528e-02f, -1.564953267e-02f, 9.136570145e-04f,
+    1.060033872e-02f, 6.414257580e-03f, -2.343198460e-03f, -5.352131220e-03f, -2.018635938e-03f, 1.747971962e-03f,
+    2.136514128e-03f, 3.658653622e-04f, -8.050092741e-04f, -5.901934779e-04f, 1.406758408e-05f, 1.948575474e-04f,
+    8.954982293e-05f, 1.976183172e-04f, -6.115122678e-05f, -6.817094571e-04f, -7.236541174e-04f, 6.594094326e-04f,
+    2.292389289e-03f, 1.350124480e-03f, -2.731290474e-03f, -5.405644947e-03f, -1.186021006e-03f, 7.706497286e-03f,
+    1.006834171e-02f, -1.679482194e-03f, -1.748452789e-02f, -1.553802316e-02f, 1.082259672e-02f, 3.525401842e-02f,
+    2.007470491e-02f, -3.513953446e-02f, -7.246431267e-02f, -1.985954165e-02f, 1.315968793e-01f, 2.978674023e-01f,
+    3.623787366e-01f, 2.768817141e-01f, 1.050277494e-01f, -3.494707508e-02f, -7.119852458e-02f, -2.605827441e-02f,
+    2.559070294e-02f, 3.337611223e-02f, 6.009952652e-03f, -1.758313905e-02f, -1.573079296e-02f, 8.133943378e-04f,
+    1.058639418e-02f, 6.468457886e-03f, -2.299907281e-03f, -5.357650795e-03f, -2.047396923e-03f, 1.733850178e-03f,
+    2.143900927e-03f, 3.772824769e-04f, -8.024978358e-04f, -5.940550354e-04f, 1.129443262e-05f, 1.951328804e-04f,
+    8.860947606e-05f, 1.976832584e-04f, -5.791529507e-05f, -6.782809710e-04f, -7.276607767e-04f, 6.473976106e-04f,
+    2.287376940e-03f, 1.367798398e-03f, -2.703195911e-03f, -5.406981841e-03f, -1.235140018e-03f, 7.657639032e-03f,
+    1.009701338e-02f, -1.572736737e-03f, -1.741951768e-02f, -1.563587391e-02f, 1.062134647e-02f, 3.519436709e-02f,
+    2.032578406e-02f, -3.476651526e-02f, -7.245322545e-02f, -2.053750579e-02f, 1.304789015e-01f, 2.970392984e-01f,
+    3.624513219e-01f, 2.778001048e-01f, 1.061213212e-01f, -3.436843629e-02f, -7.129160279e-02f, -2.644032138e-02f,
+    2.538264923e-02f, 3.347224167e-02f, 6.208892387e-03f, -1.751069415e-02f, -1.581144421e-02f, 7.128074161e-04f,
+    1.057184511e-02f, 6.522476187e-03f, -2.256353740e-03f, -5.362897874e-03f, -2.076149692e-03f, 1.719576913e-03f,
+    2.151197910e-03f, 3.887310463e-04f, -7.999255075e-04f, -5.979024688e-04f, 8.501027653e-06f, 1.953953742e-04f,
+    8.767116008e-05f, 1.977327488e-04f, -5.469751612e-05f, -6.748305734e-04f, -7.316041377e-04f, 6.354036280e-04f,
+    2.282257119e-03f, 1.385328864e-03f, -2.675054032e-03f, -5.408021755e-03f, -1.284037620e-03f, 7.608518868e-03f,
+    1.012506658e-02f, -1.466204980e-03f, -1.735376665e-02f, -1.573264077e-02f, 1.042008366e-02f, 3.513304206e-02f,
+    2.057506804e-02f, -3.439288227e-02f, -7.243841139e-02f, -2.121124998e-02f, 1.293616604e-01f, 2.962069954e-01f,
+    3.625176322e-01f, 2.787148980e-01f, 1.072162915e-01f, -3.378539817e-02f, -7.138129749e-02f, -2.682219874e-02f,
+    2.517266151e-02f, 3.356688277e-02f, 6.408044473e-03f, -1.743713139e-02f, -1.589148049e-02f, 6.119007282e-04f,
+    1.055669056e-02f, 6.576309002e-03f, -2.212539400e-03f, -5.367871258e-03f, -2.104892598e-03f, 1.705152404e-03f,
+    2.158404280e-03f, 4.002105255e-04f, -7.972921464e-04f, -6.017354465e-04f, 5.687439066e-06f, 1.956449112e-04f,
+    8.673495062e-05f, 1.977668968e-04f, -5.149800199e-05f, -6.713586069e-04f, -7.354842660e-04f, 6.234281184e-04f,
+    2.277030559e-03f, 1.402715423e-03f, -2.646866575e-03f, -5.408765610e-03f, -1.332711832e-03f, 7.559140227e-03f,
+    1.015250158e-02f, -1.359892011e-03f, -1.728728025e-02f, -1.582832155e-02f, 1.021881879e-02f, 3.507005111e-02f,
+    2.082254944e-02f, -3.401865602e-02f, -7.241988501e-02f, -2.188076436e-02f, 1.282451866e-01f, 2.953705191e-01f,
+    3.625776654e-01f, 2.796260655e-01f, 1.083126313e-01f, -3.319796695e-02f, -7.146759206e-02f, -2.720388684e-02f,
+    2.496074490e-02f, 3.366002655e-02f, 6.607399071e-03f, -1.736245166e-02f, -1.597089587e-02f, 5.106787819e-04f,
+    1.054092960e-02f, 6.629952849e-03f, -2.168465842e-03f, -5.372569757e-03f, -2.133623991e-03f, 1.690576900e-03f,
+    2.165519244e-03f, 4.117203657e-04f, -7.945976127e-04f, -6.055536362e-04f, 2.853738631e-06f, 1.958813737e-04f,
+    8.580092263e-05f, 1.977858114e-04f, -4.831686280e-05f, -6.678654143e-04f, -7.393012313e-04f, 6.114717120e-04f,
+    2.271697997e-03f, 1.419957627e-03f, -2.618635277e-03f, -5.409214340e-03f, -1.381160691e-03f, 7.509506550e-03f,
+    1.017931865e-02f, -1.253802889e-03f, -1.722006399e-02f, -1.592291412e-02f, 1.001756233e-02f, 3.500540208e-02f,
+    2.106822091e-02f, -3.364385704e-02f, -7.239766090e-02f, -2.254603926e-02f, 1.271295108e-01f, 2.945298957e-01f,
+    3.626314195e-01f, 2.805335789e-01f, 1.094103115e-01f, -3.260614905e-02f, -7.155046994e-02f, -2.758536598e-02f,
+    2.474690463e-02f, 3.375166404e-02f, 6.806946308e-03f, -1.728665588e-02f, -1.604968446e-02f, 4.091461147e-04f,
+    1.052456134e-02f, 6.683404247e-03f, -2.124134667e-03f, -5.376992196e-03f, -2.162342216e-03f, 1.675850657e-03f,
+    2.172542010e-03f, 4.232600135e-04f, -7.918417701e-04f, -6.093567049e-04f, -3.938420066e-19f, 1.961046446e-04f,
+    8.486915032e-05f, 1.977896020e-04f, -4.515420671e-05f, -6.643513377e-04f, -7.430551068e-04f, 5.995350349e-04f,
+    2.266260171e-03f, 1.437055041e-03f, -2.590361869e-03f, -5.409368893e-03f, -1.429382254e-03f, 7.459621278e-03f,
+    1.020551813e-02f, -1.147942651e-03f, -1.715212339e-02f, -1.601641644e-02f, 9.816324760e-03f, 3.493910289e-02f,
+    2.131207526e-02f, -3.326850578e-02f, -7.237175379e-02f, -2.320706515e-02f, 1.260146634e-01f, 2.936851514e-01f,
+    3.626788927e-01f, 2.814374101e-01f, 1.105093028e-01f, -3.200995104e-02f, -7.162991470e-02f, -2.796661639e-02f,
+    2.453114601e-02f, 3.384178634e-02f, 7.006676274e-03f, -1.720974506e-02f, -1.612784038e-02f, 3.073072931e-04f,
+    1.050758492e-02f, 6.736659714e-03f, -2.079547496e-03f, -5.381137409e-03f, -2.191045612e-03f, 1.660973943e-03f,
+    2.179471788e-03f, 4.348289114e-04f, -7.890244856e-04f, -6.131443190e-04f, -2.873701295e-06f, 1.963146070e-04f,
+    8.393970720e-05f, 1.977783786e-04f, -4.201013999e-05f, -6.608167190e-04f, -7.467459695e-04f, 5.876187094e-04f,
+    2.260717824e-03f, 1.454007238e-03f, -2.562048079e-03f, -5.409230230e-03f, -1.477374596e-03f, 7.409487858e-03f,
+    1.023110036e-02f, -1.042316304e-03f, -1.708346400e-02f, -1.610882648e-02f, 9.615116493e-03f, 3.487116148e-02f,
+    2.155410538e-02f, -3.289262269e-02f, -7.234217849e-02f, -2.386383270e-02f, 1.249006749e-01f, 2.928363126e-01f,
+    3.627200835e-01f, 2.823375312e-01f, 1.116095758e-01f, -3.140937967e-02f, -7.170590996e-02f, -2.834761826e-02f,
+    2.431347450e-02f, 3.393038460e-02f, 7.206579021e-03f, -1.713172027e-02f, -1.620535775e-02f, 2.051669124e-04f,
+    1.048999951e-02f, 6.789715770e-03f, -2.034705968e-03f, -5.385004242e-03f, -2.219732513e-03f, 1.645947034e-03f,
+    2.186307792e-03f, 4.464264979e-04f, -7.861456293e-04f, -6.169161441e-04f, -5.767287832e-06f, 1.965111444e-04f,
+    8.301266607e-05f, 1.977522516e-04f, -3.888476695e-05f, -6.572618998e-04f, -7.503739000e-04f, 5.757233540e-04f,
+    2.255071703e-03f, 1.470813801e-03f, -2.533695633e-03f, -5.408799325e-03f, -1.525135810e-03f, 7.359109740e-03f,
+    1.025606573e-02f, -9.369288320e-04f, -1.701409139e-02f, -1.620014233e-02f, 9.413947931e-03f, 3.480158591e-02f,
+    2.179430426e-02f, -3.251622816e-02f, -7.230894995e-02f, -2.451633272e-02f, 1.237875757e-01f, 2.919834057e-01f,
+    3.627549905e-01f, 2.832339140e-01f, 1.127111011e-01f, -3.080444188e-02f, -7.177843947e-02f, -2.872835176e-02f,
+    2.409389565e-02f, 3.401745004e-02f, 7.406644568e-03f, -1.705258262e-02f, -1.628223073e-02f, 1.027295971e-04f,
+    1.047180430e-02f, 6.842568934e-03f, -1.989611742e-03f, -5.388591554e-03f, -2.248401248e-03f, 1.630770218e-03f,
+    2.193049238e-03f, 4.580522071e-04f, -7.832050749e-04f, -6.206718452e-04f, -8.680680298e-06f, 1.966941407e-04f,
+    8.208809899e-05f, 1.977113321e-04f, -3.577818995e-05f, -6.536872211e-04f, -7.539389824e-04f, 5.638495832e-04f,
+    2.249322556e-03f, 1.487474324e-03f, -2.505306251e-03f, -5.408077166e-03f, -1.572664008e-03f, 7.308490379e-03f,
+    1.028041466e-02f, -8.317851922e-04f, -1.694401114e-02f, -1.629036210e-02f, 9.212829442e-03f, 3.473038425e-02f,
+    2.203266504e-02f, -3.213934256e-02f, -7.227208318e-02f, -2.516455622e-02f, 1.226753962e-01f, 2.911264573e-01f,
+    3.627836127e-01f, 2.841265309e-01f, 1.138138493e-01f, -3.019514476e-02f, -7.184748707e-02f, -2.910879696e-02f,
+    2.387241511e-02f, 3.410297390e-02f, 7.606862900e-03f, -1.697233330e-02f, -1.635845350e-02f, -7.074014505e-18f,
+    1.045299852e-02f, 6.895215729e-03f, -1.944266496e-03f, -5.391898216e-03f, -2.277050144e-03f, 1.615443790e-03f,
+    2.199695343e-03f, 4.697054690e-04f, -7.802026991e-04f, -6.244110865e-04f, -1.161379748e-05f, 1.968634800e-04f,
+    8.116607732e-05f, 1.976557315e-04f, -3.269050946e-05f, -6.500930238e-04f, -7.574413045e-04f, 5.519980075e-04f,
+    2.243471136e-03f, 1.503988411e-03f, -2.476881652e-03f, -5.407064754e-03f, -1.619957322e-03f, 7.257633230e-03f,
+    1.030414759e-02f, -7.268903146e-04f, -1.687322888e-02f, -1.637948399e-02f, 9.011771366e-03f, 3.465756467e-02f,
+    2.226918093e-02f, -3.176198621e-02f, -7.223159334e-02f, -2.580849437e-02f, 1.215641665e-01f, 2.902654942e-01f,
+    3.628059489e-01f, 2.850153539e-01f, 1.149177908e-01f, -2.958149557e-02f, -7.191303667e-02f, -2.948893393e-02f,
+    2.364903865e-02f, 3.418694751e-02f, 7.807223966e-03f, -1.689097355e-02f, -1.643402024e-02f, -1.030171975e-04f,
+    1.043358143e-02f, 6.947652675e-03f, -1.898671928e-03f, -5.394923111e-03f, -2.305677519e-03f, 1.599968057e-03f,
+    2.206245327e-03f, 4.813857094e-04f, -7.771383825e-04f, -6.281335318e-04f, -1.456655628e-05f, 1.970190470e-04f,
+    8.024667169e-05f, 1.975855617e-04f, -2.962182400e-05f, -6.464796480e-04f, -7.608809578e-04f, 5.401692337e-04f,
+    2.237518199e-03f, 1.520355674e-03f, -2.448423547e-03f, -5.405763103e-03f, -1.667013901e-03f, 7.206541753e-03f,
+    1.032726501e-02f, -6.222491027e-04f, -1.680175024e-02f, -1.646750624e-02f, 8.810784013e-03f, 3.458313537e-02f,
+    2.250384527e-02f, -3.138417939e-02f, -7.218749566e-02f, -2.644813849e-02f, 1.204539168e-01f, 2.894005431e-01f,
+    3.628219985e-01f, 2.859003556e-01f, 1.160228959e-01f, -2.896350176e-02f, -7.197507231e-02f, -2.986874268e-02f,
+    2.342377217e-02f, 3.426936223e-02f, 8.007717681e-03f, -1.680850468e-02f, -1.650892516e-02f, -2.063172858e-04f,
+    1.041355233e-02f, 6.999876297e-03f, -1.852829754e-03f, -5.397665133e-03f, -2.334281689e-03f, 1.584343334e-03f,
+    2.212698416e-03f, 4.930923500e-04f, -7.740120086e-04f, -6.318388443e-04f, -1.753887167e-05f, 1.971607265e-04f,
+    7.932995201e-05f, 1.975009353e-04f, -2.657223017e-05f, -6.428474337e-04f, -7.642580372e-04f, 5.283638643e-04f,
+    2.231464503e-03f, 1.536575739e-03f, -2.419933647e-03f, -5.404173239e-03f, -1.713831914e-03f, 7.155219410e-03f,
+    1.034976744e-02f, -5.178664333e-04f, -1.672958088e-02f, -1.655442716e-02f, 8.609877659e-03f, 3.450710463e-02f,
+    2.273665151e-02f, -3.100594235e-02f, -7.213980550e-02f, -2.708348010e-02f, 1.193446772e-01f, 2.885316310e-01f,
+    3.628317610e-01f, 2.867815084e-01f, 1.171291349e-01f, -2.834117094e-02f, -7.203357811e-02f, -3.024820316e-02f,
+    2.319662165e-02f, 3.435020949e-02f, 8.208333927e-03f, -1.672492807e-02f, -1.658316249e-02f, -3.098955272e-04f,
+    1.039291054e-02f, 7.051883118e-03f, -1.806741708e-03f, -5.400123191e-03f, -2.362860967e-03f, 1.568569949e-03f,
+    2.219053833e-03f, 5.048248084e-04f, -7.708234646e-04f, -6.355266864e-04f, -2.053065674e-05f, 1.972884039e-04f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_48000[] = {
+    1.693139693e-04f, -3.429042480e-19f, -4.917223368e-04f, -7.482015730e-04f, 1.076246391e-18f, 1.525364710e-03f,
+    2.080891061e-03f, -2.353937657e-18f, -3.628840136e-03f, -4.670503412e-03f, 1.635508231e-17f, 7.441875259e-03f,
+    9.250814994e-03f, -6.454593217e-18f, -1.399430558e-02f, -1.709762025e-02f, 8.849157409e-18f, 2.548539683e-02f,
+    3.129915641e-02f, -1.098497267e-17f, -4.908651133e-02f, -6.399507838e-02f, 1.246524016e-17f, 1.353215209e-01f,
+    2.744186436e-01f, 3.333607560e-01f, 2.744186436e-01f, 1.353215209e-01f, 1.246524016e-17f, -6.399507838e-02f,
+    -4.908651133e-02f, -1.098497267e-17f, 3.129915641e-02f, 2.548539683e-02f, 8.849157409e-18f, -1.709762025e-02f,
+    -1.399430558e-02f, -6.454593217e-18f, 9.250814994e-03f, 7.441875259e-03f, 1.635508231e-17f, -4.670503412e-03f,
+    -3.628840136e-03f, -2.353937657e-18f, 2.080891061e-03f, 1.525364710e-03f, 1.076246391e-18f, -7.482015730e-04f,
+    -4.917223368e-04f, -3.429042480e-19f, 1.693139693e-04f, 7.885447941e-05f,
+};
+
+alignas(16) constexpr float RESAMPLER_TABLE_96000[] = {
+    6.889075399e-05f, 8.465566626e-05f, 6.642734341e-05f, -1.714494539e-19f, -1.125201338e-04f, -2.458573395e-04f,
+    -3.525238669e-04f, -3.740949605e-04f, -2.616573800e-04f, 5.381148153e-19f, 3.732021154e-04f, 7.626704776e-04f,
+    1.031836658e-03f, 1.040429327e-03f, 6.954099840e-04f, -1.176950499e-18f, -9.179502923e-04f, -1.814391811e-03f,
+    -2.381239505e-03f, -2.335215338e-03f, -1.521521876e-03f, 8.177413804e-18f, 1.920117777e-03f, 3.720879682e-03f,
+    4.795487981e-03f, 4.625335464e-03f, 2.968417524e-03f, -3.227246349e-18f, -3.650102773e-03f, -6.997043821e-03f,
+    -8.933491852e-03f, -8.548676991e-03f, -5.451637670e-03f, 4.424509799e-18f, 6.653190585e-03f, 1.274249997e-02f,
+    1.629074822e-02f, 1.564933449e-02f, 1.004780833e-02f, -5.492400797e-18f, -1.256779060e-02f, -2.454287344e-02f,
+    -3.219669638e-02f, -3.199704088e-02f, -2.148433743e-02f, 6.232523018e-18f, 3.092707680e-02f, 6.765970674e-02f,
+    1.050145485e-01f, 1.372071850e-01f, 1.589822005e-01f, 1.666777822e-01f, 1.589822005e-01f, 1.372071850e-01f,
+    1.050145485e-01f, 6.765970674e-02f, 3.092707680e-02f, 6.232523018e-18f, -2.148433743e-02f, -3.199704088e-02f,
+    -3.219669638e-02f, -2.454287344e-02f, -1.256779060e-02f, -5.492400797e-18f, 1.004780833e-02f, 1.564933449e-02f,
+    1.629074822e-02f, 1.274249997e-02f, 6.653190585e-03f, 4.424509799e-18f, -5.451637670e-03f, -8.548676991e-03f,
+    -8.933491852e-03f, -6.997043821e-03f, -3.650102773e-03f, -3.227246349e-18f, 2.968417524e-03f, 4.625335464e-03f,
+    4.795487981e-03f, 3.720879682e-03f, 1.920117777e-03f, 8.177413804e-18f, -1.521521876e-03f, -2.335215338e-03f,
+    -2.381239505e-03f, -1.814391811e-03f, -9.179502923e-04f, -1.176950499e-18f, 6.954099840e-04f, 1.040429327e-03f,
+    1.031836658e-03f, 7.626704776e-04f, 3.732021154e-04f, 5.381148153e-19f, -2.616573800e-04f, -3.740949605e-04f,
+    -3.525238669e-04f, -2.458573395e-04f, -1.125201338e-04f, -1.714494539e-19f, 6.642734341e-05f, 8.465566626e-05f,
+    6.889075399e-05f, 3.942662569e-05f,
+};
+
+constexpr ResamplerCoefficients RESAMPLER_COEFFICIENTS[] = {
+    {8000, 2, 1, 20, RESAMPLER_TABLE_8000},
+    {11025, 640, 441, 20, RESAMPLER_TABLE_11025},
+    {22050, 320, 441, 24, RESAMPLER_TABLE_22050},
+    {32000, 1, 2, 36, RESAMPLER_TABLE_32000},
+    {44100, 160, 441, 48, RESAMPLER_TABLE_44100},
+    {48000, 1, 3, 52, RESAMPLER_TABLE_48000},
+    {96000, 1, 6, 104, RESAMPLER_TABLE_96000},
+};
+
+#endif // LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_
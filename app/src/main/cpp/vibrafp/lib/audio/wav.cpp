@@ -1,4 +1,5 @@
 #include "audio/wav.h"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstring>
@@ -6,6 +7,48 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include "utils/trace.h"
+
+namespace
+{
+// Read-only streambuf over memory owned by the caller, lets the chunk parser
+// run on an in-memory WAV without first copying it into a string.
+class MemoryStreamBuffer : public std::streambuf
+{
+public:
+    MemoryStreamBuffer(const char *data, std::size_t size)
+    {
+        char *begin = const_cast<char *>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir dir,
+                     std::ios_base::openmode /*which*/) override
+    {
+        off_type base = egptr() - eback();
+        if (dir == std::ios_base::beg)
+        {
+            base = 0;
+        }
+        else if (dir == std::ios_base::cur)
+        {
+            base = gptr() - eback();
+        }
+        if (offset < -base || offset > (egptr() - eback()) - base)
+        {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + base + offset, egptr());
+        return pos_type(base + offset);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which) override
+    {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+};
+} // namespace
 
 Wav Wav::FromFile(const std::string &wav_file_path)
 {
@@ -23,11 +66,22 @@ Wav Wav::FromFile(const std::string &wav_file_path)
 Wav Wav::FromRawWav(const char *raw_wav, std::uint32_t raw_wav_size)
 {
     Wav wav;
-    std::istringstream stream(std::string(raw_wav, raw_wav_size));
+    MemoryStreamBuffer buffer(raw_wav, raw_wav_size);
+    std::istream stream(&buffer);
     wav.readWavFileBuffer(stream);
     return wav;
 }
 
+Wav Wav::ViewRawWav(const char *raw_wav, std::uint32_t raw_wav_size)
+{
+    trace::Scope trace_scope("Wav::ViewRawWav");
+    Wav wav;
+    MemoryStreamBuffer buffer(raw_wav, raw_wav_size);
+    std::istream stream(&buffer);
+    wav.readWavFileBuffer(stream, raw_wav);
+    return wav;
+}
+
 Wav Wav::FromSignedPCM(const char *raw_pcm, std::uint32_t raw_pcm_size, std::uint32_t sample_rate,
                        std::uint32_t sample_width, std::uint32_t channel_count)
 {
@@ -57,13 +111,16 @@ Wav Wav::fromPCM(const char *raw_pcm, std::uint32_t raw_pcm_size, AudioFormat au
     wav.fmt_.byte_rate = sample_rate * channel_count * sample_width / 8;
     wav.fmt_.block_align = channel_count * sample_width / 8;
     wav.fmt_.bits_per_sample = sample_width;
+    wav.sample_format_ = audio_format == AudioFormat::PCM_FLOAT ? SampleFormat::FLOAT
+                                                                : SampleFormat::SIGNED_INTEGER;
     wav.data_size_ = raw_pcm_size;
-    wav.data_.reset(new std::uint8_t[raw_pcm_size]);
-    std::memcpy(wav.data_.get(), raw_pcm, raw_pcm_size);
+    wav.owned_data_.reset(new std::uint8_t[raw_pcm_size]);
+    std::memcpy(wav.owned_data_.get(), raw_pcm, raw_pcm_size);
+    wav.data_ = wav.owned_data_.get();
     return wav;
 }
 
-void Wav::readWavFileBuffer(std::istream &stream)
+void Wav::readWavFileBuffer(std::istream &stream, const char *buffer)
 {
     stream.read(reinterpret_cast<char *>(&header_), sizeof(WavHeader));
 
@@ -81,19 +138,37 @@ void Wav::readWavFileBuffer(std::istream &stream)
 
         if (strncmp(subchunk_id, "data", 4) == 0)
         {
-            data_size_ = subchunk_size;
-            data_.reset(new std::uint8_t[data_size_]);
-            stream.read(reinterpret_cast<char *>(data_.get()), data_size_);
+            // Truncated files (or ones still being written, with a size of
+            // 0xFFFFFFFF) only hold the samples up to the end of the input.
+            const auto offset = stream.tellg();
+            stream.seekg(0, std::ios::end);
+            const auto available = static_cast<std::uint64_t>(stream.tellg() - offset);
+            stream.seekg(offset);
+            data_size_ = static_cast<std::uint32_t>(std::min<std::uint64_t>(subchunk_size, available));
+
+            if (buffer != nullptr)
+            {
+                data_ = reinterpret_cast<const std::uint8_t *>(buffer) + offset;
+                stream.seekg(data_size_, std::ios::cur);
+            }
+            else
+            {
+                owned_data_.reset(new std::uint8_t[data_size_]);
+                stream.read(reinterpret_cast<char *>(owned_data_.get()), data_size_);
+                data_ = owned_data_.get();
+            }
+            stream.seekg(subchunk_size & 1, std::ios::cur);
             data_chunk_found = true;
         }
         else if (strncmp(subchunk_id, "fmt ", 4) == 0)
         {
-            stream.read(reinterpret_cast<char *>(&fmt_), sizeof(FmtSubchunk));
+            readFmtSubchunk(stream, subchunk_size);
             fmt_chunk_found = true;
         }
         else
         {
-            stream.seekg(subchunk_size, std::ios::cur);
+            // chunks are word aligned
+            stream.seekg(subchunk_size + (subchunk_size & 1), std::ios::cur);
         }
 
         if (data_chunk_found && fmt_chunk_found)
@@ -107,3 +182,52 @@ void Wav::readWavFileBuffer(std::istream &stream)
         throw std::runtime_error("Invalid WAV file");
     }
 }
+
+void Wav::readFmtSubchunk(std::istream &stream, std::uint32_t subchunk_size)
+{
+    if (subchunk_size < sizeof(FmtSubchunk))
+    {
+        throw std::runtime_error("Invalid WAV fmt chunk");
+    }
+    stream.read(reinterpret_cast<char *>(&fmt_), sizeof(FmtSubchunk));
+    std::uint32_t remaining = subchunk_size - sizeof(FmtSubchunk);
+
+    if (fmt_.audio_format == static_cast<std::uint16_t>(AudioFormat::EXTENSIBLE))
+    {
+        // KSDATAFORMAT_SUBTYPE_* GUIDs share everything but the leading format code
+        static const std::uint8_t kSubFormatSuffix[14] = {0x00, 0x00, 0x00, 0x00, 0x10,
+                                                          0x00, 0x80, 0x00, 0x00, 0xAA,
+                                                          0x00, 0x38, 0x9B, 0x71};
+        FmtExtension extension;
+        if (remaining < sizeof(FmtExtension))
+        {
+            throw std::runtime_error("Invalid WAVE_FORMAT_EXTENSIBLE fmt chunk");
+        }
+        stream.read(reinterpret_cast<char *>(&extension), sizeof(FmtExtension));
+        remaining -= sizeof(FmtExtension);
+
+        if (std::memcmp(extension.sub_format + 2, kSubFormatSuffix, sizeof(kSubFormatSuffix)) != 0)
+        {
+            throw std::runtime_error("Unsupported WAVE_FORMAT_EXTENSIBLE sub-format");
+        }
+        // Samples are left aligned in their container, so valid_bits_per_sample
+        // does not change how they are read.
+        fmt_.audio_format = extension.sub_format[0] | (extension.sub_format[1] << 8);
+    }
+
+    switch (static_cast<AudioFormat>(fmt_.audio_format))
+    {
+    case AudioFormat::PCM_INTEGER:
+        // 8-bit WAV samples are unsigned, wider ones are signed
+        sample_format_ = fmt_.bits_per_sample == 8 ? SampleFormat::UNSIGNED_INTEGER
+                                                   : SampleFormat::SIGNED_INTEGER;
+        break;
+    case AudioFormat::PCM_FLOAT:
+        sample_format_ = SampleFormat::FLOAT;
+        break;
+    default:
+        throw std::runtime_error("Unsupported WAV audio format");
+    }
+
+    stream.seekg(remaining + (subchunk_size & 1), std::ios::cur);
+}
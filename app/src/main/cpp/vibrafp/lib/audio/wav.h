@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include "audio/byte_control.h"
+#include "audio/downmix.h"
 
 struct WavHeader
 {
@@ -22,10 +23,20 @@ struct FmtSubchunk
     std::uint16_t bits_per_sample;
 };
 
+// Trailer of a WAVE_FORMAT_EXTENSIBLE fmt chunk
+struct FmtExtension
+{
+    std::uint16_t extension_size;
+    std::uint16_t valid_bits_per_sample;
+    std::uint32_t channel_mask;
+    std::uint8_t sub_format[16]; // GUID, the first two bytes hold the format code
+};
+
 enum class AudioFormat
 {
     PCM_INTEGER = 1,
     PCM_FLOAT = 3,
+    EXTENSIBLE = 0xFFFE,
 };
 
 class Wav
@@ -35,6 +46,9 @@ public:
     Wav(const Wav &) = delete;
     static Wav FromFile(const std::string &wav_file_path);
     static Wav FromRawWav(const char *raw_wav, std::uint32_t raw_wav_size);
+    // Parses raw_wav without copying its samples, the returned Wav points
+    // into raw_wav which must outlive it.
+    static Wav ViewRawWav(const char *raw_wav, std::uint32_t raw_wav_size);
     static Wav FromSignedPCM(const char *raw_pcm, std::uint32_t raw_pcm_size,
                              std::uint32_t sample_rate, std::uint32_t sample_width,
                              std::uint32_t channel_count);
@@ -43,10 +57,15 @@ public:
                             std::uint32_t channel_count);
     ~Wav();
 
+    // For WAVE_FORMAT_EXTENSIBLE files this is the code of the sub-format
     inline std::uint16_t audio_format() const
     {
         return fmt_.audio_format;
     }
+    inline SampleFormat sample_format() const
+    {
+        return sample_format_;
+    }
     inline std::uint16_t num_channels() const
     {
         return fmt_.num_channels;
@@ -67,7 +86,7 @@ public:
     {
         return header_.file_size;
     }
-    inline const std::unique_ptr<std::uint8_t[]> &data() const
+    inline const std::uint8_t *data() const
     {
         return data_;
     }
@@ -77,14 +96,19 @@ private:
     static Wav fromPCM(const char *raw_pcm, std::uint32_t raw_pcm_size, AudioFormat audio_format,
                        std::uint32_t sample_rate, std::uint32_t sample_width,
                        std::uint32_t channel_count);
-    void readWavFileBuffer(std::istream &stream);
+    // Samples are copied out of the stream unless `buffer` holds the bytes
+    // the stream reads from, in which case data_ points into it.
+    void readWavFileBuffer(std::istream &stream, const char *buffer = nullptr);
+    void readFmtSubchunk(std::istream &stream, std::uint32_t subchunk_size);
 
 private:
     WavHeader header_;
     FmtSubchunk fmt_;
+    SampleFormat sample_format_;
     std::string wav_file_path_;
     std::uint32_t data_size_;
-    std::unique_ptr<std::uint8_t[]> data_;
+    const std::uint8_t *data_;
+    std::unique_ptr<std::uint8_t[]> owned_data_;
 };
 
 #endif // LIB_AUDIO_WAV_H_
@@ -0,0 +1,172 @@
+#include "match/index_segments.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <stdexcept>
+
+namespace
+{
+std::string segmentPath(const std::string &directory, std::uint32_t level, std::uint64_t sequence)
+{
+    char name[64];
+    std::snprintf(name, sizeof(name), "segment-%u-%llu.vli", level,
+                  static_cast<unsigned long long>(sequence));
+    return directory + "/" + name;
+}
+
+// Rejects temporary files and anything else that merely starts like a segment
+bool parseSegmentName(const char *name, std::uint32_t *level, std::uint64_t *sequence)
+{
+    unsigned int parsed_level = 0;
+    unsigned long long parsed_sequence = 0;
+    if (std::sscanf(name, "segment-%u-%llu.vli", &parsed_level, &parsed_sequence) != 2)
+    {
+        return false;
+    }
+    char canonical[64];
+    std::snprintf(canonical, sizeof(canonical), "segment-%u-%llu.vli", parsed_level,
+                  parsed_sequence);
+    if (std::string(canonical) != name)
+    {
+        return false;
+    }
+    *level = parsed_level;
+    *sequence = parsed_sequence;
+    return true;
+}
+
+bool sameConfig(const LandmarkConfig &a, const LandmarkConfig &b)
+{
+    return a.fan_out == b.fan_out && a.min_pass_delta == b.min_pass_delta &&
+           a.max_pass_delta == b.max_pass_delta && a.max_bin_delta == b.max_bin_delta;
+}
+} // namespace
+
+std::vector<IndexSegment> ListIndexSegments(const std::string &directory)
+{
+    DIR *dir = ::opendir(directory.c_str());
+    if (dir == nullptr)
+    {
+        throw std::runtime_error("Cannot read index directory " + directory);
+    }
+    std::vector<IndexSegment> segments;
+    while (const dirent *entry = ::readdir(dir))
+    {
+        IndexSegment segment;
+        if (parseSegmentName(entry->d_name, &segment.level, &segment.sequence))
+        {
+            segment.path = directory + "/" + entry->d_name;
+            segments.push_back(segment);
+        }
+    }
+    ::closedir(dir);
+    std::sort(segments.begin(), segments.end(),
+              [](const IndexSegment &a, const IndexSegment &b) { return a.sequence < b.sequence; });
+    return segments;
+}
+
+void AppendIndexSegment(const std::string &directory, LandmarkIndexBuilder &builder)
+{
+    if (::mkdir(directory.c_str(), 0777) != 0 && errno != EEXIST)
+    {
+        throw std::runtime_error("Cannot create index directory " + directory);
+    }
+    std::vector<IndexSegment> segments = ListIndexSegments(directory);
+    if (!segments.empty() &&
+        !sameConfig(LandmarkIndex::Open(segments.front().path).config(), builder.config()))
+    {
+        throw std::invalid_argument("Index segments were built with a different config");
+    }
+    std::uint64_t next_sequence = segments.empty() ? 0 : segments.back().sequence + 1;
+
+    IndexSegment added = {segmentPath(directory, 0, next_sequence), 0, next_sequence};
+    ++next_sequence;
+    builder.Write(added.path);
+    segments.push_back(added);
+
+    // Only the level that just grew can have become full
+    for (std::uint32_t level = 0;; ++level)
+    {
+        std::vector<IndexSegment> full;
+        for (const auto &segment : segments)
+        {
+            if (segment.level == level)
+            {
+                full.push_back(segment);
+            }
+        }
+        if (full.size() < SEGMENT_MERGE_FANIN)
+        {
+            break;
+        }
+
+        LandmarkIndexBuilder merged(builder.config());
+        for (const auto &segment : full)
+        {
+            merged.AddIndex(LandmarkIndex::Open(segment.path));
+        }
+        IndexSegment merged_segment = {segmentPath(directory, level + 1, next_sequence), level + 1,
+                                       next_sequence};
+        ++next_sequence;
+        // Until the inputs are removed readers may see a track twice, which
+        // does not change which track matches best
+        merged.Write(merged_segment.path);
+        for (const auto &segment : full)
+        {
+            std::remove(segment.path.c_str());
+        }
+        segments.erase(std::remove_if(segments.begin(), segments.end(),
+                                      [level](const IndexSegment &segment) {
+                                          return segment.level == level;
+                                      }),
+                       segments.end());
+        segments.push_back(merged_segment);
+    }
+}
+
+std::vector<LandmarkIndex> OpenIndexSegments(const std::string &directory)
+{
+    std::vector<LandmarkIndex> indexes;
+    for (const auto &segment : ListIndexSegments(directory))
+    {
+        try
+        {
+            indexes.push_back(LandmarkIndex::Open(segment.path));
+        }
+        catch (const std::runtime_error &)
+        {
+            if (::access(segment.path.c_str(), F_OK) == 0)
+            {
+                throw;
+            }
+        }
+    }
+    return indexes;
+}
+
+MatchResult QueryIndexSegments(const std::vector<LandmarkIndex> &segments, const Signature &query)
+{
+    MatchResult best = {false, 0, 0, 0, 0};
+    std::vector<Landmark> landmarks;
+    const LandmarkConfig *extracted_config = nullptr;
+    for (const auto &segment : segments)
+    {
+        // Segments normally share one config, extract the query landmarks once
+        if (extracted_config == nullptr || !sameConfig(*extracted_config, segment.config()))
+        {
+            landmarks.clear();
+            ExtractLandmarks(query, segment.config(), 0, &landmarks);
+            extracted_config = &segment.config();
+        }
+        const MatchResult result = segment.Query(landmarks);
+        if (result.score > best.score || (result.found && !best.found))
+        {
+            best = result;
+        }
+    }
+    best.query_landmarks = static_cast<std::uint32_t>(landmarks.size());
+    return best;
+}
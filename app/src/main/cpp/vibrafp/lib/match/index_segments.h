@@ -0,0 +1,46 @@
+#ifndef LIB_MATCH_INDEX_SEGMENTS_H_
+#define LIB_MATCH_INDEX_SEGMENTS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "match/landmark_index.h"
+
+// A landmark index kept as several LandmarkIndex files in one directory, so
+// that tracks are added by writing a small segment instead of rewriting the
+// whole index. Segments are named segment-<level>-<sequence>.vli. New tracks
+// go to level 0 and every SEGMENT_MERGE_FANIN segments of a level are merged
+// into one segment of the next level, so each posting is rewritten a
+// logarithmic number of times. A track must not span segments.
+constexpr std::size_t SEGMENT_MERGE_FANIN = 8;
+
+struct IndexSegment
+{
+    std::string path;
+    std::uint32_t level;
+    std::uint64_t sequence;
+};
+
+// Segments of `directory`, oldest first. Throws std::runtime_error if the
+// directory cannot be read.
+std::vector<IndexSegment> ListIndexSegments(const std::string &directory);
+
+// Writes `builder` as a new level 0 segment, creating `directory` if needed,
+// and merges the levels that became full. Only one process may append to a
+// directory at a time, readers can open it concurrently. Throws
+// std::invalid_argument if the segments use another LandmarkConfig,
+// std::runtime_error if a file cannot be read or written.
+void AppendIndexSegment(const std::string &directory, LandmarkIndexBuilder &builder);
+
+// Maps every segment of `directory`. Segments removed by a concurrent merge
+// after the listing are skipped, their postings are in the merged segment.
+// Throws std::runtime_error if the directory cannot be read or a segment is
+// corrupt.
+std::vector<LandmarkIndex> OpenIndexSegments(const std::string &directory);
+
+// Best match over segments holding disjoint tracks, see LandmarkIndex::Query().
+MatchResult QueryIndexSegments(const std::vector<LandmarkIndex> &segments,
+                               const Signature &query);
+
+#endif // LIB_MATCH_INDEX_SEGMENTS_H_
@@ -0,0 +1,136 @@
+#include "match/landmark.h"
+#include <stdexcept>
+#include "algorithm/signature.h"
+
+// corrected_peak_frequency_bin() is in 1/64 FFT bin units
+constexpr std::uint32_t BIN_FRACTION_BITS = 6;
+constexpr std::uint32_t MAX_ANCHOR_BIN = (1u << 10) - 1;
+constexpr std::uint32_t BIN_DELTA_BIAS = 1u << 9;
+constexpr std::uint32_t MAX_FIELD_DELTA = (1u << 9) - 1;
+// Initial pending anchor capacity per band, above what fan_out 5 leaves pending
+constexpr std::size_t PENDING_ANCHORS_RESERVED = 16;
+
+LandmarkConfig::LandmarkConfig()
+    : fan_out(5), min_pass_delta(1), max_pass_delta(255), max_bin_delta(255)
+{
+}
+
+std::uint32_t PackLandmarkHash(FrequencyBand band, std::uint32_t anchor_bin,
+                               std::uint32_t target_bin, std::uint32_t pass_delta)
+{
+    const std::uint32_t anchor = anchor_bin >> BIN_FRACTION_BITS;
+    const std::uint32_t target = target_bin >> BIN_FRACTION_BITS;
+    const std::uint32_t band_field = static_cast<std::uint32_t>(static_cast<int>(band) + 1);
+    const std::uint32_t anchor_field = anchor < MAX_ANCHOR_BIN ? anchor : MAX_ANCHOR_BIN;
+    const std::uint32_t delta_field = (target + BIN_DELTA_BIAS - anchor) & 0x3ff;
+    return (band_field << 29) | (anchor_field << 19) | (delta_field << 9) |
+           (pass_delta & MAX_FIELD_DELTA);
+}
+
+namespace
+{
+void validateConfig(const LandmarkConfig &config)
+{
+    if (config.fan_out == 0 || config.min_pass_delta == 0 ||
+        config.max_pass_delta < config.min_pass_delta ||
+        config.max_pass_delta > MAX_FIELD_DELTA || config.max_bin_delta > MAX_FIELD_DELTA)
+    {
+        throw std::invalid_argument("Invalid landmark target zone");
+    }
+}
+} // namespace
+
+void ExtractLandmarks(const Signature &signature, const LandmarkConfig &config,
+                      std::uint32_t pass_offset, std::vector<Landmark> *landmarks)
+{
+    validateConfig(config);
+    const std::int64_t max_bin_delta = static_cast<std::int64_t>(config.max_bin_delta)
+                                       << BIN_FRACTION_BITS;
+
+    for (const auto &pair : signature.frequency_band_to_peaks())
+    {
+        // Peaks are in time order within a band
+        const auto &peaks = pair.second;
+        for (std::size_t anchor = 0; anchor < peaks.size(); ++anchor)
+        {
+            const FrequencyPeak &a = peaks[anchor];
+            std::uint32_t paired = 0;
+            for (std::size_t target = anchor + 1;
+                 target < peaks.size() && paired < config.fan_out; ++target)
+            {
+                const FrequencyPeak &t = peaks[target];
+                const std::uint32_t pass_delta = t.fft_pass_number() - a.fft_pass_number();
+                if (pass_delta > config.max_pass_delta)
+                {
+                    break;
+                }
+                const std::int64_t bin_delta =
+                    static_cast<std::int64_t>(t.corrected_peak_frequency_bin()) -
+                    a.corrected_peak_frequency_bin();
+                if (pass_delta < config.min_pass_delta || bin_delta > max_bin_delta ||
+                    bin_delta < -max_bin_delta)
+                {
+                    continue;
+                }
+                landmarks->push_back(Landmark{PackLandmarkHash(pair.first,
+                                                               a.corrected_peak_frequency_bin(),
+                                                               t.corrected_peak_frequency_bin(),
+                                                               pass_delta),
+                                              a.fft_pass_number() + pass_offset});
+                ++paired;
+            }
+        }
+    }
+}
+
+LandmarkStream::LandmarkStream(const LandmarkConfig &config) : config_(config), pending_anchors_()
+{
+    validateConfig(config_);
+    for (auto &anchors : pending_anchors_)
+    {
+        anchors.reserve(PENDING_ANCHORS_RESERVED);
+    }
+}
+
+void LandmarkStream::Reset()
+{
+    for (auto &anchors : pending_anchors_)
+    {
+        anchors.clear();
+    }
+}
+
+void LandmarkStream::AddPeak(FrequencyBand band, const FrequencyPeak &peak,
+                             std::vector<Landmark> *landmarks)
+{
+    const std::int64_t max_bin_delta = static_cast<std::int64_t>(config_.max_bin_delta)
+                                       << BIN_FRACTION_BITS;
+    auto &anchors = pending_anchors_[static_cast<int>(band) + 1];
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < anchors.size(); ++i)
+    {
+        PendingAnchor anchor = anchors[i];
+        const std::uint32_t pass_delta = peak.fft_pass_number() - anchor.fft_pass_number;
+        if (pass_delta > config_.max_pass_delta)
+        {
+            continue;
+        }
+        const std::int64_t bin_delta =
+            static_cast<std::int64_t>(peak.corrected_peak_frequency_bin()) - anchor.frequency_bin;
+        if (pass_delta >= config_.min_pass_delta && bin_delta <= max_bin_delta &&
+            bin_delta >= -max_bin_delta)
+        {
+            landmarks->push_back(Landmark{PackLandmarkHash(band, anchor.frequency_bin,
+                                                           peak.corrected_peak_frequency_bin(),
+                                                           pass_delta),
+                                          anchor.fft_pass_number});
+            if (++anchor.targets == config_.fan_out)
+            {
+                continue;
+            }
+        }
+        anchors[kept++] = anchor;
+    }
+    anchors.resize(kept);
+    anchors.push_back(PendingAnchor{peak.fft_pass_number(), peak.corrected_peak_frequency_bin(), 0});
+}
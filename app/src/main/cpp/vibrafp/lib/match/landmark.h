@@ -0,0 +1,80 @@
+#ifndef LIB_MATCH_LANDMARK_H_
+#define LIB_MATCH_LANDMARK_H_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "algorithm/frequency.h"
+
+class Signature;
+
+// Two peaks of the same band, an anchor and a later target, reduced to a
+// 32 bit hash that does not depend on where the pair occurs in the audio:
+//   bits 31-29  band + 1
+//   bits 28-19  anchor frequency, in whole FFT bins
+//   bits 18-9   target minus anchor frequency, biased by 512
+//   bits 8-0    target minus anchor fft pass number
+struct Landmark
+{
+    std::uint32_t hash;
+    std::uint32_t anchor_pass; // fft pass number of the anchor peak
+};
+
+// Which targets are paired with each anchor peak
+struct LandmarkConfig
+{
+    LandmarkConfig();
+
+    std::uint32_t fan_out;        // at most this many targets per anchor
+    std::uint32_t min_pass_delta; // target zone start, in 128 sample hops
+    std::uint32_t max_pass_delta; // target zone end, at most 511
+    std::uint32_t max_bin_delta;  // target zone half height, in FFT bins, at most 511
+};
+
+std::uint32_t PackLandmarkHash(FrequencyBand band, std::uint32_t anchor_bin,
+                               std::uint32_t target_bin, std::uint32_t pass_delta);
+
+// Appends the landmarks of every band of `signature` to `landmarks`, with
+// `pass_offset` added to the anchor positions. Throws std::invalid_argument
+// if the config is out of range.
+void ExtractLandmarks(const Signature &signature, const LandmarkConfig &config,
+                      std::uint32_t pass_offset, std::vector<Landmark> *landmarks);
+
+// ExtractLandmarks() for peaks that arrive one at a time, as
+// SignatureGenerator finds them: a new peak is the next target of every
+// pending anchor of its band, so each landmark is complete as soon as its
+// target peak is. Produces the same landmarks as ExtractLandmarks(), ordered
+// by target rather than by anchor.
+class LandmarkStream
+{
+public:
+    // Throws std::invalid_argument if the config is out of range
+    explicit LandmarkStream(const LandmarkConfig &config = LandmarkConfig());
+    void Reset();
+
+    // Appends the landmarks `peak` completes. The peaks of each band must be
+    // added in time order.
+    void AddPeak(FrequencyBand band, const FrequencyPeak &peak, std::vector<Landmark> *landmarks);
+
+    inline const LandmarkConfig &config() const
+    {
+        return config_;
+    }
+
+private:
+    struct PendingAnchor
+    {
+        std::uint32_t fft_pass_number;
+        std::uint32_t frequency_bin;
+        std::uint32_t targets; // landmarks already formed with this anchor
+    };
+
+    LandmarkConfig config_;
+    // Anchors of each band, indexed by band + 1, that can still be paired with
+    // a later peak. An anchor stops pending once it has fan_out targets or is
+    // too old to get more. Reset() keeps the capacity, so a warm stream does
+    // not allocate.
+    std::array<std::vector<PendingAnchor>, 5> pending_anchors_;
+};
+
+#endif // LIB_MATCH_LANDMARK_H_
@@ -0,0 +1,340 @@
+#include "match/landmark_index.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+constexpr char INDEX_MAGIC[8] = {'V', 'I', 'B', 'R', 'A', 'L', 'M', 'I'};
+constexpr std::uint32_t INDEX_VERSION = 1;
+constexpr std::uint32_t MIN_BUCKET_BITS = 8;
+constexpr std::uint32_t MAX_BUCKET_BITS = 20;
+constexpr std::size_t KEYS_PER_BUCKET = 16;
+constexpr std::size_t WRITE_CHUNK_POSTINGS = 1 << 16;
+
+// File layout, every field little-endian and 4 byte aligned:
+//   IndexFileHeader
+//   uint32 bucket_starts[(1 << bucket_bits) + 1]  first key of each top-bits bucket
+//   uint32 keys[key_count]                        distinct hashes, ascending
+//   uint32 offsets[key_count + 1]                 first posting of each key
+//   Posting postings[posting_count]
+struct IndexFileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t track_count;
+    std::uint32_t key_count;
+    std::uint32_t posting_count;
+    std::uint32_t bucket_bits;
+    std::uint32_t fan_out;
+    std::uint32_t min_pass_delta;
+    std::uint32_t max_pass_delta;
+    std::uint32_t max_bin_delta;
+    std::uint32_t reserved;
+};
+
+static_assert(sizeof(IndexFileHeader) == 48, "IndexFileHeader must not be padded");
+
+std::uint32_t bucketBitsFor(std::size_t key_count)
+{
+    std::uint32_t bits = MIN_BUCKET_BITS;
+    while (bits < MAX_BUCKET_BITS && (key_count >> bits) > KEYS_PER_BUCKET)
+    {
+        ++bits;
+    }
+    return bits;
+}
+
+inline std::uint64_t voteKey(std::uint32_t track_id, std::int64_t offset)
+{
+    return (static_cast<std::uint64_t>(track_id) << 32) |
+           static_cast<std::uint32_t>(static_cast<std::int32_t>(offset));
+}
+
+inline bool sameConfig(const LandmarkConfig &a, const LandmarkConfig &b)
+{
+    return a.fan_out == b.fan_out && a.min_pass_delta == b.min_pass_delta &&
+           a.max_pass_delta == b.max_pass_delta && a.max_bin_delta == b.max_bin_delta;
+}
+
+template <typename T> void writeArray(std::ofstream &out, const T *data, std::size_t count)
+{
+    out.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(count * sizeof(T)));
+}
+} // namespace
+
+LandmarkIndexBuilder::LandmarkIndexBuilder(const LandmarkConfig &config)
+    : config_(config), entries_(), scratch_()
+{
+}
+
+void LandmarkIndexBuilder::AddSignature(std::uint32_t track_id, const Signature &signature,
+                                        std::uint32_t pass_offset)
+{
+    scratch_.clear();
+    ExtractLandmarks(signature, config_, pass_offset, &scratch_);
+    AddLandmarks(track_id, scratch_);
+}
+
+void LandmarkIndexBuilder::AddLandmarks(std::uint32_t track_id,
+                                        const std::vector<Landmark> &landmarks)
+{
+    for (const auto &landmark : landmarks)
+    {
+        entries_.push_back(Entry{landmark.hash, track_id, landmark.anchor_pass});
+    }
+}
+
+void LandmarkIndexBuilder::AddIndex(const LandmarkIndex &index)
+{
+    if (!sameConfig(index.config(), config_))
+    {
+        throw std::invalid_argument("Landmark index was built with a different config");
+    }
+    entries_.reserve(entries_.size() + index.posting_count());
+    index.ForEachHash(
+        [this](std::uint32_t hash, const LandmarkIndex::Posting *postings, std::size_t count) {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                entries_.push_back(Entry{hash, postings[i].track_id, postings[i].pass});
+            }
+        });
+}
+
+void LandmarkIndexBuilder::Write(const std::string &path)
+{
+    if (entries_.size() > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw std::runtime_error("Too many landmarks for one index");
+    }
+    std::sort(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b) {
+        if (a.hash != b.hash)
+            return a.hash < b.hash;
+        if (a.track_id != b.track_id)
+            return a.track_id < b.track_id;
+        return a.pass < b.pass;
+    });
+
+    std::vector<std::uint32_t> keys;
+    std::vector<std::uint32_t> offsets;
+    std::unordered_set<std::uint32_t> tracks;
+    for (std::size_t i = 0; i < entries_.size(); ++i)
+    {
+        if (i == 0 || entries_[i].hash != entries_[i - 1].hash)
+        {
+            keys.push_back(entries_[i].hash);
+            offsets.push_back(static_cast<std::uint32_t>(i));
+        }
+        tracks.insert(entries_[i].track_id);
+    }
+    offsets.push_back(static_cast<std::uint32_t>(entries_.size()));
+
+    const std::uint32_t bucket_bits = bucketBitsFor(keys.size());
+    std::vector<std::uint32_t> bucket_starts((1u << bucket_bits) + 1);
+    std::size_t key = 0;
+    for (std::size_t bucket = 0; bucket < bucket_starts.size(); ++bucket)
+    {
+        while (key < keys.size() && (keys[key] >> (32 - bucket_bits)) < bucket)
+        {
+            ++key;
+        }
+        bucket_starts[bucket] = static_cast<std::uint32_t>(key);
+    }
+
+    IndexFileHeader header = {};
+    std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+    header.version = INDEX_VERSION;
+    header.track_count = static_cast<std::uint32_t>(tracks.size());
+    header.key_count = static_cast<std::uint32_t>(keys.size());
+    header.posting_count = static_cast<std::uint32_t>(entries_.size());
+    header.bucket_bits = bucket_bits;
+    header.fan_out = config_.fan_out;
+    header.min_pass_delta = config_.min_pass_delta;
+    header.max_pass_delta = config_.max_pass_delta;
+    header.max_bin_delta = config_.max_bin_delta;
+
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            throw std::runtime_error("Failed to create " + temp_path);
+        }
+        writeArray(out, &header, 1);
+        writeArray(out, bucket_starts.data(), bucket_starts.size());
+        writeArray(out, keys.data(), keys.size());
+        writeArray(out, offsets.data(), offsets.size());
+        // Postings are converted in chunks rather than copied as a whole,
+        // the entries already hold the largest part of the index in memory
+        std::vector<LandmarkIndex::Posting> chunk;
+        chunk.reserve(WRITE_CHUNK_POSTINGS);
+        for (std::size_t i = 0; i < entries_.size(); i += chunk.size())
+        {
+            chunk.clear();
+            const std::size_t end = std::min(entries_.size(), i + WRITE_CHUNK_POSTINGS);
+            for (std::size_t j = i; j < end; ++j)
+            {
+                chunk.push_back(LandmarkIndex::Posting{entries_[j].track_id, entries_[j].pass});
+            }
+            writeArray(out, chunk.data(), chunk.size());
+        }
+        out.close();
+        if (!out)
+        {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Failed to write " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temp_path.c_str());
+        throw std::runtime_error("Failed to replace " + path);
+    }
+}
+
+LandmarkIndex::LandmarkIndex()
+    : file_(), config_(), track_count_(0), bucket_bits_(0), key_count_(0), posting_count_(0),
+      bucket_starts_(nullptr), keys_(nullptr), offsets_(nullptr), postings_(nullptr)
+{
+}
+
+LandmarkIndex LandmarkIndex::Open(const std::string &path)
+{
+    LandmarkIndex index;
+    index.file_ = MappedFile(path);
+    const char *data = index.file_.data();
+    const std::size_t size = index.file_.size();
+
+    IndexFileHeader header;
+    if (size < sizeof(header))
+    {
+        throw std::runtime_error("Landmark index is truncated");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 ||
+        header.version != INDEX_VERSION)
+    {
+        throw std::runtime_error("Not a landmark index or unsupported version");
+    }
+    if (header.bucket_bits < MIN_BUCKET_BITS || header.bucket_bits > MAX_BUCKET_BITS)
+    {
+        throw std::runtime_error("Landmark index is corrupt");
+    }
+
+    const std::uint64_t bucket_count = (1ull << header.bucket_bits) + 1;
+    const std::uint64_t expected_size =
+        sizeof(header) + 4 * (bucket_count + header.key_count + header.key_count + 1) +
+        sizeof(Posting) * static_cast<std::uint64_t>(header.posting_count);
+    if (expected_size != size)
+    {
+        throw std::runtime_error("Landmark index size does not match its header");
+    }
+
+    index.config_.fan_out = header.fan_out;
+    index.config_.min_pass_delta = header.min_pass_delta;
+    index.config_.max_pass_delta = header.max_pass_delta;
+    index.config_.max_bin_delta = header.max_bin_delta;
+    index.track_count_ = header.track_count;
+    index.bucket_bits_ = header.bucket_bits;
+    index.key_count_ = header.key_count;
+    index.posting_count_ = header.posting_count;
+    index.bucket_starts_ = reinterpret_cast<const std::uint32_t *>(data + sizeof(header));
+    index.keys_ = index.bucket_starts_ + bucket_count;
+    index.offsets_ = index.keys_ + header.key_count;
+    index.postings_ = reinterpret_cast<const Posting *>(index.offsets_ + header.key_count + 1);
+
+    // Only the ends of the tables are checked, so that opening does not touch
+    // all their pages. find() clamps every range it reads to them, a corrupt
+    // entry in between gives wrong matches but no read out of bounds.
+    if (index.bucket_starts_[0] != 0 || index.bucket_starts_[bucket_count - 1] != header.key_count ||
+        index.offsets_[0] != 0 || index.offsets_[header.key_count] != header.posting_count)
+    {
+        throw std::runtime_error("Landmark index is corrupt");
+    }
+    return index;
+}
+
+const LandmarkIndex::Posting *LandmarkIndex::find(std::uint32_t hash, std::size_t *count) const
+{
+    *count = 0;
+    if (key_count_ == 0)
+    {
+        return nullptr;
+    }
+    const std::uint32_t bucket = hash >> (32 - bucket_bits_);
+    const std::size_t end_key = std::min<std::size_t>(bucket_starts_[bucket + 1], key_count_);
+    const std::uint32_t *begin = keys_ + std::min<std::size_t>(bucket_starts_[bucket], end_key);
+    const std::uint32_t *end = keys_ + end_key;
+    const std::uint32_t *key = std::lower_bound(begin, end, hash);
+    if (key == end || *key != hash)
+    {
+        return nullptr;
+    }
+    const std::size_t k = key - keys_;
+    const std::size_t last = std::min<std::size_t>(offsets_[k + 1], posting_count_);
+    const std::size_t first = std::min<std::size_t>(offsets_[k], last);
+    *count = last - first;
+    return postings_ + first;
+}
+
+MatchResult LandmarkIndex::Query(const Signature &query, std::uint32_t min_score,
+                                 std::uint32_t max_postings_per_hash) const
+{
+    std::vector<Landmark> landmarks;
+    ExtractLandmarks(query, config_, 0, &landmarks);
+    return Query(landmarks, min_score, max_postings_per_hash);
+}
+
+MatchResult LandmarkIndex::Query(const std::vector<Landmark> &query, std::uint32_t min_score,
+                                 std::uint32_t max_postings_per_hash) const
+{
+    MatchResult result = {false, 0, 0, 0, static_cast<std::uint32_t>(query.size())};
+
+    std::unordered_map<std::uint64_t, std::uint32_t> votes;
+    votes.reserve(query.size() * 4);
+    for (const auto &landmark : query)
+    {
+        std::size_t count = 0;
+        const Posting *postings = find(landmark.hash, &count);
+        if (count > max_postings_per_hash)
+        {
+            continue;
+        }
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::int64_t offset =
+                static_cast<std::int64_t>(postings[i].pass) - landmark.anchor_pass;
+            ++votes[voteKey(postings[i].track_id, offset)];
+        }
+    }
+
+    // A re-recorded peak can land one hop off, so neighbouring offsets of
+    // the same track vote together
+    auto votesAt = [&votes](std::uint64_t key) -> std::uint32_t {
+        const auto it = votes.find(key);
+        return it == votes.end() ? 0 : it->second;
+    };
+    std::uint64_t best_key = 0;
+    for (const auto &vote : votes)
+    {
+        const std::uint32_t track_id = static_cast<std::uint32_t>(vote.first >> 32);
+        const std::int32_t offset = static_cast<std::int32_t>(vote.first & 0xffffffffu);
+        const std::uint32_t score = vote.second + votesAt(voteKey(track_id, offset - 1)) +
+                                    votesAt(voteKey(track_id, offset + 1));
+        // Ties go to the lowest key so the result does not depend on hashing
+        if (score > result.score || (score == result.score && vote.first < best_key))
+        {
+            result.score = score;
+            result.track_id = track_id;
+            result.offset_passes = offset;
+            best_key = vote.first;
+        }
+    }
+    result.found = result.score > 0 && result.score >= min_score;
+    return result;
+}
@@ -0,0 +1,140 @@
+#ifndef LIB_MATCH_LANDMARK_INDEX_H_
+#define LIB_MATCH_LANDMARK_INDEX_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "algorithm/signature.h"
+#include "match/landmark.h"
+#include "utils/mapped_file.h"
+
+struct MatchResult
+{
+    bool found;
+    std::uint32_t track_id;
+    // Position of the query start in the track, in fft passes (128 samples
+    // at 16kHz). Negative if the query starts before the indexed audio.
+    std::int32_t offset_passes;
+    // Query landmarks that agree with that track and offset
+    std::uint32_t score;
+    std::uint32_t query_landmarks;
+};
+
+class LandmarkIndex;
+
+// Collects landmarks of any number of tracks in memory and writes them as
+// a LandmarkIndex file. Tracks can be added at any time, including from an
+// existing index to extend it.
+class LandmarkIndexBuilder
+{
+public:
+    explicit LandmarkIndexBuilder(const LandmarkConfig &config = LandmarkConfig());
+
+    // `pass_offset` places the signature within the track, for tracks
+    // indexed in several segments.
+    void AddSignature(std::uint32_t track_id, const Signature &signature,
+                      std::uint32_t pass_offset = 0);
+    void AddLandmarks(std::uint32_t track_id, const std::vector<Landmark> &landmarks);
+    // Copies every track of `index`, which must use the same config.
+    void AddIndex(const LandmarkIndex &index);
+
+    inline const LandmarkConfig &config() const
+    {
+        return config_;
+    }
+    inline std::size_t landmark_count() const
+    {
+        return entries_.size();
+    }
+
+    // Writes to a temporary file renamed over `path`, so readers that map
+    // the previous version keep a consistent view. Throws std::runtime_error.
+    void Write(const std::string &path);
+
+private:
+    struct Entry
+    {
+        std::uint32_t hash;
+        std::uint32_t track_id;
+        std::uint32_t pass;
+    };
+
+    LandmarkConfig config_;
+    std::vector<Entry> entries_;
+    std::vector<Landmark> scratch_;
+};
+
+// Read-only, memory-mapped inverted index from landmark hash to the tracks
+// and positions it occurs at.
+class LandmarkIndex
+{
+public:
+    struct Posting
+    {
+        std::uint32_t track_id;
+        std::uint32_t pass;
+    };
+
+    LandmarkIndex(LandmarkIndex &&) = default;
+    LandmarkIndex(const LandmarkIndex &) = delete;
+    // Throws std::runtime_error if the file is missing or corrupt.
+    static LandmarkIndex Open(const std::string &path);
+
+    // Votes for (track, offset) pairs over the query landmarks. Hashes that
+    // occur more than `max_postings_per_hash` times carry little information
+    // and are skipped. The result is found if the best pair has at least
+    // `min_score` votes.
+    MatchResult Query(const Signature &query, std::uint32_t min_score = 8,
+                      std::uint32_t max_postings_per_hash = 4096) const;
+    MatchResult Query(const std::vector<Landmark> &query, std::uint32_t min_score = 8,
+                      std::uint32_t max_postings_per_hash = 4096) const;
+
+    inline const LandmarkConfig &config() const
+    {
+        return config_;
+    }
+    inline std::uint32_t track_count() const
+    {
+        return track_count_;
+    }
+    inline std::size_t hash_count() const
+    {
+        return key_count_;
+    }
+    inline std::size_t posting_count() const
+    {
+        return posting_count_;
+    }
+
+    // Calls `visit(hash, postings, count)` for every hash in ascending order
+    template <typename Visitor> void ForEachHash(Visitor visit) const
+    {
+        for (std::size_t k = 0; k < key_count_; ++k)
+        {
+            // Clamped like find(), see Open()
+            const std::size_t last = std::min<std::size_t>(offsets_[k + 1], posting_count_);
+            const std::size_t first = std::min<std::size_t>(offsets_[k], last);
+            visit(keys_[k], postings_ + first, last - first);
+        }
+    }
+
+private:
+    LandmarkIndex();
+    const Posting *find(std::uint32_t hash, std::size_t *count) const;
+
+private:
+    MappedFile file_;
+    LandmarkConfig config_;
+    std::uint32_t track_count_;
+    std::uint32_t bucket_bits_;
+    std::size_t key_count_;
+    std::size_t posting_count_;
+    const std::uint32_t *bucket_starts_;
+    const std::uint32_t *keys_;
+    const std::uint32_t *offsets_;
+    const Posting *postings_;
+};
+
+#endif // LIB_MATCH_LANDMARK_INDEX_H_
@@ -0,0 +1,132 @@
+#include "match/lsh_table.h"
+#include <algorithm>
+#include <utility>
+
+namespace
+{
+// splitmix64 finalizer
+inline std::uint64_t mix64(std::uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+}
+
+bool isEmpty(const SignatureDigest &digest)
+{
+    return digest == EmptyDigest();
+}
+} // namespace
+
+LshTable::LshTable() : buckets_(), entries_()
+{
+}
+
+LshTable::BandKeys LshTable::bandKeys(const SignatureDigest &digest)
+{
+    BandKeys keys;
+    for (std::size_t band = 0; band < LSH_BANDS; ++band)
+    {
+        // Seeded with the band so equal values in different bands do not collide
+        std::uint64_t key = band;
+        for (std::size_t row = 0; row < LSH_ROWS; ++row)
+        {
+            key = mix64(key ^ digest[band * LSH_ROWS + row]);
+        }
+        keys[band] = key;
+    }
+    return keys;
+}
+
+bool LshTable::Insert(std::uint64_t id, const SignatureDigest &digest)
+{
+    if (isEmpty(digest))
+    {
+        return false;
+    }
+    Remove(id);
+    const BandKeys keys = bandKeys(digest);
+    for (const auto key : keys)
+    {
+        buckets_[key].push_back(id);
+    }
+    entries_.emplace(id, keys);
+    return true;
+}
+
+bool LshTable::Remove(std::uint64_t id)
+{
+    const auto entry = entries_.find(id);
+    if (entry == entries_.end())
+    {
+        return false;
+    }
+    for (const auto key : entry->second)
+    {
+        const auto bucket = buckets_.find(key);
+        auto &ids = bucket->second;
+        ids.erase(std::find(ids.begin(), ids.end(), id));
+        if (ids.empty())
+        {
+            buckets_.erase(bucket);
+        }
+    }
+    entries_.erase(entry);
+    return true;
+}
+
+void LshTable::Clear()
+{
+    buckets_.clear();
+    entries_.clear();
+}
+
+std::vector<std::uint64_t> LshTable::Query(const SignatureDigest &digest,
+                                           std::size_t min_bands) const
+{
+    std::vector<std::uint64_t> ids;
+    if (isEmpty(digest))
+    {
+        return ids;
+    }
+
+    // Buckets hold few ids, a flat list of (id, shared bands) beats a map
+    std::vector<std::pair<std::uint64_t, std::size_t>> shared;
+    for (const auto key : bandKeys(digest))
+    {
+        const auto bucket = buckets_.find(key);
+        if (bucket == buckets_.end())
+        {
+            continue;
+        }
+        for (const auto id : bucket->second)
+        {
+            auto it = std::find_if(shared.begin(), shared.end(),
+                                   [id](const std::pair<std::uint64_t, std::size_t> &candidate) {
+                                       return candidate.first == id;
+                                   });
+            if (it == shared.end())
+            {
+                shared.emplace_back(id, 1);
+            }
+            else
+            {
+                ++it->second;
+            }
+        }
+    }
+
+    std::sort(shared.begin(), shared.end(),
+              [](const std::pair<std::uint64_t, std::size_t> &a,
+                 const std::pair<std::uint64_t, std::size_t> &b) {
+                  return a.second != b.second ? a.second > b.second : a.first < b.first;
+              });
+    for (const auto &candidate : shared)
+    {
+        if (candidate.second >= min_bands)
+        {
+            ids.push_back(candidate.first);
+        }
+    }
+    return ids;
+}
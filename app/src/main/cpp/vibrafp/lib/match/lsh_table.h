@@ -0,0 +1,54 @@
+#ifndef LIB_MATCH_LSH_TABLE_H_
+#define LIB_MATCH_LSH_TABLE_H_
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "algorithm/signature_digest.h"
+
+// Digest values hashed together into one bucket key. Two digests whose
+// landmark sets have Jaccard similarity J share a given band with probability
+// J^LSH_ROWS, and at least one of the LSH_BANDS bands with probability
+// 1 - (1 - J^LSH_ROWS)^LSH_BANDS: almost surely from J = 0.5, one time in
+// two at J = 0.2 and once in a few hundred at the J of unrelated audio.
+constexpr std::size_t LSH_ROWS = 2u;
+constexpr std::size_t LSH_BANDS = DIGEST_SIZE / LSH_ROWS;
+
+// Near-duplicate lookup of signature digests. A lookup probes LSH_BANDS
+// buckets however many entries the table holds; the candidates it returns
+// are meant to be confirmed with CompareSignatures().
+class LshTable
+{
+public:
+    LshTable();
+
+    // Replaces any entry with the same id. Returns false and adds nothing
+    // for the digest of a signature without landmarks, which carries no
+    // information.
+    bool Insert(std::uint64_t id, const SignatureDigest &digest);
+    // Returns false if there was no entry with this id
+    bool Remove(std::uint64_t id);
+    void Clear();
+
+    // Ids of the entries sharing at least `min_bands` bands with `digest`,
+    // those sharing the most first, then by id.
+    std::vector<std::uint64_t> Query(const SignatureDigest &digest,
+                                     std::size_t min_bands = 1) const;
+
+    inline std::size_t size() const
+    {
+        return entries_.size();
+    }
+
+private:
+    typedef std::array<std::uint64_t, LSH_BANDS> BandKeys;
+
+    static BandKeys bandKeys(const SignatureDigest &digest);
+
+    // Bucket key to the ids of the entries with that key
+    std::unordered_map<std::uint64_t, std::vector<std::uint64_t>> buckets_;
+    std::unordered_map<std::uint64_t, BandKeys> entries_;
+};
+
+#endif // LIB_MATCH_LSH_TABLE_H_
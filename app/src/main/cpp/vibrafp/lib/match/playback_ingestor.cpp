@@ -0,0 +1,133 @@
+#include "match/playback_ingestor.h"
+#include <algorithm>
+#include <limits>
+#include "match/index_segments.h"
+#include "match/landmark_index.h"
+
+struct PlaybackIngestor::Track
+{
+    Track(std::uint32_t track_id, SampleFormat sample_format, std::uint32_t sample_rate,
+          std::uint32_t bits_per_sample, std::uint32_t channels)
+        : id(track_id), downsampler(sample_format, sample_rate, bits_per_sample, channels),
+          queue_offset(0)
+    {
+    }
+
+    std::uint32_t id;
+    Downsampler downsampler;
+    SignatureGenerator generator;
+    std::vector<std::uint8_t> queue; // PCM not analysed yet, from queue_offset on
+    std::size_t queue_offset;
+    LowQualityTrack block; // scratch for the downsampler output
+    std::vector<Landmark> landmarks;
+};
+
+PlaybackIngestor::PlaybackIngestor(const std::string &directory, const LandmarkConfig &config)
+    : directory_(directory), config_(config)
+{
+}
+
+PlaybackIngestor::~PlaybackIngestor() = default;
+
+void PlaybackIngestor::BeginTrack(std::uint32_t track_id, SampleFormat sample_format,
+                                  std::uint32_t sample_rate, std::uint32_t bits_per_sample,
+                                  std::uint32_t channels)
+{
+    EndTrack();
+    std::unique_ptr<Track> track(
+        new Track(track_id, sample_format, sample_rate, bits_per_sample, channels));
+    // A track is one signature as long as the audio, its landmark passes
+    // then count from the start of the track
+    track->generator.set_max_time_seconds(std::numeric_limits<double>::infinity());
+    track->generator.EnableLandmarks(config_);
+    current_ = std::move(track);
+}
+
+std::size_t PlaybackIngestor::Feed(const void *pcm, std::size_t size,
+                                   std::chrono::microseconds budget)
+{
+    if (current_ == nullptr)
+    {
+        return 0;
+    }
+    Track &track = *current_;
+    const std::size_t queued = track.queue.size() - track.queue_offset;
+    if (queued + size > MAX_INGEST_QUEUE_BYTES)
+    {
+        AbandonTrack();
+        return 0;
+    }
+    if (track.queue_offset > 0 && track.queue_offset >= track.queue.size() / 2)
+    {
+        track.queue.erase(track.queue.begin(), track.queue.begin() + track.queue_offset);
+        track.queue_offset = 0;
+    }
+    const std::uint8_t *bytes = static_cast<const std::uint8_t *>(pcm);
+    track.queue.insert(track.queue.end(), bytes, bytes + size);
+
+    const auto deadline = std::chrono::steady_clock::now() + budget;
+    while (track.queue_offset < track.queue.size() && std::chrono::steady_clock::now() < deadline)
+    {
+        analyse(&track, INGEST_SLICE_FRAMES);
+    }
+    return track.queue.size() - track.queue_offset;
+}
+
+void PlaybackIngestor::EndTrack()
+{
+    if (current_ == nullptr)
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(ended_mutex_);
+    ended_.push_back(std::move(current_));
+}
+
+void PlaybackIngestor::AbandonTrack()
+{
+    current_.reset();
+}
+
+std::vector<std::uint32_t> PlaybackIngestor::Commit()
+{
+    std::vector<std::unique_ptr<Track>> ended;
+    {
+        std::lock_guard<std::mutex> lock(ended_mutex_);
+        ended.swap(ended_);
+    }
+
+    LandmarkIndexBuilder builder(config_);
+    std::vector<std::uint32_t> written;
+    for (auto &track : ended)
+    {
+        analyse(track.get(), std::numeric_limits<std::size_t>::max());
+        track->block.clear();
+        track->downsampler.Flush(&track->block);
+        track->generator.ProcessInput(track->block.data(), track->block.size());
+        track->generator.TakeLandmarks(&track->landmarks);
+        if (track->landmarks.size() >= MIN_INGEST_LANDMARKS)
+        {
+            builder.AddLandmarks(track->id, track->landmarks);
+            written.push_back(track->id);
+        }
+        track.reset();
+    }
+    if (!written.empty())
+    {
+        AppendIndexSegment(directory_, builder);
+    }
+    return written;
+}
+
+void PlaybackIngestor::analyse(Track *track, std::size_t max_frames)
+{
+    const std::size_t frame_size = track->downsampler.frame_size();
+    const std::size_t queued = track->queue.size() - track->queue_offset;
+    const std::size_t size =
+        max_frames >= queued / frame_size ? queued : max_frames * frame_size;
+    track->block.clear();
+    track->downsampler.Process(track->queue.data() + track->queue_offset, size, &track->block);
+    track->generator.ProcessInput(track->block.data(), track->block.size());
+    track->generator.TakeLandmarks(&track->landmarks);
+    track->queue_offset += size;
+}
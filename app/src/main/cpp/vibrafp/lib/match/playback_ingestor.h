@@ -0,0 +1,88 @@
+#ifndef LIB_MATCH_PLAYBACK_INGESTOR_H_
+#define LIB_MATCH_PLAYBACK_INGESTOR_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "algorithm/signature_generator.h"
+#include "audio/downsampler.h"
+#include "match/landmark.h"
+
+// Source frames analysed between budget checks, about 23 ms of 44.1kHz audio
+constexpr std::size_t INGEST_SLICE_FRAMES = 1024;
+// A track whose queue grows past this, about 47 s of 44.1kHz stereo int16,
+// is not keeping up with playback and is dropped rather than buffered
+constexpr std::size_t MAX_INGEST_QUEUE_BYTES = 8u << 20;
+// Tracks with fewer landmarks were played too briefly to be worth indexing
+constexpr std::size_t MIN_INGEST_LANDMARKS = 512;
+
+// Fingerprints audio while it is played and appends it to a segmented
+// landmark index (see match/index_segments.h), so that a later recording of
+// anything played matches on device.
+//
+// The audio thread calls BeginTrack(), Feed() and EndTrack(). Feed() only
+// copies the block and analyses queued audio for as long as its time budget
+// allows, so it never holds up playback for longer than that. Ended tracks
+// are finished and written by Commit(), meant for a low priority thread.
+class PlaybackIngestor
+{
+public:
+    explicit PlaybackIngestor(const std::string &directory,
+                              const LandmarkConfig &config = LandmarkConfig());
+    PlaybackIngestor(const PlaybackIngestor &) = delete;
+    PlaybackIngestor &operator=(const PlaybackIngestor &) = delete;
+    ~PlaybackIngestor();
+
+    // Ends the current track, if any, and starts ingesting `track_id`.
+    // `track_id` must not have been committed before, a track has to be in
+    // a single segment. Throws std::invalid_argument for unsupported formats.
+    void BeginTrack(std::uint32_t track_id, SampleFormat sample_format,
+                    std::uint32_t sample_rate, std::uint32_t bits_per_sample,
+                    std::uint32_t channels);
+
+    // Queues `size` bytes of interleaved PCM of the current track and
+    // analyses queued audio until `budget` is spent, checked after every
+    // INGEST_SLICE_FRAMES so one slice may overrun it. Returns the bytes still
+    // queued, which later calls or Commit() take care of. Drops the track when
+    // the queue would grow past MAX_INGEST_QUEUE_BYTES, tracking() is false
+    // then. Ignored when no track is being ingested.
+    std::size_t Feed(const void *pcm, std::size_t size, std::chrono::microseconds budget);
+
+    // Hands the current track over to Commit()
+    void EndTrack();
+
+    // Drops the current track, nothing of it is indexed
+    void AbandonTrack();
+
+    // True between BeginTrack() and EndTrack() unless the track was dropped
+    inline bool tracking() const
+    {
+        return current_ != nullptr;
+    }
+
+    // Analyses what is left of the ended tracks and writes those long enough
+    // as a new segment. May run concurrently with the audio thread calls but
+    // not with another Commit(). Returns the ids of the tracks written, in
+    // the order they ended; the others will never be indexed under their id.
+    // Throws std::runtime_error, the ended tracks are lost then.
+    std::vector<std::uint32_t> Commit();
+
+private:
+    struct Track;
+
+    void analyse(Track *track, std::size_t max_frames);
+
+private:
+    std::string directory_;
+    LandmarkConfig config_;
+    std::unique_ptr<Track> current_; // audio thread only
+
+    std::mutex ended_mutex_;
+    std::vector<std::unique_ptr<Track>> ended_;
+};
+
+#endif // LIB_MATCH_PLAYBACK_INGESTOR_H_
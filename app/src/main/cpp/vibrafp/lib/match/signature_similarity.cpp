@@ -0,0 +1,206 @@
+#include "match/signature_similarity.h"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+inline std::uint32_t absDifference(std::uint32_t x, std::uint32_t y)
+{
+    return x > y ? x - y : y - x;
+}
+
+inline bool binsMatch(const FrequencyPeak &x, const FrequencyPeak &y, std::uint32_t jitter)
+{
+    return absDifference(x.corrected_peak_frequency_bin(), y.corrected_peak_frequency_bin()) <=
+           jitter;
+}
+
+std::uint32_t lastPass(const Signature &signature)
+{
+    std::uint32_t last = 0;
+    for (const auto &pair : signature.frequency_band_to_peaks())
+    {
+        if (!pair.second.empty())
+        {
+            last = std::max(last, pair.second.back().fft_pass_number());
+        }
+    }
+    return last;
+}
+
+// Peaks of `peaks` with a partner in `others` at the aligned position. Each
+// peak counts once however many partners it has.
+std::uint32_t countMatched(const std::vector<FrequencyPeak> &peaks,
+                           const std::vector<FrequencyPeak> &others, std::int64_t offset,
+                           const SimilarityConfig &config)
+{
+    const std::int64_t jitter = config.max_pass_jitter;
+    std::uint32_t matched = 0;
+    for (const auto &peak : peaks)
+    {
+        const std::int64_t aligned = static_cast<std::int64_t>(peak.fft_pass_number()) - offset;
+        // peaks are in time order
+        auto other = std::lower_bound(others.begin(), others.end(), aligned - jitter,
+                                      [](const FrequencyPeak &p, std::int64_t pass) {
+                                          return static_cast<std::int64_t>(p.fft_pass_number()) <
+                                                 pass;
+                                      });
+        for (; other != others.end() &&
+               static_cast<std::int64_t>(other->fft_pass_number()) <= aligned + jitter;
+             ++other)
+        {
+            if (binsMatch(peak, *other, config.max_bin_jitter))
+            {
+                ++matched;
+                break;
+            }
+        }
+    }
+    return matched;
+}
+
+struct BinAndPass
+{
+    std::uint32_t bin;
+    std::uint32_t pass;
+
+    bool operator<(const BinAndPass &other) const
+    {
+        return bin < other.bin;
+    }
+};
+
+void sortByBin(const std::vector<FrequencyPeak> &peaks, std::vector<BinAndPass> *sorted)
+{
+    sorted->clear();
+    for (const auto &peak : peaks)
+    {
+        sorted->push_back(BinAndPass{peak.corrected_peak_frequency_bin(), peak.fft_pass_number()});
+    }
+    std::sort(sorted->begin(), sorted->end());
+}
+
+std::uint32_t countInRange(const std::vector<FrequencyPeak> &peaks, std::int64_t first,
+                           std::int64_t last)
+{
+    std::uint32_t count = 0;
+    for (const auto &peak : peaks)
+    {
+        const std::int64_t pass = peak.fft_pass_number();
+        count += pass >= first && pass <= last;
+    }
+    return count;
+}
+} // namespace
+
+SimilarityConfig::SimilarityConfig() : max_bin_jitter(64), max_pass_jitter(1), min_overlap_peaks(32)
+{
+}
+
+SimilarityResult CompareSignatures(const Signature &a, const Signature &b,
+                                   const SimilarityConfig &config)
+{
+    if (a.sample_rate() != b.sample_rate())
+    {
+        throw std::invalid_argument("Signatures have different sample rates");
+    }
+    SimilarityResult result = {0.0, 0, 0};
+
+    // votes[offset + last_b] for offsets from -last_b to last_a
+    const std::int64_t last_a = lastPass(a);
+    const std::int64_t last_b = lastPass(b);
+    std::vector<std::uint32_t> votes(static_cast<std::size_t>(last_a + last_b + 1), 0);
+    const auto &bands_a = a.frequency_band_to_peaks();
+    const auto &bands_b = b.frequency_band_to_peaks();
+    std::vector<BinAndPass> sorted_a, sorted_b;
+    for (const auto &pair : bands_a)
+    {
+        const auto other = bands_b.find(pair.first);
+        if (other == bands_b.end())
+        {
+            continue;
+        }
+        // With both sides ordered by frequency only pairs within the bin
+        // jitter are visited
+        sortByBin(pair.second, &sorted_a);
+        sortByBin(other->second, &sorted_b);
+        std::size_t window_start = 0;
+        for (const auto &peak_a : sorted_a)
+        {
+            while (window_start < sorted_b.size() &&
+                   sorted_b[window_start].bin + config.max_bin_jitter < peak_a.bin)
+            {
+                ++window_start;
+            }
+            for (std::size_t k = window_start;
+                 k < sorted_b.size() && sorted_b[k].bin <= peak_a.bin + config.max_bin_jitter; ++k)
+            {
+                ++votes[peak_a.pass + last_b - sorted_b[k].pass];
+            }
+        }
+    }
+
+    // Offsets within the pass jitter of each other vote together, the
+    // offset with the most votes of its own breaks ties
+    const std::int64_t jitter = config.max_pass_jitter;
+    const std::int64_t size = static_cast<std::int64_t>(votes.size());
+    std::uint64_t best_window = 0;
+    std::uint32_t best_votes = 0;
+    std::int64_t best_index = -1;
+    for (std::int64_t i = 0; i < size; ++i)
+    {
+        if (votes[i] == 0)
+        {
+            continue;
+        }
+        std::uint64_t window = 0;
+        for (std::int64_t j = std::max<std::int64_t>(0, i - jitter);
+             j <= std::min(size - 1, i + jitter); ++j)
+        {
+            window += votes[j];
+        }
+        if (window > best_window || (window == best_window && votes[i] > best_votes))
+        {
+            best_window = window;
+            best_votes = votes[i];
+            best_index = i;
+        }
+    }
+    if (best_index < 0)
+    {
+        return result;
+    }
+    const std::int64_t offset = best_index - last_b;
+    result.offset_passes = static_cast<std::int32_t>(offset);
+
+    // Count each peak once, in both directions, over the shared time range
+    const std::int64_t first_shared = std::max<std::int64_t>(0, offset);
+    const std::int64_t last_shared = std::min(last_a, last_b + offset);
+    std::uint32_t matched_a = 0, matched_b = 0, overlap_a = 0, overlap_b = 0;
+    for (const auto &pair : bands_a)
+    {
+        overlap_a += countInRange(pair.second, first_shared - jitter, last_shared + jitter);
+        const auto other = bands_b.find(pair.first);
+        if (other != bands_b.end())
+        {
+            matched_a += countMatched(pair.second, other->second, offset, config);
+        }
+    }
+    for (const auto &pair : bands_b)
+    {
+        overlap_b += countInRange(pair.second, first_shared - offset - jitter,
+                                  last_shared - offset + jitter);
+        const auto other = bands_a.find(pair.first);
+        if (other != bands_a.end())
+        {
+            matched_b += countMatched(pair.second, other->second, -offset, config);
+        }
+    }
+
+    result.matched_peaks = std::min(matched_a, matched_b);
+    const std::uint32_t overlap =
+        std::max(std::min(overlap_a, overlap_b), config.min_overlap_peaks);
+    result.score = std::min(1.0, static_cast<double>(result.matched_peaks) / overlap);
+    return result;
+}
@@ -0,0 +1,36 @@
+#ifndef LIB_MATCH_SIGNATURE_SIMILARITY_H_
+#define LIB_MATCH_SIGNATURE_SIMILARITY_H_
+
+#include <cstdint>
+#include "algorithm/signature.h"
+
+struct SimilarityResult
+{
+    // Matched peaks over the peaks either signature has in the time range
+    // they share, from 0 for unrelated audio to 1 for identical signatures
+    double score;
+    // Shift that aligns `b` with `a`: a peak at pass p in `b` lines up with
+    // pass p + offset_passes in `a`
+    std::int32_t offset_passes;
+    std::uint32_t matched_peaks;
+};
+
+struct SimilarityConfig
+{
+    SimilarityConfig();
+
+    std::uint32_t max_bin_jitter;  // in 1/64 FFT bin units, as corrected_peak_frequency_bin()
+    std::uint32_t max_pass_jitter; // in fft passes, around the aligned position
+    // Shared ranges with fewer peaks than this are scored as if they had
+    // this many, so a handful of coincidences cannot score high
+    std::uint32_t min_overlap_peaks;
+};
+
+// Aligns the peaks of `a` and `b` band by band: every pair of peaks with
+// close frequencies votes for their time offset, then the peaks that agree
+// with the winning offset are counted. Throws std::invalid_argument if the
+// signatures have different sample rates.
+SimilarityResult CompareSignatures(const Signature &a, const Signature &b,
+                                   const SimilarityConfig &config = SimilarityConfig());
+
+#endif // LIB_MATCH_SIGNATURE_SIMILARITY_H_
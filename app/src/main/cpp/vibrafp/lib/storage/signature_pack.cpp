@@ -0,0 +1,575 @@
+#include "storage/signature_pack.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+constexpr char PACK_MAGIC[8] = {'V', 'I', 'B', 'R', 'A', 'S', 'P', 'K'};
+constexpr std::uint32_t PACK_VERSION = 1;
+constexpr std::size_t BAND_COUNT = 5;
+constexpr std::uint32_t MAX_RICE_BITS = 31;
+// Quotients this large are written as ones followed by the raw value, so a
+// corrupt or unusual delta costs at most RICE_ESCAPE + 64 bits
+constexpr std::uint64_t RICE_ESCAPE = 32;
+
+// File layout, every field little-endian:
+//   PackFileHeader
+//   Entry entries[entry_count]  ascending keys
+//   char records[records_size]  one record per entry, byte aligned
+// Record layout:
+//   varint sample_rate, varint num_samples, uint8 band mask (bit band + 1)
+//   per band present: varint peak_count, varint payload_size,
+//                     uint8 rice_bits[3]
+//   per band present: payload, LSB first bit stream of the Rice coded
+//                     pass delta, zigzag magnitude delta and zigzag bin delta
+//                     of each peak, padded to a byte
+struct PackFileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t entry_count;
+    std::uint64_t records_size;
+};
+
+static_assert(sizeof(PackFileHeader) == 24, "PackFileHeader must not be padded");
+
+// Bit index of a power of two, from the top bits of its product with a de
+// Bruijn sequence. Counts the unary part of a Rice code without a branch per bit.
+constexpr std::uint64_t DE_BRUIJN_64 = 0x03f79d71b4cb0a89ull;
+constexpr std::uint8_t DE_BRUIJN_BIT_INDEX[64] = {
+    0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,  62, 55, 59, 36, 53, 51,
+    43, 22, 45, 39, 33, 30, 24, 18, 12, 5,  63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21,
+    44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6};
+
+inline std::uint32_t trailingOnes(std::uint64_t value)
+{
+    const std::uint64_t zeros = ~value;
+    if (zeros == 0)
+    {
+        return 64;
+    }
+    return DE_BRUIJN_BIT_INDEX[((zeros & (~zeros + 1)) * DE_BRUIJN_64) >> 58];
+}
+
+inline std::uint64_t zigzag(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t value)
+{
+    return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+}
+
+void putVarint(std::string *out, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out->push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out->push_back(static_cast<char>(value));
+}
+
+std::uint64_t getVarint(const char **p, const char *end)
+{
+    std::uint64_t value = 0;
+    for (std::uint32_t shift = 0; shift < 64; shift += 7)
+    {
+        if (*p == end)
+        {
+            break;
+        }
+        const auto byte = static_cast<std::uint8_t>(*(*p)++);
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return value;
+        }
+    }
+    throw std::runtime_error("Signature record is truncated");
+}
+
+class BitWriter
+{
+public:
+    explicit BitWriter(std::string *out) : out_(out), pending_(0), pending_bits_(0)
+    {
+    }
+
+    // At most 33 bits at a time
+    void Put(std::uint64_t value, std::uint32_t count)
+    {
+        pending_ |= (value & ((1ull << count) - 1)) << pending_bits_;
+        pending_bits_ += count;
+        while (pending_bits_ >= 8)
+        {
+            out_->push_back(static_cast<char>(pending_));
+            pending_ >>= 8;
+            pending_bits_ -= 8;
+        }
+    }
+
+    void PutRice(std::uint64_t value, std::uint32_t bits)
+    {
+        const std::uint64_t quotient = value >> bits;
+        if (quotient >= RICE_ESCAPE)
+        {
+            Put(0xffffffffu, RICE_ESCAPE);
+            Put(value, 32);
+            Put(value >> 32, 32);
+            return;
+        }
+        Put((1ull << quotient) - 1, static_cast<std::uint32_t>(quotient) + 1);
+        Put(value, bits);
+    }
+
+    void Flush()
+    {
+        if (pending_bits_ > 0)
+        {
+            out_->push_back(static_cast<char>(pending_));
+            pending_ = 0;
+            pending_bits_ = 0;
+        }
+    }
+
+private:
+    std::string *out_;
+    std::uint64_t pending_;
+    std::uint32_t pending_bits_;
+};
+
+inline std::size_t riceSize(std::uint64_t value, std::uint32_t bits)
+{
+    const std::uint64_t quotient = value >> bits;
+    return quotient >= RICE_ESCAPE ? RICE_ESCAPE + 64 : quotient + 1 + bits;
+}
+
+std::uint32_t bestRiceBits(const std::vector<std::uint64_t> &values)
+{
+    std::uint32_t best_bits = 0;
+    std::size_t best_size = std::numeric_limits<std::size_t>::max();
+    for (std::uint32_t bits = 0; bits <= MAX_RICE_BITS; ++bits)
+    {
+        std::size_t size = 0;
+        for (std::uint64_t value : values)
+        {
+            size += riceSize(value, bits);
+        }
+        if (size < best_size)
+        {
+            best_size = size;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+std::string encodeRecord(const Signature &signature)
+{
+    std::string record;
+    putVarint(&record, signature.sample_rate());
+    putVarint(&record, signature.num_samples());
+
+    std::uint8_t band_mask = 0;
+    std::string band_headers;
+    std::string payloads;
+    std::vector<std::uint64_t> fields[3];
+    for (const auto &pair : signature.frequency_band_to_peaks())
+    {
+        const auto &peaks = pair.second;
+        band_mask |= 1u << (static_cast<std::int32_t>(pair.first) + 1);
+
+        for (auto &field : fields)
+        {
+            field.clear();
+        }
+        std::int64_t fft_pass_number = 0;
+        std::int64_t peak_magnitude = 0;
+        std::int64_t frequency_bin = 0;
+        for (const auto &peak : peaks)
+        {
+            fields[0].push_back(zigzag(peak.fft_pass_number() - fft_pass_number));
+            fields[1].push_back(zigzag(peak.peak_magnitude() - peak_magnitude));
+            fields[2].push_back(zigzag(peak.corrected_peak_frequency_bin() - frequency_bin));
+            fft_pass_number = peak.fft_pass_number();
+            peak_magnitude = peak.peak_magnitude();
+            frequency_bin = peak.corrected_peak_frequency_bin();
+        }
+
+        std::uint32_t rice_bits[3];
+        for (std::size_t f = 0; f < 3; ++f)
+        {
+            rice_bits[f] = bestRiceBits(fields[f]);
+        }
+        const std::size_t payload_start = payloads.size();
+        BitWriter writer(&payloads);
+        for (std::size_t i = 0; i < peaks.size(); ++i)
+        {
+            for (std::size_t f = 0; f < 3; ++f)
+            {
+                writer.PutRice(fields[f][i], rice_bits[f]);
+            }
+        }
+        writer.Flush();
+
+        putVarint(&band_headers, peaks.size());
+        putVarint(&band_headers, payloads.size() - payload_start);
+        for (std::uint32_t bits : rice_bits)
+        {
+            band_headers.push_back(static_cast<char>(bits));
+        }
+    }
+    record.push_back(static_cast<char>(band_mask));
+    record += band_headers;
+    record += payloads;
+    return record;
+}
+} // namespace
+
+void SignaturePackWriter::Add(std::uint64_t key, const Signature &signature)
+{
+    records_[key] = encodeRecord(signature);
+}
+
+void SignaturePackWriter::AddUri(std::uint64_t key, const char *uri, std::size_t size)
+{
+    Signature signature(0, 0);
+    try
+    {
+        signature = Signature::DecodeBase64(uri, size);
+    }
+    catch (const std::runtime_error &e)
+    {
+        throw std::invalid_argument(e.what());
+    }
+    // The prefix is optional on input but always emitted
+    const std::string encoded = signature.EncodeBase64();
+    if (encoded.size() < size || encoded.compare(encoded.size() - size, size, uri, size) != 0)
+    {
+        throw std::invalid_argument("Signature is not in its canonical encoding");
+    }
+    Add(key, signature);
+}
+
+void SignaturePackWriter::AddPack(const SignaturePack &pack)
+{
+    // Every entry must lie within the records and start with a valid header
+    // before any is copied, so a corrupt pack adds nothing
+    for (std::size_t i = 0; i < pack.size(); ++i)
+    {
+        pack.record(i);
+    }
+    for (std::size_t i = 0; i < pack.size(); ++i)
+    {
+        const SignaturePack::Entry &entry = pack.entries_[i];
+        records_[entry.key].assign(pack.records_ + entry.offset, entry.size);
+    }
+}
+
+bool SignaturePackWriter::Remove(std::uint64_t key)
+{
+    return records_.erase(key) != 0;
+}
+
+void SignaturePackWriter::Write(const std::string &path) const
+{
+    std::vector<SignaturePack::Entry> entries;
+    entries.reserve(records_.size());
+    std::uint64_t records_size = 0;
+    for (const auto &pair : records_)
+    {
+        if (records_size + pair.second.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error("Too many signatures for one pack");
+        }
+        entries.push_back(SignaturePack::Entry{pair.first, static_cast<std::uint32_t>(records_size),
+                                               static_cast<std::uint32_t>(pair.second.size())});
+        records_size += pair.second.size();
+    }
+
+    PackFileHeader header = {};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.entry_count = static_cast<std::uint32_t>(entries.size());
+    header.records_size = records_size;
+
+    const std::string temp_path = path + ".tmp";
+    {
+        std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+        if (!out)
+        {
+            throw std::runtime_error("Failed to create " + temp_path);
+        }
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char *>(entries.data()),
+                  static_cast<std::streamsize>(entries.size() * sizeof(SignaturePack::Entry)));
+        for (const auto &pair : records_)
+        {
+            out.write(pair.second.data(), static_cast<std::streamsize>(pair.second.size()));
+        }
+        out.close();
+        if (!out)
+        {
+            std::remove(temp_path.c_str());
+            throw std::runtime_error("Failed to write " + temp_path);
+        }
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temp_path.c_str());
+        throw std::runtime_error("Failed to replace " + path);
+    }
+}
+
+SignatureRecord::SignatureRecord(const char *data, std::size_t size)
+    : size_(size), peak_count_(0), band_count_(0)
+{
+    const char *p = data;
+    const char *end = data + size;
+    const std::uint64_t sample_rate = getVarint(&p, end);
+    const std::uint64_t num_samples = getVarint(&p, end);
+    if (sample_rate > std::numeric_limits<std::uint32_t>::max() ||
+        num_samples > std::numeric_limits<std::uint32_t>::max() || p == end)
+    {
+        throw std::runtime_error("Signature record header is corrupt");
+    }
+    sample_rate_ = static_cast<std::uint32_t>(sample_rate);
+    num_samples_ = static_cast<std::uint32_t>(num_samples);
+
+    const auto band_mask = static_cast<std::uint8_t>(*p++);
+    if (band_mask >> BAND_COUNT != 0)
+    {
+        throw std::runtime_error("Signature record has an unknown frequency band");
+    }
+    std::uint64_t payloads_size = 0;
+    for (std::size_t b = 0; b < BAND_COUNT; ++b)
+    {
+        if ((band_mask & (1u << b)) == 0)
+        {
+            continue;
+        }
+        Band &band = bands_[band_count_++];
+        band.band = static_cast<FrequencyBand>(static_cast<std::int32_t>(b) - 1);
+        const std::uint64_t peak_count = getVarint(&p, end);
+        const std::uint64_t payload_size = getVarint(&p, end);
+        // Every peak takes at least a bit per field, so a count the payload
+        // cannot hold is corrupt before any of it is decoded
+        if (static_cast<std::size_t>(end - p) < 3 ||
+            payload_size > static_cast<std::uint64_t>(end - p) ||
+            peak_count > std::numeric_limits<std::uint32_t>::max() - peak_count_ ||
+            peak_count * 3 > payload_size * 8)
+        {
+            throw std::runtime_error("Signature record header is corrupt");
+        }
+        band.peak_count = static_cast<std::uint32_t>(peak_count);
+        band.payload_size = static_cast<std::size_t>(payload_size);
+        peak_count_ += band.peak_count;
+        for (auto &bits : band.rice_bits)
+        {
+            bits = static_cast<std::uint8_t>(*p++);
+            if (bits > MAX_RICE_BITS)
+            {
+                throw std::runtime_error("Signature record header is corrupt");
+            }
+        }
+        payloads_size += band.payload_size;
+    }
+    if (payloads_size != static_cast<std::uint64_t>(end - p))
+    {
+        throw std::runtime_error("Signature record size does not match its header");
+    }
+    for (std::uint32_t b = 0; b < band_count_; ++b)
+    {
+        bands_[b].payload = reinterpret_cast<const std::uint8_t *>(p);
+        p += bands_[b].payload_size;
+    }
+}
+
+Signature SignatureRecord::ToSignature() const
+{
+    Signature signature(sample_rate_, num_samples_);
+    auto &band_to_peaks = signature.frequency_band_to_peaks();
+    DigestBuilder digest_builder;
+    for (std::uint32_t b = 0; b < band_count_; ++b)
+    {
+        auto &peaks = band_to_peaks[bands_[b].band];
+        peaks.reserve(bands_[b].peak_count);
+        BandDecoder decoder(bands_[b], sample_rate_);
+        for (std::uint32_t i = 0; i < bands_[b].peak_count; ++i)
+        {
+            peaks.push_back(decoder.Next());
+            digest_builder.AddPeak(bands_[b].band, peaks.back());
+        }
+    }
+    signature.set_digest(digest_builder.Digest());
+    return signature;
+}
+
+std::string SignatureRecord::EncodeBase64() const
+{
+    return ToSignature().EncodeBase64();
+}
+
+SignatureRecord::BandDecoder::BandDecoder(const Band &band, std::uint32_t sample_rate)
+    : band_(band), sample_rate_(sample_rate), next_byte_(0), buffer_(0), buffered_bits_(0),
+      fft_pass_number_(0), peak_magnitude_(0), frequency_bin_(0)
+{
+}
+
+void SignatureRecord::BandDecoder::refill()
+{
+    // At most 63 bits, so any count of buffered bits can be shifted out.
+    // Whole bytes only, the bits past the buffered ones stay zero.
+    const std::uint32_t room = (63 - buffered_bits_) >> 3;
+    if (band_.payload_size - next_byte_ >= 8)
+    {
+        std::uint64_t word = 0;
+        for (std::uint32_t i = 0; i < 8; ++i)
+        {
+            word |= static_cast<std::uint64_t>(band_.payload[next_byte_ + i]) << (i << 3);
+        }
+        buffer_ |= (word & ((1ull << (room << 3)) - 1)) << buffered_bits_;
+        next_byte_ += room;
+        buffered_bits_ += room << 3;
+        return;
+    }
+    for (std::uint32_t i = 0; i < room && next_byte_ < band_.payload_size; ++i)
+    {
+        buffer_ |= static_cast<std::uint64_t>(band_.payload[next_byte_++]) << buffered_bits_;
+        buffered_bits_ += 8;
+    }
+}
+
+void SignatureRecord::BandDecoder::consume(std::uint32_t count)
+{
+    if (count > buffered_bits_)
+    {
+        throw std::runtime_error("Signature record payload is truncated");
+    }
+    buffer_ >>= count;
+    buffered_bits_ -= count;
+}
+
+std::uint64_t SignatureRecord::BandDecoder::readBits(std::uint32_t count)
+{
+    refill();
+    const std::uint64_t value = buffer_ & ((1ull << count) - 1);
+    consume(count);
+    return value;
+}
+
+inline std::uint64_t SignatureRecord::BandDecoder::readRice(std::uint32_t bits)
+{
+    if (buffered_bits_ < 32)
+    {
+        refill();
+    }
+    // Bits past the buffered ones are zero, so this stops there at the latest
+    const std::uint32_t quotient = trailingOnes(buffer_);
+    const std::uint32_t size = quotient + 1 + bits;
+    if (quotient >= RICE_ESCAPE || size > buffered_bits_)
+    {
+        return readLongRice(bits);
+    }
+    const std::uint64_t value =
+        (static_cast<std::uint64_t>(quotient) << bits) | ((buffer_ >> (quotient + 1)) & ((1ull << bits) - 1));
+    buffer_ >>= size;
+    buffered_bits_ -= size;
+    return value;
+}
+
+std::uint64_t SignatureRecord::BandDecoder::readLongRice(std::uint32_t bits)
+{
+    std::uint64_t quotient = 0;
+    for (;;)
+    {
+        refill();
+        const bool one = (buffer_ & 1) != 0;
+        consume(1);
+        if (!one)
+        {
+            break;
+        }
+        if (++quotient == RICE_ESCAPE)
+        {
+            const std::uint64_t low = readBits(32);
+            return low | (readBits(32) << 32);
+        }
+    }
+    return (quotient << bits) | readBits(bits);
+}
+
+FrequencyPeak SignatureRecord::BandDecoder::Next()
+{
+    fft_pass_number_ += static_cast<std::uint32_t>(unzigzag(readRice(band_.rice_bits[0])));
+    peak_magnitude_ += static_cast<std::uint32_t>(unzigzag(readRice(band_.rice_bits[1])));
+    frequency_bin_ += static_cast<std::uint32_t>(unzigzag(readRice(band_.rice_bits[2])));
+    return FrequencyPeak(fft_pass_number_, peak_magnitude_, frequency_bin_, sample_rate_);
+}
+
+SignaturePack::SignaturePack()
+    : file_(), entry_count_(0), entries_(nullptr), records_(nullptr), records_size_(0)
+{
+}
+
+SignaturePack SignaturePack::Open(const std::string &path)
+{
+    SignaturePack pack;
+    pack.file_ = MappedFile(path);
+    const char *data = pack.file_.data();
+    const std::size_t size = pack.file_.size();
+
+    PackFileHeader header;
+    if (size < sizeof(header))
+    {
+        throw std::runtime_error("Signature pack is truncated");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 ||
+        header.version != PACK_VERSION)
+    {
+        throw std::runtime_error("Not a signature pack or unsupported version");
+    }
+    const std::uint64_t entries_size = sizeof(Entry) * static_cast<std::uint64_t>(header.entry_count);
+    // In this order nothing wraps, whatever records_size holds
+    if (entries_size > size - sizeof(header) ||
+        header.records_size != size - sizeof(header) - entries_size)
+    {
+        throw std::runtime_error("Signature pack size does not match its header");
+    }
+    pack.entry_count_ = header.entry_count;
+    pack.entries_ = reinterpret_cast<const Entry *>(data + sizeof(header));
+    pack.records_ = data + sizeof(header) + entries_size;
+    pack.records_size_ = header.records_size;
+    return pack;
+}
+
+std::uint64_t SignaturePack::key(std::size_t i) const
+{
+    return entries_[i].key;
+}
+
+std::size_t SignaturePack::Find(std::uint64_t key) const
+{
+    const Entry *end = entries_ + entry_count_;
+    const Entry *found = std::lower_bound(
+        entries_, end, key, [](const Entry &entry, std::uint64_t k) { return entry.key < k; });
+    return found != end && found->key == key ? found - entries_ : entry_count_;
+}
+
+SignatureRecord SignaturePack::record(std::size_t i) const
+{
+    const Entry &entry = entries_[i];
+    if (entry.offset > records_size_ || entry.size > records_size_ - entry.offset)
+    {
+        throw std::runtime_error("Signature pack is corrupt");
+    }
+    return SignatureRecord(records_ + entry.offset, entry.size);
+}
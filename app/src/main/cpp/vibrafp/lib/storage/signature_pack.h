@@ -0,0 +1,182 @@
+#ifndef LIB_STORAGE_SIGNATURE_PACK_H_
+#define LIB_STORAGE_SIGNATURE_PACK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include "algorithm/frequency.h"
+#include "algorithm/signature.h"
+#include "utils/mapped_file.h"
+
+// Compact storage for many signatures, about 40% smaller than their URIs.
+// Each signature is a record holding its sample rate and count, a header
+// per band with its peak count and payload size, then the band payloads.
+// A payload Rice codes the pass delta and the zigzag magnitude and bin
+// deltas of each peak against the previous one, with parameters chosen per
+// band and field. Records are found by key through a sorted index block.
+//
+// Records keep every header field EncodeBinary() derives the URI from, so
+// a signature in its canonical encoding comes back as the exact same URI.
+
+class SignaturePack;
+
+// Collects signatures in memory, encoded as they are added, and writes
+// them as a SignaturePack file.
+class SignaturePackWriter
+{
+public:
+    // Replaces any signature added under `key`
+    void Add(std::uint64_t key, const Signature &signature);
+    // Adds a signature URI, throwing std::invalid_argument unless it is
+    // valid and re-encodes to the same bytes, which every URI this library
+    // produces does.
+    void AddUri(std::uint64_t key, const char *uri, std::size_t size);
+    // Copies every record of `pack` without decoding its peaks, replacing
+    // those with the same key. Throws std::runtime_error if a record header
+    // is corrupt.
+    void AddPack(const SignaturePack &pack);
+    bool Remove(std::uint64_t key);
+
+    inline std::size_t size() const
+    {
+        return records_.size();
+    }
+
+    // Writes to a temporary file renamed over `path`, so readers that map
+    // the previous version keep a consistent view. Throws std::runtime_error.
+    void Write(const std::string &path) const;
+
+private:
+    std::map<std::uint64_t, std::string> records_;
+};
+
+// Zero-copy view of one record of a mapped pack. The record headers are
+// checked on construction, the peaks as they are decoded.
+class SignatureRecord
+{
+public:
+    // Throws std::runtime_error if the record header is corrupt
+    SignatureRecord(const char *data, std::size_t size);
+
+    inline std::uint32_t sample_rate() const
+    {
+        return sample_rate_;
+    }
+    inline std::uint32_t num_samples() const
+    {
+        return num_samples_;
+    }
+    inline std::uint32_t peak_count() const
+    {
+        return peak_count_;
+    }
+    // Encoded size, for comparison with the URI
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+
+    // Calls `visit(band, peak)` for every peak, ordered by band and then as
+    // in the signature. Throws std::runtime_error if a payload is corrupt.
+    template <typename Visitor> void ForEachPeak(Visitor visit) const
+    {
+        for (std::uint32_t b = 0; b < band_count_; ++b)
+        {
+            BandDecoder decoder(bands_[b], sample_rate_);
+            for (std::uint32_t i = 0; i < bands_[b].peak_count; ++i)
+            {
+                visit(bands_[b].band, decoder.Next());
+            }
+        }
+    }
+
+    // Throws std::runtime_error if a payload is corrupt
+    Signature ToSignature() const;
+    // The URI of the signature, ToSignature().EncodeBase64()
+    std::string EncodeBase64() const;
+
+private:
+    struct Band
+    {
+        FrequencyBand band;
+        std::uint32_t peak_count;
+        const std::uint8_t *payload;
+        std::size_t payload_size;
+        std::uint8_t rice_bits[3]; // pass, magnitude, bin
+    };
+
+    // Reads the peaks of a band in order, without bounds on their number
+    class BandDecoder
+    {
+    public:
+        BandDecoder(const Band &band, std::uint32_t sample_rate);
+        // Throws std::runtime_error past the end of the payload
+        FrequencyPeak Next();
+
+    private:
+        void refill();
+        void consume(std::uint32_t count);
+        std::uint64_t readBits(std::uint32_t count);
+        std::uint64_t readRice(std::uint32_t bits);
+        std::uint64_t readLongRice(std::uint32_t bits); // codes not fully buffered
+
+        const Band &band_;
+        std::uint32_t sample_rate_;
+        std::size_t next_byte_;
+        std::uint64_t buffer_; // LSB first, the next bit is bit 0
+        std::uint32_t buffered_bits_;
+        std::uint32_t fft_pass_number_;
+        std::uint32_t peak_magnitude_;
+        std::uint32_t frequency_bin_;
+    };
+
+    std::size_t size_;
+    std::uint32_t sample_rate_;
+    std::uint32_t num_samples_;
+    std::uint32_t peak_count_;
+    std::uint32_t band_count_;
+    Band bands_[5];
+};
+
+// Read-only, memory-mapped pack written by SignaturePackWriter. Opening it
+// reads only the header, records are decoded on access.
+class SignaturePack
+{
+public:
+    SignaturePack(SignaturePack &&) = default;
+    SignaturePack(const SignaturePack &) = delete;
+    // Throws std::runtime_error if the file is missing or corrupt.
+    static SignaturePack Open(const std::string &path);
+
+    inline std::size_t size() const
+    {
+        return entry_count_;
+    }
+    std::uint64_t key(std::size_t i) const;
+    // Index of the record with `key`, or size() if there is none
+    std::size_t Find(std::uint64_t key) const;
+    // Throws std::runtime_error if the record header is corrupt
+    SignatureRecord record(std::size_t i) const;
+
+private:
+    friend class SignaturePackWriter;
+
+    struct Entry
+    {
+        std::uint64_t key;
+        std::uint32_t offset; // from the start of the data block
+        std::uint32_t size;
+    };
+
+    SignaturePack();
+
+private:
+    MappedFile file_;
+    std::size_t entry_count_;
+    const Entry *entries_; // ascending keys
+    const char *records_;
+    std::size_t records_size_;
+};
+
+#endif // LIB_STORAGE_SIGNATURE_PACK_H_
@@ -0,0 +1,380 @@
+#include "utils/base64.h"
+#include <cstdint>
+#include "utils/cpu_features.h"
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <tmmintrin.h>
+#endif
+
+namespace
+{
+const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                            "abcdefghijklmnopqrstuvwxyz"
+                            "0123456789+/";
+
+constexpr std::uint8_t INVALID = 0xff;
+
+// Value of each ASCII character, INVALID for anything outside the alphabet
+const std::uint8_t DECODE_TABLE[128] = {
+    INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, INVALID, INVALID, 62,      INVALID, INVALID, INVALID, 63,
+    52,      53,      54,      55,      56,      57,      58,      59,
+    60,      61,      INVALID, INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, 0,       1,       2,       3,       4,       5,       6,
+    7,       8,       9,       10,      11,      12,      13,      14,
+    15,      16,      17,      18,      19,      20,      21,      22,
+    23,      24,      25,      INVALID, INVALID, INVALID, INVALID, INVALID,
+    INVALID, 26,      27,      28,      29,      30,      31,      32,
+    33,      34,      35,      36,      37,      38,      39,      40,
+    41,      42,      43,      44,      45,      46,      47,      48,
+    49,      50,      51,      INVALID, INVALID, INVALID, INVALID, INVALID,
+};
+
+inline std::uint8_t decodeChar(std::uint8_t c)
+{
+    return c < 128 ? DECODE_TABLE[c] : INVALID;
+}
+
+// The block functions convert whole groups of three bytes / four characters
+// and return how many input bytes they consumed. Vector versions stop early
+// and leave the remainder to the scalar ones, which also report bad input.
+using EncodeBlocksFunc = std::size_t (*)(const std::uint8_t *in, std::size_t len, char *out);
+using DecodeBlocksFunc = std::size_t (*)(const std::uint8_t *in, std::size_t len,
+                                         std::uint8_t *out);
+
+std::size_t encodeBlocksScalar(const std::uint8_t *in, std::size_t len, char *out)
+{
+    std::size_t i = 0;
+    for (; i + 3 <= len; i += 3)
+    {
+        const std::uint32_t triple = (in[i] << 16) | (in[i + 1] << 8) | in[i + 2];
+        *out++ = BASE64_CHARS[(triple >> 18) & 0x3f];
+        *out++ = BASE64_CHARS[(triple >> 12) & 0x3f];
+        *out++ = BASE64_CHARS[(triple >> 6) & 0x3f];
+        *out++ = BASE64_CHARS[triple & 0x3f];
+    }
+    return i;
+}
+
+std::size_t decodeBlocksScalar(const std::uint8_t *in, std::size_t len, std::uint8_t *out)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= len; i += 4)
+    {
+        const std::uint8_t a = decodeChar(in[i]);
+        const std::uint8_t b = decodeChar(in[i + 1]);
+        const std::uint8_t c = decodeChar(in[i + 2]);
+        const std::uint8_t d = decodeChar(in[i + 3]);
+        if ((a | b | c | d) == INVALID)
+        {
+            break;
+        }
+        const std::uint32_t triple = (a << 18) | (b << 12) | (c << 6) | d;
+        *out++ = static_cast<std::uint8_t>(triple >> 16);
+        *out++ = static_cast<std::uint8_t>(triple >> 8);
+        *out++ = static_cast<std::uint8_t>(triple);
+    }
+    return i;
+}
+
+#if defined(__aarch64__)
+// 48 bytes -> 64 characters per iteration. vld3 splits the input into the
+// first, second and third byte of every group, so the 6 bit indices are
+// plain shifts, and a 64 entry table lookup maps them to the alphabet.
+std::size_t encodeBlocksNeon(const std::uint8_t *in, std::size_t len, char *out)
+{
+    const auto *alphabet = reinterpret_cast<const std::uint8_t *>(BASE64_CHARS);
+    uint8x16x4_t table;
+    table.val[0] = vld1q_u8(alphabet);
+    table.val[1] = vld1q_u8(alphabet + 16);
+    table.val[2] = vld1q_u8(alphabet + 32);
+    table.val[3] = vld1q_u8(alphabet + 48);
+    const uint8x16_t low_6_bits = vdupq_n_u8(0x3f);
+
+    std::size_t i = 0;
+    for (; i + 48 <= len; i += 48, out += 64)
+    {
+        const uint8x16x3_t bytes = vld3q_u8(in + i);
+        uint8x16x4_t indices;
+        indices.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        indices.val[1] = vandq_u8(vsliq_n_u8(vshrq_n_u8(bytes.val[1], 4), bytes.val[0], 4),
+                                  low_6_bits);
+        indices.val[2] = vandq_u8(vsliq_n_u8(vshrq_n_u8(bytes.val[2], 6), bytes.val[1], 2),
+                                  low_6_bits);
+        indices.val[3] = vandq_u8(bytes.val[2], low_6_bits);
+
+        uint8x16x4_t chars;
+        chars.val[0] = vqtbl4q_u8(table, indices.val[0]);
+        chars.val[1] = vqtbl4q_u8(table, indices.val[1]);
+        chars.val[2] = vqtbl4q_u8(table, indices.val[2]);
+        chars.val[3] = vqtbl4q_u8(table, indices.val[3]);
+        vst4q_u8(reinterpret_cast<std::uint8_t *>(out), chars);
+    }
+    return i;
+}
+
+// 64 characters -> 48 bytes per iteration. The two 64 entry lookups cover
+// ASCII, anything at or above 0x80 is flagged separately.
+std::size_t decodeBlocksNeon(const std::uint8_t *in, std::size_t len, std::uint8_t *out)
+{
+    uint8x16x4_t table_low, table_high;
+    for (int k = 0; k < 4; ++k)
+    {
+        table_low.val[k] = vld1q_u8(DECODE_TABLE + 16 * k);
+        table_high.val[k] = vld1q_u8(DECODE_TABLE + 64 + 16 * k);
+    }
+    const uint8x16_t offset = vdupq_n_u8(64);
+    const uint8x16_t non_ascii = vdupq_n_u8(0x80);
+
+    std::size_t i = 0;
+    for (; i + 64 <= len; i += 64, out += 48)
+    {
+        const uint8x16x4_t chars = vld4q_u8(in + i);
+        uint8x16x4_t values;
+        uint8x16_t error = vdupq_n_u8(0);
+        for (int k = 0; k < 4; ++k)
+        {
+            const uint8x16_t c = chars.val[k];
+            uint8x16_t value = vqtbl4q_u8(table_low, c);
+            value = vqtbx4q_u8(value, table_high, vsubq_u8(c, offset));
+            error = vorrq_u8(error, vorrq_u8(value, vandq_u8(c, non_ascii)));
+            values.val[k] = value;
+        }
+        // valid values are below 64, INVALID and 0x80 both set bit 7
+        if (vmaxvq_u8(error) >= 0x80)
+        {
+            break;
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(values.val[0], 2), vshrq_n_u8(values.val[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(values.val[1], 4), vshrq_n_u8(values.val[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(values.val[2], 6), values.val[3]);
+        vst3q_u8(out, bytes);
+    }
+    return i;
+}
+#elif defined(__x86_64__) || defined(__i386__)
+// Byte shuffle and multiply-shift approach from Wojciech Muła's "Base64
+// encoding with SIMD instructions": 12 bytes -> 16 characters per iteration.
+// The load reads 16 bytes, so the loop stops while 4 spare ones remain.
+__attribute__((target("ssse3"))) std::size_t encodeBlocksSsse3(const std::uint8_t *in,
+                                                               std::size_t len, char *out)
+{
+    const __m128i split = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+    const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                            '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    std::size_t i = 0;
+    for (; i + 16 <= len; i += 12, out += 16)
+    {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        input = _mm_shuffle_epi8(input, split);
+
+        // every 32 bit lane now holds b1 b0 b2 b1, pull out the four indices
+        const __m128i t0 = _mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(input, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t1, t3);
+
+        // map each index range onto the offset from index to character
+        __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        range = _mm_or_si128(range, _mm_and_si128(upper, _mm_set1_epi8(13)));
+        const __m128i chars = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, range), indices);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), chars);
+    }
+    return i;
+}
+
+// 16 characters -> 12 bytes per iteration, validating with nibble lookups.
+// The store writes 16 bytes, so the loop keeps 8 characters (at least 4
+// decoded bytes) in hand.
+__attribute__((target("ssse3"))) std::size_t decodeBlocksSsse3(const std::uint8_t *in,
+                                                               std::size_t len, std::uint8_t *out)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+                                         0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10,
+                                         0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll =
+        _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+    const __m128i slash = _mm_set1_epi8('/');
+    const __m128i zero = _mm_setzero_si128();
+
+    std::size_t i = 0;
+    for (; i + 24 <= len; i += 16, out += 12)
+    {
+        const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), low_nibble);
+        const __m128i lo_nibbles = _mm_and_si128(chars, low_nibble);
+        const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), zero)) != 0xffff)
+        {
+            break;
+        }
+
+        const __m128i is_slash = _mm_cmpeq_epi8(chars, slash);
+        const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(is_slash, hi_nibbles));
+        const __m128i values = _mm_add_epi8(chars, roll);
+
+        // merge 4 x 6 bits into 24 bits per lane, then compact the lanes
+        const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        const __m128i triples = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_shuffle_epi8(triples, pack));
+    }
+    return i;
+}
+#endif
+
+struct Codec
+{
+    EncodeBlocksFunc encode_blocks;
+    DecodeBlocksFunc decode_blocks;
+};
+
+const Codec SCALAR_CODEC = {&encodeBlocksScalar, &decodeBlocksScalar};
+
+Codec selectCodec(const cpu::Features &features)
+{
+#if defined(__aarch64__)
+    if (features.neon)
+    {
+        return Codec{&encodeBlocksNeon, &decodeBlocksNeon};
+    }
+#elif defined(__x86_64__) || defined(__i386__)
+    if (features.ssse3)
+    {
+        return Codec{&encodeBlocksSsse3, &decodeBlocksSsse3};
+    }
+#endif
+    (void)features;
+    return SCALAR_CODEC;
+}
+
+const Codec &codec()
+{
+    static const Codec selected = selectCodec(cpu::Detected());
+    return cpu::IsScalarForced() ? SCALAR_CODEC : selected;
+}
+
+void encodeWith(EncodeBlocksFunc encode_blocks, const char *bytes_to_encode, std::size_t in_len,
+                char *out)
+{
+    const auto *in = reinterpret_cast<const std::uint8_t *>(bytes_to_encode);
+    std::size_t done = encode_blocks(in, in_len, out);
+    done += encodeBlocksScalar(in + done, in_len - done, out + done / 3 * 4);
+    out += done / 3 * 4;
+    in += done;
+    in_len -= done;
+
+    if (in_len != 0)
+    {
+        const std::uint32_t triple = (in[0] << 16) | (in_len == 2 ? in[1] << 8 : 0);
+        *out++ = BASE64_CHARS[(triple >> 18) & 0x3f];
+        *out++ = BASE64_CHARS[(triple >> 12) & 0x3f];
+        *out++ = in_len == 2 ? BASE64_CHARS[(triple >> 6) & 0x3f] : '=';
+        *out++ = '=';
+    }
+}
+
+bool decodeWith(DecodeBlocksFunc decode_blocks, const char *encoded, std::size_t in_len,
+                char *decoded, std::size_t *out_len)
+{
+    if (in_len % 4 != 0)
+    {
+        return false;
+    }
+    const auto *in = reinterpret_cast<const std::uint8_t *>(encoded);
+    auto *out = reinterpret_cast<std::uint8_t *>(decoded);
+
+    // the last group is the only one allowed to carry padding
+    std::size_t padding = 0;
+    if (in_len != 0 && in[in_len - 1] == '=')
+    {
+        padding = in[in_len - 2] == '=' ? 2 : 1;
+    }
+    const std::size_t body = padding != 0 ? in_len - 4 : in_len;
+
+    std::size_t done = decode_blocks(in, body, out);
+    done += decodeBlocksScalar(in + done, body - done, out + done / 4 * 3);
+    if (done != body)
+    {
+        return false;
+    }
+    out += done / 4 * 3;
+
+    if (padding != 0)
+    {
+        const std::uint8_t a = decodeChar(in[body]);
+        const std::uint8_t b = decodeChar(in[body + 1]);
+        const std::uint8_t c = padding == 1 ? decodeChar(in[body + 2]) : 0;
+        if ((a | b | c) == INVALID)
+        {
+            return false;
+        }
+        const std::uint32_t triple = (a << 18) | (b << 12) | (c << 6);
+        *out++ = static_cast<std::uint8_t>(triple >> 16);
+        if (padding == 1)
+        {
+            *out++ = static_cast<std::uint8_t>(triple >> 8);
+        }
+    }
+    *out_len = out - reinterpret_cast<std::uint8_t *>(decoded);
+    return true;
+}
+} // namespace
+
+namespace base64
+{
+void encode(const char *bytes_to_encode, std::size_t in_len, char *out)
+{
+    encodeWith(codec().encode_blocks, bytes_to_encode, in_len, out);
+}
+
+std::string encode(const char *bytes_to_encode, std::size_t in_len)
+{
+    std::string ret(encoded_size(in_len), '\0');
+    encode(bytes_to_encode, in_len, &ret[0]);
+    return ret;
+}
+
+bool decode(const char *encoded, std::size_t in_len, char *out, std::size_t *out_len)
+{
+    return decodeWith(codec().decode_blocks, encoded, in_len, out, out_len);
+}
+
+bool decode(const char *encoded, std::size_t in_len, std::string *out)
+{
+    out->resize(decoded_max_size(in_len));
+    std::size_t size = 0;
+    if (!decode(encoded, in_len, &(*out)[0], &size))
+    {
+        out->clear();
+        return false;
+    }
+    out->resize(size);
+    return true;
+}
+
+void encode_scalar(const char *bytes_to_encode, std::size_t in_len, char *out)
+{
+    encodeWith(&encodeBlocksScalar, bytes_to_encode, in_len, out);
+}
+
+bool decode_scalar(const char *encoded, std::size_t in_len, char *out, std::size_t *out_len)
+{
+    return decodeWith(&decodeBlocksScalar, encoded, in_len, out, out_len);
+}
+} // namespace base64
@@ -1,55 +1,34 @@
 #ifndef LIB_UTILS_BASE64_H_
 #define LIB_UTILS_BASE64_H_
 
+#include <cstddef>
 #include <string>
 
 namespace base64
 {
-static const char base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                   "abcdefghijklmnopqrstuvwxyz"
-                                   "0123456789+/";
-std::string encode(const char *bytes_to_encode, unsigned int in_len)
+inline std::size_t encoded_size(std::size_t in_len)
 {
-    std::string ret;
-    int i = 0;
-    int j = 0;
-    unsigned char char_array_3[3];
-    unsigned char char_array_4[4];
-
-    while (in_len--)
-    {
-        char_array_3[i++] = *(bytes_to_encode++);
-        if (i == 3)
-        {
-            char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-            char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-            char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
-            char_array_4[3] = char_array_3[2] & 0x3f;
-
-            for (i = 0; (i < 4); i++)
-                ret += base64_chars[char_array_4[i]];
-            i = 0;
-        }
-    }
-
-    if (i)
-    {
-        for (j = i; j < 3; j++)
-            char_array_3[j] = '\0';
+    return (in_len + 2) / 3 * 4;
+}
 
-        char_array_4[0] = (char_array_3[0] & 0xfc) >> 2;
-        char_array_4[1] = ((char_array_3[0] & 0x03) << 4) + ((char_array_3[1] & 0xf0) >> 4);
-        char_array_4[2] = ((char_array_3[1] & 0x0f) << 2) + ((char_array_3[2] & 0xc0) >> 6);
+// Upper bound, padding makes the actual size up to two bytes smaller
+inline std::size_t decoded_max_size(std::size_t in_len)
+{
+    return in_len / 4 * 3;
+}
 
-        for (j = 0; (j < i + 1); j++)
-            ret += base64_chars[char_array_4[j]];
+// Writes exactly encoded_size(in_len) characters to `out`, padded with '='.
+void encode(const char *bytes_to_encode, std::size_t in_len, char *out);
+std::string encode(const char *bytes_to_encode, std::size_t in_len);
 
-        while ((i++ < 3))
-            ret += '=';
-    }
+// Decodes padded standard base64 into `out`, which must hold
+// decoded_max_size(in_len) bytes. Returns false if the input is malformed.
+bool decode(const char *encoded, std::size_t in_len, char *out, std::size_t *out_len);
+bool decode(const char *encoded, std::size_t in_len, std::string *out);
 
-    return ret;
-}
+// Portable implementations, exposed for verification and benchmarks
+void encode_scalar(const char *bytes_to_encode, std::size_t in_len, char *out);
+bool decode_scalar(const char *encoded, std::size_t in_len, char *out, std::size_t *out_len);
 } // namespace base64
 
 #endif // LIB_UTILS_BASE64_H_
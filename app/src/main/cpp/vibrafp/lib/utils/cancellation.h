@@ -0,0 +1,89 @@
+#ifndef LIB_UTILS_CANCELLATION_H_
+#define LIB_UTILS_CANCELLATION_H_
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+class OperationCancelled : public std::runtime_error
+{
+public:
+    enum class Reason
+    {
+        CANCELLED,
+        DEADLINE_EXCEEDED,
+    };
+
+    explicit OperationCancelled(Reason reason)
+        : std::runtime_error(reason == Reason::CANCELLED ? "Operation cancelled"
+                                                         : "Operation deadline exceeded"),
+          reason_(reason)
+    {
+    }
+
+    inline Reason reason() const
+    {
+        return reason_;
+    }
+
+private:
+    Reason reason_;
+};
+
+// Shared between the thread doing the work, which polls it at cheap points,
+// and any thread that wants the work to stop. Both Cancel() and
+// set_deadline() may be called while the work is running.
+class CancellationToken
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    CancellationToken() : cancelled_(false), deadline_ticks_(NO_DEADLINE)
+    {
+    }
+    CancellationToken(const CancellationToken &) = delete;
+    CancellationToken &operator=(const CancellationToken &) = delete;
+
+    inline void Cancel()
+    {
+        cancelled_.store(true, std::memory_order_relaxed);
+    }
+
+    inline bool IsCancelled() const
+    {
+        return cancelled_.load(std::memory_order_relaxed);
+    }
+
+    inline void set_deadline(Clock::time_point deadline)
+    {
+        deadline_ticks_.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    }
+
+    inline bool IsPastDeadline() const
+    {
+        const auto deadline = deadline_ticks_.load(std::memory_order_relaxed);
+        return deadline != NO_DEADLINE && Clock::now().time_since_epoch().count() >= deadline;
+    }
+
+    // Throws OperationCancelled if the work should stop.
+    inline void ThrowIfCancelled() const
+    {
+        if (IsCancelled())
+        {
+            throw OperationCancelled(OperationCancelled::Reason::CANCELLED);
+        }
+        if (IsPastDeadline())
+        {
+            throw OperationCancelled(OperationCancelled::Reason::DEADLINE_EXCEEDED);
+        }
+    }
+
+private:
+    static constexpr Clock::rep NO_DEADLINE = std::numeric_limits<Clock::rep>::max();
+
+    std::atomic<bool> cancelled_;
+    std::atomic<Clock::rep> deadline_ticks_;
+};
+
+#endif // LIB_UTILS_CANCELLATION_H_
@@ -0,0 +1,133 @@
+#include "utils/cpu_features.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if (defined(__aarch64__) || defined(__arm__)) && defined(__linux__)
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+// Older kernel headers lack the ARMv8.2 bits
+#if defined(__aarch64__) && defined(__linux__)
+#ifndef HWCAP_ASIMDHP
+#define HWCAP_ASIMDHP (1 << 10)
+#endif
+#ifndef HWCAP_ASIMDDP
+#define HWCAP_ASIMDDP (1 << 20)
+#endif
+#endif
+
+namespace
+{
+cpu::Features detect()
+{
+    cpu::Features features;
+    std::memset(&features, 0, sizeof(features));
+#if defined(__aarch64__)
+    features.neon = true;
+#if defined(__ARM_FEATURE_CRC32)
+    features.crc32 = true;
+#endif
+#if defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    features.crc32 = features.crc32 || (hwcap & HWCAP_CRC32) != 0;
+    features.pmull = (hwcap & HWCAP_PMULL) != 0;
+    features.dotprod = (hwcap & HWCAP_ASIMDDP) != 0;
+    features.fp16 = (hwcap & HWCAP_ASIMDHP) != 0;
+#endif
+#elif defined(__arm__) && defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+    const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+    features.neon = (hwcap & HWCAP_NEON) != 0;
+    features.crc32 = (hwcap2 & HWCAP2_CRC32) != 0;
+    features.pmull = (hwcap2 & HWCAP2_PMULL) != 0;
+#elif defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        features.sse2 = (edx & bit_SSE2) != 0;
+        features.ssse3 = (ecx & bit_SSSE3) != 0;
+        features.sse41 = (ecx & bit_SSE4_1) != 0;
+        features.pclmul = (ecx & bit_PCLMUL) != 0;
+
+        // AVX2 also needs the OS to save the YMM registers on context switches
+        bool os_saves_ymm = false;
+        if ((ecx & bit_OSXSAVE) != 0 && (ecx & bit_AVX) != 0)
+        {
+            unsigned int xcr0_low, xcr0_high;
+            __asm__("xgetbv" : "=a"(xcr0_low), "=d"(xcr0_high) : "c"(0));
+            os_saves_ymm = (xcr0_low & 0x6) == 0x6;
+        }
+        if (os_saves_ymm && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        {
+            features.avx2 = (ebx & bit_AVX2) != 0;
+        }
+    }
+#endif
+    return features;
+}
+
+bool scalarForcedByEnvironment()
+{
+    const char *value = std::getenv("VIBRA_FORCE_SCALAR");
+    return value != nullptr && value[0] != '\0' && std::strcmp(value, "0") != 0;
+}
+
+std::atomic<bool> &scalarForced()
+{
+    static std::atomic<bool> forced(scalarForcedByEnvironment());
+    return forced;
+}
+} // namespace
+
+namespace cpu
+{
+const Features &Detected()
+{
+    static const Features features = detect();
+    return features;
+}
+
+const Features &Enabled()
+{
+    static const Features none = Features();
+    return IsScalarForced() ? none : Detected();
+}
+
+void SetScalarForced(bool forced)
+{
+    scalarForced().store(forced, std::memory_order_relaxed);
+}
+
+bool IsScalarForced()
+{
+    return scalarForced().load(std::memory_order_relaxed);
+}
+
+std::string Describe(const Features &features)
+{
+    const struct
+    {
+        bool set;
+        const char *name;
+    } names[] = {
+        {features.neon, "neon"},   {features.crc32, "crc32"},   {features.pmull, "pmull"},
+        {features.dotprod, "dotprod"}, {features.fp16, "fp16"}, {features.sse2, "sse2"},
+        {features.ssse3, "ssse3"}, {features.sse41, "sse4.1"}, {features.pclmul, "pclmul"},
+        {features.avx2, "avx2"},
+    };
+    std::string description;
+    for (const auto &name : names)
+    {
+        if (name.set)
+        {
+            description += description.empty() ? "" : " ";
+            description += name.name;
+        }
+    }
+    return description;
+}
+} // namespace cpu
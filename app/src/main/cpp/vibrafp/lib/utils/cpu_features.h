@@ -0,0 +1,47 @@
+#ifndef LIB_UTILS_CPU_FEATURES_H_
+#define LIB_UTILS_CPU_FEATURES_H_
+
+#include <string>
+
+// Instruction set extensions of the CPU the library runs on, detected once
+// through getauxval() on ARM and cpuid on x86. The DSP kernels are picked
+// from them at run time, so one build per ABI runs the best kernels each
+// device supports.
+namespace cpu
+{
+struct Features
+{
+    // ARM
+    bool neon;    // Advanced SIMD, always there on AArch64
+    bool crc32;   // ARMv8 CRC32 instructions
+    bool pmull;   // 64-bit polynomial multiply
+    bool dotprod; // ARMv8.2 SDOT/UDOT
+    bool fp16;    // ARMv8.2 half-precision arithmetic
+    // x86
+    bool sse2;
+    bool ssse3;
+    bool sse41;
+    bool pclmul;
+    bool avx2; // only if the OS also saves the AVX registers
+};
+
+// Detected on the first call
+const Features &Detected();
+
+// What the kernels may use: Detected(), or nothing while the scalar
+// kernels are forced.
+const Features &Enabled();
+
+// Forces the portable kernels everywhere, to check them against the
+// vectorized ones on the same device. Starts out set if the
+// VIBRA_FORCE_SCALAR environment variable is set to anything but 0.
+// Kernels are looked up when a pipeline object is created, so the setting
+// applies to those created afterwards.
+void SetScalarForced(bool forced);
+bool IsScalarForced();
+
+// Space separated names of the features set, e.g. "neon crc32 pmull"
+std::string Describe(const Features &features);
+} // namespace cpu
+
+#endif // LIB_UTILS_CPU_FEATURES_H_
@@ -0,0 +1,241 @@
+#include "utils/crc32.h"
+#include <cstring>
+#include "utils/cpu_features.h"
+
+#if defined(__aarch64__)
+#include <arm_acle.h>
+#elif defined(__x86_64__)
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+namespace
+{
+constexpr std::uint32_t POLYNOMIAL = 0xEDB88320u;
+constexpr std::size_t SLICES = 8;
+
+// C++11 constexpr functions are single expressions, so the table is built
+// through recursion and an index sequence rather than loops.
+constexpr std::uint32_t reflectedStep(std::uint32_t crc, int bits)
+{
+    return bits == 0 ? crc : reflectedStep(crc & 1 ? (crc >> 1) ^ POLYNOMIAL : crc >> 1, bits - 1);
+}
+
+constexpr std::uint32_t advanceZeroBytes(std::uint32_t crc, std::size_t count)
+{
+    return count == 0 ? crc : advanceZeroBytes((crc >> 8) ^ reflectedStep(crc & 0xff, 8), count - 1);
+}
+
+// Entry b of slice k is the CRC of byte b followed by k zero bytes
+constexpr std::uint32_t tableEntry(std::size_t index)
+{
+    return advanceZeroBytes(reflectedStep(static_cast<std::uint32_t>(index & 0xff), 8), index >> 8);
+}
+
+template <std::size_t... I> struct IndexSequence
+{
+};
+
+template <typename A, typename B> struct ConcatSequence;
+
+template <std::size_t... A, std::size_t... B>
+struct ConcatSequence<IndexSequence<A...>, IndexSequence<B...>>
+{
+    using type = IndexSequence<A..., (sizeof...(A) + B)...>;
+};
+
+// Halving keeps the template depth logarithmic in N
+template <std::size_t N> struct MakeIndexSequence
+{
+    using type = typename ConcatSequence<typename MakeIndexSequence<N / 2>::type,
+                                         typename MakeIndexSequence<N - N / 2>::type>::type;
+};
+
+template <> struct MakeIndexSequence<0>
+{
+    using type = IndexSequence<>;
+};
+
+template <> struct MakeIndexSequence<1>
+{
+    using type = IndexSequence<0>;
+};
+
+struct CrcTable
+{
+    std::uint32_t entries[SLICES * 256];
+};
+
+template <std::size_t... I> constexpr CrcTable makeTable(IndexSequence<I...>)
+{
+    return CrcTable{{tableEntry(I)...}};
+}
+
+constexpr CrcTable CRC_TABLE = makeTable(MakeIndexSequence<SLICES * 256>::type());
+
+static_assert(CRC_TABLE.entries[1] == 0x77073096u, "CRC table does not match zlib");
+
+inline std::uint32_t slice(std::size_t index, std::uint32_t byte)
+{
+    return CRC_TABLE.entries[index * 256 + byte];
+}
+
+// `crc` is the pre-inverted running value in all the update functions
+std::uint32_t updateSoftware(std::uint32_t crc, const std::uint8_t *p, std::size_t len)
+{
+    for (; len >= SLICES; len -= SLICES, p += SLICES)
+    {
+        const std::uint32_t low = crc ^ (p[0] | (p[1] << 8) | (p[2] << 16) |
+                                         (static_cast<std::uint32_t>(p[3]) << 24));
+        crc = slice(7, low & 0xff) ^ slice(6, (low >> 8) & 0xff) ^ slice(5, (low >> 16) & 0xff) ^
+              slice(4, low >> 24) ^ slice(3, p[4]) ^ slice(2, p[5]) ^ slice(1, p[6]) ^
+              slice(0, p[7]);
+    }
+    while (len--)
+    {
+        crc = slice(0, (crc ^ *p++) & 0xff) ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if defined(__aarch64__)
+#if defined(__clang__)
+#define CRC_TARGET __attribute__((target("crc")))
+#else
+#define CRC_TARGET __attribute__((target("+crc")))
+#endif
+
+CRC_TARGET std::uint32_t updateArmv8(std::uint32_t crc, const std::uint8_t *p, std::size_t len)
+{
+    for (; len >= 8; len -= 8, p += 8)
+    {
+        std::uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        crc = __crc32d(crc, value);
+    }
+    while (len--)
+    {
+        crc = __crc32b(crc, *p++);
+    }
+    return crc;
+}
+
+#undef CRC_TARGET
+#elif defined(__x86_64__)
+// Folding with carry-less multiplication, after Intel's "Fast CRC Computation
+// for Generic Polynomials Using PCLMULQDQ Instruction". Needs len >= 64 and a
+// multiple of 16.
+__attribute__((target("pclmul,sse2"))) std::uint32_t
+updatePclmul(std::uint32_t crc, const std::uint8_t *p, std::size_t len)
+{
+    // x^(4*128+32) mod P, x^(4*128-32) mod P
+    const __m128i fold_by_4 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    // x^(128+32) mod P, x^(128-32) mod P
+    const __m128i fold_by_1 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    // x^64 mod P
+    const __m128i fold_64 = _mm_set_epi64x(0, 0x0163cd6124);
+    // P(x) and the Barrett constant floor(x^64 / P(x)), bit reflected
+    const __m128i barrett = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i low_32_mask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 32));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    p += 64;
+    len -= 64;
+
+    for (; len >= 64; len -= 64, p += 64)
+    {
+        const __m128i x5 = _mm_clmulepi64_si128(x1, fold_by_4, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, fold_by_4, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, fold_by_4, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, fold_by_4, 0x00);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, fold_by_4, 0x11), x5);
+        x2 = _mm_xor_si128(_mm_clmulepi64_si128(x2, fold_by_4, 0x11), x6);
+        x3 = _mm_xor_si128(_mm_clmulepi64_si128(x3, fold_by_4, 0x11), x7);
+        x4 = _mm_xor_si128(_mm_clmulepi64_si128(x4, fold_by_4, 0x11), x8);
+        x1 = _mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+        x2 = _mm_xor_si128(x2, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 16)));
+        x3 = _mm_xor_si128(x3, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 32)));
+        x4 = _mm_xor_si128(x4, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 48)));
+    }
+
+    // fold the four lanes into one, then any remaining 16 byte blocks
+    const __m128i lanes[3] = {x2, x3, x4};
+    for (const auto &lane : lanes)
+    {
+        const __m128i low = _mm_clmulepi64_si128(x1, fold_by_1, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, fold_by_1, 0x11), lane), low);
+    }
+    for (; len >= 16; len -= 16, p += 16)
+    {
+        const __m128i low = _mm_clmulepi64_si128(x1, fold_by_1, 0x00);
+        x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, fold_by_1, 0x11), low);
+        x1 = _mm_xor_si128(x1, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)));
+    }
+
+    // 128 -> 64 bits
+    __m128i x2r = _mm_clmulepi64_si128(x1, fold_by_1, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2r);
+    x2r = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, low_32_mask);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, fold_64, 0x00), x2r);
+
+    // Barrett reduction to 32 bits
+    x2r = _mm_and_si128(x1, low_32_mask);
+    x2r = _mm_clmulepi64_si128(x2r, barrett, 0x10);
+    x2r = _mm_and_si128(x2r, low_32_mask);
+    x2r = _mm_clmulepi64_si128(x2r, barrett, 0x00);
+    x1 = _mm_xor_si128(x1, x2r);
+    return static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+
+std::uint32_t updateX86(std::uint32_t crc, const std::uint8_t *p, std::size_t len)
+{
+    if (len >= 64)
+    {
+        const std::size_t folded = len & ~static_cast<std::size_t>(15);
+        crc = updatePclmul(crc, p, folded);
+        p += folded;
+        len -= folded;
+    }
+    return updateSoftware(crc, p, len);
+}
+#endif
+
+using UpdateFunc = std::uint32_t (*)(std::uint32_t crc, const std::uint8_t *p, std::size_t len);
+
+UpdateFunc selectUpdateFunc(const cpu::Features &features)
+{
+#if defined(__aarch64__)
+    if (features.crc32)
+    {
+        return &updateArmv8;
+    }
+#elif defined(__x86_64__)
+    if (features.pclmul)
+    {
+        return &updateX86;
+    }
+#endif
+    (void)features;
+    return &updateSoftware;
+}
+} // namespace
+
+namespace crc32
+{
+std::uint32_t crc32(const char *buf, std::size_t len)
+{
+    static const UpdateFunc selected = selectUpdateFunc(cpu::Detected());
+    const UpdateFunc update = cpu::IsScalarForced() ? &updateSoftware : selected;
+    return ~update(0xFFFFFFFFu, reinterpret_cast<const std::uint8_t *>(buf), len);
+}
+
+std::uint32_t crc32_software(const char *buf, std::size_t len)
+{
+    return ~updateSoftware(0xFFFFFFFFu, reinterpret_cast<const std::uint8_t *>(buf), len);
+}
+} // namespace crc32
@@ -1,28 +1,18 @@
 #ifndef LIB_UTILS_CRC32_H_
 #define LIB_UTILS_CRC32_H_
 
+#include <cstddef>
+#include <cstdint>
+
 namespace crc32
 {
-std::uint32_t crc32(const char *buf, std::size_t len)
-{
-    std::uint32_t crc_table[256];
-    std::uint32_t crc;
-    std::size_t i, j;
-
-    for (i = 0; i < 256; i++)
-    {
-        crc = i;
-        for (j = 0; j < 8; j++)
-            crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320UL : crc >> 1;
-        crc_table[i] = crc;
-    };
-    crc = 0xFFFFFFFFUL;
-
-    while (len--)
-        crc = crc_table[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+// CRC-32 (IEEE 802.3, reflected 0xEDB88320) of `len` bytes. Uses the CPU's
+// CRC or carry-less multiply instructions when available, slice-by-8 tables
+// otherwise.
+std::uint32_t crc32(const char *buf, std::size_t len);
 
-    return crc ^ 0xFFFFFFFFUL;
-}
+// Portable slice-by-8 implementation, exposed for verification and benchmarks
+std::uint32_t crc32_software(const char *buf, std::size_t len);
 } // namespace crc32
 
 #endif // LIB_UTILS_CRC32_H_
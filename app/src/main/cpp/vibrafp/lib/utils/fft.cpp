@@ -0,0 +1,35 @@
+#include "utils/fft.h"
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+
+namespace fft
+{
+fftw_plan RealPlan(int size)
+{
+    static std::mutex mutex;
+    // Never destroyed, threads still running at exit may use the plans
+    static auto *plans = new std::map<int, fftw_plan>();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto found = plans->find(size);
+    if (found != plans->end())
+    {
+        return found->second;
+    }
+
+    // The arrays of fftw_alloc_*() all have the alignment the plan is made
+    // for, so these are only needed while planning
+    std::unique_ptr<double, decltype(&fftw_free)> input(fftw_alloc_real(size), fftw_free);
+    std::unique_ptr<fftw_complex, decltype(&fftw_free)> output(fftw_alloc_complex(size / 2 + 1),
+                                                               fftw_free);
+    fftw_plan plan = fftw_plan_dft_r2c_1d(size, input.get(), output.get(), FFTW_ESTIMATE);
+    if (plan == nullptr)
+    {
+        throw std::runtime_error("Cannot plan an FFT of size " + std::to_string(size));
+    }
+    plans->emplace(size, plan);
+    return plan;
+}
+} // namespace fft
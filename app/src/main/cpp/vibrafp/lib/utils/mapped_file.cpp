@@ -0,0 +1,79 @@
+#include "utils/mapped_file.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+MappedFile::MappedFile() : data_(nullptr), size_(0)
+{
+}
+
+MappedFile::MappedFile(const std::string &path) : data_(nullptr), size_(0)
+{
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        throw std::runtime_error("Failed to open " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw std::runtime_error("Failed to stat " + path + ": " + std::strerror(error));
+    }
+
+    // mmap rejects empty mappings, an empty file is simply an empty view
+    if (st.st_size > 0)
+    {
+        void *mapping = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::runtime_error("Failed to map " + path + ": " + std::strerror(error));
+        }
+        data_ = static_cast<const char *>(mapping);
+        size_ = static_cast<std::size_t>(st.st_size);
+    }
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+}
+
+MappedFile::MappedFile(MappedFile &&other) : data_(other.data_), size_(other.size_)
+{
+    other.data_ = nullptr;
+    other.size_ = 0;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other)
+{
+    if (this != &other)
+    {
+        unmap();
+        data_ = other.data_;
+        size_ = other.size_;
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    unmap();
+}
+
+void MappedFile::unmap()
+{
+    if (data_ != nullptr)
+    {
+        ::munmap(const_cast<char *>(data_), size_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef LIB_UTILS_MAPPED_FILE_H_
+#define LIB_UTILS_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+// Read-only memory mapping of a whole file. Pages are loaded on first
+// access and shared with the page cache, so opening a large index costs
+// no reads up front.
+class MappedFile
+{
+public:
+    MappedFile();
+    // Throws std::runtime_error if the file cannot be opened or mapped.
+    explicit MappedFile(const std::string &path);
+    MappedFile(MappedFile &&other);
+    MappedFile &operator=(MappedFile &&other);
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+    inline const char *data() const
+    {
+        return data_;
+    }
+    inline std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    void unmap();
+
+private:
+    const char *data_;
+    std::size_t size_;
+};
+
+#endif // LIB_UTILS_MAPPED_FILE_H_
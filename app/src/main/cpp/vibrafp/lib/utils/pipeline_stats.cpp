@@ -0,0 +1,47 @@
+#include "utils/pipeline_stats.h"
+#include <sys/resource.h>
+#include <algorithm>
+#if defined(__GLIBC__) || defined(__BIONIC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+std::size_t heapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#elif defined(__GLIBC__) || defined(__BIONIC__)
+    // The int fields of the older struct wrap past 2 GB, far above what a
+    // fingerprint needs
+    return static_cast<unsigned int>(mallinfo().uordblks);
+#else
+    return 0;
+#endif
+}
+} // namespace
+
+PipelineStats::PipelineStats()
+    : stage_time(), frames_processed(0), heap_high_water(0), heap_at_start_(heapInUse())
+{
+}
+
+void PipelineStats::SampleHeap()
+{
+    const std::size_t in_use = heapInUse();
+    if (in_use > heap_at_start_)
+    {
+        heap_high_water = std::max(heap_high_water, in_use - heap_at_start_);
+    }
+}
+
+std::uint64_t PipelineStats::MaxResidentBytes()
+{
+    struct rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    // Linux reports kilobytes
+    return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+}
@@ -0,0 +1,82 @@
+#ifndef LIB_UTILS_PIPELINE_STATS_H_
+#define LIB_UTILS_PIPELINE_STATS_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Where the time and memory of one fingerprint computation go. The pipeline
+// stages only measure when they are handed a PipelineStats, otherwise the
+// cost is a null check per stage.
+struct PipelineStats
+{
+    using Clock = std::chrono::steady_clock;
+
+    enum Stage
+    {
+        WAV_PARSE,
+        DOWNSAMPLE,
+        FFT,
+        SPREADING,
+        RECOGNITION,
+        ENCODE,
+        TOTAL, // the library calls doing the work, overlapping the others
+        STAGE_COUNT,
+    };
+
+    PipelineStats();
+
+    // Samples the heap bytes in use, keeping the highest value seen above
+    // those in use at construction. The heap is the process' one, so work
+    // on other threads is counted too. Does nothing where the C library
+    // cannot tell.
+    void SampleHeap();
+
+    // High-water mark of the resident set of the process, 0 if unknown
+    static std::uint64_t MaxResidentBytes();
+
+    Clock::duration stage_time[STAGE_COUNT];
+    std::uint64_t frames_processed; // source frames, before downsampling
+    std::size_t heap_high_water;    // bytes above heap_at_start
+
+private:
+    std::size_t heap_at_start_;
+};
+
+// Adds the time until Stop() or the end of the scope to a stage of `stats`,
+// which may be null.
+class StageTimer
+{
+public:
+    inline StageTimer(PipelineStats *stats, PipelineStats::Stage stage)
+        : stats_(stats), stage_(stage)
+    {
+        if (stats_ != nullptr)
+        {
+            start_ = PipelineStats::Clock::now();
+        }
+    }
+    StageTimer(const StageTimer &) = delete;
+    StageTimer &operator=(const StageTimer &) = delete;
+
+    inline ~StageTimer()
+    {
+        Stop();
+    }
+
+    inline void Stop()
+    {
+        if (stats_ != nullptr)
+        {
+            stats_->stage_time[stage_] += PipelineStats::Clock::now() - start_;
+            stats_ = nullptr;
+        }
+    }
+
+private:
+    PipelineStats *stats_;
+    PipelineStats::Stage stage_;
+    PipelineStats::Clock::time_point start_;
+};
+
+#endif // LIB_UTILS_PIPELINE_STATS_H_
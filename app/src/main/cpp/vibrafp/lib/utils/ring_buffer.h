@@ -1,6 +1,7 @@
 #ifndef LIB_UTILS_RING_BUFFER_H_
 #define LIB_UTILS_RING_BUFFER_H_
 
+#include <algorithm>
 #include <vector>
 
 template <typename T> class RingBuffer : private std::vector<T>
@@ -10,6 +11,12 @@ public:
     virtual ~RingBuffer();
 
     void Append(const T &value);
+    // The element Append() would write next, to fill it in place and then
+    // Advance() past it
+    T &Next();
+    void Advance();
+    // Sets every element to `value` and starts over, keeping the storage
+    void Reset(const T &value);
     std::uint32_t size() const
     {
         return std::vector<T>::size();
@@ -25,6 +32,11 @@ public:
 
     T &operator[](std::int32_t index);
 
+    T *data()
+    {
+        return std::vector<T>::data();
+    }
+
     typename std::vector<T>::iterator begin()
     {
         return std::vector<T>::begin();
@@ -61,9 +73,26 @@ template <typename T> RingBuffer<T>::~RingBuffer()
 
 template <typename T> void RingBuffer<T>::Append(const T &value)
 {
-    this->operator[](position_) = value;
+    Next() = value;
+    Advance();
+}
+
+template <typename T> T &RingBuffer<T>::Next()
+{
+    return this->operator[](position_);
+}
+
+template <typename T> void RingBuffer<T>::Advance()
+{
     position_ = (position_ + 1) % std::vector<T>::size();
     num_written_++;
 }
 
+template <typename T> void RingBuffer<T>::Reset(const T &value)
+{
+    std::fill(std::vector<T>::begin(), std::vector<T>::end(), value);
+    num_written_ = 0;
+    position_ = 0;
+}
+
 #endif // LIB_UTILS_RING_BUFFER_H_
@@ -0,0 +1,140 @@
+#include "utils/trace.h"
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <stdexcept>
+#ifdef __ANDROID__
+#include <android/trace.h>
+#endif
+
+namespace trace
+{
+#if VIBRA_TRACING
+namespace
+{
+std::atomic<Callback> callback(nullptr);
+void *callback_user_data = nullptr;
+
+struct JsonWriter
+{
+    std::mutex mutex;
+    std::FILE *file = nullptr;
+    bool empty = true;
+    std::chrono::steady_clock::time_point start;
+};
+
+JsonWriter json_writer;
+
+void writeJsonEvent(const char *name, int begin, void *user_data)
+{
+    auto *writer = static_cast<JsonWriter *>(user_data);
+    const auto now = std::chrono::steady_clock::now();
+    const long tid = ::syscall(SYS_gettid);
+    std::lock_guard<std::mutex> lock(writer->mutex);
+    if (writer->file == nullptr)
+    {
+        return;
+    }
+    const long long ts =
+        std::chrono::duration_cast<std::chrono::microseconds>(now - writer->start).count();
+    std::fprintf(writer->file,
+                 "%s{\"name\":\"%s\",\"cat\":\"vibra\",\"ph\":\"%c\",\"ts\":%lld,\"pid\":%d,"
+                 "\"tid\":%ld}",
+                 writer->empty ? "" : ",\n", name, begin ? 'B' : 'E', ts,
+                 static_cast<int>(::getpid()), tid);
+    writer->empty = false;
+}
+} // namespace
+
+bool SetCallback(Callback new_callback, void *user_data)
+{
+    callback.store(nullptr);
+    callback_user_data = user_data;
+    callback.store(new_callback);
+    return true;
+}
+
+bool StartJson(const std::string &path)
+{
+    StopJson();
+    std::FILE *file = std::fopen(path.c_str(), "w");
+    if (file == nullptr)
+    {
+        throw std::runtime_error("Cannot create trace file " + path);
+    }
+    {
+        std::lock_guard<std::mutex> lock(json_writer.mutex);
+        json_writer.file = file;
+        json_writer.empty = true;
+        json_writer.start = std::chrono::steady_clock::now();
+        // The JSON array format, which allows the closing bracket to be missing
+        std::fputs("[\n", file);
+    }
+    return SetCallback(writeJsonEvent, &json_writer);
+}
+
+void StopJson()
+{
+    if (callback.load() == writeJsonEvent)
+    {
+        callback.store(nullptr);
+    }
+    std::lock_guard<std::mutex> lock(json_writer.mutex);
+    if (json_writer.file != nullptr)
+    {
+        std::fputs("\n]\n", json_writer.file);
+        std::fclose(json_writer.file);
+        json_writer.file = nullptr;
+    }
+}
+
+void Begin(const char *name)
+{
+#ifdef __ANDROID__
+    ATrace_beginSection(name);
+#endif
+    const Callback current = callback.load(std::memory_order_acquire);
+    if (current != nullptr)
+    {
+        current(name, 1, callback_user_data);
+    }
+}
+
+void End(const char *name)
+{
+#ifdef __ANDROID__
+    ATrace_endSection();
+#endif
+    const Callback current = callback.load(std::memory_order_acquire);
+    if (current != nullptr)
+    {
+        current(name, 0, callback_user_data);
+    }
+}
+#else
+bool SetCallback(Callback /*callback*/, void * /*user_data*/)
+{
+    return false;
+}
+
+bool StartJson(const std::string & /*path*/)
+{
+    return false;
+}
+
+void StopJson()
+{
+}
+
+void Begin(const char * /*name*/)
+{
+}
+
+void End(const char * /*name*/)
+{
+}
+#endif
+} // namespace trace
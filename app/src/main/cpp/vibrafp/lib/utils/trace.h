@@ -0,0 +1,113 @@
+#ifndef LIB_UTILS_TRACE_H_
+#define LIB_UTILS_TRACE_H_
+
+#include <cstdint>
+#include <string>
+
+// Trace sections around the pipeline stages, compiled in with the
+// VIBRA_TRACING CMake option and free otherwise. On Android they are ATrace
+// sections that show up in systrace and Perfetto, everywhere they also go
+// to the callback, such as the Chrome trace JSON writer below.
+//
+// Section names must be string literals, sinks may keep the pointers.
+namespace trace
+{
+// `begin` is zero for the end of the section named `name` on this thread,
+// the signature of VibraTraceCallback in vibra.h
+using Callback = void (*)(const char *name, int begin, void *user_data);
+
+// Both return false when tracing is not compiled in. Sinks must not be
+// changed while other threads may be in a traced section.
+bool SetCallback(Callback callback, void *user_data);
+// Writes the sections of every thread to `path` in the Chrome trace event
+// format, readable by chrome://tracing and ui.perfetto.dev, until
+// StopJson(). Replaces the callback. Throws std::runtime_error if the file
+// cannot be created.
+bool StartJson(const std::string &path);
+void StopJson();
+
+void Begin(const char *name);
+void End(const char *name);
+
+#if VIBRA_TRACING
+class Scope
+{
+public:
+    inline explicit Scope(const char *name) : name_(name)
+    {
+        Begin(name_);
+    }
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    inline ~Scope()
+    {
+        End(name_);
+    }
+
+private:
+    const char *name_;
+};
+
+// Splits a loop into sections of `ticks_per_slice` iterations, so that long
+// computations show their progress without a section per iteration.
+class Slices
+{
+public:
+    inline Slices(const char *name, std::uint32_t ticks_per_slice)
+        : name_(name), ticks_per_slice_(ticks_per_slice), ticks_(0)
+    {
+    }
+    Slices(const Slices &) = delete;
+    Slices &operator=(const Slices &) = delete;
+
+    inline ~Slices()
+    {
+        if (ticks_ > 0)
+        {
+            End(name_);
+        }
+    }
+
+    // Call at the start of each iteration
+    inline void Tick()
+    {
+        if (ticks_ == ticks_per_slice_)
+        {
+            End(name_);
+            ticks_ = 0;
+        }
+        if (ticks_++ == 0)
+        {
+            Begin(name_);
+        }
+    }
+
+private:
+    const char *name_;
+    std::uint32_t ticks_per_slice_;
+    std::uint32_t ticks_;
+};
+#else
+class Scope
+{
+public:
+    inline explicit Scope(const char * /*name*/)
+    {
+    }
+};
+
+class Slices
+{
+public:
+    inline Slices(const char * /*name*/, std::uint32_t /*ticks_per_slice*/)
+    {
+    }
+    inline void Tick()
+    {
+    }
+};
+#endif
+} // namespace trace
+
+#endif // LIB_UTILS_TRACE_H_
@@ -1,34 +1,838 @@
 #include "../include/vibra.h"
-#include "algorithm/signature_generator.h"
+#include "algorithm/fingerprint_session.h"
 #include "audio/downsampler.h"
 #include "audio/wav.h"
+#include "match/index_segments.h"
+#include "match/landmark_index.h"
+#include "match/lsh_table.h"
+#include "match/playback_ingestor.h"
+#include "match/signature_similarity.h"
+#include "storage/signature_pack.h"
+#include "utils/cpu_features.h"
+#include "utils/trace.h"
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 constexpr std::uint32_t MAX_DURATION_SECONDS = 12;
+static_assert(VIBRA_DIGEST_SIZE == DIGEST_SIZE, "vibra.h digest size is out of date");
 
-Fingerprint *_get_fingerprint_from_wav(const Wav &wav);
+struct VibraSession
+{
+    std::vector<char> pcm; // empty when the caller's buffer is borrowed
+    std::unique_ptr<FingerprintSession> session;
+    CancellationToken cancellation_token;
+    std::unique_ptr<PipelineStats> stats; // null unless stats were enabled
+    unsigned int peaks_per_band[4];       // once the fingerprint was fetched
+    std::string error;
+};
+
+struct VibraSignature
+{
+    Signature signature;
+};
+
+struct VibraLshTable
+{
+    LshTable table;
+};
+
+struct VibraIndexBuilder
+{
+    LandmarkIndexBuilder builder;
+    std::string error;
+};
 
-Fingerprint *_get_fingerprint_from_low_quality_pcm(const LowQualityTrack &pcm);
+struct VibraIndex
+{
+    std::vector<LandmarkIndex> segments; // a single one for index files
+};
+
+struct VibraIngestor
+{
+    explicit VibraIngestor(const char *directory) : ingestor(directory)
+    {
+    }
+
+    PlaybackIngestor ingestor;
+    std::string error;
+    // commits run on another thread than the rest
+    std::vector<std::uint32_t> committed_ids;
+    std::string commit_error;
+};
+
+struct VibraSignaturePackWriter
+{
+    SignaturePackWriter writer;
+    std::string error;
+};
+
+struct VibraSignaturePack
+{
+    SignaturePack pack;
+};
+
+// fft passes are 128 samples at the 16kHz analysis rate, 8 ms each
+constexpr int MS_PER_FFT_PASS = 8;
+// About 6 seconds of 44.1kHz audio between landmark hand-offs
+constexpr std::size_t INDEX_STEP_FRAMES = 1u << 18;
+
+namespace
+{
+std::atomic<bool> stats_enabled(false);
+} // namespace
+
+Fingerprint *_get_fingerprint_from_pcm(const char *raw_pcm, std::int64_t pcm_data_size,
+                                       SampleFormat sample_format, int sample_rate,
+                                       int sample_width, int channel_count,
+                                       PipelineStats *stats);
+
+// Times the encoding into `stats` and counts the peaks of the fingerprint
+// stats if it is not null, the other fields are set by _finish_stats().
+Fingerprint *_get_fingerprint_from_signature(const Signature &signature,
+                                             PipelineStats *stats = nullptr);
+
+// Null unless stats are enabled
+PipelineStats *_new_stats();
+
+// Stops `total_timer` and copies `stats`, if not null, to the fingerprint
+Fingerprint *_finish_stats(Fingerprint *fingerprint, const PipelineStats *stats,
+                           StageTimer *total_timer);
+
+// Copies all but the peak counts, which PipelineStats does not know about
+void _copy_stats(const PipelineStats &stats, VibraStats *out);
+
+SignatureDigest _digest_from_values(const unsigned long long *values);
+
+int vibra_trace_set_callback(VibraTraceCallback callback, void *user_data)
+{
+    return trace::SetCallback(callback, user_data) ? VIBRA_STATUS_DONE : VIBRA_STATUS_ERROR;
+}
+
+int vibra_trace_start_json(const char *path)
+{
+    try
+    {
+        return trace::StartJson(path) ? VIBRA_STATUS_DONE : VIBRA_STATUS_ERROR;
+    }
+    catch (const std::exception &)
+    {
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+void vibra_trace_stop_json(void)
+{
+    trace::StopJson();
+}
+
+void vibra_set_stats_enabled(int enabled)
+{
+    stats_enabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+void vibra_set_force_scalar(int forced)
+{
+    cpu::SetScalarForced(forced != 0);
+}
+
+const char *vibra_get_cpu_features(void)
+{
+    static const std::string features = cpu::Describe(cpu::Detected());
+    return features.c_str();
+}
 
 Fingerprint *vibra_get_fingerprint_from_wav_data(const char *raw_wav, int wav_data_size)
 {
-    Wav wav = Wav::FromRawWav(raw_wav, wav_data_size);
-    return _get_fingerprint_from_wav(wav);
+    trace::Scope trace_scope("vibra_get_fingerprint_from_wav_data");
+    std::unique_ptr<PipelineStats> stats(_new_stats());
+    StageTimer total_timer(stats.get(), PipelineStats::TOTAL);
+    StageTimer parse_timer(stats.get(), PipelineStats::WAV_PARSE);
+    Wav wav = Wav::ViewRawWav(raw_wav, wav_data_size);
+    parse_timer.Stop();
+    Fingerprint *fingerprint = _get_fingerprint_from_pcm(
+        reinterpret_cast<const char *>(wav.data()), wav.data_size(), wav.sample_format(),
+        wav.sample_rate_(), wav.bits_per_sample(), wav.num_channels(), stats.get());
+    return _finish_stats(fingerprint, stats.get(), &total_timer);
 }
 
 Fingerprint *vibra_get_fingerprint_from_signed_pcm(const char *raw_pcm, int pcm_data_size,
                                                    int sample_rate, int sample_width,
                                                    int channel_count)
 {
-    Wav wav = Wav::FromSignedPCM(raw_pcm, pcm_data_size, sample_rate, sample_width, channel_count);
-    return _get_fingerprint_from_wav(wav);
+    trace::Scope trace_scope("vibra_get_fingerprint_from_signed_pcm");
+    std::unique_ptr<PipelineStats> stats(_new_stats());
+    StageTimer total_timer(stats.get(), PipelineStats::TOTAL);
+    Fingerprint *fingerprint =
+        _get_fingerprint_from_pcm(raw_pcm, pcm_data_size, SampleFormat::SIGNED_INTEGER,
+                                  sample_rate, sample_width, channel_count, stats.get());
+    return _finish_stats(fingerprint, stats.get(), &total_timer);
 }
 
 Fingerprint *vibra_get_fingerprint_from_float_pcm(const char *raw_pcm, int pcm_data_size,
                                                   int sample_rate, int sample_width,
                                                   int channel_count)
 {
-    Wav wav = Wav::FromFloatPCM(raw_pcm, pcm_data_size, sample_rate, sample_width, channel_count);
-    return _get_fingerprint_from_wav(wav);
+    trace::Scope trace_scope("vibra_get_fingerprint_from_float_pcm");
+    std::unique_ptr<PipelineStats> stats(_new_stats());
+    StageTimer total_timer(stats.get(), PipelineStats::TOTAL);
+    Fingerprint *fingerprint =
+        _get_fingerprint_from_pcm(raw_pcm, pcm_data_size, SampleFormat::FLOAT, sample_rate,
+                                  sample_width, channel_count, stats.get());
+    return _finish_stats(fingerprint, stats.get(), &total_timer);
+}
+
+// Copies `raw_pcm` into the session unless `borrow` is set
+VibraSession *_create_session(const char *raw_pcm, int pcm_data_size, int sample_rate,
+                              int sample_width, int channel_count, int is_float, bool borrow)
+{
+    if (raw_pcm == nullptr || pcm_data_size < 0 || sample_rate <= 0 || sample_width <= 0 ||
+        channel_count <= 0)
+    {
+        return nullptr;
+    }
+    try
+    {
+        std::unique_ptr<VibraSession> session(new VibraSession);
+        if (!borrow)
+        {
+            session->pcm.assign(raw_pcm, raw_pcm + pcm_data_size);
+            raw_pcm = session->pcm.data();
+        }
+        session->session.reset(new FingerprintSession(
+            raw_pcm, static_cast<std::size_t>(pcm_data_size),
+            is_float ? SampleFormat::FLOAT : SampleFormat::SIGNED_INTEGER, sample_rate,
+            sample_width, channel_count, MAX_DURATION_SECONDS));
+        session->session->set_cancellation_token(&session->cancellation_token);
+        session->stats.reset(_new_stats());
+        session->session->set_stats(session->stats.get());
+        std::fill(session->peaks_per_band, session->peaks_per_band + 4, 0u);
+        return session.release();
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+VibraSession *vibra_session_create(const char *raw_pcm, int pcm_data_size, int sample_rate,
+                                   int sample_width, int channel_count, int is_float)
+{
+    return _create_session(raw_pcm, pcm_data_size, sample_rate, sample_width, channel_count,
+                           is_float, false);
+}
+
+VibraSession *vibra_session_create_borrowed(const char *raw_pcm, int pcm_data_size,
+                                            int sample_rate, int sample_width, int channel_count,
+                                            int is_float)
+{
+    return _create_session(raw_pcm, pcm_data_size, sample_rate, sample_width, channel_count,
+                           is_float, true);
+}
+
+void vibra_session_set_timeout_ms(VibraSession *session, unsigned int timeout_ms)
+{
+    session->cancellation_token.set_deadline(CancellationToken::Clock::now() +
+                                             std::chrono::milliseconds(timeout_ms));
+}
+
+void vibra_session_cancel(VibraSession *session)
+{
+    session->cancellation_token.Cancel();
+}
+
+int vibra_session_step(VibraSession *session, int max_frames)
+{
+    if (max_frames <= 0)
+    {
+        session->error = "max_frames must be positive";
+        return VIBRA_STATUS_ERROR;
+    }
+    try
+    {
+        trace::Scope trace_scope("vibra_session_step");
+        StageTimer total_timer(session->stats.get(), PipelineStats::TOTAL);
+        return session->session->Step(max_frames) ? VIBRA_STATUS_DONE : VIBRA_STATUS_PENDING;
+    }
+    catch (const OperationCancelled &e)
+    {
+        session->error = e.what();
+        return e.reason() == OperationCancelled::Reason::CANCELLED
+                   ? VIBRA_STATUS_CANCELLED
+                   : VIBRA_STATUS_DEADLINE_EXCEEDED;
+    }
+    catch (const std::exception &e)
+    {
+        session->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+Fingerprint *vibra_session_get_fingerprint(VibraSession *session)
+{
+    if (!session->session->IsDone())
+    {
+        session->error = "Session has not finished";
+        return nullptr;
+    }
+    try
+    {
+        trace::Scope trace_scope("vibra_session_get_fingerprint");
+        StageTimer total_timer(session->stats.get(), PipelineStats::TOTAL);
+        Fingerprint *fingerprint =
+            _get_fingerprint_from_signature(session->session->Finish(), session->stats.get());
+        if (fingerprint->has_stats)
+        {
+            std::copy(fingerprint->stats.peaks_per_band, fingerprint->stats.peaks_per_band + 4,
+                      session->peaks_per_band);
+        }
+        return _finish_stats(fingerprint, session->stats.get(), &total_timer);
+    }
+    catch (const std::exception &e)
+    {
+        session->error = e.what();
+        return nullptr;
+    }
+}
+
+int vibra_session_get_stats(const VibraSession *session, VibraStats *stats)
+{
+    if (session->stats == nullptr)
+    {
+        return VIBRA_STATUS_ERROR;
+    }
+    _copy_stats(*session->stats, stats);
+    std::copy(session->peaks_per_band, session->peaks_per_band + 4, stats->peaks_per_band);
+    return VIBRA_STATUS_DONE;
+}
+
+const char *vibra_session_get_error(VibraSession *session)
+{
+    return session->error.c_str();
+}
+
+void vibra_session_free(VibraSession *session)
+{
+    delete session;
+}
+
+VibraSignature *vibra_signature_from_uri(const char *uri, int uri_size)
+{
+    if (uri == nullptr || uri_size < 0)
+    {
+        return nullptr;
+    }
+    try
+    {
+        return new VibraSignature{Signature::DecodeBase64(uri, uri_size)};
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+unsigned int vibra_signature_get_sample_ms(const VibraSignature *signature)
+{
+    return static_cast<std::uint64_t>(signature->signature.num_samples()) * 1000 /
+           signature->signature.sample_rate();
+}
+
+int vibra_signature_get_peak_count(const VibraSignature *signature)
+{
+    return signature->signature.SumOfPeaksLength();
+}
+
+int vibra_signature_get_peaks(const VibraSignature *signature, VibraPeak *peaks, int capacity)
+{
+    if (peaks == nullptr || capacity <= 0)
+    {
+        return 0;
+    }
+    int count = 0;
+    for (const auto &pair : signature->signature.frequency_band_to_peaks())
+    {
+        for (const auto &peak : pair.second)
+        {
+            if (count == capacity)
+            {
+                return count;
+            }
+            peaks[count++] = VibraPeak{static_cast<int>(pair.first), peak.fft_pass_number(),
+                                       peak.peak_magnitude(),
+                                       peak.corrected_peak_frequency_bin()};
+        }
+    }
+    return count;
+}
+
+Fingerprint *vibra_signature_to_fingerprint(const VibraSignature *signature)
+{
+    try
+    {
+        return _get_fingerprint_from_signature(signature->signature);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+void vibra_signature_free(VibraSignature *signature)
+{
+    delete signature;
+}
+
+int vibra_compare_signatures(const VibraSignature *a, const VibraSignature *b,
+                             VibraSimilarity *similarity)
+{
+    try
+    {
+        const SimilarityResult result = CompareSignatures(a->signature, b->signature);
+        // an fft pass is 128 samples
+        const long long offset_us = static_cast<long long>(result.offset_passes) * 128 *
+                                    1000000 / a->signature.sample_rate();
+        *similarity = VibraSimilarity{result.score, offset_us, result.matched_peaks};
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &)
+    {
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_signature_get_digest(const VibraSignature *signature, unsigned long long *digest)
+{
+    const SignatureDigest &values = signature->signature.digest();
+    std::copy(values.begin(), values.end(), digest);
+    return values == EmptyDigest() ? VIBRA_STATUS_ERROR : VIBRA_STATUS_DONE;
+}
+
+VibraLshTable *vibra_lsh_table_create(void)
+{
+    return new VibraLshTable();
+}
+
+int vibra_lsh_table_insert(VibraLshTable *table, long long id, const unsigned long long *digest)
+{
+    return table->table.Insert(static_cast<std::uint64_t>(id), _digest_from_values(digest))
+               ? VIBRA_STATUS_DONE
+               : VIBRA_STATUS_ERROR;
+}
+
+int vibra_lsh_table_remove(VibraLshTable *table, long long id)
+{
+    return table->table.Remove(static_cast<std::uint64_t>(id)) ? 1 : 0;
+}
+
+int vibra_lsh_table_query(const VibraLshTable *table, const unsigned long long *digest,
+                          long long *ids, int capacity)
+{
+    if (ids == nullptr || capacity <= 0)
+    {
+        return 0;
+    }
+    const std::vector<std::uint64_t> candidates = table->table.Query(_digest_from_values(digest));
+    const int count = std::min(capacity, static_cast<int>(candidates.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        ids[i] = static_cast<long long>(candidates[i]);
+    }
+    return count;
+}
+
+int vibra_lsh_table_get_size(const VibraLshTable *table)
+{
+    return static_cast<int>(table->table.size());
+}
+
+void vibra_lsh_table_free(VibraLshTable *table)
+{
+    delete table;
+}
+
+VibraIndexBuilder *vibra_index_builder_create(void)
+{
+    return new VibraIndexBuilder();
+}
+
+int vibra_index_builder_add_signature(VibraIndexBuilder *builder, unsigned int track_id,
+                                      const VibraSignature *signature, unsigned int offset_ms)
+{
+    try
+    {
+        builder->builder.AddSignature(track_id, signature->signature, offset_ms / MS_PER_FFT_PASS);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        builder->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_index_builder_add_pcm(VibraIndexBuilder *builder, unsigned int track_id,
+                                const char *raw_pcm, int pcm_data_size, int sample_rate,
+                                int sample_width, int channel_count, int is_float)
+{
+    if (raw_pcm == nullptr || pcm_data_size < 0 || sample_rate <= 0 || sample_width <= 0 ||
+        channel_count <= 0)
+    {
+        builder->error = "Invalid PCM parameters";
+        return VIBRA_STATUS_ERROR;
+    }
+    try
+    {
+        FingerprintSession session(raw_pcm, pcm_data_size,
+                                   is_float ? SampleFormat::FLOAT : SampleFormat::SIGNED_INTEGER,
+                                   sample_rate, sample_width, channel_count,
+                                   std::numeric_limits<double>::infinity());
+        // Landmarks are taken as the peaks are found rather than extracted
+        // from the finished signature in a second pass
+        session.EnableLandmarks(builder->builder.config());
+        std::vector<Landmark> landmarks;
+        while (!session.Step(INDEX_STEP_FRAMES))
+        {
+            landmarks.clear();
+            session.TakeLandmarks(&landmarks);
+            builder->builder.AddLandmarks(track_id, landmarks);
+        }
+        landmarks.clear();
+        session.TakeLandmarks(&landmarks);
+        builder->builder.AddLandmarks(track_id, landmarks);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        builder->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_index_builder_add_index(VibraIndexBuilder *builder, const VibraIndex *index)
+{
+    try
+    {
+        for (const auto &segment : index->segments)
+        {
+            builder->builder.AddIndex(segment);
+        }
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        builder->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_index_builder_write(VibraIndexBuilder *builder, const char *path)
+{
+    try
+    {
+        builder->builder.Write(path);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        builder->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+const char *vibra_index_builder_get_error(VibraIndexBuilder *builder)
+{
+    return builder->error.c_str();
+}
+
+void vibra_index_builder_free(VibraIndexBuilder *builder)
+{
+    delete builder;
+}
+
+VibraIndex *vibra_index_open(const char *path)
+{
+    try
+    {
+        struct stat info;
+        if (::stat(path, &info) == 0 && S_ISDIR(info.st_mode))
+        {
+            return new VibraIndex{OpenIndexSegments(path)};
+        }
+        std::unique_ptr<VibraIndex> index(new VibraIndex());
+        index->segments.push_back(LandmarkIndex::Open(path));
+        return index.release();
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+int vibra_index_query(const VibraIndex *index, const VibraSignature *signature,
+                      VibraMatch *match)
+{
+    try
+    {
+        const MatchResult result = QueryIndexSegments(index->segments, signature->signature);
+        *match = VibraMatch{result.track_id, result.offset_passes * MS_PER_FFT_PASS,
+                            result.score, result.query_landmarks};
+        return result.found ? 1 : 0;
+    }
+    catch (const std::exception &)
+    {
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+unsigned int vibra_index_get_track_count(const VibraIndex *index)
+{
+    unsigned int track_count = 0;
+    for (const auto &segment : index->segments)
+    {
+        track_count += segment.track_count();
+    }
+    return track_count;
+}
+
+void vibra_index_free(VibraIndex *index)
+{
+    delete index;
+}
+
+VibraIngestor *vibra_ingestor_create(const char *directory)
+{
+    if (directory == nullptr)
+    {
+        return nullptr;
+    }
+    return new VibraIngestor(directory);
+}
+
+int vibra_ingestor_begin_track(VibraIngestor *ingestor, unsigned int track_id, int sample_rate,
+                               int sample_width, int channel_count, int is_float)
+{
+    if (sample_rate <= 0 || sample_width <= 0 || channel_count <= 0)
+    {
+        ingestor->error = "Invalid PCM parameters";
+        return VIBRA_STATUS_ERROR;
+    }
+    try
+    {
+        ingestor->ingestor.BeginTrack(track_id,
+                                      is_float ? SampleFormat::FLOAT : SampleFormat::SIGNED_INTEGER,
+                                      sample_rate, sample_width, channel_count);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        ingestor->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_ingestor_feed(VibraIngestor *ingestor, const char *raw_pcm, int pcm_data_size,
+                        int budget_us)
+{
+    if (raw_pcm == nullptr || pcm_data_size < 0 || budget_us < 0)
+    {
+        ingestor->error = "Invalid PCM parameters";
+        return VIBRA_STATUS_ERROR;
+    }
+    try
+    {
+        const bool tracking = ingestor->ingestor.tracking();
+        const std::size_t queued = ingestor->ingestor.Feed(raw_pcm, pcm_data_size,
+                                                           std::chrono::microseconds(budget_us));
+        if (tracking && !ingestor->ingestor.tracking())
+        {
+            ingestor->error = "The track fell behind playback and was dropped";
+            return VIBRA_STATUS_DROPPED;
+        }
+        return queued == 0 ? VIBRA_STATUS_DONE : VIBRA_STATUS_PENDING;
+    }
+    catch (const std::exception &e)
+    {
+        // Whatever was analysed is inconsistent now, so is the rest of the track
+        ingestor->ingestor.AbandonTrack();
+        ingestor->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+void vibra_ingestor_end_track(VibraIngestor *ingestor)
+{
+    ingestor->ingestor.EndTrack();
+}
+
+int vibra_ingestor_commit(VibraIngestor *ingestor)
+{
+    ingestor->committed_ids.clear();
+    try
+    {
+        ingestor->committed_ids = ingestor->ingestor.Commit();
+        return static_cast<int>(ingestor->committed_ids.size());
+    }
+    catch (const std::exception &e)
+    {
+        ingestor->commit_error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_ingestor_get_committed_ids(const VibraIngestor *ingestor, unsigned int *ids,
+                                     int capacity)
+{
+    if (ids == nullptr || capacity <= 0)
+    {
+        return 0;
+    }
+    const int count =
+        static_cast<int>(std::min<std::size_t>(ingestor->committed_ids.size(), capacity));
+    std::copy(ingestor->committed_ids.begin(), ingestor->committed_ids.begin() + count, ids);
+    return count;
+}
+
+const char *vibra_ingestor_get_error(VibraIngestor *ingestor)
+{
+    return ingestor->error.c_str();
+}
+
+const char *vibra_ingestor_get_commit_error(VibraIngestor *ingestor)
+{
+    return ingestor->commit_error.c_str();
+}
+
+void vibra_ingestor_free(VibraIngestor *ingestor)
+{
+    delete ingestor;
+}
+
+VibraSignaturePackWriter *vibra_signature_pack_writer_create(void)
+{
+    return new VibraSignaturePackWriter();
+}
+
+int vibra_signature_pack_writer_add(VibraSignaturePackWriter *writer, unsigned long long key,
+                                    const char *uri, int uri_size)
+{
+    if (uri == nullptr || uri_size < 0)
+    {
+        writer->error = "Invalid signature URI";
+        return VIBRA_STATUS_ERROR;
+    }
+    try
+    {
+        writer->writer.AddUri(key, uri, uri_size);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        writer->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_signature_pack_writer_add_pack(VibraSignaturePackWriter *writer,
+                                         const VibraSignaturePack *pack)
+{
+    try
+    {
+        writer->writer.AddPack(pack->pack);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        writer->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+int vibra_signature_pack_writer_remove(VibraSignaturePackWriter *writer, unsigned long long key)
+{
+    return writer->writer.Remove(key) ? 1 : 0;
+}
+
+int vibra_signature_pack_writer_write(VibraSignaturePackWriter *writer, const char *path)
+{
+    try
+    {
+        writer->writer.Write(path);
+        return VIBRA_STATUS_DONE;
+    }
+    catch (const std::exception &e)
+    {
+        writer->error = e.what();
+        return VIBRA_STATUS_ERROR;
+    }
+}
+
+const char *vibra_signature_pack_writer_get_error(VibraSignaturePackWriter *writer)
+{
+    return writer->error.c_str();
+}
+
+void vibra_signature_pack_writer_free(VibraSignaturePackWriter *writer)
+{
+    delete writer;
+}
+
+VibraSignaturePack *vibra_signature_pack_open(const char *path)
+{
+    try
+    {
+        return new VibraSignaturePack{SignaturePack::Open(path)};
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+int vibra_signature_pack_get_size(const VibraSignaturePack *pack)
+{
+    return static_cast<int>(pack->pack.size());
+}
+
+unsigned long long vibra_signature_pack_get_key(const VibraSignaturePack *pack, int index)
+{
+    if (index < 0 || static_cast<std::size_t>(index) >= pack->pack.size())
+    {
+        return 0;
+    }
+    return pack->pack.key(index);
+}
+
+int vibra_signature_pack_find(const VibraSignaturePack *pack, unsigned long long key)
+{
+    const std::size_t index = pack->pack.Find(key);
+    return index == pack->pack.size() ? -1 : static_cast<int>(index);
+}
+
+VibraSignature *vibra_signature_pack_get_signature(const VibraSignaturePack *pack, int index)
+{
+    if (index < 0 || static_cast<std::size_t>(index) >= pack->pack.size())
+    {
+        return nullptr;
+    }
+    try
+    {
+        return new VibraSignature{pack->pack.record(index).ToSignature()};
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+void vibra_signature_pack_free(VibraSignaturePack *pack)
+{
+    delete pack;
 }
 
 const char *vibra_get_uri_from_fingerprint(Fingerprint *fingerprint)
@@ -41,27 +845,98 @@ unsigned int vibra_get_sample_ms_from_fingerprint(Fingerprint *fingerprint)
     return fingerprint->sample_ms;
 }
 
+int vibra_get_stats_from_fingerprint(const Fingerprint *fingerprint, VibraStats *stats)
+{
+    if (!fingerprint->has_stats)
+    {
+        return VIBRA_STATUS_ERROR;
+    }
+    *stats = fingerprint->stats;
+    return VIBRA_STATUS_DONE;
+}
+
 void vibra_free_fingerprint(Fingerprint *fingerprint)
 {
     delete fingerprint;
 }
 
-Fingerprint *_get_fingerprint_from_wav(const Wav &wav)
+Fingerprint *_get_fingerprint_from_pcm(const char *raw_pcm, std::int64_t pcm_data_size,
+                                       SampleFormat sample_format, int sample_rate,
+                                       int sample_width, int channel_count,
+                                       PipelineStats *stats)
 {
-    LowQualityTrack pcm = Downsampler::GetLowQualityPCM(wav);
-    return _get_fingerprint_from_low_quality_pcm(pcm);
+    if (raw_pcm == nullptr || pcm_data_size < 0 || sample_rate <= 0 || sample_width <= 0 ||
+        channel_count <= 0)
+    {
+        throw std::invalid_argument("Invalid PCM parameters");
+    }
+    FingerprintSession session(raw_pcm, static_cast<std::size_t>(pcm_data_size), sample_format,
+                               sample_rate, sample_width, channel_count, MAX_DURATION_SECONDS);
+    session.set_stats(stats);
+    return _get_fingerprint_from_signature(session.Finish(), stats);
 }
 
-Fingerprint *_get_fingerprint_from_low_quality_pcm(const LowQualityTrack &pcm)
+Fingerprint *_get_fingerprint_from_signature(const Signature &signature, PipelineStats *stats)
 {
-    SignatureGenerator generator;
-    generator.FeedInput(pcm);
-    generator.set_max_time_seconds(MAX_DURATION_SECONDS);
+    std::unique_ptr<Fingerprint> fingerprint(new Fingerprint);
+    StageTimer encode_timer(stats, PipelineStats::ENCODE);
+    fingerprint->uri = signature.EncodeBase64();
+    encode_timer.Stop();
+    fingerprint->sample_ms =
+        static_cast<std::uint64_t>(signature.num_samples()) * 1000 / signature.sample_rate();
+    std::copy(signature.digest().begin(), signature.digest().end(), fingerprint->digest);
+    fingerprint->has_stats = stats != nullptr;
+    fingerprint->stats = VibraStats();
+    if (stats != nullptr)
+    {
+        for (const auto &pair : signature.frequency_band_to_peaks())
+        {
+            const int band = static_cast<int>(pair.first);
+            if (band >= 0 && band < 4)
+            {
+                fingerprint->stats.peaks_per_band[band] = pair.second.size();
+            }
+        }
+    }
+    return fingerprint.release();
+}
 
-    Signature signature = generator.GetNextSignature();
+PipelineStats *_new_stats()
+{
+    return stats_enabled.load(std::memory_order_relaxed) ? new PipelineStats : nullptr;
+}
 
-    Fingerprint *fingerprint = new Fingerprint;
-    fingerprint->uri = signature.EncodeBase64();
-    fingerprint->sample_ms = signature.num_samples() * 1000 / signature.sample_rate();
+Fingerprint *_finish_stats(Fingerprint *fingerprint, const PipelineStats *stats,
+                           StageTimer *total_timer)
+{
+    total_timer->Stop();
+    if (stats != nullptr)
+    {
+        _copy_stats(*stats, &fingerprint->stats);
+    }
     return fingerprint;
 }
+
+void _copy_stats(const PipelineStats &stats, VibraStats *out)
+{
+    const auto ms = [&stats](PipelineStats::Stage stage) {
+        return std::chrono::duration<double, std::milli>(stats.stage_time[stage]).count();
+    };
+    out->wav_parse_ms = ms(PipelineStats::WAV_PARSE);
+    out->downsample_ms = ms(PipelineStats::DOWNSAMPLE);
+    out->fft_ms = ms(PipelineStats::FFT);
+    out->spreading_ms = ms(PipelineStats::SPREADING);
+    out->recognition_ms = ms(PipelineStats::RECOGNITION);
+    out->encode_ms = ms(PipelineStats::ENCODE);
+    out->total_ms = ms(PipelineStats::TOTAL);
+    out->frames_processed = stats.frames_processed;
+    out->heap_high_water_bytes = stats.heap_high_water;
+    out->max_resident_bytes = PipelineStats::MaxResidentBytes();
+}
+
+SignatureDigest _digest_from_values(const unsigned long long *values)
+{
+    SignatureDigest digest;
+    std::copy(values, values + DIGEST_SIZE, digest.begin());
+    return digest;
+}
@@ -1,15 +1,20 @@
 #include <jni.h>
 #include <string>
+#include <vector>
 #include "../include/vibra.h"
 
-extern "C"
-JNIEXPORT jstring JNICALL
-Java_com_metrolist_music_recognition_VibraSignature_fromI16(JNIEnv *env, jclass /*clazz*/, jbyteArray rawPcm) {
+static jstring fingerprintFromSignedPcm16(JNIEnv *env, jbyteArray rawPcm, jint sampleRate,
+                                          jint channelCount) {
     if (rawPcm == nullptr) {
         jclass iae = env->FindClass("java/lang/IllegalArgumentException");
         if (iae) env->ThrowNew(iae, "rawPcm must not be null");
         return nullptr;
     }
+    if (sampleRate <= 0 || channelCount <= 0) {
+        jclass iae = env->FindClass("java/lang/IllegalArgumentException");
+        if (iae) env->ThrowNew(iae, "sampleRate and channelCount must be positive");
+        return nullptr;
+    }
     jbyte *pcmData = env->GetByteArrayElements(rawPcm, nullptr);
     if (pcmData == nullptr) {
         if (!env->ExceptionCheck()) {
@@ -23,9 +28,9 @@ Java_com_metrolist_music_recognition_VibraSignature_fromI16(JNIEnv *env, jclass
         Fingerprint *fp = vibra_get_fingerprint_from_signed_pcm(
                 reinterpret_cast<const char *>(pcmData),
                 static_cast<int>(size),
-                /*sample rate*/ 16000,
+                static_cast<int>(sampleRate),
                 /*bits per sample*/16,
-                /*channels*/1
+                static_cast<int>(channelCount)
         );
         env->ReleaseByteArrayElements(rawPcm, pcmData, JNI_ABORT);
         if (fp == nullptr) {
@@ -65,3 +70,719 @@ Java_com_metrolist_music_recognition_VibraSignature_fromI16(JNIEnv *env, jclass
         return nullptr;
     }
 }
+
+extern "C"
+JNIEXPORT jstring JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_fromI16(JNIEnv *env, jclass /*clazz*/, jbyteArray rawPcm) {
+    return fingerprintFromSignedPcm16(env, rawPcm, /*sample rate*/ 16000, /*channels*/ 1);
+}
+
+extern "C"
+JNIEXPORT jstring JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_fromPcm16(JNIEnv *env, jclass /*clazz*/, jbyteArray rawPcm,
+                                                              jint sampleRate, jint channelCount) {
+    return fingerprintFromSignedPcm16(env, rawPcm, sampleRate, channelCount);
+}
+
+static void throwIfNoPending(JNIEnv *env, const char *className, const char *message) {
+    if (!env->ExceptionCheck()) {
+        jclass clazz = env->FindClass(className);
+        if (clazz) env->ThrowNew(clazz, message);
+    }
+}
+
+// A session borrows the Java array instead of copying it: the global ref keeps
+// the array alive and its elements, which ART hands out without a copy for
+// arrays this large, are only released in sessionFree.
+struct JniSession {
+    VibraSession *session;
+    jbyteArray pcm;
+    jbyte *pcmData;
+};
+
+static VibraSession *sessionOf(jlong handle) {
+    return reinterpret_cast<JniSession *>(handle)->session;
+}
+
+static void releaseSession(JNIEnv *env, JniSession *jniSession) {
+    if (jniSession->session != nullptr) vibra_session_free(jniSession->session);
+    if (jniSession->pcmData != nullptr) env->ReleaseByteArrayElements(jniSession->pcm, jniSession->pcmData, JNI_ABORT);
+    if (jniSession->pcm != nullptr) env->DeleteGlobalRef(jniSession->pcm);
+    delete jniSession;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionCreate(JNIEnv *env, jclass /*clazz*/, jbyteArray rawPcm,
+                                                                  jint sampleRate, jint channelCount) {
+    if (rawPcm == nullptr || sampleRate <= 0 || channelCount <= 0) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException",
+                         "rawPcm must not be null, sampleRate and channelCount must be positive");
+        return 0;
+    }
+    auto *jniSession = new JniSession{nullptr, nullptr, nullptr};
+    jniSession->pcm = static_cast<jbyteArray>(env->NewGlobalRef(rawPcm));
+    if (jniSession->pcm == nullptr) {
+        releaseSession(env, jniSession);
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "NewGlobalRef returned null");
+        return 0;
+    }
+    jniSession->pcmData = env->GetByteArrayElements(jniSession->pcm, nullptr);
+    if (jniSession->pcmData == nullptr) {
+        releaseSession(env, jniSession);
+        throwIfNoPending(env, "java/lang/RuntimeException", "GetByteArrayElements returned null");
+        return 0;
+    }
+    jniSession->session = vibra_session_create_borrowed(
+            reinterpret_cast<const char *>(jniSession->pcmData),
+            static_cast<int>(env->GetArrayLength(rawPcm)),
+            static_cast<int>(sampleRate), /*bits per sample*/16,
+            static_cast<int>(channelCount), /*is float*/0);
+    if (jniSession->session == nullptr) {
+        releaseSession(env, jniSession);
+        throwIfNoPending(env, "java/lang/RuntimeException", "Failed to create fingerprint session");
+        return 0;
+    }
+    return reinterpret_cast<jlong>(jniSession);
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionSetTimeout(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle,
+                                                                      jint timeoutMs) {
+    vibra_session_set_timeout_ms(sessionOf(handle),
+                                 static_cast<unsigned int>(timeoutMs < 0 ? 0 : timeoutMs));
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionCancel(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_session_cancel(sessionOf(handle));
+}
+
+// Cancellation and deadlines come back as their VibraStatus code so Kotlin can
+// tell them apart from real failures, which are thrown as RuntimeException.
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionStep(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jint maxFrames) {
+    auto *session = sessionOf(handle);
+    int status = vibra_session_step(session, static_cast<int>(maxFrames));
+    if (status == VIBRA_STATUS_ERROR) {
+        throwIfNoPending(env, "java/lang/RuntimeException", vibra_session_get_error(session));
+    }
+    return status;
+}
+
+extern "C"
+JNIEXPORT jstring JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionFingerprint(JNIEnv *env, jclass /*clazz*/, jlong handle) {
+    auto *session = sessionOf(handle);
+    Fingerprint *fp = vibra_session_get_fingerprint(session);
+    if (fp == nullptr) {
+        throwIfNoPending(env, "java/lang/RuntimeException", vibra_session_get_error(session));
+        return nullptr;
+    }
+    jstring result = env->NewStringUTF(fp->uri.c_str());
+    vibra_free_fingerprint(fp);
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate result string");
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_setStatsEnabled(JNIEnv * /*env*/, jclass /*clazz*/,
+                                                                    jboolean enabled) {
+    vibra_set_stats_enabled(enabled == JNI_TRUE ? 1 : 0);
+}
+
+// The VibraStats fields in declaration order, or null if the session collects none
+extern "C"
+JNIEXPORT jdoubleArray JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionStats(JNIEnv *env, jclass /*clazz*/, jlong handle) {
+    VibraStats stats;
+    if (vibra_session_get_stats(sessionOf(handle), &stats) != VIBRA_STATUS_DONE) {
+        return nullptr;
+    }
+    const jdouble values[14] = {stats.wav_parse_ms, stats.downsample_ms, stats.fft_ms, stats.spreading_ms,
+                                stats.recognition_ms, stats.encode_ms, stats.total_ms,
+                                static_cast<jdouble>(stats.frames_processed),
+                                static_cast<jdouble>(stats.peaks_per_band[0]),
+                                static_cast<jdouble>(stats.peaks_per_band[1]),
+                                static_cast<jdouble>(stats.peaks_per_band[2]),
+                                static_cast<jdouble>(stats.peaks_per_band[3]),
+                                static_cast<jdouble>(stats.heap_high_water_bytes),
+                                static_cast<jdouble>(stats.max_resident_bytes)};
+    jdoubleArray result = env->NewDoubleArray(14);
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate stats array");
+        return nullptr;
+    }
+    env->SetDoubleArrayRegion(result, 0, 14, values);
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_sessionFree(JNIEnv *env, jclass /*clazz*/, jlong handle) {
+    releaseSession(env, reinterpret_cast<JniSession *>(handle));
+}
+
+// Both return false with a Java exception pending on failure
+static bool stringFromJava(JNIEnv *env, jstring value, std::string *out) {
+    const char *chars = env->GetStringUTFChars(value, nullptr);
+    if (chars == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "GetStringUTFChars returned null");
+        return false;
+    }
+    out->assign(chars, env->GetStringUTFLength(value));
+    env->ReleaseStringUTFChars(value, chars);
+    return true;
+}
+
+static VibraSignature *signatureFromUri(JNIEnv *env, jstring uri) {
+    std::string chars;
+    if (!stringFromJava(env, uri, &chars)) {
+        return nullptr;
+    }
+    return vibra_signature_from_uri(chars.data(), static_cast<int>(chars.size()));
+}
+
+// The result is the duration in milliseconds followed by one
+// [band, fft pass number, magnitude, frequency bin] group per peak, which
+// keeps it to a single array copy instead of an object per peak.
+extern "C"
+JNIEXPORT jintArray JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_decodeSignature(JNIEnv *env, jclass /*clazz*/, jstring uri) {
+    if (uri == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "uri must not be null");
+        return nullptr;
+    }
+    VibraSignature *signature = signatureFromUri(env, uri);
+    if (signature == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Malformed signature URI");
+        return nullptr;
+    }
+
+    std::vector<VibraPeak> peaks(vibra_signature_get_peak_count(signature));
+    vibra_signature_get_peaks(signature, peaks.data(), static_cast<int>(peaks.size()));
+    std::vector<jint> values;
+    values.reserve(1 + 4 * peaks.size());
+    values.push_back(static_cast<jint>(vibra_signature_get_sample_ms(signature)));
+    vibra_signature_free(signature);
+    for (const auto &peak : peaks) {
+        values.push_back(peak.band);
+        values.push_back(static_cast<jint>(peak.fft_pass_number));
+        values.push_back(static_cast<jint>(peak.magnitude));
+        values.push_back(static_cast<jint>(peak.frequency_bin));
+    }
+
+    jintArray result = env->NewIntArray(static_cast<jsize>(values.size()));
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate peak array");
+        return nullptr;
+    }
+    env->SetIntArrayRegion(result, 0, static_cast<jsize>(values.size()), values.data());
+    return result;
+}
+
+// Returns [score, offset in microseconds, matched peaks]
+extern "C"
+JNIEXPORT jdoubleArray JNICALL
+Java_com_metrolist_music_recognition_VibraSignature_compareSignatures(JNIEnv *env, jclass /*clazz*/, jstring uriA,
+                                                                      jstring uriB) {
+    if (uriA == nullptr || uriB == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "uris must not be null");
+        return nullptr;
+    }
+    VibraSignature *a = signatureFromUri(env, uriA);
+    VibraSignature *b = a != nullptr ? signatureFromUri(env, uriB) : nullptr;
+    if (b == nullptr) {
+        vibra_signature_free(a);
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Malformed signature URI");
+        return nullptr;
+    }
+    VibraSimilarity similarity;
+    int status = vibra_compare_signatures(a, b, &similarity);
+    vibra_signature_free(a);
+    vibra_signature_free(b);
+    if (status != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Signatures have different sample rates");
+        return nullptr;
+    }
+    const jdouble values[3] = {similarity.score, static_cast<jdouble>(similarity.offset_us),
+                               static_cast<jdouble>(similarity.matched_peaks)};
+    jdoubleArray result = env->NewDoubleArray(3);
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate similarity array");
+        return nullptr;
+    }
+    env->SetDoubleArrayRegion(result, 0, 3, values);
+    return result;
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_indexOpen(JNIEnv *env, jclass /*clazz*/, jstring path) {
+    std::string pathChars;
+    if (path == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "path must not be null");
+        return 0;
+    }
+    if (!stringFromJava(env, path, &pathChars)) {
+        return 0;
+    }
+    VibraIndex *index = vibra_index_open(pathChars.c_str());
+    if (index == nullptr) {
+        throwIfNoPending(env, "java/io/IOException", "Missing or corrupt landmark index");
+        return 0;
+    }
+    return reinterpret_cast<jlong>(index);
+}
+
+// Returns [track id, offset ms, score, query landmarks], or null without a match
+extern "C"
+JNIEXPORT jintArray JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_indexQuery(JNIEnv *env, jclass /*clazz*/, jlong handle, jstring uri) {
+    if (uri == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "uri must not be null");
+        return nullptr;
+    }
+    VibraSignature *signature = signatureFromUri(env, uri);
+    if (signature == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Malformed signature URI");
+        return nullptr;
+    }
+    VibraMatch match;
+    int found = vibra_index_query(reinterpret_cast<VibraIndex *>(handle), signature, &match);
+    vibra_signature_free(signature);
+    if (found == VIBRA_STATUS_ERROR) {
+        throwIfNoPending(env, "java/lang/RuntimeException", "Landmark index query failed");
+        return nullptr;
+    }
+    if (found == 0) {
+        return nullptr;
+    }
+    const jint values[4] = {static_cast<jint>(match.track_id), match.offset_ms,
+                            static_cast<jint>(match.score), static_cast<jint>(match.query_landmarks)};
+    jintArray result = env->NewIntArray(4);
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate match array");
+        return nullptr;
+    }
+    env->SetIntArrayRegion(result, 0, 4, values);
+    return result;
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_indexTrackCount(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    return static_cast<jint>(vibra_index_get_track_count(reinterpret_cast<VibraIndex *>(handle)));
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_indexFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_index_free(reinterpret_cast<VibraIndex *>(handle));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderCreate(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return reinterpret_cast<jlong>(vibra_index_builder_create());
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderAddPcm16(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jint trackId, jbyteArray rawPcm,
+                                                                jint sampleRate, jint channelCount) {
+    if (rawPcm == nullptr || sampleRate <= 0 || channelCount <= 0) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException",
+                         "rawPcm must not be null, sampleRate and channelCount must be positive");
+        return;
+    }
+    jbyte *pcmData = env->GetByteArrayElements(rawPcm, nullptr);
+    if (pcmData == nullptr) {
+        throwIfNoPending(env, "java/lang/RuntimeException", "GetByteArrayElements returned null");
+        return;
+    }
+    auto *builder = reinterpret_cast<VibraIndexBuilder *>(handle);
+    int status = vibra_index_builder_add_pcm(builder, static_cast<unsigned int>(trackId),
+                                             reinterpret_cast<const char *>(pcmData),
+                                             static_cast<int>(env->GetArrayLength(rawPcm)),
+                                             static_cast<int>(sampleRate), /*bits per sample*/16,
+                                             static_cast<int>(channelCount), /*is float*/0);
+    env->ReleaseByteArrayElements(rawPcm, pcmData, JNI_ABORT);
+    if (status != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/RuntimeException", vibra_index_builder_get_error(builder));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderAddSignature(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                    jint trackId, jstring uri, jint offsetMs) {
+    if (uri == nullptr || offsetMs < 0) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException",
+                         "uri must not be null and offsetMs must not be negative");
+        return;
+    }
+    VibraSignature *signature = signatureFromUri(env, uri);
+    if (signature == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Malformed signature URI");
+        return;
+    }
+    auto *builder = reinterpret_cast<VibraIndexBuilder *>(handle);
+    int status = vibra_index_builder_add_signature(builder, static_cast<unsigned int>(trackId), signature,
+                                                   static_cast<unsigned int>(offsetMs));
+    vibra_signature_free(signature);
+    if (status != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/RuntimeException", vibra_index_builder_get_error(builder));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderAddIndex(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jlong indexHandle) {
+    auto *builder = reinterpret_cast<VibraIndexBuilder *>(handle);
+    if (vibra_index_builder_add_index(builder, reinterpret_cast<VibraIndex *>(indexHandle)) != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", vibra_index_builder_get_error(builder));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderWrite(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                             jstring path) {
+    std::string pathChars;
+    if (path == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "path must not be null");
+        return;
+    }
+    if (!stringFromJava(env, path, &pathChars)) {
+        return;
+    }
+    auto *builder = reinterpret_cast<VibraIndexBuilder *>(handle);
+    if (vibra_index_builder_write(builder, pathChars.c_str()) != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/io/IOException", vibra_index_builder_get_error(builder));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIndex_builderFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_index_builder_free(reinterpret_cast<VibraIndexBuilder *>(handle));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableCreate(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return reinterpret_cast<jlong>(vibra_lsh_table_create());
+}
+
+// Returns false with a Java exception pending for a malformed URI, and
+// without one for a signature too short to have landmarks
+static bool digestFromUri(JNIEnv *env, jstring uri, unsigned long long *digest) {
+    if (uri == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "uri must not be null");
+        return false;
+    }
+    VibraSignature *signature = signatureFromUri(env, uri);
+    if (signature == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "Malformed signature URI");
+        return false;
+    }
+    int status = vibra_signature_get_digest(signature, digest);
+    vibra_signature_free(signature);
+    return status == VIBRA_STATUS_DONE;
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableInsert(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                               jlong id, jstring uri) {
+    unsigned long long digest[VIBRA_DIGEST_SIZE];
+    if (!digestFromUri(env, uri, digest)) {
+        return JNI_FALSE;
+    }
+    int status = vibra_lsh_table_insert(reinterpret_cast<VibraLshTable *>(handle), id, digest);
+    return status == VIBRA_STATUS_DONE ? JNI_TRUE : JNI_FALSE;
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableRemove(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle,
+                                                               jlong id) {
+    return vibra_lsh_table_remove(reinterpret_cast<VibraLshTable *>(handle), id) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Returns the candidate ids, closest first
+extern "C"
+JNIEXPORT jlongArray JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableQuery(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                              jstring uri) {
+    auto *table = reinterpret_cast<VibraLshTable *>(handle);
+    unsigned long long digest[VIBRA_DIGEST_SIZE];
+    std::vector<long long> ids;
+    if (digestFromUri(env, uri, digest)) {
+        ids.resize(vibra_lsh_table_get_size(table));
+        ids.resize(vibra_lsh_table_query(table, digest, ids.data(), static_cast<int>(ids.size())));
+    } else if (env->ExceptionCheck()) {
+        return nullptr;
+    }
+    jlongArray result = env->NewLongArray(static_cast<jsize>(ids.size()));
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate id array");
+        return nullptr;
+    }
+    std::vector<jlong> values(ids.begin(), ids.end());
+    env->SetLongArrayRegion(result, 0, static_cast<jsize>(values.size()), values.data());
+    return result;
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableSize(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    return static_cast<jint>(vibra_lsh_table_get_size(reinterpret_cast<VibraLshTable *>(handle)));
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraLshTable_tableFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_lsh_table_free(reinterpret_cast<VibraLshTable *>(handle));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorCreate(JNIEnv *env, jclass /*clazz*/, jstring directory) {
+    std::string directoryChars;
+    if (directory == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "directory must not be null");
+        return 0;
+    }
+    if (!stringFromJava(env, directory, &directoryChars)) {
+        return 0;
+    }
+    return reinterpret_cast<jlong>(vibra_ingestor_create(directoryChars.c_str()));
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorBeginTrack(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                      jint trackId, jint sampleRate,
+                                                                      jint channelCount) {
+    auto *ingestor = reinterpret_cast<VibraIngestor *>(handle);
+    int status = vibra_ingestor_begin_track(ingestor, static_cast<unsigned int>(trackId),
+                                            static_cast<int>(sampleRate), /*bits per sample*/16,
+                                            static_cast<int>(channelCount), /*is float*/0);
+    if (status != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", vibra_ingestor_get_error(ingestor));
+    }
+}
+
+// Returns VIBRA_STATUS_DONE, VIBRA_STATUS_PENDING while fed audio is still queued, or
+// VIBRA_STATUS_DROPPED
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorFeed(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jbyteArray rawPcm, jint length, jint budgetUs) {
+    if (rawPcm == nullptr || length < 0 || length > env->GetArrayLength(rawPcm) || budgetUs < 0) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException",
+                         "rawPcm must hold length bytes and budgetUs must not be negative");
+        return VIBRA_STATUS_ERROR;
+    }
+    jbyte *pcmData = env->GetByteArrayElements(rawPcm, nullptr);
+    if (pcmData == nullptr) {
+        throwIfNoPending(env, "java/lang/RuntimeException", "GetByteArrayElements returned null");
+        return VIBRA_STATUS_ERROR;
+    }
+    auto *ingestor = reinterpret_cast<VibraIngestor *>(handle);
+    int status = vibra_ingestor_feed(ingestor, reinterpret_cast<const char *>(pcmData),
+                                     static_cast<int>(length), static_cast<int>(budgetUs));
+    env->ReleaseByteArrayElements(rawPcm, pcmData, JNI_ABORT);
+    if (status == VIBRA_STATUS_ERROR) {
+        throwIfNoPending(env, "java/lang/RuntimeException", vibra_ingestor_get_error(ingestor));
+        return VIBRA_STATUS_ERROR;
+    }
+    return static_cast<jint>(status);
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorEndTrack(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_ingestor_end_track(reinterpret_cast<VibraIngestor *>(handle));
+}
+
+// The ids of the tracks written, the others were played too briefly
+extern "C"
+JNIEXPORT jintArray JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorCommit(JNIEnv *env, jclass /*clazz*/, jlong handle) {
+    auto *ingestor = reinterpret_cast<VibraIngestor *>(handle);
+    int written = vibra_ingestor_commit(ingestor);
+    if (written == VIBRA_STATUS_ERROR) {
+        throwIfNoPending(env, "java/io/IOException", vibra_ingestor_get_commit_error(ingestor));
+        return nullptr;
+    }
+    std::vector<unsigned int> ids(static_cast<std::size_t>(written));
+    vibra_ingestor_get_committed_ids(ingestor, ids.data(), written);
+    jintArray result = env->NewIntArray(static_cast<jsize>(written));
+    if (result == nullptr) {
+        throwIfNoPending(env, "java/lang/OutOfMemoryError", "Failed to allocate id array");
+        return nullptr;
+    }
+    if (written > 0) {
+        env->SetIntArrayRegion(result, 0, static_cast<jsize>(written),
+                               reinterpret_cast<const jint *>(ids.data()));
+    }
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraIngestor_ingestorFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_ingestor_free(reinterpret_cast<VibraIngestor *>(handle));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packOpen(JNIEnv *env, jclass /*clazz*/, jstring path) {
+    std::string pathChars;
+    if (path == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "path must not be null");
+        return 0;
+    }
+    if (!stringFromJava(env, path, &pathChars)) {
+        return 0;
+    }
+    VibraSignaturePack *pack = vibra_signature_pack_open(pathChars.c_str());
+    if (pack == nullptr) {
+        throwIfNoPending(env, "java/io/IOException", "Missing or corrupt signature pack");
+        return 0;
+    }
+    return reinterpret_cast<jlong>(pack);
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packSize(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    return static_cast<jint>(vibra_signature_pack_get_size(reinterpret_cast<VibraSignaturePack *>(handle)));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packKey(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jint index) {
+    auto *pack = reinterpret_cast<VibraSignaturePack *>(handle);
+    if (index < 0 || index >= vibra_signature_pack_get_size(pack)) {
+        throwIfNoPending(env, "java/lang/IndexOutOfBoundsException", "Signature index out of range");
+        return 0;
+    }
+    return static_cast<jlong>(vibra_signature_pack_get_key(pack, static_cast<int>(index)));
+}
+
+extern "C"
+JNIEXPORT jint JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packFind(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle,
+                                                                 jlong key) {
+    return static_cast<jint>(vibra_signature_pack_find(reinterpret_cast<VibraSignaturePack *>(handle),
+                                                       static_cast<unsigned long long>(key)));
+}
+
+extern "C"
+JNIEXPORT jstring JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packUri(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                jint index) {
+    auto *pack = reinterpret_cast<VibraSignaturePack *>(handle);
+    if (index < 0 || index >= vibra_signature_pack_get_size(pack)) {
+        throwIfNoPending(env, "java/lang/IndexOutOfBoundsException", "Signature index out of range");
+        return nullptr;
+    }
+    VibraSignature *signature = vibra_signature_pack_get_signature(pack, static_cast<int>(index));
+    Fingerprint *fingerprint = signature != nullptr ? vibra_signature_to_fingerprint(signature) : nullptr;
+    vibra_signature_free(signature);
+    if (fingerprint == nullptr) {
+        throwIfNoPending(env, "java/io/IOException", "Corrupt signature pack record");
+        return nullptr;
+    }
+    jstring result = env->NewStringUTF(vibra_get_uri_from_fingerprint(fingerprint));
+    vibra_free_fingerprint(fingerprint);
+    return result;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_packFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_signature_pack_free(reinterpret_cast<VibraSignaturePack *>(handle));
+}
+
+extern "C"
+JNIEXPORT jlong JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerCreate(JNIEnv * /*env*/, jclass /*clazz*/) {
+    return reinterpret_cast<jlong>(vibra_signature_pack_writer_create());
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerAdd(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                  jlong key, jstring uri) {
+    std::string uriChars;
+    if (uri == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "uri must not be null");
+        return;
+    }
+    if (!stringFromJava(env, uri, &uriChars)) {
+        return;
+    }
+    auto *writer = reinterpret_cast<VibraSignaturePackWriter *>(handle);
+    if (vibra_signature_pack_writer_add(writer, static_cast<unsigned long long>(key), uriChars.data(),
+                                        static_cast<int>(uriChars.size())) != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", vibra_signature_pack_writer_get_error(writer));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerAddPack(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                      jlong packHandle) {
+    auto *writer = reinterpret_cast<VibraSignaturePackWriter *>(handle);
+    if (vibra_signature_pack_writer_add_pack(writer, reinterpret_cast<VibraSignaturePack *>(packHandle)) !=
+        VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/io/IOException", vibra_signature_pack_writer_get_error(writer));
+    }
+}
+
+extern "C"
+JNIEXPORT jboolean JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerRemove(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle,
+                                                                     jlong key) {
+    return vibra_signature_pack_writer_remove(reinterpret_cast<VibraSignaturePackWriter *>(handle),
+                                              static_cast<unsigned long long>(key)) ? JNI_TRUE : JNI_FALSE;
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerWrite(JNIEnv *env, jclass /*clazz*/, jlong handle,
+                                                                    jstring path) {
+    std::string pathChars;
+    if (path == nullptr) {
+        throwIfNoPending(env, "java/lang/IllegalArgumentException", "path must not be null");
+        return;
+    }
+    if (!stringFromJava(env, path, &pathChars)) {
+        return;
+    }
+    auto *writer = reinterpret_cast<VibraSignaturePackWriter *>(handle);
+    if (vibra_signature_pack_writer_write(writer, pathChars.c_str()) != VIBRA_STATUS_DONE) {
+        throwIfNoPending(env, "java/io/IOException", vibra_signature_pack_writer_get_error(writer));
+    }
+}
+
+extern "C"
+JNIEXPORT void JNICALL
+Java_com_metrolist_music_recognition_VibraSignaturePack_writerFree(JNIEnv * /*env*/, jclass /*clazz*/, jlong handle) {
+    vibra_signature_pack_writer_free(reinterpret_cast<VibraSignaturePackWriter *>(handle));
+}
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Generates lib/audio/resampler_coefficients.h.
+
+Each table is a Kaiser-windowed sinc prototype for a rational L/M resampler
+from one of the common input rates to 16 kHz, split into L polyphase branches
+of K taps. Branches are stored reversed so the inner loop is a contiguous dot
+product over the input history. The design rules must stay in sync with
+Resampler::designCoefficients() in lib/audio/resampler.cpp.
+
+usage: gen_resampler_coefficients.py > ../lib/audio/resampler_coefficients.h
+"""
+
+import math
+
+OUTPUT_RATE = 16000
+INPUT_RATES = [8000, 11025, 22050, 32000, 44100, 48000, 96000]
+STOPBAND_ATTENUATION_DB = 70.0
+VALUES_PER_LINE = 6
+
+
+def bessel_i0(x):
+    total, term, k = 1.0, 1.0, 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def design(input_rate):
+    g = math.gcd(input_rate, OUTPUT_RATE)
+    up, down = OUTPUT_RATE // g, input_rate // g
+
+    # Pass band ends at 3/8 of the lower rate and the stop band starts where
+    # its alias folds back onto the pass band edge.
+    min_rate = min(input_rate, OUTPUT_RATE)
+    cutoff = 0.5 * min_rate
+    transition = 0.25 * min_rate
+    beta = 0.1102 * (STOPBAND_ATTENUATION_DB - 8.7)
+    taps = math.ceil((STOPBAND_ATTENUATION_DB - 7.95) /
+                     (2.285 * 2.0 * math.pi * transition / input_rate))
+    taps = (taps + 3) // 4 * 4
+
+    # Centre the prototype on a whole branch index so every output lands
+    # exactly on its sampling instant.
+    length = up * taps
+    center = length // 2
+    fc = cutoff / (input_rate * up)
+    proto = []
+    for n in range(length):
+        t = n - center
+        sinc = 2.0 * fc if t == 0 else math.sin(2.0 * math.pi * fc * t) / (math.pi * t)
+        ratio = (n - center) / center
+        window = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - ratio * ratio))) / bessel_i0(beta)
+        proto.append(sinc * window)
+
+    table = []
+    for phase in range(up):
+        branch = [proto[phase + k * up] for k in range(taps)]
+        gain = sum(branch)
+        table.extend(c / gain for c in reversed(branch))
+    return up, down, taps, table
+
+
+def main():
+    print("// Generated by scripts/gen_resampler_coefficients.py. Do not edit.")
+    print("#ifndef LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_")
+    print("#define LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_")
+    print()
+    print("#include <cstdint>")
+    print()
+    print("struct ResamplerCoefficients")
+    print("{")
+    print("    std::uint32_t input_rate;")
+    print("    std::uint32_t up;   // L: number of polyphase branches")
+    print("    std::uint32_t down; // M: input step per output, in branches")
+    print("    std::uint32_t taps; // K: taps per branch, multiple of 4")
+    print("    const float *table; // L * K, each branch reversed")
+    print("};")
+    entries = []
+    for rate in INPUT_RATES:
+        up, down, taps, table = design(rate)
+        name = "RESAMPLER_TABLE_%d" % rate
+        entries.append((rate, up, down, taps, name))
+        print()
+        print("alignas(16) constexpr float %s[] = {" % name)
+        for i in range(0, len(table), VALUES_PER_LINE):
+            chunk = table[i:i + VALUES_PER_LINE]
+            print("    " + " ".join("%.9ef," % c for c in chunk))
+        print("};")
+    print()
+    print("constexpr ResamplerCoefficients RESAMPLER_COEFFICIENTS[] = {")
+    for rate, up, down, taps, name in entries:
+        print("    {%d, %d, %d, %d, %s}," % (rate, up, down, taps, name))
+    print("};")
+    print()
+    print("#endif // LIB_AUDIO_RESAMPLER_COEFFICIENTS_H_")
+
+
+if __name__ == "__main__":
+    main()
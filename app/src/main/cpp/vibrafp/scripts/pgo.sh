@@ -0,0 +1,148 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+########################################################
+# pgo.sh
+# Profile-guided optimisation of the fingerprint library, with before/after numbers.
+#
+# For the host, or for each Android ABI on a device reached through adb:
+#  1. builds the tools without PGO, records the golden corpus and benchmarks them
+#  2. builds them with -DVIBRA_PGO=GENERATE and runs the training workload: the golden
+#     corpus (60 WAV cases through the WAV entry point) and the end-to-end benchmarks
+#  3. merges the profile and rebuilds with -DVIBRA_PGO=USE
+#  4. checks the golden corpus is still bit-exact and benchmarks against step 1
+#
+# Profiles end up in <OUT>/<abi>.profdata (Clang) or <OUT>/<abi>/ (GCC, host only).
+# The app's release build uses them with ./gradlew assembleRelease -PvibraPgoDir=<OUT>.
+#
+# Usage:
+#   ./pgo.sh                                    # host, system compiler
+#   ./pgo.sh --ndk /path/to/ndk --abis arm64-v8a,armeabi-v7a
+########################################################
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+LIB_DIR="$(realpath "${SCRIPT_DIR}/../lib")"
+OUT_DIR="$(realpath -m "${SCRIPT_DIR}/../pgo")"
+WORK_DIR="$(pwd)/.build-pgo"
+NDK_DIR="${ANDROID_NDK_HOME:-}"
+USE_NDK=0
+API="${API:-26}"
+ABIS=("arm64-v8a" "armeabi-v7a" "x86_64" "x86")
+REPEAT=20
+DEVICE_DIR="/data/local/tmp/vibra-pgo"
+
+usage() {
+  cat <<EOF
+Usage: $0 [options]
+
+Options:
+  --ndk PATH         Profile on a device for the Android ABIs, with this NDK
+  --abis a,b,c       Comma-separated subset of: ${ABIS[*]}
+  --api N            Android API level (default: ${API})
+  --out PATH         Profile directory (default: ${OUT_DIR})
+  --work PATH        Build and result directory (default: ${WORK_DIR})
+  --repeat N         Timed calls per benchmark case (default: ${REPEAT})
+  --help             Show this help
+EOF
+  exit 1
+}
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --ndk) NDK_DIR="$2"; USE_NDK=1; shift 2;;
+    --abis) IFS=',' read -r -a ABIS <<< "$2"; shift 2;;
+    --api) API="$2"; shift 2;;
+    --out) OUT_DIR="$(realpath -m "$2")"; shift 2;;
+    --work) WORK_DIR="$(realpath -m "$2")"; shift 2;;
+    --repeat) REPEAT="$2"; shift 2;;
+    --help|-h) usage;;
+    *) echo "Unknown argument: $1"; usage;;
+  esac
+done
+
+mkdir -p "${OUT_DIR}" "${WORK_DIR}"
+CPU_COUNT="$(nproc || echo 1)"
+
+# configure <build dir> <abi or empty> <cmake args...>
+configure() {
+  local build_dir="$1" abi="$2"
+  shift 2
+  local args=(-S "${LIB_DIR}" -B "${build_dir}" -DCMAKE_BUILD_TYPE=Release
+              -DVIBRA_BUILD_TOOLS=ON -DVIBRA_BUILD_JNI=OFF -DVIBRA_PGO_DIR="${OUT_DIR}")
+  if [[ -n "${abi}" ]]; then
+    args+=(-DCMAKE_TOOLCHAIN_FILE="${NDK_DIR}/build/cmake/android.toolchain.cmake"
+           -DANDROID_ABI="${abi}" -DANDROID_PLATFORM="android-${API}")
+  fi
+  cmake "${args[@]}" "$@" >/dev/null
+  cmake --build "${build_dir}" -j"${CPU_COUNT}" --target vibra_bench vibra_golden
+}
+
+# run <build dir> <abi or empty> <tool> <args...>, paths relative to the result dir
+run() {
+  local build_dir="$1" abi="$2" tool="$3"
+  shift 3
+  if [[ -z "${abi}" ]]; then
+    (cd "${RESULT_DIR}" && LLVM_PROFILE_FILE="${RAW_DIR}/%m.profraw" \
+      "${build_dir}/${tool}" "$@")
+  else
+    adb push "${build_dir}/${tool}" "${DEVICE_DIR}/${tool}" >/dev/null
+    adb shell "cd ${DEVICE_DIR} && LLVM_PROFILE_FILE=${DEVICE_DIR}/raw/%m.profraw ./${tool} $*"
+  fi
+}
+
+# fetch <file>, copies a result file off the device
+fetch() {
+  if [[ -n "${ABI}" ]]; then
+    adb pull "${DEVICE_DIR}/$1" "${RESULT_DIR}/$1" >/dev/null
+  fi
+}
+
+if [[ "${USE_NDK}" -eq 1 ]]; then
+  NDK_DIR="$(realpath "${NDK_DIR}")"
+  LLVM_PROFDATA="${NDK_DIR}/toolchains/llvm/prebuilt/linux-x86_64/bin/llvm-profdata"
+  TARGETS=("${ABIS[@]}")
+else
+  LLVM_PROFDATA="$(command -v llvm-profdata || true)"
+  TARGETS=("")
+fi
+
+for ABI in "${TARGETS[@]}"; do
+  NAME="${ABI:-$(uname -m)}"
+  RESULT_DIR="${WORK_DIR}/${NAME}"
+  RAW_DIR="${RESULT_DIR}/raw"
+  BASE_BUILD="${WORK_DIR}/build-${NAME}-base"
+  PGO_BUILD="${WORK_DIR}/build-${NAME}-pgo"
+  rm -rf "${RESULT_DIR}" "${OUT_DIR}/${NAME}" "${OUT_DIR}/${NAME}.profdata" "${OUT_DIR}/${NAME}-raw"
+  mkdir -p "${RESULT_DIR}/golden" "${RAW_DIR}"
+  if [[ -n "${ABI}" ]]; then
+    adb shell "rm -rf ${DEVICE_DIR} && mkdir -p ${DEVICE_DIR}/golden ${DEVICE_DIR}/raw"
+  fi
+  echo ">>> ${NAME}: baseline"
+  configure "${BASE_BUILD}" "${ABI}" -DVIBRA_PGO=OFF
+  run "${BASE_BUILD}" "${ABI}" vibra_golden record golden
+  run "${BASE_BUILD}" "${ABI}" vibra_bench --repeat "${REPEAT}" --json before.json
+  fetch before.json
+
+  echo ">>> ${NAME}: training"
+  configure "${PGO_BUILD}" "${ABI}" -DVIBRA_PGO=GENERATE
+  run "${PGO_BUILD}" "${ABI}" vibra_golden check golden
+  run "${PGO_BUILD}" "${ABI}" vibra_bench --repeat 3 --filter end_to_end >/dev/null
+  if [[ -n "${ABI}" ]]; then
+    adb pull "${DEVICE_DIR}/raw/." "${RAW_DIR}" >/dev/null
+  fi
+  # GCC wrote its profile in place, Clang's raw profiles need merging
+  if compgen -G "${RAW_DIR}/*.profraw" >/dev/null; then
+    "${LLVM_PROFDATA}" merge -o "${OUT_DIR}/${NAME}.profdata" "${RAW_DIR}"
+  fi
+
+  echo ">>> ${NAME}: optimised"
+  configure "${PGO_BUILD}" "${ABI}" -DVIBRA_PGO=USE
+  run "${PGO_BUILD}" "${ABI}" vibra_golden check golden
+  # Exits with status 2 when a case got slower, which is a result here
+  run "${PGO_BUILD}" "${ABI}" vibra_bench --repeat "${REPEAT}" --json after.json \
+    --baseline before.json | tee "${RESULT_DIR}/comparison.txt" || true
+  fetch after.json
+  echo "Results for ${NAME} in ${RESULT_DIR}"
+done
+
+echo "PGO profiles: ${OUT_DIR}"
@@ -0,0 +1,228 @@
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "test.h"
+#include "utils/base64.h"
+#include "utils/cpu_features.h"
+
+namespace
+{
+// Longer than a few blocks of every vectorized kernel, so that each length
+// mixes vector blocks, the scalar tail and padding
+constexpr std::size_t MAX_LENGTH = 200;
+constexpr std::size_t MAX_MISALIGNMENT = 16;
+constexpr int ROUNDS_PER_LENGTH = 4;
+
+// Characters that are never valid inside a group of standard base64
+const char INVALID_CHARS[] = {'-', '_', ' ', '\n', '\0', '@', '[', '`', '{', '.',
+                              ':', '\x7f', '\x80', '\xc3', '\xff'};
+
+// Holds `data` at `misalignment` bytes into a buffer that ends with it, so
+// that a kernel reading past the end trips the address sanitizer
+class Placed
+{
+public:
+    Placed(const std::string &data, std::size_t misalignment)
+        : storage_(misalignment + data.size()), misalignment_(misalignment)
+    {
+        if (!data.empty())
+        {
+            std::memcpy(&storage_[misalignment], data.data(), data.size());
+        }
+    }
+    const char *data() const
+    {
+        return storage_.data() + misalignment_;
+    }
+    std::size_t size() const
+    {
+        return storage_.size() - misalignment_;
+    }
+
+private:
+    std::vector<char> storage_;
+    std::size_t misalignment_;
+};
+
+// The kernel picked for this CPU, which may be the portable one
+class DispatchedKernels
+{
+public:
+    DispatchedKernels() : was_forced_(cpu::IsScalarForced())
+    {
+        cpu::SetScalarForced(false);
+    }
+    ~DispatchedKernels()
+    {
+        cpu::SetScalarForced(was_forced_);
+    }
+
+private:
+    bool was_forced_;
+};
+
+std::string encodeScalar(const std::string &bytes)
+{
+    std::string out(base64::encoded_size(bytes.size()), '\0');
+    base64::encode_scalar(bytes.data(), bytes.size(), &out[0]);
+    return out;
+}
+
+struct Decoded
+{
+    bool valid;
+    std::string bytes;
+};
+
+Decoded decodeWith(bool scalar, const std::string &encoded, std::size_t misalignment)
+{
+    const Placed in(encoded, misalignment);
+    std::vector<char> out(base64::decoded_max_size(in.size()) + 1);
+    std::size_t size = 0;
+    const bool valid = scalar ? base64::decode_scalar(in.data(), in.size(), out.data(), &size)
+                              : base64::decode(in.data(), in.size(), out.data(), &size);
+    return Decoded{valid, valid ? std::string(out.data(), size) : std::string()};
+}
+
+// Both decoders agree on `encoded`, and reject it if `must_fail`
+void checkDecodersAgree(const std::string &encoded, std::size_t misalignment, bool must_fail)
+{
+    const Decoded scalar = decodeWith(true, encoded, misalignment);
+    const Decoded dispatched = decodeWith(false, encoded, misalignment);
+    if (!CHECK_EQ(dispatched.valid, scalar.valid) || !CHECK_EQ(dispatched.bytes, scalar.bytes))
+    {
+        test::Fail(__FILE__, __LINE__, "decoders disagree on " + test::Describe(encoded));
+    }
+    if (must_fail && scalar.valid)
+    {
+        test::Fail(__FILE__, __LINE__, "accepted " + test::Describe(encoded));
+    }
+}
+
+std::string randomBytes(std::mt19937 &random, std::size_t size)
+{
+    std::string bytes(size, '\0');
+    for (auto &byte : bytes)
+    {
+        byte = static_cast<char>(random() & 0xff);
+    }
+    return bytes;
+}
+} // namespace
+
+TEST(base64, known_vectors)
+{
+    // RFC 4648, section 10
+    const char *const vectors[][2] = {
+        {"", ""},         {"f", "Zg=="},         {"fo", "Zm8="},        {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="}, {"fooba", "Zm9vYmE="}, {"foobar", "Zm9vYmFy"},
+    };
+    DispatchedKernels dispatched;
+    for (const auto &vector : vectors)
+    {
+        const std::string bytes = vector[0];
+        CHECK_EQ(base64::encode(bytes.data(), bytes.size()), vector[1]);
+        CHECK_EQ(encodeScalar(bytes), vector[1]);
+        std::string decoded;
+        CHECK(base64::decode(vector[1], std::strlen(vector[1]), &decoded));
+        CHECK_EQ(decoded, bytes);
+    }
+}
+
+TEST(base64, vectorized_matches_scalar)
+{
+    DispatchedKernels dispatched;
+    std::mt19937 random(33);
+    for (std::size_t length = 0; length <= MAX_LENGTH; ++length)
+    {
+        for (int round = 0; round < ROUNDS_PER_LENGTH; ++round)
+        {
+            const std::string bytes = randomBytes(random, length);
+            const std::size_t misalignment = random() % MAX_MISALIGNMENT;
+            const Placed in(bytes, misalignment);
+
+            std::string encoded(base64::encoded_size(length), '\0');
+            base64::encode(in.data(), in.size(), &encoded[0]);
+            const std::string expected = encodeScalar(bytes);
+            if (!CHECK_EQ(encoded, expected))
+            {
+                continue;
+            }
+            const Decoded decoded = decodeWith(false, encoded, random() % MAX_MISALIGNMENT);
+            CHECK(decoded.valid);
+            CHECK_EQ(decoded.bytes, bytes);
+        }
+    }
+}
+
+TEST(base64, corrupt_input_is_rejected_alike)
+{
+    DispatchedKernels dispatched;
+    std::mt19937 random(34);
+    for (std::size_t length = 1; length <= MAX_LENGTH; ++length)
+    {
+        const std::string encoded = encodeScalar(randomBytes(random, length));
+        for (int round = 0; round < ROUNDS_PER_LENGTH; ++round)
+        {
+            std::string corrupt = encoded;
+            const std::size_t position = random() % corrupt.size();
+            corrupt[position] = INVALID_CHARS[random() % sizeof(INVALID_CHARS)];
+            checkDecodersAgree(corrupt, random() % MAX_MISALIGNMENT, true);
+
+            // Padding anywhere but at the end of the last group
+            std::string padded = encoded;
+            const std::size_t pad_position = random() % padded.size();
+            padded[pad_position] = '=';
+            checkDecodersAgree(padded, random() % MAX_MISALIGNMENT,
+                               pad_position + 2 < padded.size());
+        }
+    }
+}
+
+TEST(base64, padding_and_truncation)
+{
+    DispatchedKernels dispatched;
+    std::mt19937 random(35);
+    for (std::size_t length = 1; length <= MAX_LENGTH; ++length)
+    {
+        const std::string bytes = randomBytes(random, length);
+        const std::string encoded = encodeScalar(bytes);
+        CHECK_EQ(encoded.size() % 4, 0u);
+        CHECK_EQ(encoded[encoded.size() - 1] == '=', length % 3 != 0);
+        CHECK_EQ(encoded[encoded.size() - 2] == '=', length % 3 == 1);
+
+        // Not a whole number of groups
+        for (std::size_t cut = 1; cut < 4 && cut <= encoded.size(); ++cut)
+        {
+            checkDecodersAgree(encoded.substr(0, encoded.size() - cut), 0, true);
+        }
+        // Whole groups of a longer input decode to its prefix
+        if (encoded.size() > 4)
+        {
+            const std::string prefix = encoded.substr(0, encoded.size() - 4);
+            checkDecodersAgree(prefix, random() % MAX_MISALIGNMENT, false);
+            if (prefix.find('=') == std::string::npos)
+            {
+                const Decoded decoded = decodeWith(false, prefix, 0);
+                CHECK(decoded.valid);
+                CHECK_EQ(decoded.bytes, bytes.substr(0, prefix.size() / 4 * 3));
+            }
+        }
+        // Padding a group that needs none
+        if (length % 3 == 0)
+        {
+            checkDecodersAgree(encoded + "====", 0, true);
+            checkDecodersAgree(encoded + "A===", 0, true);
+        }
+    }
+
+    for (const char *malformed : {"====", "A===", "AB=C", "A=B=", "=AAA", "AA==AAAA"})
+    {
+        checkDecodersAgree(malformed, 0, true);
+    }
+    std::string out = "kept";
+    CHECK(!base64::decode("Zm9", 3, &out));
+    CHECK(out.empty());
+}
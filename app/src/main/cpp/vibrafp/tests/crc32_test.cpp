@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "test.h"
+#include "utils/cpu_features.h"
+#include "utils/crc32.h"
+
+namespace
+{
+// Covers the lengths below the 64 byte PCLMUL cutoff, the cutoff itself and
+// a few folds past it, each with every 16 byte tail
+constexpr std::size_t MAX_LENGTH = 300;
+constexpr std::size_t MAX_MISALIGNMENT = 16;
+
+// The implementation picked for this CPU, which may be the portable one
+class DispatchedCrc
+{
+public:
+    DispatchedCrc() : was_forced_(cpu::IsScalarForced())
+    {
+        cpu::SetScalarForced(false);
+    }
+    ~DispatchedCrc()
+    {
+        cpu::SetScalarForced(was_forced_);
+    }
+
+private:
+    bool was_forced_;
+};
+} // namespace
+
+TEST(crc32, known_vectors)
+{
+    const char *const check = "123456789";
+    DispatchedCrc dispatched;
+    CHECK_EQ(crc32::crc32(check, 9), 0xCBF43926u);
+    CHECK_EQ(crc32::crc32_software(check, 9), 0xCBF43926u);
+    CHECK_EQ(crc32::crc32(check, 0), 0u);
+    CHECK_EQ(crc32::crc32_software(check, 0), 0u);
+
+    const std::string zeros(32, '\0');
+    CHECK_EQ(crc32::crc32(zeros.data(), zeros.size()), 0x190A55ADu);
+}
+
+TEST(crc32, dispatched_matches_software)
+{
+    DispatchedCrc dispatched;
+    std::mt19937 random(36);
+    std::vector<char> bytes(MAX_LENGTH);
+    for (auto &byte : bytes)
+    {
+        byte = static_cast<char>(random() & 0xff);
+    }
+    for (std::size_t misalignment = 0; misalignment < MAX_MISALIGNMENT; ++misalignment)
+    {
+        for (std::size_t length = 0; length <= MAX_LENGTH; ++length)
+        {
+            // Ends with the data, so that reading past it trips the address
+            // sanitizer
+            std::vector<char> storage(misalignment + length);
+            if (length > 0)
+            {
+                std::memcpy(&storage[misalignment], bytes.data(), length);
+            }
+            const char *data = storage.data() + misalignment;
+            if (!CHECK_EQ(crc32::crc32(data, length), crc32::crc32_software(data, length)))
+            {
+                test::Fail(__FILE__, __LINE__,
+                           "length " + std::to_string(length) + " at misalignment " +
+                               std::to_string(misalignment));
+            }
+        }
+    }
+}
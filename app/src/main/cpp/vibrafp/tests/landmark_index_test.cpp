@@ -0,0 +1,206 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "match/landmark_index.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+
+namespace
+{
+constexpr double TRACK_SECONDS = 40.0;
+constexpr double QUERY_SECONDS = 8.0;
+constexpr std::uint32_t PASSES_PER_SECOND = 16000 / 128;
+
+// Fields of IndexFileHeader, see landmark_index.cpp
+constexpr std::size_t HEADER_SIZE = 48;
+constexpr std::size_t VERSION_OFFSET = 8;
+constexpr std::size_t KEY_COUNT_OFFSET = 16;
+constexpr std::size_t BUCKET_BITS_OFFSET = 24;
+
+std::uint32_t load32(const std::string &data, std::size_t offset)
+{
+    std::uint32_t value;
+    std::memcpy(&value, data.data() + offset, sizeof(value));
+    return value;
+}
+
+void store32(std::string *data, std::size_t offset, std::uint32_t value)
+{
+    std::memcpy(&(*data)[offset], &value, sizeof(value));
+}
+
+std::vector<double> track(std::uint32_t seed)
+{
+    return synthetic::Music(16000, TRACK_SECONDS, seed);
+}
+
+// Three tracks, ids 10 + seed
+void writeIndex(const std::string &path)
+{
+    LandmarkIndexBuilder builder;
+    for (std::uint32_t seed = 1; seed <= 3; ++seed)
+    {
+        builder.AddSignature(10 + seed, test::SignatureOf(track(seed)));
+    }
+    builder.Write(path);
+}
+
+bool nearOffset(std::int32_t offset_passes, double seconds)
+{
+    return std::abs(offset_passes - static_cast<std::int32_t>(seconds * PASSES_PER_SECOND)) <= 1;
+}
+} // namespace
+
+TEST(landmark_index, finds_track_and_offset)
+{
+    test::TempDir dir;
+    writeIndex(dir.File("tracks.vli"));
+    const LandmarkIndex index = LandmarkIndex::Open(dir.File("tracks.vli"));
+    CHECK_EQ(index.track_count(), 3u);
+    CHECK(index.hash_count() > 0u);
+
+    for (std::uint32_t seed = 1; seed <= 3; ++seed)
+    {
+        const std::vector<double> audio = track(seed);
+        for (double start : {0.0, 13.0, TRACK_SECONDS - QUERY_SECONDS})
+        {
+            const MatchResult result =
+                index.Query(test::SignatureOf(test::Excerpt(audio, start, QUERY_SECONDS)));
+            CHECK(result.found);
+            CHECK_EQ(result.track_id, 10 + seed);
+            if (!CHECK(nearOffset(result.offset_passes, start)))
+            {
+                test::Fail(__FILE__, __LINE__,
+                           "offset " + test::Describe(result.offset_passes) + " for " +
+                               test::Describe(start) + " s");
+            }
+            CHECK(result.score <= result.query_landmarks);
+        }
+    }
+}
+
+TEST(landmark_index, survives_noise_and_gain)
+{
+    test::TempDir dir;
+    writeIndex(dir.File("tracks.vli"));
+    const LandmarkIndex index = LandmarkIndex::Open(dir.File("tracks.vli"));
+
+    const std::vector<double> excerpt = test::Excerpt(track(2), 21.0, QUERY_SECONDS);
+    const std::vector<double> recording =
+        synthetic::Mix(excerpt, 0.5, synthetic::Noise(16000, QUERY_SECONDS, 9), 0.05);
+    const MatchResult result = index.Query(test::SignatureOf(recording));
+    CHECK(result.found);
+    CHECK_EQ(result.track_id, 12u);
+    CHECK(nearOffset(result.offset_passes, 21.0));
+}
+
+TEST(landmark_index, misses_unrelated_audio)
+{
+    test::TempDir dir;
+    writeIndex(dir.File("tracks.vli"));
+    const LandmarkIndex index = LandmarkIndex::Open(dir.File("tracks.vli"));
+
+    const std::vector<std::vector<double>> unrelated = {
+        synthetic::Noise(16000, QUERY_SECONDS, 78),
+        synthetic::Chirp(16000, QUERY_SECONDS, 200.0, 4000.0),
+        synthetic::Mix(synthetic::Tone(16000, QUERY_SECONDS, 523.0), 0.5,
+                       synthetic::Tone(16000, QUERY_SECONDS, 659.0), 0.5),
+    };
+    for (const auto &audio : unrelated)
+    {
+        CHECK(!index.Query(test::SignatureOf(audio)).found);
+    }
+    // An empty query votes for nothing
+    CHECK(!index.Query(std::vector<Landmark>()).found);
+
+    // Another song of the same generator, whose 36 notes fall on the same
+    // quarter second grid, shares a few landmarks by chance. A true match
+    // gets most of them.
+    const Signature other_song = test::SignatureOf(synthetic::Music(16000, QUERY_SECONDS, 77));
+    const MatchResult coincidence = index.Query(other_song);
+    const MatchResult match =
+        index.Query(test::SignatureOf(test::Excerpt(track(1), 3.0, QUERY_SECONDS)));
+    CHECK(coincidence.score * 10 < coincidence.query_landmarks);
+    CHECK(match.score * 10 > match.query_landmarks * 8);
+}
+
+TEST(landmark_index, rejects_corrupt_files)
+{
+    test::TempDir dir;
+    const std::string path = dir.File("tracks.vli");
+    writeIndex(path);
+    const std::string valid = test::ReadFile(path);
+    REQUIRE(valid.size() > HEADER_SIZE);
+
+    CHECK_THROWS(LandmarkIndex::Open(dir.File("missing.vli")), std::runtime_error);
+    auto opensAfter = [&](const std::string &data) {
+        const std::string corrupt_path = dir.File("corrupt.vli");
+        test::WriteFile(corrupt_path, data);
+        LandmarkIndex::Open(corrupt_path);
+    };
+    for (std::size_t size : {std::size_t(0), std::size_t(10), HEADER_SIZE, HEADER_SIZE + 4,
+                             valid.size() / 2, valid.size() - 1})
+    {
+        CHECK_THROWS(opensAfter(valid.substr(0, size)), std::runtime_error);
+    }
+    CHECK_THROWS(opensAfter(valid + std::string(8, '\0')), std::runtime_error);
+
+    std::string bad_magic = valid;
+    bad_magic[0] ^= 1;
+    CHECK_THROWS(opensAfter(bad_magic), std::runtime_error);
+    std::string bad_version = valid;
+    store32(&bad_version, VERSION_OFFSET, load32(valid, VERSION_OFFSET) + 1);
+    CHECK_THROWS(opensAfter(bad_version), std::runtime_error);
+    std::string bad_key_count = valid;
+    store32(&bad_key_count, KEY_COUNT_OFFSET, load32(valid, KEY_COUNT_OFFSET) + 1);
+    CHECK_THROWS(opensAfter(bad_key_count), std::runtime_error);
+    for (std::uint32_t bucket_bits : {0u, 31u, 64u})
+    {
+        std::string bad_bits = valid;
+        store32(&bad_bits, BUCKET_BITS_OFFSET, bucket_bits);
+        CHECK_THROWS(opensAfter(bad_bits), std::runtime_error);
+    }
+}
+
+TEST(landmark_index, corrupt_tables_stay_in_bounds)
+{
+    // Open() only checks the ends of the bucket and offset tables, whatever
+    // is in between must give wrong matches at worst. The address sanitizer
+    // build checks that no lookup reads outside the file.
+    test::TempDir dir;
+    const std::string path = dir.File("tracks.vli");
+    writeIndex(path);
+    const std::string valid = test::ReadFile(path);
+    const std::uint32_t bucket_count = (1u << load32(valid, BUCKET_BITS_OFFSET)) + 1;
+    const std::uint32_t key_count = load32(valid, KEY_COUNT_OFFSET);
+    const std::size_t buckets_offset = HEADER_SIZE;
+    const std::size_t offsets_offset = buckets_offset + 4 * (bucket_count + key_count);
+    const Signature query = test::SignatureOf(test::Excerpt(track(1), 5.0, QUERY_SECONDS));
+
+    const std::uint32_t garbage[] = {0xffffff00u, key_count + 1, 0x7fffffffu};
+    for (std::uint32_t value : garbage)
+    {
+        std::string buckets = valid;
+        for (std::uint32_t i = 1; i + 1 < bucket_count; ++i)
+        {
+            store32(&buckets, buckets_offset + 4 * i, value);
+        }
+        std::string offsets = valid;
+        for (std::uint32_t i = 1; i < key_count; ++i)
+        {
+            store32(&offsets, offsets_offset + 4 * i, i % 2 != 0 ? value : 0);
+        }
+        for (const std::string *data : {&buckets, &offsets})
+        {
+            test::WriteFile(dir.File("corrupt.vli"), *data);
+            const LandmarkIndex index = LandmarkIndex::Open(dir.File("corrupt.vli"));
+            index.Query(query, 1, UINT32_MAX);
+            LandmarkIndexBuilder rebuilt;
+            rebuilt.AddIndex(index);
+        }
+    }
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "algorithm/fingerprint_session.h"
+#include "match/lsh_table.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+#include "vibra.h"
+
+namespace
+{
+constexpr double TRACK_SECONDS = 12.0;
+constexpr std::uint32_t TRACK_COUNT = 8;
+
+std::vector<double> track(std::uint32_t seed)
+{
+    return synthetic::Music(16000, TRACK_SECONDS, seed);
+}
+
+// The same audio delivered again as 44.1 kHz stereo at a lower level
+SignatureDigest reencodedDigest(std::uint32_t seed)
+{
+    std::vector<double> audio = synthetic::Music(44100, TRACK_SECONDS, seed);
+    for (auto &sample : audio)
+    {
+        sample *= 0.7;
+    }
+    const std::vector<char> pcm = synthetic::EncodePcm(audio, SampleFormat::SIGNED_INTEGER, 2, 2);
+    FingerprintSession session(pcm.data(), pcm.size(), SampleFormat::SIGNED_INTEGER, 44100, 16, 2,
+                               std::numeric_limits<double>::infinity());
+    return session.Finish().digest();
+}
+
+SignatureDigest digestOf(const std::vector<double> &audio)
+{
+    return test::SignatureOf(audio).digest();
+}
+
+// A digest whose bands are all distinct from those of any other `seed`, and
+// which shares its first `shared_bands` bands with `base`
+SignatureDigest madeUpDigest(std::uint64_t seed, const SignatureDigest &base,
+                             std::size_t shared_bands)
+{
+    SignatureDigest digest;
+    for (std::size_t i = 0; i < DIGEST_SIZE; ++i)
+    {
+        digest[i] = i < shared_bands * LSH_ROWS ? base[i] : seed * DIGEST_SIZE + i;
+    }
+    return digest;
+}
+
+// As the C API takes them
+std::vector<unsigned long long> values(const SignatureDigest &digest)
+{
+    return std::vector<unsigned long long>(digest.begin(), digest.end());
+}
+
+bool contains(const std::vector<std::uint64_t> &ids, std::uint64_t id)
+{
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+} // namespace
+
+TEST(lsh_table, finds_near_duplicates)
+{
+    LshTable table;
+    for (std::uint32_t seed = 1; seed <= TRACK_COUNT; ++seed)
+    {
+        REQUIRE(table.Insert(100 + seed, digestOf(track(seed))));
+    }
+    CHECK_EQ(table.size(), static_cast<std::size_t>(TRACK_COUNT));
+
+    // The digest estimates how many landmarks two signatures share, which
+    // other encodings and trimmed copies of a track keep
+    for (std::uint32_t seed = 1; seed <= TRACK_COUNT; ++seed)
+    {
+        const std::vector<double> trimmed = test::Excerpt(track(seed), 1.0, TRACK_SECONDS - 2.0);
+        for (const SignatureDigest &digest : {reencodedDigest(seed), digestOf(trimmed)})
+        {
+            const std::vector<std::uint64_t> candidates = table.Query(digest);
+            if (!CHECK(!candidates.empty() && candidates[0] == 100 + seed))
+            {
+                test::Fail(__FILE__, __LINE__,
+                           "track " + test::Describe(100 + seed) + " not the best candidate");
+            }
+        }
+    }
+
+    // Unrelated audio may share a band by chance, hardly ever two
+    const std::vector<std::vector<double>> unrelated = {
+        synthetic::Noise(16000, TRACK_SECONDS, 60),
+        synthetic::Chirp(16000, TRACK_SECONDS, 200.0, 4000.0),
+        synthetic::Mix(synthetic::Tone(16000, TRACK_SECONDS, 523.0), 0.5,
+                       synthetic::Tone(16000, TRACK_SECONDS, 784.0), 0.5),
+    };
+    for (const auto &audio : unrelated)
+    {
+        CHECK(table.Query(digestOf(audio), 2).empty());
+    }
+}
+
+TEST(lsh_table, rejects_empty_digests)
+{
+    LshTable table;
+    CHECK(!table.Insert(1, EmptyDigest()));
+    // Too short to pair any peaks
+    const SignatureDigest silence = digestOf(std::vector<double>(16000, 0.0));
+    CHECK(silence == EmptyDigest());
+    CHECK(!table.Insert(2, silence));
+    CHECK_EQ(table.size(), 0u);
+
+    const SignatureDigest digest = madeUpDigest(1, EmptyDigest(), 0);
+    REQUIRE(table.Insert(3, digest));
+    CHECK(table.Query(EmptyDigest()).empty());
+}
+
+TEST(lsh_table, insert_replaces_remove_forgets)
+{
+    const SignatureDigest first = madeUpDigest(1, EmptyDigest(), 0);
+    const SignatureDigest second = madeUpDigest(2, EmptyDigest(), 0);
+    LshTable table;
+    REQUIRE(table.Insert(7, first));
+    CHECK(table.Query(first) == std::vector<std::uint64_t>{7});
+
+    // Same id, new digest: the old one no longer finds it
+    REQUIRE(table.Insert(7, second));
+    CHECK_EQ(table.size(), 1u);
+    CHECK(table.Query(first).empty());
+    CHECK(table.Query(second) == std::vector<std::uint64_t>{7});
+
+    REQUIRE(table.Insert(8, second));
+    CHECK(table.Remove(7));
+    CHECK(!table.Remove(7));
+    CHECK(table.Query(second) == std::vector<std::uint64_t>{8});
+    table.Clear();
+    CHECK_EQ(table.size(), 0u);
+    CHECK(table.Query(second).empty());
+    CHECK(!table.Remove(8));
+}
+
+TEST(lsh_table, orders_by_shared_bands_then_id)
+{
+    const SignatureDigest query = madeUpDigest(1, EmptyDigest(), 0);
+    LshTable table;
+    // id: shared bands
+    const std::size_t entries[][2] = {{40, 2}, {10, 5}, {30, 2}, {20, LSH_BANDS}, {50, 0}};
+    for (const auto &entry : entries)
+    {
+        REQUIRE(table.Insert(entry[0], madeUpDigest(entry[0], query, entry[1])));
+    }
+    CHECK(table.Query(query) == (std::vector<std::uint64_t>{20, 10, 30, 40}));
+    CHECK(table.Query(query, 3) == (std::vector<std::uint64_t>{20, 10}));
+    CHECK(table.Query(query, LSH_BANDS) == std::vector<std::uint64_t>{20});
+    CHECK(!contains(table.Query(query, 0), 50));
+}
+
+TEST(lsh_table, c_api_truncates_to_capacity)
+{
+    const SignatureDigest query = madeUpDigest(1, EmptyDigest(), 0);
+    VibraLshTable *table = vibra_lsh_table_create();
+    REQUIRE(table != nullptr);
+    for (long long id = 1; id <= 3; ++id)
+    {
+        const SignatureDigest digest = madeUpDigest(10 + id, query, static_cast<std::size_t>(id));
+        CHECK_EQ(vibra_lsh_table_insert(table, id, values(digest).data()), VIBRA_STATUS_DONE);
+    }
+    CHECK_EQ(vibra_lsh_table_insert(table, 4, values(EmptyDigest()).data()), VIBRA_STATUS_ERROR);
+    CHECK_EQ(vibra_lsh_table_get_size(table), 3);
+
+    const std::vector<unsigned long long> query_values = values(query);
+    long long ids[3] = {0, 0, 0};
+    CHECK_EQ(vibra_lsh_table_query(table, query_values.data(), ids, 2), 2);
+    CHECK_EQ(ids[0], 3);
+    CHECK_EQ(ids[1], 2);
+    CHECK_EQ(ids[2], 0);
+    CHECK_EQ(vibra_lsh_table_query(table, query_values.data(), ids, 0), 0);
+    CHECK_EQ(vibra_lsh_table_remove(table, 3), 1);
+    CHECK_EQ(vibra_lsh_table_remove(table, 3), 0);
+    CHECK_EQ(vibra_lsh_table_query(table, query_values.data(), ids, 3), 2);
+    vibra_lsh_table_free(table);
+}
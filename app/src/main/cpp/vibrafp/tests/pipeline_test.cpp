@@ -0,0 +1,208 @@
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "algorithm/signature_generator.h"
+#include "audio/resampler.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "utils/cpu_features.h"
+#include "vibra.h"
+
+namespace
+{
+std::string uriOf(Fingerprint *fingerprint)
+{
+    REQUIRE(fingerprint != nullptr);
+    const std::string uri = vibra_get_uri_from_fingerprint(fingerprint);
+    vibra_free_fingerprint(fingerprint);
+    return uri;
+}
+
+std::string pcmUri(const std::vector<char> &pcm, SampleFormat format, int rate, int width,
+                   int channels)
+{
+    const int size = static_cast<int>(pcm.size());
+    return uriOf(format == SampleFormat::FLOAT
+                     ? vibra_get_fingerprint_from_float_pcm(pcm.data(), size, rate, width * 8,
+                                                            channels)
+                     : vibra_get_fingerprint_from_signed_pcm(pcm.data(), size, rate, width * 8,
+                                                             channels));
+}
+
+std::string sessionUri(const std::vector<char> &pcm, int rate, int width, int channels,
+                       int step_frames, bool borrow = false)
+{
+    VibraSession *session =
+        (borrow ? vibra_session_create_borrowed : vibra_session_create)(
+            pcm.data(), static_cast<int>(pcm.size()), rate, width * 8, channels, 0);
+    REQUIRE(session != nullptr);
+    int status;
+    while ((status = vibra_session_step(session, step_frames)) == VIBRA_STATUS_PENDING)
+    {
+    }
+    CHECK_EQ(status, VIBRA_STATUS_DONE);
+    Fingerprint *fingerprint = vibra_session_get_fingerprint(session);
+    vibra_session_free(session);
+    return uriOf(fingerprint);
+}
+
+struct PcmFormat
+{
+    SampleFormat format;
+    int rate;
+    int width; // bytes
+    int channels;
+};
+
+const PcmFormat FORMATS[] = {
+    {SampleFormat::SIGNED_INTEGER, 16000, 2, 1}, {SampleFormat::SIGNED_INTEGER, 44100, 2, 2},
+    {SampleFormat::SIGNED_INTEGER, 22050, 3, 1}, {SampleFormat::SIGNED_INTEGER, 8000, 4, 2},
+    {SampleFormat::FLOAT, 48000, 4, 2},          {SampleFormat::FLOAT, 32000, 8, 1},
+};
+} // namespace
+
+TEST(pipeline, entry_points_agree)
+{
+    const std::vector<char> pcm = synthetic::EncodePcm(synthetic::Music(44100, 8.0, 3),
+                                                       SampleFormat::SIGNED_INTEGER, 2, 2);
+    const std::string uri = pcmUri(pcm, SampleFormat::SIGNED_INTEGER, 44100, 2, 2);
+    CHECK(uri.find("data:audio/vnd.shazam.sig;base64,") == 0);
+
+    const std::vector<char> wav =
+        synthetic::WrapWav(pcm, SampleFormat::SIGNED_INTEGER, 44100, 2, 2);
+    CHECK_EQ(uriOf(vibra_get_fingerprint_from_wav_data(wav.data(), static_cast<int>(wav.size()))),
+             uri);
+    // Step sizes that do not divide the resampler blocks
+    CHECK_EQ(sessionUri(pcm, 44100, 2, 2, 1000), uri);
+    CHECK_EQ(sessionUri(pcm, 44100, 2, 2, 44100 * 20), uri);
+    CHECK_EQ(sessionUri(pcm, 44100, 2, 2, 1000, true), uri);
+}
+
+TEST(pipeline, vectorized_kernels_match_portable)
+{
+    const bool was_forced = cpu::IsScalarForced();
+    for (const auto &format : FORMATS)
+    {
+        const std::vector<char> pcm =
+            synthetic::EncodePcm(synthetic::Music(format.rate, 5.0, format.rate), format.format,
+                                 format.width, format.channels);
+        cpu::SetScalarForced(false);
+        const std::string vectorized =
+            pcmUri(pcm, format.format, format.rate, format.width, format.channels);
+        cpu::SetScalarForced(true);
+        const std::string portable =
+            pcmUri(pcm, format.format, format.rate, format.width, format.channels);
+        CHECK_EQ(vectorized, portable);
+    }
+    cpu::SetScalarForced(was_forced);
+}
+
+TEST(pipeline, rejects_invalid_formats)
+{
+    const std::vector<char> pcm =
+        synthetic::EncodePcm(synthetic::Tone(16000, 1.0, 440.0), SampleFormat::SIGNED_INTEGER,
+                             2, 1);
+    const int size = static_cast<int>(pcm.size());
+    CHECK_THROWS(vibra_get_fingerprint_from_signed_pcm(pcm.data(), size, 0, 16, 1),
+                 std::invalid_argument);
+    CHECK_THROWS(vibra_get_fingerprint_from_signed_pcm(pcm.data(), size, 16000, 16, 0),
+                 std::invalid_argument);
+    CHECK_THROWS(vibra_get_fingerprint_from_signed_pcm(pcm.data(), size, 16000, 12, 1),
+                 std::runtime_error);
+    // No resampling ratio fits below MIN_RESAMPLER_INPUT_RATE, these used
+    // to loop until memory ran out
+    CHECK_THROWS(vibra_get_fingerprint_from_signed_pcm(pcm.data(), size, 7, 16, 1),
+                 std::invalid_argument);
+    CHECK_THROWS(vibra_get_fingerprint_from_signed_pcm(
+                     pcm.data(), size, static_cast<int>(MIN_RESAMPLER_INPUT_RATE) - 1, 16, 1),
+                 std::invalid_argument);
+    CHECK(vibra_session_create(pcm.data(), size, 7, 16, 1, 0) == nullptr);
+
+    Fingerprint *fingerprint = vibra_get_fingerprint_from_signed_pcm(
+        pcm.data(), size, static_cast<int>(MIN_RESAMPLER_INPUT_RATE), 16, 1);
+    CHECK(fingerprint != nullptr);
+    vibra_free_fingerprint(fingerprint);
+}
+
+TEST(pipeline, odd_rates_are_resampled)
+{
+    // Rates without a precomputed table get one designed, including those
+    // that need an approximated ratio
+    for (int rate : {7350, 12345, 44056, 96001})
+    {
+        const std::vector<char> pcm = synthetic::EncodePcm(
+            synthetic::Tone(rate, 3.0, 1000.0), SampleFormat::SIGNED_INTEGER, 2, 1);
+        Fingerprint *fingerprint = vibra_get_fingerprint_from_signed_pcm(
+            pcm.data(), static_cast<int>(pcm.size()), rate, 16, 1);
+        REQUIRE(fingerprint != nullptr);
+        const unsigned int sample_ms = vibra_get_sample_ms_from_fingerprint(fingerprint);
+        CHECK(sample_ms > 2990 && sample_ms <= 3000);
+        vibra_free_fingerprint(fingerprint);
+    }
+}
+
+TEST(pipeline, session_cancel_and_deadline)
+{
+    const std::vector<char> pcm = synthetic::EncodePcm(synthetic::Music(44100, 12.0, 4),
+                                                       SampleFormat::SIGNED_INTEGER, 2, 2);
+    const int size = static_cast<int>(pcm.size());
+    const int all_frames = std::numeric_limits<int>::max();
+
+    // Cancelled from another thread between two steps
+    VibraSession *session = vibra_session_create(pcm.data(), size, 44100, 16, 2, 0);
+    REQUIRE(session != nullptr);
+    CHECK_EQ(vibra_session_step(session, 1000), VIBRA_STATUS_PENDING);
+    std::thread canceller(vibra_session_cancel, session);
+    canceller.join();
+    CHECK_EQ(vibra_session_step(session, all_frames), VIBRA_STATUS_CANCELLED);
+    CHECK_EQ(std::string(vibra_session_get_error(session)), "Operation cancelled");
+    vibra_session_free(session);
+
+    session = vibra_session_create(pcm.data(), size, 44100, 16, 2, 0);
+    REQUIRE(session != nullptr);
+    vibra_session_set_timeout_ms(session, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    CHECK_EQ(vibra_session_step(session, all_frames), VIBRA_STATUS_DEADLINE_EXCEEDED);
+    vibra_session_free(session);
+
+    // Cancelled while a single step over the whole input runs, it stops
+    // before the input is exhausted
+    vibra_set_stats_enabled(1);
+    session = vibra_session_create(pcm.data(), size, 44100, 16, 2, 0);
+    vibra_set_stats_enabled(0);
+    REQUIRE(session != nullptr);
+    std::atomic<bool> stepping(false);
+    int status = VIBRA_STATUS_PENDING;
+    std::thread worker([&] {
+        stepping.store(true);
+        status = vibra_session_step(session, all_frames);
+    });
+    while (!stepping.load())
+    {
+        std::this_thread::yield();
+    }
+    vibra_session_cancel(session);
+    worker.join();
+    CHECK_EQ(status, VIBRA_STATUS_CANCELLED);
+    VibraStats stats;
+    REQUIRE_EQ(vibra_session_get_stats(session, &stats), VIBRA_STATUS_DONE);
+    CHECK(stats.frames_processed < pcm.size() / 4);
+    vibra_session_free(session);
+
+    // The generator polls the token every CANCELLATION_CHECK_HOPS blocks of
+    // 128 samples, so a cancelled token stops ProcessInput() on the block
+    // that reaches the poll rather than between calls
+    CancellationToken token;
+    token.Cancel();
+    SignatureGenerator generator;
+    generator.set_max_time_seconds(12);
+    generator.set_cancellation_token(&token);
+    const LowQualityTrack samples((CANCELLATION_CHECK_HOPS - 1) * 128, 0);
+    CHECK_EQ(generator.ProcessInput(samples.data(), samples.size()), samples.size());
+    const LowQualityTrack last_hop(128, 0);
+    CHECK_THROWS(generator.ProcessInput(last_hop.data(), last_hop.size()), OperationCancelled);
+}
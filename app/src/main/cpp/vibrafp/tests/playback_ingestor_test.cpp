@@ -0,0 +1,297 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "match/index_segments.h"
+#include "match/playback_ingestor.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+#include "vibra.h"
+
+namespace
+{
+constexpr double TRACK_SECONDS = 20.0;
+constexpr double QUERY_SECONDS = 8.0;
+constexpr std::uint32_t PASSES_PER_SECOND = 16000 / 128;
+// About 23 ms of 44.1 kHz stereo int16, as an audio callback would hand over
+constexpr std::size_t BLOCK_BYTES = 4096;
+
+struct Played
+{
+    std::vector<char> pcm;
+    std::uint32_t rate;
+    std::uint32_t channels;
+};
+
+Played music(std::uint32_t seed, std::uint32_t rate, std::uint32_t channels,
+             double seconds = TRACK_SECONDS)
+{
+    return Played{synthetic::EncodePcm(synthetic::Music(rate, seconds, seed),
+                                       SampleFormat::SIGNED_INTEGER, 2, channels),
+                  rate, channels};
+}
+
+// Plays `track` block by block, giving each Feed() `budget`. Returns what
+// was still queued after the last block.
+std::size_t play(PlaybackIngestor *ingestor, std::uint32_t track_id, const Played &track,
+                 std::chrono::microseconds budget)
+{
+    ingestor->BeginTrack(track_id, SampleFormat::SIGNED_INTEGER, track.rate, 16, track.channels);
+    std::size_t queued = 0;
+    for (std::size_t offset = 0; offset < track.pcm.size(); offset += BLOCK_BYTES)
+    {
+        const std::size_t size = std::min(BLOCK_BYTES, track.pcm.size() - offset);
+        queued = ingestor->Feed(track.pcm.data() + offset, size, budget);
+    }
+    ingestor->EndTrack();
+    return queued;
+}
+
+// QUERY_SECONDS of Music(seed) from `start`, as recorded at 16 kHz
+Signature recording(std::uint32_t seed, double start)
+{
+    return test::SignatureOf(
+        test::Excerpt(synthetic::Music(16000, TRACK_SECONDS, seed), start, QUERY_SECONDS));
+}
+
+bool finds(const std::vector<LandmarkIndex> &segments, std::uint32_t track_id,
+           std::uint32_t seed, double start)
+{
+    const MatchResult result = QueryIndexSegments(segments, recording(seed, start));
+    const std::int32_t expected_offset = static_cast<std::int32_t>(start * PASSES_PER_SECOND);
+    return result.found && result.track_id == track_id &&
+           std::abs(result.offset_passes - expected_offset) <= 1;
+}
+} // namespace
+
+TEST(playback_ingestor, committed_tracks_can_be_queried)
+{
+    test::TempDir dir;
+    const std::string index_dir = dir.File("index");
+    {
+        PlaybackIngestor ingestor(index_dir);
+        // Nothing analysed while playing, all of it left to Commit()
+        CHECK(play(&ingestor, 1, music(21, 44100, 2), std::chrono::microseconds(0)) > 0u);
+        // Everything analysed while playing
+        CHECK_EQ(play(&ingestor, 2, music(22, 16000, 1), std::chrono::seconds(10)), 0u);
+        CHECK(!ingestor.tracking());
+        CHECK(ingestor.Commit() == std::vector<std::uint32_t>({1, 2}));
+        CHECK(ingestor.Commit().empty());
+    }
+    REQUIRE_EQ(ListIndexSegments(index_dir).size(), 1u);
+    {
+        const std::vector<LandmarkIndex> segments = OpenIndexSegments(index_dir);
+        CHECK(finds(segments, 1, 21, 3.0));
+        CHECK(finds(segments, 2, 22, 11.0));
+        const Signature unrelated =
+            test::SignatureOf(synthetic::Chirp(16000, QUERY_SECONDS, 200.0, 4000.0));
+        CHECK(!QueryIndexSegments(segments, unrelated).found);
+    }
+
+    // A later session adds a segment, earlier tracks stay
+    {
+        PlaybackIngestor ingestor(index_dir);
+        play(&ingestor, 3, music(23, 22050, 1), std::chrono::microseconds(200));
+        CHECK(ingestor.Commit() == std::vector<std::uint32_t>({3}));
+    }
+    CHECK_EQ(ListIndexSegments(index_dir).size(), 2u);
+    const std::vector<LandmarkIndex> segments = OpenIndexSegments(index_dir);
+    CHECK(finds(segments, 1, 21, 7.0));
+    CHECK(finds(segments, 3, 23, 3.0));
+
+    // Through the C API, which opens the directory
+    VibraIndex *index = vibra_index_open(index_dir.c_str());
+    REQUIRE(index != nullptr);
+    CHECK_EQ(vibra_index_get_track_count(index), 3u);
+    const std::string uri = recording(22, 5.0).EncodeBase64();
+    VibraSignature *query = vibra_signature_from_uri(uri.data(), static_cast<int>(uri.size()));
+    REQUIRE(query != nullptr);
+    VibraMatch match;
+    CHECK_EQ(vibra_index_query(index, query, &match), 1);
+    CHECK_EQ(match.track_id, 2u);
+    CHECK(std::abs(match.offset_ms - 5000) <= 16);
+    vibra_signature_free(query);
+    vibra_index_free(index);
+}
+
+TEST(playback_ingestor, short_and_dropped_tracks_are_not_written)
+{
+    test::TempDir dir;
+    const std::string index_dir = dir.File("index");
+    PlaybackIngestor ingestor(index_dir);
+
+    // Fed while no track is being ingested
+    const Played track = music(24, 16000, 1);
+    CHECK_EQ(ingestor.Feed(track.pcm.data(), track.pcm.size(), std::chrono::seconds(1)), 0u);
+
+    // Skipped after a second
+    play(&ingestor, 1, music(24, 16000, 1, 1.0), std::chrono::seconds(1));
+    // Stopped halfway
+    ingestor.BeginTrack(2, SampleFormat::SIGNED_INTEGER, 16000, 16, 1);
+    ingestor.Feed(track.pcm.data(), track.pcm.size() / 2, std::chrono::seconds(1));
+    CHECK(ingestor.tracking());
+    ingestor.AbandonTrack();
+    CHECK(!ingestor.tracking());
+    ingestor.EndTrack();
+    // Queued faster than it could be analysed
+    ingestor.BeginTrack(3, SampleFormat::SIGNED_INTEGER, 16000, 16, 1);
+    const std::vector<char> silence(MAX_INGEST_QUEUE_BYTES / 2 + 2, 0);
+    ingestor.Feed(silence.data(), silence.size(), std::chrono::microseconds(0));
+    CHECK(ingestor.tracking());
+    CHECK_EQ(ingestor.Feed(silence.data(), silence.size(), std::chrono::microseconds(0)), 0u);
+    CHECK(!ingestor.tracking());
+
+    CHECK(ingestor.Commit().empty());
+    // Not even the directory was created
+    CHECK_THROWS(ListIndexSegments(index_dir), std::runtime_error);
+
+    CHECK_THROWS(ingestor.BeginTrack(4, SampleFormat::SIGNED_INTEGER, 7, 16, 1),
+                 std::invalid_argument);
+    CHECK_THROWS(ingestor.BeginTrack(4, SampleFormat::SIGNED_INTEGER, 16000, 16, 0),
+                 std::invalid_argument);
+    CHECK(!ingestor.tracking());
+}
+
+TEST(playback_ingestor, c_api_reports_dropped_tracks)
+{
+    test::TempDir dir;
+    CHECK(vibra_ingestor_create(nullptr) == nullptr);
+    VibraIngestor *ingestor = vibra_ingestor_create(dir.File("index").c_str());
+    REQUIRE(ingestor != nullptr);
+
+    const std::vector<char> silence(MAX_INGEST_QUEUE_BYTES / 2 + 2, 0);
+    const int size = static_cast<int>(silence.size());
+    CHECK_EQ(vibra_ingestor_begin_track(ingestor, 1, 16000, 16, 1, 0), VIBRA_STATUS_DONE);
+    CHECK_EQ(vibra_ingestor_feed(ingestor, silence.data(), size, 0), VIBRA_STATUS_PENDING);
+    CHECK_EQ(vibra_ingestor_feed(ingestor, silence.data(), size, 0), VIBRA_STATUS_DROPPED);
+    // Ignored until the next track begins
+    CHECK_EQ(vibra_ingestor_feed(ingestor, silence.data(), size, 0), VIBRA_STATUS_DONE);
+    vibra_ingestor_end_track(ingestor);
+    CHECK_EQ(vibra_ingestor_commit(ingestor), 0);
+    vibra_ingestor_free(ingestor);
+}
+
+TEST(playback_ingestor, short_plays_are_ingested_again)
+{
+    test::TempDir dir;
+    const std::string index_dir = dir.File("index");
+    VibraIngestor *ingestor = vibra_ingestor_create(index_dir.c_str());
+    REQUIRE(ingestor != nullptr);
+    auto playThroughC = [&](unsigned int track_id, const Played &track) {
+        REQUIRE_EQ(vibra_ingestor_begin_track(ingestor, track_id, 16000, 16, 1, 0),
+                   VIBRA_STATUS_DONE);
+        for (std::size_t offset = 0; offset < track.pcm.size(); offset += BLOCK_BYTES)
+        {
+            const std::size_t size = std::min(BLOCK_BYTES, track.pcm.size() - offset);
+            vibra_ingestor_feed(ingestor, track.pcm.data() + offset, static_cast<int>(size),
+                                1000000);
+        }
+        vibra_ingestor_end_track(ingestor);
+    };
+    unsigned int ids[4] = {0, 0, 0, 0};
+
+    // Skipped on its first play, alongside a track played in full
+    playThroughC(1, music(27, 16000, 1, 1.0));
+    playThroughC(2, music(28, 16000, 1));
+    CHECK_EQ(vibra_ingestor_commit(ingestor), 1);
+    CHECK_EQ(vibra_ingestor_get_committed_ids(ingestor, ids, 4), 1);
+    CHECK_EQ(ids[0], 2u);
+
+    // The next play of the same song gets a new id and is indexed
+    playThroughC(3, music(27, 16000, 1));
+    CHECK_EQ(vibra_ingestor_commit(ingestor), 1);
+    CHECK_EQ(vibra_ingestor_get_committed_ids(ingestor, ids, 4), 1);
+    CHECK_EQ(ids[0], 3u);
+    CHECK_EQ(vibra_ingestor_get_committed_ids(ingestor, ids, 0), 0);
+    CHECK_EQ(vibra_ingestor_commit(ingestor), 0);
+    CHECK_EQ(vibra_ingestor_get_committed_ids(ingestor, ids, 4), 0);
+    vibra_ingestor_free(ingestor);
+
+    const std::vector<LandmarkIndex> segments = OpenIndexSegments(index_dir);
+    CHECK(finds(segments, 3, 27, 4.0));
+    CHECK(finds(segments, 2, 28, 4.0));
+}
+
+TEST(playback_ingestor, full_levels_are_merged)
+{
+    test::TempDir dir;
+    const std::string index_dir = dir.File("index");
+    for (std::uint32_t seed = 1; seed <= SEGMENT_MERGE_FANIN; ++seed)
+    {
+        LandmarkIndexBuilder builder;
+        builder.AddSignature(seed, recording(seed, 0.0));
+        AppendIndexSegment(index_dir, builder);
+    }
+    const std::vector<IndexSegment> listed = ListIndexSegments(index_dir);
+    REQUIRE_EQ(listed.size(), 1u);
+    CHECK_EQ(listed[0].level, 1u);
+    CHECK_EQ(listed[0].sequence, static_cast<std::uint64_t>(SEGMENT_MERGE_FANIN));
+
+    const std::vector<LandmarkIndex> segments = OpenIndexSegments(index_dir);
+    CHECK_EQ(segments[0].track_count(), static_cast<std::uint32_t>(SEGMENT_MERGE_FANIN));
+    for (std::uint32_t seed = 1; seed <= SEGMENT_MERGE_FANIN; ++seed)
+    {
+        CHECK_EQ(QueryIndexSegments(segments, recording(seed, 0.0)).track_id, seed);
+    }
+
+    // Segments of another config are not mixed in
+    LandmarkConfig config;
+    config.fan_out += 1;
+    LandmarkIndexBuilder other(config);
+    other.AddSignature(99, recording(9, 0.0));
+    CHECK_THROWS(AppendIndexSegment(index_dir, other), std::invalid_argument);
+    CHECK_EQ(ListIndexSegments(index_dir).size(), 1u);
+}
+
+TEST(playback_ingestor, corrupt_segments_are_rejected)
+{
+    test::TempDir dir;
+    const std::string index_dir = dir.File("index");
+    {
+        PlaybackIngestor ingestor(index_dir);
+        play(&ingestor, 1, music(25, 16000, 1), std::chrono::seconds(1));
+        REQUIRE_EQ(ingestor.Commit().size(), 1u);
+        play(&ingestor, 2, music(26, 16000, 1), std::chrono::seconds(1));
+        REQUIRE_EQ(ingestor.Commit().size(), 1u);
+    }
+    const std::vector<IndexSegment> listed = ListIndexSegments(index_dir);
+    REQUIRE_EQ(listed.size(), 2u);
+    const std::string valid = test::ReadFile(listed[1].path);
+
+    // Files that are not segments are ignored
+    test::WriteFile(index_dir + "/segment-0-5.vli.tmp", "partial");
+    test::WriteFile(index_dir + "/segment-0-05.vli", "not canonical");
+    CHECK_EQ(ListIndexSegments(index_dir).size(), 2u);
+    CHECK_EQ(OpenIndexSegments(index_dir).size(), 2u);
+
+    auto rejected = [&](const std::string &data) {
+        test::WriteFile(listed[1].path, data);
+        bool thrown = false;
+        try
+        {
+            OpenIndexSegments(index_dir);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        VibraIndex *index = vibra_index_open(index_dir.c_str());
+        vibra_index_free(index);
+        return thrown && index == nullptr;
+    };
+    std::string bad_magic = valid;
+    bad_magic[0] ^= 1;
+    CHECK(rejected(bad_magic));
+    CHECK(rejected(valid.substr(0, valid.size() / 2)));
+    CHECK(rejected(valid.substr(0, 10)));
+    CHECK(rejected(std::string()));
+
+    test::WriteFile(listed[1].path, valid);
+    VibraIndex *index = vibra_index_open(index_dir.c_str());
+    CHECK(index != nullptr);
+    vibra_index_free(index);
+}
@@ -0,0 +1,427 @@
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "algorithm/signature.h"
+#include "storage/signature_pack.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+#include "utils/base64.h"
+#include "utils/crc32.h"
+#include "vibra.h"
+
+namespace
+{
+// PackFileHeader, then an entry of key, offset and size per record
+constexpr std::size_t HEADER_SIZE = 24;
+constexpr std::size_t ENTRY_SIZE = 16;
+constexpr std::size_t ENTRY_COUNT_OFFSET = 12;
+constexpr std::size_t RECORDS_SIZE_OFFSET = 16;
+
+template <typename T> T load(const std::string &bytes, std::size_t offset)
+{
+    T value;
+    std::memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+template <typename T> void store(std::string *bytes, std::size_t offset, T value)
+{
+    std::memcpy(&(*bytes)[offset], &value, sizeof(value));
+}
+
+void putVarint(std::string *out, std::uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        out->push_back(static_cast<char>(value | 0x80));
+        value >>= 7;
+    }
+    out->push_back(static_cast<char>(value));
+}
+
+void addPeak(Signature *signature, FrequencyBand band, std::uint32_t pass,
+             std::uint32_t magnitude, std::uint32_t bin)
+{
+    signature->frequency_band_to_peaks()[band].emplace_back(pass, magnitude, bin,
+                                                            signature->sample_rate());
+}
+
+// Every band, gaps that need a pass escape in the URI and deltas far past
+// what the Rice parameters of their band favour
+Signature handMadeSignature(std::uint32_t num_samples = 16000 * 30)
+{
+    Signature signature(16000, num_samples);
+    addPeak(&signature, FrequencyBand::_0_150, 3, 9000, 600);
+    addPeak(&signature, FrequencyBand::_250_520, 0, 12000, 1400);
+    addPeak(&signature, FrequencyBand::_250_520, 254, 12001, 1500);
+    addPeak(&signature, FrequencyBand::_250_520, 509, 12002, 1600);
+    addPeak(&signature, FrequencyBand::_520_1450, 700, 20000, 3000);
+    addPeak(&signature, FrequencyBand::_1450_3500, 255, 30000, 9000);
+    addPeak(&signature, FrequencyBand::_1450_3500, 3000, 30001, 9001);
+    addPeak(&signature, FrequencyBand::_1450_3500, 3001, 1, 65535);
+    addPeak(&signature, FrequencyBand::_3500_5500, 1, 65535, 65535);
+    return signature;
+}
+
+// Sets the CRC of an edited signature, so that the decoder gets past it
+std::string resign(std::string binary)
+{
+    store<std::uint32_t>(&binary, 4, crc32::crc32(binary.data() + 8, binary.size() - 8));
+    return binary;
+}
+
+std::string uriOf(const std::string &binary)
+{
+    return "data:audio/vnd.shazam.sig;base64," + base64::encode(binary.data(), binary.size());
+}
+
+// A pack of `signatures` under keys 1, 2, ... as written to `path`
+std::string writePack(const std::string &path, const std::vector<Signature> &signatures)
+{
+    SignaturePackWriter writer;
+    for (std::size_t i = 0; i < signatures.size(); ++i)
+    {
+        writer.Add(i + 1, signatures[i]);
+    }
+    writer.Write(path);
+    return test::ReadFile(path);
+}
+
+// The bytes of the single record of a pack of `signature`
+std::string recordOf(const test::TempDir &dir, const Signature &signature)
+{
+    return writePack(dir.File("record.pack"), {signature}).substr(HEADER_SIZE + ENTRY_SIZE);
+}
+
+// A record of a single band with the given header fields and payload
+std::string bandRecord(std::uint64_t peak_count, std::uint8_t rice_bits,
+                       const std::string &payload)
+{
+    std::string record;
+    putVarint(&record, 16000);
+    putVarint(&record, 16000);
+    record.push_back(1 << 2);
+    putVarint(&record, peak_count);
+    putVarint(&record, payload.size());
+    record.append(3, static_cast<char>(rice_bits));
+    return record + payload;
+}
+} // namespace
+
+TEST(signature_pack, uris_round_trip_byte_identical)
+{
+    test::TempDir dir;
+    std::vector<Signature> signatures;
+    for (std::uint32_t seed = 41; seed < 44; ++seed)
+    {
+        signatures.push_back(test::SignatureOf(synthetic::Music(16000, 12.0, seed)));
+    }
+    signatures.push_back(handMadeSignature());
+    signatures.push_back(Signature(16000, 16000)); // no peaks at all
+
+    SignaturePackWriter writer;
+    std::vector<std::string> uris;
+    for (std::size_t i = 0; i < signatures.size(); ++i)
+    {
+        uris.push_back(signatures[i].EncodeBase64());
+        writer.AddUri(100 + i, uris[i].data(), uris[i].size());
+    }
+    REQUIRE_EQ(writer.size(), signatures.size());
+    const std::string path = dir.File("signatures.pack");
+    writer.Write(path);
+
+    const SignaturePack pack = SignaturePack::Open(path);
+    REQUIRE_EQ(pack.size(), signatures.size());
+    std::size_t records_size = 0;
+    std::size_t binaries_size = 0;
+    for (std::size_t i = 0; i < signatures.size(); ++i)
+    {
+        const std::size_t index = pack.Find(100 + i);
+        REQUIRE(index < pack.size());
+        const SignatureRecord record = pack.record(index);
+        CHECK_EQ(record.EncodeBase64(), uris[i]);
+        CHECK_EQ(record.sample_rate(), signatures[i].sample_rate());
+        CHECK_EQ(record.num_samples(), signatures[i].num_samples());
+        CHECK_EQ(record.peak_count(), signatures[i].SumOfPeaksLength());
+        std::uint32_t visited = 0;
+        record.ForEachPeak([&visited](FrequencyBand, const FrequencyPeak &) { ++visited; });
+        CHECK_EQ(visited, record.peak_count());
+        // Hand-made signatures have no digest until decoded
+        CHECK(record.ToSignature().digest() ==
+              Signature::DecodeBase64(uris[i].data(), uris[i].size()).digest());
+        records_size += record.size();
+        binaries_size += signatures[i].EncodeBinary().size();
+    }
+    CHECK(records_size < binaries_size);
+
+    // Through the C API
+    VibraSignaturePack *c_pack = vibra_signature_pack_open(path.c_str());
+    REQUIRE(c_pack != nullptr);
+    CHECK_EQ(vibra_signature_pack_get_size(c_pack), static_cast<int>(signatures.size()));
+    for (std::size_t i = 0; i < signatures.size(); ++i)
+    {
+        const int index = vibra_signature_pack_find(c_pack, 100 + i);
+        VibraSignature *signature = vibra_signature_pack_get_signature(c_pack, index);
+        REQUIRE(signature != nullptr);
+        Fingerprint *fingerprint = vibra_signature_to_fingerprint(signature);
+        REQUIRE(fingerprint != nullptr);
+        CHECK_EQ(std::string(vibra_get_uri_from_fingerprint(fingerprint)), uris[i]);
+        vibra_free_fingerprint(fingerprint);
+        vibra_signature_free(signature);
+    }
+    vibra_signature_pack_free(c_pack);
+}
+
+TEST(signature_pack, add_uri_rejects_non_canonical_input)
+{
+    const std::string binary = handMadeSignature().EncodeBinary();
+    const std::string uri = uriOf(binary);
+    SignaturePackWriter writer;
+
+    // The prefix is optional, the record comes back with it
+    const std::string bare = uri.substr(uri.find(',') + 1);
+    writer.AddUri(1, bare.data(), bare.size());
+    CHECK_EQ(writer.size(), 1u);
+
+    CHECK_THROWS(writer.AddUri(2, uri.data(), uri.size() - 4), std::invalid_argument);
+    CHECK_THROWS(writer.AddUri(2, "data:audio/vnd.shazam.sig;base64,*@#!", 37),
+                 std::invalid_argument);
+
+    // Signatures that decode, but not to the bytes their URI holds: a set
+    // field the encoder leaves at zero, and padding that is not zero
+    std::string unused_field = binary;
+    store<std::uint32_t>(&unused_field, 16, 1);
+    std::string padding = binary;
+    padding[padding.size() - 1] = '\x55';
+    for (const std::string *edited : {&unused_field, &padding})
+    {
+        const std::string signed_binary = resign(*edited);
+        CHECK(Signature::DecodeBinary(signed_binary.data(), signed_binary.size())
+                  .SumOfPeaksLength() == 9u);
+        const std::string edited_uri = uriOf(signed_binary);
+        CHECK_THROWS(writer.AddUri(2, edited_uri.data(), edited_uri.size()),
+                     std::invalid_argument);
+    }
+    CHECK_EQ(writer.size(), 1u);
+
+    // Through the C API
+    VibraSignaturePackWriter *c_writer = vibra_signature_pack_writer_create();
+    REQUIRE(c_writer != nullptr);
+    const std::string edited_uri = uriOf(resign(padding));
+    CHECK_EQ(vibra_signature_pack_writer_add(c_writer, 1, edited_uri.data(),
+                                             static_cast<int>(edited_uri.size())),
+             VIBRA_STATUS_ERROR);
+    CHECK(std::string(vibra_signature_pack_writer_get_error(c_writer)).size() > 0u);
+    CHECK_EQ(vibra_signature_pack_writer_add(c_writer, 1, uri.data(), static_cast<int>(uri.size())),
+             VIBRA_STATUS_DONE);
+    vibra_signature_pack_writer_free(c_writer);
+}
+
+TEST(signature_pack, keys_are_sorted_and_found)
+{
+    test::TempDir dir;
+    const std::uint64_t KEYS[] = {42, 7, 0xffffffffffffffffull, 0, 1000};
+    SignaturePackWriter writer;
+    for (std::uint64_t key : KEYS)
+    {
+        writer.Add(key, handMadeSignature(16000 + static_cast<std::uint32_t>(key % 1000)));
+    }
+    writer.Add(7, handMadeSignature(12345)); // replaces
+    CHECK(writer.Remove(1000));
+    CHECK(!writer.Remove(1000));
+    CHECK_EQ(writer.size(), 4u);
+    const std::string path = dir.File("keys.pack");
+    writer.Write(path);
+
+    const SignaturePack pack = SignaturePack::Open(path);
+    REQUIRE_EQ(pack.size(), 4u);
+    CHECK_EQ(pack.key(0), 0u);
+    CHECK_EQ(pack.key(1), 7u);
+    CHECK_EQ(pack.key(2), 42u);
+    CHECK_EQ(pack.key(3), 0xffffffffffffffffull);
+    for (std::size_t i = 0; i < pack.size(); ++i)
+    {
+        CHECK_EQ(pack.Find(pack.key(i)), i);
+    }
+    CHECK_EQ(pack.Find(5), pack.size());
+    CHECK_EQ(pack.Find(1000), pack.size());
+    CHECK_EQ(pack.record(pack.Find(7)).num_samples(), 12345u);
+    CHECK_EQ(pack.record(pack.Find(42)).num_samples(), 16042u);
+
+    // Records of a pack replace those of the same key
+    SignaturePackWriter merged;
+    merged.Add(42, handMadeSignature(99));
+    merged.Add(9, handMadeSignature(999));
+    merged.AddPack(pack);
+    CHECK_EQ(merged.size(), 5u);
+    const std::string merged_path = dir.File("merged.pack");
+    merged.Write(merged_path);
+    const SignaturePack merged_pack = SignaturePack::Open(merged_path);
+    CHECK_EQ(merged_pack.record(merged_pack.Find(42)).num_samples(), 16042u);
+    CHECK_EQ(merged_pack.record(merged_pack.Find(9)).num_samples(), 999u);
+
+    // Through the C API, which checks the index
+    VibraSignaturePack *c_pack = vibra_signature_pack_open(path.c_str());
+    REQUIRE(c_pack != nullptr);
+    CHECK_EQ(vibra_signature_pack_get_key(c_pack, 1), 7u);
+    CHECK_EQ(vibra_signature_pack_get_key(c_pack, -1), 0u);
+    CHECK_EQ(vibra_signature_pack_get_key(c_pack, 4), 0u);
+    CHECK_EQ(vibra_signature_pack_find(c_pack, 42), 2);
+    CHECK_EQ(vibra_signature_pack_find(c_pack, 43), -1);
+    CHECK(vibra_signature_pack_get_signature(c_pack, 4) == nullptr);
+    vibra_signature_pack_free(c_pack);
+
+    // An empty pack
+    const std::string empty_path = dir.File("empty.pack");
+    SignaturePackWriter().Write(empty_path);
+    const SignaturePack empty = SignaturePack::Open(empty_path);
+    CHECK_EQ(empty.size(), 0u);
+    CHECK_EQ(empty.Find(0), 0u);
+}
+
+TEST(signature_pack, rejects_corrupt_headers)
+{
+    test::TempDir dir;
+    const std::string path = dir.File("signatures.pack");
+    const std::string bytes = writePack(path, {handMadeSignature(), handMadeSignature(32000)});
+    REQUIRE_EQ(load<std::uint32_t>(bytes, ENTRY_COUNT_OFFSET), 2u);
+    const auto records_size = load<std::uint64_t>(bytes, RECORDS_SIZE_OFFSET);
+    REQUIRE_EQ(HEADER_SIZE + 2 * ENTRY_SIZE + records_size, bytes.size());
+    const std::string corrupt_path = dir.File("corrupt.pack");
+    auto opens = [&corrupt_path](const std::string &corrupt) {
+        test::WriteFile(corrupt_path, corrupt);
+        VibraSignaturePack *c_pack = vibra_signature_pack_open(corrupt_path.c_str());
+        vibra_signature_pack_free(c_pack);
+        try
+        {
+            SignaturePack::Open(corrupt_path);
+        }
+        catch (const std::runtime_error &)
+        {
+            CHECK(c_pack == nullptr);
+            return false;
+        }
+        CHECK(c_pack != nullptr);
+        return true;
+    };
+    CHECK(opens(bytes));
+
+    for (std::size_t size = 0; size < bytes.size(); ++size)
+    {
+        CHECK(!opens(bytes.substr(0, size)));
+    }
+    CHECK(!opens(bytes + '\0'));
+
+    std::string bad_magic = bytes;
+    bad_magic[0] = 'W';
+    CHECK(!opens(bad_magic));
+    std::string bad_version = bytes;
+    store<std::uint32_t>(&bad_version, 8, 2);
+    CHECK(!opens(bad_version));
+
+    // Sizes whose sum wraps around to the file size in 64 bits
+    std::string wrapping = bytes;
+    store<std::uint32_t>(&wrapping, ENTRY_COUNT_OFFSET, 1002);
+    store<std::uint64_t>(&wrapping, RECORDS_SIZE_OFFSET, records_size - 1000 * ENTRY_SIZE);
+    CHECK(!opens(wrapping));
+    const std::uint64_t HUGE_SIZES[] = {~std::uint64_t(0), std::uint64_t(1) << 63,
+                                        records_size + 1};
+    for (std::uint64_t size : HUGE_SIZES)
+    {
+        std::string huge = bytes;
+        store<std::uint64_t>(&huge, RECORDS_SIZE_OFFSET, size);
+        CHECK(!opens(huge));
+    }
+    std::string many_entries = bytes;
+    store<std::uint32_t>(&many_entries, ENTRY_COUNT_OFFSET, 0xffffffffu);
+    CHECK(!opens(many_entries));
+}
+
+TEST(signature_pack, rejects_corrupt_records)
+{
+    test::TempDir dir;
+    const std::string path = dir.File("signatures.pack");
+    const std::string bytes = writePack(path, {handMadeSignature(), handMadeSignature(32000)});
+    const auto records_size = load<std::uint64_t>(bytes, RECORDS_SIZE_OFFSET);
+    // Entries outside the records are caught when the record is read
+    const std::size_t first_entry = HEADER_SIZE;
+    for (int field = 0; field < 2; ++field)
+    {
+        std::string corrupt = bytes;
+        if (field == 0)
+        {
+            store(&corrupt, first_entry + 8, static_cast<std::uint32_t>(records_size));
+        }
+        else
+        {
+            store<std::uint32_t>(&corrupt, first_entry + 12, 0xffffffffu);
+        }
+        test::WriteFile(path, corrupt);
+        const SignaturePack pack = SignaturePack::Open(path);
+        CHECK_THROWS(pack.record(0), std::runtime_error);
+        SignaturePackWriter writer;
+        CHECK_THROWS(writer.AddPack(pack), std::runtime_error);
+        CHECK_EQ(writer.size(), 0u);
+        VibraSignaturePack *c_pack = vibra_signature_pack_open(path.c_str());
+        REQUIRE(c_pack != nullptr);
+        CHECK(vibra_signature_pack_get_signature(c_pack, 0) == nullptr);
+        VibraSignature *intact = vibra_signature_pack_get_signature(c_pack, 1);
+        CHECK(intact != nullptr);
+        vibra_signature_free(intact);
+        vibra_signature_pack_free(c_pack);
+    }
+
+    // Every truncation of a record breaks its header
+    const std::string record = recordOf(dir, handMadeSignature());
+    CHECK_EQ(SignatureRecord(record.data(), record.size()).EncodeBase64(),
+             handMadeSignature().EncodeBase64());
+    for (std::size_t size = 0; size < record.size(); ++size)
+    {
+        CHECK_THROWS(SignatureRecord(record.data(), size), std::runtime_error);
+    }
+
+    // Any corrupt byte either fails to decode or decodes to some signature
+    for (std::size_t offset = 0; offset < record.size(); ++offset)
+    {
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            std::string corrupt = record;
+            corrupt[offset] = static_cast<char>(corrupt[offset] ^ (1 << bit));
+            try
+            {
+                SignatureRecord(corrupt.data(), corrupt.size()).ToSignature();
+            }
+            catch (const std::runtime_error &)
+            {
+            }
+        }
+    }
+
+    // Three bytes of zero bits hold at most eight peaks of one bit per field
+    const std::string zeros(3, '\0');
+    const std::string eight = bandRecord(8, 0, zeros);
+    CHECK_EQ(SignatureRecord(eight.data(), eight.size()).ToSignature().SumOfPeaksLength(), 8u);
+    const std::uint64_t TOO_MANY[] = {9, 0xffffffffu, ~std::uint64_t(0)};
+    for (std::uint64_t peak_count : TOO_MANY)
+    {
+        const std::string too_many = bandRecord(peak_count, 0, zeros);
+        CHECK_THROWS(SignatureRecord(too_many.data(), too_many.size()), std::runtime_error);
+    }
+    // Plausible counts the payload still runs out of
+    const std::string short_payload = bandRecord(8, 2, zeros);
+    const SignatureRecord short_record(short_payload.data(), short_payload.size());
+    CHECK_THROWS(short_record.ToSignature(), std::runtime_error);
+
+    std::string unknown_band = eight;
+    unknown_band[4] = static_cast<char>(1 << 5); // after the two 2-byte varints
+    CHECK_THROWS(SignatureRecord(unknown_band.data(), unknown_band.size()), std::runtime_error);
+    const std::string wide_rice = bandRecord(1, 32, zeros);
+    CHECK_THROWS(SignatureRecord(wide_rice.data(), wide_rice.size()), std::runtime_error);
+    std::string big_rate;
+    putVarint(&big_rate, 0x100000000ull);
+    big_rate += eight.substr(2);
+    CHECK_THROWS(SignatureRecord(big_rate.data(), big_rate.size()), std::runtime_error);
+}
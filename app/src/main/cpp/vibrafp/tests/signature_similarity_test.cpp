@@ -0,0 +1,134 @@
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "match/signature_similarity.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+#include "vibra.h"
+
+namespace
+{
+constexpr double TRACK_SECONDS = 24.0;
+constexpr double QUERY_SECONDS = 8.0;
+constexpr std::int32_t PASSES_PER_SECOND = 16000 / 128;
+
+std::vector<double> concatenate(std::vector<double> head, const std::vector<double> &tail)
+{
+    head.insert(head.end(), tail.begin(), tail.end());
+    return head;
+}
+
+bool nearOffset(std::int32_t offset_passes, double seconds)
+{
+    return std::abs(offset_passes - static_cast<std::int32_t>(seconds * PASSES_PER_SECOND)) <= 1;
+}
+
+VibraSignature *toC(const Signature &signature)
+{
+    const std::string uri = signature.EncodeBase64();
+    VibraSignature *result = vibra_signature_from_uri(uri.data(), static_cast<int>(uri.size()));
+    REQUIRE(result != nullptr);
+    return result;
+}
+} // namespace
+
+TEST(signature_similarity, identical_signatures_score_one)
+{
+    const Signature signature = test::SignatureOf(synthetic::Music(16000, QUERY_SECONDS, 5));
+    const SimilarityResult result = CompareSignatures(signature, signature);
+    CHECK_EQ(result.score, 1.0);
+    CHECK_EQ(result.offset_passes, 0);
+    CHECK_EQ(result.matched_peaks, static_cast<std::uint32_t>(signature.SumOfPeaksLength()));
+
+    // An empty signature shares nothing
+    const Signature empty(16000, 0);
+    CHECK_EQ(CompareSignatures(signature, empty).score, 0.0);
+    CHECK_EQ(CompareSignatures(empty, empty).matched_peaks, 0u);
+}
+
+TEST(signature_similarity, finds_the_offset_of_an_excerpt)
+{
+    const std::vector<double> track = synthetic::Music(16000, TRACK_SECONDS, 6);
+    const Signature whole = test::SignatureOf(track);
+    for (double start : {0.0, 5.0, 11.5, TRACK_SECONDS - QUERY_SECONDS})
+    {
+        const Signature excerpt = test::SignatureOf(test::Excerpt(track, start, QUERY_SECONDS));
+        const SimilarityResult forward = CompareSignatures(whole, excerpt);
+        if (!CHECK(nearOffset(forward.offset_passes, start)))
+        {
+            test::Fail(__FILE__, __LINE__,
+                       "offset " + test::Describe(forward.offset_passes) + " for " +
+                           test::Describe(start) + " s");
+        }
+        CHECK(forward.score > 0.8);
+        // The other way round the offset changes sign and the score stays
+        const SimilarityResult backward = CompareSignatures(excerpt, whole);
+        CHECK(nearOffset(-backward.offset_passes, start));
+        CHECK_EQ(backward.score, forward.score);
+    }
+}
+
+TEST(signature_similarity, score_follows_the_shared_audio)
+{
+    // The first `shared` seconds of each query are the reference, the rest
+    // another sound, so the shared time range is always the whole query
+    const std::vector<double> track = synthetic::Music(16000, TRACK_SECONDS, 7);
+    const std::vector<double> reference_audio = test::Excerpt(track, 4.0, QUERY_SECONDS);
+    const Signature reference = test::SignatureOf(reference_audio);
+    const std::vector<double> filler = synthetic::Chirp(16000, QUERY_SECONDS, 300.0, 3000.0);
+
+    double previous_score = 1.0;
+    for (double shared : {8.0, 6.0, 4.0, 2.0})
+    {
+        const std::vector<double> query =
+            concatenate(test::Excerpt(reference_audio, 0.0, shared),
+                        test::Excerpt(filler, shared, QUERY_SECONDS - shared));
+        const SimilarityResult result = CompareSignatures(reference, test::SignatureOf(query));
+        CHECK(nearOffset(result.offset_passes, 0.0));
+        if (!CHECK(result.score < previous_score || shared == QUERY_SECONDS))
+        {
+            test::Fail(__FILE__, __LINE__,
+                       test::Describe(result.score) + " with " + test::Describe(shared) +
+                           " s shared");
+        }
+        previous_score = result.score;
+    }
+    CHECK(previous_score > 0.3);
+
+    // Audio with nothing in common scores below any of them
+    for (const auto &unrelated :
+         {synthetic::Noise(16000, QUERY_SECONDS, 8), filler,
+          synthetic::Mix(synthetic::Tone(16000, QUERY_SECONDS, 440.0), 0.5,
+                         synthetic::Tone(16000, QUERY_SECONDS, 1320.0), 0.5)})
+    {
+        CHECK(CompareSignatures(reference, test::SignatureOf(unrelated)).score < 0.1);
+    }
+}
+
+TEST(signature_similarity, rejects_different_sample_rates)
+{
+    const Signature at_16k(16000, 16000);
+    const Signature at_8k(8000, 8000);
+    CHECK_THROWS(CompareSignatures(at_16k, at_8k), std::invalid_argument);
+    CHECK_THROWS(CompareSignatures(at_8k, at_16k), std::invalid_argument);
+}
+
+TEST(signature_similarity, c_api_reports_microseconds)
+{
+    const std::vector<double> track = synthetic::Music(16000, TRACK_SECONDS, 9);
+    VibraSignature *whole = toC(test::SignatureOf(track));
+    VibraSignature *excerpt = toC(test::SignatureOf(test::Excerpt(track, 6.0, QUERY_SECONDS)));
+
+    VibraSimilarity similarity{};
+    CHECK_EQ(vibra_compare_signatures(whole, excerpt, &similarity), VIBRA_STATUS_DONE);
+    CHECK(similarity.score > 0.8);
+    // Within a pass of 8 ms
+    CHECK(std::llabs(similarity.offset_us - 6000000) <= 8000);
+    CHECK(similarity.matched_peaks > 0u);
+
+    vibra_signature_free(excerpt);
+    vibra_signature_free(whole);
+}
@@ -0,0 +1,253 @@
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "algorithm/signature.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "test_util.h"
+#include "utils/base64.h"
+#include "utils/crc32.h"
+#include "vibra.h"
+
+namespace
+{
+constexpr char URI_PREFIX[] = "data:audio/vnd.shazam.sig;base64,";
+constexpr std::size_t URI_PREFIX_SIZE = sizeof(URI_PREFIX) - 1;
+// Header, then the contents tag and size
+constexpr std::size_t FIRST_BAND_OFFSET = sizeof(RawSignatureHeader) + 8;
+
+std::uint32_t load32(const std::string &binary, std::size_t offset)
+{
+    std::uint32_t value;
+    std::memcpy(&value, binary.data() + offset, sizeof(value));
+    return value;
+}
+
+void store32(std::string *binary, std::size_t offset, std::uint32_t value)
+{
+    std::memcpy(&(*binary)[offset], &value, sizeof(value));
+}
+
+// Sets the CRC of an edited signature, so that the decoder gets past it
+std::string resign(std::string binary)
+{
+    store32(&binary, 4, crc32::crc32(binary.data() + 8, binary.size() - 8));
+    return binary;
+}
+
+void addPeak(Signature *signature, FrequencyBand band, std::uint32_t pass,
+             std::uint32_t magnitude, std::uint32_t bin)
+{
+    signature->frequency_band_to_peaks()[band].emplace_back(pass, magnitude, bin,
+                                                            signature->sample_rate());
+}
+
+// Every band, and gaps of 255 passes and more that need a pass escape
+Signature handMadeSignature()
+{
+    Signature signature(16000, 16000 * 30);
+    addPeak(&signature, FrequencyBand::_0_150, 3, 9000, 600);
+    addPeak(&signature, FrequencyBand::_250_520, 0, 12000, 1400);
+    addPeak(&signature, FrequencyBand::_250_520, 254, 12001, 1500);
+    addPeak(&signature, FrequencyBand::_250_520, 509, 12002, 1600);
+    addPeak(&signature, FrequencyBand::_520_1450, 700, 20000, 3000);
+    addPeak(&signature, FrequencyBand::_1450_3500, 255, 30000, 9000);
+    addPeak(&signature, FrequencyBand::_1450_3500, 3000, 30001, 9001);
+    addPeak(&signature, FrequencyBand::_3500_5500, 1, 65535, 65535);
+    return signature;
+}
+
+// A single band holding two peaks: 10 payload bytes and 2 of padding
+std::string twoPeakBinary()
+{
+    Signature signature(16000, 16000);
+    addPeak(&signature, FrequencyBand::_520_1450, 5, 1000, 2000);
+    addPeak(&signature, FrequencyBand::_520_1450, 9, 1001, 2001);
+    return signature.EncodeBinary();
+}
+
+bool samePeaks(const Signature &a, const Signature &b)
+{
+    const auto &a_bands = a.frequency_band_to_peaks();
+    const auto &b_bands = b.frequency_band_to_peaks();
+    if (a_bands.size() != b_bands.size())
+    {
+        return false;
+    }
+    for (auto a_it = a_bands.begin(), b_it = b_bands.begin(); a_it != a_bands.end();
+         ++a_it, ++b_it)
+    {
+        if (a_it->first != b_it->first || a_it->second.size() != b_it->second.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < a_it->second.size(); ++i)
+        {
+            const FrequencyPeak &p = a_it->second[i];
+            const FrequencyPeak &q = b_it->second[i];
+            if (p.fft_pass_number() != q.fft_pass_number() ||
+                p.peak_magnitude() != q.peak_magnitude() ||
+                p.corrected_peak_frequency_bin() != q.corrected_peak_frequency_bin())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+std::string bytesToUri(const std::string &binary)
+{
+    return URI_PREFIX + base64::encode(binary.data(), binary.size());
+}
+} // namespace
+
+TEST(signature, round_trip_is_byte_identical)
+{
+    const Signature generated = test::SignatureOf(synthetic::Music(16000, 12.0, 34));
+    const Signature hand_made = handMadeSignature();
+    for (const Signature *original : {&generated, &hand_made})
+    {
+        const std::string uri = original->EncodeBase64();
+        const Signature decoded = Signature::DecodeBase64(uri.data(), uri.size());
+        CHECK(samePeaks(decoded, *original));
+        CHECK_EQ(decoded.num_samples(), original->num_samples());
+        CHECK_EQ(decoded.EncodeBase64(), uri);
+        CHECK_EQ(decoded.EncodeBinary(), original->EncodeBinary());
+    }
+    // The decoder rebuilds the digest the generator computed as it went
+    const std::string uri = generated.EncodeBase64();
+    CHECK(Signature::DecodeBase64(uri.data(), uri.size()).digest() == generated.digest());
+    CHECK(generated.SumOfPeaksLength() > 100u);
+}
+
+TEST(signature, prefix_is_optional)
+{
+    const std::string uri = handMadeSignature().EncodeBase64();
+    REQUIRE(uri.compare(0, URI_PREFIX_SIZE, URI_PREFIX) == 0);
+    const std::string bare = uri.substr(URI_PREFIX_SIZE);
+    const Signature with_prefix = Signature::DecodeBase64(uri.data(), uri.size());
+    const Signature without_prefix = Signature::DecodeBase64(bare.data(), bare.size());
+    CHECK(samePeaks(with_prefix, without_prefix));
+    CHECK_EQ(without_prefix.EncodeBase64(), uri);
+
+    // Through the C API, which also re-encodes
+    for (const std::string *text : {&uri, &bare})
+    {
+        VibraSignature *signature =
+            vibra_signature_from_uri(text->data(), static_cast<int>(text->size()));
+        REQUIRE(signature != nullptr);
+        CHECK_EQ(vibra_signature_get_peak_count(signature), 8);
+        CHECK_EQ(vibra_signature_get_sample_ms(signature), 30000u);
+        Fingerprint *fingerprint = vibra_signature_to_fingerprint(signature);
+        REQUIRE(fingerprint != nullptr);
+        CHECK_EQ(std::string(vibra_get_uri_from_fingerprint(fingerprint)), uri);
+        vibra_free_fingerprint(fingerprint);
+        vibra_signature_free(signature);
+    }
+}
+
+TEST(signature, long_signatures_keep_their_duration)
+{
+    // num_samples * 1000 no longer fits 32 bits past about 268 s at 16 kHz
+    Signature signature(16000, 16000 * 600);
+    addPeak(&signature, FrequencyBand::_520_1450, 5, 1000, 2000);
+    const std::string uri = signature.EncodeBase64();
+    VibraSignature *decoded = vibra_signature_from_uri(uri.data(), static_cast<int>(uri.size()));
+    REQUIRE(decoded != nullptr);
+    CHECK_EQ(vibra_signature_get_sample_ms(decoded), 600000u);
+    Fingerprint *fingerprint = vibra_signature_to_fingerprint(decoded);
+    REQUIRE(fingerprint != nullptr);
+    CHECK_EQ(vibra_get_sample_ms_from_fingerprint(fingerprint), 600000u);
+    vibra_free_fingerprint(fingerprint);
+    vibra_signature_free(decoded);
+}
+
+TEST(signature, rejects_truncated_input)
+{
+    const std::string binary = handMadeSignature().EncodeBinary();
+    for (std::size_t size = 0; size < binary.size(); ++size)
+    {
+        CHECK_THROWS(Signature::DecodeBinary(binary.data(), size), std::runtime_error);
+    }
+    const std::string uri = bytesToUri(binary);
+    for (std::size_t cut : {1u, 2u, 3u, 4u, 8u})
+    {
+        CHECK_THROWS(Signature::DecodeBase64(uri.data(), uri.size() - cut), std::runtime_error);
+        CHECK(vibra_signature_from_uri(uri.data(), static_cast<int>(uri.size() - cut)) ==
+              nullptr);
+    }
+    CHECK_THROWS(Signature::DecodeBase64(URI_PREFIX, URI_PREFIX_SIZE), std::runtime_error);
+    CHECK_THROWS(Signature::DecodeBase64("data:audio/vnd.shazam.sig;base64,*@#!", 37),
+                 std::runtime_error);
+}
+
+TEST(signature, rejects_bad_crc_and_magic)
+{
+    const std::string binary = handMadeSignature().EncodeBinary();
+    CHECK(samePeaks(Signature::DecodeBinary(binary.data(), binary.size()), handMadeSignature()));
+
+    // A flipped bit anywhere the CRC covers
+    for (std::size_t offset = 8; offset < binary.size(); offset += 7)
+    {
+        std::string corrupt = binary;
+        corrupt[offset] ^= 0x10;
+        CHECK_THROWS(Signature::DecodeBinary(corrupt.data(), corrupt.size()), std::runtime_error);
+    }
+    std::string bad_crc = binary;
+    store32(&bad_crc, 4, load32(binary, 4) + 1);
+    CHECK_THROWS(Signature::DecodeBinary(bad_crc.data(), bad_crc.size()), std::runtime_error);
+    const std::string bad_crc_uri = bytesToUri(bad_crc);
+    CHECK(vibra_signature_from_uri(bad_crc_uri.data(), static_cast<int>(bad_crc_uri.size())) ==
+          nullptr);
+
+    // Magic numbers are checked before the CRC, re-signing does not help
+    for (std::size_t magic_offset : {0u, 12u})
+    {
+        std::string bad_magic = binary;
+        store32(&bad_magic, magic_offset, load32(binary, magic_offset) ^ 1);
+        bad_magic = resign(bad_magic);
+        CHECK_THROWS(Signature::DecodeBinary(bad_magic.data(), bad_magic.size()),
+                     std::runtime_error);
+    }
+}
+
+TEST(signature, rejects_band_and_peak_overruns)
+{
+    const std::string binary = twoPeakBinary();
+    REQUIRE_EQ(binary.size(), FIRST_BAND_OFFSET + 8 + 12);
+    REQUIRE_EQ(load32(binary, FIRST_BAND_OFFSET + 4), 10u);
+    CHECK_EQ(Signature::DecodeBinary(binary.data(), binary.size()).SumOfPeaksLength(), 2u);
+
+    auto withPayloadSize = [&binary](std::uint32_t payload_size) {
+        std::string edited = binary;
+        store32(&edited, FIRST_BAND_OFFSET + 4, payload_size);
+        return resign(edited);
+    };
+    // Past the end of the signature, with or without its padding
+    for (std::uint32_t payload_size : {13u, 16u, 0x7fffffffu, 0xffffffffu})
+    {
+        const std::string edited = withPayloadSize(payload_size);
+        CHECK_THROWS(Signature::DecodeBinary(edited.data(), edited.size()), std::runtime_error);
+    }
+    // Ending inside a peak
+    for (std::uint32_t payload_size : {3u, 8u, 12u})
+    {
+        const std::string edited = withPayloadSize(payload_size);
+        CHECK_THROWS(Signature::DecodeBinary(edited.data(), edited.size()), std::runtime_error);
+    }
+    // A pass escape with no peak left after it in the band
+    std::string escape = binary;
+    escape[FIRST_BAND_OFFSET + 8 + 5] = '\xff';
+    escape = resign(escape);
+    CHECK_THROWS(Signature::DecodeBinary(escape.data(), escape.size()), std::runtime_error);
+
+    // An unknown band tag
+    std::string unknown_band = binary;
+    store32(&unknown_band, FIRST_BAND_OFFSET, load32(binary, FIRST_BAND_OFFSET) + 10);
+    unknown_band = resign(unknown_band);
+    CHECK_THROWS(Signature::DecodeBinary(unknown_band.data(), unknown_band.size()),
+                 std::runtime_error);
+}
@@ -0,0 +1,112 @@
+#ifndef TESTS_TEST_H_
+#define TESTS_TEST_H_
+
+#include <sstream>
+#include <string>
+
+// A minimal test registry for vibra_tests, which must build wherever the
+// library does without pulling in a framework.
+//
+//   TEST(base64, round_trip)
+//   {
+//       CHECK_EQ(base64::encode("ab", 2), "YWI=");
+//   }
+//
+// CHECK* record a failure and let the test go on, REQUIRE* end the test.
+// The suite of a test is the name of its file, <suite>_test.cpp, so that
+// CTest can run each file on its own.
+namespace test
+{
+typedef void (*TestFunc)();
+
+struct Registration
+{
+    Registration(const char *suite, const char *name, TestFunc func);
+};
+
+// Thrown by REQUIRE* to end the current test, caught by the runner
+struct Abort
+{
+};
+
+void Fail(const char *file, int line, const std::string &message);
+
+template <typename T> std::string Describe(const T &value)
+{
+    std::ostringstream out;
+    out << value;
+    return out.str();
+}
+
+inline std::string Describe(const std::string &value)
+{
+    return "\"" + value + "\"";
+}
+
+inline std::string Describe(bool value)
+{
+    return value ? "true" : "false";
+}
+
+template <typename A, typename B>
+bool CheckEqual(const A &a, const B &b, const char *a_text, const char *b_text, const char *file,
+                int line)
+{
+    if (a == b)
+    {
+        return true;
+    }
+    Fail(file, line,
+         std::string(a_text) + " == " + b_text + ", got " + Describe(a) + " and " + Describe(b));
+    return false;
+}
+} // namespace test
+
+#define TEST(suite, name)                                                                    \
+    static void suite##_##name();                                                            \
+    static const test::Registration suite##_##name##_registration(#suite, #name,             \
+                                                                  &suite##_##name);          \
+    static void suite##_##name()
+
+#define CHECK(condition)                                                                     \
+    ((condition) ? true : (test::Fail(__FILE__, __LINE__, "CHECK(" #condition ")"), false))
+
+#define CHECK_EQ(a, b) test::CheckEqual((a), (b), #a, #b, __FILE__, __LINE__)
+
+#define CHECK_THROWS(expression, exception)                                                  \
+    do                                                                                       \
+    {                                                                                        \
+        bool thrown = false;                                                                 \
+        try                                                                                  \
+        {                                                                                    \
+            (void)(expression);                                                              \
+        }                                                                                    \
+        catch (const exception &)                                                            \
+        {                                                                                    \
+            thrown = true;                                                                   \
+        }                                                                                    \
+        if (!thrown)                                                                         \
+        {                                                                                    \
+            test::Fail(__FILE__, __LINE__, #expression " did not throw " #exception);        \
+        }                                                                                    \
+    } while (0)
+
+#define REQUIRE(condition)                                                                   \
+    do                                                                                       \
+    {                                                                                        \
+        if (!CHECK(condition))                                                               \
+        {                                                                                    \
+            throw test::Abort();                                                             \
+        }                                                                                    \
+    } while (0)
+
+#define REQUIRE_EQ(a, b)                                                                     \
+    do                                                                                       \
+    {                                                                                        \
+        if (!CHECK_EQ(a, b))                                                                 \
+        {                                                                                    \
+            throw test::Abort();                                                             \
+        }                                                                                    \
+    } while (0)
+
+#endif // TESTS_TEST_H_
@@ -0,0 +1,111 @@
+#include "test_util.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "algorithm/fingerprint_session.h"
+#include "synthetic_audio.h"
+
+namespace test
+{
+TempDir::TempDir()
+{
+    const char *base = std::getenv("TMPDIR");
+    std::string pattern = std::string(base != nullptr && base[0] != '\0' ? base : "/tmp") +
+                          "/vibra_tests-XXXXXX";
+    if (::mkdtemp(&pattern[0]) == nullptr)
+    {
+        throw std::runtime_error("Cannot create a directory from " + pattern + ": " +
+                                 std::strerror(errno));
+    }
+    path_ = pattern;
+}
+
+TempDir::~TempDir()
+{
+    removeTree(path_);
+}
+
+std::string TempDir::File(const std::string &name) const
+{
+    return path_ + "/" + name;
+}
+
+void TempDir::removeTree(const std::string &path)
+{
+    DIR *dir = ::opendir(path.c_str());
+    if (dir != nullptr)
+    {
+        while (const dirent *entry = ::readdir(dir))
+        {
+            const std::string name = entry->d_name;
+            if (name == "." || name == "..")
+            {
+                continue;
+            }
+            const std::string child = path + "/" + name;
+            struct stat info;
+            if (::lstat(child.c_str(), &info) == 0 && S_ISDIR(info.st_mode))
+            {
+                removeTree(child);
+            }
+            else
+            {
+                ::unlink(child.c_str());
+            }
+        }
+        ::closedir(dir);
+    }
+    ::rmdir(path.c_str());
+}
+
+std::string ReadFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        throw std::runtime_error("Cannot read " + path);
+    }
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const std::string &path, const std::string &data)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << data;
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+std::vector<char> Pcm16k(const std::vector<double> &signal)
+{
+    return synthetic::EncodePcm(signal, SampleFormat::SIGNED_INTEGER, 2, 1);
+}
+
+Signature SignatureOf(const std::vector<double> &signal)
+{
+    const std::vector<char> pcm = Pcm16k(signal);
+    FingerprintSession session(pcm.data(), pcm.size(), SampleFormat::SIGNED_INTEGER,
+                               LOW_QUALITY_SAMPLE_RATE, 16, 1,
+                               std::numeric_limits<double>::infinity());
+    return session.Finish();
+}
+
+std::vector<double> Excerpt(const std::vector<double> &signal, double begin, double seconds)
+{
+    const std::size_t first =
+        std::min(signal.size(), static_cast<std::size_t>(begin * LOW_QUALITY_SAMPLE_RATE));
+    const std::size_t last = std::min(
+        signal.size(), first + static_cast<std::size_t>(seconds * LOW_QUALITY_SAMPLE_RATE));
+    return std::vector<double>(signal.begin() + first, signal.begin() + last);
+}
+} // namespace test
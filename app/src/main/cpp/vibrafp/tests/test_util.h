@@ -0,0 +1,46 @@
+#ifndef TESTS_TEST_UTIL_H_
+#define TESTS_TEST_UTIL_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "algorithm/signature.h"
+
+namespace test
+{
+// A fresh directory under $TMPDIR, removed with everything in it when the
+// object goes out of scope
+class TempDir
+{
+public:
+    TempDir();
+    TempDir(const TempDir &) = delete;
+    TempDir &operator=(const TempDir &) = delete;
+    ~TempDir();
+
+    inline const std::string &path() const
+    {
+        return path_;
+    }
+    std::string File(const std::string &name) const;
+
+private:
+    static void removeTree(const std::string &path);
+
+    std::string path_;
+};
+
+std::string ReadFile(const std::string &path);
+void WriteFile(const std::string &path, const std::string &data);
+
+// `signal` as mono int16 PCM at 16 kHz, the rate the generator works at
+std::vector<char> Pcm16k(const std::vector<double> &signal);
+
+// The signature of all of a 16 kHz `signal`, however long
+Signature SignatureOf(const std::vector<double> &signal);
+
+// Samples [begin, begin + seconds) of a 16 kHz `signal`
+std::vector<double> Excerpt(const std::vector<double> &signal, double begin, double seconds);
+} // namespace test
+
+#endif // TESTS_TEST_UTIL_H_
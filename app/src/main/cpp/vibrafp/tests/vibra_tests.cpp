@@ -0,0 +1,137 @@
+// Behaviour tests of the library.
+//
+//   vibra_tests [--list] [SUITE | SUITE.NAME ...]
+//
+// Runs every test, or those of the suites and tests named. CTest runs one
+// suite per entry, see lib/CMakeLists.txt. A name that matches no test is an
+// error, so that a renamed suite cannot silently stop running.
+//
+// Exit status: 0 if every test run passed, 1 otherwise.
+
+#include "test.h"
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace
+{
+struct TestCase
+{
+    const char *suite;
+    const char *name;
+    test::TestFunc func;
+};
+
+std::vector<TestCase> &registry()
+{
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+int g_failures = 0; // of the running test
+
+bool selected(const TestCase &test, const std::vector<std::string> &filters,
+              std::vector<bool> *used)
+{
+    if (filters.empty())
+    {
+        return true;
+    }
+    const std::string suite = test.suite;
+    const std::string full_name = suite + "." + test.name;
+    bool any = false;
+    for (std::size_t i = 0; i < filters.size(); ++i)
+    {
+        if (filters[i] == suite || filters[i] == full_name)
+        {
+            (*used)[i] = true;
+            any = true;
+        }
+    }
+    return any;
+}
+} // namespace
+
+namespace test
+{
+Registration::Registration(const char *suite, const char *name, TestFunc func)
+{
+    registry().push_back(TestCase{suite, name, func});
+}
+
+void Fail(const char *file, int line, const std::string &message)
+{
+    ++g_failures;
+    std::fprintf(stderr, "%s:%d: failed: %s\n", file, line, message.c_str());
+}
+} // namespace test
+
+int main(int argc, char **argv)
+{
+    bool list = false;
+    std::vector<std::string> filters;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--list")
+        {
+            list = true;
+        }
+        else if (!arg.empty() && arg[0] == '-')
+        {
+            std::fprintf(stderr, "usage: %s [--list] [SUITE | SUITE.NAME ...]\n", argv[0]);
+            return 1;
+        }
+        else
+        {
+            filters.push_back(arg);
+        }
+    }
+
+    std::vector<bool> used(filters.size(), false);
+    int run = 0;
+    int failed = 0;
+    for (const auto &test : registry())
+    {
+        if (!selected(test, filters, &used))
+        {
+            continue;
+        }
+        if (list)
+        {
+            std::printf("%s.%s\n", test.suite, test.name);
+            continue;
+        }
+        g_failures = 0;
+        try
+        {
+            test.func();
+        }
+        catch (const test::Abort &)
+        {
+        }
+        catch (const std::exception &e)
+        {
+            test::Fail(__FILE__, __LINE__, std::string("uncaught exception: ") + e.what());
+        }
+        ++run;
+        failed += g_failures != 0 ? 1 : 0;
+        std::printf("%s %s.%s\n", g_failures != 0 ? "FAIL" : "ok  ", test.suite, test.name);
+    }
+
+    int status = failed == 0 ? 0 : 1;
+    for (std::size_t i = 0; i < filters.size(); ++i)
+    {
+        if (!used[i])
+        {
+            std::fprintf(stderr, "No test matches %s\n", filters[i].c_str());
+            status = 1;
+        }
+    }
+    if (!list)
+    {
+        std::printf("%d of %d tests passed\n", run - failed, run);
+    }
+    return status;
+}
@@ -0,0 +1,266 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "audio/wav.h"
+#include "synthetic_audio.h"
+#include "test.h"
+#include "vibra.h"
+
+namespace
+{
+// KSDATAFORMAT_SUBTYPE_PCM and _IEEE_FLOAT but for their leading format code
+const std::uint8_t GUID_SUFFIX[14] = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+                                      0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+
+void appendLe(std::vector<char> *out, std::uint32_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        out->push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+
+void appendChunk(std::vector<char> *out, const char *id, const std::vector<char> &body,
+                 std::uint32_t declared_size)
+{
+    out->insert(out->end(), id, id + 4);
+    appendLe(out, declared_size, 4);
+    out->insert(out->end(), body.begin(), body.end());
+}
+
+void appendChunk(std::vector<char> *out, const char *id, const std::vector<char> &body)
+{
+    appendChunk(out, id, body, static_cast<std::uint32_t>(body.size()));
+    if (body.size() % 2 != 0)
+    {
+        out->push_back('\0'); // pad byte
+    }
+}
+
+// The 16 bytes every fmt chunk starts with
+std::vector<char> fmtBody(std::uint16_t audio_format, std::uint32_t rate, std::uint32_t width,
+                          std::uint32_t channels)
+{
+    std::vector<char> body;
+    appendLe(&body, audio_format, 2);
+    appendLe(&body, channels, 2);
+    appendLe(&body, rate, 4);
+    appendLe(&body, rate * channels * width, 4);
+    appendLe(&body, channels * width, 2);
+    appendLe(&body, width * 8, 2);
+    return body;
+}
+
+std::vector<char> extensibleFmtBody(std::uint16_t sub_format, std::uint32_t rate,
+                                    std::uint32_t width, std::uint32_t channels)
+{
+    std::vector<char> body = fmtBody(0xFFFE, rate, width, channels);
+    appendLe(&body, 22, 2);        // extension size
+    appendLe(&body, width * 8, 2); // valid bits per sample
+    appendLe(&body, channels == 1 ? 0x4 : 0x3, 4);
+    appendLe(&body, sub_format, 2);
+    body.insert(body.end(), GUID_SUFFIX, GUID_SUFFIX + sizeof(GUID_SUFFIX));
+    return body;
+}
+
+// RIFF/WAVE around `chunks`, which hold whole chunks with their headers
+std::vector<char> riff(const std::vector<char> &chunks)
+{
+    std::vector<char> wav = {'R', 'I', 'F', 'F'};
+    appendLe(&wav, static_cast<std::uint32_t>(chunks.size() + 4), 4);
+    wav.insert(wav.end(), {'W', 'A', 'V', 'E'});
+    wav.insert(wav.end(), chunks.begin(), chunks.end());
+    return wav;
+}
+
+Wav view(const std::vector<char> &wav)
+{
+    return Wav::ViewRawWav(wav.data(), static_cast<std::uint32_t>(wav.size()));
+}
+
+std::string wavUri(const std::vector<char> &wav)
+{
+    Fingerprint *fingerprint =
+        vibra_get_fingerprint_from_wav_data(wav.data(), static_cast<int>(wav.size()));
+    REQUIRE(fingerprint != nullptr);
+    const std::string uri = vibra_get_uri_from_fingerprint(fingerprint);
+    vibra_free_fingerprint(fingerprint);
+    return uri;
+}
+
+std::string signedPcmUri(const std::vector<char> &pcm, int rate, int width, int channels)
+{
+    Fingerprint *fingerprint = vibra_get_fingerprint_from_signed_pcm(
+        pcm.data(), static_cast<int>(pcm.size()), rate, width * 8, channels);
+    REQUIRE(fingerprint != nullptr);
+    const std::string uri = vibra_get_uri_from_fingerprint(fingerprint);
+    vibra_free_fingerprint(fingerprint);
+    return uri;
+}
+} // namespace
+
+TEST(wav, integer_widths)
+{
+    const std::vector<double> music = synthetic::Music(22050, 4.0, 5);
+    for (std::uint32_t width : {2u, 3u, 4u})
+    {
+        const std::vector<char> pcm =
+            synthetic::EncodePcm(music, SampleFormat::SIGNED_INTEGER, width, 2);
+        const std::vector<char> wav =
+            synthetic::WrapWav(pcm, SampleFormat::SIGNED_INTEGER, 22050, width, 2);
+        const Wav parsed = view(wav);
+        CHECK(parsed.sample_format() == SampleFormat::SIGNED_INTEGER);
+        CHECK_EQ(parsed.bits_per_sample(), width * 8);
+        CHECK_EQ(parsed.num_channels(), 2);
+        CHECK_EQ(parsed.sample_rate_(), 22050u);
+        CHECK_EQ(parsed.data_size(), pcm.size());
+        CHECK(parsed.data() == reinterpret_cast<const std::uint8_t *>(wav.data()) + 44);
+        CHECK_EQ(wavUri(wav), signedPcmUri(pcm, 22050, width, 2));
+    }
+}
+
+TEST(wav, unsigned_8_bit)
+{
+    const std::vector<char> pcm = synthetic::EncodePcm(synthetic::Music(11025, 4.0, 6),
+                                                       SampleFormat::UNSIGNED_INTEGER, 1, 1);
+    const std::vector<char> wav =
+        synthetic::WrapWav(pcm, SampleFormat::UNSIGNED_INTEGER, 11025, 1, 1);
+    const Wav parsed = view(wav);
+    CHECK(parsed.sample_format() == SampleFormat::UNSIGNED_INTEGER);
+    CHECK_EQ(parsed.bits_per_sample(), 8u);
+
+    // Silence is 0x80, so the same samples as signed bytes differ in the top bit
+    std::vector<char> as_signed = pcm;
+    for (char &sample : as_signed)
+    {
+        sample = static_cast<char>(sample ^ 0x80);
+    }
+    CHECK_EQ(wavUri(wav), signedPcmUri(as_signed, 11025, 1, 1));
+}
+
+TEST(wav, extensible)
+{
+    const std::vector<double> music = synthetic::Music(48000, 3.0, 7);
+    const std::vector<char> pcm = synthetic::EncodePcm(music, SampleFormat::SIGNED_INTEGER, 3, 2);
+    std::vector<char> chunks;
+    appendChunk(&chunks, "fmt ", extensibleFmtBody(1, 48000, 3, 2));
+    appendChunk(&chunks, "data", pcm);
+    const std::vector<char> wav = riff(chunks);
+
+    const Wav parsed = view(wav);
+    CHECK_EQ(parsed.audio_format(), 1);
+    CHECK(parsed.sample_format() == SampleFormat::SIGNED_INTEGER);
+    CHECK_EQ(parsed.bits_per_sample(), 24u);
+    CHECK_EQ(parsed.data_size(), pcm.size());
+    CHECK_EQ(wavUri(wav),
+             wavUri(synthetic::WrapWav(pcm, SampleFormat::SIGNED_INTEGER, 48000, 3, 2)));
+
+    const std::vector<char> floats = synthetic::EncodePcm(music, SampleFormat::FLOAT, 4, 2);
+    chunks.clear();
+    appendChunk(&chunks, "fmt ", extensibleFmtBody(3, 48000, 4, 2));
+    appendChunk(&chunks, "data", floats);
+    const Wav parsed_float = view(riff(chunks));
+    CHECK_EQ(parsed_float.audio_format(), 3);
+    CHECK(parsed_float.sample_format() == SampleFormat::FLOAT);
+}
+
+TEST(wav, rejects_unknown_sub_formats)
+{
+    const std::vector<char> pcm(64);
+    std::vector<char> body = extensibleFmtBody(1, 16000, 2, 1);
+    body[body.size() - 1] ^= 0x01; // not a KSDATAFORMAT_SUBTYPE GUID
+    std::vector<char> chunks;
+    appendChunk(&chunks, "fmt ", body);
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+
+    // A GUID of the family, but for a format that is not PCM
+    chunks.clear();
+    appendChunk(&chunks, "fmt ", extensibleFmtBody(2, 16000, 2, 1));
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+
+    // Too short for the extension it announces
+    body = fmtBody(0xFFFE, 16000, 2, 1);
+    appendLe(&body, 0, 2);
+    chunks.clear();
+    appendChunk(&chunks, "fmt ", body);
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+}
+
+TEST(wav, pad_bytes_and_odd_chunks)
+{
+    const std::vector<char> pcm = synthetic::EncodePcm(synthetic::Tone(16000, 1.0, 440.0),
+                                                       SampleFormat::SIGNED_INTEGER, 2, 1);
+    // A fmt chunk with one trailing byte, then an odd-sized chunk the parser
+    // skips, both followed by their pad byte
+    std::vector<char> fmt = fmtBody(1, 16000, 2, 1);
+    fmt.push_back('\x7f');
+    std::vector<char> chunks;
+    appendChunk(&chunks, "fmt ", fmt);
+    appendChunk(&chunks, "LIST", std::vector<char>(5, 'x'));
+    appendChunk(&chunks, "data", pcm);
+    const std::vector<char> wav = riff(chunks);
+
+    const Wav parsed = view(wav);
+    CHECK_EQ(parsed.sample_rate_(), 16000u);
+    CHECK_EQ(parsed.bits_per_sample(), 16u);
+    CHECK_EQ(parsed.data_size(), pcm.size());
+    CHECK(parsed.data() == reinterpret_cast<const std::uint8_t *>(wav.data()) + wav.size() -
+                               pcm.size());
+
+    // An odd data chunk is followed by its pad byte before the fmt chunk
+    std::vector<char> odd_pcm(pcm.begin(), pcm.begin() + 1001);
+    chunks.clear();
+    appendChunk(&chunks, "data", odd_pcm);
+    appendChunk(&chunks, "fmt ", fmtBody(1, 16000, 1, 1));
+    const Wav data_first = view(riff(chunks));
+    CHECK_EQ(data_first.data_size(), 1001u);
+    CHECK_EQ(data_first.bits_per_sample(), 8u);
+    CHECK(data_first.sample_format() == SampleFormat::UNSIGNED_INTEGER);
+}
+
+TEST(wav, data_size_is_clamped)
+{
+    const std::vector<char> pcm(4000, '\0');
+    // Streaming writers leave 0xFFFFFFFF until the file is complete
+    for (std::uint32_t declared : {0xFFFFFFFFu, 4001u, 1000000u})
+    {
+        std::vector<char> chunks;
+        appendChunk(&chunks, "fmt ", fmtBody(1, 16000, 2, 1));
+        appendChunk(&chunks, "data", pcm, declared);
+        const std::vector<char> wav = riff(chunks);
+        const Wav viewed = view(wav);
+        CHECK_EQ(viewed.data_size(), pcm.size());
+        const Wav copied = Wav::FromRawWav(wav.data(), static_cast<std::uint32_t>(wav.size()));
+        CHECK_EQ(copied.data_size(), pcm.size());
+    }
+}
+
+TEST(wav, rejects_malformed_chunks)
+{
+    const std::vector<char> pcm(64);
+    std::vector<char> chunks;
+    // fmt shorter than its fixed fields
+    std::vector<char> fmt = fmtBody(1, 16000, 2, 1);
+    fmt.resize(14);
+    appendChunk(&chunks, "fmt ", fmt);
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+
+    // Neither ADPCM nor any other compressed format
+    chunks.clear();
+    appendChunk(&chunks, "fmt ", fmtBody(2, 16000, 2, 1));
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+
+    // No data chunk, and no fmt chunk
+    chunks.clear();
+    appendChunk(&chunks, "fmt ", fmtBody(1, 16000, 2, 1));
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+    chunks.clear();
+    appendChunk(&chunks, "data", pcm);
+    CHECK_THROWS(view(riff(chunks)), std::runtime_error);
+}
@@ -0,0 +1,157 @@
+#include "synthetic_audio.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+constexpr double PI = 3.14159265358979323846;
+
+// Numerical Recipes LCG, enough for test signals
+inline std::uint32_t nextRandom(std::uint32_t *state)
+{
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+void appendLe(std::vector<char> *out, std::uint32_t value, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        out->push_back(static_cast<char>(value >> (8 * i)));
+    }
+}
+} // namespace
+
+namespace synthetic
+{
+std::vector<double> Music(std::uint32_t rate, double seconds, std::uint32_t seed)
+{
+    const std::size_t frames = static_cast<std::size_t>(rate * seconds);
+    const std::size_t note_frames = rate / 4;
+    std::vector<double> samples(frames);
+    std::uint32_t state = seed;
+    double base = 220.0;
+    for (std::size_t i = 0; i < frames; ++i)
+    {
+        if (i % note_frames == 0)
+        {
+            base = 110.0 * std::pow(2.0, (nextRandom(&state) >> 24) % 36 / 12.0);
+        }
+        const double t = static_cast<double>(i) / rate;
+        const double in_note = static_cast<double>(i % note_frames) / rate;
+        double value = 0;
+        for (int harmonic = 1; harmonic <= 4; ++harmonic)
+        {
+            value += std::sin(2 * PI * base * harmonic * t) / harmonic;
+            value += std::sin(2 * PI * base * 1.5 * harmonic * t) / (2 * harmonic);
+        }
+        samples[i] = value * 0.25 * std::exp(-4 * in_note);
+    }
+    return samples;
+}
+
+std::vector<double> Tone(std::uint32_t rate, double seconds, double frequency)
+{
+    std::vector<double> samples(static_cast<std::size_t>(rate * seconds));
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        samples[i] = 0.5 * std::sin(2 * PI * frequency * i / rate);
+    }
+    return samples;
+}
+
+std::vector<double> Chirp(std::uint32_t rate, double seconds, double from, double to)
+{
+    std::vector<double> samples(static_cast<std::size_t>(rate * seconds));
+    // The phase of an exponential sweep has a closed form
+    const double k = std::log(to / from) / seconds;
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        const double t = static_cast<double>(i) / rate;
+        samples[i] = 0.5 * std::sin(2 * PI * from * (std::exp(k * t) - 1) / k);
+    }
+    return samples;
+}
+
+std::vector<double> Noise(std::uint32_t rate, double seconds, std::uint32_t seed)
+{
+    std::vector<double> samples(static_cast<std::size_t>(rate * seconds));
+    std::uint32_t state = seed;
+    for (auto &sample : samples)
+    {
+        sample = (nextRandom(&state) >> 8) / 8388608.0 - 1.0;
+    }
+    return samples;
+}
+
+std::vector<double> Mix(const std::vector<double> &a, double a_gain, const std::vector<double> &b,
+                        double b_gain)
+{
+    std::vector<double> samples(std::min(a.size(), b.size()));
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        samples[i] = a[i] * a_gain + b[i] * b_gain;
+    }
+    return samples;
+}
+
+std::vector<char> EncodePcm(const std::vector<double> &signal, SampleFormat format,
+                            std::uint32_t width, std::uint32_t channels)
+{
+    std::vector<char> pcm(signal.size() * channels * width);
+    char *out = pcm.data();
+    for (double value : signal)
+    {
+        value = std::max(-1.0, std::min(1.0, value));
+        for (std::uint32_t c = 0; c < channels; ++c, out += width)
+        {
+            if (format == SampleFormat::FLOAT && width == 4)
+            {
+                const float sample = static_cast<float>(value);
+                std::memcpy(out, &sample, width);
+            }
+            else if (format == SampleFormat::FLOAT)
+            {
+                std::memcpy(out, &value, width);
+            }
+            else
+            {
+                // Little-endian, the top `width` bytes of a 32-bit sample
+                const std::int32_t sample = static_cast<std::int32_t>(value * 2147483647.0);
+                std::uint32_t bits = static_cast<std::uint32_t>(sample);
+                if (format == SampleFormat::UNSIGNED_INTEGER)
+                {
+                    bits ^= 0x80000000u;
+                }
+                for (std::uint32_t b = 0; b < width; ++b)
+                {
+                    out[b] = static_cast<char>(bits >> (8 * (4 - width + b)));
+                }
+            }
+        }
+    }
+    return pcm;
+}
+
+std::vector<char> WrapWav(const std::vector<char> &pcm, SampleFormat format, std::uint32_t rate,
+                          std::uint32_t width, std::uint32_t channels)
+{
+    std::vector<char> wav;
+    wav.reserve(pcm.size() + 44);
+    wav.insert(wav.end(), {'R', 'I', 'F', 'F'});
+    appendLe(&wav, static_cast<std::uint32_t>(pcm.size() + 36), 4);
+    wav.insert(wav.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    appendLe(&wav, 16, 4);
+    appendLe(&wav, format == SampleFormat::FLOAT ? 3 : 1, 2);
+    appendLe(&wav, channels, 2);
+    appendLe(&wav, rate, 4);
+    appendLe(&wav, rate * channels * width, 4);
+    appendLe(&wav, channels * width, 2);
+    appendLe(&wav, width * 8, 2);
+    wav.insert(wav.end(), {'d', 'a', 't', 'a'});
+    appendLe(&wav, static_cast<std::uint32_t>(pcm.size()), 4);
+    wav.insert(wav.end(), pcm.begin(), pcm.end());
+    return wav;
+}
+} // namespace synthetic
@@ -0,0 +1,34 @@
+#ifndef TOOLS_SYNTHETIC_AUDIO_H_
+#define TOOLS_SYNTHETIC_AUDIO_H_
+
+#include <cstdint>
+#include <vector>
+#include "audio/downmix.h"
+
+// Deterministic test signals for the host tools, mono in [-1, 1]. The same
+// arguments give the same samples on every run; only libm rounding may differ
+// between platforms, which the PCM quantization absorbs in practice.
+namespace synthetic
+{
+// Chords of decaying harmonics, a new one every quarter second
+std::vector<double> Music(std::uint32_t rate, double seconds, std::uint32_t seed = 1);
+// A steady sine of `frequency` Hz
+std::vector<double> Tone(std::uint32_t rate, double seconds, double frequency);
+// A sine sweeping exponentially from `from` to `to` Hz
+std::vector<double> Chirp(std::uint32_t rate, double seconds, double from, double to);
+// Uniform white noise
+std::vector<double> Noise(std::uint32_t rate, double seconds, std::uint32_t seed);
+// Sample-wise weighted sum of two signals, the length of the shorter one
+std::vector<double> Mix(const std::vector<double> &a, double a_gain, const std::vector<double> &b,
+                        double b_gain);
+
+// Interleaves `signal` into `channels` identical channels of the given format,
+// `width` being the sample size in bytes. Values are clipped to [-1, 1].
+std::vector<char> EncodePcm(const std::vector<double> &signal, SampleFormat format,
+                            std::uint32_t width, std::uint32_t channels);
+// Prepends a canonical 44-byte WAV header to interleaved PCM
+std::vector<char> WrapWav(const std::vector<char> &pcm, SampleFormat format, std::uint32_t rate,
+                          std::uint32_t width, std::uint32_t channels);
+} // namespace synthetic
+
+#endif // TOOLS_SYNTHETIC_AUDIO_H_
@@ -0,0 +1,380 @@
+// Allocation budgets of the fingerprint pipeline.
+//
+//   vibra_alloc_check [--filter TEXT] [--verbose]
+//
+// Interposes the global operator new and, with glibc, malloc and friends, so
+// that the allocations of the library, the C++ runtime and FFTW are all
+// counted. Every case runs a pipeline stage on synthetic audio and compares
+// the allocations it made with its budget. The steady-state cases warm their
+// stage up first and then allow no allocation at all: a hop of the signature
+// generator, a block of the downsampler and a step of a fingerprint session.
+// The whole-call cases allow the fixed number of operator new calls a
+// fingerprint needs today. Their malloc calls, FFTW planning, depend on the
+// FFTW build and are only reported.
+//
+// A budget that fails after a change points at a new allocation on that
+// path. A change that removes allocations should lower the budget with it.
+//
+// Exit status: 0 if every case is within budget, 1 otherwise.
+
+#include "algorithm/fingerprint_session.h"
+#include "algorithm/signature.h"
+#include "algorithm/signature_generator.h"
+#include "audio/downsampler.h"
+#include "synthetic_audio.h"
+#include "vibra.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::atomic<std::uint64_t> g_new_calls(0);
+std::atomic<std::uint64_t> g_malloc_calls(0);
+std::atomic<std::uint64_t> g_allocated_bytes(0);
+} // namespace
+
+#ifdef __GLIBC__
+// glibc exports its allocator under these names too, so the interposed
+// functions below can forward to it without recursing into themselves
+extern "C"
+{
+void *__libc_malloc(std::size_t size);
+void *__libc_calloc(std::size_t count, std::size_t size);
+void *__libc_realloc(void *pointer, std::size_t size);
+void *__libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void *pointer);
+
+void *malloc(std::size_t size)
+{
+    g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size)
+{
+    g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(count * size, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *pointer, std::size_t size)
+{
+    g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    return __libc_realloc(pointer, size);
+}
+
+void *memalign(std::size_t alignment, std::size_t size)
+{
+    g_malloc_calls.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    return __libc_memalign(alignment, size);
+}
+
+void *aligned_alloc(std::size_t alignment, std::size_t size)
+{
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void **pointer, std::size_t alignment, std::size_t size)
+{
+    *pointer = memalign(alignment, size);
+    return *pointer != nullptr || size == 0 ? 0 : ENOMEM;
+}
+
+void free(void *pointer)
+{
+    __libc_free(pointer);
+}
+} // extern "C"
+
+constexpr bool COUNTS_MALLOC = true;
+#define VIBRA_RAW_MALLOC __libc_malloc
+#define VIBRA_RAW_FREE __libc_free
+#else
+constexpr bool COUNTS_MALLOC = false;
+#define VIBRA_RAW_MALLOC std::malloc
+#define VIBRA_RAW_FREE std::free
+#endif
+
+// Counted apart from malloc, which it does not go through
+void *operator new(std::size_t size)
+{
+    g_new_calls.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void *pointer = VIBRA_RAW_MALLOC(size != 0 ? size : 1))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return operator new(size);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    VIBRA_RAW_FREE(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    VIBRA_RAW_FREE(pointer);
+}
+
+namespace
+{
+constexpr std::uint32_t RATE = 44100;
+constexpr std::uint32_t CHANNELS = 2;
+constexpr std::uint32_t SAMPLE_WIDTH = 2;
+constexpr double SECONDS = 12.0;
+constexpr std::size_t SAMPLES_PER_HOP = 128;
+// Hops and blocks fed before the steady-state cases start counting, enough
+// for the ring buffers and the peak lists to reach their working size
+constexpr std::size_t WARM_UP_HOPS = 500;
+constexpr std::size_t MEASURED_HOPS = 500;
+constexpr std::size_t BLOCK_FRAMES = 4096;
+constexpr std::uint32_t MUSIC_SEED = 3;
+
+struct Allocations
+{
+    std::uint64_t new_calls;
+    std::uint64_t malloc_calls;
+    std::uint64_t bytes;
+};
+
+Allocations snapshot()
+{
+    return Allocations{g_new_calls.load(), g_malloc_calls.load(), g_allocated_bytes.load()};
+}
+
+Allocations since(const Allocations &start)
+{
+    const Allocations now = snapshot();
+    return Allocations{now.new_calls - start.new_calls, now.malloc_calls - start.malloc_calls,
+                       now.bytes - start.bytes};
+}
+
+constexpr std::uint64_t UNCHECKED = ~0ull;
+
+struct Case
+{
+    const char *name;
+    // Calls allowed for the whole case
+    std::uint64_t new_budget;
+    std::uint64_t malloc_budget;
+    // Runs the stage and returns what it allocated, setup excluded
+    std::function<Allocations(const std::vector<char> &pcm)> run;
+};
+
+Allocations generatorHops(const std::vector<char> &pcm)
+{
+    Downsampler downsampler(SampleFormat::SIGNED_INTEGER, RATE, SAMPLE_WIDTH * 8, CHANNELS);
+    LowQualityTrack samples;
+    downsampler.Process(pcm.data(), pcm.size(), &samples);
+
+    SignatureGenerator generator;
+    generator.set_max_time_seconds(SECONDS);
+    std::size_t offset = 0;
+    for (std::size_t hop = 0; hop < WARM_UP_HOPS; ++hop, offset += SAMPLES_PER_HOP)
+    {
+        generator.ProcessInput(samples.data() + offset, SAMPLES_PER_HOP);
+    }
+    const Allocations start = snapshot();
+    for (std::size_t hop = 0; hop < MEASURED_HOPS; ++hop, offset += SAMPLES_PER_HOP)
+    {
+        generator.ProcessInput(samples.data() + offset, SAMPLES_PER_HOP);
+    }
+    return since(start);
+}
+
+Allocations downsamplerBlocks(const std::vector<char> &pcm)
+{
+    Downsampler downsampler(SampleFormat::SIGNED_INTEGER, RATE, SAMPLE_WIDTH * 8, CHANNELS);
+    const std::size_t block_size = BLOCK_FRAMES * SAMPLE_WIDTH * CHANNELS;
+    LowQualityTrack block;
+    downsampler.Process(pcm.data(), block_size, &block);
+    Allocations start = snapshot();
+    for (std::size_t offset = block_size; offset + block_size <= pcm.size(); offset += block_size)
+    {
+        block.clear();
+        downsampler.Process(pcm.data() + offset, block_size, &block);
+    }
+    return since(start);
+}
+
+Allocations sessionSteps(const std::vector<char> &pcm)
+{
+    FingerprintSession session(pcm.data(), pcm.size(), SampleFormat::SIGNED_INTEGER, RATE,
+                               SAMPLE_WIDTH * 8, CHANNELS, SECONDS);
+    const std::size_t warm_up_frames = WARM_UP_HOPS * SAMPLES_PER_HOP * RATE / 16000;
+    session.Step(warm_up_frames);
+    const Allocations start = snapshot();
+    while (!session.Step(BLOCK_FRAMES))
+    {
+    }
+    return since(start);
+}
+
+Allocations encodeBase64(const std::vector<char> &pcm)
+{
+    FingerprintSession session(pcm.data(), pcm.size(), SampleFormat::SIGNED_INTEGER, RATE,
+                               SAMPLE_WIDTH * 8, CHANNELS, SECONDS);
+    const Signature signature = session.Finish();
+    const Allocations start = snapshot();
+    const std::string uri = signature.EncodeBase64();
+    return since(start);
+}
+
+Allocations fingerprintSignedPcm(const std::vector<char> &pcm)
+{
+    const Allocations start = snapshot();
+    Fingerprint *fingerprint = vibra_get_fingerprint_from_signed_pcm(
+        pcm.data(), static_cast<int>(pcm.size()), RATE, SAMPLE_WIDTH * 8, CHANNELS);
+    vibra_free_fingerprint(fingerprint);
+    return since(start);
+}
+
+Allocations fingerprintWavData(const std::vector<char> &pcm)
+{
+    const std::vector<char> wav =
+        synthetic::WrapWav(pcm, SampleFormat::SIGNED_INTEGER, RATE, SAMPLE_WIDTH, CHANNELS);
+    const Allocations start = snapshot();
+    Fingerprint *fingerprint =
+        vibra_get_fingerprint_from_wav_data(wav.data(), static_cast<int>(wav.size()));
+    vibra_free_fingerprint(fingerprint);
+    return since(start);
+}
+
+Allocations fingerprintSession(const std::vector<char> &pcm)
+{
+    const Allocations start = snapshot();
+    VibraSession *session = vibra_session_create(pcm.data(), static_cast<int>(pcm.size()), RATE,
+                                                 SAMPLE_WIDTH * 8, CHANNELS, 0);
+    while (vibra_session_step(session, BLOCK_FRAMES) == VIBRA_STATUS_PENDING)
+    {
+    }
+    Fingerprint *fingerprint = vibra_session_get_fingerprint(session);
+    vibra_free_fingerprint(fingerprint);
+    vibra_session_free(session);
+    return since(start);
+}
+
+// The whole-call budgets are what a 12 s fingerprint needs: the generator
+// with its two 2 MB spectrum rings, the resampler, the first peak of each
+// band, the signature and its URI. The session copies the PCM too.
+const Case CASES[] = {
+    {"steady/generator_hop", 0, 0, generatorHops},
+    {"steady/downsampler_block", 0, 0, downsamplerBlocks},
+    {"steady/session_step", 0, 0, sessionSteps},
+    {"call/encode_base64", 2, UNCHECKED, encodeBase64},
+    {"call/fingerprint_signed_pcm", 35, UNCHECKED, fingerprintSignedPcm},
+    {"call/fingerprint_wav_data", 35, UNCHECKED, fingerprintWavData},
+    {"call/fingerprint_session", 38, UNCHECKED, fingerprintSession},
+};
+
+std::string budgetText(std::uint64_t budget)
+{
+    return budget == UNCHECKED ? "-" : std::to_string(budget);
+}
+
+int usage(const char *program)
+{
+    std::fprintf(stderr, "usage: %s [--filter TEXT] [--verbose]\n", program);
+    return 1;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::string filter;
+    bool verbose = false;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--verbose")
+        {
+            verbose = true;
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+    if (!COUNTS_MALLOC)
+    {
+        std::fprintf(stderr, "malloc is not interposed on this C library, only operator new "
+                             "is counted\n");
+    }
+
+    // Music with a peak in every band within the warm-up: a band is added to
+    // the signature, an allocation, with its first peak
+    const std::vector<char> pcm = synthetic::EncodePcm(synthetic::Music(RATE, SECONDS, MUSIC_SEED),
+                                                       SampleFormat::SIGNED_INTEGER, SAMPLE_WIDTH,
+                                                       CHANNELS);
+    int failures = 0;
+    try
+    {
+        for (const Case &item : CASES)
+        {
+            if (std::string(item.name).find(filter) == std::string::npos)
+            {
+                continue;
+            }
+            const Allocations allocations = item.run(pcm);
+            const bool passed = allocations.new_calls <= item.new_budget &&
+                                (item.malloc_budget == UNCHECKED ||
+                                 allocations.malloc_calls <= item.malloc_budget);
+            failures += passed ? 0 : 1;
+            if (verbose || !passed)
+            {
+                std::printf("%-28s %s %5llu new (budget %s), %5llu malloc (budget %s), "
+                            "%llu bytes\n",
+                            item.name, passed ? "ok  " : "FAIL",
+                            static_cast<unsigned long long>(allocations.new_calls),
+                            budgetText(item.new_budget).c_str(),
+                            static_cast<unsigned long long>(allocations.malloc_calls),
+                            budgetText(item.malloc_budget).c_str(),
+                            static_cast<unsigned long long>(allocations.bytes));
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    std::printf("%d cases over budget\n", failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,668 @@
+// Per-stage benchmarks of the fingerprint pipeline.
+//
+//   vibra_bench [--repeat N] [--filter TEXT] [--json OUT] [--baseline IN]
+//               [--threshold PERCENT] [--trace OUT] [file.wav ...]
+//
+// Every stage runs on a deterministic synthetic clip, and the WAV stages
+// also on each file given. Each case reports the best of N timed calls after
+// a warm-up call, as the cost per unit of input (an audio frame, a 16 kHz
+// sample for the generator stages, a byte for the codecs), how much faster
+// than real time that is, and the operator new calls per call.
+//
+// --json writes the results for a later --baseline run, which prints the
+// change of every case and exits with status 2 if one got slower by more
+// than the threshold, 10% by default.
+//
+// --trace writes the pipeline trace sections of the run as Chrome trace
+// JSON, in builds configured with -DVIBRA_TRACING=ON. The timings then
+// include the tracing overhead.
+//
+// The kernels are the vectorized ones of the CPU, or the portable ones with
+// VIBRA_FORCE_SCALAR=1 set.
+
+#include "algorithm/signature.h"
+#include "algorithm/signature_generator.h"
+#include "audio/downmix.h"
+#include "audio/downsampler.h"
+#include "audio/wav.h"
+#include "utils/base64.h"
+#include "utils/cpu_features.h"
+#include "utils/crc32.h"
+#include "synthetic_audio.h"
+#include "vibra.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::atomic<std::uint64_t> g_allocations(0);
+// Keeps the results of pure calls from being optimised away
+volatile std::uint32_t g_sink;
+} // namespace
+
+// Counts every allocation of the library and the bench, not FFTW's
+void *operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *pointer = std::malloc(size != 0 ? size : 1))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+namespace
+{
+constexpr int DEFAULT_REPEAT = 10;
+constexpr double DEFAULT_THRESHOLD_PERCENT = 10.0;
+constexpr std::uint32_t SYNTHETIC_RATE = 44100;
+constexpr std::uint32_t SYNTHETIC_CHANNELS = 2;
+constexpr double SYNTHETIC_SECONDS = 12.0;
+// The fingerprint functions stop after this much audio
+constexpr double MAX_ANALYSED_SECONDS = 12.0;
+constexpr std::size_t SAMPLES_PER_HOP = 128;
+
+struct Result
+{
+    std::string name;
+    std::string unit;
+    double units_per_call;
+    double best_ns;
+    double audio_seconds; // 0 for stages that do not take audio
+    double allocations_per_call;
+
+    double nsPerUnit() const
+    {
+        return best_ns / units_per_call;
+    }
+    double realtimeFactor() const
+    {
+        return audio_seconds > 0 ? audio_seconds * 1e9 / best_ns : 0;
+    }
+};
+
+struct Options
+{
+    int repeat = DEFAULT_REPEAT;
+    std::string filter;
+    std::string json_path;
+    std::string baseline_path;
+    std::string trace_path;
+    double threshold_percent = DEFAULT_THRESHOLD_PERCENT;
+    std::vector<std::string> wav_paths;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double elapsedNs(Clock::time_point start, Clock::time_point end)
+{
+    return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+class Runner
+{
+public:
+    explicit Runner(const Options &options) : options_(options)
+    {
+    }
+
+    bool Selected(const std::string &name) const
+    {
+        return name.find(options_.filter) != std::string::npos;
+    }
+
+    // Times `body`, which processes `units` units of input per call
+    void Run(const std::string &name, const std::string &unit, double units,
+             double audio_seconds, const std::function<void()> &body)
+    {
+        if (!Selected(name))
+        {
+            return;
+        }
+        body();
+        double best = std::numeric_limits<double>::infinity();
+        std::uint64_t allocations = 0;
+        for (int i = 0; i < options_.repeat; ++i)
+        {
+            const std::uint64_t allocations_before = g_allocations.load();
+            const Clock::time_point start = Clock::now();
+            body();
+            const Clock::time_point end = Clock::now();
+            allocations = g_allocations.load() - allocations_before;
+            best = std::min(best, elapsedNs(start, end));
+        }
+        Add(Result{name, unit, units, best, audio_seconds, static_cast<double>(allocations)});
+    }
+
+    void Add(const Result &result)
+    {
+        std::printf("%-40s %12.2f ns/%-6s %10.3f ms %10.1fx rt %10.1f allocs\n",
+                    result.name.c_str(), result.nsPerUnit(), result.unit.c_str(),
+                    result.best_ns / 1e6, result.realtimeFactor(), result.allocations_per_call);
+        results_.push_back(result);
+    }
+
+    inline int repeat() const
+    {
+        return options_.repeat;
+    }
+
+    inline const std::vector<Result> &results() const
+    {
+        return results_;
+    }
+
+private:
+    const Options &options_;
+    std::vector<Result> results_;
+};
+} // namespace
+
+// Drives the private stages of SignatureGenerator one hop at a time, as
+// processInput() does, timing each separately.
+class SignatureGeneratorStages
+{
+public:
+    static void Run(Runner *runner, const LowQualityTrack &track)
+    {
+        const char *const kNames[] = {"generator/fft", "generator/spreading",
+                                      "generator/recognition"};
+        bool any = false;
+        for (const char *name : kNames)
+        {
+            any = any || runner->Selected(name);
+        }
+        const std::size_t hops = track.size() / SAMPLES_PER_HOP;
+        if (!any || hops == 0)
+        {
+            return;
+        }
+
+        double best[3];
+        double allocations[3];
+        std::fill(best, best + 3, std::numeric_limits<double>::infinity());
+        // One untimed pass first, like Runner::Run()
+        for (int pass = 0; pass <= runner->repeat(); ++pass)
+        {
+            SignatureGenerator generator;
+            generator.set_max_time_seconds(std::numeric_limits<double>::infinity());
+            double total[3] = {0, 0, 0};
+            std::uint64_t allocated[3] = {0, 0, 0};
+            for (std::size_t hop = 0; hop < hops; ++hop)
+            {
+                const LowQualitySample *input = track.data() + hop * SAMPLES_PER_HOP;
+                generator.next_signature_.Addnum_samples(SAMPLES_PER_HOP);
+                time(&total[0], &allocated[0],
+                     [&] { generator.doFFT(input, SAMPLES_PER_HOP); });
+                time(&total[1], &allocated[1], [&] { generator.doPeakSpreading(); });
+                if (generator.spread_ffts_output_.num_written() >= 47)
+                {
+                    time(&total[2], &allocated[2], [&] { generator.doPeakRecognition(); });
+                }
+            }
+            for (int stage = 0; pass > 0 && stage < 3; ++stage)
+            {
+                if (total[stage] < best[stage])
+                {
+                    best[stage] = total[stage];
+                    allocations[stage] = static_cast<double>(allocated[stage]);
+                }
+            }
+        }
+
+        const double samples = static_cast<double>(hops * SAMPLES_PER_HOP);
+        for (int stage = 0; stage < 3; ++stage)
+        {
+            if (runner->Selected(kNames[stage]))
+            {
+                runner->Add(Result{kNames[stage], "sample", samples, best[stage],
+                                   samples / LOW_QUALITY_SAMPLE_RATE, allocations[stage]});
+            }
+        }
+    }
+
+private:
+    template <typename Stage> static void time(double *total, std::uint64_t *allocated, Stage stage)
+    {
+        const std::uint64_t allocations_before = g_allocations.load();
+        const Clock::time_point start = Clock::now();
+        stage();
+        const Clock::time_point end = Clock::now();
+        *allocated += g_allocations.load() - allocations_before;
+        *total += elapsedNs(start, end);
+    }
+};
+
+namespace
+{
+struct PcmFormat
+{
+    const char *name;
+    SampleFormat format;
+    std::uint32_t width;
+    std::uint32_t channels;
+    std::uint32_t rate;
+};
+
+// Every specialized downmix kernel, and the generic one through 6 channels
+const PcmFormat DOWNMIX_FORMATS[] = {
+    {"u8x1", SampleFormat::UNSIGNED_INTEGER, 1, 1, 44100},
+    {"u8x2", SampleFormat::UNSIGNED_INTEGER, 1, 2, 44100},
+    {"s16x1", SampleFormat::SIGNED_INTEGER, 2, 1, 44100},
+    {"s16x2", SampleFormat::SIGNED_INTEGER, 2, 2, 44100},
+    {"s16x6", SampleFormat::SIGNED_INTEGER, 2, 6, 44100},
+    {"s24x1", SampleFormat::SIGNED_INTEGER, 3, 1, 48000},
+    {"s24x2", SampleFormat::SIGNED_INTEGER, 3, 2, 48000},
+    {"s24x6", SampleFormat::SIGNED_INTEGER, 3, 6, 48000},
+    {"s32x2", SampleFormat::SIGNED_INTEGER, 4, 2, 48000},
+    {"f32x1", SampleFormat::FLOAT, 4, 1, 48000},
+    {"f32x2", SampleFormat::FLOAT, 4, 2, 48000},
+    {"f32x6", SampleFormat::FLOAT, 4, 6, 48000},
+    {"f64x2", SampleFormat::FLOAT, 8, 2, 48000},
+};
+
+// Full conversions to 16 kHz: resampled, integer-ratio and copied through
+const PcmFormat DOWNSAMPLE_FORMATS[] = {
+    {"s16x2@44100", SampleFormat::SIGNED_INTEGER, 2, 2, 44100},
+    {"f32x2@48000", SampleFormat::FLOAT, 4, 2, 48000},
+    {"s16x1@16000", SampleFormat::SIGNED_INTEGER, 2, 1, 16000},
+};
+
+void runDownmix(Runner *runner, const PcmFormat &format)
+{
+    const std::string name = std::string("downmix/") + format.name;
+    if (!runner->Selected(name))
+    {
+        return;
+    }
+    const std::vector<double> music = synthetic::Music(format.rate, SYNTHETIC_SECONDS);
+    const std::vector<char> pcm =
+        synthetic::EncodePcm(music, format.format, format.width, format.channels);
+    DownmixFunc downmix = downmix::GetDownmixFunc(format.format, format.width, format.channels);
+    std::vector<float> mono(music.size());
+    runner->Run(name, "frame", static_cast<double>(music.size()), SYNTHETIC_SECONDS,
+                [&] { downmix(mono.data(), pcm.data(), music.size(), format.channels); });
+}
+
+void runDownsample(Runner *runner, const PcmFormat &format)
+{
+    const std::string name = std::string("downsample/") + format.name;
+    if (!runner->Selected(name))
+    {
+        return;
+    }
+    const std::vector<double> music = synthetic::Music(format.rate, SYNTHETIC_SECONDS);
+    const std::vector<char> pcm =
+        synthetic::EncodePcm(music, format.format, format.width, format.channels);
+    LowQualityTrack output;
+    runner->Run(name, "frame", static_cast<double>(music.size()), SYNTHETIC_SECONDS, [&] {
+        Downsampler downsampler(format.format, format.rate, format.width * 8, format.channels);
+        output.clear();
+        downsampler.Process(pcm.data(), pcm.size(), &output);
+        downsampler.Flush(&output);
+    });
+}
+
+// The WAV stages on one file, synthetic or recorded
+void runWav(Runner *runner, const std::string &label, const std::vector<char> &data)
+{
+    Wav probe = Wav::ViewRawWav(data.data(), static_cast<std::uint32_t>(data.size()));
+    const double frames = static_cast<double>(probe.data_size()) /
+                          (probe.num_channels() * probe.bits_per_sample() / 8);
+    const double seconds = frames / probe.sample_rate_();
+    const std::uint32_t size = static_cast<std::uint32_t>(data.size());
+
+    runner->Run("wav/from_raw_wav/" + label, "frame", frames, seconds,
+                [&] { Wav::FromRawWav(data.data(), size); });
+    runner->Run("downsample/get_low_quality_pcm/" + label, "frame", frames, seconds,
+                [&] { Downsampler::GetLowQualityPCM(probe); });
+    const double analysed = std::min(seconds, MAX_ANALYSED_SECONDS);
+    runner->Run("end_to_end/wav_data/" + label, "frame",
+                analysed * probe.sample_rate_(), analysed, [&] {
+                    Fingerprint *fingerprint = vibra_get_fingerprint_from_wav_data(
+                        data.data(), static_cast<int>(data.size()));
+                    if (fingerprint == nullptr)
+                    {
+                        throw std::runtime_error("Fingerprinting " + label + " failed");
+                    }
+                    vibra_free_fingerprint(fingerprint);
+                });
+}
+
+void runGenerator(Runner *runner)
+{
+    const std::vector<double> music =
+        synthetic::Music(LOW_QUALITY_SAMPLE_RATE, SYNTHETIC_SECONDS);
+    const std::vector<char> pcm =
+        synthetic::EncodePcm(music, SampleFormat::SIGNED_INTEGER, 2, 1);
+    LowQualityTrack track(music.size());
+    std::memcpy(track.data(), pcm.data(), pcm.size());
+    SignatureGeneratorStages::Run(runner, track);
+
+    // A full 12 s signature to encode
+    SignatureGenerator generator;
+    generator.set_max_time_seconds(SYNTHETIC_SECONDS);
+    generator.FeedInput(track);
+    const Signature signature = generator.GetNextSignature();
+    const std::string binary = signature.EncodeBinary();
+
+    runner->Run("signature/encode_base64", "peak",
+                static_cast<double>(signature.SumOfPeaksLength()), 0,
+                [&] { signature.EncodeBase64(); });
+    runner->Run("crc32/signature", "byte", static_cast<double>(binary.size()), 0,
+                [&] { g_sink = crc32::crc32(binary.data(), binary.size()); });
+    runner->Run("crc32_software/signature", "byte", static_cast<double>(binary.size()), 0,
+                [&] { g_sink = crc32::crc32_software(binary.data(), binary.size()); });
+
+    std::vector<char> encoded(base64::encoded_size(binary.size()));
+    runner->Run("base64/encode/signature", "byte", static_cast<double>(binary.size()), 0,
+                [&] { base64::encode(binary.data(), binary.size(), encoded.data()); });
+    runner->Run("base64/encode_scalar/signature", "byte", static_cast<double>(binary.size()), 0,
+                [&] { base64::encode_scalar(binary.data(), binary.size(), encoded.data()); });
+}
+
+// Each call covers at least CRC32_BYTES_PER_CALL bytes so that the small sizes,
+// where the PCLMUL path hands over to the byte tail, are timed above the clock
+// resolution
+constexpr std::size_t CRC32_BYTES_PER_CALL = 1u << 20;
+
+void runCrc32(Runner *runner)
+{
+    const std::size_t kSizes[] = {16, 63, 64, 1024, 64 * 1024, 1024 * 1024};
+    std::vector<char> data(kSizes[5]);
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<char>(i * 2654435761u >> 24);
+    }
+    for (std::size_t size : kSizes)
+    {
+        const std::size_t calls = std::max<std::size_t>(1, CRC32_BYTES_PER_CALL / size);
+        const double bytes = static_cast<double>(calls * size);
+        std::ostringstream label;
+        label << size << "B";
+        runner->Run("crc32/" + label.str(), "byte", bytes, 0, [&] {
+            for (std::size_t i = 0; i < calls; ++i)
+            {
+                g_sink = crc32::crc32(data.data(), size);
+            }
+        });
+        runner->Run("crc32_software/" + label.str(), "byte", bytes, 0, [&] {
+            for (std::size_t i = 0; i < calls; ++i)
+            {
+                g_sink = crc32::crc32_software(data.data(), size);
+            }
+        });
+    }
+}
+
+void runEndToEnd(Runner *runner)
+{
+    const double kClipSeconds[] = {3, 10, 12};
+    const std::vector<double> music = synthetic::Music(SYNTHETIC_RATE, SYNTHETIC_SECONDS);
+    const std::vector<char> pcm =
+        synthetic::EncodePcm(music, SampleFormat::SIGNED_INTEGER, 2, SYNTHETIC_CHANNELS);
+    for (double seconds : kClipSeconds)
+    {
+        const std::size_t frames = static_cast<std::size_t>(seconds * SYNTHETIC_RATE);
+        const int size = static_cast<int>(frames * SYNTHETIC_CHANNELS * 2);
+        std::ostringstream name;
+        name << "end_to_end/signed_pcm/" << seconds << "s";
+        runner->Run(name.str(), "frame", static_cast<double>(frames), seconds, [&] {
+            Fingerprint *fingerprint = vibra_get_fingerprint_from_signed_pcm(
+                pcm.data(), size, SYNTHETIC_RATE, 16, SYNTHETIC_CHANNELS);
+            if (fingerprint == nullptr)
+            {
+                throw std::runtime_error("Fingerprinting failed");
+            }
+            vibra_free_fingerprint(fingerprint);
+        });
+    }
+}
+
+std::string jsonEscape(const std::string &text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+void writeJson(const std::string &path, const std::vector<Result> &results)
+{
+    std::ofstream out(path);
+    out << "{\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const Result &result = results[i];
+        out << "    {\"name\": \"" << jsonEscape(result.name) << "\", \"unit\": \""
+            << result.unit << "\", \"ns_per_unit\": " << result.nsPerUnit()
+            << ", \"ms_per_call\": " << result.best_ns / 1e6
+            << ", \"realtime_factor\": ";
+        if (result.audio_seconds > 0)
+        {
+            out << result.realtimeFactor();
+        }
+        else
+        {
+            out << "null";
+        }
+        out << ", \"allocations_per_call\": " << result.allocations_per_call << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+// Reads back what writeJson() wrote: the ns_per_unit of every name
+std::map<std::string, double> readBaseline(const std::string &path)
+{
+    std::ifstream in(path);
+    if (!in)
+    {
+        throw std::runtime_error("Cannot read " + path);
+    }
+    const std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::map<std::string, double> baseline;
+    const std::string kName = "\"name\": \"";
+    const std::string kValue = "\"ns_per_unit\": ";
+    for (std::size_t at = text.find(kName); at != std::string::npos; at = text.find(kName, at))
+    {
+        at += kName.size();
+        std::string name;
+        for (; at < text.size() && text[at] != '"'; ++at)
+        {
+            if (text[at] == '\\' && at + 1 < text.size())
+            {
+                ++at;
+            }
+            name += text[at];
+        }
+        const std::size_t value = text.find(kValue, at);
+        if (value == std::string::npos)
+        {
+            break;
+        }
+        baseline[name] = std::strtod(text.c_str() + value + kValue.size(), nullptr);
+    }
+    return baseline;
+}
+
+// Returns the number of cases slower than the threshold
+int compare(const std::map<std::string, double> &baseline, const std::vector<Result> &results,
+            double threshold_percent)
+{
+    int regressions = 0;
+    std::printf("\n%-40s %14s %14s %9s\n", "compared to baseline", "before ns", "now ns", "change");
+    for (const auto &result : results)
+    {
+        const auto found = baseline.find(result.name);
+        if (found == baseline.end() || found->second <= 0)
+        {
+            std::printf("%-40s %14s %14.2f %9s\n", result.name.c_str(), "-", result.nsPerUnit(),
+                        "new");
+            continue;
+        }
+        const double change = (result.nsPerUnit() / found->second - 1) * 100;
+        const bool regressed = change > threshold_percent;
+        regressions += regressed ? 1 : 0;
+        std::printf("%-40s %14.2f %14.2f %+8.1f%%%s\n", result.name.c_str(), found->second,
+                    result.nsPerUnit(), change, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+bool parseOptions(int argc, char **argv, Options *options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--repeat" && has_value)
+        {
+            options->repeat = std::max(1, std::atoi(argv[++i]));
+        }
+        else if (arg == "--filter" && has_value)
+        {
+            options->filter = argv[++i];
+        }
+        else if (arg == "--json" && has_value)
+        {
+            options->json_path = argv[++i];
+        }
+        else if (arg == "--baseline" && has_value)
+        {
+            options->baseline_path = argv[++i];
+        }
+        else if (arg == "--trace" && has_value)
+        {
+            options->trace_path = argv[++i];
+        }
+        else if (arg == "--threshold" && has_value)
+        {
+            options->threshold_percent = std::atof(argv[++i]);
+        }
+        else if (arg.compare(0, 2, "--") == 0)
+        {
+            return false;
+        }
+        else
+        {
+            options->wav_paths.push_back(arg);
+        }
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, &options))
+    {
+        std::fprintf(stderr, "usage: %s [--repeat N] [--filter TEXT] [--json OUT] "
+                             "[--baseline IN] [--threshold PERCENT] [--trace OUT] [file.wav ...]\n",
+                     argv[0]);
+        return 1;
+    }
+
+    if (!options.trace_path.empty() &&
+        vibra_trace_start_json(options.trace_path.c_str()) != VIBRA_STATUS_DONE)
+    {
+        std::fprintf(stderr, "Cannot trace to %s, was the build configured with "
+                             "-DVIBRA_TRACING=ON?\n",
+                     options.trace_path.c_str());
+        return 1;
+    }
+
+    std::fprintf(stderr, "CPU features: %s%s\n", vibra_get_cpu_features(),
+                 cpu::IsScalarForced() ? " (forced scalar)" : "");
+    try
+    {
+        Runner runner(options);
+        for (const auto &format : DOWNMIX_FORMATS)
+        {
+            runDownmix(&runner, format);
+        }
+        for (const auto &format : DOWNSAMPLE_FORMATS)
+        {
+            runDownsample(&runner, format);
+        }
+
+        const std::vector<double> music = synthetic::Music(SYNTHETIC_RATE, SYNTHETIC_SECONDS);
+        runWav(&runner, "synthetic",
+               synthetic::WrapWav(
+                   synthetic::EncodePcm(music, SampleFormat::SIGNED_INTEGER, 2, SYNTHETIC_CHANNELS),
+                   SampleFormat::SIGNED_INTEGER, SYNTHETIC_RATE, 2, SYNTHETIC_CHANNELS));
+        for (const auto &path : options.wav_paths)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                throw std::runtime_error("Cannot read " + path);
+            }
+            const std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                                         std::istreambuf_iterator<char>());
+            runWav(&runner, path.substr(path.find_last_of('/') + 1), data);
+        }
+
+        runGenerator(&runner);
+        runCrc32(&runner);
+        runEndToEnd(&runner);
+        vibra_trace_stop_json();
+
+        if (!options.json_path.empty())
+        {
+            writeJson(options.json_path, runner.results());
+        }
+        if (!options.baseline_path.empty() &&
+            compare(readBaseline(options.baseline_path), runner.results(),
+                    options.threshold_percent) > 0)
+        {
+            return 2;
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
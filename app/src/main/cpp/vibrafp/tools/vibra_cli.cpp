@@ -0,0 +1,489 @@
+// Batch fingerprinting of audio files on a pool of worker threads.
+//
+//   vibra_cli [--threads N] [--format uri|binary|landmarks] [--output OUT]
+//             [--seconds S] [--raw RATE:BITS:CHANNELS[:float]] PATH...
+//
+// Every PATH is a file or a directory searched recursively for .wav, .raw
+// and .pcm files. Files starting with a RIFF/WAVE header are read as WAV,
+// any other as raw interleaved PCM in the --raw format. Files are mapped,
+// not read, so only the analysed part of a long track is paged in.
+//
+// Each file gives one JSON line on OUT, stdout by default, in the order the
+// workers finish them:
+//   {"path": ..., "sample_ms": ..., "peaks": ..., "uri": "data:audio/vnd.shazam.sig;base64,..."}
+// --format binary replaces "uri" with "binary", the base64 of the raw
+// signature, and --format landmarks with "landmarks", the [hash, anchor
+// pass] pairs of the whole analysed audio, see match/landmark.h. A file that
+// fails gives {"path": ..., "error": ...} instead.
+//
+// The first S seconds of every file are analysed, 12 by default as in the
+// app; --seconds 0 analyses whole files. A summary goes to stderr: files per
+// second, how much faster than real time that is over all threads and per
+// busy core, and the time of every pipeline stage summed over all files.
+//
+// Exit status: 0 if every file was fingerprinted, 1 otherwise.
+
+#include "algorithm/fingerprint_session.h"
+#include "algorithm/signature.h"
+#include "audio/downsampler.h"
+#include "audio/wav.h"
+#include "utils/base64.h"
+#include "utils/mapped_file.h"
+#include "utils/pipeline_stats.h"
+#include <dirent.h>
+#include <sys/stat.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+constexpr double DEFAULT_SECONDS = 12.0;
+const char *const AUDIO_EXTENSIONS[] = {".wav", ".raw", ".pcm"};
+const char *const STAGE_NAMES[PipelineStats::STAGE_COUNT] = {
+    "wav_parse", "downsample", "fft", "spreading", "recognition", "encode", "total"};
+
+enum class OutputFormat
+{
+    URI,
+    BINARY,
+    LANDMARKS,
+};
+
+struct RawFormat
+{
+    std::uint32_t sample_rate;
+    std::uint32_t bits_per_sample;
+    std::uint32_t channels;
+    SampleFormat sample_format;
+};
+
+struct Options
+{
+    unsigned int threads = 0; // one per hardware thread
+    OutputFormat format = OutputFormat::URI;
+    std::string output_path;
+    double seconds = DEFAULT_SECONDS;
+    bool has_raw = false;
+    RawFormat raw = RawFormat();
+    std::vector<std::string> paths;
+};
+
+// What a worker adds to the summary for each file
+struct Totals
+{
+    Totals() : files(0), failures(0), audio_seconds(0.0), stats()
+    {
+    }
+
+    std::uint64_t files;
+    std::uint64_t failures;
+    double audio_seconds; // analysed audio
+    PipelineStats stats;  // stage times summed over the files
+};
+
+std::string jsonEscape(const std::string &text)
+{
+    std::string escaped;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+            escaped += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char code[8];
+            std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned char>(c));
+            escaped += code;
+        }
+        else
+        {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+bool hasAudioExtension(const std::string &name)
+{
+    const std::size_t dot = name.find_last_of('.');
+    if (dot == std::string::npos)
+    {
+        return false;
+    }
+    std::string extension = name.substr(dot);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](char c) { return static_cast<char>(std::tolower(c)); });
+    for (const char *audio_extension : AUDIO_EXTENSIONS)
+    {
+        if (extension == audio_extension)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Appends the audio files under `path`, a directory's in name order
+void collectFiles(const std::string &path, bool named, std::vector<std::string> *files)
+{
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0)
+    {
+        throw std::runtime_error("Cannot read " + path);
+    }
+    if (!S_ISDIR(st.st_mode))
+    {
+        // Files named on the command line are taken whatever their name
+        if (named || hasAudioExtension(path))
+        {
+            files->push_back(path);
+        }
+        return;
+    }
+
+    DIR *dir = ::opendir(path.c_str());
+    if (dir == nullptr)
+    {
+        throw std::runtime_error("Cannot read directory " + path);
+    }
+    std::vector<std::string> names;
+    while (const dirent *entry = ::readdir(dir))
+    {
+        if (std::strcmp(entry->d_name, ".") != 0 && std::strcmp(entry->d_name, "..") != 0)
+        {
+            names.push_back(entry->d_name);
+        }
+    }
+    ::closedir(dir);
+    std::sort(names.begin(), names.end());
+    for (const std::string &name : names)
+    {
+        collectFiles(path + "/" + name, false, files);
+    }
+}
+
+bool isWav(const MappedFile &file)
+{
+    return file.size() >= 12 && std::memcmp(file.data(), "RIFF", 4) == 0 &&
+           std::memcmp(file.data() + 8, "WAVE", 4) == 0;
+}
+
+// Fingerprints one file into the body of its JSON line, after the path.
+// Throws std::exception if the file cannot be read or decoded.
+std::string fingerprintFile(const std::string &path, const Options &options,
+                            PipelineStats *stats, double *audio_seconds)
+{
+    const MappedFile file(path);
+    const char *pcm = file.data();
+    std::size_t pcm_size = file.size();
+    RawFormat format = options.raw;
+
+    StageTimer parse_timer(stats, PipelineStats::WAV_PARSE);
+    if (isWav(file))
+    {
+        if (file.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw std::runtime_error("WAV file larger than 4 GiB");
+        }
+        const Wav wav = Wav::ViewRawWav(file.data(), static_cast<std::uint32_t>(file.size()));
+        pcm = reinterpret_cast<const char *>(wav.data());
+        pcm_size = wav.data_size();
+        format = RawFormat{wav.sample_rate_(), wav.bits_per_sample(), wav.num_channels(),
+                           wav.sample_format()};
+    }
+    else if (!options.has_raw)
+    {
+        throw std::runtime_error("Not a WAV file, and no --raw format given");
+    }
+    parse_timer.Stop();
+    if (format.sample_rate == 0 || format.bits_per_sample == 0 || format.channels == 0)
+    {
+        throw std::runtime_error("Invalid audio format");
+    }
+
+    // Whole files: a limit past the end of the input
+    const std::size_t frame_size = format.bits_per_sample / 8 * format.channels;
+    const double seconds =
+        options.seconds > 0.0
+            ? options.seconds
+            : static_cast<double>(pcm_size / std::max<std::size_t>(frame_size, 1)) /
+                      format.sample_rate +
+                  1.0;
+    FingerprintSession session(pcm, pcm_size, format.sample_format, format.sample_rate,
+                               format.bits_per_sample, format.channels, seconds);
+    session.set_stats(stats);
+    if (options.format == OutputFormat::LANDMARKS)
+    {
+        session.EnableLandmarks(LandmarkConfig());
+    }
+    const Signature signature = session.Finish();
+
+    StageTimer encode_timer(stats, PipelineStats::ENCODE);
+    *audio_seconds = static_cast<double>(signature.num_samples()) / signature.sample_rate();
+    std::ostringstream line;
+    line << ", \"sample_ms\": "
+         << static_cast<std::uint64_t>(*audio_seconds * 1000.0)
+         << ", \"peaks\": " << signature.SumOfPeaksLength();
+    switch (options.format)
+    {
+    case OutputFormat::URI:
+        line << ", \"uri\": \"" << signature.EncodeBase64() << "\"";
+        break;
+    case OutputFormat::BINARY:
+    {
+        const std::string binary = signature.EncodeBinary();
+        line << ", \"binary\": \"" << base64::encode(binary.data(), binary.size()) << "\"";
+        break;
+    }
+    case OutputFormat::LANDMARKS:
+    {
+        std::vector<Landmark> landmarks;
+        session.TakeLandmarks(&landmarks);
+        line << ", \"landmarks\": [";
+        for (std::size_t i = 0; i < landmarks.size(); ++i)
+        {
+            line << (i == 0 ? "[" : ", [") << landmarks[i].hash << ", "
+                 << landmarks[i].anchor_pass << "]";
+        }
+        line << "]";
+        break;
+    }
+    }
+    return line.str();
+}
+
+void addStats(const PipelineStats &stats, PipelineStats *total)
+{
+    for (int stage = 0; stage < PipelineStats::STAGE_COUNT; ++stage)
+    {
+        total->stage_time[stage] += stats.stage_time[stage];
+    }
+    total->frames_processed += stats.frames_processed;
+}
+
+// Takes files from `next` until there are none left, writing their lines to
+// `out` and adding them to `totals`, both under `mutex`.
+void runWorker(const std::vector<std::string> &files, const Options &options,
+               std::atomic<std::size_t> *next, std::ostream *out, Totals *totals,
+               std::mutex *mutex)
+{
+    for (std::size_t i = next->fetch_add(1); i < files.size(); i = next->fetch_add(1))
+    {
+        PipelineStats stats;
+        double audio_seconds = 0.0;
+        std::string line = "{\"path\": \"" + jsonEscape(files[i]) + "\"";
+        bool failed = false;
+        {
+            StageTimer total_timer(&stats, PipelineStats::TOTAL);
+            try
+            {
+                line += fingerprintFile(files[i], options, &stats, &audio_seconds);
+            }
+            catch (const std::exception &e)
+            {
+                line += ", \"error\": \"" + jsonEscape(e.what()) + "\"";
+                failed = true;
+            }
+        }
+        line += "}\n";
+
+        std::lock_guard<std::mutex> lock(*mutex);
+        *out << line;
+        totals->files += 1;
+        totals->failures += failed ? 1 : 0;
+        totals->audio_seconds += audio_seconds;
+        addStats(stats, &totals->stats);
+    }
+}
+
+double toSeconds(PipelineStats::Clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+void printSummary(const Totals &totals, unsigned int threads, double wall_seconds)
+{
+    const double busy_seconds = toSeconds(totals.stats.stage_time[PipelineStats::TOTAL]);
+    std::fprintf(stderr, "%llu files, %llu failed, %.1f s of audio in %.3f s on %u threads\n",
+                 static_cast<unsigned long long>(totals.files),
+                 static_cast<unsigned long long>(totals.failures), totals.audio_seconds,
+                 wall_seconds, threads);
+    if (wall_seconds > 0.0 && busy_seconds > 0.0)
+    {
+        std::fprintf(stderr, "%.1f files/s, %.0fx real time, %.0fx real time per busy core\n",
+                     totals.files / wall_seconds, totals.audio_seconds / wall_seconds,
+                     totals.audio_seconds / busy_seconds);
+    }
+    std::fprintf(stderr, "%-12s %12s %7s\n", "stage", "ms", "share");
+    for (int stage = 0; stage < PipelineStats::STAGE_COUNT; ++stage)
+    {
+        const double seconds = toSeconds(totals.stats.stage_time[stage]);
+        std::fprintf(stderr, "%-12s %12.1f %6.1f%%\n", STAGE_NAMES[stage], seconds * 1000.0,
+                     busy_seconds > 0.0 ? 100.0 * seconds / busy_seconds : 0.0);
+    }
+}
+
+// RATE:BITS:CHANNELS with an optional :float
+bool parseRawFormat(const std::string &text, RawFormat *format)
+{
+    char suffix[8] = {0};
+    unsigned int rate = 0;
+    unsigned int bits = 0;
+    unsigned int channels = 0;
+    const int fields = std::sscanf(text.c_str(), "%u:%u:%u:%7s", &rate, &bits, &channels, suffix);
+    if (fields < 3 || (fields == 4 && std::strcmp(suffix, "float") != 0) || rate == 0 ||
+        bits % 8 != 0 || bits == 0 || channels == 0)
+    {
+        return false;
+    }
+    *format = RawFormat{rate, bits, channels,
+                        fields == 4 ? SampleFormat::FLOAT : SampleFormat::SIGNED_INTEGER};
+    return true;
+}
+
+bool parseOptions(int argc, char **argv, Options *options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--threads" && has_value)
+        {
+            options->threads = static_cast<unsigned int>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--format" && has_value)
+        {
+            const std::string format = argv[++i];
+            if (format == "uri")
+            {
+                options->format = OutputFormat::URI;
+            }
+            else if (format == "binary")
+            {
+                options->format = OutputFormat::BINARY;
+            }
+            else if (format == "landmarks")
+            {
+                options->format = OutputFormat::LANDMARKS;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        else if (arg == "--output" && has_value)
+        {
+            options->output_path = argv[++i];
+        }
+        else if (arg == "--seconds" && has_value)
+        {
+            options->seconds = std::atof(argv[++i]);
+        }
+        else if (arg == "--raw" && has_value)
+        {
+            if (!parseRawFormat(argv[++i], &options->raw))
+            {
+                return false;
+            }
+            options->has_raw = true;
+        }
+        else if (arg.compare(0, 2, "--") == 0)
+        {
+            return false;
+        }
+        else
+        {
+            options->paths.push_back(arg);
+        }
+    }
+    return !options->paths.empty() && options->seconds >= 0.0;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, &options))
+    {
+        std::fprintf(stderr, "usage: %s [--threads N] [--format uri|binary|landmarks] "
+                             "[--output OUT] [--seconds S] [--raw RATE:BITS:CHANNELS[:float]] "
+                             "PATH...\n",
+                     argv[0]);
+        return 1;
+    }
+    if (options.threads == 0)
+    {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    Totals totals;
+    unsigned int threads = 0;
+    double wall_seconds = 0.0;
+    try
+    {
+        std::vector<std::string> files;
+        for (const std::string &path : options.paths)
+        {
+            collectFiles(path, true, &files);
+        }
+
+        std::ofstream file;
+        if (!options.output_path.empty())
+        {
+            file.open(options.output_path);
+            if (!file)
+            {
+                throw std::runtime_error("Cannot write " + options.output_path);
+            }
+        }
+        std::ostream &out = options.output_path.empty() ? std::cout : file;
+
+        threads = static_cast<unsigned int>(std::min<std::size_t>(options.threads, files.size()));
+        const auto start = std::chrono::steady_clock::now();
+        std::atomic<std::size_t> next(0);
+        std::mutex mutex;
+        std::vector<std::thread> workers;
+        for (unsigned int i = 1; i < threads; ++i)
+        {
+            workers.emplace_back(runWorker, std::cref(files), std::cref(options), &next, &out,
+                                 &totals, &mutex);
+        }
+        runWorker(files, options, &next, &out, &totals, &mutex);
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+        wall_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        out.flush();
+        if (!out)
+        {
+            throw std::runtime_error("Failed to write the signatures");
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+    printSummary(totals, threads, wall_seconds);
+    return totals.failures == 0 ? 0 : 1;
+}
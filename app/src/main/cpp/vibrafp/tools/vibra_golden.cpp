@@ -0,0 +1,374 @@
+// Golden-signature corpus: checks that signature generation still produces
+// the URIs recorded from a known-good build.
+//
+//   vibra_golden record DIR
+//   vibra_golden check DIR [--tolerance] [--min-overlap F] [--filter TEXT]
+//
+// The corpus is generated on the fly: tones, chirps, noise, synthetic music
+// and mixes, each run through a different WAV format, rate and channel count.
+// `record` writes DIR/<case>.sig holding the URI of every case. `check`
+// regenerates them and, for every case whose URI differs, reports the first
+// peak that diverges from the golden one, band by band. With --tolerance,
+// meant for intentionally approximate engines, it instead measures how many
+// peaks still match within one FFT pass and one bin, and fails the cases
+// whose overlap falls under --min-overlap (0.9 by default).
+//
+// Exit status: 0 if every case passes, 1 otherwise.
+
+#include "algorithm/signature.h"
+#include "synthetic_audio.h"
+#include "vibra.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr double DEFAULT_MIN_OVERLAP = 0.9;
+// Peaks within this many passes and 1/64 bins count as the same peak
+constexpr std::uint32_t PASS_SLACK = 1;
+constexpr std::uint32_t BIN_SLACK = 64;
+
+struct Signal
+{
+    const char *name;
+    std::function<std::vector<double>(std::uint32_t rate, double seconds)> generate;
+};
+
+struct Format
+{
+    const char *name;
+    SampleFormat format;
+    std::uint32_t width;
+    std::uint32_t channels;
+    std::uint32_t rate;
+};
+
+const Format FORMATS[] = {
+    {"s16x1_16000", SampleFormat::SIGNED_INTEGER, 2, 1, 16000},
+    {"s16x2_44100", SampleFormat::SIGNED_INTEGER, 2, 2, 44100},
+    {"s16x2_48000", SampleFormat::SIGNED_INTEGER, 2, 2, 48000},
+    {"s16x1_11025", SampleFormat::SIGNED_INTEGER, 2, 1, 11025},
+    {"u8x1_8000", SampleFormat::UNSIGNED_INTEGER, 1, 1, 8000},
+    {"s24x2_96000", SampleFormat::SIGNED_INTEGER, 3, 2, 96000},
+    {"s32x1_22050", SampleFormat::SIGNED_INTEGER, 4, 1, 22050},
+    {"f32x2_48000", SampleFormat::FLOAT, 4, 2, 48000},
+    {"f32x6_44100", SampleFormat::FLOAT, 4, 6, 44100},
+    {"f64x1_32000", SampleFormat::FLOAT, 8, 1, 32000},
+};
+
+std::vector<Signal> signals()
+{
+    return {
+        {"tone440", [](std::uint32_t rate, double seconds)
+         { return synthetic::Tone(rate, seconds, 440.0); }},
+        {"tone3000", [](std::uint32_t rate, double seconds)
+         { return synthetic::Tone(rate, seconds, 3000.0); }},
+        {"chirp", [](std::uint32_t rate, double seconds)
+         { return synthetic::Chirp(rate, seconds, 100.0, 3900.0); }},
+        {"noise", [](std::uint32_t rate, double seconds)
+         { return synthetic::Noise(rate, seconds, 7); }},
+        {"music", [](std::uint32_t rate, double seconds)
+         { return synthetic::Music(rate, seconds, 11); }},
+        {"music_noise", [](std::uint32_t rate, double seconds)
+         {
+             return synthetic::Mix(synthetic::Music(rate, seconds, 23), 0.8,
+                                   synthetic::Noise(rate, seconds, 29), 0.1);
+         }},
+    };
+}
+
+struct Case
+{
+    std::string name;
+    std::vector<char> wav;
+};
+
+// Durations cycle through 4, 8 and 12 s so signatures of every length the
+// fingerprint functions produce are covered
+template <typename Visit> void forEachCase(const std::string &filter, Visit visit)
+{
+    const std::vector<Signal> all_signals = signals();
+    std::size_t index = 0;
+    for (const auto &signal : all_signals)
+    {
+        for (const auto &format : FORMATS)
+        {
+            const double seconds = 4.0 * (1 + index++ % 3);
+            const std::string name = std::string(signal.name) + "-" + format.name;
+            if (name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+            const std::vector<char> pcm =
+                synthetic::EncodePcm(signal.generate(format.rate, seconds), format.format,
+                                     format.width, format.channels);
+            visit(Case{name, synthetic::WrapWav(pcm, format.format, format.rate, format.width,
+                                                format.channels)});
+        }
+    }
+}
+
+std::string fingerprint(const Case &item)
+{
+    Fingerprint *fingerprint =
+        vibra_get_fingerprint_from_wav_data(item.wav.data(), static_cast<int>(item.wav.size()));
+    if (fingerprint == nullptr)
+    {
+        throw std::runtime_error("Fingerprinting " + item.name + " failed");
+    }
+    std::string uri = vibra_get_uri_from_fingerprint(fingerprint);
+    vibra_free_fingerprint(fingerprint);
+    return uri;
+}
+
+std::string goldenPath(const std::string &directory, const std::string &name)
+{
+    return directory + "/" + name + ".sig";
+}
+
+const char *bandName(FrequencyBand band)
+{
+    switch (band)
+    {
+    case FrequencyBand::_0_150:
+        return "0-150 Hz";
+    case FrequencyBand::_250_520:
+        return "250-520 Hz";
+    case FrequencyBand::_520_1450:
+        return "520-1450 Hz";
+    case FrequencyBand::_1450_3500:
+        return "1450-3500 Hz";
+    case FrequencyBand::_3500_5500:
+        return "3500-5500 Hz";
+    }
+    return "unknown band";
+}
+
+std::string describe(const FrequencyPeak &peak)
+{
+    char text[96];
+    std::snprintf(text, sizeof(text), "pass %u magnitude %u bin %u", peak.fft_pass_number(),
+                  peak.peak_magnitude(), peak.corrected_peak_frequency_bin());
+    return text;
+}
+
+bool samePeak(const FrequencyPeak &a, const FrequencyPeak &b)
+{
+    return a.fft_pass_number() == b.fft_pass_number() &&
+           a.peak_magnitude() == b.peak_magnitude() &&
+           a.corrected_peak_frequency_bin() == b.corrected_peak_frequency_bin();
+}
+
+const std::vector<FrequencyPeak> &bandPeaks(const Signature &signature, FrequencyBand band)
+{
+    static const std::vector<FrequencyPeak> kNone;
+    const auto found = signature.frequency_band_to_peaks().find(band);
+    return found == signature.frequency_band_to_peaks().end() ? kNone : found->second;
+}
+
+const FrequencyBand BANDS[] = {FrequencyBand::_0_150, FrequencyBand::_250_520,
+                               FrequencyBand::_520_1450, FrequencyBand::_1450_3500,
+                               FrequencyBand::_3500_5500};
+
+// Where two signatures first differ, for URIs that are not identical
+std::string firstDivergence(const Signature &golden, const Signature &actual)
+{
+    if (golden.sample_rate() != actual.sample_rate() ||
+        golden.num_samples() != actual.num_samples())
+    {
+        char text[128];
+        std::snprintf(text, sizeof(text), "header: expected %u samples at %u Hz, got %u at %u Hz",
+                      golden.num_samples(), golden.sample_rate(), actual.num_samples(),
+                      actual.sample_rate());
+        return text;
+    }
+    for (FrequencyBand band : BANDS)
+    {
+        const std::vector<FrequencyPeak> &expected = bandPeaks(golden, band);
+        const std::vector<FrequencyPeak> &got = bandPeaks(actual, band);
+        for (std::size_t i = 0; i < std::max(expected.size(), got.size()); ++i)
+        {
+            if (i < expected.size() && i < got.size() && samePeak(expected[i], got[i]))
+            {
+                continue;
+            }
+            const std::string position =
+                std::string(bandName(band)) + " peak " + std::to_string(i) + ": ";
+            if (i >= got.size())
+            {
+                return position + "expected " + describe(expected[i]) + ", got no more peaks";
+            }
+            if (i >= expected.size())
+            {
+                return position + "expected no more peaks, got " + describe(got[i]);
+            }
+            return position + "expected " + describe(expected[i]) + ", got " + describe(got[i]);
+        }
+    }
+    return "same peaks, different encoding";
+}
+
+// Matched peaks over the peaks of the larger signature, greedily pairing
+// each golden peak with the first unpaired one close enough
+double peakOverlap(const Signature &golden, const Signature &actual)
+{
+    std::size_t matched = 0;
+    std::size_t golden_count = 0;
+    std::size_t actual_count = 0;
+    for (FrequencyBand band : BANDS)
+    {
+        const std::vector<FrequencyPeak> &expected = bandPeaks(golden, band);
+        const std::vector<FrequencyPeak> &got = bandPeaks(actual, band);
+        golden_count += expected.size();
+        actual_count += got.size();
+        std::vector<bool> paired(got.size(), false);
+        std::size_t window = 0; // first peak of `got` that may still match
+        for (const auto &peak : expected)
+        {
+            while (window < got.size() &&
+                   got[window].fft_pass_number() + PASS_SLACK < peak.fft_pass_number())
+            {
+                ++window;
+            }
+            for (std::size_t i = window;
+                 i < got.size() && got[i].fft_pass_number() <= peak.fft_pass_number() + PASS_SLACK;
+                 ++i)
+            {
+                const std::uint32_t a = got[i].corrected_peak_frequency_bin();
+                const std::uint32_t b = peak.corrected_peak_frequency_bin();
+                if (!paired[i] && (a > b ? a - b : b - a) <= BIN_SLACK)
+                {
+                    paired[i] = true;
+                    ++matched;
+                    break;
+                }
+            }
+        }
+    }
+    const std::size_t larger = std::max(golden_count, actual_count);
+    return larger == 0 ? 1.0 : static_cast<double>(matched) / larger;
+}
+
+std::string readFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        throw std::runtime_error("Cannot read " + path);
+    }
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string &path, const std::string &data)
+{
+    std::ofstream out(path, std::ios::binary);
+    out << data;
+    if (!out)
+    {
+        throw std::runtime_error("Cannot write " + path);
+    }
+}
+
+int usage(const char *program)
+{
+    std::fprintf(stderr,
+                 "usage: %s record DIR [--filter TEXT]\n"
+                 "       %s check DIR [--tolerance] [--min-overlap F] [--filter TEXT]\n",
+                 program, program);
+    return 1;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        return usage(argv[0]);
+    }
+    const std::string command = argv[1];
+    const std::string directory = argv[2];
+    bool tolerance = false;
+    double min_overlap = DEFAULT_MIN_OVERLAP;
+    std::string filter;
+    for (int i = 3; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--tolerance")
+        {
+            tolerance = true;
+        }
+        else if (arg == "--min-overlap" && i + 1 < argc)
+        {
+            min_overlap = std::atof(argv[++i]);
+        }
+        else if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+    if (command != "record" && command != "check")
+    {
+        return usage(argv[0]);
+    }
+
+    int cases = 0;
+    int failures = 0;
+    try
+    {
+        forEachCase(filter, [&](const Case &item) {
+            ++cases;
+            const std::string uri = fingerprint(item);
+            const std::string path = goldenPath(directory, item.name);
+            if (command == "record")
+            {
+                writeFile(path, uri + "\n");
+                return;
+            }
+
+            std::string golden_uri = readFile(path);
+            golden_uri.erase(golden_uri.find_last_not_of("\r\n") + 1);
+            if (!tolerance && golden_uri == uri)
+            {
+                return;
+            }
+            const Signature golden = Signature::DecodeBase64(golden_uri.data(), golden_uri.size());
+            const Signature actual = Signature::DecodeBase64(uri.data(), uri.size());
+            if (tolerance)
+            {
+                const double overlap = peakOverlap(golden, actual);
+                const bool failed = overlap < min_overlap;
+                failures += failed ? 1 : 0;
+                std::printf("%-28s overlap %.3f%s\n", item.name.c_str(), overlap,
+                            failed ? "  FAIL" : "");
+                return;
+            }
+            ++failures;
+            std::printf("%-28s %s\n", item.name.c_str(), firstDivergence(golden, actual).c_str());
+        });
+    }
+    catch (const std::exception &e)
+    {
+        std::fprintf(stderr, "%s\n", e.what());
+        return 1;
+    }
+
+    if (command == "record")
+    {
+        std::printf("recorded %d cases in %s\n", cases, directory.c_str());
+        return 0;
+    }
+    std::printf("%d of %d cases %s\n", cases - failures, cases,
+                tolerance ? "within tolerance" : "bit-exact");
+    return failures == 0 ? 0 : 1;
+}
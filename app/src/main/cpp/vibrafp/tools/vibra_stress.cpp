@@ -0,0 +1,326 @@
+// Concurrent fingerprinting through the C API, to check that the library is
+// reentrant and to measure how its throughput scales with threads.
+//
+//   vibra_stress [--threads N] [--seconds S] [--clips C]
+//
+// C synthetic clips, 8 by default, go through the four entry points in turn,
+// each with its own format: signed PCM, float PCM, WAV data and a session
+// driven in steps. First N threads, the hardware threads by default, make
+// the first calls of the process all at once, then each clip is
+// fingerprinted on the main thread as the reference. Then for 1, 2, 4, ...
+// and N threads, every thread fingerprints the clips round robin for S
+// seconds, 2 by default, and compares each URI with the reference.
+//
+// Configured with -DVIBRA_SANITIZE=thread this is the data race check of the
+// library; the throughput numbers of such a build mean nothing.
+//
+// Exit status: 0 if every call gave the reference URI, 1 otherwise.
+
+#include "synthetic_audio.h"
+#include "vibra.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr double CLIP_SECONDS = 10.0;
+constexpr int SESSION_STEP_FRAMES = 4096;
+// Mismatches reported one by one, the rest are only counted
+constexpr std::uint64_t MAX_REPORTED_MISMATCHES = 10;
+
+enum class EntryPoint
+{
+    SIGNED_PCM,
+    FLOAT_PCM,
+    WAV_DATA,
+    SESSION,
+};
+
+struct ClipFormat
+{
+    EntryPoint entry_point;
+    const char *name;
+    SampleFormat sample_format;
+    std::uint32_t rate;
+    std::uint32_t width; // bytes
+    std::uint32_t channels;
+};
+
+const ClipFormat CLIP_FORMATS[] = {
+    {EntryPoint::SIGNED_PCM, "signed_pcm s16x2@44100", SampleFormat::SIGNED_INTEGER, 44100, 2, 2},
+    {EntryPoint::FLOAT_PCM, "float_pcm f32x2@48000", SampleFormat::FLOAT, 48000, 4, 2},
+    {EntryPoint::WAV_DATA, "wav_data s24x1@22050", SampleFormat::SIGNED_INTEGER, 22050, 3, 1},
+    {EntryPoint::SESSION, "session s16x1@16000", SampleFormat::SIGNED_INTEGER, 16000, 2, 1},
+};
+
+struct Clip
+{
+    const ClipFormat *format;
+    std::vector<char> data;
+    std::string uri; // the reference
+};
+
+struct Options
+{
+    unsigned int threads = 0; // hardware threads
+    double seconds = 2.0;
+    unsigned int clips = 8;
+};
+
+struct Round
+{
+    unsigned int threads;
+    std::uint64_t calls;
+    std::uint64_t mismatches;
+    double seconds;
+};
+
+Clip makeClip(unsigned int index)
+{
+    Clip clip;
+    clip.format = &CLIP_FORMATS[index % (sizeof(CLIP_FORMATS) / sizeof(CLIP_FORMATS[0]))];
+    const ClipFormat &format = *clip.format;
+    clip.data = synthetic::EncodePcm(synthetic::Music(format.rate, CLIP_SECONDS, index + 1),
+                                     format.sample_format, format.width, format.channels);
+    if (format.entry_point == EntryPoint::WAV_DATA)
+    {
+        clip.data = synthetic::WrapWav(clip.data, format.sample_format, format.rate,
+                                       format.width, format.channels);
+    }
+    return clip;
+}
+
+Fingerprint *fingerprintSession(const Clip &clip)
+{
+    const ClipFormat &format = *clip.format;
+    VibraSession *session = vibra_session_create(
+        clip.data.data(), static_cast<int>(clip.data.size()), static_cast<int>(format.rate),
+        static_cast<int>(format.width * 8), static_cast<int>(format.channels),
+        format.sample_format == SampleFormat::FLOAT);
+    if (session == nullptr)
+    {
+        return nullptr;
+    }
+    int status;
+    while ((status = vibra_session_step(session, SESSION_STEP_FRAMES)) == VIBRA_STATUS_PENDING)
+    {
+    }
+    Fingerprint *fingerprint =
+        status == VIBRA_STATUS_DONE ? vibra_session_get_fingerprint(session) : nullptr;
+    vibra_session_free(session);
+    return fingerprint;
+}
+
+// The URI of the clip, or an empty string if the call failed
+std::string fingerprintUri(const Clip &clip)
+{
+    const ClipFormat &format = *clip.format;
+    const int size = static_cast<int>(clip.data.size());
+    const int rate = static_cast<int>(format.rate);
+    const int bits = static_cast<int>(format.width * 8);
+    const int channels = static_cast<int>(format.channels);
+    Fingerprint *fingerprint = nullptr;
+    try
+    {
+        switch (format.entry_point)
+        {
+        case EntryPoint::SIGNED_PCM:
+            fingerprint = vibra_get_fingerprint_from_signed_pcm(clip.data.data(), size, rate,
+                                                                bits, channels);
+            break;
+        case EntryPoint::FLOAT_PCM:
+            fingerprint = vibra_get_fingerprint_from_float_pcm(clip.data.data(), size, rate,
+                                                               bits, channels);
+            break;
+        case EntryPoint::WAV_DATA:
+            fingerprint = vibra_get_fingerprint_from_wav_data(clip.data.data(), size);
+            break;
+        case EntryPoint::SESSION:
+            fingerprint = fingerprintSession(clip);
+            break;
+        }
+    }
+    catch (const std::exception &)
+    {
+        return std::string();
+    }
+    if (fingerprint == nullptr)
+    {
+        return std::string();
+    }
+    std::string uri = vibra_get_uri_from_fingerprint(fingerprint);
+    vibra_free_fingerprint(fingerprint);
+    return uri;
+}
+
+Round runRound(const std::vector<Clip> &clips, unsigned int threads, double seconds)
+{
+    std::atomic<std::uint64_t> calls(0);
+    std::atomic<std::uint64_t> mismatches(0);
+    const Clock::time_point start = Clock::now();
+    const Clock::time_point deadline =
+        start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+
+    auto work = [&](unsigned int thread) {
+        // Threads start on different clips so that every entry point runs at once
+        for (std::size_t i = thread; Clock::now() < deadline; i += threads)
+        {
+            const Clip &clip = clips[i % clips.size()];
+            if (fingerprintUri(clip) != clip.uri &&
+                mismatches.fetch_add(1) < MAX_REPORTED_MISMATCHES)
+            {
+                std::fprintf(stderr, "thread %u: clip %zu (%s) differs from its reference\n",
+                             thread, i % clips.size(), clip.format->name);
+            }
+            calls.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned int thread = 1; thread < threads; ++thread)
+    {
+        workers.emplace_back(work, thread);
+    }
+    work(0);
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+
+    Round round;
+    round.threads = threads;
+    round.calls = calls.load();
+    round.mismatches = mismatches.load();
+    round.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    return round;
+}
+
+// The first calls on a cold library, which plan the FFT, all at once
+std::vector<std::string> runColdStart(const std::vector<Clip> &clips, unsigned int threads)
+{
+    std::vector<std::string> uris(threads);
+    std::atomic<unsigned int> waiting(threads);
+    auto work = [&](unsigned int thread) {
+        waiting.fetch_sub(1);
+        while (waiting.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        uris[thread] = fingerprintUri(clips[thread % clips.size()]);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned int thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back(work, thread);
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+    return uris;
+}
+
+bool parseOptions(int argc, char **argv, Options *options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (arg == "--threads" && has_value)
+        {
+            options->threads = static_cast<unsigned int>(std::atoi(argv[++i]));
+        }
+        else if (arg == "--seconds" && has_value)
+        {
+            options->seconds = std::atof(argv[++i]);
+        }
+        else if (arg == "--clips" && has_value)
+        {
+            options->clips = static_cast<unsigned int>(std::atoi(argv[++i]));
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return options->seconds > 0.0 && options->clips > 0;
+}
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if (!parseOptions(argc, argv, &options))
+    {
+        std::fprintf(stderr, "usage: %s [--threads N] [--seconds S] [--clips C]\n", argv[0]);
+        return 1;
+    }
+    if (options.threads == 0)
+    {
+        options.threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::vector<Clip> clips;
+    for (unsigned int i = 0; i < options.clips; ++i)
+    {
+        clips.push_back(makeClip(i));
+    }
+    const std::vector<std::string> cold_uris = runColdStart(clips, options.threads);
+    for (std::size_t i = 0; i < clips.size(); ++i)
+    {
+        clips[i].uri = fingerprintUri(clips[i]);
+        if (clips[i].uri.empty())
+        {
+            std::fprintf(stderr, "Cannot fingerprint clip %zu (%s)\n", i, clips[i].format->name);
+            return 1;
+        }
+    }
+    std::uint64_t mismatches = 0;
+    for (unsigned int thread = 0; thread < options.threads; ++thread)
+    {
+        if (cold_uris[thread] != clips[thread % clips.size()].uri)
+        {
+            std::fprintf(stderr, "cold start thread %u: clip %zu differs from its reference\n",
+                         thread, thread % clips.size());
+            ++mismatches;
+        }
+    }
+
+    std::vector<unsigned int> thread_counts;
+    for (unsigned int threads = 1; threads < options.threads; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(options.threads);
+
+    std::printf("%zu clips of %.0f s, %u hardware threads, CPU features: %s\n", clips.size(),
+                CLIP_SECONDS, std::thread::hardware_concurrency(), vibra_get_cpu_features());
+    std::printf("%7s %8s %9s %11s %8s %10s %10s\n", "threads", "calls", "calls/s", "x realtime",
+                "speedup", "efficiency", "mismatches");
+    double single_rate = 0.0;
+    for (unsigned int threads : thread_counts)
+    {
+        const Round round = runRound(clips, threads, options.seconds);
+        const double rate = round.calls / round.seconds;
+        if (threads == 1)
+        {
+            single_rate = rate;
+        }
+        const double speedup = rate / single_rate;
+        std::printf("%7u %8llu %9.2f %10.1fx %7.2fx %9.0f%% %10llu\n", threads,
+                    static_cast<unsigned long long>(round.calls), rate, rate * CLIP_SECONDS,
+                    speedup, 100.0 * speedup / threads,
+                    static_cast<unsigned long long>(round.mismatches));
+        mismatches += round.mismatches;
+    }
+    return mismatches == 0 ? 0 : 1;
+}
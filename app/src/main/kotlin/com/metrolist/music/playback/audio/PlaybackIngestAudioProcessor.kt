@@ -0,0 +1,130 @@
+/**
+ * Metrolist Project (C) 2026
+ * Licensed under GPL-3.0 | See git history for contributors
+ */
+
+package com.metrolist.music.playback.audio
+
+import androidx.media3.common.C
+import androidx.media3.common.audio.AudioProcessor
+import androidx.media3.common.util.UnstableApi
+import com.metrolist.music.models.MediaMetadata
+import com.metrolist.music.recognition.PlaybackIndex
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
+
+/**
+ * PCM pass-through processor that fingerprints the decoded audio of the item in
+ * [PlaybackIndex.nowPlaying] into the [PlaybackIndex], a bounded amount of work per buffer.
+ * The audio is attributed to whatever item is current when it reaches the processor.
+ */
+@UnstableApi
+@Suppress("DEPRECATION")
+class PlaybackIngestAudioProcessor : AudioProcessor {
+
+    private var sampleRate = 0
+    private var channelCount = 0
+    private var encoding = C.ENCODING_INVALID
+
+    private var outputBuffer: ByteBuffer = EMPTY_BUFFER
+    private var inputEnded = false
+
+    // Item whose audio is coming in, and whether it is being fingerprinted
+    private var track: MediaMetadata? = null
+    private var ingesting = false
+
+    private var samples = ByteArray(0)
+
+    override fun configure(inputAudioFormat: AudioProcessor.AudioFormat): AudioProcessor.AudioFormat {
+        if (inputAudioFormat.sampleRate != sampleRate || inputAudioFormat.channelCount != channelCount) {
+            endTrack()
+        }
+        sampleRate = inputAudioFormat.sampleRate
+        channelCount = inputAudioFormat.channelCount
+        encoding = inputAudioFormat.encoding
+        return inputAudioFormat
+    }
+
+    override fun isActive(): Boolean = encoding == C.ENCODING_PCM_16BIT
+
+    override fun queueInput(inputBuffer: ByteBuffer) {
+        if (!inputBuffer.hasRemaining()) {
+            outputBuffer = EMPTY_BUFFER
+            return
+        }
+
+        ingest(inputBuffer)
+
+        val out = replaceOutputBuffer(inputBuffer.remaining())
+        out.put(inputBuffer)
+        out.flip()
+    }
+
+    private fun ingest(inputBuffer: ByteBuffer) {
+        val playing = PlaybackIndex.nowPlaying
+        if (playing?.id != track?.id) {
+            endTrack()
+            track = playing
+            ingesting = playing != null && PlaybackIndex.beginTrack(playing, sampleRate, channelCount)
+        }
+        if (!ingesting) return
+
+        val size = inputBuffer.remaining()
+        if (samples.size < size) {
+            samples = ByteArray(size)
+        }
+        // Read through a duplicate so the buffer position is left for the pass-through
+        inputBuffer.duplicate().get(samples, 0, size)
+        ingesting = PlaybackIndex.feed(samples, size)
+    }
+
+    private fun endTrack() {
+        if (ingesting) {
+            PlaybackIndex.endTrack()
+        }
+        track = null
+        ingesting = false
+    }
+
+    override fun queueEndOfStream() {
+        inputEnded = true
+        endTrack()
+    }
+
+    override fun getOutput(): ByteBuffer {
+        val output = outputBuffer
+        outputBuffer = EMPTY_BUFFER
+        return output
+    }
+
+    override fun isEnded(): Boolean = inputEnded && outputBuffer === EMPTY_BUFFER
+
+    // A seek keeps the track: its landmarks still line up within each stretch played
+    @Deprecated("Deprecated in AudioProcessor")
+    override fun flush() {
+        outputBuffer = EMPTY_BUFFER
+        inputEnded = false
+    }
+
+    @Deprecated("Deprecated in AudioProcessor")
+    override fun reset() {
+        flush()
+        endTrack()
+        sampleRate = 0
+        channelCount = 0
+        encoding = C.ENCODING_INVALID
+    }
+
+    private fun replaceOutputBuffer(size: Int): ByteBuffer {
+        if (outputBuffer.capacity() < size) {
+            outputBuffer = ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder())
+        } else {
+            outputBuffer.clear()
+        }
+        return outputBuffer
+    }
+
+    companion object {
+        private val EMPTY_BUFFER: ByteBuffer = ByteBuffer.allocateDirect(0).order(ByteOrder.nativeOrder())
+    }
+}
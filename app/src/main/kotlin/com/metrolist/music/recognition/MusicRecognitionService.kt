@@ -16,7 +16,10 @@ import android.content.pm.PackageManager
 import android.media.AudioFormat
 import android.media.AudioRecord
 import android.media.MediaRecorder
+import android.os.Build
+import android.os.Trace
 import androidx.core.content.ContextCompat
+import com.metrolist.music.BuildConfig
 import com.metrolist.shazamkit.Shazam
 import com.metrolist.shazamkit.models.RecognitionResult
 import com.metrolist.shazamkit.models.RecognitionStatus
@@ -26,8 +29,10 @@ import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.asStateFlow
 import kotlinx.coroutines.isActive
 import kotlinx.coroutines.withContext
-import java.io.ByteArrayOutputStream
+import timber.log.Timber
 import java.nio.ByteOrder
+import java.util.concurrent.atomic.AtomicInteger
+import kotlin.coroutines.cancellation.CancellationException
 
 /**
  * Service for recognizing music using audio fingerprinting.
@@ -39,12 +44,17 @@ object MusicRecognitionService {
     // Recording parameters
     private const val RECORDING_SAMPLE_RATE = 44100
     private const val CHANNEL_CONFIG = AudioFormat.CHANNEL_IN_MONO
+    private const val RECORDING_CHANNEL_COUNT = 1
     private const val AUDIO_FORMAT = AudioFormat.ENCODING_PCM_16BIT
     // Recording duration: 10 seconds for better recognition accuracy
     // Original MusicRecognizer uses: 3s -> 6s -> 9s -> 10s fallback
     // We use 10s directly to match the fallback duration for maximum compatibility
     private const val RECORDING_DURATION_MS = 10000L
+    private const val FINGERPRINT_TIMEOUT_MS = 5000
     
+    // Cookies of the async trace sections, which may end on another thread
+    private val traceCookie = AtomicInteger()
+
     private val _recognitionStatus = MutableStateFlow<RecognitionStatus>(RecognitionStatus.Ready)
     val recognitionStatus: StateFlow<RecognitionStatus> = _recognitionStatus.asStateFlow()
     
@@ -66,54 +76,72 @@ object MusicRecognitionService {
         }
         
         _recognitionStatus.value = RecognitionStatus.Listening
+        VibraSignature.statsEnabled = BuildConfig.DEBUG
         
         try {
             // Step 1: Record audio
-            val audioData = recordAudio()
+            val audioData = traceSection("recognition: recording") { recordAudio() }
             
             _recognitionStatus.value = RecognitionStatus.Processing
             
-            // Step 2: Convert to mono if needed and resample to 16kHz
-            val decodedAudio = DecodedAudio(
-                data = audioData,
-                channelCount = 1,
-                sampleRate = RECORDING_SAMPLE_RATE,
-                pcmEncoding = AUDIO_FORMAT
-            )
-            
-            val resampledAudio = AudioResampler.resample(
-                decodedAudio, 
-                VibraSignature.REQUIRED_SAMPLE_RATE
-            ).getOrElse { error ->
-                _recognitionStatus.value = RecognitionStatus.Error("Failed to resample audio: ${error.message}")
-                return@withContext _recognitionStatus.value
-            }
-            
-            // Verify format
+            // Step 2: Verify format
             require(
-                resampledAudio.channelCount == 1 &&
-                resampledAudio.sampleRate == VibraSignature.REQUIRED_SAMPLE_RATE &&
-                resampledAudio.pcmEncoding == AudioFormat.ENCODING_PCM_16BIT &&
                 ByteOrder.nativeOrder() == ByteOrder.LITTLE_ENDIAN &&
-                resampledAudio.data.isNotEmpty() && 
-                resampledAudio.data.size % 2 == 0
+                audioData.isNotEmpty() &&
+                audioData.size % 2 == 0
             ) { "Invalid audio format for fingerprint generation" }
             
-            // Step 3: Generate fingerprint using native library
+            // Step 3: Generate fingerprint using native library, which resamples to 16kHz itself
+            // Its stats are logged next to the network latency in debug builds
+            var nativeStats: VibraSignature.NativeStats? = null
             val signature = try {
-                VibraSignature.fromI16(resampledAudio.data)
+                traceSection("recognition: fingerprint") {
+                    VibraSignature.fromPcm16Cancellable(
+                        audioData,
+                        RECORDING_SAMPLE_RATE,
+                        RECORDING_CHANNEL_COUNT,
+                        FINGERPRINT_TIMEOUT_MS,
+                        onStats = if (BuildConfig.DEBUG) { stats -> nativeStats = stats } else null,
+                    )
+                }
+            } catch (e: CancellationException) {
+                throw e
             } catch (e: Exception) {
                 _recognitionStatus.value = RecognitionStatus.Error("Failed to generate fingerprint: ${e.message}")
                 return@withContext _recognitionStatus.value
             }
             
-            // Step 4: Send to Shazam API
-            val sampleDurationMs = (resampledAudio.data.size / 2) * 1000L / VibraSignature.REQUIRED_SAMPLE_RATE
+            // Step 4: Tracks played by the app are recognized from the on-device index
+            PlaybackIndex.load(context)
+            PlaybackIndex.recognize(signature)?.let { played ->
+                _recognitionStatus.value = RecognitionStatus.Success(played)
+                return@withContext _recognitionStatus.value
+            }
+            
+            // Step 5: Serve a recent recognition of the same audio without a network query
+            RecognitionCache.get(signature)?.let { cached ->
+                _recognitionStatus.value = RecognitionStatus.Success(cached)
+                return@withContext _recognitionStatus.value
+            }
+            
+            // Step 6: Send to Shazam API
+            val sampleDurationMs = (audioData.size / 2 / RECORDING_CHANNEL_COUNT) * 1000L / RECORDING_SAMPLE_RATE
             
-            val result = Shazam.recognize(signature, sampleDurationMs)
+            val requestStart = System.nanoTime()
+            val result = traceSection("recognition: Shazam request") {
+                Shazam.recognize(signature, sampleDurationMs)
+            }
+            if (BuildConfig.DEBUG) {
+                Timber.d(
+                    "Fingerprint %s, Shazam request %d ms",
+                    nativeStats,
+                    (System.nanoTime() - requestStart) / 1_000_000,
+                )
+            }
             
             result.fold(
                 onSuccess = { recognitionResult ->
+                    RecognitionCache.put(signature, recognitionResult)
                     _recognitionStatus.value = RecognitionStatus.Success(recognitionResult)
                 },
                 onFailure = { error ->
@@ -127,12 +155,29 @@ object MusicRecognitionService {
             )
             
             _recognitionStatus.value
+        } catch (e: CancellationException) {
+            _recognitionStatus.value = RecognitionStatus.Ready
+            throw e
         } catch (e: Exception) {
             _recognitionStatus.value = RecognitionStatus.Error(e.message ?: "Recognition failed")
             _recognitionStatus.value
         }
     }
     
+    /**
+     * Runs [block] in an async trace section, shown in Perfetto next to the native
+     * fingerprinting sections of debug builds. Sections need Android 10.
+     */
+    private inline fun <T> traceSection(name: String, block: () -> T): T {
+        val cookie = traceCookie.incrementAndGet()
+        if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q) Trace.beginAsyncSection(name, cookie)
+        try {
+            return block()
+        } finally {
+            if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q) Trace.endAsyncSection(name, cookie)
+        }
+    }
+
     @SuppressLint("MissingPermission")
     private suspend fun recordAudio(): ByteArray = withContext(Dispatchers.IO) {
         val bufferSize = AudioRecord.getMinBufferSize(
@@ -149,25 +194,30 @@ object MusicRecognitionService {
             bufferSize
         )
         
-        val outputStream = ByteArrayOutputStream()
-        val buffer = ByteArray(bufferSize)
-        val startTime = System.currentTimeMillis()
+        // 16-bit samples, recorded straight into the buffer handed to the native library
+        val audioData = ByteArray(
+            (RECORDING_SAMPLE_RATE * RECORDING_DURATION_MS / 1000).toInt() * 2 * RECORDING_CHANNEL_COUNT
+        )
+        var bytesRecorded = 0
         
         try {
             audioRecord.startRecording()
             
-            while (System.currentTimeMillis() - startTime < RECORDING_DURATION_MS && isActive) {
-                val bytesRead = audioRecord.read(buffer, 0, bufferSize)
-                if (bytesRead > 0) {
-                    outputStream.write(buffer, 0, bytesRead)
-                }
+            while (bytesRecorded < audioData.size && isActive) {
+                val bytesRead = audioRecord.read(
+                    audioData,
+                    bytesRecorded,
+                    minOf(bufferSize, audioData.size - bytesRecorded)
+                )
+                if (bytesRead < 0) break
+                bytesRecorded += bytesRead
             }
         } finally {
             audioRecord.stop()
             audioRecord.release()
         }
         
-        outputStream.toByteArray()
+        if (bytesRecorded == audioData.size) audioData else audioData.copyOf(bytesRecorded)
     }
     
     fun reset() {
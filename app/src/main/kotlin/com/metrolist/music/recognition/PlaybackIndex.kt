@@ -0,0 +1,286 @@
+package com.metrolist.music.recognition
+
+import android.content.Context
+import android.os.Process
+import com.metrolist.music.models.MediaMetadata
+import com.metrolist.shazamkit.models.RecognitionResult
+import timber.log.Timber
+import java.io.File
+import java.io.IOException
+import java.util.concurrent.Executors
+
+/**
+ * On-device index of the tracks played by the app, so that recording one of them
+ * is recognized locally instead of through Shazam.
+ *
+ * The audio thread fingerprints a track while it plays (see
+ * PlaybackIngestAudioProcessor) and hands it over to a background thread when the
+ * next one starts. Track metadata is kept in a catalogue file next to the index,
+ * one tab-separated line per indexed track. A line holding only a track id reserves
+ * the ids up to it before a commit, so that an id the index has but the catalogue
+ * lacks is never handed out again. A track is indexed from its first play long
+ * enough to fingerprint.
+ *
+ * The audio thread never waits on disk: [lock] only guards the bookkeeping below and
+ * is never held across I/O, the index is opened and queried under [indexLock].
+ */
+object PlaybackIndex {
+
+    private const val DIRECTORY = "playback_index"
+    private const val CATALOGUE = "catalogue.tsv"
+
+    // Analysis time per audio buffer on the playback thread, a buffer is tens of ms of audio
+    private const val FEED_BUDGET_US = 2000
+
+    private class Track(
+        val trackId: Int,
+        val mediaId: String,
+        val title: String,
+        val artist: String,
+        val album: String?,
+        val artworkUrl: String?,
+    )
+
+    /** The item being played, set by the player and followed by the ingestion. */
+    @Volatile
+    var nowPlaying: MediaMetadata? = null
+
+    @Volatile
+    private var directory: File? = null
+
+    @Volatile
+    private var ingestor: VibraIngestor? = null
+
+    private val lock = Any()
+
+    // Indexed tracks by media id and by track id, and the media ids of the ended
+    // tracks not committed yet
+    private val tracks = HashMap<String, Track>()
+    private val tracksById = HashMap<Int, Track>()
+    private val pending = HashSet<String>()
+    private var ended = ArrayList<Track>()
+    private var nextTrackId = 0
+
+    // Indexed tracks whose catalogue line could not be written yet
+    private var uncatalogued = ArrayList<Track>()
+
+    // The track being ingested, audio thread only
+    private var ingesting: Track? = null
+
+    private val indexLock = Any()
+    private var index: VibraIndex? = null
+
+    private val committer = Executors.newSingleThreadExecutor { runnable ->
+        Thread({
+            Process.setThreadPriority(Process.THREAD_PRIORITY_BACKGROUND)
+            runnable.run()
+        }, "PlaybackIndex")
+    }
+
+    /**
+     * Loads the catalogue on the background thread, safe to call from the main thread.
+     * Nothing is fingerprinted until the load has finished.
+     */
+    fun init(context: Context) {
+        val dir = File(context.applicationContext.filesDir, DIRECTORY)
+        committer.execute { load(dir) }
+    }
+
+    /** Loads the catalogue on the calling thread, for callers off the main thread. */
+    fun load(context: Context) = load(File(context.applicationContext.filesDir, DIRECTORY))
+
+    @Synchronized
+    private fun load(dir: File) {
+        if (directory != null) return
+        try {
+            val catalogued = ArrayList<Track>()
+            var reserved = 0
+            File(dir, CATALOGUE).takeIf { it.exists() }?.forEachLine { line ->
+                val fields = line.split('\t')
+                val trackId = fields.getOrNull(0)?.toIntOrNull() ?: return@forEachLine
+                reserved = maxOf(reserved, trackId + 1)
+                if (fields.size < 6) return@forEachLine
+                catalogued += Track(
+                    trackId,
+                    fields[1],
+                    fields[2],
+                    fields[3],
+                    fields[4].ifEmpty { null },
+                    fields[5].ifEmpty { null },
+                )
+            }
+            synchronized(lock) {
+                catalogued.forEach {
+                    tracks[it.mediaId] = it
+                    tracksById[it.trackId] = it
+                }
+                nextTrackId = maxOf(nextTrackId, reserved)
+            }
+            directory = dir
+            ingestor = VibraIngestor(dir.path)
+        } catch (e: Exception) {
+            Timber.e(e, "Playback index unavailable")
+        }
+    }
+
+    /**
+     * Starts fingerprinting [metadata] from the audio thread, unless it is indexed already.
+     *
+     * @return false if nothing is to be fed for this track
+     */
+    fun beginTrack(metadata: MediaMetadata, sampleRate: Int, channelCount: Int): Boolean {
+        val ingestor = ingestor ?: return false
+        endTrack()
+        val trackId = synchronized(lock) {
+            if (tracks.containsKey(metadata.id) || metadata.id in pending) return false
+            nextTrackId++
+        }
+        val track = Track(
+            trackId,
+            metadata.id,
+            metadata.title,
+            metadata.artists.joinToString { it.name },
+            metadata.album?.title,
+            metadata.thumbnailUrl,
+        )
+        return try {
+            ingestor.beginTrack(track.trackId, sampleRate, channelCount)
+            ingesting = track
+            true
+        } catch (e: IllegalArgumentException) {
+            Timber.w(e, "Cannot fingerprint the audio format")
+            false
+        }
+    }
+
+    /**
+     * Fingerprints the first [length] bytes of [samples] of the current track, for
+     * at most about [FEED_BUDGET_US] on the calling thread.
+     *
+     * @return false once the track is no longer being fingerprinted
+     */
+    fun feed(samples: ByteArray, length: Int): Boolean {
+        val ingestor = ingestor ?: return false
+        val status = try {
+            ingestor.feed(samples, length, FEED_BUDGET_US)
+        } catch (e: RuntimeException) {
+            Timber.w(e, "Fingerprinting the played track failed")
+            ingesting = null
+            return false
+        }
+        if (status == VibraIngestor.STATUS_DROPPED) {
+            // Not catalogued either, so the track is ingested again when it is next played
+            Timber.w("Fingerprinting fell behind playback, the played track is dropped")
+            ingesting = null
+            return false
+        }
+        return true
+    }
+
+    /** Ends the current track and adds it to the index in the background. */
+    fun endTrack() {
+        val track = ingesting ?: return
+        ingesting = null
+        // Ended on both sides at once, so that every track a commit takes from [ended]
+        // was handed to the native commit too. The native end only moves the track.
+        synchronized(lock) {
+            ended.add(track)
+            pending.add(track.mediaId)
+            ingestor?.endTrack()
+        }
+        committer.execute(::commit)
+    }
+
+    /** Returns the played track [signatureUri] was recorded from, if it is indexed. */
+    fun recognize(signatureUri: String): RecognitionResult? {
+        if (synchronized(lock) { tracksById.isEmpty() }) return null
+        val dir = directory ?: return null
+        val trackId = try {
+            synchronized(indexLock) {
+                val openIndex = index ?: VibraIndex.open(dir.path).also { index = it }
+                openIndex.query(signatureUri)?.trackId
+            } ?: return null
+        } catch (e: IOException) {
+            Timber.w(e, "Playback index query failed")
+            return null
+        } catch (e: IllegalArgumentException) {
+            return null
+        }
+        return synchronized(lock) { tracksById[trackId] }?.toRecognitionResult()
+    }
+
+    private fun commit() {
+        val dir = directory ?: return
+        val ingestor = ingestor ?: return
+        val (committing, reserved) = synchronized(lock) {
+            Pair(ended.also { ended = ArrayList() }, nextTrackId - 1)
+        }
+        if (committing.isEmpty()) return
+        // Reserves the ids handed out so far before any of them reaches the index
+        try {
+            dir.mkdirs()
+            File(dir, CATALOGUE).appendText("$reserved\n")
+        } catch (e: IOException) {
+            // The native side keeps the tracks too, both are retried with the next commit
+            Timber.e(e, "Cannot write the playback catalogue")
+            synchronized(lock) { ended.addAll(0, committing) }
+            return
+        }
+        val written = try {
+            ingestor.commit().toHashSet()
+        } catch (e: IOException) {
+            Timber.e(e, "Cannot add played tracks to the index")
+            emptySet<Int>()
+        }
+        val catalogue = synchronized(lock) {
+            // Tracks that ended since [committing] was taken may have been written too
+            val indexed = (committing + ended).filter { it.trackId in written }
+            ended.removeAll { it.trackId in written }
+            // Played too briefly or lost, ingested again when next played
+            committing.forEach { if (it.trackId !in written) pending.remove(it.mediaId) }
+            indexed.forEach {
+                tracks[it.mediaId] = it
+                tracksById[it.trackId] = it
+                pending.remove(it.mediaId)
+            }
+            uncatalogued.addAll(indexed)
+            uncatalogued.also { uncatalogued = ArrayList() }
+        }
+        if (catalogue.isNotEmpty()) {
+            try {
+                File(dir, CATALOGUE).appendText(catalogue.joinToString("") { it.toLine() })
+            } catch (e: IOException) {
+                // Already indexed and recognized, the lines are retried with the next commit
+                Timber.e(e, "Cannot write the playback catalogue")
+                synchronized(lock) { uncatalogued.addAll(0, catalogue) }
+            }
+        }
+        if (written.isEmpty()) return
+        synchronized(indexLock) {
+            index?.close()
+            index = null
+        }
+    }
+
+    private fun Track.toLine() =
+        listOf(trackId.toString(), mediaId, title, artist, album.orEmpty(), artworkUrl.orEmpty())
+            .joinToString("\t") { it.replace('\t', ' ').replace('\n', ' ') } + "\n"
+
+    private fun Track.toRecognitionResult() = RecognitionResult(
+        trackId = mediaId,
+        title = title,
+        artist = artist,
+        album = album,
+        coverArtUrl = artworkUrl,
+        coverArtHqUrl = artworkUrl,
+        genre = null,
+        releaseDate = null,
+        label = null,
+        lyrics = null,
+        shazamUrl = null,
+        appleMusicUrl = null,
+        spotifyUrl = null,
+        isrc = null,
+        youtubeVideoId = mediaId,
+    )
+}
@@ -0,0 +1,78 @@
+package com.metrolist.music.recognition
+
+import com.metrolist.shazamkit.models.RecognitionResult
+
+/**
+ * Recent recognition results, looked up by audio rather than by signature string:
+ * recording the same song again within [CACHE_DURATION_MS] produces a different
+ * signature, which is matched here against the earlier one without a network query.
+ *
+ * Candidates come from a [VibraLshTable] and are only served once
+ * [VibraSignature.compare] confirms them.
+ */
+object RecognitionCache {
+
+    // Same window as the signature string cache of Shazam
+    private const val CACHE_DURATION_MS = 300000L
+
+    private const val MAX_ENTRIES = 100
+
+    // Unrelated audio scores around 0.02, recordings of the same audio 0.25 and up
+    private const val MIN_SIMILARITY = 0.2
+
+    private class Entry(
+        val signature: String,
+        val result: RecognitionResult,
+        val timestamp: Long,
+    )
+
+    private val table = VibraLshTable()
+
+    private val entries = LinkedHashMap<Long, Entry>()
+
+    private var nextId = 0L
+
+    /** Returns the result of an earlier recognition of the same audio, if any. */
+    @Synchronized
+    fun get(signature: String): RecognitionResult? {
+        evictExpired()
+        for (id in table.query(signature)) {
+            val entry = entries[id] ?: continue
+            if (VibraSignature.compare(entry.signature, signature).score >= MIN_SIMILARITY) {
+                return entry.result
+            }
+        }
+        return null
+    }
+
+    @Synchronized
+    fun put(signature: String, result: RecognitionResult) {
+        evictExpired()
+        val id = nextId++
+        if (!table.insert(id, signature)) return
+        entries[id] = Entry(signature, result, System.currentTimeMillis())
+        if (entries.size > MAX_ENTRIES) {
+            remove(entries.keys.first())
+        }
+    }
+
+    @Synchronized
+    fun clear() {
+        entries.keys.toList().forEach(::remove)
+    }
+
+    // Entries are in insertion order, so the expired ones come first
+    private fun evictExpired() {
+        val now = System.currentTimeMillis()
+        while (entries.isNotEmpty()) {
+            val (id, entry) = entries.entries.first()
+            if (now - entry.timestamp <= CACHE_DURATION_MS) break
+            remove(id)
+        }
+    }
+
+    private fun remove(id: Long) {
+        entries.remove(id)
+        table.remove(id)
+    }
+}
@@ -0,0 +1,139 @@
+package com.metrolist.music.recognition
+
+import java.io.Closeable
+import java.io.IOException
+
+/**
+ * On-device landmark index for recognizing tracks without a network round trip.
+ * Tracks are added through a [Builder] and written to a file, which [open] maps
+ * into memory. Queries take signatures produced by [VibraSignature].
+ *
+ * Queries are thread-safe; [close] must not race with them.
+ */
+class VibraIndex private constructor(private var handle: Long) : Closeable {
+
+    /**
+     * @property trackId Id the matching track was added with
+     * @property offsetMs Position of the query start within the track
+     * @property score Number of query landmarks agreeing with the track and offset
+     * @property queryLandmarks Number of landmarks extracted from the query
+     */
+    data class Match(
+        val trackId: Int,
+        val offsetMs: Int,
+        val score: Int,
+        val queryLandmarks: Int,
+    )
+
+    val trackCount: Int
+        get() = indexTrackCount(checkOpen())
+
+    /**
+     * Finds the indexed track that best matches [signatureUri].
+     *
+     * @return The match, or null if no track scored high enough
+     * @throws IllegalArgumentException if [signatureUri] is not a valid signature
+     */
+    fun query(signatureUri: String): Match? {
+        val values = indexQuery(checkOpen(), signatureUri) ?: return null
+        return Match(values[0], values[1], values[2], values[3])
+    }
+
+    override fun close() {
+        if (handle != 0L) {
+            indexFree(handle)
+            handle = 0L
+        }
+    }
+
+    private fun checkOpen(): Long {
+        check(handle != 0L) { "VibraIndex is closed" }
+        return handle
+    }
+
+    /** Collects tracks in native memory until [write] is called. */
+    class Builder : Closeable {
+        private var handle = builderCreate()
+
+        /**
+         * Fingerprints a whole decoded track.
+         *
+         * @param samples Raw PCM audio data (16-bit signed, little-endian, interleaved)
+         */
+        fun addPcm16(trackId: Int, samples: ByteArray, sampleRate: Int, channelCount: Int) =
+            builderAddPcm16(checkOpen(), trackId, samples, sampleRate, channelCount)
+
+        /** Adds a signature taken [offsetMs] into the track. */
+        fun addSignature(trackId: Int, signatureUri: String, offsetMs: Int = 0) =
+            builderAddSignature(checkOpen(), trackId, signatureUri, offsetMs)
+
+        /** Copies every track of [index], to extend an existing index file. */
+        fun addIndex(index: VibraIndex) = builderAddIndex(checkOpen(), index.checkOpen())
+
+        /** Atomically replaces [path]; indexes already open on it stay valid. */
+        @Throws(IOException::class)
+        fun write(path: String) = builderWrite(checkOpen(), path)
+
+        override fun close() {
+            if (handle != 0L) {
+                builderFree(handle)
+                handle = 0L
+            }
+        }
+
+        private fun checkOpen(): Long {
+            check(handle != 0L) { "VibraIndex.Builder is closed" }
+            return handle
+        }
+    }
+
+    companion object {
+        init {
+            System.loadLibrary("vibra_fp")
+        }
+
+        /**
+         * Maps an index file, or every segment of a [VibraIngestor] directory.
+         *
+         * @throws IOException if [path] is missing or not a valid index
+         */
+        @Throws(IOException::class)
+        fun open(path: String): VibraIndex = VibraIndex(indexOpen(path))
+
+        @JvmStatic
+        private external fun indexOpen(path: String): Long
+
+        @JvmStatic
+        private external fun indexQuery(index: Long, signatureUri: String): IntArray?
+
+        @JvmStatic
+        private external fun indexTrackCount(index: Long): Int
+
+        @JvmStatic
+        private external fun indexFree(index: Long)
+
+        @JvmStatic
+        private external fun builderCreate(): Long
+
+        @JvmStatic
+        private external fun builderAddPcm16(
+            builder: Long,
+            trackId: Int,
+            samples: ByteArray,
+            sampleRate: Int,
+            channelCount: Int,
+        )
+
+        @JvmStatic
+        private external fun builderAddSignature(builder: Long, trackId: Int, signatureUri: String, offsetMs: Int)
+
+        @JvmStatic
+        private external fun builderAddIndex(builder: Long, index: Long)
+
+        @JvmStatic
+        private external fun builderWrite(builder: Long, path: String)
+
+        @JvmStatic
+        private external fun builderFree(builder: Long)
+    }
+}
@@ -0,0 +1,89 @@
+package com.metrolist.music.recognition
+
+import java.io.Closeable
+import java.io.IOException
+
+/**
+ * Fingerprints tracks while they are played and adds them to the index directory
+ * [directory], which [VibraIndex.open] queries.
+ *
+ * [beginTrack], [feed] and [endTrack] belong on the audio thread: [feed] analyses
+ * queued audio for at most a given budget so playback never waits on it. Ended
+ * tracks are written by [commit], meant for a background thread.
+ */
+class VibraIngestor(directory: String) : Closeable {
+    private var handle = ingestorCreate(directory)
+
+    /**
+     * Starts ingesting 16-bit PCM as [trackId], ending the current track.
+     * Each id may be committed only once.
+     */
+    fun beginTrack(trackId: Int, sampleRate: Int, channelCount: Int) =
+        ingestorBeginTrack(checkOpen(), trackId, sampleRate, channelCount)
+
+    /**
+     * Queues the first [length] bytes of [samples] (16-bit signed, little-endian,
+     * interleaved) and analyses queued audio for about [budgetUs] microseconds.
+     *
+     * @return [STATUS_DONE], [STATUS_PENDING] if some audio is left queued for later
+     * calls, or [STATUS_DROPPED] if the track fell behind playback and nothing of it
+     * will be committed
+     */
+    fun feed(samples: ByteArray, length: Int, budgetUs: Int): Int =
+        ingestorFeed(checkOpen(), samples, length, budgetUs)
+
+    /** Hands the current track over to the next [commit]. */
+    fun endTrack() = ingestorEndTrack(checkOpen())
+
+    /**
+     * Finishes the ended tracks and adds them to the index directory, skipping
+     * those played too briefly. Must not run concurrently with another commit.
+     *
+     * @return The ids of the tracks added, those of the skipped tracks are never
+     * indexed
+     * @throws IOException if writing the index fails, all ended tracks are lost then
+     */
+    @Throws(IOException::class)
+    fun commit(): IntArray = ingestorCommit(checkOpen())
+
+    override fun close() {
+        if (handle != 0L) {
+            ingestorFree(handle)
+            handle = 0L
+        }
+    }
+
+    private fun checkOpen(): Long {
+        check(handle != 0L) { "VibraIngestor is closed" }
+        return handle
+    }
+
+    companion object {
+        // Status codes returned by feed, mirroring VibraStatus in vibra.h
+        const val STATUS_DONE = 0
+        const val STATUS_PENDING = 1
+        const val STATUS_DROPPED = -4
+
+        init {
+            System.loadLibrary("vibra_fp")
+        }
+
+        @JvmStatic
+        private external fun ingestorCreate(directory: String): Long
+
+        @JvmStatic
+        private external fun ingestorBeginTrack(ingestor: Long, trackId: Int, sampleRate: Int, channelCount: Int)
+
+        @JvmStatic
+        private external fun ingestorFeed(ingestor: Long, samples: ByteArray, length: Int, budgetUs: Int): Int
+
+        @JvmStatic
+        private external fun ingestorEndTrack(ingestor: Long)
+
+        @JvmStatic
+        private external fun ingestorCommit(ingestor: Long): IntArray
+
+        @JvmStatic
+        private external fun ingestorFree(ingestor: Long)
+    }
+}
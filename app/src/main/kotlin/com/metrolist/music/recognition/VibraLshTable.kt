@@ -0,0 +1,72 @@
+package com.metrolist.music.recognition
+
+import java.io.Closeable
+
+/**
+ * In-memory table of signature digests for finding near-duplicate signatures.
+ * A lookup costs a fixed number of hash probes whatever the table size. The
+ * candidates it returns are likely, not certain, to be the same audio; confirm
+ * them with [VibraSignature.compare].
+ *
+ * Not thread-safe.
+ */
+class VibraLshTable : Closeable {
+    private var handle = tableCreate()
+
+    val size: Int
+        get() = tableSize(checkOpen())
+
+    /**
+     * Adds [signatureUri] under [id], replacing any entry with that id.
+     *
+     * @return false if the signature is too short to be looked up, nothing is added then
+     * @throws IllegalArgumentException if [signatureUri] is not a valid signature
+     */
+    fun insert(id: Long, signatureUri: String): Boolean = tableInsert(checkOpen(), id, signatureUri)
+
+    /** @return false if there was no entry with [id] */
+    fun remove(id: Long): Boolean = tableRemove(checkOpen(), id)
+
+    /**
+     * Ids of the entries close to [signatureUri], the closest first.
+     *
+     * @throws IllegalArgumentException if [signatureUri] is not a valid signature
+     */
+    fun query(signatureUri: String): LongArray = tableQuery(checkOpen(), signatureUri)!!
+
+    override fun close() {
+        if (handle != 0L) {
+            tableFree(handle)
+            handle = 0L
+        }
+    }
+
+    private fun checkOpen(): Long {
+        check(handle != 0L) { "VibraLshTable is closed" }
+        return handle
+    }
+
+    companion object {
+        init {
+            System.loadLibrary("vibra_fp")
+        }
+
+        @JvmStatic
+        private external fun tableCreate(): Long
+
+        @JvmStatic
+        private external fun tableInsert(table: Long, id: Long, signatureUri: String): Boolean
+
+        @JvmStatic
+        private external fun tableRemove(table: Long, id: Long): Boolean
+
+        @JvmStatic
+        private external fun tableQuery(table: Long, signatureUri: String): LongArray?
+
+        @JvmStatic
+        private external fun tableSize(table: Long): Int
+
+        @JvmStatic
+        private external fun tableFree(table: Long)
+    }
+}
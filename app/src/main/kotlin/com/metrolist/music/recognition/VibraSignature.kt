@@ -1,5 +1,10 @@
 package com.metrolist.music.recognition
 
+import kotlinx.coroutines.currentCoroutineContext
+import kotlinx.coroutines.ensureActive
+import java.util.concurrent.TimeoutException
+import kotlin.coroutines.cancellation.CancellationException
+
 /**
  * Native library interface for generating Shazam-compatible audio fingerprints.
  * Uses the vibra_fp library which implements the Shazam signature algorithm.
@@ -12,6 +17,15 @@ object VibraSignature {
 
     const val REQUIRED_SAMPLE_RATE = 16_000
 
+    // Status codes returned by sessionStep, mirroring VibraStatus in vibra.h
+    const val STATUS_DONE = 0
+    const val STATUS_PENDING = 1
+    const val STATUS_CANCELLED = -1
+    const val STATUS_DEADLINE_EXCEEDED = -2
+
+    // About 90ms of 44.1kHz audio, a few milliseconds of native work per step
+    private const val STEP_FRAMES = 4096
+
     /**
      * Generates a Shazam signature from PCM audio data.
      * 
@@ -21,4 +35,206 @@ object VibraSignature {
      */
     @JvmStatic
     external fun fromI16(samples: ByteArray): String
+
+    /**
+     * Generates a Shazam signature from 16-bit PCM audio at any sample rate.
+     * Downmixing and anti-aliased resampling to 16kHz happen natively.
+     *
+     * @param samples Raw PCM audio data (16-bit signed, little-endian, interleaved)
+     * @param sampleRate Sample rate of [samples] in Hz
+     * @param channelCount Number of interleaved channels in [samples]
+     * @return The encoded signature string suitable for Shazam API
+     * @throws RuntimeException if signature generation fails
+     */
+    @JvmStatic
+    external fun fromPcm16(samples: ByteArray, sampleRate: Int, channelCount: Int): String
+
+    /**
+     * Cancellable variant of [fromPcm16]. The native work runs in small steps with a
+     * cancellation check in between, so a cancelled coroutine stops fingerprinting
+     * within one step instead of running the whole computation to completion.
+     * [samples] is read in place, so it must not change until this returns.
+     *
+     * @param timeoutMs Native deadline for the whole computation, 0 for none
+     * @param onStats Called with the native stats of the computation once it ends,
+     * successfully or not, if [statsEnabled]
+     * @throws CancellationException if the coroutine or the native session was cancelled
+     * @throws TimeoutException if [timeoutMs] elapsed
+     * @throws RuntimeException if signature generation fails
+     */
+    suspend fun fromPcm16Cancellable(
+        samples: ByteArray,
+        sampleRate: Int,
+        channelCount: Int,
+        timeoutMs: Int = 0,
+        onStats: ((NativeStats) -> Unit)? = null,
+    ): String {
+        val session = sessionCreate(samples, sampleRate, channelCount)
+        try {
+            if (timeoutMs > 0) sessionSetTimeout(session, timeoutMs)
+            while (true) {
+                currentCoroutineContext().ensureActive()
+                when (sessionStep(session, STEP_FRAMES)) {
+                    STATUS_PENDING -> continue
+                    STATUS_DONE -> return sessionFingerprint(session)
+                    STATUS_CANCELLED -> throw CancellationException("Fingerprint generation cancelled")
+                    STATUS_DEADLINE_EXCEEDED -> throw TimeoutException("Fingerprint generation timed out")
+                }
+            }
+        } finally {
+            if (onStats != null) sessionStats(session)?.let { onStats(NativeStats(it)) }
+            sessionFree(session)
+        }
+    }
+
+    /**
+     * Where the time and memory of a native fingerprint computation went, see
+     * [statsEnabled]. The memory figures are those of the whole process.
+     *
+     * @property totalMs Time spent in native calls, about the sum of the stages
+     * @property framesProcessed Input frames, before resampling to 16kHz
+     * @property peaksPerBand Peaks found in each band, 250-520Hz first
+     * @property heapHighWaterBytes Peak native heap growth during the computation, 0 if unknown
+     * @property maxResidentBytes High-water mark of the process resident set, 0 if unknown
+     */
+    data class NativeStats(
+        val downsampleMs: Double,
+        val fftMs: Double,
+        val spreadingMs: Double,
+        val recognitionMs: Double,
+        val encodeMs: Double,
+        val totalMs: Double,
+        val framesProcessed: Long,
+        val peaksPerBand: List<Int>,
+        val heapHighWaterBytes: Long,
+        val maxResidentBytes: Long,
+    ) {
+        internal constructor(values: DoubleArray) : this(
+            downsampleMs = values[1],
+            fftMs = values[2],
+            spreadingMs = values[3],
+            recognitionMs = values[4],
+            encodeMs = values[5],
+            totalMs = values[6],
+            framesProcessed = values[7].toLong(),
+            peaksPerBand = List(4) { values[8 + it].toInt() },
+            heapHighWaterBytes = values[12].toLong(),
+            maxResidentBytes = values[13].toLong(),
+        )
+    }
+
+    /**
+     * Collects [NativeStats] for the sessions created from now on. Off by default, when
+     * it costs nothing measurable.
+     */
+    @Volatile
+    var statsEnabled = false
+        set(value) {
+            setStatsEnabled(value)
+            field = value
+        }
+
+    /**
+     * A signature decoded by [decode]. Peak `i` is described by the `i`-th
+     * element of each array, ordered by band and then by time.
+     *
+     * @property sampleMs Duration of the audio the signature was computed from
+     * @property bands Frequency band of each peak, 0 for 250-520Hz up to 3 for 3500-5500Hz
+     * @property fftPassNumbers Position of each peak in 128-sample hops at 16kHz
+     * @property magnitudes Log-scaled peak magnitudes
+     * @property frequencyBins Interpolated FFT bins in 1/64 bin units
+     */
+    class DecodedSignature(
+        val sampleMs: Int,
+        val bands: IntArray,
+        val fftPassNumbers: IntArray,
+        val magnitudes: IntArray,
+        val frequencyBins: IntArray,
+    ) {
+        val peakCount: Int
+            get() = bands.size
+    }
+
+    /**
+     * Parses a signature URI as returned by [fromPcm16] back into its peaks.
+     *
+     * @throws IllegalArgumentException if [uri] is not a valid signature
+     */
+    fun decode(uri: String): DecodedSignature {
+        val values = decodeSignature(uri)
+        val count = (values.size - 1) / 4
+        return DecodedSignature(
+            sampleMs = values[0],
+            bands = IntArray(count) { values[1 + 4 * it] },
+            fftPassNumbers = IntArray(count) { values[2 + 4 * it] },
+            magnitudes = IntArray(count) { values[3 + 4 * it] },
+            frequencyBins = IntArray(count) { values[4 + 4 * it] },
+        )
+    }
+
+    /** Duration in milliseconds followed by four values per peak, see [decode]. */
+    @JvmStatic
+    external fun decodeSignature(uri: String): IntArray
+
+    /**
+     * @property score From 0 for unrelated audio to 1 for identical signatures
+     * @property offsetUs Start of the second signature relative to the first
+     * @property matchedPeaks Peaks that line up at [offsetUs]
+     */
+    data class Similarity(
+        val score: Double,
+        val offsetUs: Long,
+        val matchedPeaks: Int,
+    )
+
+    /**
+     * Compares two signature URIs, allowing for a time offset and small frequency
+     * jitter, so two recordings of the same audio can be recognized as such without
+     * a network query. Only the time range both signatures cover is scored.
+     *
+     * @throws IllegalArgumentException if either URI is not a valid signature
+     */
+    fun compare(a: String, b: String): Similarity {
+        val values = compareSignatures(a, b)
+        return Similarity(values[0], values[1].toLong(), values[2].toInt())
+    }
+
+    /** Score, offset in microseconds and matched peaks, see [compare]. */
+    @JvmStatic
+    external fun compareSignatures(a: String, b: String): DoubleArray
+
+    /** Creates a native session over [samples], which must stay unchanged until [sessionFree]. */
+    @JvmStatic
+    external fun sessionCreate(samples: ByteArray, sampleRate: Int, channelCount: Int): Long
+
+    /** Makes the session fail with [STATUS_DEADLINE_EXCEEDED] after [timeoutMs]. */
+    @JvmStatic
+    external fun sessionSetTimeout(session: Long, timeoutMs: Int)
+
+    /** Thread-safe, a concurrent [sessionStep] returns [STATUS_CANCELLED] shortly after. */
+    @JvmStatic
+    external fun sessionCancel(session: Long)
+
+    /**
+     * Processes at most [maxFrames] frames.
+     *
+     * @return One of the STATUS_ constants
+     * @throws RuntimeException if signature generation fails
+     */
+    @JvmStatic
+    external fun sessionStep(session: Long, maxFrames: Int): Int
+
+    /** Returns the signature of a session whose last step returned [STATUS_DONE]. */
+    @JvmStatic
+    external fun sessionFingerprint(session: Long): String
+
+    @JvmStatic
+    external fun sessionFree(session: Long)
+
+    @JvmStatic
+    external fun setStatsEnabled(enabled: Boolean)
+
+    /** The native stats fields in declaration order, null unless [statsEnabled] at creation. */
+    @JvmStatic
+    external fun sessionStats(session: Long): DoubleArray?
 }
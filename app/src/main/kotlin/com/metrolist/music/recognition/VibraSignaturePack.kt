@@ -0,0 +1,129 @@
+package com.metrolist.music.recognition
+
+import java.io.Closeable
+import java.io.IOException
+
+/**
+ * Read-only file of signature URIs stored by key, in less space than the URIs
+ * themselves. [open] maps the file and reads only its header; a signature is
+ * decoded when it is asked for. Packs are written by a [Builder].
+ *
+ * Reads are thread-safe; [close] must not race with them.
+ */
+class VibraSignaturePack private constructor(private var handle: Long) : Closeable {
+
+    val size: Int
+        get() = packSize(checkOpen())
+
+    /** Key of the signature at [index], keys are in ascending order. */
+    fun key(index: Int): Long = packKey(checkOpen(), index)
+
+    /** @return The index of the signature stored under [key], or -1 if there is none */
+    fun find(key: Long): Int = packFind(checkOpen(), key)
+
+    /**
+     * The URI of the signature at [index], the same bytes it was added as.
+     *
+     * @throws IOException if the record is corrupt
+     */
+    @Throws(IOException::class)
+    fun uri(index: Int): String = packUri(checkOpen(), index)
+
+    override fun close() {
+        if (handle != 0L) {
+            packFree(handle)
+            handle = 0L
+        }
+    }
+
+    private fun checkOpen(): Long {
+        check(handle != 0L) { "VibraSignaturePack is closed" }
+        return handle
+    }
+
+    /** Collects signatures in native memory until [write] is called. */
+    class Builder : Closeable {
+        private var handle = writerCreate()
+
+        /**
+         * Adds [signatureUri] under [key], replacing any signature with that key.
+         *
+         * @throws IllegalArgumentException unless [signatureUri] is a valid signature
+         * as encoded by [VibraSignature]
+         */
+        fun add(key: Long, signatureUri: String) = writerAdd(checkOpen(), key, signatureUri)
+
+        /** Copies every signature of [pack], to extend an existing pack file. */
+        @Throws(IOException::class)
+        fun addPack(pack: VibraSignaturePack) = writerAddPack(checkOpen(), pack.checkOpen())
+
+        /** @return true if a signature was added under [key] */
+        fun remove(key: Long): Boolean = writerRemove(checkOpen(), key)
+
+        /** Atomically replaces [path]; packs already open on it stay valid. */
+        @Throws(IOException::class)
+        fun write(path: String) = writerWrite(checkOpen(), path)
+
+        override fun close() {
+            if (handle != 0L) {
+                writerFree(handle)
+                handle = 0L
+            }
+        }
+
+        private fun checkOpen(): Long {
+            check(handle != 0L) { "VibraSignaturePack.Builder is closed" }
+            return handle
+        }
+    }
+
+    companion object {
+        init {
+            System.loadLibrary("vibra_fp")
+        }
+
+        /**
+         * Maps a pack file.
+         *
+         * @throws IOException if [path] is missing or not a valid pack
+         */
+        @Throws(IOException::class)
+        fun open(path: String): VibraSignaturePack = VibraSignaturePack(packOpen(path))
+
+        @JvmStatic
+        private external fun packOpen(path: String): Long
+
+        @JvmStatic
+        private external fun packSize(pack: Long): Int
+
+        @JvmStatic
+        private external fun packKey(pack: Long, index: Int): Long
+
+        @JvmStatic
+        private external fun packFind(pack: Long, key: Long): Int
+
+        @JvmStatic
+        private external fun packUri(pack: Long, index: Int): String
+
+        @JvmStatic
+        private external fun packFree(pack: Long)
+
+        @JvmStatic
+        private external fun writerCreate(): Long
+
+        @JvmStatic
+        private external fun writerAdd(writer: Long, key: Long, signatureUri: String)
+
+        @JvmStatic
+        private external fun writerAddPack(writer: Long, pack: Long)
+
+        @JvmStatic
+        private external fun writerRemove(writer: Long, key: Long): Boolean
+
+        @JvmStatic
+        private external fun writerWrite(writer: Long, path: String)
+
+        @JvmStatic
+        private external fun writerFree(writer: Long)
+    }
+}